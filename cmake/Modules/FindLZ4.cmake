@@ -0,0 +1,72 @@
+# GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+# This file is part of GNSS-SDR.
+#
+# SPDX-FileCopyrightText: 2026 C. Fernandez-Prades cfernandez(at)cttc.es
+# SPDX-License-Identifier: BSD-3-Clause
+
+#
+# Provides the following imported target:
+# Lz4::lz4
+#
+
+if(NOT COMMAND feature_summary)
+    include(FeatureSummary)
+endif()
+
+if(NOT PKG_CONFIG_FOUND)
+    include(FindPkgConfig)
+endif()
+
+find_package(PkgConfig)
+pkg_check_modules(PC_LZ4 "liblz4")
+
+find_path(LZ4_INCLUDE_DIRS
+    NAMES lz4.h
+    HINTS ${PC_LZ4_INCLUDE_DIR} ${CMAKE_INSTALL_PREFIX}/include
+    PATHS /usr/local/include /usr/include /opt/local/include
+)
+
+find_library(LZ4_LIBRARIES
+    NAMES lz4 liblz4.so.1
+    HINTS ${PC_LZ4_LIBDIR} ${CMAKE_INSTALL_PREFIX}/lib ${CMAKE_INSTALL_PREFIX}/lib64
+    PATHS /usr/lib
+        /usr/lib64
+        /usr/lib/x86_64-linux-gnu
+        /usr/lib/aarch64-linux-gnu
+        /usr/lib/arm-linux-gnueabi
+        /usr/lib/arm-linux-gnueabihf
+        /usr/lib/i386-linux-gnu
+        /usr/lib/mips-linux-gnu
+        /usr/lib/mips64el-linux-gnuabi64
+        /usr/lib/mipsel-linux-gnu
+        /usr/lib/powerpc64-linux-gnu
+        /usr/lib/powerpc64le-linux-gnu
+        /usr/lib/riscv64-linux-gnu
+        /usr/lib/s390x-linux-gnu
+        /usr/local/lib
+        /usr/local/lib64
+        /opt/local/lib
+)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(LZ4 DEFAULT_MSG LZ4_LIBRARIES LZ4_INCLUDE_DIRS)
+mark_as_advanced(LZ4_LIBRARIES LZ4_INCLUDE_DIRS)
+
+set_package_properties(LZ4 PROPERTIES URL "https://lz4.org/")
+if(PC_LZ4_VERSION)
+    set_package_properties(LZ4 PROPERTIES
+        DESCRIPTION "Extremely fast lossless compression library (found: v${PC_LZ4_VERSION})"
+    )
+else()
+    set_package_properties(LZ4 PROPERTIES
+        DESCRIPTION "Extremely fast lossless compression library"
+    )
+endif()
+
+if(LZ4_FOUND AND LZ4_INCLUDE_DIRS AND NOT TARGET Lz4::lz4)
+    add_library(Lz4::lz4 INTERFACE IMPORTED)
+    set_target_properties(Lz4::lz4 PROPERTIES
+        INTERFACE_INCLUDE_DIRECTORIES "${LZ4_INCLUDE_DIRS}"
+        INTERFACE_LINK_LIBRARIES "${LZ4_LIBRARIES}"
+    )
+endif()
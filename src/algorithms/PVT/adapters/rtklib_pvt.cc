@@ -81,6 +81,15 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     pvt_output_parameters.system_ecef_pos_sd_m = configuration->property(role + ".kf_system_ecef_pos_sd_m", 0.01);
     pvt_output_parameters.system_ecef_vel_sd_ms = configuration->property(role + ".kf_system_ecef_vel_sd_ms", 0.001);
 
+    // PVT KF fast mode settings (static receivers: full LS/RTK solution at a reduced
+    // rate, KF propagation with innovation checks for the epochs in between)
+    pvt_output_parameters.enable_pvt_kf_fast_mode = configuration->property(role + ".enable_pvt_kf_fast_mode", false);
+    pvt_output_parameters.kf_fast_mode_full_update_interval_s = configuration->property(role + ".kf_fast_mode_full_update_interval_s", 1.0);
+    pvt_output_parameters.kf_fast_mode_innovation_threshold_m = configuration->property(role + ".kf_fast_mode_innovation_threshold_m", 10.0);
+
+    // Per-constellation integrity sub-solutions
+    pvt_output_parameters.enable_sub_solutions = configuration->property(role + ".enable_sub_solutions", false);
+
     // NMEA Printer settings
     pvt_output_parameters.flag_nmea_tty_port = configuration->property(role + ".flag_nmea_tty_port", false);
     pvt_output_parameters.nmea_dump_filename = configuration->property(role + ".nmea_dump_filename", default_nmea_dump_filename);
@@ -102,6 +111,7 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
         {
             pvt_output_parameters.rinex_name = FLAGS_RINEX_name;
         }
+    pvt_output_parameters.rinex_output_compression = configuration->property(role + ".rinex_output_compression", std::string("none"));
 
     // RTCM Printer settings
     pvt_output_parameters.flag_rtcm_tty_port = configuration->property(role + ".flag_rtcm_tty_port", false);
@@ -867,6 +877,7 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
         {
             pvt_output_parameters.protobuf_enabled = true;
         }
+    pvt_output_parameters.monitor_delta_compression_enabled = configuration->property(role + ".enable_delta_compression", false);
 
     // Read EPHEMERIS MONITOR Configuration
     pvt_output_parameters.monitor_ephemeris_enabled = configuration->property(role + ".enable_monitor_ephemeris", false);
@@ -882,6 +893,9 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     // Set maximum clock offset allowed if pvt_output_parameters.enable_rx_clock_correction = false
     pvt_output_parameters.max_obs_block_rx_clock_offset_ms = configuration->property(role + ".max_clock_offset_ms", pvt_output_parameters.max_obs_block_rx_clock_offset_ms);
 
+    // Enable or disable the continuous sample clock model in the observables block
+    pvt_output_parameters.enable_clock_steering = configuration->property(role + ".enable_clock_steering", pvt_output_parameters.enable_clock_steering);
+
     // Source timetag
     pvt_output_parameters.log_source_timetag = configuration->property(role + ".log_timetag", pvt_output_parameters.log_source_timetag);
     pvt_output_parameters.log_source_timetag_file = configuration->property(role + ".log_source_timetag_file", pvt_output_parameters.log_source_timetag_file);
@@ -890,6 +904,18 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     pvt_output_parameters.use_e6_for_pvt = configuration->property(role + ".use_e6_for_pvt", pvt_output_parameters.use_e6_for_pvt);
     pvt_output_parameters.use_has_corrections = configuration->property(role + ".use_has_corrections", pvt_output_parameters.use_has_corrections);
 
+    // Vector tracking assistance: feed NCO commands back to the tracking channels
+    pvt_output_parameters.enable_vtl_assist = configuration->property(role + ".enable_vtl_assist", pvt_output_parameters.enable_vtl_assist);
+    pvt_output_parameters.vtl_assist_coast_time_s = configuration->property(role + ".vtl_assist_coast_time_s", pvt_output_parameters.vtl_assist_coast_time_s);
+
+    // Bounded-latency real-time mode: skip observables epochs already past their deadline
+    pvt_output_parameters.rt_deadline_ms = configuration->property(role + ".rt_deadline_ms", pvt_output_parameters.rt_deadline_ms);
+    pvt_output_parameters.rt_max_consecutive_skips = configuration->property(role + ".rt_max_consecutive_skips", pvt_output_parameters.rt_max_consecutive_skips);
+
+    // Navigation data validation: run consistency checks on decoded ephemerides in a worker pool
+    pvt_output_parameters.enable_nav_data_validation = configuration->property(role + ".enable_nav_data_validation", pvt_output_parameters.enable_nav_data_validation);
+    pvt_output_parameters.nav_validation_threads = configuration->property(role + ".nav_validation_threads", pvt_output_parameters.nav_validation_threads);
+
     // Use unhealthy satellites
     pvt_output_parameters.use_unhealthy_sats = configuration->property(role + ".use_unhealthy_sats", pvt_output_parameters.use_unhealthy_sats);
 
@@ -926,6 +952,12 @@ bool Rtklib_Pvt::get_latest_PVT(double* longitude_deg,
 }
 
 
+double Rtklib_Pvt::get_rx_clock_drift_ppm()
+{
+    return pvt_->get_rx_clock_drift_ppm();
+}
+
+
 void Rtklib_Pvt::clear_ephemeris()
 {
     pvt_->clear_ephemeris();
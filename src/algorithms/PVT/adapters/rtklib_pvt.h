@@ -220,6 +220,8 @@ public:
         double* course_over_ground_deg,
         time_t* UTC_time) override;
 
+    double get_rx_clock_drift_ppm() override;
+
 private:
     rtklib_pvt_gs_sptr pvt_;
     rtk_t rtk{};
@@ -48,13 +48,17 @@
 #include "gpx_printer.h"
 #include "has_simple_printer.h"
 #include "kml_printer.h"
+#include "latency_tracer.h"
 #include "monitor_ephemeris_udp_sink.h"
 #include "monitor_pvt.h"
 #include "monitor_pvt_udp_sink.h"
 #include "nmea_printer.h"
 #include "pvt_conf.h"
+#include "pvt_solution_snapshot.h"
 #include "rinex_printer.h"
 #include "rtcm_printer.h"
+#include "rtklib_conversions.h"
+#include "rtklib_ephemeris.h"
 #include "rtklib_rtkcmn.h"
 #include "rtklib_solver.h"
 #include "trackingcmd.h"
@@ -75,6 +79,7 @@
 #include <iomanip>                      // for put_time, setprecision
 #include <iostream>                     // for operator<<
 #include <locale>                       // for locale
+#include <map>                          // for map
 #include <sstream>                      // for ostringstream
 #include <stdexcept>                    // for length_error
 #include <sys/ipc.h>                    // for IPC_CREAT
@@ -150,6 +155,9 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
       d_rx_time(0.0),
       d_local_counter_ms(0ULL),
       d_timestamp_rx_clock_offset_correction_msg_ms(0LL),
+      d_writer_dropped_tasks(0ULL),
+      d_nav_validator_revision(0ULL),
+      d_rt_deadline_skips(0ULL),
       d_rinexobs_rate_ms(conf_.rinexobs_rate_ms),
       d_kml_rate_ms(conf_.kml_rate_ms),
       d_gpx_rate_ms(conf_.gpx_rate_ms),
@@ -160,6 +168,10 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
       d_display_rate_ms(conf_.display_rate_ms),
       d_report_rate_ms(1000),
       d_max_obs_block_rx_clock_offset_ms(conf_.max_obs_block_rx_clock_offset_ms),
+      d_vtl_assist_coast_time_s(conf_.vtl_assist_coast_time_s),
+      d_rt_deadline_ms(conf_.rt_deadline_ms),
+      d_rt_max_consecutive_skips(conf_.rt_max_consecutive_skips),
+      d_rt_consecutive_skips(0),
       d_nchannels(nchannels),
       d_type_of_rx(conf_.type_of_receiver),
       d_observable_interval_ms(conf_.observable_interval_ms),
@@ -176,14 +188,18 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
       d_flag_monitor_ephemeris_enabled(conf_.monitor_ephemeris_enabled),
       d_show_local_time_zone(conf_.show_local_time_zone),
       d_enable_rx_clock_correction(conf_.enable_rx_clock_correction),
+      d_enable_clock_steering(conf_.enable_clock_steering),
+      d_enable_vtl_assist(conf_.enable_vtl_assist),
       d_an_printer_enabled(conf_.an_output_enabled),
       d_log_timetag(conf_.log_source_timetag),
       d_use_has_corrections(conf_.use_has_corrections),
-      d_use_unhealthy_sats(conf_.use_unhealthy_sats)
+      d_use_unhealthy_sats(conf_.use_unhealthy_sats),
+      d_enable_nav_data_validation(conf_.enable_nav_data_validation),
+      d_writer_running(false)
 {
     // Send feedback message to observables block with the receiver clock offset
     this->message_port_register_out(pmt::mp("pvt_to_observables"));
-    // Experimental: VLT commands from PVT to tracking channels
+    // VTL commands from PVT to tracking channels (vector tracking assistance)
     this->message_port_register_out(pmt::mp("pvt_to_trk"));
     // Send PVT status to gnss_flowgraph
     this->message_port_register_out(pmt::mp("status"));
@@ -217,6 +233,13 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
     d_initial_carrier_phase_offset_estimation_rads = std::vector<double>(nchannels, 0.0);
     d_channel_initialized = std::vector<bool>(nchannels, false);
 
+    // one slot per channel; the reserved capacity survives clear(), so the
+    // per-epoch rebuild of the observables maps does not allocate
+    d_gnss_observables_map.reserve(nchannels);
+    d_gnss_observables_map_t0.reserve(nchannels);
+    d_gnss_observables_map_t1.reserve(nchannels);
+    d_vtl_last_synchro_map.reserve(nchannels);
+
     std::string dump_ls_pvt_filename = conf_.dump_filename;
 
     if (d_dump)
@@ -389,7 +412,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
     // initialize RINEX printer
     if (d_rinex_output_enabled)
         {
-            d_rp = std::make_unique<Rinex_Printer>(d_rinex_version, conf_.rinex_output_path, conf_.rinex_name);
+            d_rp = std::make_unique<Rinex_Printer>(d_rinex_version, conf_.rinex_output_path, conf_.rinex_name, conf_.rinex_output_compression);
             d_rp->set_pre_2009_file(conf_.pre_2009_file);
         }
     else
@@ -462,7 +485,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             std::sort(udp_addr_vec.begin(), udp_addr_vec.end());
             udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
 
-            d_udp_sink_ptr = std::make_unique<Monitor_Pvt_Udp_Sink>(udp_addr_vec, conf_.udp_port, conf_.protobuf_enabled);
+            d_udp_sink_ptr = std::make_unique<Monitor_Pvt_Udp_Sink>(udp_addr_vec, conf_.udp_port, conf_.protobuf_enabled, conf_.monitor_delta_compression_enabled);
         }
     else
         {
@@ -569,6 +592,37 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
                 }
         }
 
+    // writer thread draining the output sink queue, so a slow disk or a
+    // network hiccup on an output device does not stall the solver
+    if (d_kml_output_enabled || d_gpx_output_enabled || d_geojson_output_enabled || d_nmea_output_file_enabled)
+        {
+            d_writer_running = true;
+            d_writer_thread = std::thread(&rtklib_pvt_gs::writer_task_loop, this);
+        }
+
+    // worker pool validating decoded navigation data off the message handler
+    // thread, so a burst of simultaneous subframe completions across the
+    // channels does not delay the PVT epoch that is due
+    if (d_enable_nav_data_validation)
+        {
+            d_nav_validator = std::make_unique<Nav_Data_Validator>(static_cast<uint32_t>(std::max(conf_.nav_validation_threads, 1)));
+        }
+
+    if (d_rt_deadline_ms > 0)
+        {
+            if (Latency_Tracer::get_instance().enabled())
+                {
+                    std::cout << "PVT real-time mode enabled: observables epochs older than "
+                              << d_rt_deadline_ms << " [ms] will be skipped when fresher epochs are queued\n";
+                }
+            else
+                {
+                    std::cerr << TEXT_RED << "WARNING: PVT.rt_deadline_ms requires GNSS-SDR.enable_latency_trace=true "
+                              << "to measure epoch age. Real-time mode is disabled." << TEXT_RESET << '\n';
+                    d_rt_deadline_ms = 0;
+                }
+        }
+
     d_start = std::chrono::system_clock::now();
 }
 
@@ -576,6 +630,16 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
 rtklib_pvt_gs::~rtklib_pvt_gs()
 {
     DLOG(INFO) << "PVT block destructor called.";
+    if (d_rt_deadline_skips > 0ULL)
+        {
+            LOG(INFO) << "PVT real-time mode: " << d_rt_deadline_skips
+                      << " stale observables epochs were skipped past their deadline";
+        }
+    if (d_writer_thread.joinable())
+        {
+            d_writer_running = false;
+            d_writer_thread.join();
+        }
     if (d_sysv_msqid != -1)
         {
             msgctl(d_sysv_msqid, IPC_RMID, nullptr);
@@ -1141,6 +1205,42 @@ rtklib_pvt_gs::~rtklib_pvt_gs()
 }
 
 
+void rtklib_pvt_gs::writer_task_loop()
+{
+    std::function<void()> task;
+    while (d_writer_running.load() || !d_writer_queue.empty())
+        {
+            if (d_writer_queue.timed_wait_and_pop(task, 100))
+                {
+                    task();
+                }
+        }
+}
+
+
+void rtklib_pvt_gs::enqueue_writer_task(std::function<void()> task)
+{
+    // keep the synchronous behavior when no writer thread was started
+    if (!d_writer_running.load())
+        {
+            task();
+            return;
+        }
+    // bounded queue: if the output sinks cannot keep up with real time,
+    // drop output epochs instead of stalling the flowgraph
+    if (d_writer_queue.size() >= 500)
+        {
+            if ((d_writer_dropped_tasks++ % 100) == 0)
+                {
+                    LOG(WARNING) << "PVT output writer queue is full, dropping output epochs ("
+                                 << d_writer_dropped_tasks << " dropped so far)";
+                }
+            return;
+        }
+    d_writer_queue.push(std::move(task));
+}
+
+
 void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
 {
     try
@@ -1186,10 +1286,19 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                     d_rp->log_rinex_nav_gps_nav(d_type_of_rx, new_eph);
                                 }
                         }
-                    d_internal_pvt_solver->gps_ephemeris_map[gps_eph->PRN] = *gps_eph;
-                    if (d_enable_rx_clock_correction == true)
+                    if (d_enable_nav_data_validation)
                         {
-                            d_user_pvt_solver->gps_ephemeris_map[gps_eph->PRN] = *gps_eph;
+                            // consistency checks run in the validation pool; the verified
+                            // record is merged into the solvers before the next PVT epoch
+                            d_nav_validator->enqueue(gps_eph);
+                        }
+                    else
+                        {
+                            d_internal_pvt_solver->gps_ephemeris_map[gps_eph->PRN] = *gps_eph;
+                            if (d_enable_rx_clock_correction == true)
+                                {
+                                    d_user_pvt_solver->gps_ephemeris_map[gps_eph->PRN] = *gps_eph;
+                                }
                         }
                     if (gps_eph->SV_health != 0)
                         {
@@ -1346,10 +1455,19 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                     d_rp->log_rinex_nav_gal_nav(d_type_of_rx, new_gal_eph);
                                 }
                         }
-                    d_internal_pvt_solver->galileo_ephemeris_map[galileo_eph->PRN] = *galileo_eph;
-                    if (d_enable_rx_clock_correction == true)
+                    if (d_enable_nav_data_validation)
                         {
-                            d_user_pvt_solver->galileo_ephemeris_map[galileo_eph->PRN] = *galileo_eph;
+                            // consistency checks run in the validation pool; the verified
+                            // record is merged into the solvers before the next PVT epoch
+                            d_nav_validator->enqueue(galileo_eph);
+                        }
+                    else
+                        {
+                            d_internal_pvt_solver->galileo_ephemeris_map[galileo_eph->PRN] = *galileo_eph;
+                            if (d_enable_rx_clock_correction == true)
+                                {
+                                    d_user_pvt_solver->galileo_ephemeris_map[galileo_eph->PRN] = *galileo_eph;
+                                }
                         }
                     if (((galileo_eph->E1B_HS != 0) || (galileo_eph->E1B_DVS == true)) ||
                         ((galileo_eph->E5a_HS != 0) || (galileo_eph->E5a_DVS == true)) ||
@@ -1714,7 +1832,9 @@ bool rtklib_pvt_gs::save_gnss_synchro_map_xml(const std::string& file_name)
                 {
                     ofs.open(file_name.c_str(), std::ofstream::trunc | std::ofstream::out);
                     boost::archive::xml_oarchive xml(ofs);
-                    xml << boost::serialization::make_nvp("GNSS-SDR_gnss_synchro_map", d_gnss_observables_map);
+                    // copied into a std::map, which is what Boost.Serialization knows how to archive
+                    const std::map<int, Gnss_Synchro> gnss_synchro_map(d_gnss_observables_map.cbegin(), d_gnss_observables_map.cend());
+                    xml << boost::serialization::make_nvp("GNSS-SDR_gnss_synchro_map", gnss_synchro_map);
                     LOG(INFO) << "Saved gnss_sychro map data";
                 }
             catch (const std::exception& e)
@@ -1755,8 +1875,10 @@ bool rtklib_pvt_gs::load_gnss_synchro_map_xml(const std::string& file_name)
         {
             ifs.open(file_name.c_str(), std::ifstream::binary | std::ifstream::in);
             boost::archive::xml_iarchive xml(ifs);
+            std::map<int, Gnss_Synchro> gnss_synchro_map;
+            xml >> boost::serialization::make_nvp("GNSS-SDR_gnss_synchro_map", gnss_synchro_map);
             d_gnss_observables_map.clear();
-            xml >> boost::serialization::make_nvp("GNSS-SDR_gnss_synchro_map", d_gnss_observables_map);
+            d_gnss_observables_map.insert(gnss_synchro_map.cbegin(), gnss_synchro_map.cend());
             // std::cout << "Loaded gnss_synchro map data with " << gnss_synchro_map.size() << " pseudoranges\n";
         }
     catch (const std::exception& e)
@@ -1823,11 +1945,21 @@ bool rtklib_pvt_gs::get_latest_PVT(double* longitude_deg,
 }
 
 
-void rtklib_pvt_gs::apply_rx_clock_offset(std::map<int, Gnss_Synchro>& observables_map,
+double rtklib_pvt_gs::get_rx_clock_drift_ppm() const
+{
+    if (d_enable_rx_clock_correction == true)
+        {
+            return d_user_pvt_solver->get_clock_drift_ppm();
+        }
+    return d_internal_pvt_solver->get_clock_drift_ppm();
+}
+
+
+void rtklib_pvt_gs::apply_rx_clock_offset(Gnss_Synchro_Map& observables_map,
     double rx_clock_offset_s)
 {
     // apply corrections according to Rinex 3.04, Table 1: Observation Corrections for Receiver Clock Offset
-    std::map<int, Gnss_Synchro>::iterator observables_iter;
+    Gnss_Synchro_Map::iterator observables_iter;
 
     for (observables_iter = observables_map.begin(); observables_iter != observables_map.end(); observables_iter++)
         {
@@ -1843,11 +1975,12 @@ void rtklib_pvt_gs::apply_rx_clock_offset(std::map<int, Gnss_Synchro>& observabl
 }
 
 
-std::map<int, Gnss_Synchro> rtklib_pvt_gs::interpolate_observables(const std::map<int, Gnss_Synchro>& observables_map_t0,
-    const std::map<int, Gnss_Synchro>& observables_map_t1,
-    double rx_time_s)
+void rtklib_pvt_gs::interpolate_observables(const Gnss_Synchro_Map& observables_map_t0,
+    const Gnss_Synchro_Map& observables_map_t1,
+    double rx_time_s,
+    Gnss_Synchro_Map& interp_observables_map)
 {
-    std::map<int, Gnss_Synchro> interp_observables_map;
+    interp_observables_map.clear();
     // Linear interpolation: y(t) = y(t0) + (y(t1) - y(t0)) * (t - t0) / (t1 - t0)
 
     // check TOW rollover
@@ -1867,7 +2000,7 @@ std::map<int, Gnss_Synchro> rtklib_pvt_gs::interpolate_observables(const std::ma
                               observables_map_t0.cbegin()->second.RX_time);
         }
 
-    std::map<int, Gnss_Synchro>::const_iterator observables_iter;
+    Gnss_Synchro_Map::const_iterator observables_iter;
     for (observables_iter = observables_map_t0.cbegin(); observables_iter != observables_map_t0.cend(); observables_iter++)
         {
             // 1. Check if the observable exist in t0 and t1
@@ -1888,14 +2021,13 @@ std::map<int, Gnss_Synchro> rtklib_pvt_gs::interpolate_observables(const std::ma
                     // observable does not exist in t1
                 }
         }
-    return interp_observables_map;
 }
 
 
 void rtklib_pvt_gs::initialize_and_apply_carrier_phase_offset()
 {
     // we have a valid PVT. First check if we need to reset the initial carrier phase offsets to match their pseudoranges
-    std::map<int, Gnss_Synchro>::iterator observables_iter;
+    Gnss_Synchro_Map::iterator observables_iter;
     for (observables_iter = d_gnss_observables_map.begin(); observables_iter != d_gnss_observables_map.end(); observables_iter++)
         {
             // check if an initialization is required (new satellite or loss of lock)
@@ -1919,6 +2051,161 @@ void rtklib_pvt_gs::initialize_and_apply_carrier_phase_offset()
 }
 
 
+void rtklib_pvt_gs::merge_validated_nav_data()
+{
+    // cheap check first: the validation pool bumps the revision counter only
+    // when a record passes the checks
+    const uint64_t revision = d_nav_validator->revision();
+    if (revision == d_nav_validator_revision)
+        {
+            return;
+        }
+    d_nav_validator_revision = revision;
+    for (const auto& eph : *d_nav_validator->get_validated_gps_eph())
+        {
+            d_internal_pvt_solver->gps_ephemeris_map[eph.first] = eph.second;
+            if (d_enable_rx_clock_correction == true)
+                {
+                    d_user_pvt_solver->gps_ephemeris_map[eph.first] = eph.second;
+                }
+        }
+    for (const auto& eph : *d_nav_validator->get_validated_galileo_eph())
+        {
+            d_internal_pvt_solver->galileo_ephemeris_map[eph.first] = eph.second;
+            if (d_enable_rx_clock_correction == true)
+                {
+                    d_user_pvt_solver->galileo_ephemeris_map[eph.first] = eph.second;
+                }
+        }
+}
+
+
+void rtklib_pvt_gs::send_vtl_commands()
+{
+    // Close the tracking loops in the navigation domain: predict the carrier
+    // Doppler of each satellite in track from the receiver position, velocity
+    // and clock drift, and publish it as a per-channel NCO command. Channels
+    // receiving these commands can coast through signal blockage without
+    // triggering a reacquisition, as long as the navigation solution stays
+    // healthy.
+    if (d_gnss_observables_map.empty())
+        {
+            return;
+        }
+
+    // refresh the per-channel satellite assignments with the current epoch,
+    // keeping the channels that temporarily lost their signal
+    for (const auto& obs : d_gnss_observables_map)
+        {
+            if (obs.second.Flag_valid_pseudorange == true)
+                {
+                    d_vtl_last_synchro_map[obs.second.Channel_ID] = obs.second;
+                }
+        }
+    // all the observables of the epoch share the same sample counter; the
+    // tracking side uses it to discard stale commands
+    const uint64_t epoch_sample_counter = d_gnss_observables_map.cbegin()->second.Tracking_sample_counter;
+
+    const std::array<double, 3> rx_pos = d_user_pvt_solver->get_rx_pos();
+    std::array<double, 3> rx_geo{};
+    ecef2pos(rx_pos.data(), rx_geo.data());
+    std::array<double, 3> rx_vel_ecef{};
+    enu2ecef(rx_geo.data(), d_user_pvt_solver->get_rx_vel().data(), rx_vel_ecef.data());
+    const double clock_drift_ppm = d_user_pvt_solver->get_clock_drift_ppm();
+
+    auto synchro_iter = d_vtl_last_synchro_map.begin();
+    while (synchro_iter != d_vtl_last_synchro_map.end())
+        {
+            const Gnss_Synchro& sync = synchro_iter->second;
+            // channels without a valid observable for too long are dropped
+            // from the assistance, so they can be reassigned by the flowgraph
+            if ((d_rx_time - sync.RX_time) > static_cast<double>(d_vtl_assist_coast_time_s))
+                {
+                    synchro_iter = d_vtl_last_synchro_map.erase(synchro_iter);
+                    continue;
+                }
+
+            // satellite position and velocity from the broadcast ephemeris
+            eph_t rtk_eph{};
+            bool eph_found = false;
+            switch (sync.System)
+                {
+                case 'G':
+                    {
+                        const auto eph_it = d_user_pvt_solver->gps_ephemeris_map.find(static_cast<int>(sync.PRN));
+                        if (eph_it != d_user_pvt_solver->gps_ephemeris_map.cend())
+                            {
+                                rtk_eph = eph_to_rtklib(eph_it->second, d_user_pvt_solver->is_pre_2009());
+                                eph_found = true;
+                            }
+                        break;
+                    }
+                case 'E':
+                    {
+                        const auto eph_it = d_user_pvt_solver->galileo_ephemeris_map.find(static_cast<int>(sync.PRN));
+                        if (eph_it != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                            {
+                                rtk_eph = eph_to_rtklib(eph_it->second);
+                                eph_found = true;
+                            }
+                        break;
+                    }
+                default:
+                    break;
+                }
+            if (eph_found == false)
+                {
+                    ++synchro_iter;
+                    continue;
+                }
+
+            const gtime_t t_tx = timeadd(gpst2time(rtk_eph.week, d_rx_time), -sync.Pseudorange_m / SPEED_OF_LIGHT_M_S);
+            std::array<double, 3> r_sat_t1{};
+            std::array<double, 3> r_sat_t2{};
+            double sat_clock_bias = 0.0;
+            double sat_pos_variance = 0.0;
+            eph2pos(t_tx, &rtk_eph, r_sat_t1.data(), &sat_clock_bias, &sat_pos_variance);
+            eph2pos(timeadd(t_tx, 0.5), &rtk_eph, r_sat_t2.data(), &sat_clock_bias, &sat_pos_variance);
+
+            std::array<double, 3> line_of_sight{};
+            std::array<double, 3> sat_vel{};
+            for (int i = 0; i < 3; i++)
+                {
+                    line_of_sight[i] = r_sat_t1[i] - rx_pos[i];
+                    sat_vel[i] = (r_sat_t2[i] - r_sat_t1[i]) / 0.5;
+                }
+            const double range_m = norm_rtk(line_of_sight.data(), 3);
+            if (range_m <= 0.0)
+                {
+                    ++synchro_iter;
+                    continue;
+                }
+            double range_rate_m_s = 0.0;
+            for (int i = 0; i < 3; i++)
+                {
+                    range_rate_m_s += (sat_vel[i] - rx_vel_ecef[i]) * line_of_sight[i] / range_m;
+                }
+
+            double carrier_freq_hz = FREQ1;
+            const auto it_freq_map = SIGNAL_FREQ_MAP.find(std::string(sync.Signal, 2));
+            if (it_freq_map != SIGNAL_FREQ_MAP.cend())
+                {
+                    carrier_freq_hz = it_freq_map->second;
+                }
+            // a receiver clock running fast makes all the measured Dopplers look lower
+            const double predicted_doppler_hz = -range_rate_m_s * carrier_freq_hz / SPEED_OF_LIGHT_M_S - clock_drift_ppm * 1e-6 * carrier_freq_hz;
+
+            const auto trk_cmd = std::make_shared<TrackingCmd>(TrackingCmd());
+            trk_cmd->enable_carrier_nco_cmd = true;
+            trk_cmd->carrier_freq_hz = predicted_doppler_hz;
+            trk_cmd->sample_counter = epoch_sample_counter;
+            trk_cmd->channel_id = static_cast<uint32_t>(sync.Channel_ID);
+            this->message_port_pub(pmt::mp("pvt_to_trk"), pmt::make_any(trk_cmd));
+            ++synchro_iter;
+        }
+}
+
+
 void rtklib_pvt_gs::update_HAS_corrections()
 {
     this->d_internal_pvt_solver->update_has_corrections(this->d_gnss_observables_map);
@@ -1974,6 +2261,38 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
 
             d_gnss_observables_map.clear();
             const auto** in = reinterpret_cast<const Gnss_Synchro**>(&input_items[0]);  // Get the input buffer pointer
+
+            // ############ 0. REAL-TIME DEADLINE CHECK ####
+            // When a processing hiccup creates backlog, the epochs queued behind
+            // the freshest one are already stale for a real-time consumer. Skip
+            // them instead of solving them in order, so the output latency stays
+            // bounded; the consecutive-skip cap keeps enough observation
+            // continuity for the RTK ambiguity filter
+            if ((d_rt_deadline_ms > 0) && (epoch < noutput_items - 1) && (d_rt_consecutive_skips < d_rt_max_consecutive_skips))
+                {
+                    uint64_t epoch_sample_stamp = 0;
+                    for (uint32_t i = 0; i < d_nchannels; i++)
+                        {
+                            if (in[i][epoch].Flag_valid_pseudorange)
+                                {
+                                    epoch_sample_stamp = in[i][epoch].Tracking_sample_counter;
+                                    break;
+                                }
+                        }
+                    if ((epoch_sample_stamp > 0) && (Latency_Tracer::get_instance().age_ms(epoch_sample_stamp) > static_cast<double>(d_rt_deadline_ms)))
+                        {
+                            d_rt_consecutive_skips++;
+                            d_rt_deadline_skips++;
+                            if ((d_rt_deadline_skips % 100ULL) == 1ULL)
+                                {
+                                    LOG(WARNING) << "PVT real-time mode: skipped a stale observables epoch ("
+                                                 << d_rt_deadline_skips << " skipped so far)";
+                                }
+                            continue;
+                        }
+                }
+            d_rt_consecutive_skips = 0;
+
             // ############ 1. READ PSEUDORANGES ####
             for (uint32_t i = 0; i < d_nchannels; i++)
                 {
@@ -2099,6 +2418,10 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                 }
 
             // ############ 2 COMPUTE THE PVT ################################
+            if (d_enable_nav_data_validation)
+                {
+                    merge_validated_nav_data();
+                }
             bool flag_pvt_valid = false;
             if (d_gnss_observables_map.empty() == false)
                 {
@@ -2109,6 +2432,10 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                     if (d_internal_pvt_solver->get_PVT(d_gnss_observables_map, d_observable_interval_ms / 1000.0))
                         {
                             d_pvt_errors_counter = 0;  // Reset consecutive PVT error counter
+                            if (Latency_Tracer::get_instance().enabled())
+                                {
+                                    Latency_Tracer::get_instance().record_stage("pvt", d_gnss_observables_map.cbegin()->second.Tracking_sample_counter);
+                                }
                             const double Rx_clock_offset_s = d_internal_pvt_solver->get_time_offset_s();
 
                             // **************** time tags ****************
@@ -2161,6 +2488,15 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                                 }
                             else
                                 {
+                                    if (d_enable_clock_steering == true)
+                                        {
+                                            // feed the sample clock model in the observables block with the
+                                            // per-epoch solved offset and drift. The pair payload keeps it
+                                            // apart from the coarse correction messages sent above, which
+                                            // carry a plain double
+                                            const std::pair<double, double> clock_measurement(Rx_clock_offset_s, d_internal_pvt_solver->get_clock_drift_ppm());
+                                            this->message_port_pub(pmt::mp("pvt_to_observables"), pmt::make_any(clock_measurement));
+                                        }
                                     if (d_enable_rx_clock_correction == true)
                                         {
                                             d_gnss_observables_map_t0 = d_gnss_observables_map_t1;
@@ -2180,9 +2516,10 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                                                             // std::cout << " obs time t0: " << d_gnss_observables_map_t0.cbegin()->second.RX_time
                                                             //           << " t1: " << d_gnss_observables_map_t1.cbegin()->second.RX_time
                                                             //           << " interp time: " << d_rx_time << '\n';
-                                                            d_gnss_observables_map = interpolate_observables(d_gnss_observables_map_t0,
+                                                            interpolate_observables(d_gnss_observables_map_t0,
                                                                 d_gnss_observables_map_t1,
-                                                                d_rx_time);
+                                                                d_rx_time,
+                                                                d_gnss_observables_map);
                                                             flag_compute_pvt_output = true;
                                                             // d_rx_time = current_RX_time;
                                                             // std::cout.precision(17);
@@ -2225,12 +2562,12 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
 
                     if (flag_pvt_valid == true)
                         {
-                            // experimental VTL tests
-                            // send tracking command
-                            //                            const std::shared_ptr<TrackingCmd> trk_cmd_test = std::make_shared<TrackingCmd>(TrackingCmd());
-                            //                            trk_cmd_test->carrier_freq_hz = 12345.4;
-                            //                            trk_cmd_test->sample_counter = d_gnss_observables_map.begin()->second.Tracking_sample_counter;
-                            //                            this->message_port_pub(pmt::mp("pvt_to_trk"), pmt::make_any(trk_cmd_test));
+                            // vector tracking assistance: close the loops in the navigation
+                            // domain by sending NCO commands back to the tracking channels
+                            if (d_enable_vtl_assist == true)
+                                {
+                                    send_vtl_commands();
+                                }
 
                             // initialize (if needed) the accumulated phase offset and apply it to the active channels
                             // required to report accumulated phase cycles comparable to pseudoranges
@@ -2328,56 +2665,62 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                                             send_sys_v_ttff_msg(ttff);
                                             d_first_fix = false;
                                         }
-                                    if (d_kml_output_enabled)
+                                    const bool kml_due = d_kml_output_enabled && (current_RX_time_ms % d_kml_rate_ms == 0);
+                                    const bool gpx_due = d_gpx_output_enabled && (current_RX_time_ms % d_gpx_rate_ms == 0);
+                                    const bool geojson_due = d_geojson_output_enabled && (current_RX_time_ms % d_geojson_rate_ms == 0);
+                                    const bool nmea_due = d_nmea_output_file_enabled && (current_RX_time_ms % d_nmea_rate_ms == 0);
+                                    if (kml_due || gpx_due || geojson_due || nmea_due)
                                         {
-                                            if (current_RX_time_ms % d_kml_rate_ms == 0)
-                                                {
-                                                    d_kml_dump->print_position(d_user_pvt_solver.get());
-                                                }
+                                            // self-contained copy of this epoch, formatted and written
+                                            // by the writer thread while the solver moves on
+                                            const auto snapshot = std::make_shared<Pvt_Solution_Snapshot>(*d_user_pvt_solver);
+                                            enqueue_writer_task([this, snapshot, kml_due, gpx_due, geojson_due, nmea_due] {
+                                                if (kml_due)
+                                                    {
+                                                        d_kml_dump->print_position(snapshot.get());
+                                                    }
+                                                if (gpx_due)
+                                                    {
+                                                        d_gpx_dump->print_position(snapshot.get());
+                                                    }
+                                                if (geojson_due)
+                                                    {
+                                                        d_geojson_printer->print_position(snapshot.get());
+                                                    }
+                                                if (nmea_due)
+                                                    {
+                                                        d_nmea_printer->Print_Nmea_Line(snapshot.get());
+                                                    }
+                                            });
                                         }
-                                    if (d_gpx_output_enabled)
+                                    if (d_rinex_output_enabled || d_rtcm_enabled)
                                         {
-                                            if (current_RX_time_ms % d_gpx_rate_ms == 0)
+                                            // the RINEX and RTCM message builders consume std::map; both are
+                                            // low-rate output paths, so a per-output copy is acceptable there
+                                            const std::map<int, Gnss_Synchro> observables_std_map(d_gnss_observables_map.cbegin(), d_gnss_observables_map.cend());
+                                            if (d_rinex_output_enabled)
                                                 {
-                                                    d_gpx_dump->print_position(d_user_pvt_solver.get());
+                                                    d_rp->print_rinex_annotation(d_user_pvt_solver.get(), observables_std_map, d_rx_time, d_type_of_rx, flag_write_RINEX_obs_output);
                                                 }
-                                        }
-                                    if (d_geojson_output_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_geojson_rate_ms == 0)
+                                            if (d_rtcm_enabled)
                                                 {
-                                                    d_geojson_printer->print_position(d_user_pvt_solver.get());
+                                                    d_rtcm_printer->Print_Rtcm_Messages(d_user_pvt_solver.get(),
+                                                        observables_std_map,
+                                                        d_rx_time,
+                                                        d_type_of_rx,
+                                                        d_rtcm_MSM_rate_ms,
+                                                        d_rtcm_MT1019_rate_ms,
+                                                        d_rtcm_MT1020_rate_ms,
+                                                        d_rtcm_MT1045_rate_ms,
+                                                        d_rtcm_MT1077_rate_ms,
+                                                        d_rtcm_MT1097_rate_ms,
+                                                        flag_write_RTCM_MSM_output,
+                                                        flag_write_RTCM_1019_output,
+                                                        flag_write_RTCM_1020_output,
+                                                        flag_write_RTCM_1045_output,
+                                                        d_enable_rx_clock_correction);
                                                 }
                                         }
-                                    if (d_nmea_output_file_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_nmea_rate_ms == 0)
-                                                {
-                                                    d_nmea_printer->Print_Nmea_Line(d_user_pvt_solver.get());
-                                                }
-                                        }
-                                    if (d_rinex_output_enabled)
-                                        {
-                                            d_rp->print_rinex_annotation(d_user_pvt_solver.get(), d_gnss_observables_map, d_rx_time, d_type_of_rx, flag_write_RINEX_obs_output);
-                                        }
-                                    if (d_rtcm_enabled)
-                                        {
-                                            d_rtcm_printer->Print_Rtcm_Messages(d_user_pvt_solver.get(),
-                                                d_gnss_observables_map,
-                                                d_rx_time,
-                                                d_type_of_rx,
-                                                d_rtcm_MSM_rate_ms,
-                                                d_rtcm_MT1019_rate_ms,
-                                                d_rtcm_MT1020_rate_ms,
-                                                d_rtcm_MT1045_rate_ms,
-                                                d_rtcm_MT1077_rate_ms,
-                                                d_rtcm_MT1097_rate_ms,
-                                                flag_write_RTCM_MSM_output,
-                                                flag_write_RTCM_1019_output,
-                                                flag_write_RTCM_1020_output,
-                                                flag_write_RTCM_1045_output,
-                                                d_enable_rx_clock_correction);
-                                        }
                                 }
                         }
 
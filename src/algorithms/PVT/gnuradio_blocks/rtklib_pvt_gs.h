@@ -17,8 +17,11 @@
 #ifndef GNSS_SDR_RTKLIB_PVT_GS_H
 #define GNSS_SDR_RTKLIB_PVT_GS_H
 
+#include "concurrent_queue.h"
 #include "gnss_block_interface.h"
+#include "nav_data_validator.h"
 #include "gnss_synchro.h"
+#include "gnss_synchro_map.h"
 #include "gnss_time.h"
 #include "rtklib.h"
 #include <boost/date_time/gregorian/gregorian.hpp>
@@ -29,12 +32,15 @@
 #include <chrono>                 // for system_clock
 #include <cstddef>                // for size_t
 #include <cstdint>                // for int32_t
+#include <atomic>                 // for std::atomic
 #include <ctime>                  // for time_t
 #include <fstream>                // for std::fstream
+#include <functional>             // for std::function
 #include <map>                    // for map
 #include <memory>                 // for shared_ptr, unique_ptr
 #include <queue>                  // for std::queue
 #include <string>                 // for string
+#include <thread>                 // for std::thread
 #include <sys/types.h>            // for key_t
 #include <vector>                 // for vector
 
@@ -126,6 +132,11 @@ public:
         double* course_over_ground_deg,
         time_t* UTC_time) const;
 
+    /*!
+     * \brief Get the latest receiver clock drift estimate, in ppm
+     */
+    double get_rx_clock_drift_ppm() const;
+
     int work(int noutput_items, gr_vector_const_void_star& input_items,
         gr_vector_void_star& output_items);  //!< PVT Signal Processing
 
@@ -146,14 +157,21 @@ private:
 
     void initialize_and_apply_carrier_phase_offset();
 
-    void apply_rx_clock_offset(std::map<int, Gnss_Synchro>& observables_map,
+    void send_vtl_commands();
+
+    // merge the ephemerides verified by the validation pool into the solvers
+    void merge_validated_nav_data();
+
+    void apply_rx_clock_offset(Gnss_Synchro_Map& observables_map,
         double rx_clock_offset_s);
 
     void update_HAS_corrections();
 
-    std::map<int, Gnss_Synchro> interpolate_observables(const std::map<int, Gnss_Synchro>& observables_map_t0,
-        const std::map<int, Gnss_Synchro>& observables_map_t1,
-        double rx_time_s);
+    // fills interp_observables_map in place so its capacity is reused across epochs
+    void interpolate_observables(const Gnss_Synchro_Map& observables_map_t0,
+        const Gnss_Synchro_Map& observables_map_t1,
+        double rx_time_s,
+        Gnss_Synchro_Map& interp_observables_map);
 
     inline std::time_t convert_to_time_t(const boost::posix_time::ptime pt) const
     {
@@ -162,6 +180,12 @@ private:
 
     std::vector<std::string> split_string(const std::string& s, char delim) const;
 
+    // hand a sink task to the output writer thread, dropping it if the
+    // bounded queue is full so the solver never blocks on output latency
+    void enqueue_writer_task(std::function<void()> task);
+
+    void writer_task_loop();
+
     typedef struct
     {
         long mtype;  // NOLINT(google-runtime-int)
@@ -198,15 +222,21 @@ private:
     std::vector<bool> d_channel_initialized;
     std::vector<double> d_initial_carrier_phase_offset_estimation_rads;
 
-    std::map<int, Gnss_Synchro> d_gnss_observables_map;
-    std::map<int, Gnss_Synchro> d_gnss_observables_map_t0;
-    std::map<int, Gnss_Synchro> d_gnss_observables_map_t1;
+    Gnss_Synchro_Map d_gnss_observables_map;
+    Gnss_Synchro_Map d_gnss_observables_map_t0;
+    Gnss_Synchro_Map d_gnss_observables_map_t1;
+    Gnss_Synchro_Map d_vtl_last_synchro_map;  // last valid observable per channel, for vector tracking assistance
 
     std::queue<GnssTime> d_TimeChannelTagTimestamps;
 
     boost::posix_time::time_duration d_utc_diff_time;
     std::unique_ptr<Geohash> d_geohash;
 
+    Concurrent_Queue<std::function<void()>> d_writer_queue;
+    std::thread d_writer_thread;
+
+    std::unique_ptr<Nav_Data_Validator> d_nav_validator;
+
     size_t d_gps_ephemeris_sptr_type_hash_code;
     size_t d_gps_iono_sptr_type_hash_code;
     size_t d_gps_utc_model_sptr_type_hash_code;
@@ -232,6 +262,9 @@ private:
     double d_rx_time;
     uint64_t d_local_counter_ms;
     uint64_t d_timestamp_rx_clock_offset_correction_msg_ms;
+    uint64_t d_writer_dropped_tasks;
+    uint64_t d_nav_validator_revision;
+    uint64_t d_rt_deadline_skips;
 
     key_t d_sysv_msg_key;
     int d_sysv_msqid;
@@ -253,6 +286,10 @@ private:
     int32_t d_display_rate_ms;
     int32_t d_report_rate_ms;
     int32_t d_max_obs_block_rx_clock_offset_ms;
+    int32_t d_vtl_assist_coast_time_s;
+    int32_t d_rt_deadline_ms;
+    int32_t d_rt_max_consecutive_skips;
+    int32_t d_rt_consecutive_skips;
 
     uint32_t d_nchannels;
     uint32_t d_type_of_rx;
@@ -273,11 +310,15 @@ private:
     bool d_flag_monitor_ephemeris_enabled;
     bool d_show_local_time_zone;
     bool d_enable_rx_clock_correction;
+    bool d_enable_clock_steering;
+    bool d_enable_vtl_assist;
     bool d_enable_has_messages;
     bool d_an_printer_enabled;
     bool d_log_timetag;
     bool d_use_has_corrections;
     bool d_use_unhealthy_sats;
+    bool d_enable_nav_data_validation;
+    std::atomic<bool> d_writer_running;
 };
 
 
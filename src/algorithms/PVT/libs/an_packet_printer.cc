@@ -55,7 +55,7 @@ An_Packet_Printer::~An_Packet_Printer()
 }
 
 
-bool An_Packet_Printer::print_packet(const Rtklib_Solver* const pvt_data, const std::map<int, Gnss_Synchro>& gnss_observables_map)
+bool An_Packet_Printer::print_packet(const Rtklib_Solver* const pvt_data, const Gnss_Synchro_Map& gnss_observables_map)
 {
     an_packet_t an_packet{};
     sdr_gnss_packet_t sdr_gnss_packet{};
@@ -91,10 +91,10 @@ void An_Packet_Printer::close_serial() const
  * @param  NavData_t* pointer to input packet with all the information
  * @reval  None
  */
-void An_Packet_Printer::update_sdr_gnss_packet(sdr_gnss_packet_t* _packet, const Rtklib_Solver* const pvt, const std::map<int, Gnss_Synchro>& gnss_observables_map) const
+void An_Packet_Printer::update_sdr_gnss_packet(sdr_gnss_packet_t* _packet, const Rtklib_Solver* const pvt, const Gnss_Synchro_Map& gnss_observables_map) const
 {
     std::chrono::time_point<std::chrono::system_clock> this_epoch;
-    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
+    Gnss_Synchro_Map::const_iterator gnss_observables_iter;
     uint8_t num_gps_sats = 0;
     uint8_t num_gal_sats = 0;
     int index = 0;
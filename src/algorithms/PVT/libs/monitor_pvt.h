@@ -18,7 +18,9 @@
 #define GNSS_SDR_MONITOR_PVT_H
 
 #include <boost/serialization/nvp.hpp>
+#include <boost/serialization/vector.hpp>
 #include <cstdint>
+#include <vector>
 
 /** \addtogroup PVT
  * \{ */
@@ -26,6 +28,54 @@
  * \{ */
 
 
+/*!
+ * \brief This class contains the per-satellite residuals of a PVT epoch,
+ * as computed internally by the solver
+ */
+class Monitor_Sat_Residual
+{
+public:
+    // Navigation system (RTKLIB SYS_??? identifier)
+    uint8_t sys;
+    // Satellite PRN (slot number for GLONASS)
+    uint8_t prn;
+    // Valid satellite flag on the first frequency
+    uint8_t valid;
+    // Signal strength [dB-Hz]
+    float snr_dbhz;
+    // Azimuth [rad]
+    float azimuth_rad;
+    // Elevation [rad]
+    float elevation_rad;
+    // Pseudorange residual on the first frequency [m]
+    float pseudorange_residual_m;
+    // Carrier-phase residual on the first frequency [m]
+    float carrier_phase_residual_m;
+
+    /*!
+     * \brief This member function serializes and restores
+     * Monitor_Sat_Residual objects from a byte stream.
+     */
+    template <class Archive>
+
+    void serialize(Archive& ar, const unsigned int version)
+    {
+        if (version)
+            {
+            };
+
+        ar& BOOST_SERIALIZATION_NVP(sys);
+        ar& BOOST_SERIALIZATION_NVP(prn);
+        ar& BOOST_SERIALIZATION_NVP(valid);
+        ar& BOOST_SERIALIZATION_NVP(snr_dbhz);
+        ar& BOOST_SERIALIZATION_NVP(azimuth_rad);
+        ar& BOOST_SERIALIZATION_NVP(elevation_rad);
+        ar& BOOST_SERIALIZATION_NVP(pseudorange_residual_m);
+        ar& BOOST_SERIALIZATION_NVP(carrier_phase_residual_m);
+    }
+};
+
+
 /*!
  * \brief This class contains parameters and outputs of the PVT block
  */
@@ -84,6 +134,9 @@ public:
     // User clock drift [ppm]
     double user_clk_drift_ppm;
 
+    // Per-satellite residuals of the epoch
+    std::vector<Monitor_Sat_Residual> sat_residuals;
+
     /*!
      * \brief This member function serializes and restores
      * Monitor_Pvt objects from a byte stream.
@@ -131,6 +184,8 @@ public:
         ar& BOOST_SERIALIZATION_NVP(vdop);
 
         ar& BOOST_SERIALIZATION_NVP(user_clk_drift_ppm);
+
+        ar& BOOST_SERIALIZATION_NVP(sat_residuals);
     }
 };
 
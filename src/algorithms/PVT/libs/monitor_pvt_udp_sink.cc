@@ -16,6 +16,7 @@
  */
 
 #include "monitor_pvt_udp_sink.h"
+#include "gnss_sdr_make_unique.h"
 #include <boost/archive/binary_oarchive.hpp>
 #include <iostream>
 #include <sstream>
@@ -23,8 +24,9 @@
 
 Monitor_Pvt_Udp_Sink::Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addresses,
     const uint16_t& port,
-    bool protobuf_enabled) : socket{io_context},
-                             use_protobuf(protobuf_enabled)
+    bool protobuf_enabled,
+    bool enable_delta_compression) : socket{io_context},
+                                     use_protobuf(protobuf_enabled)
 {
     for (const auto& address : addresses)
         {
@@ -36,6 +38,11 @@ Monitor_Pvt_Udp_Sink::Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addre
         {
             serdes = Serdes_Monitor_Pvt();
         }
+
+    if (enable_delta_compression)
+        {
+            delta_codec = std::make_unique<Monitor_Delta_Codec>();
+        }
 }
 
 
@@ -54,9 +61,16 @@ bool Monitor_Pvt_Udp_Sink::write_monitor_pvt(const Monitor_Pvt* const monitor_pv
             outbound_data = serdes.createProtobuffer(monitor_pvt);
         }
 
+    if (delta_codec)
+        {
+            outbound_data = delta_codec->encode(outbound_data.data(), outbound_data.size());
+        }
+
     for (const auto& endpoint : endpoints)
         {
             socket.open(endpoint.protocol(), error);
+            // never block the PVT block on a slow or dead subscriber
+            socket.non_blocking(true, error);
 
             try
                 {
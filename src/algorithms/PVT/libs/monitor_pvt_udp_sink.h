@@ -18,6 +18,7 @@
 #ifndef GNSS_SDR_MONITOR_PVT_UDP_SINK_H
 #define GNSS_SDR_MONITOR_PVT_UDP_SINK_H
 
+#include "monitor_delta_codec.h"
 #include "monitor_pvt.h"
 #include "serdes_monitor_pvt.h"
 #include <boost/asio.hpp>
@@ -40,11 +41,12 @@ using b_io_context = boost::asio::io_service;
 class Monitor_Pvt_Udp_Sink
 {
 public:
-    Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled);
+    Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled, bool enable_delta_compression = false);
     bool write_monitor_pvt(const Monitor_Pvt* const monitor_pvt);
 
 private:
     Serdes_Monitor_Pvt serdes;
+    std::unique_ptr<Monitor_Delta_Codec> delta_codec;  // optional delta framing layer
     b_io_context io_context;
     boost::asio::ip::udp::socket socket;
     std::vector<boost::asio::ip::udp::endpoint> endpoints;
@@ -0,0 +1,177 @@
+/*!
+ * \file nav_data_validator.cc
+ * \brief Worker pool running consistency checks on decoded navigation data
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "nav_data_validator.h"
+#include <glog/logging.h>
+#include <cmath>
+#include <utility>
+
+Nav_Data_Validator::Nav_Data_Validator(uint32_t num_workers)
+{
+    if (num_workers < 1)
+        {
+            num_workers = 1;
+        }
+    running_ = true;
+    workers_.reserve(num_workers);
+    for (uint32_t n = 0; n < num_workers; n++)
+        {
+            workers_.emplace_back(&Nav_Data_Validator::worker_loop, this);
+        }
+}
+
+
+Nav_Data_Validator::~Nav_Data_Validator()
+{
+    running_ = false;
+    for (auto& worker : workers_)
+        {
+            if (worker.joinable())
+                {
+                    worker.join();
+                }
+        }
+    if (rejected_records_.load() > 0)
+        {
+            LOG(INFO) << "Navigation data validator rejected " << rejected_records_.load() << " records";
+        }
+}
+
+
+void Nav_Data_Validator::worker_loop()
+{
+    std::function<void()> task;
+    while (running_.load() || !task_queue_.empty())
+        {
+            if (task_queue_.timed_wait_and_pop(task, 100))
+                {
+                    task();
+                }
+        }
+}
+
+
+uint64_t Nav_Data_Validator::revision() const
+{
+    return revision_.load();
+}
+
+
+std::shared_ptr<const std::map<int, Gps_Ephemeris>> Nav_Data_Validator::get_validated_gps_eph() const
+{
+    return validated_gps_eph_map_.get_snapshot();
+}
+
+
+std::shared_ptr<const std::map<int, Galileo_Ephemeris>> Nav_Data_Validator::get_validated_galileo_eph() const
+{
+    return validated_galileo_eph_map_.get_snapshot();
+}
+
+
+bool Nav_Data_Validator::validate_keplerian(const Gnss_Ephemeris& eph)
+{
+    // plausibility ranges for a MEO navigation satellite; a decoded record
+    // violating any of them is necessarily corrupted (or forged)
+    if (eph.PRN < 1 or eph.PRN > 63)
+        {
+            return false;
+        }
+    if (eph.sqrtA < 4500.0 or eph.sqrtA > 6500.0)  // GPS ~5153.7, Galileo ~5440.6 m^1/2
+        {
+            return false;
+        }
+    if (eph.ecc < 0.0 or eph.ecc > 0.05)
+        {
+            return false;
+        }
+    if (eph.toe < 0 or eph.toe >= 604800 or eph.toc < 0 or eph.toc >= 604800)
+        {
+            return false;
+        }
+    if (eph.i_0 < 0.2 or eph.i_0 > 1.6)  // inclination ~0.96-0.99 rad
+        {
+            return false;
+        }
+    if (std::fabs(eph.delta_n) > 1e-6 or std::fabs(eph.OMEGAdot) > 1e-6 or std::fabs(eph.idot) > 1e-6)
+        {
+            return false;
+        }
+    if (std::fabs(eph.Cuc) > 1e-3 or std::fabs(eph.Cus) > 1e-3 or
+        std::fabs(eph.Cic) > 1e-3 or std::fabs(eph.Cis) > 1e-3 or
+        std::fabs(eph.Crc) > 1e4 or std::fabs(eph.Crs) > 1e4)
+        {
+            return false;
+        }
+    if (std::fabs(eph.af0) > 1e-2 or std::fabs(eph.af1) > 1e-8 or std::fabs(eph.af2) > 1e-14)
+        {
+            return false;
+        }
+    return true;
+}
+
+
+void Nav_Data_Validator::enqueue(const std::shared_ptr<Gps_Ephemeris>& eph)
+{
+    task_queue_.push([this, eph]() {
+        if (!validate_keplerian(*eph))
+            {
+                rejected_records_++;
+                LOG(WARNING) << "Discarding GPS ephemeris from PRN " << eph->PRN << ": parameters out of range";
+                return;
+            }
+        // a repeated broadcast of the same data set must be bit-identical
+        Gps_Ephemeris previous_eph;
+        if (validated_gps_eph_map_.read(static_cast<int>(eph->PRN), previous_eph))
+            {
+                if (previous_eph.toe == eph->toe and previous_eph.WN == eph->WN and
+                    (previous_eph.M_0 != eph->M_0 or previous_eph.sqrtA != eph->sqrtA or previous_eph.af0 != eph->af0))
+                    {
+                        rejected_records_++;
+                        LOG(WARNING) << "Discarding GPS ephemeris from PRN " << eph->PRN << ": inconsistent repetition of Toe " << eph->toe;
+                        return;
+                    }
+            }
+        validated_gps_eph_map_.write(static_cast<int>(eph->PRN), *eph);
+        revision_++;
+    });
+}
+
+
+void Nav_Data_Validator::enqueue(const std::shared_ptr<Galileo_Ephemeris>& eph)
+{
+    task_queue_.push([this, eph]() {
+        if (!validate_keplerian(*eph))
+            {
+                rejected_records_++;
+                LOG(WARNING) << "Discarding Galileo ephemeris from PRN " << eph->PRN << ": parameters out of range";
+                return;
+            }
+        Galileo_Ephemeris previous_eph;
+        if (validated_galileo_eph_map_.read(static_cast<int>(eph->PRN), previous_eph))
+            {
+                if (previous_eph.toe == eph->toe and previous_eph.WN == eph->WN and
+                    (previous_eph.M_0 != eph->M_0 or previous_eph.sqrtA != eph->sqrtA or previous_eph.af0 != eph->af0))
+                    {
+                        rejected_records_++;
+                        LOG(WARNING) << "Discarding Galileo ephemeris from PRN " << eph->PRN << ": inconsistent repetition of Toe " << eph->toe;
+                        return;
+                    }
+            }
+        validated_galileo_eph_map_.write(static_cast<int>(eph->PRN), *eph);
+        revision_++;
+    });
+}
@@ -0,0 +1,90 @@
+/*!
+ * \file nav_data_validator.h
+ * \brief Worker pool running consistency checks on decoded navigation data
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_NAV_DATA_VALIDATOR_H
+#define GNSS_SDR_NAV_DATA_VALIDATOR_H
+
+#include "concurrent_queue.h"
+#include "concurrent_snapshot_map.h"
+#include "galileo_ephemeris.h"
+#include "gnss_ephemeris.h"
+#include "gps_ephemeris.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+/*!
+ * \brief This class runs plausibility and consistency checks on decoded
+ * navigation data in a small worker pool, off the thread that received it.
+ *
+ * A burst of simultaneous subframe completions across many channels would
+ * otherwise execute all the checks inline in the PVT message handler, which
+ * shares its thread with the PVT computation. Verified records are published
+ * in thread-safe maps and merged back by the consumer at its own pace.
+ */
+class Nav_Data_Validator
+{
+public:
+    //! Starts the worker pool (at least one thread)
+    explicit Nav_Data_Validator(uint32_t num_workers);
+
+    //! Drains the pending tasks and joins the workers
+    ~Nav_Data_Validator();
+
+    //! Queues a GPS LNAV ephemeris for validation
+    void enqueue(const std::shared_ptr<Gps_Ephemeris>& eph);
+
+    //! Queues a Galileo I/NAV - F/NAV ephemeris for validation
+    void enqueue(const std::shared_ptr<Galileo_Ephemeris>& eph);
+
+    //! Counter increased every time a record passes validation, so consumers
+    //! can skip the map copies when nothing new has arrived
+    uint64_t revision() const;
+
+    //! Lock-free snapshot of the validated GPS ephemerides, keyed by PRN
+    std::shared_ptr<const std::map<int, Gps_Ephemeris>> get_validated_gps_eph() const;
+
+    //! Lock-free snapshot of the validated Galileo ephemerides, keyed by PRN
+    std::shared_ptr<const std::map<int, Galileo_Ephemeris>> get_validated_galileo_eph() const;
+
+    //! Plausibility checks on the broadcast Keplerian parameters
+    static bool validate_keplerian(const Gnss_Ephemeris& eph);
+
+private:
+    void worker_loop();
+
+    Concurrent_Queue<std::function<void()>> task_queue_;
+    Concurrent_Snapshot_Map<Gps_Ephemeris> validated_gps_eph_map_;
+    Concurrent_Snapshot_Map<Galileo_Ephemeris> validated_galileo_eph_map_;
+    std::vector<std::thread> workers_;
+    std::atomic<uint64_t> revision_{0};
+    std::atomic<uint64_t> rejected_records_{0};
+    std::atomic<bool> running_{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_NAV_DATA_VALIDATOR_H
@@ -21,10 +21,9 @@
 
 #include "nmea_printer.h"
 #include "gnss_sdr_filesystem.h"
+#include "pvt_solution_snapshot.h"
 #include "rtklib_solution.h"
-#include "rtklib_solver.h"
 #include <glog/logging.h>
-#include <array>
 #include <cstdint>
 #include <exception>
 #include <fcntl.h>
@@ -100,8 +99,6 @@ Nmea_Printer::Nmea_Printer(const std::string& filename,
         {
             nmea_dev_descriptor = -1;
         }
-
-    d_PVT_data = nullptr;
 }
 
 
@@ -190,33 +187,19 @@ void Nmea_Printer::close_serial() const
 }
 
 
-bool Nmea_Printer::Print_Nmea_Line(const Rtklib_Solver* const pvt_data)
+bool Nmea_Printer::Print_Nmea_Line(const Pvt_Solution_Snapshot* const pvt_data)
 {
-    // set the new PVT data
-    d_PVT_data = pvt_data;
-
     // generate the NMEA sentences
-
-    // GPRMC
-    const std::string GPRMC = get_GPRMC();
-    // GPGGA (Global Positioning System Fixed Data)
-    const std::string GPGGA = get_GPGGA();
-    // GPGSA
-    const std::string GPGSA = get_GPGSA();
-    // GPGSV
-    const std::string GPGSV = get_GPGSV();
+    const size_t len = build_nmea_sentences(pvt_data);
+    const char* sentences = reinterpret_cast<const char*>(d_sentence_buffer.data());
 
     // write to log file
     if (d_flag_nmea_output_file)
         {
             try
                 {
-                    nmea_file_descriptor
-                        << GPRMC
-                        << GPGGA  // GPGGA (Global Positioning System Fixed Data)
-                        << GPGSA
-                        << GPGSV
-                        << std::flush;
+                    nmea_file_descriptor.write(sentences, len);
+                    nmea_file_descriptor.flush();
                 }
             catch (const std::exception& ex)
                 {
@@ -227,22 +210,7 @@ bool Nmea_Printer::Print_Nmea_Line(const Rtklib_Solver* const pvt_data)
     // write to serial device
     if (nmea_dev_descriptor != -1)
         {
-            if (write(nmea_dev_descriptor, GPRMC.c_str(), GPRMC.length()) == -1)
-                {
-                    DLOG(INFO) << "NMEA printer cannot write on serial device" << nmea_devname.c_str();
-                    return false;
-                }
-            if (write(nmea_dev_descriptor, GPGGA.c_str(), GPGGA.length()) == -1)
-                {
-                    DLOG(INFO) << "NMEA printer cannot write on serial device" << nmea_devname.c_str();
-                    return false;
-                }
-            if (write(nmea_dev_descriptor, GPGSA.c_str(), GPGSA.length()) == -1)
-                {
-                    DLOG(INFO) << "NMEA printer cannot write on serial device" << nmea_devname.c_str();
-                    return false;
-                }
-            if (write(nmea_dev_descriptor, GPGSV.c_str(), GPGSV.length()) == -1)
+            if (write(nmea_dev_descriptor, sentences, len) == -1)
                 {
                     DLOG(INFO) << "NMEA printer cannot write on serial device" << nmea_devname.c_str();
                     return false;
@@ -252,184 +220,18 @@ bool Nmea_Printer::Print_Nmea_Line(const Rtklib_Solver* const pvt_data)
 }
 
 
-char Nmea_Printer::checkSum(const std::string& sentence) const
-{
-    char check = 0;
-    // iterate over the string, XOR each byte with the total sum:
-    for (char c : sentence)
-        {
-            check = static_cast<char>(check ^ c);
-        }
-    // return the result
-    return check;
-}
-
-
-std::string Nmea_Printer::latitude_to_hm(double lat) const
-{
-    bool north;
-    if (lat < 0.0)
-        {
-            north = false;
-            lat = -lat;
-        }
-    else
-        {
-            north = true;
-        }
-
-    const int deg = static_cast<int>(lat);
-    double mins = lat - static_cast<double>(deg);
-    mins *= 60.0;
-    std::ostringstream out_string;
-    out_string.setf(std::ios::fixed, std::ios::floatfield);
-    out_string.fill('0');
-    out_string.width(2);
-    out_string << deg;
-    out_string.width(2);
-    out_string << static_cast<int>(mins) << ".";
-    out_string.width(4);
-    out_string << static_cast<int>((mins - static_cast<double>(static_cast<int>(mins))) * 1e4);
-
-    if (north == true)
-        {
-            out_string << ",N";
-        }
-    else
-        {
-            out_string << ",S";
-        }
-    return out_string.str();
-}
-
-
-std::string Nmea_Printer::longitude_to_hm(double longitude) const
-{
-    bool east;
-    if (longitude < 0.0)
-        {
-            east = false;
-            longitude = -longitude;
-        }
-    else
-        {
-            east = true;
-        }
-    const int deg = static_cast<int>(longitude);
-    double mins = longitude - static_cast<double>(deg);
-    mins *= 60.0;
-    std::ostringstream out_string;
-    out_string.setf(std::ios::fixed, std::ios::floatfield);
-    out_string.width(3);
-    out_string.fill('0');
-    out_string << deg;
-    out_string.width(2);
-    out_string << static_cast<int>(mins) << ".";
-    out_string.width(4);
-    out_string << static_cast<int>((mins - static_cast<double>(static_cast<int>(mins))) * 1e4);
-
-    if (east == true)
-        {
-            out_string << ",E";
-        }
-    else
-        {
-            out_string << ",W";
-        }
-    return out_string.str();
-}
-
-
-std::string Nmea_Printer::get_UTC_NMEA_time(const boost::posix_time::ptime d_position_UTC_time) const
-{
-    // UTC Time: hhmmss.sss
-    std::stringstream sentence_str;
-
-    const boost::posix_time::time_duration td = d_position_UTC_time.time_of_day();
-    const int utc_hours = td.hours();
-    const int utc_mins = td.minutes();
-    const int utc_seconds = td.seconds();
-    const auto utc_milliseconds = static_cast<int>(td.total_milliseconds() - td.total_seconds() * 1000);
-
-    if (utc_hours < 10)
-        {
-            sentence_str << "0";  //  two digits for hours
-        }
-    sentence_str << utc_hours;
-
-    if (utc_mins < 10)
-        {
-            sentence_str << "0";  //  two digits for minutes
-        }
-    sentence_str << utc_mins;
-
-    if (utc_seconds < 10)
-        {
-            sentence_str << "0";  //  two digits for seconds
-        }
-    sentence_str << utc_seconds;
-
-    if (utc_milliseconds < 10)
-        {
-            sentence_str << ".00";  //  three digits for ms
-            sentence_str << utc_milliseconds;
-        }
-    else if (utc_milliseconds < 100)
-        {
-            sentence_str << ".0";  //   three digits for ms
-            sentence_str << utc_milliseconds;
-        }
-    else
-        {
-            sentence_str << ".";  //   three digits for ms
-            sentence_str << utc_milliseconds;
-        }
-    return sentence_str.str();
-}
-
-
-std::string Nmea_Printer::get_GPRMC() const
-{
-    // Sample -> $GPRMC,161229.487,A,3723.2475,N,12158.3416,W,0.13,309.62,120598,*10
-    std::stringstream sentence_str;
-    std::array<unsigned char, 1024> buff{};
-    outnmea_rmc(buff.data(), &d_PVT_data->pvt_sol);
-    sentence_str << buff.data();
-    return sentence_str.str();
-}
-
-
-std::string Nmea_Printer::get_GPGSA() const
+size_t Nmea_Printer::build_nmea_sentences(const Pvt_Solution_Snapshot* pvt_data)
 {
+    // Samples:
+    // $GPRMC,161229.487,A,3723.2475,N,12158.3416,W,0.13,309.62,120598,*10
+    // $GPGGA,104427.591,5920.7009,N,01803.2938,E,1,05,3.3,78.2,M,23.2,M,0.0,0000*4A
     // $GPGSA,A,3,07,02,26,27,09,04,15, , , , , ,1.8,1.0,1.5*33
-    // GSA-GNSS DOP and Active Satellites
-    std::stringstream sentence_str;
-    std::array<unsigned char, 1024> buff{};
-    outnmea_gsa(buff.data(), &d_PVT_data->pvt_sol, d_PVT_data->pvt_ssat.data());
-    sentence_str << buff.data();
-    return sentence_str.str();
-}
-
-
-std::string Nmea_Printer::get_GPGSV() const
-{
-    // GSV-GNSS Satellites in View
     // $GPGSV,2,1,07,07,79,048,42,02,51,062,43,26,36,256,42,27,27,138,42,1*71
     // Notice that NMEA 2.1 only supports 12 channels
-    std::stringstream sentence_str;
-    std::array<unsigned char, 1024> buff{};
-    outnmea_gsv(buff.data(), &d_PVT_data->pvt_sol, d_PVT_data->pvt_ssat.data());
-    sentence_str << buff.data();
-    return sentence_str.str();
-}
-
-
-std::string Nmea_Printer::get_GPGGA() const
-{
-    std::stringstream sentence_str;
-    std::array<unsigned char, 1024> buff{};
-    outnmea_gga(buff.data(), &d_PVT_data->pvt_sol);
-    sentence_str << buff.data();
-    return sentence_str.str();
-    // $GPGGA,104427.591,5920.7009,N,01803.2938,E,1,05,3.3,78.2,M,23.2,M,0.0,0000*4A
+    unsigned char* p = d_sentence_buffer.data();
+    p += outnmea_rmc(p, &pvt_data->pvt_sol);
+    p += outnmea_gga(p, &pvt_data->pvt_sol);
+    p += outnmea_gsa(p, &pvt_data->pvt_sol, pvt_data->pvt_ssat.data());
+    p += outnmea_gsv(p, &pvt_data->pvt_sol, pvt_data->pvt_ssat.data());
+    return static_cast<size_t>(p - d_sentence_buffer.data());
 }
@@ -22,10 +22,10 @@
 #ifndef GNSS_SDR_NMEA_PRINTER_H
 #define GNSS_SDR_NMEA_PRINTER_H
 
-#include <boost/date_time/posix_time/ptime.hpp>  // for ptime
-#include <fstream>                               // for ofstream
-#include <memory>                                // for shared_ptr
-#include <string>                                // for string
+#include <array>    // for array
+#include <cstddef>  // for size_t
+#include <fstream>  // for ofstream
+#include <string>   // for string
 
 /** \addtogroup PVT
  * \{ */
@@ -33,7 +33,7 @@
  * \{ */
 
 
-class Rtklib_Solver;
+class Pvt_Solution_Snapshot;
 
 /*!
  * \brief This class provides a implementation of a subset of the NMEA-0183 standard for interfacing
@@ -57,21 +57,17 @@ public:
     /*!
      * \brief Print NMEA PVT and satellite info to the initialized device
      */
-    bool Print_Nmea_Line(const Rtklib_Solver* const pvt_data);
+    bool Print_Nmea_Line(const Pvt_Solution_Snapshot* const pvt_data);
 
 private:
     int init_serial(const std::string& serial_device);  // serial port control
     void close_serial() const;
-    std::string get_GPGGA() const;  // fix data
-    std::string get_GPGSV() const;  // satellite data
-    std::string get_GPGSA() const;  // overall satellite reception data
-    std::string get_GPRMC() const;  // minimum recommended data
-    std::string get_UTC_NMEA_time(const boost::posix_time::ptime d_position_UTC_time) const;
-    std::string longitude_to_hm(double longitude) const;
-    std::string latitude_to_hm(double lat) const;
-    char checkSum(const std::string& sentence) const;
-
-    const Rtklib_Solver* d_PVT_data;
+
+    // builds the RMC, GGA, GSA and GSV sentences back to back in
+    // d_sentence_buffer and returns the total length in bytes
+    size_t build_nmea_sentences(const Pvt_Solution_Snapshot* pvt_data);
+
+    std::array<unsigned char, 4096> d_sentence_buffer{};  // reused across epochs so an output epoch does not allocate
 
     std::ofstream nmea_file_descriptor;  // Output file stream for NMEA log file
 
@@ -33,6 +33,7 @@ public:
     std::map<int, int> rtcm_msg_rate_ms;
 
     std::string rinex_name = std::string("-");
+    std::string rinex_output_compression = std::string("none");
     std::string dump_filename;
     std::string nmea_dump_filename;
     std::string nmea_dump_devname;
@@ -63,6 +64,14 @@ public:
     int32_t rinexobs_rate_ms = 0;
     int32_t an_rate_ms = 1000;
     int32_t max_obs_block_rx_clock_offset_ms = 40;
+    // bounded-latency real-time mode: wall-clock deadline for an observables
+    // epoch to reach the PVT block. Epochs already past the deadline are
+    // skipped when fresher ones are queued behind them, with a cap on
+    // consecutive skips to preserve observation continuity for the RTK
+    // ambiguity filter. 0 disables the mode. It requires
+    // GNSS-SDR.enable_latency_trace=true for the epoch age measurement
+    int32_t rt_deadline_ms = 0;
+    int32_t rt_max_consecutive_skips = 5;
     int udp_port = 0;
     int udp_eph_port = 0;
     int rtk_trace_level = 0;
@@ -85,7 +94,9 @@ public:
     bool monitor_enabled = false;
     bool monitor_ephemeris_enabled = false;
     bool protobuf_enabled = true;
+    bool monitor_delta_compression_enabled = false;
     bool enable_rx_clock_correction = true;
+    bool enable_clock_steering = false;
     bool show_local_time_zone = false;
     bool pre_2009_file = false;
     bool dump = false;
@@ -95,12 +106,31 @@ public:
     bool use_has_corrections = true;
     bool use_unhealthy_sats = false;
 
+    // Vector tracking assistance parameters
+    bool enable_vtl_assist = false;
+    int32_t vtl_assist_coast_time_s = 10;
+
+    // Navigation data validation parameters
+    bool enable_nav_data_validation = false;
+    int32_t nav_validation_threads = 2;
+
     // PVT KF parameters
     bool enable_pvt_kf = false;
     double measures_ecef_pos_sd_m = 1.0;
     double measures_ecef_vel_sd_ms = 0.1;
     double system_ecef_pos_sd_m = 0.01;
     double system_ecef_vel_sd_ms = 0.001;
+
+    // PVT KF fast mode parameters (static receivers)
+    bool enable_pvt_kf_fast_mode = false;
+    double kf_fast_mode_full_update_interval_s = 1.0;
+    double kf_fast_mode_innovation_threshold_m = 10.0;
+
+    // Per-constellation integrity sub-solutions: besides the combined
+    // solution, each epoch computes a single-point solution restricted to
+    // every constellation with enough observables, evaluated in parallel
+    // threads sharing one satellite position computation
+    bool enable_sub_solutions = false;
 };
 
 
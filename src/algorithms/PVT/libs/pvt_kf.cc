@@ -123,6 +123,24 @@ void Pvt_Kf::run_Kf(const arma::vec& p, const arma::vec& v)
 }
 
 
+void Pvt_Kf::predict_Kf()
+{
+    if (d_initialized)
+        {
+            // time update only, for the epochs without a measurement
+            d_x_new_old = d_F * d_x_old_old;
+            d_P_new_old = d_F * d_P_old_old * d_F.t() + d_Q;
+
+            d_x_new_new = d_x_new_old;
+            d_P_new_new = d_P_new_old;
+
+            // prepare data for next KF epoch
+            d_x_old_old = d_x_new_new;
+            d_P_old_old = d_P_new_new;
+        }
+}
+
+
 void Pvt_Kf::get_pv_Kf(arma::vec& p, arma::vec& v) const
 {
     if (d_initialized)
@@ -44,6 +44,7 @@ public:
         double system_ecef_vel_sd_ms);
     bool is_initialized() const;
     void run_Kf(const arma::vec& p, const arma::vec& v);
+    void predict_Kf();
     void get_pv_Kf(arma::vec& p, arma::vec& v) const;
     void reset_Kf();
 
@@ -0,0 +1,53 @@
+/*!
+ * \file pvt_solution_snapshot.cc
+ * \brief Implementation of a self-contained copy of a PVT solution epoch
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pvt_solution_snapshot.h"
+#include "rtklib_solver.h"
+
+Pvt_Solution_Snapshot::Pvt_Solution_Snapshot(const Rtklib_Solver& solver)
+    : Pvt_Solution(solver),
+      pvt_sol(solver.pvt_sol),
+      pvt_ssat(solver.pvt_ssat),
+      d_hdop(solver.get_hdop()),
+      d_vdop(solver.get_vdop()),
+      d_pdop(solver.get_pdop()),
+      d_gdop(solver.get_gdop())
+{
+}
+
+
+double Pvt_Solution_Snapshot::get_hdop() const
+{
+    return d_hdop;
+}
+
+
+double Pvt_Solution_Snapshot::get_vdop() const
+{
+    return d_vdop;
+}
+
+
+double Pvt_Solution_Snapshot::get_pdop() const
+{
+    return d_pdop;
+}
+
+
+double Pvt_Solution_Snapshot::get_gdop() const
+{
+    return d_gdop;
+}
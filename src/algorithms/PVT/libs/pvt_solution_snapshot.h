@@ -0,0 +1,62 @@
+/*!
+ * \file pvt_solution_snapshot.h
+ * \brief Interface of a self-contained copy of a PVT solution epoch
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PVT_SOLUTION_SNAPSHOT_H
+#define GNSS_SDR_PVT_SOLUTION_SNAPSHOT_H
+
+#include "pvt_solution.h"
+#include "rtklib.h"
+#include <array>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+class Rtklib_Solver;
+
+/*!
+ * \brief Self-contained copy of one PVT solution epoch.
+ *
+ * It captures everything the position and NMEA printers read from the
+ * solver, so output sinks can run in a writer thread while the solver
+ * moves on to the next epoch.
+ */
+class Pvt_Solution_Snapshot : public Pvt_Solution
+{
+public:
+    Pvt_Solution_Snapshot() = default;
+    explicit Pvt_Solution_Snapshot(const Rtklib_Solver& solver);
+
+    double get_hdop() const override;
+    double get_vdop() const override;
+    double get_pdop() const override;
+    double get_gdop() const override;
+
+    sol_t pvt_sol{};
+    std::array<ssat_t, MAXSAT> pvt_ssat{};
+
+private:
+    double d_hdop{0.0};
+    double d_vdop{0.0};
+    double d_pdop{0.0};
+    double d_gdop{0.0};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_PVT_SOLUTION_SNAPSHOT_H
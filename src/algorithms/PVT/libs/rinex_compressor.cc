@@ -0,0 +1,90 @@
+/*!
+ * \file rinex_compressor.cc
+ * \brief Streaming gzip compression of finished RINEX files
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rinex_compressor.h"
+#include "gnss_sdr_filesystem.h"
+#include <glog/logging.h>
+#include <exception>  // for exception
+#include <fstream>    // for ifstream, ofstream
+
+#if USE_BOOST_IOSTREAMS
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <array>  // for array
+#endif
+
+
+bool rinex_gzip_file(const std::string& filename)
+{
+#if USE_BOOST_IOSTREAMS
+    const std::string gz_filename = filename + ".gz";
+    try
+        {
+            std::ifstream in(filename, std::ios::in | std::ios::binary);
+            if (!in.is_open())
+                {
+                    LOG(WARNING) << "Could not open " << filename << " for compression";
+                    return false;
+                }
+            std::ofstream gz_file(gz_filename, std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!gz_file.is_open())
+                {
+                    LOG(WARNING) << "Could not create " << gz_filename;
+                    return false;
+                }
+            boost::iostreams::filtering_ostream out;
+            out.push(boost::iostreams::gzip_compressor());
+            out.push(gz_file);
+            // stream in bounded chunks so arbitrarily long sessions do not
+            // need the whole file in memory
+            std::array<char, 65536> buffer{};
+            while (in)
+                {
+                    in.read(buffer.data(), buffer.size());
+                    if (in.gcount() > 0)
+                        {
+                            out.write(buffer.data(), in.gcount());
+                        }
+                }
+            out.reset();  // flush the gzip trailer and close the chain
+            if (!gz_file.good())
+                {
+                    LOG(WARNING) << "Error writing " << gz_filename << ", keeping the uncompressed file";
+                    errorlib::error_code ec;
+                    fs::remove(fs::path(gz_filename), ec);
+                    return false;
+                }
+            gz_file.close();
+            in.close();
+        }
+    catch (const std::exception& e)
+        {
+            LOG(WARNING) << "Error compressing " << filename << ": " << e.what();
+            errorlib::error_code ec;
+            fs::remove(fs::path(gz_filename), ec);
+            return false;
+        }
+    errorlib::error_code ec;
+    if (!fs::remove(fs::path(filename), ec))
+        {
+            LOG(INFO) << "Error deleting " << filename << " after compression";
+        }
+    return true;
+#else
+    LOG(WARNING) << "RINEX compression requested but GNSS-SDR was built without Boost Iostreams, keeping " << filename << " uncompressed";
+    return false;
+#endif
+}
@@ -0,0 +1,43 @@
+/*!
+ * \file rinex_compressor.h
+ * \brief Streaming gzip compression of finished RINEX files
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_RINEX_COMPRESSOR_H
+#define GNSS_SDR_RINEX_COMPRESSOR_H
+
+#include <string>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+/*!
+ * \brief Compresses a finished RINEX file into <filename>.gz
+ *
+ * The file is streamed through a gzip filter in fixed-size chunks, so the
+ * memory usage stays bounded regardless of the file size. On success the
+ * plain-text file is removed and true is returned; on failure the original
+ * file is kept, any partial archive is removed, and false is returned.
+ *
+ * Requires GNSS-SDR to be built with Boost Iostreams; otherwise a warning
+ * is logged and the file is left uncompressed.
+ */
+bool rinex_gzip_file(const std::string& filename);
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_RINEX_COMPRESSOR_H
@@ -38,6 +38,7 @@
 #include "gps_iono.h"
 #include "gps_navigation_message.h"
 #include "gps_utc_model.h"
+#include "rinex_compressor.h"
 #include "rtklib_solver.h"
 #include <boost/date_time/gregorian/gregorian.hpp>
 #include <boost/date_time/local_time/local_time.hpp>
@@ -51,6 +52,7 @@
 #include <iterator>
 #include <ostream>
 #include <set>
+#include <thread>    // for thread
 #include <unistd.h>  // for getlogin_r()
 #include <utility>
 #include <vector>
@@ -58,13 +60,19 @@
 
 Rinex_Printer::Rinex_Printer(int32_t conf_version,
     const std::string& base_path,
-    const std::string& base_name) : d_fake_cnav_iode(1),
-                                    d_numberTypesObservations(4),
-                                    d_rinex_header_updated(false),
-                                    d_rinex_header_written(false),
-                                    d_pre_2009_file(false)
+    const std::string& base_name,
+    const std::string& compression) : d_fake_cnav_iode(1),
+                                      d_numberTypesObservations(4),
+                                      d_rinex_header_updated(false),
+                                      d_rinex_header_written(false),
+                                      d_pre_2009_file(false),
+                                      d_gzip_output(compression == "gzip")
 
 {
+    if (compression != "none" && compression != "gzip")
+        {
+            std::cout << "Unknown RINEX compression mode " << compression << ", writing plain-text files\n";
+        }
     // RINEX v3.02 codes
     satelliteSystem["GPS"] = "G";
     satelliteSystem["GLONASS"] = "R";
@@ -298,6 +306,45 @@ Rinex_Printer::~Rinex_Printer()
                     LOG(INFO) << "Error deleting temporary file";
                 }
         }
+
+    // Compress the files that were kept, each on its own thread so the
+    // receiver shutdown only waits for the largest one
+    if (d_gzip_output)
+        {
+            std::vector<std::thread> compressors;
+            if (posn != 0)
+                {
+                    compressors.emplace_back(rinex_gzip_file, navfilename);
+                }
+            if (poso != 0)
+                {
+                    compressors.emplace_back(rinex_gzip_file, obsfilename);
+                }
+            if (poss != 0)
+                {
+                    compressors.emplace_back(rinex_gzip_file, sbsfilename);
+                }
+            if (posng != 0)
+                {
+                    compressors.emplace_back(rinex_gzip_file, navGalfilename);
+                }
+            if (posmn != 0)
+                {
+                    compressors.emplace_back(rinex_gzip_file, navMixfilename);
+                }
+            if (posnr != 0)
+                {
+                    compressors.emplace_back(rinex_gzip_file, navGlofilename);
+                }
+            if (posnc != 0)
+                {
+                    compressors.emplace_back(rinex_gzip_file, navBdsfilename);
+                }
+            for (auto& compressor : compressors)
+                {
+                    compressor.join();
+                }
+        }
 }
 
 
@@ -1518,6 +1565,43 @@ void Rinex_Printer::log_rinex_nav_bds_dnav(int type_of_rx, const std::map<int32_
 }
 
 
+void Rinex_Printer::print_gps_nav_header(const Gps_Iono& iono,
+    const Gps_Utc_Model& utc_model,
+    const Gps_Ephemeris& eph)
+{
+    rinex_nav_header(navFile, iono, utc_model, eph);
+    output_navfilename.push_back(navfilename);
+    d_rinex_header_written = true;
+}
+
+
+void Rinex_Printer::print_gps_cnav_header(const Gps_CNAV_Iono& iono,
+    const Gps_CNAV_Utc_Model& utc_model)
+{
+    rinex_nav_header(navFile, iono, utc_model);
+    output_navfilename.push_back(navfilename);
+    d_rinex_header_written = true;
+}
+
+
+void Rinex_Printer::print_gal_nav_header(const Galileo_Iono& iono,
+    const Galileo_Utc_Model& utc_model)
+{
+    rinex_nav_header(navGalFile, iono, utc_model);
+    output_navfilename.push_back(navGalfilename);
+    d_rinex_header_written = true;
+}
+
+
+void Rinex_Printer::print_glo_gnav_header(const Glonass_Gnav_Utc_Model& utc_model,
+    const Glonass_Gnav_Ephemeris& eph)
+{
+    rinex_nav_header(navGloFile, utc_model, eph);
+    output_navfilename.push_back(navGlofilename);
+    d_rinex_header_written = true;
+}
+
+
 void Rinex_Printer::lengthCheck(const std::string& line) const
 {
     if (line.length() != 80)
@@ -10109,7 +10193,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Glonass_Gnav_Ephemeri
                     line += std::to_string(static_cast<int32_t>(observables_iter->second.PRN));
                 }
             // Receiver clock offset (optional)
-            // line += rightJustify(asString(clockOffset, 12), 15);
+            // line += Rinex_Printer::fixedWidthString(clockOffset, 15, 12);
             line += std::string(80 - line.size(), ' ');
             Rinex_Printer::lengthCheck(line);
             out << line << '\n';
@@ -10123,7 +10207,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Glonass_Gnav_Ephemeri
                     line.clear();
                     // GLONASS L1 PSEUDORANGE
                     line += std::string(2, ' ');
-                    lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Pseudorange_m, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Pseudorange_m, 14, 3);
 
                     // Loss of lock indicator (LLI)
                     int32_t lli = 0;  // Include in the observation!!
@@ -10140,7 +10224,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Glonass_Gnav_Ephemeri
                     const int32_t ssi = Rinex_Printer::signalStrength(observables_iter->second.CN0_dB_hz);
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
                     // GLONASS L1 CA PHASE
-                    lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_phase_rads / TWO_PI, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_phase_rads / TWO_PI, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -10151,7 +10235,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Glonass_Gnav_Ephemeri
                     //    }
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
                     // GLONASS L1 CA DOPPLER
-                    lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_Doppler_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_Doppler_hz, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -10162,7 +10246,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Glonass_Gnav_Ephemeri
                     //    }
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
                     // GLONASS L1 SIGNAL STRENGTH
-                    lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.CN0_dB_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.CN0_dB_hz, 14, 3);
                     if (lineObs.size() < 80)
                         {
                             lineObs += std::string(80 - lineObs.size(), ' ');
@@ -10209,7 +10293,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Glonass_Gnav_Ephemeri
             line += Rinex_Printer::rightJustify(std::to_string(numSatellitesObserved), 3);
 
             // Receiver clock offset (optional)
-            // line += rightJustify(asString(clockOffset, 12), 15);
+            // line += Rinex_Printer::fixedWidthString(clockOffset, 15, 12);
 
             line += std::string(80 - line.size(), ' ');
             Rinex_Printer::lengthCheck(line);
@@ -10228,7 +10312,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Glonass_Gnav_Ephemeri
                         }
                     lineObs += std::to_string(static_cast<int32_t>(observables_iter->second.PRN));
                     // lineObs += std::string(2, ' ');
-                    lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Pseudorange_m, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Pseudorange_m, 14, 3);
 
                     // Loss of lock indicator (LLI)
                     int32_t lli = 0;  // Include in the observation!!
@@ -10246,7 +10330,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Glonass_Gnav_Ephemeri
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GLONASS L1 CA PHASE
-                    lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_phase_rads / TWO_PI, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_phase_rads / TWO_PI, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -10258,7 +10342,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Glonass_Gnav_Ephemeri
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GLONASS L1 CA DOPPLER
-                    lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_Doppler_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_Doppler_hz, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -10271,7 +10355,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Glonass_Gnav_Ephemeri
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GLONASS L1 SIGNAL STRENGTH
-                    lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.CN0_dB_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.CN0_dB_hz, 14, 3);
 
                     if (lineObs.size() < 80)
                         {
@@ -10503,7 +10587,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                 }
 
             // Pseudorange Measurements
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Pseudorange_m, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Pseudorange_m, 14, 3);
 
             // Loss of lock indicator (LLI)
             int32_t lli = 0;  // Include in the observation!!
@@ -10521,7 +10605,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
             lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
             // PHASE
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_phase_rads / TWO_PI, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_phase_rads / TWO_PI, 14, 3);
             if (lli == 0)
                 {
                     lineObs += std::string(1, ' ');
@@ -10533,7 +10617,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
             lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
             // DOPPLER
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_Doppler_hz, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_Doppler_hz, 14, 3);
             if (lli == 0)
                 {
                     lineObs += std::string(1, ' ');
@@ -10545,7 +10629,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
             lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
             // SIGNAL STRENGTH
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.CN0_dB_hz, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.CN0_dB_hz, 14, 3);
 
             if (lineObs.size() < 80)
                 {
@@ -10574,7 +10658,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                 {
                     /// \todo Need to account for pseudorange correction for glonass
                     // double leap_seconds = Rinex_Printer::get_leap_second(glonass_gnav_eph, gps_obs_time);
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Pseudorange_m, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Pseudorange_m, 14, 3);
 
                     // Loss of lock indicator (LLI)
                     int32_t lli = 0;  // Include in the observation!!
@@ -10592,7 +10676,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GLONASS CARRIER PHASE
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_phase_rads / (TWO_PI), 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_phase_rads / (TWO_PI), 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -10604,7 +10688,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GLONASS  DOPPLER
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_Doppler_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_Doppler_hz, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -10616,7 +10700,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GLONASS SIGNAL STRENGTH
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.CN0_dB_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.CN0_dB_hz, 14, 3);
                 }
 
             if (lineObs.size() < 80)
@@ -10763,7 +10847,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& g
             lineObs += std::to_string(static_cast<int32_t>(observables_iter->second.PRN));
 
             // Pseudorange Measurements
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Pseudorange_m, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Pseudorange_m, 14, 3);
 
             // Loss of lock indicator (LLI)
             int32_t lli = 0;  // Include in the observation!!
@@ -10781,7 +10865,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& g
             lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
             // PHASE
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_phase_rads / TWO_PI, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_phase_rads / TWO_PI, 14, 3);
             if (lli == 0)
                 {
                     lineObs += std::string(1, ' ');
@@ -10793,7 +10877,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& g
             lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
             // DOPPLER
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_Doppler_hz, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_Doppler_hz, 14, 3);
             if (lli == 0)
                 {
                     lineObs += std::string(1, ' ');
@@ -10805,7 +10889,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& g
             lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
             // SIGNAL STRENGTH
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.CN0_dB_hz, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.CN0_dB_hz, 14, 3);
 
             if (lineObs.size() < 80)
                 {
@@ -10832,7 +10916,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& g
                 {
                     /// \todo Need to account for pseudorange correction for glonass
                     // double leap_seconds = Rinex_Printer::get_leap_second(glonass_gnav_eph, gps_obs_time);
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Pseudorange_m, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Pseudorange_m, 14, 3);
 
                     // Loss of lock indicator (LLI)
                     int32_t lli = 0;  // Include in the observation!!
@@ -10850,7 +10934,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& g
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GLONASS CARRIER PHASE
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_phase_rads / (TWO_PI), 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_phase_rads / (TWO_PI), 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -10862,7 +10946,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& g
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GLONASS  DOPPLER
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_Doppler_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_Doppler_hz, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -10874,7 +10958,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& g
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GLONASS SIGNAL STRENGTH
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.CN0_dB_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.CN0_dB_hz, 14, 3);
                 }
 
             if (lineObs.size() < 80)
@@ -10991,7 +11075,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ga
     line += Rinex_Printer::rightJustify(std::to_string(numSatellitesObserved), 3);
 
     // Receiver clock offset (optional)
-    // line += rightJustify(asString(clockOffset, 12), 15);
+    // line += Rinex_Printer::fixedWidthString(clockOffset, 15, 12);
 
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
@@ -11019,7 +11103,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ga
                     lineObs += std::string(1, '0');
                 }
             lineObs += std::to_string(static_cast<int32_t>(observables_iter->second.PRN));
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Pseudorange_m, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Pseudorange_m, 14, 3);
 
             // Loss of lock indicator (LLI)
             int32_t lli = 0;  // Include in the observation!!
@@ -11037,7 +11121,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ga
             lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
             // PHASE
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_phase_rads / TWO_PI, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_phase_rads / TWO_PI, 14, 3);
             if (lli == 0)
                 {
                     lineObs += std::string(1, ' ');
@@ -11049,7 +11133,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ga
             lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
             // DOPPLER
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_Doppler_hz, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_Doppler_hz, 14, 3);
             if (lli == 0)
                 {
                     lineObs += std::string(1, ' ');
@@ -11061,7 +11145,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ga
             lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
             // SIGNAL STRENGTH
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.CN0_dB_hz, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.CN0_dB_hz, 14, 3);
 
             if (lineObs.size() < 80)
                 {
@@ -11085,7 +11169,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ga
             ret = total_glo_map.equal_range(*it);
             for (auto iter = ret.first; iter != ret.second; ++iter)
                 {
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Pseudorange_m, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Pseudorange_m, 14, 3);
 
                     // Loss of lock indicator (LLI)
                     int32_t lli = 0;  // Include in the observation!!
@@ -11103,7 +11187,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ga
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GLONASS CARRIER PHASE
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_phase_rads / (TWO_PI), 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_phase_rads / (TWO_PI), 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -11115,7 +11199,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ga
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GLONASS  DOPPLER
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_Doppler_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_Doppler_hz, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -11127,7 +11211,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ga
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GLONASS SIGNAL STRENGTH
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.CN0_dB_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.CN0_dB_hz, 14, 3);
                 }
 
             if (lineObs.size() < 80)
@@ -11217,7 +11301,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, d
                     line += std::to_string(static_cast<int32_t>(observables_iter->second.PRN));
                 }
             // Receiver clock offset (optional)
-            // line += rightJustify(asString(clockOffset, 12), 15);
+            // line += Rinex_Printer::fixedWidthString(clockOffset, 15, 12);
             line += std::string(80 - line.size(), ' ');
             Rinex_Printer::lengthCheck(line);
             out << line << '\n';
@@ -11231,7 +11315,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, d
                     line.clear();
                     // GPS L1 PSEUDORANGE
                     line += std::string(2, ' ');
-                    lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Pseudorange_m, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Pseudorange_m, 14, 3);
 
                     // Loss of lock indicator (LLI)
                     int32_t lli = 0;  // Include in the observation!!
@@ -11248,7 +11332,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, d
                     const int32_t ssi = Rinex_Printer::signalStrength(observables_iter->second.CN0_dB_hz);
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
                     // GPS L1 CA PHASE
-                    lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_phase_rads / TWO_PI, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_phase_rads / TWO_PI, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -11259,7 +11343,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, d
                     //    }
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
                     // GPS L1 CA DOPPLER
-                    lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_Doppler_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_Doppler_hz, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -11270,7 +11354,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, d
                     //   }
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
                     // GPS L1 SIGNAL STRENGTH
-                    lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.CN0_dB_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.CN0_dB_hz, 14, 3);
                     if (lineObs.size() < 80)
                         {
                             lineObs += std::string(80 - lineObs.size(), ' ');
@@ -11318,7 +11402,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, d
             line += Rinex_Printer::rightJustify(std::to_string(numSatellitesObserved), 3);
 
             // Receiver clock offset (optional)
-            // line += rightJustify(asString(clockOffset, 12), 15);
+            // line += Rinex_Printer::fixedWidthString(clockOffset, 15, 12);
 
             line += std::string(80 - line.size(), ' ');
             Rinex_Printer::lengthCheck(line);
@@ -11337,7 +11421,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, d
                         }
                     lineObs += std::to_string(static_cast<int32_t>(observables_iter->second.PRN));
                     // lineObs += std::string(2, ' ');
-                    lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Pseudorange_m, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Pseudorange_m, 14, 3);
 
                     // Loss of lock indicator (LLI)
                     int32_t lli = 0;  // Include in the observation!!
@@ -11355,7 +11439,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, d
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GPS L1 CA PHASE
-                    lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_phase_rads / TWO_PI, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_phase_rads / TWO_PI, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -11367,7 +11451,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, d
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GPS L1 CA DOPPLER
-                    lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_Doppler_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_Doppler_hz, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -11380,7 +11464,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, d
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GPS L1 SIGNAL STRENGTH
-                    lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.CN0_dB_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.CN0_dB_hz, 14, 3);
 
                     if (lineObs.size() < 80)
                         {
@@ -11445,7 +11529,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
     line += Rinex_Printer::rightJustify(std::to_string(numSatellitesObserved), 3);
 
     // Receiver clock offset (optional)
-    // line += rightJustify(asString(clockOffset, 12), 15);
+    // line += Rinex_Printer::fixedWidthString(clockOffset, 15, 12);
 
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
@@ -11465,7 +11549,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
             lineObs += std::to_string(static_cast<int32_t>(observables_iter->second.PRN));
             // lineObs += std::string(2, ' ');
             // GPS L2 PSEUDORANGE
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Pseudorange_m, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Pseudorange_m, 14, 3);
 
             // Loss of lock indicator (LLI)
             int32_t lli = 0;  // Include in the observation!!
@@ -11483,7 +11567,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
             lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
             // GPS L2 PHASE
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_phase_rads / TWO_PI, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_phase_rads / TWO_PI, 14, 3);
             if (lli == 0)
                 {
                     lineObs += std::string(1, ' ');
@@ -11495,7 +11579,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
             lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
             // GPS L2 DOPPLER
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_Doppler_hz, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_Doppler_hz, 14, 3);
             if (lli == 0)
                 {
                     lineObs += std::string(1, ' ');
@@ -11508,7 +11592,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
             lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
             // GPS L2 SIGNAL STRENGTH
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.CN0_dB_hz, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.CN0_dB_hz, 14, 3);
 
             if (lineObs.size() < 80)
                 {
@@ -11669,7 +11753,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, c
     const int32_t numSatellitesObserved = available_prns.size();
     line += Rinex_Printer::rightJustify(std::to_string(numSatellitesObserved), 3);
     // Receiver clock offset (optional)
-    // line += rightJustify(asString(clockOffset, 12), 15);
+    // line += Rinex_Printer::fixedWidthString(clockOffset, 15, 12);
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
@@ -11701,7 +11785,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, c
                             lineObs += std::string(62, ' ');
                         }
 
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Pseudorange_m, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Pseudorange_m, 14, 3);
 
                     // Loss of lock indicator (LLI)
                     int32_t lli = 0;  // Include in the observation!!
@@ -11719,7 +11803,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, c
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GPS CARRIER PHASE
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_phase_rads / (TWO_PI), 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_phase_rads / (TWO_PI), 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -11731,7 +11815,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, c
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GPS  DOPPLER
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_Doppler_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_Doppler_hz, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -11743,7 +11827,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, c
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // GPS SIGNAL STRENGTH
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.CN0_dB_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.CN0_dB_hz, 14, 3);
                 }
 
             if (lineObs.size() < 80)
@@ -11922,7 +12006,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ep
     const int32_t numSatellitesObserved = available_prns.size();
     line += Rinex_Printer::rightJustify(std::to_string(numSatellitesObserved), 3);
     // Receiver clock offset (optional)
-    // line += rightJustify(asString(clockOffset, 12), 15);
+    // line += Rinex_Printer::fixedWidthString(clockOffset, 15, 12);
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
@@ -11943,7 +12027,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ep
             ret = total_map.equal_range(*it);
             for (auto iter = ret.first; iter != ret.second; ++iter)
                 {
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Pseudorange_m, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Pseudorange_m, 14, 3);
 
                     // Loss of lock indicator (LLI)
                     int32_t lli = 0;  // Include in the observation!!
@@ -11961,7 +12045,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ep
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // Galileo CARRIER PHASE
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_phase_rads / (TWO_PI), 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_phase_rads / (TWO_PI), 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -11973,7 +12057,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ep
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // Galileo  DOPPLER
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_Doppler_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_Doppler_hz, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -11985,7 +12069,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ep
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // Galileo SIGNAL STRENGTH
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.CN0_dB_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.CN0_dB_hz, 14, 3);
                 }
 
             if (lineObs.size() < 80)
@@ -12139,7 +12223,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
     line += Rinex_Printer::rightJustify(std::to_string(numSatellitesObserved), 3);
 
     // Receiver clock offset (optional)
-    // line += rightJustify(asString(clockOffset, 12), 15);
+    // line += Rinex_Printer::fixedWidthString(clockOffset, 15, 12);
 
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
@@ -12167,7 +12251,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                     lineObs += std::string(1, '0');
                 }
             lineObs += std::to_string(static_cast<int32_t>(observables_iter->second.PRN));
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Pseudorange_m, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Pseudorange_m, 14, 3);
 
             // Loss of lock indicator (LLI)
             int32_t lli = 0;  // Include in the observation!!
@@ -12185,7 +12269,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
             lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
             // PHASE
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_phase_rads / TWO_PI, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_phase_rads / TWO_PI, 14, 3);
             if (lli == 0)
                 {
                     lineObs += std::string(1, ' ');
@@ -12197,7 +12281,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
             lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
             // DOPPLER
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.Carrier_Doppler_hz, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.Carrier_Doppler_hz, 14, 3);
             if (lli == 0)
                 {
                     lineObs += std::string(1, ' ');
@@ -12209,7 +12293,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
             lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
             // SIGNAL STRENGTH
-            lineObs += Rinex_Printer::rightJustify(asString(observables_iter->second.CN0_dB_hz, 3), 14);
+            lineObs += Rinex_Printer::fixedWidthString(observables_iter->second.CN0_dB_hz, 14, 3);
 
             if (lineObs.size() < 80)
                 {
@@ -12233,7 +12317,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
             ret = total_gal_map.equal_range(*it);
             for (auto iter = ret.first; iter != ret.second; ++iter)
                 {
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Pseudorange_m, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Pseudorange_m, 14, 3);
 
                     // Loss of lock indicator (LLI)
                     int32_t lli = 0;  // Include in the observation!!
@@ -12251,7 +12335,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // Galileo CARRIER PHASE
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_phase_rads / (TWO_PI), 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_phase_rads / (TWO_PI), 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -12263,7 +12347,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // Galileo  DOPPLER
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_Doppler_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_Doppler_hz, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -12275,7 +12359,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // Galileo SIGNAL STRENGTH
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.CN0_dB_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.CN0_dB_hz, 14, 3);
                 }
 
             if (lineObs.size() < 80)
@@ -12462,7 +12546,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
     line += Rinex_Printer::rightJustify(std::to_string(numSatellitesObserved), 3);
 
     // Receiver clock offset (optional)
-    // line += rightJustify(asString(clockOffset, 12), 15);
+    // line += Rinex_Printer::fixedWidthString(clockOffset, 15, 12);
 
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
@@ -12486,7 +12570,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
             ret = total_gps_map.equal_range(*it);
             for (auto iter = ret.first; iter != ret.second; ++iter)
                 {
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Pseudorange_m, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Pseudorange_m, 14, 3);
 
                     // Loss of lock indicator (LLI)
                     int32_t lli = 0;  // Include in the observation!!
@@ -12504,7 +12588,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // CARRIER PHASE
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_phase_rads / (TWO_PI), 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_phase_rads / (TWO_PI), 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -12516,7 +12600,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     //  DOPPLER
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_Doppler_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_Doppler_hz, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -12528,7 +12612,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // SIGNAL STRENGTH
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.CN0_dB_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.CN0_dB_hz, 14, 3);
                 }
 
             out << lineObs << '\n';
@@ -12548,7 +12632,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
             ret = total_gal_map.equal_range(*it);
             for (auto iter = ret.first; iter != ret.second; ++iter)
                 {
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Pseudorange_m, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Pseudorange_m, 14, 3);
 
                     // Loss of lock indicator (LLI)
                     int32_t lli = 0;  // Include in the observation!!
@@ -12566,7 +12650,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // Galileo CARRIER PHASE
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_phase_rads / (TWO_PI), 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_phase_rads / (TWO_PI), 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -12578,7 +12662,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // Galileo  DOPPLER
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_Doppler_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_Doppler_hz, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -12590,7 +12674,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // Galileo SIGNAL STRENGTH
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.CN0_dB_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.CN0_dB_hz, 14, 3);
                 }
 
             // if (lineObs.size() < 80) lineObs += std::string(80 - lineObs.size(), ' ');
@@ -12795,7 +12879,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
     line += Rinex_Printer::rightJustify(std::to_string(numSatellitesObserved), 3);
 
     // Receiver clock offset (optional)
-    // line += rightJustify(asString(clockOffset, 12), 15);
+    // line += Rinex_Printer::fixedWidthString(clockOffset, 15, 12);
 
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
@@ -12830,7 +12914,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                             lineObs += std::string(62, ' ');
                         }
 
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Pseudorange_m, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Pseudorange_m, 14, 3);
 
                     // Loss of lock indicator (LLI)
                     int32_t lli = 0;  // Include in the observation!!
@@ -12848,7 +12932,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // CARRIER PHASE
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_phase_rads / (TWO_PI), 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_phase_rads / (TWO_PI), 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -12860,7 +12944,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     //  DOPPLER
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_Doppler_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_Doppler_hz, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -12872,7 +12956,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // SIGNAL STRENGTH
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.CN0_dB_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.CN0_dB_hz, 14, 3);
                 }
 
             out << lineObs << '\n';
@@ -12892,7 +12976,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
             ret = total_gal_map.equal_range(*it);
             for (auto iter = ret.first; iter != ret.second; ++iter)
                 {
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Pseudorange_m, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Pseudorange_m, 14, 3);
 
                     // Loss of lock indicator (LLI)
                     int32_t lli = 0;  // Include in the observation!!
@@ -12910,7 +12994,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // Galileo CARRIER PHASE
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_phase_rads / (TWO_PI), 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_phase_rads / (TWO_PI), 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -12922,7 +13006,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // Galileo  DOPPLER
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_Doppler_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_Doppler_hz, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -12934,7 +13018,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // Galileo SIGNAL STRENGTH
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.CN0_dB_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.CN0_dB_hz, 14, 3);
                 }
 
             // if (lineObs.size() < 80) lineObs += std::string(80 - lineObs.size(), ' ');
@@ -13056,7 +13140,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Beidou_Dnav_Ephemeris
     const int32_t numSatellitesObserved = available_prns.size();
     line += Rinex_Printer::rightJustify(std::to_string(numSatellitesObserved), 3);
     // Receiver clock offset (optional)
-    // line += rightJustify(asString(clockOffset, 12), 15);
+    // line += Rinex_Printer::fixedWidthString(clockOffset, 15, 12);
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
@@ -13077,7 +13161,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Beidou_Dnav_Ephemeris
             ret = total_map.equal_range(*it);
             for (auto iter = ret.first; iter != ret.second; ++iter)
                 {
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Pseudorange_m, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Pseudorange_m, 14, 3);
 
                     // Loss of lock indicator (LLI)
                     int32_t lli = 0;  // Include in the observation!!
@@ -13091,7 +13175,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Beidou_Dnav_Ephemeris
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     // CARRIER PHASE
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_phase_rads / (TWO_PI), 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_phase_rads / (TWO_PI), 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -13099,7 +13183,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Beidou_Dnav_Ephemeris
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     //  DOPPLER
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.Carrier_Doppler_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.Carrier_Doppler_hz, 14, 3);
                     if (lli == 0)
                         {
                             lineObs += std::string(1, ' ');
@@ -13107,7 +13191,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Beidou_Dnav_Ephemeris
                     lineObs += Rinex_Printer::rightJustify(Rinex_Printer::asString<int32_t>(ssi), 1);
 
                     //  SIGNAL STRENGTH
-                    lineObs += Rinex_Printer::rightJustify(asString(iter->second.CN0_dB_hz, 3), 14);
+                    lineObs += Rinex_Printer::fixedWidthString(iter->second.CN0_dB_hz, 14, 3);
                 }
 
             if (lineObs.size() < 80)
@@ -39,10 +39,13 @@
 #define GNSS_SDR_RINEX_PRINTER_H
 
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <array>    // for array
+#include <cmath>    // for fabs, modf, nearbyint, signbit
 #include <cstdint>  // for int32_t
 #include <cstdlib>  // for strtol, strtod
 #include <fstream>  // for fstream
 #include <iomanip>  // for setprecision
+#include <limits>   // for numeric_limits
 #include <map>      // for map
 #include <sstream>  // for stringstream
 #include <string>   // for string
@@ -84,13 +87,16 @@ class Rinex_Printer
 public:
     /*!
      * \brief Constructor. Creates GNSS Navigation and Observables RINEX files.
+     * The compression parameter accepts "none" or "gzip".
      */
     explicit Rinex_Printer(int version = 0,
         const std::string& base_path = ".",
-        const std::string& base_name = "-");
+        const std::string& base_name = "-",
+        const std::string& compression = "none");
 
     /*!
-     * \brief Destructor. Removes created files if empty.
+     * \brief Destructor. Removes created files if empty, and compresses the
+     * non-empty ones if compression was requested.
      */
     ~Rinex_Printer();
 
@@ -201,6 +207,35 @@ public:
     void log_rinex_nav_bds_dnav(int type_of_rx,
         const std::map<int32_t, Beidou_Dnav_Ephemeris>& new_bds_eph);
 
+    /*!
+     * \brief Writes the GPS L1 C/A navigation file header for a standalone
+     * navigation data conversion, without an associated observation file
+     */
+    void print_gps_nav_header(const Gps_Iono& iono,
+        const Gps_Utc_Model& utc_model,
+        const Gps_Ephemeris& eph);
+
+    /*!
+     * \brief Writes the GPS CNAV navigation file header for a standalone
+     * navigation data conversion, without an associated observation file
+     */
+    void print_gps_cnav_header(const Gps_CNAV_Iono& iono,
+        const Gps_CNAV_Utc_Model& utc_model);
+
+    /*!
+     * \brief Writes the Galileo navigation file header for a standalone
+     * navigation data conversion, without an associated observation file
+     */
+    void print_gal_nav_header(const Galileo_Iono& iono,
+        const Galileo_Utc_Model& utc_model);
+
+    /*!
+     * \brief Writes the GLONASS GNAV navigation file header for a standalone
+     * navigation data conversion, without an associated observation file
+     */
+    void print_glo_gnav_header(const Glonass_Gnav_Utc_Model& utc_model,
+        const Glonass_Gnav_Ephemeris& eph);
+
     /*!
      * \brief Set processing for signals older than 2009
      */
@@ -230,6 +265,16 @@ public:
         return obsfilename;
     }
 
+    /*!
+     * \brief Fast fixed-point formatting backend for observation records.
+     * Formats \a x with \a precision decimal places, right-justified in a
+     * field of \a width characters, using integer arithmetic on a stack
+     * buffer instead of a stringstream. Drop-in replacement for
+     * rightJustify(asString(x, precision), width), to which it falls back
+     * for values outside the integer-safe range. Public so the unit test
+     * can sweep it against the stringstream path.
+     */
+    inline std::string fixedWidthString(double x, int width, int precision) const;
 
 private:
     /*
@@ -1013,6 +1058,7 @@ private:
     bool d_rinex_header_updated;
     bool d_rinex_header_written;
     bool d_pre_2009_file;
+    bool d_gzip_output;  // compress the non-empty files at shutdown
 };
 
 
@@ -1245,6 +1291,78 @@ inline int64_t asInt(const std::string& s)
 }
 
 
+inline std::string Rinex_Printer::fixedWidthString(double x, int width, int precision) const
+{
+    static const std::array<double, 10> pow10 = {1.0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8, 1.0e9};
+    if (precision < 0 || precision > 9 || width <= 0 || width > 30 ||
+        !(std::fabs(x) < 9.0e15 / pow10[precision]))
+        {
+            std::string s = asString(x, precision);
+            return rightJustify(s, width);
+        }
+    // signbit instead of (x < 0.0), so negative zero keeps its sign like
+    // in the stringstream path
+    const bool negative = std::signbit(x);
+    const int64_t divisor = static_cast<int64_t>(pow10[precision]);
+    // split before scaling so the multiplication stays in the exact range
+    double int_part_d;
+    const double frac = std::modf(std::fabs(x), &int_part_d);
+    int64_t int_part = static_cast<int64_t>(int_part_d);
+    const double scaled = frac * pow10[precision];
+    // the product above carries up to half an ulp of rounding error, so when
+    // it lands that close to a rounding tie this path could pick the other
+    // side of it than the stringstream path, which rounds the full decimal
+    // expansion. Hand those rare near-tie cases (and the exact ties, which
+    // the stream rounds to even) to the slow path instead of second-guessing
+    double scaled_int;
+    const double scaled_frac = std::modf(scaled, &scaled_int);
+    const double tie_margin = 4.0 * std::numeric_limits<double>::epsilon() * (scaled + 1.0);
+    if (std::fabs(scaled_frac - 0.5) <= tie_margin)
+        {
+            std::string s = asString(x, precision);
+            return rightJustify(s, width);
+        }
+    // away from ties, nearbyint of the product is the correctly rounded digit
+    int64_t frac_part = static_cast<int64_t>(std::nearbyint(scaled));
+    if (frac_part >= divisor)
+        {
+            frac_part -= divisor;
+            int_part += 1;
+        }
+
+    std::array<char, 32> buf{};
+    int pos = 32;
+    for (int i = 0; i < precision; i++)
+        {
+            buf[--pos] = static_cast<char>('0' + (frac_part % 10));
+            frac_part /= 10;
+        }
+    if (precision > 0)
+        {
+            buf[--pos] = '.';
+        }
+    do
+        {
+            buf[--pos] = static_cast<char>('0' + (int_part % 10));
+            int_part /= 10;
+        }
+    while (int_part != 0);
+    if (negative)
+        {
+            buf[--pos] = '-';
+        }
+    const int len = 32 - pos;
+    if (len > width)
+        {
+            // same behavior as rightJustify: truncate from the left
+            return std::string(buf.data() + 32 - width, width);
+        }
+    std::string field(static_cast<std::string::size_type>(width), ' ');
+    field.replace(static_cast<std::string::size_type>(width - len), len, buf.data() + pos, len);
+    return field;
+}
+
+
 inline int Rinex_Printer::toInt(const std::string& bitString, int sLength) const
 {
     int tempInt;
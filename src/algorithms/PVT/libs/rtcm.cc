@@ -398,17 +398,47 @@ int64_t Rtcm::hex_to_int(const std::string& s) const
 
 std::string Rtcm::build_message(const std::string& data) const
 {
+    // assembles the frame in a single pass over the content bits, writing
+    // into a reusable buffer instead of concatenating intermediate strings
+    // and round-tripping through boost::dynamic_bitset
     const uint32_t msg_length_bits = data.length();
-    const uint32_t msg_length_bytes = std::ceil(static_cast<float>(msg_length_bits) / 8.0);
-    const auto message_length = std::bitset<10>(msg_length_bytes);
-    const uint32_t zeros_to_fill = 8 * msg_length_bytes - msg_length_bits;
-    const std::string b(zeros_to_fill, '0');
-    const std::string msg_content = data + b;
-    const std::string msg_without_crc = preamble.to_string() +
-                                        reserved_field.to_string() +
-                                        message_length.to_string() +
-                                        msg_content;
-    return Rtcm::add_CRC(msg_without_crc);
+    const uint32_t msg_length_bytes = (msg_length_bits + 7U) / 8U;
+
+    frame_buffer.clear();
+    frame_buffer.reserve(6 + msg_length_bytes);
+
+    // preamble (8 bits), reserved field (6 bits), message length (10 bits)
+    frame_buffer.push_back(static_cast<uint8_t>(preamble.to_ulong()));
+    frame_buffer.push_back(static_cast<uint8_t>((reserved_field.to_ulong() << 2U) | ((msg_length_bytes >> 8U) & 0x03U)));
+    frame_buffer.push_back(static_cast<uint8_t>(msg_length_bytes & 0xFFU));
+
+    // pack the content bits MSB first, zero-padding the last byte
+    uint8_t byte = 0U;
+    uint32_t bits_in_byte = 0U;
+    for (const char bit : data)
+        {
+            byte = static_cast<uint8_t>((byte << 1U) | static_cast<uint8_t>(bit == '1'));
+            if (++bits_in_byte == 8U)
+                {
+                    frame_buffer.push_back(byte);
+                    byte = 0U;
+                    bits_in_byte = 0U;
+                }
+        }
+    if (bits_in_byte != 0U)
+        {
+            frame_buffer.push_back(static_cast<uint8_t>(byte << (8U - bits_in_byte)));
+        }
+
+    // Qualcomm CRC-24Q over the whole frame, appended MSB first
+    boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> CRC_RTCM;
+    CRC_RTCM.process_bytes(frame_buffer.data(), frame_buffer.size());
+    const uint32_t crc = CRC_RTCM.checksum();
+    frame_buffer.push_back(static_cast<uint8_t>((crc >> 16U) & 0xFFU));
+    frame_buffer.push_back(static_cast<uint8_t>((crc >> 8U) & 0xFFU));
+    frame_buffer.push_back(static_cast<uint8_t>(crc & 0xFFU));
+
+    return std::string(frame_buffer.begin(), frame_buffer.end());
 }
 
 
@@ -993,6 +993,7 @@ private:
     //
     std::bitset<8> preamble;
     std::bitset<6> reserved_field;
+    mutable std::vector<uint8_t> frame_buffer;  // reusable frame assembly buffer
     std::string add_CRC(const std::string& m) const;
     std::string build_message(const std::string& data) const;  // adds 0s to complete a byte and adds the CRC
 
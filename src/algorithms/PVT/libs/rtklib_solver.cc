@@ -32,14 +32,20 @@
 
 #include "rtklib_solver.h"
 #include "Beidou_DNAV.h"
+#include "async_dump_writer.h"
 #include "gnss_sdr_filesystem.h"
+#include "rtklib_ephemeris.h"
+#include "rtklib_pntpos.h"
+#include "rtklib_rtkcmn.h"
 #include "rtklib_rtkpos.h"
 #include "rtklib_solution.h"
 #include <glog/logging.h>
 #include <matio.h>
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <exception>
+#include <fstream>
 #include <utility>
 #include <vector>
 
@@ -135,18 +141,10 @@ Rtklib_Solver::Rtklib_Solver(const rtk_t &rtk,
     // ############# ENABLE DATA FILE LOG #################
     if (d_flag_dump_enabled == true)
         {
-            if (d_dump_file.is_open() == false)
+            if (d_dump_stream_id < 0)
                 {
-                    try
-                        {
-                            d_dump_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
-                            d_dump_file.open(d_dump_filename.c_str(), std::ios::out | std::ios::binary);
-                            LOG(INFO) << "PVT lib dump enabled Log file: " << d_dump_filename.c_str();
-                        }
-                    catch (const std::ofstream::failure &e)
-                        {
-                            LOG(WARNING) << "Exception opening RTKLIB dump file " << e.what();
-                        }
+                    d_dump_stream_id = Async_Dump_Writer::get_instance().open_stream(d_dump_filename);
+                    LOG(INFO) << "PVT lib dump enabled Log file: " << d_dump_filename.c_str();
                 }
         }
 }
@@ -155,18 +153,13 @@ Rtklib_Solver::Rtklib_Solver(const rtk_t &rtk,
 Rtklib_Solver::~Rtklib_Solver()
 {
     DLOG(INFO) << "Rtklib_Solver destructor called.";
-    if (d_dump_file.is_open() == true)
+    if (d_dump_stream_id >= 0)
         {
-            const auto pos = d_dump_file.tellp();
-            try
-                {
-                    d_dump_file.close();
-                }
-            catch (const std::exception &ex)
-                {
-                    LOG(WARNING) << "Exception in destructor closing the RTKLIB dump file " << ex.what();
-                }
-            if (pos == 0)
+            // blocks until the data is on disk, so save_matfile() below
+            // re-reads a complete file
+            const uint64_t bytes_written = Async_Dump_Writer::get_instance().close_stream(d_dump_stream_id);
+            d_dump_stream_id = -1;
+            if (bytes_written == 0)
                 {
                     errorlib::error_code ec;
                     if (!fs::remove(fs::path(d_dump_filename), ec))
@@ -701,14 +694,14 @@ void Rtklib_Solver::store_has_data(const Galileo_HAS_data &new_has_data)
 }
 
 
-void Rtklib_Solver::update_has_corrections(const std::map<int, Gnss_Synchro> &obs_map)
+void Rtklib_Solver::update_has_corrections(const Gnss_Synchro_Map &obs_map)
 {
     this->check_has_orbit_clock_validity(obs_map);
     this->get_has_biases(obs_map);
 }
 
 
-void Rtklib_Solver::check_has_orbit_clock_validity(const std::map<int, Gnss_Synchro> &obs_map)
+void Rtklib_Solver::check_has_orbit_clock_validity(const Gnss_Synchro_Map &obs_map)
 {
     for (const auto &it : obs_map)
         {
@@ -781,7 +774,7 @@ void Rtklib_Solver::check_has_orbit_clock_validity(const std::map<int, Gnss_Sync
 }
 
 
-void Rtklib_Solver::get_has_biases(const std::map<int, Gnss_Synchro> &obs_map)
+void Rtklib_Solver::get_has_biases(const Gnss_Synchro_Map &obs_map)
 {
     d_has_obs_corr_map.clear();
     if (!d_has_clock_corrections_store_map.empty() && !d_has_orbit_corrections_store_map.empty())
@@ -898,9 +891,243 @@ void Rtklib_Solver::get_current_has_obs_correction(const std::string &signal, ui
 }
 
 
-bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_map, double kf_update_interval_s)
+bool Rtklib_Solver::compute_obs_innovations(int num_obs, const double *rr, double &median_m, double &max_residual_m, int &used_sats)
+{
+    std::vector<double> rs(6 * num_obs);
+    std::vector<double> dts(2 * num_obs);
+    std::vector<double> var(num_obs);
+    std::vector<int> svh(num_obs);
+    satposs(d_obs_data[0].time, d_obs_data.data(), num_obs, &d_nav_data, d_rtk.opt.sateph, rs.data(), dts.data(), var.data(), svh.data());
+
+    // pseudorange innovations against the predicted receiver position; the common
+    // term absorbs the receiver clock offset plus the mean atmospheric delay
+    std::vector<double> innovations;
+    innovations.reserve(num_obs);
+    std::array<double, 3> e{};
+    for (int i = 0; i < num_obs; i++)
+        {
+            if (svh[i] < 0)
+                {
+                    continue;
+                }
+            double pr = 0.0;
+            for (int j = 0; j < NFREQ; j++)
+                {
+                    if (d_obs_data[i].P[j] != 0.0)
+                        {
+                            pr = d_obs_data[i].P[j];
+                            break;
+                        }
+                }
+            if (pr == 0.0)
+                {
+                    continue;
+                }
+            const double r = geodist(rs.data() + i * 6, rr, e.data());
+            if (r <= 0.0)
+                {
+                    continue;
+                }
+            innovations.push_back(pr - (r - SPEED_OF_LIGHT_M_S * dts[i * 2]));
+        }
+    used_sats = static_cast<int>(innovations.size());
+    if (used_sats < 4)
+        {
+            return false;
+        }
+    const auto median_it = innovations.begin() + used_sats / 2;
+    std::nth_element(innovations.begin(), median_it, innovations.end());
+    median_m = *median_it;
+    max_residual_m = 0.0;
+    for (const auto innovation : innovations)
+        {
+            max_residual_m = std::max(max_residual_m, std::fabs(innovation - median_m));
+        }
+    return true;
+}
+
+
+void Rtklib_Solver::launch_sub_solutions(int num_obs)
+{
+    // group the observables of the epoch by constellation
+    std::map<char, std::vector<int>> sys_indices;
+    for (int i = 0; i < num_obs; i++)
+        {
+            int prn = 0;
+            char sys_id;
+            switch (satsys(d_obs_data[i].sat, &prn))
+                {
+                case SYS_GPS:
+                    sys_id = 'G';
+                    break;
+                case SYS_GAL:
+                    sys_id = 'E';
+                    break;
+                case SYS_GLO:
+                    sys_id = 'R';
+                    break;
+                case SYS_BDS:
+                    sys_id = 'C';
+                    break;
+                default:
+                    continue;
+                }
+            sys_indices[sys_id].push_back(i);
+        }
+    // a sub-solution needs at least four satellites, and with a single
+    // constellation in view it would just duplicate the combined solution
+    for (auto it = sys_indices.begin(); it != sys_indices.end();)
+        {
+            if (it->second.size() < 4)
+                {
+                    it = sys_indices.erase(it);
+                }
+            else
+                {
+                    ++it;
+                }
+        }
+    if (sys_indices.size() < 2)
+        {
+            return;
+        }
+
+    // one satposs() evaluation over the full observable set, shared by all
+    // sub-solutions
+    std::vector<double> rs(6 * num_obs);
+    std::vector<double> dts(2 * num_obs);
+    std::vector<double> var(num_obs);
+    std::vector<int> svh(num_obs);
+    satposs(d_obs_data[0].time, d_obs_data.data(), num_obs, &d_nav_data, d_rtk.opt.sateph, rs.data(), dts.data(), var.data(), svh.data());
+
+    d_sub_results.assign(sys_indices.size(), {'\0', sol_t{}});
+    size_t slot = 0;
+    for (const auto &sys : sys_indices)
+        {
+            // gather the subset of observables and their satellite positions
+            const auto n_sub = static_cast<int>(sys.second.size());
+            std::vector<obsd_t> sub_obs(n_sub);
+            std::vector<double> sub_rs(6 * n_sub);
+            std::vector<double> sub_dts(2 * n_sub);
+            std::vector<double> sub_var(n_sub);
+            std::vector<int> sub_svh(n_sub);
+            for (int k = 0; k < n_sub; k++)
+                {
+                    const int i = sys.second[k];
+                    sub_obs[k] = d_obs_data[i];
+                    std::copy_n(rs.data() + 6 * i, 6, sub_rs.data() + 6 * k);
+                    std::copy_n(dts.data() + 2 * i, 2, sub_dts.data() + 2 * k);
+                    sub_var[k] = var[i];
+                    sub_svh[k] = svh[i];
+                }
+            prcopt_t sub_opt = d_rtk.opt;
+            sub_opt.mode = PMODE_SINGLE;
+            d_sub_threads.emplace_back([this, slot, sys_id = sys.first, sub_opt,
+                                           sub_obs = std::move(sub_obs), sub_rs = std::move(sub_rs),
+                                           sub_dts = std::move(sub_dts), sub_var = std::move(sub_var),
+                                           sub_svh = std::move(sub_svh)]() {
+                sol_t sub_sol{};
+                std::array<char, 128> msg{};
+                if (pntpos_sat(sub_obs.data(), static_cast<int>(sub_obs.size()), &d_nav_data,
+                        &sub_opt, &sub_sol, nullptr, nullptr, msg.data(),
+                        sub_rs.data(), sub_dts.data(), sub_var.data(), sub_svh.data()) != 0)
+                    {
+                        d_sub_results[slot] = {sys_id, sub_sol};
+                    }
+                else
+                    {
+                        DLOG(INFO) << "Sub-solution " << sys_id << " failed: " << msg.data();
+                    }
+            });
+            slot++;
+        }
+}
+
+
+void Rtklib_Solver::join_sub_solutions()
+{
+    for (auto &t : d_sub_threads)
+        {
+            t.join();
+        }
+    d_sub_threads.clear();
+    d_sub_solutions.clear();
+    for (const auto &result : d_sub_results)
+        {
+            if (result.first != '\0')
+                {
+                    d_sub_solutions[result.first] = result.second;
+                }
+        }
+    d_sub_results.clear();
+    if (d_rtk.sol.stat != SOLQ_NONE)
+        {
+            for (const auto &sub : d_sub_solutions)
+                {
+                    std::array<double, 3> delta{sub.second.rr[0] - d_rtk.sol.rr[0],
+                        sub.second.rr[1] - d_rtk.sol.rr[1],
+                        sub.second.rr[2] - d_rtk.sol.rr[2]};
+                    DLOG(INFO) << "Sub-solution " << sub.first << " with " << static_cast<int>(sub.second.ns)
+                               << " satellites: separation from the combined solution = "
+                               << norm_rtk(delta.data(), 3) << " [m]";
+                }
+        }
+}
+
+
+bool Rtklib_Solver::run_fast_kf_epoch(int num_obs)
+{
+    arma::vec p;
+    arma::vec v;
+    d_pvt_kf.get_pv_Kf(p, v);
+    const std::array<double, 3> rr{p[0], p[1], p[2]};
+
+    // validate the KF state against the observed pseudoranges before touching it,
+    // so a failed check falls back to the full solution with the filter unchanged
+    double median_m = 0.0;
+    double max_residual_m = 0.0;
+    int used_sats = 0;
+    if (compute_obs_innovations(num_obs, rr.data(), median_m, max_residual_m, used_sats) == false)
+        {
+            return false;
+        }
+    if (max_residual_m > d_conf.kf_fast_mode_innovation_threshold_m)
+        {
+            LOG(INFO) << "PVT KF fast mode: innovation check failed (max residual "
+                      << max_residual_m << " [m]), falling back to the full solution";
+            return false;
+        }
+
+    // innovation check passed: propagate the solution without running rtkpos
+    d_pvt_kf.predict_Kf();
+    d_pvt_kf.get_pv_Kf(p, v);
+    pvt_sol.time = d_obs_data[0].time;
+    pvt_sol.rr[0] = p[0];  // [m]
+    pvt_sol.rr[1] = p[1];  // [m]
+    pvt_sol.rr[2] = p[2];  // [m]
+    pvt_sol.rr[3] = v[0];  // [m/s]
+    pvt_sol.rr[4] = v[1];  // [m/s]
+    pvt_sol.rr[5] = v[2];  // [m/s]
+    pvt_sol.ns = static_cast<unsigned char>(used_sats);
+
+    // the clock bias captured at the last full epoch turns the innovation median
+    // into a receiver clock offset estimate
+    const double dtr_s = (median_m - d_fast_clock_bias_m) / SPEED_OF_LIGHT_M_S;
+    if (d_rtk.opt.mode == PMODE_SINGLE)
+        {
+            pvt_sol.dtr[0] = dtr_s - pvt_sol.dtr[2];
+        }
+    else
+        {
+            pvt_sol.dtr[0] = (dtr_s - pvt_sol.dtr[2]) * SPEED_OF_LIGHT_M_S;
+        }
+    return true;
+}
+
+
+bool Rtklib_Solver::get_PVT(const Gnss_Synchro_Map &gnss_observables_map, double kf_update_interval_s)
 {
-    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
+    Gnss_Synchro_Map::const_iterator gnss_observables_iter;
     std::map<int, Galileo_Ephemeris>::const_iterator galileo_ephemeris_iter;
     std::map<int, Gps_Ephemeris>::const_iterator gps_ephemeris_iter;
     std::map<int, Gps_CNAV_Ephemeris>::const_iterator gps_cnav_ephemeris_iter;
@@ -1495,7 +1722,42 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                         }
                 }
 
-            result = rtkpos(&d_rtk, d_obs_data.data(), valid_obs + glo_valid_obs, &d_nav_data);
+            // KF fast mode for static receivers: the full measurement processing runs
+            // at kf_fast_mode_full_update_interval_s, the epochs in between propagate
+            // the KF state and only validate it against the observed pseudoranges
+            bool fast_epoch = false;
+            if (d_conf.enable_pvt_kf == true &&
+                d_conf.enable_pvt_kf_fast_mode == true &&
+                d_pvt_kf.is_initialized() == true &&
+                pvt_sol.stat != SOLQ_NONE)
+                {
+                    const double elapsed_s = timediff(d_obs_data[0].time, d_last_full_epoch_time);
+                    if (elapsed_s > 0.0 && elapsed_s < d_conf.kf_fast_mode_full_update_interval_s)
+                        {
+                            fast_epoch = run_fast_kf_epoch(valid_obs + glo_valid_obs);
+                        }
+                }
+
+            if (fast_epoch)
+                {
+                    result = 1;
+                }
+            else
+                {
+                    if (d_conf.enable_sub_solutions)
+                        {
+                            // the per-constellation sub-solutions run in worker
+                            // threads while this thread computes the combined
+                            // solution, and are joined before the epoch result
+                            // is published so the output order is preserved
+                            launch_sub_solutions(valid_obs + glo_valid_obs);
+                        }
+                    result = rtkpos(&d_rtk, d_obs_data.data(), valid_obs + glo_valid_obs, &d_nav_data);
+                    if (d_conf.enable_sub_solutions)
+                        {
+                            join_sub_solutions();
+                        }
+                }
 
             if (result == 0)
                 {
@@ -1510,39 +1772,49 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                 }
             else
                 {
-                    this->set_num_valid_observations(d_rtk.sol.ns);  // record the number of valid satellites used by the PVT solver
-                    pvt_sol = d_rtk.sol;
-                    // DOP computation
-                    unsigned int used_sats = 0;
-                    for (unsigned int i = 0; i < MAXSAT; i++)
+                    if (!fast_epoch)
                         {
-                            pvt_ssat[i] = d_rtk.ssat[i];
-                            if (d_rtk.ssat[i].vs == 1)
+                            this->set_num_valid_observations(d_rtk.sol.ns);  // record the number of valid satellites used by the PVT solver
+                            pvt_sol = d_rtk.sol;
+                            d_last_full_epoch_time = pvt_sol.time;
+                            // DOP computation
+                            unsigned int used_sats = 0;
+                            for (unsigned int i = 0; i < MAXSAT; i++)
                                 {
-                                    used_sats++;
+                                    pvt_ssat[i] = d_rtk.ssat[i];
+                                    if (d_rtk.ssat[i].vs == 1)
+                                        {
+                                            used_sats++;
+                                        }
                                 }
-                        }
 
-                    std::vector<double> azel(used_sats * 2);
-                    int index_aux = 0;
-                    for (auto &i : d_rtk.ssat)
-                        {
-                            if (i.vs == 1)
+                            std::vector<double> azel(used_sats * 2);
+                            int index_aux = 0;
+                            for (auto &i : d_rtk.ssat)
+                                {
+                                    if (i.vs == 1)
+                                        {
+                                            azel[2 * index_aux] = i.azel[0];
+                                            azel[2 * index_aux + 1] = i.azel[1];
+                                            index_aux++;
+                                        }
+                                }
+
+                            if (index_aux > 0)
                                 {
-                                    azel[2 * index_aux] = i.azel[0];
-                                    azel[2 * index_aux + 1] = i.azel[1];
-                                    index_aux++;
+                                    dops(index_aux, azel.data(), 0.0, d_dop.data());
                                 }
                         }
-
-                    if (index_aux > 0)
+                    else
                         {
-                            dops(index_aux, azel.data(), 0.0, d_dop.data());
+                            // KF fast epoch: the satellite geometry, DOP and channel status
+                            // are kept from the last full solution
+                            this->set_num_valid_observations(pvt_sol.ns);
                         }
                     this->set_valid_position(true);
                     std::array<double, 4> rx_position_and_time{};
 
-                    if (d_conf.enable_pvt_kf == true)
+                    if (d_conf.enable_pvt_kf == true && !fast_epoch)
                         {
                             if (d_pvt_kf.is_initialized() == false)
                                 {
@@ -1589,6 +1861,20 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                             // add also the clock offset from gps to galileo (pvt_sol.dtr[2])
                             rx_position_and_time[3] = pvt_sol.dtr[2] + pvt_sol.dtr[0] / SPEED_OF_LIGHT_M_S;
                         }
+
+                    if (d_conf.enable_pvt_kf == true && d_conf.enable_pvt_kf_fast_mode == true && !fast_epoch && d_pvt_kf.is_initialized() == true)
+                        {
+                            // reference the raw innovation median to the full solution clock
+                            // offset, so the fast epochs can cancel the atmospheric delays
+                            // common to both
+                            double median_m = 0.0;
+                            double max_residual_m = 0.0;
+                            int used_sats = 0;
+                            if (compute_obs_innovations(valid_obs + glo_valid_obs, pvt_sol.rr, median_m, max_residual_m, used_sats))
+                                {
+                                    d_fast_clock_bias_m = median_m - rx_position_and_time[3] * SPEED_OF_LIGHT_M_S;
+                                }
+                        }
                     this->set_rx_pos({rx_position_and_time[0], rx_position_and_time[1], rx_position_and_time[2]});  // save ECEF position for the next iteration
 
                     // compute Ground speed and COG
@@ -1686,86 +1972,99 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                     // User clock drift [ppm]
                     d_monitor_pvt.user_clk_drift_ppm = clock_drift_ppm;
 
+                    // Per-satellite residuals, so external integrity monitors
+                    // do not need to re-derive them from the raw observables
+                    d_monitor_pvt.sat_residuals.clear();
+                    for (unsigned int i = 0; i < MAXSAT; i++)
+                        {
+                            if (pvt_ssat[i].vs == 1)
+                                {
+                                    Monitor_Sat_Residual residual{};
+                                    int prn = 0;
+                                    residual.sys = static_cast<uint8_t>(satsys(static_cast<int>(i) + 1, &prn));
+                                    residual.prn = static_cast<uint8_t>(prn);
+                                    residual.valid = pvt_ssat[i].vsat[0];
+                                    residual.snr_dbhz = static_cast<float>(pvt_ssat[i].snr[0]) * 0.25F;
+                                    residual.azimuth_rad = static_cast<float>(pvt_ssat[i].azel[0]);
+                                    residual.elevation_rad = static_cast<float>(pvt_ssat[i].azel[1]);
+                                    residual.pseudorange_residual_m = static_cast<float>(pvt_ssat[i].resp[0]);
+                                    residual.carrier_phase_residual_m = static_cast<float>(pvt_ssat[i].resc[0]);
+                                    d_monitor_pvt.sat_residuals.push_back(residual);
+                                }
+                        }
+
                     // ######## LOG FILE #########
                     if (d_flag_dump_enabled == true)
                         {
                             // MULTIPLEXED FILE RECORDING - Record results to file
-                            try
-                                {
-                                    double tmp_double;
-                                    uint32_t tmp_uint32;
-                                    // TOW
-                                    tmp_uint32 = gnss_observables_map.cbegin()->second.TOW_at_current_symbol_ms;
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_uint32), sizeof(uint32_t));
-                                    // WEEK
-                                    tmp_uint32 = adjgpsweek(d_nav_data.eph[0].week, this->is_pre_2009());
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_uint32), sizeof(uint32_t));
-                                    // PVT GPS time
-                                    tmp_double = gnss_observables_map.cbegin()->second.RX_time;
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    // User clock offset [s]
-                                    tmp_double = rx_position_and_time[3];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-
-                                    // ECEF POS X,Y,X [m] + ECEF VEL X,Y,X [m/s] (6 x double)
-                                    tmp_double = pvt_sol.rr[0];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.rr[1];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.rr[2];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.rr[3];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.rr[4];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.rr[5];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-
-                                    // position variance/covariance (m^2) {c_xx,c_yy,c_zz,c_xy,c_yz,c_zx} (6 x double)
-                                    tmp_double = pvt_sol.qr[0];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.qr[1];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.qr[2];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.qr[3];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.qr[4];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.qr[5];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-
-                                    // GEO user position Latitude [deg]
-                                    tmp_double = this->get_latitude();
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    // GEO user position Longitude [deg]
-                                    tmp_double = this->get_longitude();
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    // GEO user position Height [m]
-                                    tmp_double = this->get_height();
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-
-                                    // NUMBER OF VALID SATS
-                                    d_dump_file.write(reinterpret_cast<char *>(&pvt_sol.ns), sizeof(uint8_t));
-                                    // RTKLIB solution status
-                                    d_dump_file.write(reinterpret_cast<char *>(&pvt_sol.stat), sizeof(uint8_t));
-                                    // RTKLIB solution type (0:xyz-ecef,1:enu-baseline)
-                                    d_dump_file.write(reinterpret_cast<char *>(&pvt_sol.type), sizeof(uint8_t));
-                                    // AR ratio factor for validation
-                                    d_dump_file.write(reinterpret_cast<char *>(&pvt_sol.ratio), sizeof(float));
-                                    // AR ratio threshold for validation
-                                    d_dump_file.write(reinterpret_cast<char *>(&pvt_sol.thres), sizeof(float));
-
-                                    // GDOP / PDOP / HDOP / VDOP
-                                    d_dump_file.write(reinterpret_cast<char *>(&d_dop[0]), sizeof(double));
-                                    d_dump_file.write(reinterpret_cast<char *>(&d_dop[1]), sizeof(double));
-                                    d_dump_file.write(reinterpret_cast<char *>(&d_dop[2]), sizeof(double));
-                                    d_dump_file.write(reinterpret_cast<char *>(&d_dop[3]), sizeof(double));
-                                }
-                            catch (const std::ofstream::failure &e)
-                                {
-                                    LOG(WARNING) << "Exception writing RTKLIB dump file " << e.what();
-                                }
+                            // stage the solution into one contiguous record for
+                            // the shared asynchronous writer, keeping the file
+                            // layout expected by save_matfile()
+                            std::vector<char> record;
+                            record.reserve(2 * sizeof(uint32_t) + 21 * sizeof(double) + 3 * sizeof(uint8_t) + 2 * sizeof(float));
+                            const auto put = [&record](const void *value, std::size_t size) {
+                                const auto *bytes = static_cast<const char *>(value);
+                                record.insert(record.end(), bytes, bytes + size);
+                            };
+                            double tmp_double;
+                            uint32_t tmp_uint32;
+                            // TOW
+                            tmp_uint32 = gnss_observables_map.cbegin()->second.TOW_at_current_symbol_ms;
+                            put(&tmp_uint32, sizeof(uint32_t));
+                            // WEEK
+                            tmp_uint32 = adjgpsweek(d_nav_data.eph[0].week, this->is_pre_2009());
+                            put(&tmp_uint32, sizeof(uint32_t));
+                            // PVT GPS time
+                            tmp_double = gnss_observables_map.cbegin()->second.RX_time;
+                            put(&tmp_double, sizeof(double));
+                            // User clock offset [s]
+                            tmp_double = rx_position_and_time[3];
+                            put(&tmp_double, sizeof(double));
+
+                            // ECEF POS X,Y,X [m] + ECEF VEL X,Y,X [m/s] (6 x double)
+                            put(&pvt_sol.rr[0], sizeof(double));
+                            put(&pvt_sol.rr[1], sizeof(double));
+                            put(&pvt_sol.rr[2], sizeof(double));
+                            put(&pvt_sol.rr[3], sizeof(double));
+                            put(&pvt_sol.rr[4], sizeof(double));
+                            put(&pvt_sol.rr[5], sizeof(double));
+
+                            // position variance/covariance (m^2) {c_xx,c_yy,c_zz,c_xy,c_yz,c_zx} (6 x double)
+                            put(&pvt_sol.qr[0], sizeof(double));
+                            put(&pvt_sol.qr[1], sizeof(double));
+                            put(&pvt_sol.qr[2], sizeof(double));
+                            put(&pvt_sol.qr[3], sizeof(double));
+                            put(&pvt_sol.qr[4], sizeof(double));
+                            put(&pvt_sol.qr[5], sizeof(double));
+
+                            // GEO user position Latitude [deg]
+                            tmp_double = this->get_latitude();
+                            put(&tmp_double, sizeof(double));
+                            // GEO user position Longitude [deg]
+                            tmp_double = this->get_longitude();
+                            put(&tmp_double, sizeof(double));
+                            // GEO user position Height [m]
+                            tmp_double = this->get_height();
+                            put(&tmp_double, sizeof(double));
+
+                            // NUMBER OF VALID SATS
+                            put(&pvt_sol.ns, sizeof(uint8_t));
+                            // RTKLIB solution status
+                            put(&pvt_sol.stat, sizeof(uint8_t));
+                            // RTKLIB solution type (0:xyz-ecef,1:enu-baseline)
+                            put(&pvt_sol.type, sizeof(uint8_t));
+                            // AR ratio factor for validation
+                            put(&pvt_sol.ratio, sizeof(float));
+                            // AR ratio threshold for validation
+                            put(&pvt_sol.thres, sizeof(float));
+
+                            // GDOP / PDOP / HDOP / VDOP
+                            put(&d_dop[0], sizeof(double));
+                            put(&d_dop[1], sizeof(double));
+                            put(&d_dop[2], sizeof(double));
+                            put(&d_dop[3], sizeof(double));
+
+                            Async_Dump_Writer::get_instance().write(d_dump_stream_id, record.data(), record.size());
                         }
                 }
         }
@@ -48,6 +48,7 @@
 #include "glonass_gnav_ephemeris.h"
 #include "glonass_gnav_utc_model.h"
 #include "gnss_synchro.h"
+#include "gnss_synchro_map.h"
 #include "gps_almanac.h"
 #include "gps_cnav_ephemeris.h"
 #include "gps_cnav_iono.h"
@@ -63,10 +64,11 @@
 #include "rtklib_conversions.h"
 #include <array>
 #include <cstdint>
-#include <fstream>
 #include <map>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 /** \addtogroup PVT
  * \{ */
@@ -89,7 +91,7 @@ public:
         Pvt_Conf conf);
     ~Rtklib_Solver();
 
-    bool get_PVT(const std::map<int, Gnss_Synchro>& gnss_observables_map, double kf_update_interval_s);
+    bool get_PVT(const Gnss_Synchro_Map& gnss_observables_map, double kf_update_interval_s);
 
     double get_hdop() const override;
     double get_vdop() const override;
@@ -97,7 +99,14 @@ public:
     double get_gdop() const override;
     Monitor_Pvt get_monitor_pvt() const;
     void store_has_data(const Galileo_HAS_data& new_has_data);
-    void update_has_corrections(const std::map<int, Gnss_Synchro>& obs_map);
+    void update_has_corrections(const Gnss_Synchro_Map& obs_map);
+
+    //! Per-constellation single-point sub-solutions of the last full epoch
+    //! (PVT.enable_sub_solutions=true), keyed by system id ('G', 'E', 'R', 'C')
+    const std::map<char, sol_t>& get_sub_solutions() const
+    {
+        return d_sub_solutions;
+    }
 
     sol_t pvt_sol{};
     std::array<ssat_t, MAXSAT> pvt_ssat{};
@@ -129,8 +138,20 @@ public:
 private:
     bool save_matfile() const;
 
-    void check_has_orbit_clock_validity(const std::map<int, Gnss_Synchro>& obs_map);
-    void get_has_biases(const std::map<int, Gnss_Synchro>& obs_map);
+    // KF fast mode: propagate the KF state and validate it against the observed
+    // pseudoranges instead of running the full rtkpos measurement processing
+    bool run_fast_kf_epoch(int num_obs);
+    bool compute_obs_innovations(int num_obs, const double* rr, double& median_m, double& max_residual_m, int& used_sats);
+
+    // integrity sub-solutions: launch one single-point solution per
+    // constellation in parallel threads (sharing one satposs() evaluation)
+    // while the caller computes the combined solution, then join before the
+    // epoch result is published so the output order is preserved
+    void launch_sub_solutions(int num_obs);
+    void join_sub_solutions();
+
+    void check_has_orbit_clock_validity(const Gnss_Synchro_Map& obs_map);
+    void get_has_biases(const Gnss_Synchro_Map& obs_map);
     void get_current_has_obs_correction(const std::string& signal, uint32_t tow_obs, int prn);
 
     std::array<obsd_t, MAXOBS> d_obs_data{};
@@ -146,10 +167,16 @@ private:
 
     std::map<std::string, std::map<int, HAS_obs_corrections>> d_has_obs_corr_map;  // first key is signal, second key is PRN
 
+    std::map<char, sol_t> d_sub_solutions;
+    std::vector<std::pair<char, sol_t>> d_sub_results;  // one slot per worker thread
+    std::vector<std::thread> d_sub_threads;
+
     std::string d_dump_filename;
-    std::ofstream d_dump_file;
+    int d_dump_stream_id = -1;  // handle into the shared Async_Dump_Writer
     rtk_t d_rtk{};
     nav_t d_nav_data{};
+    gtime_t d_last_full_epoch_time{};
+    double d_fast_clock_bias_m{};
     Monitor_Pvt d_monitor_pvt{};
     Pvt_Conf d_conf;
     Pvt_Kf d_pvt_kf;
@@ -113,6 +113,19 @@ public:
         monitor_.set_vdop(monitor->vdop);
         monitor_.set_user_clk_drift_ppm(monitor->user_clk_drift_ppm);
 
+        for (const auto& residual : monitor->sat_residuals)
+            {
+                gnss_sdr::MonitorSatResidual* sat_residual = monitor_.add_sat_residual();
+                sat_residual->set_sys(residual.sys);
+                sat_residual->set_prn(residual.prn);
+                sat_residual->set_valid(residual.valid);
+                sat_residual->set_snr_dbhz(residual.snr_dbhz);
+                sat_residual->set_azimuth_rad(residual.azimuth_rad);
+                sat_residual->set_elevation_rad(residual.elevation_rad);
+                sat_residual->set_pseudorange_residual_m(residual.pseudorange_residual_m);
+                sat_residual->set_carrier_phase_residual_m(residual.carrier_phase_residual_m);
+            }
+
         monitor_.SerializeToString(&data);
         return data;
     }
@@ -151,6 +164,21 @@ public:
         monitor.vdop = mon.vdop();
         monitor.user_clk_drift_ppm = mon.user_clk_drift_ppm();
 
+        monitor.sat_residuals.reserve(mon.sat_residual_size());
+        for (const auto& sat_residual : mon.sat_residual())
+            {
+                Monitor_Sat_Residual residual{};
+                residual.sys = static_cast<uint8_t>(sat_residual.sys());
+                residual.prn = static_cast<uint8_t>(sat_residual.prn());
+                residual.valid = static_cast<uint8_t>(sat_residual.valid());
+                residual.snr_dbhz = sat_residual.snr_dbhz();
+                residual.azimuth_rad = sat_residual.azimuth_rad();
+                residual.elevation_rad = sat_residual.elevation_rad();
+                residual.pseudorange_residual_m = sat_residual.pseudorange_residual_m();
+                residual.carrier_phase_residual_m = sat_residual.carrier_phase_residual_m();
+                monitor.sat_residuals.push_back(residual);
+            }
+
         return monitor;
     }
 
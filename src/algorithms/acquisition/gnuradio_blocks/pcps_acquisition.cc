@@ -21,14 +21,21 @@
 
 #include "pcps_acquisition.h"
 #include "GLONASS_L1_L2_CA.h"  // for GLONASS_PRN
+#include "acquisition_grid_pool.h"
+#include "acquisition_spectrum_cache.h"
+#include "acquisition_wipeoff_cache.h"
+#include "acquisition_worker_pool.h"
+#include "async_dump_writer.h"
+#include "event_log.h"
 #include "MATH_CONSTANTS.h"    // for TWO_PI
 #include "gnss_frequencies.h"
 #include "gnss_sdr_create_directory.h"
+#include "gnss_sdr_fft_size_tuner.h"
 #include "gnss_sdr_filesystem.h"
 #include "gnss_synchro.h"
+#include "streaming_mat_writer.h"
 #include <boost/math/special_functions/gamma.hpp>
 #include <gnuradio/io_signature.h>
-#include <matio.h>
 #include <pmt/pmt.h>        // for from_long
 #include <pmt/pmt_sugar.h>  // for mp
 #include <volk/volk.h>
@@ -38,6 +45,8 @@
 #include <cmath>  // for floor, fmod, rint, ceil
 #include <iostream>
 #include <map>
+#include <thread>
+#include <vector>
 
 
 pcps_acquisition_sptr pcps_make_acquisition(const Acq_Conf& conf_)
@@ -52,16 +61,20 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_)
           gr::io_signature::make(0, 1, sizeof(Gnss_Synchro))),
       d_acq_parameters(conf_),
       d_gnss_synchro(nullptr),
+      d_zero_copy_input(nullptr),
       d_dump_filename(conf_.dump_filename),
       d_dump_number(0LL),
       d_sample_counter(0ULL),
       d_threshold(0.0),
+      d_early_accept_threshold(0.0),
+      d_early_reject_threshold(0.0),
       d_mag(0),
       d_input_power(0.0),
       d_test_statistics(0.0),
       d_doppler_center_step_two(0.0),
       d_state(0),
       d_positive_acq(0),
+      d_dump_stream_id(-1),
       d_doppler_center(0U),
       d_doppler_bias(0),
       d_channel(0U),
@@ -73,23 +86,75 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_)
       d_num_doppler_bins_step2(conf_.num_doppler_bins_step2),
       d_dump_channel(conf_.dump_channel),
       d_buffer_count(0U),
+      d_num_threads(static_cast<uint32_t>(conf_.num_threads)),
+      d_coarse_size(0U),
+      d_hs_blocks(1U),
+      d_sparse_first_bin(0U),
+      d_sparse_num_bins(0U),
       d_active(false),
+      d_batch_fft(conf_.batch_fft && !conf_.bit_transition_flag),
+      d_grid_16_bits(conf_.grid_16_bits),
+      d_batch_codes_stale(true),
+      d_coarse_enabled(false),
       d_worker_active(false),
       d_step_two(false),
       d_use_CFAR_algorithm_flag(conf_.use_CFAR_algorithm_flag),
+      d_use_shared_pool(conf_.use_shared_pool),
+      d_use_grid_pool(conf_.use_grid_pool),
+      d_adaptive_dwells(conf_.adaptive_dwells && conf_.max_dwells > 1U && !conf_.bit_transition_flag),
+      d_doppler_assisted(false),
       d_dump(conf_.dump)
 {
     this->message_port_register_out(pmt::mp("events"));
 
+    // High-sensitivity mode: several code periods per dwell, correlated per
+    // period and combined coherently under parallel data-bit sign hypotheses
+    // (see high_sensitivity_doppler_grid_search). Only wired into the
+    // default serial search loop
+    if (conf_.high_sensitivity)
+        {
+            if (!conf_.bit_transition_flag && (conf_.sampled_ms == conf_.ms_per_code) &&
+                !d_batch_fft && (d_num_threads <= 1) && !d_use_shared_pool &&
+                !conf_.shared_input_fft && !conf_.use_16ic_path && !d_grid_16_bits &&
+                !conf_.sparse_fft && (conf_.coherent_blocks > 1U))
+                {
+                    // 2^(N-1) sign hypotheses are evaluated per Doppler bin;
+                    // cap the coherent span so the hypothesis set stays small
+                    d_hs_blocks = std::min(conf_.coherent_blocks, 6U);
+                    d_consumed_samples *= d_hs_blocks;
+                }
+            else
+                {
+                    LOG(WARNING) << "Acquisition high_sensitivity is not applicable to this configuration, running standard search";
+                }
+        }
+
     if (d_acq_parameters.sampled_ms == d_acq_parameters.ms_per_code)
         {
-            d_fft_size = d_consumed_samples;
+            // in high-sensitivity mode each of the d_hs_blocks code periods
+            // of the snapshot is correlated with its own transform
+            d_fft_size = d_consumed_samples / d_hs_blocks;
         }
     else
         {
             d_fft_size = d_consumed_samples * 2;
         }
-    // d_fft_size = next power of two?  ////
+
+    if (d_acq_parameters.tune_fft_size && !d_acq_parameters.bit_transition_flag && (d_hs_blocks == 1U))
+        {
+            // pad the transform up to the fastest measured smooth length; the
+            // correlation below already zero-pads code and input to d_fft_size,
+            // and the code phase is recovered modulo samples_per_code, so any
+            // length >= the snapshot works. Not applicable with
+            // bit_transition_flag, whose peak search spans half the transform
+            const uint32_t tuned_fft_size = gnss_fft_select_fast_size(d_fft_size);
+            if (tuned_fft_size != d_fft_size)
+                {
+                    LOG(INFO) << "Acquisition FFT length padded from " << d_fft_size
+                              << " to the faster measured length " << tuned_fft_size;
+                    d_fft_size = tuned_fft_size;
+                }
+        }
 
     // COD:
     // Experimenting with the overlap/save technique for handling bit trannsitions
@@ -107,15 +172,67 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_)
     //  d_acq_parameters.max_dwells = 1;  // Activation of d_acq_parameters.bit_transition_flag invalidates the value of d_acq_parameters.max_dwells
     // }
 
+    // The half-precision grid is only wired into the default and step-two
+    // search loops; the batched/threaded/shared-FFT/16ic modes keep their
+    // float grids
+    if (d_grid_16_bits && (d_batch_fft || d_num_threads > 1 || d_use_shared_pool || conf_.shared_input_fft || conf_.use_16ic_path))
+        {
+            LOG(WARNING) << "Parameter grid_16_bits is not compatible with batch_fft, num_threads, use_shared_pool, shared_input_fft or use_16ic_path. Using a single-precision grid";
+            d_grid_16_bits = false;
+        }
+
     d_tmp_buffer = volk_gnsssdr::vector<float>(d_fft_size);
     d_fft_codes = volk_gnsssdr::vector<std::complex<float>>(d_fft_size);
-    d_input_signal = volk_gnsssdr::vector<std::complex<float>>(d_fft_size);
+    d_input_signal = volk_gnsssdr::vector<std::complex<float>>(std::max(d_fft_size, d_consumed_samples));
     d_fft_if = gnss_fft_fwd_make_unique(d_fft_size);
     d_ifft = gnss_fft_rev_make_unique(d_fft_size);
 
     d_grid = arma::fmat();
     d_narrow_grid = arma::fmat();
 
+    // Two-stage search: a decimated pre-search shortlists Doppler bins before
+    // the full-resolution pass. Only available when the FFT length equals the
+    // snapshot length and is divisible by the decimation factor
+    if ((conf_.coarse_decimation > 1U) && !conf_.bit_transition_flag &&
+        (d_fft_size == d_consumed_samples) && (d_fft_size % conf_.coarse_decimation == 0U))
+        {
+            d_coarse_enabled = true;
+            d_coarse_size = d_fft_size / conf_.coarse_decimation;
+            d_fft_coarse = gnss_fft_fwd_make_unique(d_coarse_size);
+            d_ifft_coarse = gnss_fft_rev_make_unique(d_coarse_size);
+            d_fft_codes_coarse = volk_gnsssdr::vector<std::complex<float>>(d_coarse_size);
+            d_coarse_input = volk_gnsssdr::vector<std::complex<float>>(d_coarse_size);
+            d_coarse_wipeoff = volk_gnsssdr::vector<std::complex<float>>(d_coarse_size);
+            d_coarse_magnitude = volk_gnsssdr::vector<float>(d_coarse_size);
+        }
+    else if (conf_.coarse_decimation > 1U)
+        {
+            LOG(WARNING) << "Acquisition coarse_decimation is not applicable to this configuration, running full-resolution search";
+        }
+
+    // Experimental sparse-IFFT search: only for configurations where a single
+    // full-length float dwell decides the detection with the CFAR statistic
+    // through the default serial loop, so a missed sparse dwell can fall back
+    // to the dense search within the same call
+    if (conf_.sparse_fft)
+        {
+            if (!conf_.bit_transition_flag && !d_grid_16_bits && conf_.use_CFAR_algorithm_flag &&
+                (conf_.max_dwells == 1U) && !conf_.dump &&
+                !(d_batch_fft || d_num_threads > 1 || d_use_shared_pool || conf_.shared_input_fft || conf_.use_16ic_path))
+                {
+                    d_sparse_ifft_engine = std::make_unique<Sparse_Ifft_Engine>(d_fft_size);
+                    if (!d_sparse_ifft_engine->valid())
+                        {
+                            LOG(WARNING) << "Acquisition sparse_fft: no suitable subsampling factor for FFT size " << d_fft_size << ", running dense search";
+                            d_sparse_ifft_engine.reset();
+                        }
+                }
+            else
+                {
+                    LOG(WARNING) << "Acquisition sparse_fft is not applicable to this configuration, running dense search";
+                }
+        }
+
     if (conf_.it_size == sizeof(gr_complex))
         {
             d_cshort = false;
@@ -129,6 +246,10 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_)
     if (d_cshort)
         {
             d_data_buffer_sc = volk_gnsssdr::vector<lv_16sc_t>(d_consumed_samples);
+            if (d_acq_parameters.use_16ic_path)
+                {
+                    d_rotated_sc = volk_gnsssdr::vector<lv_16sc_t>(d_consumed_samples);
+                }
         }
 
     if (d_dump)
@@ -192,7 +313,12 @@ void pcps_acquisition::set_local_code(std::complex<float>* code)
         }
     else
         {
-            if (d_acq_parameters.sampled_ms == d_acq_parameters.ms_per_code)
+            if (d_hs_blocks > 1U)
+                {
+                    // one code period; the same code FFT serves every coherent block
+                    std::copy(code, code + d_fft_size, d_fft_if->get_inbuf());
+                }
+            else if (d_acq_parameters.sampled_ms == d_acq_parameters.ms_per_code)
                 {
                     std::copy(code, code + d_consumed_samples, d_fft_if->get_inbuf());
                 }
@@ -205,6 +331,19 @@ void pcps_acquisition::set_local_code(std::complex<float>* code)
 
     d_fft_if->execute();  // We need the FFT of local code
     volk_32fc_conjugate_32fc(d_fft_codes.data(), d_fft_if->get_outbuf(), d_fft_size);
+    d_batch_codes_stale = true;  // the tiled replica used by the batched engine must be rebuilt
+
+    if (d_coarse_enabled)
+        {
+            // Decimated code replica for the coarse pre-search
+            const uint32_t decimation = d_fft_size / d_coarse_size;
+            for (uint32_t i = 0; i < d_coarse_size; i++)
+                {
+                    d_fft_coarse->get_inbuf()[i] = code[i * decimation];
+                }
+            d_fft_coarse->execute();
+            volk_32fc_conjugate_32fc(d_fft_codes_coarse.data(), d_fft_coarse->get_outbuf(), d_coarse_size);
+        }
 }
 
 
@@ -229,22 +368,6 @@ bool pcps_acquisition::is_fdma()
 }
 
 
-void pcps_acquisition::update_local_carrier(own::span<gr_complex> carrier_vector, float freq) const
-{
-    float phase_step_rad;
-    if (d_acq_parameters.use_automatic_resampler)
-        {
-            phase_step_rad = static_cast<float>(TWO_PI) * freq / static_cast<float>(d_acq_parameters.resampled_fs);
-        }
-    else
-        {
-            phase_step_rad = static_cast<float>(TWO_PI) * freq / static_cast<float>(d_acq_parameters.fs_in);
-        }
-    std::array<float, 1> _phase{};
-    volk_gnsssdr_s32f_sincos_32fc(carrier_vector.data(), -phase_step_rad, _phase.data(), carrier_vector.size());
-}
-
-
 void pcps_acquisition::init()
 {
     d_gnss_synchro->Flag_valid_acquisition = false;
@@ -263,21 +386,100 @@ void pcps_acquisition::init()
     // Create the carrier Doppler wipeoff signals
     if (d_grid_doppler_wipeoffs.empty())
         {
-            d_grid_doppler_wipeoffs = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(d_num_doppler_bins, volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
+            if (d_use_grid_pool)
+                {
+                    d_grid_doppler_wipeoffs = Acquisition_Grid_Pool::get_instance().lease_wipeoff_grid(d_num_doppler_bins, d_fft_size);
+                }
+            else
+                {
+                    d_grid_doppler_wipeoffs = volk_gnsssdr::vector<volk_gnsssdr::hugepage_vector<std::complex<float>>>(d_num_doppler_bins, volk_gnsssdr::hugepage_vector<std::complex<float>>(d_fft_size));
+                }
         }
     if (d_acq_parameters.make_2_steps && (d_grid_doppler_wipeoffs_step_two.empty()))
         {
             d_grid_doppler_wipeoffs_step_two = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(d_num_doppler_bins_step2, volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
         }
 
-    if (d_magnitude_grid.empty())
+    if (d_grid_16_bits)
+        {
+            if (d_magnitude_grid_16.empty())
+                {
+                    // binary16 storage: half the footprint and half the memory
+                    // traffic of the noncoherent accumulation
+                    d_magnitude_grid_16 = volk_gnsssdr::vector<volk_gnsssdr::vector<uint16_t>>(d_num_doppler_bins, volk_gnsssdr::vector<uint16_t>(d_fft_size));
+                }
+        }
+    else if (d_magnitude_grid.empty())
+        {
+            if (d_use_grid_pool)
+                {
+                    d_magnitude_grid = Acquisition_Grid_Pool::get_instance().lease_magnitude_grid(d_num_doppler_bins, d_fft_size);
+                }
+            else
+                {
+                    d_magnitude_grid = volk_gnsssdr::vector<volk_gnsssdr::hugepage_vector<float>>(d_num_doppler_bins, volk_gnsssdr::hugepage_vector<float>(d_fft_size));
+                }
+        }
+
+    if (d_hs_blocks > 1U)
         {
-            d_magnitude_grid = volk_gnsssdr::vector<volk_gnsssdr::vector<float>>(d_num_doppler_bins, volk_gnsssdr::vector<float>(d_fft_size));
+            if (d_hs_corr_blocks.empty())
+                {
+                    if (d_use_grid_pool)
+                        {
+                            d_hs_corr_blocks = Acquisition_Grid_Pool::get_instance().lease_wipeoff_grid(d_hs_blocks, d_fft_size);
+                        }
+                    else
+                        {
+                            d_hs_corr_blocks = volk_gnsssdr::vector<volk_gnsssdr::hugepage_vector<std::complex<float>>>(d_hs_blocks, volk_gnsssdr::hugepage_vector<std::complex<float>>(d_fft_size));
+                        }
+                }
+            if (d_hs_accum.empty())
+                {
+                    d_hs_accum = volk_gnsssdr::vector<std::complex<float>>(d_fft_size);
+                    d_hs_hyp_mag = volk_gnsssdr::vector<float>(d_fft_size);
+                }
+        }
+
+    if ((d_num_threads > 1 || d_use_shared_pool) && d_fft_if_pool.empty())
+        {
+            // Each worker owns its FFT plans and scratch so no locking is
+            // needed inside the Doppler grid loop. With the shared pool the
+            // submitting thread also executes work units, hence the +1
+            const uint32_t num_workers = d_use_shared_pool ? Acquisition_Worker_Pool::get_instance().size() + 1 : d_num_threads;
+            const uint32_t pool_size = std::min(num_workers, d_num_doppler_bins);
+            for (uint32_t i = 0; i < pool_size; i++)
+                {
+                    d_fft_if_pool.push_back(gnss_fft_fwd_make_unique(d_fft_size));
+                    d_ifft_pool.push_back(gnss_fft_rev_make_unique(d_fft_size));
+                    d_tmp_buffer_pool.emplace_back(d_fft_size);
+                }
+        }
+
+    if (d_batch_fft && d_batch_fwd_grid.empty())
+        {
+            // One contiguous slab per stage so the whole Doppler grid is
+            // processed with single volk calls instead of per-bin ones
+            d_batch_fwd_grid = volk_gnsssdr::vector<std::complex<float>>(static_cast<size_t>(d_num_doppler_bins) * d_fft_size);
+            d_batch_codes = volk_gnsssdr::vector<std::complex<float>>(static_cast<size_t>(d_num_doppler_bins) * d_fft_size);
+            d_batch_codes_stale = true;
         }
 
     for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
         {
-            std::fill(d_magnitude_grid[doppler_index].begin(), d_magnitude_grid[doppler_index].end(), 0.0);
+            if (d_grid_16_bits)
+                {
+                    std::fill(d_magnitude_grid_16[doppler_index].begin(), d_magnitude_grid_16[doppler_index].end(), 0);
+                }
+            else
+                {
+                    std::fill(d_magnitude_grid[doppler_index].begin(), d_magnitude_grid[doppler_index].end(), 0.0);
+                }
+        }
+
+    if (d_coarse_enabled && d_coarse_bin_max.size() != d_num_doppler_bins)
+        {
+            d_coarse_bin_max = volk_gnsssdr::vector<float>(d_num_doppler_bins);
         }
 
     update_grid_doppler_wipeoffs();
@@ -294,20 +496,105 @@ void pcps_acquisition::init()
 
 void pcps_acquisition::update_grid_doppler_wipeoffs()
 {
-    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+    // The Doppler bins are evenly spaced, so the whole grid can be generated
+    // with a single sincos pass plus one complex product per bin
+    const float fs = d_acq_parameters.use_automatic_resampler ? static_cast<float>(d_acq_parameters.resampled_fs) : static_cast<float>(d_acq_parameters.fs_in);
+    const int32_t doppler_min = -static_cast<int32_t>(d_acq_parameters.doppler_max) + d_doppler_center;
+    const float phase_step_start = -static_cast<float>(TWO_PI) * static_cast<float>(d_doppler_bias + doppler_min) / fs;
+    const float phase_step_delta = -static_cast<float>(TWO_PI) * static_cast<float>(d_doppler_step) / fs;
+    const auto generate = [&]() {
+        std::vector<lv_32fc_t*> grid_ptrs(d_num_doppler_bins);
+        for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+            {
+                grid_ptrs[doppler_index] = d_grid_doppler_wipeoffs[doppler_index].data();
+            }
+        volk_gnsssdr_s32f_sincos_32fc_xn(grid_ptrs.data(), phase_step_start, phase_step_delta, static_cast<int>(d_num_doppler_bins), d_fft_size);
+    };
+    // Channels with identical phase steps (all satellites of a band, and
+    // co-located bands fed at the same rate from one conditioner clock that
+    // search the same Doppler span) get bit-identical grids, so only the
+    // first one pays the sincos pass and the rest copy the cached master.
+    // FDMA biases and assisted Doppler centers make the grid
+    // channel-specific and are generated directly
+    if ((d_doppler_bias == 0) && (d_doppler_center == 0))
         {
-            const int32_t doppler = -static_cast<int32_t>(d_acq_parameters.doppler_max) + d_doppler_center + d_doppler_step * doppler_index;
-            update_local_carrier(d_grid_doppler_wipeoffs[doppler_index], static_cast<float>(d_doppler_bias + doppler));
+            Acquisition_Wipeoff_Cache::get_instance().fill(phase_step_start, phase_step_delta, d_num_doppler_bins, d_fft_size, d_grid_doppler_wipeoffs, generate);
+        }
+    else
+        {
+            generate();
         }
 }
 
 
 void pcps_acquisition::update_grid_doppler_wipeoffs_step2()
 {
+    const float fs = d_acq_parameters.use_automatic_resampler ? static_cast<float>(d_acq_parameters.resampled_fs) : static_cast<float>(d_acq_parameters.fs_in);
+    const float doppler_first = d_doppler_center_step_two - static_cast<float>(floor(d_num_doppler_bins_step2 / 2.0)) * d_acq_parameters.doppler_step2;
+    const float phase_step_start = -static_cast<float>(TWO_PI) * doppler_first / fs;
+    const float phase_step_delta = -static_cast<float>(TWO_PI) * d_acq_parameters.doppler_step2 / fs;
+    std::vector<lv_32fc_t*> grid_ptrs(d_num_doppler_bins_step2);
     for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins_step2; doppler_index++)
         {
-            const float doppler = (static_cast<float>(doppler_index) - static_cast<float>(floor(d_num_doppler_bins_step2 / 2.0))) * d_acq_parameters.doppler_step2;
-            update_local_carrier(d_grid_doppler_wipeoffs_step_two[doppler_index], d_doppler_center_step_two + doppler);
+            grid_ptrs[doppler_index] = d_grid_doppler_wipeoffs_step_two[doppler_index].data();
+        }
+    volk_gnsssdr_s32f_sincos_32fc_xn(grid_ptrs.data(), phase_step_start, phase_step_delta, static_cast<int>(d_num_doppler_bins_step2), d_fft_size);
+}
+
+
+void pcps_acquisition::lease_grid_buffers()
+{
+    // (re)acquire the large grid buffers for the duration of this search.
+    // Before the first init() the grid dimensions are still unknown, and
+    // init() leases them itself in that case
+    if (d_num_doppler_bins == 0U)
+        {
+            return;
+        }
+    bool wipeoffs_leased = false;
+    if (d_grid_doppler_wipeoffs.empty())
+        {
+            d_grid_doppler_wipeoffs = Acquisition_Grid_Pool::get_instance().lease_wipeoff_grid(d_num_doppler_bins, d_fft_size);
+            wipeoffs_leased = true;
+        }
+    if (!d_grid_16_bits && d_magnitude_grid.empty())
+        {
+            d_magnitude_grid = Acquisition_Grid_Pool::get_instance().lease_magnitude_grid(d_num_doppler_bins, d_fft_size);
+            for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+                {
+                    std::fill(d_magnitude_grid[doppler_index].begin(), d_magnitude_grid[doppler_index].end(), 0.0);
+                }
+        }
+    if (d_hs_blocks > 1U && d_hs_corr_blocks.empty())
+        {
+            // per-block correlation scratch of the high-sensitivity mode,
+            // recycled through the same pool (content is overwritten per bin)
+            d_hs_corr_blocks = Acquisition_Grid_Pool::get_instance().lease_wipeoff_grid(d_hs_blocks, d_fft_size);
+        }
+    if (wipeoffs_leased)
+        {
+            // the recycled buffer carries the wipeoffs of another channel
+            update_grid_doppler_wipeoffs();
+        }
+}
+
+
+void pcps_acquisition::release_grid_buffers()
+{
+    if (!d_grid_doppler_wipeoffs.empty())
+        {
+            Acquisition_Grid_Pool::get_instance().release(std::move(d_grid_doppler_wipeoffs));
+            d_grid_doppler_wipeoffs.clear();
+        }
+    if (!d_magnitude_grid.empty())
+        {
+            Acquisition_Grid_Pool::get_instance().release(std::move(d_magnitude_grid));
+            d_magnitude_grid.clear();
+        }
+    if (!d_hs_corr_blocks.empty())
+        {
+            Acquisition_Grid_Pool::get_instance().release(std::move(d_hs_corr_blocks));
+            d_hs_corr_blocks.clear();
         }
 }
 
@@ -350,6 +637,7 @@ void pcps_acquisition::send_positive_acquisition()
                << ", magnitude " << d_mag
                << ", input signal power " << d_input_power
                << ", Assist doppler_center " << d_doppler_center;
+    Event_Log::get_instance().record(Event_Log::Event::acquisition_positive, d_channel, d_gnss_synchro->PRN, d_test_statistics, d_gnss_synchro->Acq_doppler_hz);
     d_positive_acq = 1;
 
     if (!d_channel_fsm.expired())
@@ -385,8 +673,28 @@ void pcps_acquisition::send_negative_acquisition()
                << ", doppler " << d_gnss_synchro->Acq_doppler_hz
                << ", magnitude " << d_mag
                << ", input signal power " << d_input_power;
+    Event_Log::get_instance().record(Event_Log::Event::acquisition_negative, d_channel, d_gnss_synchro->PRN, d_test_statistics, d_gnss_synchro->Acq_doppler_hz);
     d_positive_acq = 0;
-    this->message_port_pub(pmt::mp("events"), pmt::from_long(2));
+
+    if (!d_channel_fsm.expired())
+        {
+            // the channel FSM is set, so, notify it directly the negative acquisition to minimize delays
+            d_channel_fsm.lock()->Event_failed_acquisition();
+        }
+    else
+        {
+            this->message_port_pub(pmt::mp("events"), pmt::from_long(2));
+        }
+}
+
+
+pcps_acquisition::~pcps_acquisition()
+{
+    if (d_dump_stream_id >= 0)
+        {
+            Async_Dump_Writer::get_instance().close_stream(d_dump_stream_id);
+            d_dump_stream_id = -1;
+        }
 }
 
 
@@ -407,89 +715,176 @@ void pcps_acquisition::dump_results(int32_t effective_fft_size)
     filename.append(std::to_string(d_gnss_synchro->PRN));
     filename.append(".mat");
 
-    mat_t* matfp = Mat_CreateVer(filename.c_str(), nullptr, MAT_FT_MAT73);
-    if (matfp == nullptr)
+    Streaming_Mat_Writer mat_writer;
+    if (!mat_writer.open(filename))
         {
             std::cout << "Unable to create or open Acquisition dump file\n";
             // d_acq_parameters.dump = false;
         }
     else
         {
-            std::array<size_t, 2> dims{static_cast<size_t>(effective_fft_size), static_cast<size_t>(d_num_doppler_bins)};
-            matvar_t* matvar = Mat_VarCreate("acq_grid", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), d_grid.memptr(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            dims[0] = static_cast<size_t>(1);
-            dims[1] = static_cast<size_t>(1);
-            matvar = Mat_VarCreate("doppler_max", MAT_C_INT32, MAT_T_INT32, 1, dims.data(), &d_acq_parameters.doppler_max, 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("doppler_step", MAT_C_INT32, MAT_T_INT32, 1, dims.data(), &d_doppler_step, 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
+            // the grid is appended one Doppler bin at a time, so the writer
+            // never holds more than one column in flight
+            mat_writer.begin_variable("acq_grid", Streaming_Mat_Writer::Mat_Type::mat_single, static_cast<size_t>(effective_fft_size));
+            for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+                {
+                    mat_writer.append(d_grid.colptr(doppler_index), static_cast<size_t>(effective_fft_size));
+                }
+            mat_writer.end_variable();
 
-            matvar = Mat_VarCreate("d_positive_acq", MAT_C_INT32, MAT_T_INT32, 1, dims.data(), &d_positive_acq, 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
+            mat_writer.write_variable("doppler_max", Streaming_Mat_Writer::Mat_Type::mat_int32, 1, &d_acq_parameters.doppler_max, 1);
+            mat_writer.write_variable("doppler_step", Streaming_Mat_Writer::Mat_Type::mat_int32, 1, &d_doppler_step, 1);
+            mat_writer.write_variable("d_positive_acq", Streaming_Mat_Writer::Mat_Type::mat_int32, 1, &d_positive_acq, 1);
 
             auto aux = static_cast<float>(d_gnss_synchro->Acq_doppler_hz);
-            matvar = Mat_VarCreate("acq_doppler_hz", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims.data(), &aux, 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
+            mat_writer.write_variable("acq_doppler_hz", Streaming_Mat_Writer::Mat_Type::mat_single, 1, &aux, 1);
 
             aux = static_cast<float>(d_gnss_synchro->Acq_delay_samples);
-            matvar = Mat_VarCreate("acq_delay_samples", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims.data(), &aux, 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
+            mat_writer.write_variable("acq_delay_samples", Streaming_Mat_Writer::Mat_Type::mat_single, 1, &aux, 1);
 
-            matvar = Mat_VarCreate("test_statistic", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims.data(), &d_test_statistics, 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
+            mat_writer.write_variable("test_statistic", Streaming_Mat_Writer::Mat_Type::mat_single, 1, &d_test_statistics, 1);
+            mat_writer.write_variable("threshold", Streaming_Mat_Writer::Mat_Type::mat_single, 1, &d_threshold, 1);
+            mat_writer.write_variable("input_power", Streaming_Mat_Writer::Mat_Type::mat_single, 1, &d_input_power, 1);
+            mat_writer.write_variable("sample_counter", Streaming_Mat_Writer::Mat_Type::mat_uint64, 1, &d_sample_counter, 1);
+            mat_writer.write_variable("PRN", Streaming_Mat_Writer::Mat_Type::mat_uint32, 1, &d_gnss_synchro->PRN, 1);
+            mat_writer.write_variable("num_dwells", Streaming_Mat_Writer::Mat_Type::mat_int32, 1, &d_num_noncoherent_integrations_counter, 1);
 
-            matvar = Mat_VarCreate("threshold", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims.data(), &d_threshold, 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
+            if (d_acq_parameters.make_2_steps)
+                {
+                    mat_writer.begin_variable("acq_grid_narrow", Streaming_Mat_Writer::Mat_Type::mat_single, static_cast<size_t>(effective_fft_size));
+                    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins_step2; doppler_index++)
+                        {
+                            mat_writer.append(d_narrow_grid.colptr(doppler_index), static_cast<size_t>(effective_fft_size));
+                        }
+                    mat_writer.end_variable();
 
-            matvar = Mat_VarCreate("input_power", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims.data(), &d_input_power, 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
+                    mat_writer.write_variable("doppler_step_narrow", Streaming_Mat_Writer::Mat_Type::mat_single, 1, &d_acq_parameters.doppler_step2, 1);
 
-            matvar = Mat_VarCreate("sample_counter", MAT_C_UINT64, MAT_T_UINT64, 1, dims.data(), &d_sample_counter, 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
+                    aux = d_doppler_center_step_two - static_cast<float>(floor(d_num_doppler_bins_step2 / 2.0)) * d_acq_parameters.doppler_step2;
+                    mat_writer.write_variable("doppler_grid_narrow_min", Streaming_Mat_Writer::Mat_Type::mat_single, 1, &aux, 1);
+                }
 
-            matvar = Mat_VarCreate("PRN", MAT_C_UINT32, MAT_T_UINT32, 1, dims.data(), &d_gnss_synchro->PRN, 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
+            mat_writer.close();
+        }
+}
 
-            matvar = Mat_VarCreate("num_dwells", MAT_C_INT32, MAT_T_INT32, 1, dims.data(), &d_num_noncoherent_integrations_counter, 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
 
-            if (d_acq_parameters.make_2_steps)
+void pcps_acquisition::dump_results_compact(int32_t effective_fft_size)
+{
+    d_dump_number++;
+    if (d_dump_stream_id < 0)
+        {
+            std::string filename = d_dump_filename;
+            filename.append("_compact_");
+            filename.append(1, d_gnss_synchro->System);
+            filename.append("_");
+            filename.append(1, d_gnss_synchro->Signal[0]);
+            filename.append(1, d_gnss_synchro->Signal[1]);
+            filename.append("_ch_");
+            filename.append(std::to_string(d_channel));
+            filename.append(".dat");
+            d_dump_stream_id = Async_Dump_Writer::get_instance().open_stream(filename);
+            if (d_dump_stream_id < 0)
                 {
-                    dims[0] = static_cast<size_t>(effective_fft_size);
-                    dims[1] = static_cast<size_t>(d_num_doppler_bins_step2);
-                    matvar = Mat_VarCreate("acq_grid_narrow", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), d_narrow_grid.memptr(), 0);
-                    Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-                    Mat_VarFree(matvar);
+                    std::cout << "Unable to create or open Acquisition dump file\n";
+                    d_dump = false;
+                    return;
+                }
+        }
 
-                    dims[0] = static_cast<size_t>(1);
-                    dims[1] = static_cast<size_t>(1);
-                    matvar = Mat_VarCreate("doppler_step_narrow", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims.data(), &d_acq_parameters.doppler_step2, 0);
-                    Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-                    Mat_VarFree(matvar);
+    struct Grid_Peak
+    {
+        float mag;
+        uint32_t code_index;
+        uint32_t doppler_index;
+    };
+    const uint32_t topk = std::min(d_acq_parameters.dump_topk, static_cast<uint32_t>(effective_fft_size) * d_num_doppler_bins);
+    std::vector<Grid_Peak> peaks;  // kept sorted by descending magnitude
+    peaks.reserve(topk + 1);
+
+    // coarse grid: max-pooled along the code axis, so narrow correlation peaks
+    // survive the decimation instead of being subsampled away
+    const uint32_t decim = d_acq_parameters.dump_decimation;
+    const uint32_t rows_out = (static_cast<uint32_t>(effective_fft_size) + decim - 1U) / decim;
+    std::vector<float> coarse_grid(static_cast<size_t>(rows_out) * d_num_doppler_bins, 0.0F);
 
-                    aux = d_doppler_center_step_two - static_cast<float>(floor(d_num_doppler_bins_step2 / 2.0)) * d_acq_parameters.doppler_step2;
-                    matvar = Mat_VarCreate("doppler_grid_narrow_min", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims.data(), &aux, 0);
-                    Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-                    Mat_VarFree(matvar);
+    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+        {
+            const float* col = d_grid.colptr(doppler_index);
+            float* pooled = coarse_grid.data() + static_cast<size_t>(doppler_index) * rows_out;
+            for (int32_t i = 0; i < effective_fft_size; i++)
+                {
+                    const float mag = col[i];
+                    float& cell = pooled[static_cast<uint32_t>(i) / decim];
+                    if (mag > cell)
+                        {
+                            cell = mag;
+                        }
+                    if (peaks.size() < topk or mag > peaks.back().mag)
+                        {
+                            const auto it = std::upper_bound(peaks.begin(), peaks.end(), mag,
+                                [](float m, const Grid_Peak& q) { return m > q.mag; });
+                            peaks.insert(it, Grid_Peak{mag, static_cast<uint32_t>(i), doppler_index});
+                            if (peaks.size() > topk)
+                                {
+                                    peaks.pop_back();
+                                }
+                        }
                 }
+        }
 
-            Mat_Close(matfp);
+    // one self-contained record: fixed header, then the peak list, then the
+    // pooled grid in Doppler bin order
+    std::vector<char> record;
+    record.reserve(64 + peaks.size() * 12 + coarse_grid.size() * sizeof(float));
+    const auto append = [&record](const void* p, size_t n) {
+        const auto* c = static_cast<const char*>(p);
+        record.insert(record.end(), c, c + n);
+    };
+    const auto dump_number = static_cast<uint32_t>(d_dump_number);
+    append(&dump_number, sizeof(uint32_t));
+    append(&d_gnss_synchro->PRN, sizeof(uint32_t));
+    append(&d_positive_acq, sizeof(int32_t));
+    append(&d_sample_counter, sizeof(uint64_t));
+    append(&d_test_statistics, sizeof(float));
+    append(&d_threshold, sizeof(float));
+    append(&d_input_power, sizeof(float));
+    auto aux = static_cast<float>(d_gnss_synchro->Acq_doppler_hz);
+    append(&aux, sizeof(float));
+    aux = static_cast<float>(d_gnss_synchro->Acq_delay_samples);
+    append(&aux, sizeof(float));
+    append(&d_acq_parameters.doppler_max, sizeof(int32_t));
+    append(&d_doppler_step, sizeof(uint32_t));
+    append(&d_doppler_center, sizeof(int32_t));
+    const auto num_dwells = static_cast<int32_t>(d_num_noncoherent_integrations_counter);
+    append(&num_dwells, sizeof(int32_t));
+    const auto n_peaks = static_cast<uint32_t>(peaks.size());
+    append(&n_peaks, sizeof(uint32_t));
+    append(&rows_out, sizeof(uint32_t));
+    append(&d_num_doppler_bins, sizeof(uint32_t));
+    append(&decim, sizeof(uint32_t));
+    for (const auto& p : peaks)
+        {
+            append(&p.code_index, sizeof(uint32_t));
+            const int32_t doppler_hz = -d_acq_parameters.doppler_max + d_doppler_center + static_cast<int32_t>(d_doppler_step) * static_cast<int32_t>(p.doppler_index);
+            append(&doppler_hz, sizeof(int32_t));
+            append(&p.mag, sizeof(float));
         }
+    append(coarse_grid.data(), coarse_grid.size() * sizeof(float));
+
+    Async_Dump_Writer::get_instance().write(d_dump_stream_id, record.data(), record.size());
+}
+
+
+const float* pcps_acquisition::magnitude_row(uint32_t doppler_index, int32_t num_samples)
+{
+    if (d_grid_16_bits)
+        {
+            // widen the binary16 row into the scratch buffer for the readers
+            volk_gnsssdr_16u_convert_32f(d_tmp_buffer.data(), d_magnitude_grid_16[doppler_index].data(), num_samples);
+            return d_tmp_buffer.data();
+        }
+    return d_magnitude_grid[doppler_index].data();
 }
 
 
@@ -499,15 +894,22 @@ float pcps_acquisition::max_to_input_power_statistic(uint32_t& indext, int32_t&
     uint32_t index_doppler = 0U;
     uint32_t tmp_intex_t = 0U;
     uint32_t index_time = 0U;
+    float row_max = 0.0F;
+    float row_sum = 0.0F;
+    float row_sum_sq = 0.0F;
     const int32_t effective_fft_size = (d_acq_parameters.bit_transition_flag ? d_fft_size / 2 : d_fft_size);
+    std::vector<float> row_sums(num_doppler_bins);
 
-    // Find the correlation peak and the carrier frequency
+    // Find the correlation peak and the carrier frequency. The fused kernel
+    // also delivers the per-row sums in the same pass, so the noise floor
+    // estimate below does not need a second traversal of the grid
     for (uint32_t i = 0; i < num_doppler_bins; i++)
         {
-            volk_gnsssdr_32f_index_max_32u(&tmp_intex_t, d_magnitude_grid[i].data(), effective_fft_size);
-            if (d_magnitude_grid[i][tmp_intex_t] > grid_maximum)
+            volk_gnsssdr_32f_index_max_stats_32u(&tmp_intex_t, &row_max, &row_sum, &row_sum_sq, magnitude_row(i, effective_fft_size), effective_fft_size);
+            row_sums[i] = row_sum;
+            if (row_max > grid_maximum)
                 {
-                    grid_maximum = d_magnitude_grid[i][tmp_intex_t];
+                    grid_maximum = row_max;
                     index_doppler = i;
                     index_time = tmp_intex_t;
                 }
@@ -516,7 +918,7 @@ float pcps_acquisition::max_to_input_power_statistic(uint32_t& indext, int32_t&
     if (!d_step_two)
         {
             const auto index_opp = (index_doppler + d_num_doppler_bins / 2) % d_num_doppler_bins;
-            d_input_power = static_cast<float>(std::accumulate(d_magnitude_grid[index_opp].data(), d_magnitude_grid[index_opp].data() + effective_fft_size, static_cast<float>(0.0)) / effective_fft_size / 2.0 / d_num_noncoherent_integrations_counter);
+            d_input_power = static_cast<float>(row_sums[index_opp] / effective_fft_size / 2.0 / d_num_noncoherent_integrations_counter);
             doppler = -static_cast<int32_t>(doppler_max) + d_doppler_center + doppler_step * static_cast<int32_t>(index_doppler);
         }
     else
@@ -542,10 +944,11 @@ float pcps_acquisition::first_vs_second_peak_statistic(uint32_t& indext, int32_t
     // Find the correlation peak and the carrier frequency
     for (uint32_t i = 0; i < num_doppler_bins; i++)
         {
-            volk_gnsssdr_32f_index_max_32u(&tmp_intex_t, d_magnitude_grid[i].data(), d_fft_size);
-            if (d_magnitude_grid[i][tmp_intex_t] > firstPeak)
+            const float* row = magnitude_row(i, d_fft_size);
+            volk_gnsssdr_32f_index_max_32u(&tmp_intex_t, row, d_fft_size);
+            if (row[tmp_intex_t] > firstPeak)
                 {
-                    firstPeak = d_magnitude_grid[i][tmp_intex_t];
+                    firstPeak = row[tmp_intex_t];
                     index_doppler = i;
                     index_time = tmp_intex_t;
                 }
@@ -576,7 +979,11 @@ float pcps_acquisition::first_vs_second_peak_statistic(uint32_t& indext, int32_t
         }
 
     int32_t idx = excludeRangeIndex1;
-    std::copy(d_magnitude_grid[index_doppler].data(), d_magnitude_grid[index_doppler].data() + d_fft_size, d_tmp_buffer.data());
+    const float* peak_row = magnitude_row(index_doppler, d_fft_size);
+    if (peak_row != d_tmp_buffer.data())
+        {
+            std::copy(peak_row, peak_row + d_fft_size, d_tmp_buffer.data());
+        }
     do
         {
             d_tmp_buffer[idx] = 0.0;
@@ -597,6 +1004,445 @@ float pcps_acquisition::first_vs_second_peak_statistic(uint32_t& indext, int32_t
 }
 
 
+void pcps_acquisition::doppler_grid_worker(const gr_complex* in, int32_t effective_fft_size, uint32_t first_bin, uint32_t last_bin, uint32_t worker_index)
+{
+    gnss_fft_complex_fwd* fft_if = d_fft_if_pool[worker_index].get();
+    gnss_fft_complex_rev* ifft = d_ifft_pool[worker_index].get();
+    float* tmp_buffer = d_tmp_buffer_pool[worker_index].data();
+    const size_t offset = (d_acq_parameters.bit_transition_flag ? effective_fft_size : 0);
+
+    for (uint32_t doppler_index = first_bin; doppler_index < last_bin; doppler_index++)
+        {
+            // Remove Doppler
+            volk_32fc_x2_multiply_32fc(fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs[doppler_index].data(), d_fft_size);
+
+            // Perform the FFT-based convolution (parallel time search)
+            fft_if->execute();
+
+            // Multiply with the local FFT'd code reference
+            volk_32fc_x2_multiply_32fc(ifft->get_inbuf(), fft_if->get_outbuf(), d_fft_codes.data(), d_fft_size);
+
+            // Compute the inverse FFT
+            ifft->execute();
+
+            // Compute squared magnitude (and accumulate in case of non-coherent integration)
+            if (d_num_noncoherent_integrations_counter == 1)
+                {
+                    volk_32fc_magnitude_squared_32f(d_magnitude_grid[doppler_index].data(), ifft->get_outbuf() + offset, effective_fft_size);
+                }
+            else
+                {
+                    // fused squared magnitude + accumulation: one pass over the
+                    // cache-hot IFFT output, one read-modify-write of the grid row
+                    volk_gnsssdr_32fc_magnitude_squared_accumulate_32f(d_magnitude_grid[doppler_index].data(), ifft->get_outbuf() + offset, effective_fft_size);
+                }
+            // Record results to file if required
+            if (d_dump and d_channel == d_dump_channel)
+                {
+                    std::copy(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data() + effective_fft_size, d_grid.colptr(doppler_index));
+                }
+        }
+}
+
+
+void pcps_acquisition::threaded_doppler_grid_search(const gr_complex* in, int32_t effective_fft_size)
+{
+    // Split the Doppler bins across the worker pool. Each worker writes to
+    // disjoint rows of d_magnitude_grid, so the only synchronization needed
+    // is the final join; the peak reduction runs on the calling thread.
+    const auto pool_size = static_cast<uint32_t>(d_fft_if_pool.size());
+    const uint32_t bins_per_worker = (d_num_doppler_bins + pool_size - 1) / pool_size;
+    if (d_use_shared_pool)
+        {
+            // submit the bin ranges as work units to the receiver-wide pool,
+            // so the spare cores of channels already tracking execute them.
+            // Each unit owns a distinct set of FFT plans and scratch, so the
+            // units can run on any pool thread without locking
+            std::vector<std::function<void()>> work_units;
+            work_units.reserve(pool_size);
+            for (uint32_t worker_index = 0; worker_index < pool_size; worker_index++)
+                {
+                    const uint32_t first_bin = worker_index * bins_per_worker;
+                    const uint32_t last_bin = std::min(first_bin + bins_per_worker, d_num_doppler_bins);
+                    if (first_bin >= last_bin)
+                        {
+                            break;
+                        }
+                    work_units.emplace_back([this, in, effective_fft_size, first_bin, last_bin, worker_index] {
+                        doppler_grid_worker(in, effective_fft_size, first_bin, last_bin, worker_index);
+                    });
+                }
+            Acquisition_Worker_Pool::get_instance().run_and_wait(work_units);
+            return;
+        }
+    std::vector<std::thread> workers;
+    workers.reserve(pool_size);
+    for (uint32_t worker_index = 0; worker_index < pool_size; worker_index++)
+        {
+            const uint32_t first_bin = worker_index * bins_per_worker;
+            const uint32_t last_bin = std::min(first_bin + bins_per_worker, d_num_doppler_bins);
+            if (first_bin >= last_bin)
+                {
+                    break;
+                }
+            workers.emplace_back(&pcps_acquisition::doppler_grid_worker, this, in, effective_fft_size, first_bin, last_bin, worker_index);
+        }
+    for (auto& worker : workers)
+        {
+            worker.join();
+        }
+}
+
+
+void pcps_acquisition::shared_fft_doppler_grid_search(const gr_complex* in, int32_t effective_fft_size, uint64_t samp_count)
+{
+    // Frequency-domain Doppler search sharing one input FFT per band: the
+    // input spectrum is computed (or fetched) once from the process-wide
+    // cache, and each Doppler bin is obtained by circularly rotating that
+    // spectrum before the code multiplication. The Doppler wipeoff is thus
+    // quantized to the spectral bin spacing fs/fft_size, i.e. the inverse of
+    // the coherent integration time, so this mode is intended for
+    // doppler_step values not smaller than that spacing.
+    const std::string band_key = std::string(d_gnss_synchro->Signal, 2) + "_" + std::to_string(d_fft_size);
+    const auto spectrum = Acquisition_Spectrum_Cache::get_instance().get_spectrum(band_key, samp_count, d_fft_size,
+        [&](std::complex<float>* out) {
+            std::copy(in, in + d_fft_size, d_fft_if->get_inbuf());
+            d_fft_if->execute();
+            std::copy(d_fft_if->get_outbuf(), d_fft_if->get_outbuf() + d_fft_size, out);
+        });
+
+    const double fs = (d_acq_parameters.use_automatic_resampler ? static_cast<double>(d_acq_parameters.resampled_fs) : static_cast<double>(d_acq_parameters.fs_in));
+    const size_t offset = (d_acq_parameters.bit_transition_flag ? effective_fft_size : 0);
+
+    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+        {
+            const int32_t doppler = -static_cast<int32_t>(d_acq_parameters.doppler_max) + d_doppler_center + d_doppler_step * doppler_index;
+            const auto shift = static_cast<int32_t>(std::rint(static_cast<double>(d_doppler_bias + doppler) * static_cast<double>(d_fft_size) / fs));
+            const uint32_t rotation = static_cast<uint32_t>(((shift % static_cast<int32_t>(d_fft_size)) + static_cast<int32_t>(d_fft_size)) % static_cast<int32_t>(d_fft_size));
+
+            // ifft_in[k] = spectrum[(k + rotation) mod fft_size] * conj(code_fft[k])
+            volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), spectrum->data() + rotation, d_fft_codes.data(), d_fft_size - rotation);
+            if (rotation > 0)
+                {
+                    volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf() + (d_fft_size - rotation), spectrum->data(), d_fft_codes.data() + (d_fft_size - rotation), rotation);
+                }
+
+            d_ifft->execute();
+
+            if (d_num_noncoherent_integrations_counter == 1)
+                {
+                    volk_32fc_magnitude_squared_32f(d_magnitude_grid[doppler_index].data(), d_ifft->get_outbuf() + offset, effective_fft_size);
+                }
+            else
+                {
+                    volk_gnsssdr_32fc_magnitude_squared_accumulate_32f(d_magnitude_grid[doppler_index].data(), d_ifft->get_outbuf() + offset, effective_fft_size);
+                }
+            if (d_dump and d_channel == d_dump_channel)
+                {
+                    std::copy(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data() + effective_fft_size, d_grid.colptr(doppler_index));
+                }
+        }
+}
+
+
+void pcps_acquisition::coarse_doppler_prefilter(const gr_complex* in, std::vector<char>& selected_bins)
+{
+    // Decimated pre-search: evaluate the whole Doppler grid on 1/D of the
+    // samples (a D^2-fold smaller workload) and shortlist the most promising
+    // bins for the full-resolution pass. The bins opposite to each candidate
+    // are shortlisted as well so that the CFAR input-power estimate of
+    // max_to_input_power_statistic() operates on computed rows.
+    const uint32_t decimation = d_fft_size / d_coarse_size;
+    for (uint32_t i = 0; i < d_coarse_size; i++)
+        {
+            d_coarse_input[i] = in[i * decimation];
+        }
+
+    uint32_t tmp_index = 0U;
+    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+        {
+            // the decimated wipeoff is a strided view of the full-rate one
+            for (uint32_t i = 0; i < d_coarse_size; i++)
+                {
+                    d_coarse_wipeoff[i] = d_grid_doppler_wipeoffs[doppler_index][i * decimation];
+                }
+            volk_32fc_x2_multiply_32fc(d_fft_coarse->get_inbuf(), d_coarse_input.data(), d_coarse_wipeoff.data(), d_coarse_size);
+            d_fft_coarse->execute();
+            volk_32fc_x2_multiply_32fc(d_ifft_coarse->get_inbuf(), d_fft_coarse->get_outbuf(), d_fft_codes_coarse.data(), d_coarse_size);
+            d_ifft_coarse->execute();
+            volk_32fc_magnitude_squared_32f(d_coarse_magnitude.data(), d_ifft_coarse->get_outbuf(), d_coarse_size);
+            volk_gnsssdr_32f_index_max_32u(&tmp_index, d_coarse_magnitude.data(), d_coarse_size);
+            d_coarse_bin_max[doppler_index] = d_coarse_magnitude[tmp_index];
+        }
+
+    // Shortlist the strongest candidates and their opposite bins
+    std::fill(selected_bins.begin(), selected_bins.end(), 0);
+    const uint32_t num_candidates = std::min(d_acq_parameters.coarse_candidates, d_num_doppler_bins);
+    for (uint32_t candidate = 0; candidate < num_candidates; candidate++)
+        {
+            volk_gnsssdr_32f_index_max_32u(&tmp_index, d_coarse_bin_max.data(), d_num_doppler_bins);
+            selected_bins[tmp_index] = 1;
+            selected_bins[(tmp_index + d_num_doppler_bins / 2) % d_num_doppler_bins] = 1;
+            d_coarse_bin_max[tmp_index] = 0.0;
+        }
+}
+
+
+bool pcps_acquisition::sparse_ifft_doppler_grid_search(const gr_complex* in, uint32_t& indext, int32_t& doppler)
+{
+    // Experimental strong-signal dwell: instead of the full inverse FFT per
+    // Doppler bin, the subsampled-IFFT engine locates the correlation peak on
+    // 1/D of the transform work. Aliasing folds D noise contributions on top
+    // of the peak, so a weak signal may be missed here that the dense loop
+    // would have caught: the caller repeats the search densely whenever the
+    // statistic returned by this dwell does not clear the threshold, making
+    // the sparse pass a shortcut that never degrades the detection outcome
+    float grid_maximum = 0.0F;
+    float noise_power_sum = 0.0F;
+    uint32_t index_doppler = 0U;
+    uint32_t index_time = 0U;
+    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+        {
+            // Remove Doppler and compute the product spectrum, exactly as the
+            // dense loop does; only the inverse transform differs
+            volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs[doppler_index].data(), d_fft_size);
+            d_fft_if->execute();
+            volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes.data(), d_fft_size);
+
+            float peak_power = 0.0F;
+            float noise_power = 0.0F;
+            const uint32_t peak_index = d_sparse_ifft_engine->locate_peak(d_ifft->get_inbuf(), peak_power, noise_power);
+            noise_power_sum += noise_power;
+            if (peak_power > grid_maximum)
+                {
+                    grid_maximum = peak_power;
+                    index_doppler = doppler_index;
+                    index_time = peak_index;
+                }
+        }
+
+    // Same scale as max_to_input_power_statistic: the input power is half the
+    // mean squared magnitude of the (never computed) dense grid, averaged
+    // here over all Doppler bins instead of taken from the opposite row
+    d_input_power = noise_power_sum / static_cast<float>(d_num_doppler_bins) / 2.0F;
+    if (d_input_power <= 0.0F)
+        {
+            return false;
+        }
+    d_mag = grid_maximum;
+    d_test_statistics = grid_maximum / d_input_power;
+    indext = index_time;
+    doppler = -static_cast<int32_t>(d_acq_parameters.doppler_max) + d_doppler_center + static_cast<int32_t>(d_doppler_step) * static_cast<int32_t>(index_doppler);
+    return d_test_statistics > d_threshold;
+}
+
+
+void pcps_acquisition::native_16ic_doppler_grid_search(int32_t effective_fft_size)
+{
+    // Native 16-bit path: the carrier wipeoff runs on the lv_16sc_t samples
+    // with the fixed-point rotator kernel (as cpu_multicorrelator_16sc does
+    // in tracking), so the snapshot is never expanded to gr_complex. The
+    // samples are widened to float only at the FFT boundary, one Doppler bin
+    // at a time, halving the memory bandwidth of the grid loop. There is no
+    // fixed-point FFT in this tree, so the transforms stay in float.
+    const double fs = (d_acq_parameters.use_automatic_resampler ? static_cast<double>(d_acq_parameters.resampled_fs) : static_cast<double>(d_acq_parameters.fs_in));
+    const size_t offset = (d_acq_parameters.bit_transition_flag ? effective_fft_size : 0);
+
+    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+        {
+            const int32_t doppler = -static_cast<int32_t>(d_acq_parameters.doppler_max) + d_doppler_center + d_doppler_step * doppler_index;
+            const float phase_step_rad = static_cast<float>(TWO_PI) * static_cast<float>(d_doppler_bias + doppler) / static_cast<float>(fs);
+            lv_32fc_t phase_offset = lv_cmake(1.0F, 0.0F);
+            const lv_32fc_t phase_inc = lv_cmake(std::cos(-phase_step_rad), std::sin(-phase_step_rad));
+
+            // Remove Doppler in fixed point, then widen into the FFT buffer
+            volk_gnsssdr_16ic_s32fc_x2_rotator_16ic(d_rotated_sc.data(), d_data_buffer_sc.data(), phase_inc, &phase_offset, d_consumed_samples);
+            volk_gnsssdr_16ic_convert_32fc(d_fft_if->get_inbuf(), d_rotated_sc.data(), d_consumed_samples);
+            if (d_fft_size > d_consumed_samples)
+                {
+                    std::fill_n(d_fft_if->get_inbuf() + d_consumed_samples, d_fft_size - d_consumed_samples, gr_complex(0.0, 0.0));
+                }
+
+            // Perform the FFT-based convolution (parallel time search)
+            d_fft_if->execute();
+            volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes.data(), d_fft_size);
+            d_ifft->execute();
+
+            if (d_num_noncoherent_integrations_counter == 1)
+                {
+                    volk_32fc_magnitude_squared_32f(d_magnitude_grid[doppler_index].data(), d_ifft->get_outbuf() + offset, effective_fft_size);
+                }
+            else
+                {
+                    volk_gnsssdr_32fc_magnitude_squared_accumulate_32f(d_magnitude_grid[doppler_index].data(), d_ifft->get_outbuf() + offset, effective_fft_size);
+                }
+            if (d_dump and d_channel == d_dump_channel)
+                {
+                    std::copy(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data() + effective_fft_size, d_grid.colptr(doppler_index));
+                }
+        }
+}
+
+
+void pcps_acquisition::batched_doppler_grid_search(const gr_complex* in, int32_t effective_fft_size)
+{
+    // Batched evaluation of the whole Doppler grid. The per-bin products are
+    // packed into one contiguous slab so that the carrier wipeoff and the
+    // frequency-domain code multiplication are each computed with a single
+    // volk call over num_doppler_bins * fft_size samples, leaving only the
+    // transforms and the per-row grid reduction as per-bin calls.
+    if (d_batch_codes_stale)
+        {
+            for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+                {
+                    std::copy(d_fft_codes.data(), d_fft_codes.data() + d_fft_size, d_batch_codes.data() + static_cast<size_t>(doppler_index) * d_fft_size);
+                }
+            d_batch_codes_stale = false;
+        }
+
+    // Remove Doppler: one multiply per bin into the contiguous slab
+    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+        {
+            volk_32fc_x2_multiply_32fc(d_batch_fwd_grid.data() + static_cast<size_t>(doppler_index) * d_fft_size, in, d_grid_doppler_wipeoffs[doppler_index].data(), d_fft_size);
+        }
+
+    // Forward transforms, reusing the single plan over contiguous slices
+    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+        {
+            gr_complex* slice = d_batch_fwd_grid.data() + static_cast<size_t>(doppler_index) * d_fft_size;
+            std::copy(slice, slice + d_fft_size, d_fft_if->get_inbuf());
+            d_fft_if->execute();
+            std::copy(d_fft_if->get_outbuf(), d_fft_if->get_outbuf() + d_fft_size, slice);
+        }
+
+    // Multiply the whole transformed grid with the tiled local code reference
+    volk_32fc_x2_multiply_32fc(d_batch_fwd_grid.data(), d_batch_fwd_grid.data(), d_batch_codes.data(), d_num_doppler_bins * d_fft_size);
+
+    // Inverse transforms back into the slab
+    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+        {
+            gr_complex* slice = d_batch_fwd_grid.data() + static_cast<size_t>(doppler_index) * d_fft_size;
+            std::copy(slice, slice + d_fft_size, d_ifft->get_inbuf());
+            d_ifft->execute();
+            std::copy(d_ifft->get_outbuf(), d_ifft->get_outbuf() + d_fft_size, slice);
+        }
+
+    // Per-row squared magnitude, fused with the noncoherent accumulation:
+    // each row is reduced into the grid while its slice of the slab is still
+    // cache-resident, instead of a second slab-wide magnitude pass followed
+    // by a slab-wide accumulation pass
+    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+        {
+            const gr_complex* slice = d_batch_fwd_grid.data() + static_cast<size_t>(doppler_index) * d_fft_size;
+            if (d_num_noncoherent_integrations_counter == 1)
+                {
+                    volk_32fc_magnitude_squared_32f(d_magnitude_grid[doppler_index].data(), slice, effective_fft_size);
+                }
+            else
+                {
+                    volk_gnsssdr_32fc_magnitude_squared_accumulate_32f(d_magnitude_grid[doppler_index].data(), slice, effective_fft_size);
+                }
+            if (d_dump and d_channel == d_dump_channel)
+                {
+                    std::copy(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data() + effective_fft_size, d_grid.colptr(doppler_index));
+                }
+        }
+}
+
+
+void pcps_acquisition::high_sensitivity_doppler_grid_search(const gr_complex* in, int32_t effective_fft_size, const std::vector<char>& selected_bins)
+{
+    // High-sensitivity dwell: the d_hs_blocks consecutive code periods of
+    // the snapshot are correlated separately and combined coherently under
+    // every data-bit sign hypothesis, and each grid cell keeps the best
+    // hypothesis. The d_hs_blocks forward/inverse transform pairs of a
+    // Doppler bin are computed once and shared by all 2^(d_hs_blocks-1)
+    // hypotheses: correlation is linear in the input, so a sign flip
+    // commutes with the transforms and the hypotheses are combined on the
+    // stored IFFT outputs with sign-folded additions only. Versus the
+    // noncoherent max_dwells accumulation of the same span this recovers
+    // the squaring loss (about 3 dB at low C/N0), at the cost of the
+    // combination passes. The pfa-derived thresholds assume the
+    // single-period statistic, so an explicit .threshold is recommended
+    const float fs = (d_acq_parameters.use_automatic_resampler ? static_cast<float>(d_acq_parameters.resampled_fs) : static_cast<float>(d_acq_parameters.fs_in));
+    const uint32_t num_hypotheses = 1U << (d_hs_blocks - 1U);
+
+    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+        {
+            if (!selected_bins.empty() && (selected_bins[doppler_index] == 0))
+                {
+                    // not shortlisted; make sure no stale data survives
+                    if (d_num_noncoherent_integrations_counter == 1)
+                        {
+                            std::fill(d_magnitude_grid[doppler_index].begin(), d_magnitude_grid[doppler_index].end(), 0.0);
+                        }
+                    continue;
+                }
+            const int32_t doppler = -static_cast<int32_t>(d_acq_parameters.doppler_max) + d_doppler_center + static_cast<int32_t>(d_doppler_step * doppler_index);
+
+            // Per-block circular correlations. The wipeoff vector restarts
+            // at phase zero on every block, so the missing inter-block
+            // carrier rotation is applied to each block correlation as a
+            // scalar, keeping the Doppler wipeoff continuous over the span
+            for (uint32_t block = 0; block < d_hs_blocks; block++)
+                {
+                    volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in + static_cast<size_t>(block) * d_fft_size, d_grid_doppler_wipeoffs[doppler_index].data(), d_fft_size);
+                    d_fft_if->execute();
+                    volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes.data(), d_fft_size);
+                    d_ifft->execute();
+                    const float block_phase = -static_cast<float>(TWO_PI) * static_cast<float>(d_doppler_bias + doppler) * static_cast<float>(block) * static_cast<float>(d_fft_size) / fs;
+                    const lv_32fc_t rotation = lv_cmake(std::cos(block_phase), std::sin(block_phase));
+                    volk_32fc_s32fc_multiply_32fc(d_hs_corr_blocks[block].data(), d_ifft->get_outbuf(), rotation, d_fft_size);
+                }
+
+            // Hypothesis combining on the stored block correlations: bit b-1
+            // of the hypothesis word is the sign of block b relative to
+            // block 0 (the global sign is irrelevant to the magnitude)
+            for (uint32_t hypothesis = 0; hypothesis < num_hypotheses; hypothesis++)
+                {
+                    std::copy(d_hs_corr_blocks[0].data(), d_hs_corr_blocks[0].data() + d_fft_size, d_hs_accum.data());
+                    auto* accum_f = reinterpret_cast<float*>(d_hs_accum.data());
+                    for (uint32_t block = 1; block < d_hs_blocks; block++)
+                        {
+                            const auto* block_f = reinterpret_cast<const float*>(d_hs_corr_blocks[block].data());
+                            if ((hypothesis >> (block - 1U)) & 1U)
+                                {
+                                    volk_32f_x2_subtract_32f(accum_f, accum_f, block_f, 2 * d_fft_size);
+                                }
+                            else
+                                {
+                                    volk_32f_x2_add_32f(accum_f, accum_f, block_f, 2 * d_fft_size);
+                                }
+                        }
+                    if (hypothesis == 0)
+                        {
+                            volk_32fc_magnitude_squared_32f(d_hs_hyp_mag.data(), d_hs_accum.data(), effective_fft_size);
+                        }
+                    else
+                        {
+                            volk_32fc_magnitude_squared_32f(d_tmp_buffer.data(), d_hs_accum.data(), effective_fft_size);
+                            volk_32f_x2_max_32f(d_hs_hyp_mag.data(), d_hs_hyp_mag.data(), d_tmp_buffer.data(), effective_fft_size);
+                        }
+                }
+
+            // noncoherent accumulation across dwells, as in the standard loop
+            if (d_num_noncoherent_integrations_counter == 1)
+                {
+                    std::copy(d_hs_hyp_mag.data(), d_hs_hyp_mag.data() + effective_fft_size, d_magnitude_grid[doppler_index].data());
+                }
+            else
+                {
+                    volk_32f_x2_add_32f(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data(), d_hs_hyp_mag.data(), effective_fft_size);
+                }
+            // Record results to file if required
+            if (d_dump and d_channel == d_dump_channel)
+                {
+                    std::copy(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data() + effective_fft_size, d_grid.colptr(doppler_index));
+                }
+        }
+}
+
+
 void pcps_acquisition::acquisition_core(uint64_t samp_count)
 {
     gr::thread::scoped_lock lk(d_setlock);
@@ -605,23 +1451,72 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
     int32_t doppler = 0;
     uint32_t indext = 0U;
     const int32_t effective_fft_size = (d_acq_parameters.bit_transition_flag ? d_fft_size / 2 : d_fft_size);
-    if (d_cshort)
+    const bool native_16ic = (d_cshort && d_acq_parameters.use_16ic_path && !d_step_two);
+    const gr_complex* in;
+    if (native_16ic)
         {
-            volk_gnsssdr_16ic_convert_32fc(d_data_buffer.data(), d_data_buffer_sc.data(), d_consumed_samples);
+            // The 16ic grid search reads d_data_buffer_sc directly; no float
+            // staging of the snapshot is needed
+            in = nullptr;
         }
-    std::copy(d_data_buffer.data(), d_data_buffer.data() + d_consumed_samples, d_input_signal.data());
-    if (d_fft_size > d_consumed_samples)
+    else if (d_zero_copy_input != nullptr)
         {
-            for (uint32_t i = d_consumed_samples; i < d_fft_size; i++)
+            // Zero-copy mode: operate directly on the scheduler buffer view,
+            // skipping the staging copy of d_consumed_samples complex floats
+            in = d_zero_copy_input;
+        }
+    else
+        {
+            if (d_cshort)
+                {
+                    volk_gnsssdr_16ic_convert_32fc(d_data_buffer.data(), d_data_buffer_sc.data(), d_consumed_samples);
+                }
+            std::copy(d_data_buffer.data(), d_data_buffer.data() + d_consumed_samples, d_input_signal.data());
+            if (d_fft_size > d_consumed_samples)
                 {
-                    d_input_signal[i] = gr_complex(0.0, 0.0);
+                    for (uint32_t i = d_consumed_samples; i < d_fft_size; i++)
+                        {
+                            d_input_signal[i] = gr_complex(0.0, 0.0);
+                        }
                 }
+            in = d_input_signal.data();  // Get the input samples pointer
         }
-    const gr_complex* in = d_input_signal.data();  // Get the input samples pointer
 
     d_mag = 0.0;
     d_num_noncoherent_integrations_counter++;
 
+    // Sparse reacquisition: when the Doppler center was assisted from the
+    // last known state of the satellite, restrict the dwell to the bins
+    // inside the propagated uncertainty around that center. The grid is
+    // already centered on the assisted Doppler, so the window is symmetric
+    // around the middle bin, and the uncertainty grows with the age of the
+    // assistance. Not applied to the native 16ic path, which stages no
+    // float snapshot for the serial grid loop
+    if (d_num_noncoherent_integrations_counter == 1)
+        {
+            d_sparse_num_bins = 0U;
+            if (d_acq_parameters.sparse_reacq && d_doppler_assisted && !d_step_two && !native_16ic)
+                {
+                    const double assist_age_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - d_doppler_assist_time).count();
+                    const double doppler_unc_hz = static_cast<double>(d_acq_parameters.sparse_reacq_doppler_unc_hz) +
+                                                  static_cast<double>(d_acq_parameters.sparse_reacq_unc_rate_hz_s) * assist_age_s;
+                    const auto half_bins = std::max(1U, static_cast<uint32_t>(std::ceil(doppler_unc_hz / static_cast<double>(d_doppler_step))));
+                    const uint32_t mid_bin = d_num_doppler_bins / 2;
+                    const uint32_t first_bin = (half_bins < mid_bin) ? (mid_bin - half_bins) : 0U;
+                    const uint32_t last_bin = std::min(mid_bin + half_bins, d_num_doppler_bins - 1);
+                    const uint32_t window_bins = last_bin - first_bin + 1;
+                    // only worth it if a clear majority of the grid is skipped
+                    // (the opposite rows are evaluated too, for the CFAR
+                    // input-power estimate, doubling the computed set)
+                    if (4 * window_bins < d_num_doppler_bins)
+                        {
+                            d_sparse_first_bin = first_bin;
+                            d_sparse_num_bins = window_bins;
+                        }
+                }
+        }
+    const bool sparse_active = (d_sparse_num_bins != 0U);
+
     DLOG(INFO) << "Channel: " << d_channel
                << " , doing acquisition of satellite: " << d_gnss_synchro->System << " " << d_gnss_synchro->PRN
                << " ,sample stamp: " << samp_count << ", threshold: "
@@ -635,39 +1530,26 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
         }
 
     // Doppler frequency grid loop
-    if (!d_step_two)
+    // A sparse window takes the serial path: with a few percent of the bins
+    // to evaluate, the batched/threaded structures no longer pay off, and
+    // the serial loop already supports per-bin shortlisting
+    if (!d_step_two && !sparse_active && (d_batch_fft || d_num_threads > 1 || d_use_shared_pool || d_acq_parameters.shared_input_fft || native_16ic))
         {
-            for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+            if (native_16ic)
                 {
-                    // Remove Doppler
-                    volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs[doppler_index].data(), d_fft_size);
-
-                    // Perform the FFT-based convolution  (parallel time search)
-                    // Compute the FFT of the carrier wiped--off incoming signal
-                    d_fft_if->execute();
-
-                    // Multiply carrier wiped--off, Fourier transformed incoming signal with the local FFT'd code reference
-                    volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes.data(), d_fft_size);
-
-                    // Compute the inverse FFT
-                    d_ifft->execute();
-
-                    // Compute squared magnitude (and accumulate in case of non-coherent integration)
-                    const size_t offset = (d_acq_parameters.bit_transition_flag ? effective_fft_size : 0);
-                    if (d_num_noncoherent_integrations_counter == 1)
-                        {
-                            volk_32fc_magnitude_squared_32f(d_magnitude_grid[doppler_index].data(), d_ifft->get_outbuf() + offset, effective_fft_size);
-                        }
-                    else
-                        {
-                            volk_32fc_magnitude_squared_32f(d_tmp_buffer.data(), d_ifft->get_outbuf() + offset, effective_fft_size);
-                            volk_32f_x2_add_32f(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data(), d_tmp_buffer.data(), effective_fft_size);
-                        }
-                    // Record results to file if required
-                    if (d_dump and d_channel == d_dump_channel)
-                        {
-                            std::copy(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data() + effective_fft_size, d_grid.colptr(doppler_index));
-                        }
+                    native_16ic_doppler_grid_search(effective_fft_size);
+                }
+            else if (d_acq_parameters.shared_input_fft)
+                {
+                    shared_fft_doppler_grid_search(in, effective_fft_size, samp_count);
+                }
+            else if (d_num_threads > 1 || d_use_shared_pool)
+                {
+                    threaded_doppler_grid_search(in, effective_fft_size);
+                }
+            else
+                {
+                    batched_doppler_grid_search(in, effective_fft_size);
                 }
 
             // Compute the test statistic
@@ -694,6 +1576,134 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
                     d_gnss_synchro->Acq_samplestamp_samples = samp_count;
                 }
         }
+    else if (!d_step_two)
+        {
+            // A sparse-IFFT dwell tries first when the engine is enabled; on a
+            // miss, the dense loop below repeats the search in full
+            bool sparse_fft_detected = false;
+            if ((d_sparse_ifft_engine != nullptr) && !sparse_active)
+                {
+                    sparse_fft_detected = sparse_ifft_doppler_grid_search(in, indext, doppler);
+                }
+            if (!sparse_fft_detected)
+                {
+                    std::vector<char> selected_bins;
+                    if (sparse_active)
+                        {
+                            // shortlist the uncertainty window plus the opposite rows
+                            // needed by the CFAR input-power estimate; this supersedes
+                            // the coarse pre-search, which would still sweep every bin
+                            selected_bins.assign(d_num_doppler_bins, 0);
+                            for (uint32_t k = 0; k < d_sparse_num_bins; k++)
+                                {
+                                    const uint32_t bin = d_sparse_first_bin + k;
+                                    selected_bins[bin] = 1;
+                                    selected_bins[(bin + d_num_doppler_bins / 2) % d_num_doppler_bins] = 1;
+                                }
+                        }
+                    else if (d_coarse_enabled)
+                        {
+                            selected_bins.resize(d_num_doppler_bins);
+                            coarse_doppler_prefilter(in, selected_bins);
+                        }
+                    if (d_hs_blocks > 1U)
+                        {
+                            // coherent multi-block dwell with data-bit sign hypotheses
+                            high_sensitivity_doppler_grid_search(in, effective_fft_size, selected_bins);
+                        }
+                    else
+                        {
+                            for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+                                {
+                                    if (!selected_bins.empty() && (selected_bins[doppler_index] == 0))
+                                        {
+                                            // not shortlisted by the pre-search; make sure no
+                                            // stale data from a previous attempt survives
+                                            if (d_num_noncoherent_integrations_counter == 1)
+                                                {
+                                                    if (d_grid_16_bits)
+                                                        {
+                                                            std::fill(d_magnitude_grid_16[doppler_index].begin(), d_magnitude_grid_16[doppler_index].end(), 0);
+                                                        }
+                                                    else
+                                                        {
+                                                            std::fill(d_magnitude_grid[doppler_index].begin(), d_magnitude_grid[doppler_index].end(), 0.0);
+                                                        }
+                                                }
+                                            continue;
+                                        }
+                                    // Remove Doppler
+                                    volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs[doppler_index].data(), d_fft_size);
+
+                                    // Perform the FFT-based convolution  (parallel time search)
+                                    // Compute the FFT of the carrier wiped--off incoming signal
+                                    d_fft_if->execute();
+
+                                    // Multiply carrier wiped--off, Fourier transformed incoming signal with the local FFT'd code reference
+                                    volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes.data(), d_fft_size);
+
+                                    // Compute the inverse FFT
+                                    d_ifft->execute();
+
+                                    // Compute squared magnitude (and accumulate in case of non-coherent integration)
+                                    const size_t offset = (d_acq_parameters.bit_transition_flag ? effective_fft_size : 0);
+                                    if (d_grid_16_bits)
+                                        {
+                                            volk_32fc_magnitude_squared_32f(d_tmp_buffer.data(), d_ifft->get_outbuf() + offset, effective_fft_size);
+                                            if (d_num_noncoherent_integrations_counter == 1)
+                                                {
+                                                    volk_gnsssdr_32f_convert_16u(d_magnitude_grid_16[doppler_index].data(), d_tmp_buffer.data(), effective_fft_size);
+                                                }
+                                            else
+                                                {
+                                                    volk_gnsssdr_16u_32f_accumulate_16u(d_magnitude_grid_16[doppler_index].data(), d_magnitude_grid_16[doppler_index].data(), d_tmp_buffer.data(), effective_fft_size);
+                                                }
+                                        }
+                                    else if (d_num_noncoherent_integrations_counter == 1)
+                                        {
+                                            volk_32fc_magnitude_squared_32f(d_magnitude_grid[doppler_index].data(), d_ifft->get_outbuf() + offset, effective_fft_size);
+                                        }
+                                    else
+                                        {
+                                            // fused squared magnitude + accumulation: one pass
+                                            // over the cache-hot IFFT output, one
+                                            // read-modify-write of the grid row
+                                            volk_gnsssdr_32fc_magnitude_squared_accumulate_32f(d_magnitude_grid[doppler_index].data(), d_ifft->get_outbuf() + offset, effective_fft_size);
+                                        }
+                                    // Record results to file if required
+                                    if (d_dump and d_channel == d_dump_channel)
+                                        {
+                                            const float* row = magnitude_row(doppler_index, effective_fft_size);
+                                            std::copy(row, row + effective_fft_size, d_grid.colptr(doppler_index));
+                                        }
+                                }
+                        }
+
+                    // Compute the test statistic
+                    if (d_use_CFAR_algorithm_flag)
+                        {
+                            d_test_statistics = max_to_input_power_statistic(indext, doppler, d_num_doppler_bins, d_acq_parameters.doppler_max, d_doppler_step);
+                        }
+                    else
+                        {
+                            d_test_statistics = first_vs_second_peak_statistic(indext, doppler, d_num_doppler_bins, d_acq_parameters.doppler_max, d_doppler_step);
+                        }
+                }
+            if (d_acq_parameters.use_automatic_resampler)
+                {
+                    // take into account the acquisition resampler ratio
+                    d_gnss_synchro->Acq_delay_samples = static_cast<double>(std::fmod(static_cast<float>(indext), d_acq_parameters.samples_per_code)) * d_acq_parameters.resampler_ratio;
+                    d_gnss_synchro->Acq_delay_samples -= static_cast<double>(d_acq_parameters.resampler_latency_samples);  // account the resampler filter latency
+                    d_gnss_synchro->Acq_doppler_hz = static_cast<double>(doppler);
+                    d_gnss_synchro->Acq_samplestamp_samples = rint(static_cast<double>(samp_count) * d_acq_parameters.resampler_ratio);
+                }
+            else
+                {
+                    d_gnss_synchro->Acq_delay_samples = static_cast<double>(std::fmod(static_cast<float>(indext), d_acq_parameters.samples_per_code));
+                    d_gnss_synchro->Acq_doppler_hz = static_cast<double>(doppler);
+                    d_gnss_synchro->Acq_samplestamp_samples = samp_count;
+                }
+        }
     else
         {
             for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins_step2; doppler_index++)
@@ -712,19 +1722,34 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
                     d_ifft->execute();
 
                     const size_t offset = (d_acq_parameters.bit_transition_flag ? effective_fft_size : 0);
-                    if (d_num_noncoherent_integrations_counter == 1)
+                    if (d_grid_16_bits)
+                        {
+                            volk_32fc_magnitude_squared_32f(d_tmp_buffer.data(), d_ifft->get_outbuf() + offset, effective_fft_size);
+                            if (d_num_noncoherent_integrations_counter == 1)
+                                {
+                                    volk_gnsssdr_32f_convert_16u(d_magnitude_grid_16[doppler_index].data(), d_tmp_buffer.data(), effective_fft_size);
+                                }
+                            else
+                                {
+                                    volk_gnsssdr_16u_32f_accumulate_16u(d_magnitude_grid_16[doppler_index].data(), d_magnitude_grid_16[doppler_index].data(), d_tmp_buffer.data(), effective_fft_size);
+                                }
+                        }
+                    else if (d_num_noncoherent_integrations_counter == 1)
                         {
                             volk_32fc_magnitude_squared_32f(d_magnitude_grid[doppler_index].data(), d_ifft->get_outbuf() + offset, effective_fft_size);
                         }
                     else
                         {
-                            volk_32fc_magnitude_squared_32f(d_tmp_buffer.data(), d_ifft->get_outbuf() + offset, effective_fft_size);
-                            volk_32f_x2_add_32f(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data(), d_tmp_buffer.data(), effective_fft_size);
+                            // fused squared magnitude + accumulation: one pass
+                            // over the cache-hot IFFT output, one
+                            // read-modify-write of the grid row
+                            volk_gnsssdr_32fc_magnitude_squared_accumulate_32f(d_magnitude_grid[doppler_index].data(), d_ifft->get_outbuf() + offset, effective_fft_size);
                         }
                     // Record results to file if required
                     if (d_dump and d_channel == d_dump_channel)
                         {
-                            std::copy(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data() + effective_fft_size, d_narrow_grid.colptr(doppler_index));
+                            const float* row = magnitude_row(doppler_index, effective_fft_size);
+                            std::copy(row, row + effective_fft_size, d_narrow_grid.colptr(doppler_index));
                         }
                 }
             // Compute the test statistic
@@ -762,7 +1787,13 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
 
     if (!d_acq_parameters.bit_transition_flag)
         {
-            if (d_test_statistics > d_threshold)
+            float accept_threshold = d_threshold;
+            if (d_adaptive_dwells && d_num_noncoherent_integrations_counter < d_acq_parameters.max_dwells)
+                {
+                    calculate_dwell_thresholds();
+                    accept_threshold = d_early_accept_threshold;
+                }
+            if (d_test_statistics > accept_threshold)
                 {
                     d_active = false;
                     if (d_acq_parameters.make_2_steps)
@@ -794,6 +1825,14 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
                 {
                     d_buffer_count = 0;
                     d_state = 1;
+                    if (d_adaptive_dwells && d_num_noncoherent_integrations_counter >= 2U &&
+                        d_num_noncoherent_integrations_counter < d_acq_parameters.max_dwells &&
+                        d_early_reject_threshold > 0.0 && d_test_statistics < d_early_reject_threshold)
+                        {
+                            // hopeless search: skip the remaining dwells and
+                            // let the branch below declare the negative
+                            d_num_noncoherent_integrations_counter = d_acq_parameters.max_dwells;
+                        }
                 }
 
             if (d_num_noncoherent_integrations_counter == d_acq_parameters.max_dwells)
@@ -860,7 +1899,14 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
             // Record results to file if required
             if (d_dump and d_channel == d_dump_channel)
                 {
-                    pcps_acquisition::dump_results(effective_fft_size);
+                    if (d_acq_parameters.dump_compact)
+                        {
+                            pcps_acquisition::dump_results_compact(effective_fft_size);
+                        }
+                    else
+                        {
+                            pcps_acquisition::dump_results(effective_fft_size);
+                        }
                 }
             d_num_noncoherent_integrations_counter = 0U;
             d_positive_acq = 0;
@@ -895,6 +1941,37 @@ void pcps_acquisition::calculate_threshold()
 }
 
 
+void pcps_acquisition::calculate_dwell_thresholds()
+{
+    // Sequential-detection thresholds matched to the number of dwells
+    // accumulated so far. The early-accept threshold spends pfa/max_dwells
+    // per dwell, so the overall false alarm budget is preserved and a
+    // satellite accepted early would also have been accepted at max_dwells.
+    // The early-reject threshold is the median of the noise-only grid
+    // maximum: a peak still below it after two or more dwells is
+    // indistinguishable from noise and the remaining dwells are skipped
+    const float pfa = (d_step_two ? d_acq_parameters.pfa2 : d_acq_parameters.pfa);
+
+    if (pfa <= 0.0)
+        {
+            // threshold set manually in the configuration: no pfa to derive
+            // per-dwell thresholds from, fall back to single-shot decisions
+            d_early_accept_threshold = d_threshold;
+            d_early_reject_threshold = 0.0;
+            return;
+        }
+
+    const auto effective_fft_size = static_cast<int>(d_fft_size);
+    const int num_doppler_bins = (d_step_two ? d_num_doppler_bins_step2 : d_num_doppler_bins);
+
+    const int num_bins = effective_fft_size * num_doppler_bins;
+    const double dof = 2.0 * static_cast<double>(d_num_noncoherent_integrations_counter);
+
+    d_early_accept_threshold = static_cast<float>(2.0 * boost::math::gamma_p_inv(dof, std::pow(1.0 - pfa / static_cast<float>(d_acq_parameters.max_dwells), 1.0 / static_cast<float>(num_bins))));
+    d_early_reject_threshold = static_cast<float>(2.0 * boost::math::gamma_p_inv(dof, std::pow(0.5, 1.0 / static_cast<float>(num_bins))));
+}
+
+
 int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
     gr_vector_int& ninput_items,
     gr_vector_const_void_star& input_items,
@@ -949,6 +2026,23 @@ int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
             }
         case 1:
             {
+                // Zero-copy fast path: when a whole snapshot is already
+                // available in this work call, run the core directly on the
+                // scheduler buffer (blocking mode only, since the buffer view
+                // is reclaimed as soon as the samples are consumed)
+                if (d_acq_parameters.zero_copy && d_acq_parameters.blocking && !d_cshort &&
+                    (d_buffer_count == 0U) && (d_fft_size == d_consumed_samples) &&
+                    (static_cast<uint32_t>(ninput_items[0]) >= d_consumed_samples))
+                    {
+                        const auto* in = reinterpret_cast<const gr_complex*>(input_items[0]);
+                        d_sample_counter += static_cast<uint64_t>(d_consumed_samples);
+                        d_zero_copy_input = in;
+                        lk.unlock();
+                        acquisition_core(d_sample_counter);
+                        d_zero_copy_input = nullptr;
+                        consume_each(d_consumed_samples);
+                        break;
+                    }
                 uint32_t buff_increment;
                 if (d_cshort)
                     {
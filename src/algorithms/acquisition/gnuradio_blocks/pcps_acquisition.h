@@ -45,6 +45,7 @@
 #include "acq_conf.h"
 #include "channel_fsm.h"
 #include "gnss_sdr_fft.h"
+#include "sparse_ifft_engine.h"
 #include <armadillo>
 #include <glog/logging.h>
 #include <gnuradio/block.h>
@@ -56,17 +57,11 @@
 #include <complex>
 #include <cstdint>
 #include <memory>
+#include <chrono>
 #include <queue>
 #include <string>
 #include <utility>
-
-#if HAS_STD_SPAN
-#include <span>
-namespace own = std;
-#else
-#include <gsl/gsl-lite.hpp>
-namespace own = gsl;
-#endif
+#include <vector>
 
 /** \addtogroup Acquisition
  * Classes for GNSS signal acquisition
@@ -92,7 +87,7 @@ pcps_acquisition_sptr pcps_make_acquisition(const Acq_Conf& conf_);
 class pcps_acquisition : public gr::block
 {
 public:
-    ~pcps_acquisition() override = default;
+    ~pcps_acquisition() override;
 
     /*!
      * \brief Initializes acquisition algorithm and reserves memory.
@@ -142,6 +137,19 @@ public:
     {
         gr::thread::scoped_lock lock(d_setlock);  // require mutex with work function called by the scheduler
         d_active = active;
+        if (d_use_grid_pool)
+            {
+                // the channel leases the large grid buffers only while it is
+                // searching, so idle channels do not pin them
+                if (active)
+                    {
+                        lease_grid_buffers();
+                    }
+                else
+                    {
+                        release_grid_buffers();
+                    }
+            }
     }
 
     /*!
@@ -205,6 +213,11 @@ public:
                 d_doppler_center = doppler_center;
                 update_grid_doppler_wipeoffs();
             }
+        // a zero center means no assistance is available (cold start); a
+        // non-zero one timestamps the prediction so the sparse reacquisition
+        // window can propagate its uncertainty with the assistance age
+        d_doppler_assisted = (doppler_center != 0);
+        d_doppler_assist_time = std::chrono::steady_clock::now();
     }
 
     /*!
@@ -218,44 +231,80 @@ private:
     friend pcps_acquisition_sptr pcps_make_acquisition(const Acq_Conf& conf_);
     explicit pcps_acquisition(const Acq_Conf& conf_);
 
-    void update_local_carrier(own::span<gr_complex> carrier_vector, float freq) const;
+    void batched_doppler_grid_search(const gr_complex* in, int32_t effective_fft_size);
+    void threaded_doppler_grid_search(const gr_complex* in, int32_t effective_fft_size);
+    void shared_fft_doppler_grid_search(const gr_complex* in, int32_t effective_fft_size, uint64_t samp_count);
+    void native_16ic_doppler_grid_search(int32_t effective_fft_size);
+    void coarse_doppler_prefilter(const gr_complex* in, std::vector<char>& selected_bins);
+    bool sparse_ifft_doppler_grid_search(const gr_complex* in, uint32_t& indext, int32_t& doppler);
+    void high_sensitivity_doppler_grid_search(const gr_complex* in, int32_t effective_fft_size, const std::vector<char>& selected_bins);
+    void doppler_grid_worker(const gr_complex* in, int32_t effective_fft_size, uint32_t first_bin, uint32_t last_bin, uint32_t worker_index);
     void update_grid_doppler_wipeoffs();
     void update_grid_doppler_wipeoffs_step2();
+    void lease_grid_buffers();
+    void release_grid_buffers();
     void acquisition_core(uint64_t samp_count);
     void send_negative_acquisition();
     void send_positive_acquisition();
     void dump_results(int32_t effective_fft_size);
+    void dump_results_compact(int32_t effective_fft_size);
     bool is_fdma();
     bool start() override;
     void calculate_threshold(void);
+    void calculate_dwell_thresholds(void);
     float first_vs_second_peak_statistic(uint32_t& indext, int32_t& doppler, uint32_t num_doppler_bins, int32_t doppler_max, int32_t doppler_step);
     float max_to_input_power_statistic(uint32_t& indext, int32_t& doppler, uint32_t num_doppler_bins, int32_t doppler_max, int32_t doppler_step);
+    const float* magnitude_row(uint32_t doppler_index, int32_t num_samples);
 
-    volk_gnsssdr::vector<volk_gnsssdr::vector<float>> d_magnitude_grid;
+    // the two largest grids are backed by huge pages to reduce TLB pressure
+    // when many channels acquire in parallel
+    volk_gnsssdr::vector<volk_gnsssdr::hugepage_vector<float>> d_magnitude_grid;
+    volk_gnsssdr::vector<volk_gnsssdr::vector<uint16_t>> d_magnitude_grid_16;
     volk_gnsssdr::vector<float> d_tmp_buffer;
     volk_gnsssdr::vector<std::complex<float>> d_input_signal;
-    volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> d_grid_doppler_wipeoffs;
+    volk_gnsssdr::vector<volk_gnsssdr::hugepage_vector<std::complex<float>>> d_grid_doppler_wipeoffs;
     volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> d_grid_doppler_wipeoffs_step_two;
     volk_gnsssdr::vector<std::complex<float>> d_fft_codes;
+    volk_gnsssdr::vector<std::complex<float>> d_batch_fwd_grid;
+    volk_gnsssdr::vector<std::complex<float>> d_batch_codes;
     volk_gnsssdr::vector<std::complex<float>> d_data_buffer;
     volk_gnsssdr::vector<lv_16sc_t> d_data_buffer_sc;
+    volk_gnsssdr::vector<lv_16sc_t> d_rotated_sc;
 
     std::unique_ptr<gnss_fft_complex_fwd> d_fft_if;
     std::unique_ptr<gnss_fft_complex_rev> d_ifft;
+    std::unique_ptr<gnss_fft_complex_fwd> d_fft_coarse;
+    std::unique_ptr<gnss_fft_complex_rev> d_ifft_coarse;
+    std::unique_ptr<Sparse_Ifft_Engine> d_sparse_ifft_engine;
+    volk_gnsssdr::vector<std::complex<float>> d_fft_codes_coarse;
+    volk_gnsssdr::vector<std::complex<float>> d_coarse_input;
+    volk_gnsssdr::vector<std::complex<float>> d_coarse_wipeoff;
+    volk_gnsssdr::vector<float> d_coarse_magnitude;
+    volk_gnsssdr::vector<float> d_coarse_bin_max;
+    std::vector<std::unique_ptr<gnss_fft_complex_fwd>> d_fft_if_pool;
+    std::vector<std::unique_ptr<gnss_fft_complex_rev>> d_ifft_pool;
+    std::vector<volk_gnsssdr::vector<float>> d_tmp_buffer_pool;
+    volk_gnsssdr::vector<volk_gnsssdr::hugepage_vector<std::complex<float>>> d_hs_corr_blocks;
+    volk_gnsssdr::vector<std::complex<float>> d_hs_accum;
+    volk_gnsssdr::vector<float> d_hs_hyp_mag;
     std::weak_ptr<ChannelFsm> d_channel_fsm;
 
     Acq_Conf d_acq_parameters;
     Gnss_Synchro* d_gnss_synchro;
+    const gr_complex* d_zero_copy_input;
     arma::fmat d_grid;
     arma::fmat d_narrow_grid;
 
     std::queue<Gnss_Synchro> d_monitor_queue;
     std::string d_dump_filename;
+    std::chrono::steady_clock::time_point d_doppler_assist_time;
 
     int64_t d_dump_number;
     uint64_t d_sample_counter;
 
     float d_threshold;
+    float d_early_accept_threshold;
+    float d_early_reject_threshold;
     float d_mag;
     float d_input_power;
     float d_test_statistics;
@@ -263,6 +312,7 @@ private:
 
     int32_t d_state;
     int32_t d_positive_acq;
+    int32_t d_dump_stream_id;  // handle into the shared Async_Dump_Writer (compact dump mode)
     int32_t d_doppler_center;
     int32_t d_doppler_bias;
     uint32_t d_channel;
@@ -275,12 +325,25 @@ private:
     uint32_t d_num_doppler_bins_step2;
     uint32_t d_dump_channel;
     uint32_t d_buffer_count;
+    uint32_t d_num_threads;
+    uint32_t d_coarse_size;
+    uint32_t d_hs_blocks;  // 1: high-sensitivity coherent accumulation inactive
+    uint32_t d_sparse_first_bin;
+    uint32_t d_sparse_num_bins;  // 0: sparse window inactive, scan the full grid
 
     bool d_active;
+    bool d_batch_fft;
+    bool d_grid_16_bits;
+    bool d_batch_codes_stale;
+    bool d_coarse_enabled;
     bool d_worker_active;
     bool d_cshort;
     bool d_step_two;
     bool d_use_CFAR_algorithm_flag;
+    bool d_use_shared_pool;
+    bool d_use_grid_pool;
+    bool d_adaptive_dwells;
+    bool d_doppler_assisted;
     bool d_dump;
 };
 
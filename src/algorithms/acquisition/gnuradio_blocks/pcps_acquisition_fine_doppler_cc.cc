@@ -25,7 +25,8 @@
 #include <gnuradio/io_signature.h>
 #include <matio.h>
 #include <volk/volk.h>
-#include <algorithm>  // std::rotate, std::fill_n
+#include <algorithm>  // std::rotate, std::fill_n, std::min
+#include <cmath>      // std::ceil, std::round
 #include <array>
 #include <sstream>
 #include <vector>
@@ -62,6 +63,7 @@ pcps_acquisition_fine_doppler_cc::pcps_acquisition_fine_doppler_cc(const Acq_Con
       d_gnuradio_forecast_samples(d_fft_size),
       d_doppler_step(0),
       d_channel(0),
+      d_code_replica_prn(0),
       d_dump_channel(0),
       d_active(false),
       d_dump(conf_.dump)
@@ -346,72 +348,96 @@ int pcps_acquisition_fine_doppler_cc::compute_and_accumulate_grid(gr_vector_cons
 int pcps_acquisition_fine_doppler_cc::estimate_Doppler()
 {
     // Direct FFT
-    int zero_padding_factor = 8;
-    int prn_replicas = 10;
-    int signal_samples = prn_replicas * d_fft_size;
+    const int zero_padding_factor = 8;
+    const int prn_replicas = 10;
+    const int signal_samples = prn_replicas * d_fft_size;
     // int fft_size_extended = nextPowerOf2(signal_samples * zero_padding_factor);
-    int fft_size_extended = signal_samples * zero_padding_factor;
+    const int fft_size_extended = signal_samples * zero_padding_factor;
 
-    auto fft_operator = gnss_fft_fwd_make_unique(fft_size_extended);
-
-    // zero padding the entire vector
-    std::fill_n(fft_operator->get_inbuf(), fft_size_extended, gr_complex(0.0, 0.0));
-
-    // 1. generate local code aligned with the acquisition code phase estimation
-    volk_gnsssdr::vector<gr_complex> code_replica(signal_samples);
+    // The extended FFT plan and scratch vectors are kept across refinement
+    // calls: planning a transform of this length is far more expensive than
+    // executing it
+    if (!d_fft_operator_extended)
+        {
+            d_fft_operator_extended = gnss_fft_fwd_make_unique(fft_size_extended);
+            std::fill_n(d_fft_operator_extended->get_inbuf(), fft_size_extended, gr_complex(0.0, 0.0));
+            d_code_replica_base = volk_gnsssdr::vector<gr_complex>(d_fft_size);
+            d_code_replica_rotated = volk_gnsssdr::vector<gr_complex>(signal_samples);
+            d_magnitude_extended = volk_gnsssdr::vector<float>(fft_size_extended);
+        }
 
-    gps_l1_ca_code_gen_complex_sampled(code_replica, d_gnss_synchro->PRN, d_fs_in, 0);
+    // 1. generate local code aligned with the acquisition code phase estimation.
+    // The unrotated one-period replica only depends on the PRN, so it is
+    // regenerated just when the searched satellite changes
+    if (d_code_replica_prn != d_gnss_synchro->PRN)
+        {
+            gps_l1_ca_code_gen_complex_sampled(d_code_replica_base, d_gnss_synchro->PRN, d_fs_in, 0);
+            d_code_replica_prn = d_gnss_synchro->PRN;
+        }
 
-    int shift_index = static_cast<int>(d_gnss_synchro->Acq_delay_samples);
+    const int shift_index = static_cast<int>(d_gnss_synchro->Acq_delay_samples);
 
     // Rotate to align the local code replica using acquisition time delay estimation
+    std::copy_n(d_code_replica_base.data(), d_fft_size, d_code_replica_rotated.data());
     if (shift_index != 0)
         {
-            std::rotate(code_replica.data(), code_replica.data() + (d_fft_size - shift_index), code_replica.data() + d_fft_size - 1);
+            std::rotate(d_code_replica_rotated.data(), d_code_replica_rotated.data() + (d_fft_size - shift_index), d_code_replica_rotated.data() + d_fft_size - 1);
         }
 
     for (int n = 0; n < prn_replicas - 1; n++)
         {
-            std::copy_n(code_replica.data(), d_fft_size, &code_replica[(n + 1) * d_fft_size]);
+            std::copy_n(d_code_replica_rotated.data(), d_fft_size, &d_code_replica_rotated[(n + 1) * d_fft_size]);
         }
-    // 2. Perform code wipe-off
-    volk_32fc_x2_multiply_32fc(fft_operator->get_inbuf(), d_10_ms_buffer.data(), code_replica.data(), signal_samples);
+    // 2. Perform code wipe-off (the zero padding beyond signal_samples
+    // persists in the cached input buffer)
+    volk_32fc_x2_multiply_32fc(d_fft_operator_extended->get_inbuf(), d_10_ms_buffer.data(), d_code_replica_rotated.data(), signal_samples);
 
     // 3. Perform the FFT (zero padded!)
-    fft_operator->execute();
-
-    // 4. Compute the magnitude and find the maximum
-    volk_gnsssdr::vector<float> p_tmp_vector(fft_size_extended);
-    volk_32fc_magnitude_squared_32f(p_tmp_vector.data(), fft_operator->get_outbuf(), fft_size_extended);
-
-    uint32_t tmp_index_freq = 0;
-    volk_gnsssdr_32f_index_max_32u(&tmp_index_freq, p_tmp_vector.data(), fft_size_extended);
-
-    // case even
-    int counter = 0;
-    volk_gnsssdr::vector<float> fftFreqBins(fft_size_extended);
-
-    for (int k = 0; k < (fft_size_extended / 2); k++)
+    d_fft_operator_extended->execute();
+
+    // 4. Compute the magnitude and find the maximum, restricted to the
+    // +/- 1 kHz neighborhood of the coarse Doppler estimation (estimates
+    // outside it are rejected below anyway), which avoids evaluating the
+    // magnitude of the whole zero-padded spectrum
+    const double bin_width = static_cast<double>(d_fs_in) / static_cast<double>(fft_size_extended);
+    const auto window_bins = static_cast<int>(std::ceil(1000.0 / bin_width));
+    const auto center_bin = static_cast<int>(std::round(d_gnss_synchro->Acq_doppler_hz / bin_width));
+
+    uint32_t tmp_index = 0;
+    uint32_t index_freq = 0;
+    float max_magnitude = 0.0;
+    const gr_complex *spectrum = d_fft_operator_extended->get_outbuf();
+
+    int first_bin = center_bin - window_bins;
+    const int num_window_bins = 2 * window_bins + 1;
+    // process the (possibly wrapped) window as up to two contiguous segments
+    int processed_bins = 0;
+    while (processed_bins < num_window_bins)
         {
-            fftFreqBins[counter] = ((static_cast<float>(d_fs_in) / 2.0) * static_cast<float>(k)) / (static_cast<float>(fft_size_extended) / 2.0);
-            counter++;
-        }
-
-    for (int k = fft_size_extended / 2; k > 0; k--)
-        {
-            fftFreqBins[counter] = ((-static_cast<float>(d_fs_in) / 2.0) * static_cast<float>(k)) / (static_cast<float>(fft_size_extended) / 2.0);
-            counter++;
+            const int start = ((first_bin + processed_bins) % fft_size_extended + fft_size_extended) % fft_size_extended;
+            const int segment_length = std::min(num_window_bins - processed_bins, fft_size_extended - start);
+            volk_32fc_magnitude_squared_32f(d_magnitude_extended.data(), spectrum + start, segment_length);
+            volk_gnsssdr_32f_index_max_32u(&tmp_index, d_magnitude_extended.data(), segment_length);
+            if (d_magnitude_extended[tmp_index] > max_magnitude)
+                {
+                    max_magnitude = d_magnitude_extended[tmp_index];
+                    index_freq = static_cast<uint32_t>(start) + tmp_index;
+                }
+            processed_bins += segment_length;
         }
 
     // 5. Update the Doppler estimation in Hz
-    if (std::abs(fftFreqBins[tmp_index_freq] - d_gnss_synchro->Acq_doppler_hz) < 1000)
+    const float estimated_doppler = (index_freq < static_cast<uint32_t>(fft_size_extended / 2))
+                                        ? static_cast<float>(bin_width * static_cast<double>(index_freq))
+                                        : -static_cast<float>(bin_width * static_cast<double>(fft_size_extended - static_cast<int>(index_freq)));
+    if (std::abs(estimated_doppler - d_gnss_synchro->Acq_doppler_hz) < 1000)
         {
-            d_gnss_synchro->Acq_doppler_hz = static_cast<double>(fftFreqBins[tmp_index_freq]);
-            // std::cout << "FFT maximum present at " << fftFreqBins[tmp_index_freq] << " [Hz]\n";
+            d_gnss_synchro->Acq_doppler_hz = static_cast<double>(estimated_doppler);
+            // std::cout << "FFT maximum present at " << estimated_doppler << " [Hz]\n";
         }
     else
         {
-            DLOG(INFO) << "Abs(Grid Doppler - FFT Doppler)=" << std::abs(fftFreqBins[tmp_index_freq] - d_gnss_synchro->Acq_doppler_hz);
+            DLOG(INFO) << "Abs(Grid Doppler - FFT Doppler)=" << std::abs(estimated_doppler - d_gnss_synchro->Acq_doppler_hz);
             DLOG(INFO) << "Error estimating fine frequency Doppler";
         }
 
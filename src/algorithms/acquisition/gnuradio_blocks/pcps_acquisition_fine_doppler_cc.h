@@ -199,12 +199,16 @@ private:
     std::weak_ptr<ChannelFsm> d_channel_fsm;
     std::unique_ptr<gnss_fft_complex_fwd> d_fft_if;
     std::unique_ptr<gnss_fft_complex_rev> d_ifft;
+    std::unique_ptr<gnss_fft_complex_fwd> d_fft_operator_extended;
 
     volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> d_grid_doppler_wipeoffs;
     volk_gnsssdr::vector<volk_gnsssdr::vector<float>> d_grid_data;
     volk_gnsssdr::vector<gr_complex> d_fft_codes;
     volk_gnsssdr::vector<gr_complex> d_10_ms_buffer;
     volk_gnsssdr::vector<float> d_magnitude;
+    volk_gnsssdr::vector<gr_complex> d_code_replica_base;
+    volk_gnsssdr::vector<gr_complex> d_code_replica_rotated;
+    volk_gnsssdr::vector<float> d_magnitude_extended;
 
     arma::fmat grid_;
 
@@ -234,6 +238,7 @@ private:
     int d_gnuradio_forecast_samples;
     unsigned int d_doppler_step;
     unsigned int d_channel;
+    unsigned int d_code_replica_prn;
     unsigned int d_dump_channel;
 
     bool d_active;
@@ -19,11 +19,14 @@
 
 
 #include "pcps_acquisition_fpga.h"
+#include "fpga_buffer_monitor.h"   // for Fpga_buffer_monitor::buffer_near_full
 #include "gnss_sdr_make_unique.h"  // for std::make_unique in C++11
 #include "gnss_synchro.h"
 #include <glog/logging.h>
+#include <chrono>    // for std::chrono::milliseconds
 #include <cmath>     // for ceil
 #include <iostream>  // for operator<<
+#include <thread>    // for std::this_thread::sleep_for
 #include <utility>   // for move
 
 
@@ -153,6 +156,27 @@ void pcps_acquisition_fpga::send_negative_acquisition()
 }
 
 
+void pcps_acquisition_fpga::wait_for_fpga_buffer() const
+{
+    // defer the grid sweep while the FPGA DMA buffer occupancy is above the
+    // watermark configured in the signal source, so bursts of acquisition
+    // work do not overflow the receiver buffer. The wait is bounded to keep
+    // the channel FSM responsive if the buffer never drains
+    uint32_t deferred_ms = 0;
+    while (Fpga_buffer_monitor::buffer_near_full() && (deferred_ms < max_backpressure_wait_ms))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            deferred_ms++;
+        }
+    if (deferred_ms > 0)
+        {
+            DLOG(INFO) << "Channel " << d_channel
+                       << ": acquisition deferred " << deferred_ms
+                       << " ms by FPGA buffer backpressure";
+        }
+}
+
+
 void pcps_acquisition_fpga::acquisition_core(uint32_t num_doppler_bins, uint32_t doppler_step, int32_t doppler_min)
 {
     uint32_t indext = 0U;
@@ -161,6 +185,8 @@ void pcps_acquisition_fpga::acquisition_core(uint32_t num_doppler_bins, uint32_t
     uint32_t total_block_exp;
     uint64_t initial_sample;
 
+    wait_for_fpga_buffer();
+
     d_acquisition_fpga->set_doppler_sweep(num_doppler_bins, doppler_step, doppler_min);
     d_acquisition_fpga->run_acquisition();
     d_acquisition_fpga->read_acquisition_results(&indext,
@@ -178,8 +178,12 @@ private:
     friend pcps_acquisition_fpga_sptr pcps_make_acquisition_fpga(Acq_Conf_Fpga& conf_);
     explicit pcps_acquisition_fpga(Acq_Conf_Fpga& conf_);
 
+    // bound on the time a grid sweep may be deferred by FPGA buffer backpressure
+    static const uint32_t max_backpressure_wait_ms = 500;
+
     void send_negative_acquisition();
     void send_positive_acquisition();
+    void wait_for_fpga_buffer() const;
     void acquisition_core(uint32_t num_doppler_bins, uint32_t doppler_step, int32_t doppler_min);
     float first_vs_second_peak_statistic(uint32_t& indext, int32_t& doppler, uint32_t num_doppler_bins, int32_t doppler_max, int32_t doppler_step);
 
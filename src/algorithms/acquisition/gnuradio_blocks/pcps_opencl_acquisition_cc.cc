@@ -275,6 +275,10 @@ void pcps_opencl_acquisition_cc::init()
     if (d_opencl == 0)
         {
             d_cl_buffer_grid_doppler_wipeoffs = new cl::Buffer *[d_num_doppler_bins];
+            // Host-side magnitude grid: one row per Doppler bin, filled by
+            // non-blocking readbacks so the whole grid is reduced after a
+            // single queue synchronization
+            d_magnitude_grid_cl = std::vector<std::vector<float>>(d_num_doppler_bins, std::vector<float>(d_fft_size));
         }
 
     for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
@@ -498,20 +502,21 @@ void pcps_opencl_acquisition_cc::acquisition_core_opencl()
     volk_32f_accumulator_s32f(&d_input_power, d_magnitude.data(), d_fft_size);
     d_input_power /= static_cast<float>(d_fft_size);
 
-    cl::Kernel kernel;
+    // Create the kernel objects once; only their arguments change per bin
+    cl::Kernel kernel_mult(d_cl_program, "mult_vectors");
+    cl::Kernel kernel_magnitude(d_cl_program, "magnitude_squared");
 
-    // 2- Doppler frequency search loop
+    // 2- Doppler frequency search loop. All device work and the readbacks are
+    // enqueued without blocking; the in-order queue serializes the per-bin
+    // stages, so a single finish() after the loop is the only host-device
+    // synchronization point and the GPU pipeline stays full
     for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
         {
-            // doppler search steps
-            doppler = -static_cast<int>(d_doppler_max) + d_doppler_step * doppler_index;
-
             // Multiply input signal with doppler wipe-off
-            kernel = cl::Kernel(d_cl_program, "mult_vectors");
-            kernel.setArg(0, *d_cl_buffer_in);                                    // input 1
-            kernel.setArg(1, *d_cl_buffer_grid_doppler_wipeoffs[doppler_index]);  // input 2
-            kernel.setArg(2, *d_cl_buffer_1);                                     // output
-            d_cl_queue->enqueueNDRangeKernel(kernel, cl::NullRange, cl::NDRange(d_fft_size),
+            kernel_mult.setArg(0, *d_cl_buffer_in);                                    // input 1
+            kernel_mult.setArg(1, *d_cl_buffer_grid_doppler_wipeoffs[doppler_index]);  // input 2
+            kernel_mult.setArg(2, *d_cl_buffer_1);                                     // output
+            d_cl_queue->enqueueNDRangeKernel(kernel_mult, cl::NullRange, cl::NDRange(d_fft_size),
                 cl::NullRange);
 
             // In the previous operation, we store the result in the first d_fft_size positions
@@ -523,11 +528,10 @@ void pcps_opencl_acquisition_cc::acquisition_core_opencl()
 
             // Multiply carrier wiped--off, Fourier transformed incoming signal
             // with the local FFT'd code reference
-            kernel = cl::Kernel(d_cl_program, "mult_vectors");
-            kernel.setArg(0, *d_cl_buffer_2);          // input 1
-            kernel.setArg(1, *d_cl_buffer_fft_codes);  // input 2
-            kernel.setArg(2, *d_cl_buffer_2);          // output
-            d_cl_queue->enqueueNDRangeKernel(kernel, cl::NullRange, cl::NDRange(d_fft_size_pow2),
+            kernel_mult.setArg(0, *d_cl_buffer_2);          // input 1
+            kernel_mult.setArg(1, *d_cl_buffer_fft_codes);  // input 2
+            kernel_mult.setArg(2, *d_cl_buffer_2);          // output
+            d_cl_queue->enqueueNDRangeKernel(kernel_mult, cl::NullRange, cl::NDRange(d_fft_size_pow2),
                 cl::NullRange);
 
             // compute the inverse FFT
@@ -536,23 +540,31 @@ void pcps_opencl_acquisition_cc::acquisition_core_opencl()
                 0, nullptr, nullptr);
 
             // Compute magnitude
-            kernel = cl::Kernel(d_cl_program, "magnitude_squared");
-            kernel.setArg(0, *d_cl_buffer_2);          // input 1
-            kernel.setArg(1, *d_cl_buffer_magnitude);  // output
-            d_cl_queue->enqueueNDRangeKernel(kernel, cl::NullRange, cl::NDRange(d_fft_size),
+            kernel_magnitude.setArg(0, *d_cl_buffer_2);          // input 1
+            kernel_magnitude.setArg(1, *d_cl_buffer_magnitude);  // output
+            d_cl_queue->enqueueNDRangeKernel(kernel_magnitude, cl::NullRange, cl::NDRange(d_fft_size),
                 cl::NullRange);
 
-            // This is the only function that blocks this thread until all previously enqueued
-            // OpenCL commands are completed.
-            d_cl_queue->enqueueReadBuffer(*d_cl_buffer_magnitude, CL_TRUE, 0,
-                sizeof(float) * d_fft_size, d_magnitude.data());
+            // Non-blocking readback into this bin's row of the host grid; the
+            // in-order queue guarantees it completes before the next bin's
+            // magnitude kernel overwrites the device buffer
+            d_cl_queue->enqueueReadBuffer(*d_cl_buffer_magnitude, CL_FALSE, 0,
+                sizeof(float) * d_fft_size, d_magnitude_grid_cl[doppler_index].data());
+        }
 
-            // Search maximum
-            // @TODO: find an efficient way to search the maximum with OpenCL in the GPU.
-            volk_gnsssdr_32f_index_max_32u(&indext, d_magnitude.data(), d_fft_size);
+    // Single synchronization point for the whole Doppler grid
+    d_cl_queue->finish();
+
+    // 3- Search the maximum of the whole grid on the host
+    // @TODO: find an efficient way to search the maximum with OpenCL in the GPU.
+    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+        {
+            doppler = -static_cast<int>(d_doppler_max) + d_doppler_step * doppler_index;
+
+            volk_gnsssdr_32f_index_max_32u(&indext, d_magnitude_grid_cl[doppler_index].data(), d_fft_size);
 
             // Normalize the maximum value to correct the scale factor introduced by FFTW
-            magt = d_magnitude[indext] / (fft_normalization_factor * fft_normalization_factor);
+            magt = d_magnitude_grid_cl[doppler_index][indext] / (fft_normalization_factor * fft_normalization_factor);
 
             // 4- record the maximum peak and the associated synchronization parameters
             if (d_mag < magt)
@@ -248,6 +248,7 @@ private:
     std::vector<gr_complex> d_zero_vector;
     std::vector<uint64_t> d_sample_counter_buffer;
     std::vector<float> d_magnitude;
+    std::vector<std::vector<float>> d_magnitude_grid_cl;
 
     std::string d_dump_filename;
     std::string d_satellite_str;
@@ -38,8 +38,56 @@ void Acq_Conf::SetFromConfiguration(const ConfigurationInterface *configuration,
     sampled_ms = configuration->property(role + ".coherent_integration_time_ms", sampled_ms);
     bit_transition_flag = configuration->property(role + ".bit_transition_flag", bit_transition_flag);
     max_dwells = configuration->property(role + ".max_dwells", max_dwells);
+    high_sensitivity = configuration->property(role + ".high_sensitivity", high_sensitivity);
+    coherent_blocks = configuration->property(role + ".coherent_blocks", coherent_blocks);
+    if (high_sensitivity && coherent_blocks < 2U)
+        {
+            LOG(WARNING) << "Parameter coherent_blocks should be 2 or greater in high-sensitivity mode. Setting it to 2";
+            coherent_blocks = 2U;
+        }
+    batch_fft = configuration->property(role + ".batch_fft", batch_fft);
+    grid_16_bits = configuration->property(role + ".grid_16_bits", grid_16_bits);
+    zero_copy = configuration->property(role + ".zero_copy", zero_copy);
+    shared_input_fft = configuration->property(role + ".shared_input_fft", shared_input_fft);
+    use_16ic_path = configuration->property(role + ".use_16ic_path", use_16ic_path);
+    coarse_decimation = configuration->property(role + ".coarse_decimation", coarse_decimation);
+    if ((coarse_decimation != 1U) && (coarse_decimation != 2U) && (coarse_decimation != 4U))
+        {
+            LOG(WARNING) << "Parameter coarse_decimation should be 1, 2 or 4. Setting it to 1";
+            coarse_decimation = 1U;
+        }
+    coarse_candidates = configuration->property(role + ".coarse_candidates", coarse_candidates);
+    if (coarse_candidates < 1U)
+        {
+            coarse_candidates = 1U;
+        }
+    num_threads = configuration->property(role + ".num_threads", num_threads);
+    if (num_threads < 1)
+        {
+            LOG(WARNING) << "Parameter num_threads should be 1 or greater. Setting it to 1";
+            num_threads = 1;
+        }
+    use_shared_pool = configuration->property(role + ".use_shared_pool", use_shared_pool);
+    use_grid_pool = configuration->property(role + ".use_grid_pool", use_grid_pool);
+    adaptive_dwells = configuration->property(role + ".adaptive_dwells", adaptive_dwells);
+    tune_fft_size = configuration->property(role + ".tune_fft_size", tune_fft_size);
+    sparse_reacq = configuration->property(role + ".sparse_reacq", sparse_reacq);
+    sparse_fft = configuration->property(role + ".sparse_fft", sparse_fft);
+    sparse_reacq_doppler_unc_hz = configuration->property(role + ".sparse_reacq_doppler_unc_hz", sparse_reacq_doppler_unc_hz);
+    sparse_reacq_unc_rate_hz_s = configuration->property(role + ".sparse_reacq_unc_rate_hz_s", sparse_reacq_unc_rate_hz_s);
     dump = configuration->property(role + ".dump", dump);
     dump_channel = configuration->property(role + ".dump_channel", dump_channel);
+    dump_compact = configuration->property(role + ".dump_compact", dump_compact);
+    dump_topk = configuration->property(role + ".dump_topk", dump_topk);
+    if (dump_topk < 1U)
+        {
+            dump_topk = 1U;
+        }
+    dump_decimation = configuration->property(role + ".dump_decimation", dump_decimation);
+    if (dump_decimation < 1U)
+        {
+            dump_decimation = 1U;
+        }
     blocking = configuration->property(role + ".blocking", blocking);
     dump_filename = configuration->property(role + ".dump_filename", dump_filename);
 
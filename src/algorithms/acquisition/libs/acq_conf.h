@@ -53,24 +53,45 @@ public:
     float pfa2{0.0};
     float samples_per_code{0.0};
     float resampler_ratio{1.0};
+    float sparse_reacq_doppler_unc_hz{250.0};
+    float sparse_reacq_unc_rate_hz_s{100.0};
 
     uint32_t sampled_ms{1U};
     uint32_t ms_per_code{1U};
     uint32_t samples_per_chip{2U};
     uint32_t chips_per_second{1023000U};
     uint32_t max_dwells{1U};
+    uint32_t coherent_blocks{4U};
     uint32_t num_doppler_bins_step2{4U};
     uint32_t resampler_latency_samples{0U};
+    uint32_t coarse_decimation{1U};
+    uint32_t coarse_candidates{4U};
     uint32_t dump_channel{0U};
+    uint32_t dump_topk{8U};
+    uint32_t dump_decimation{64U};
     int32_t doppler_max{5000};
     int32_t doppler_min{-5000};
+    int32_t num_threads{1};
 
     bool bit_transition_flag{false};
+    bool high_sensitivity{false};
+    bool batch_fft{false};
+    bool grid_16_bits{false};
+    bool zero_copy{false};
+    bool shared_input_fft{false};
+    bool use_shared_pool{false};
+    bool use_grid_pool{false};
+    bool use_16ic_path{false};
     bool use_CFAR_algorithm_flag{true};
     bool dump{false};
+    bool dump_compact{false};
     bool blocking{true};
     bool blocking_on_standby{false};  // enable it only for unit testing to avoid sample consume on idle status
     bool make_2_steps{false};
+    bool adaptive_dwells{false};
+    bool tune_fft_size{false};
+    bool sparse_reacq{false};
+    bool sparse_fft{false};
     bool use_automatic_resampler{false};
     bool enable_monitor_output{false};
 
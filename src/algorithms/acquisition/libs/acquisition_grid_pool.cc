@@ -0,0 +1,81 @@
+/*!
+ * \file acquisition_grid_pool.cc
+ * \brief Process-wide pool of acquisition grid buffers shared by all channels
+ * \author Carles Fernandez, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acquisition_grid_pool.h"
+
+
+Acquisition_Grid_Pool& Acquisition_Grid_Pool::get_instance()
+{
+    static Acquisition_Grid_Pool instance;
+    return instance;
+}
+
+
+Acquisition_Grid_Pool::magnitude_grid_t Acquisition_Grid_Pool::lease_magnitude_grid(uint32_t num_doppler_bins, uint32_t fft_size)
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        auto it = d_magnitude_grids.find({num_doppler_bins, fft_size});
+        if (it != d_magnitude_grids.end() && !it->second.empty())
+            {
+                magnitude_grid_t grid = std::move(it->second.back());
+                it->second.pop_back();
+                return grid;
+            }
+    }
+    // no recyclable buffer: allocate outside the lock
+    return magnitude_grid_t(num_doppler_bins, volk_gnsssdr::hugepage_vector<float>(fft_size));
+}
+
+
+Acquisition_Grid_Pool::wipeoff_grid_t Acquisition_Grid_Pool::lease_wipeoff_grid(uint32_t num_doppler_bins, uint32_t fft_size)
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        auto it = d_wipeoff_grids.find({num_doppler_bins, fft_size});
+        if (it != d_wipeoff_grids.end() && !it->second.empty())
+            {
+                wipeoff_grid_t grid = std::move(it->second.back());
+                it->second.pop_back();
+                return grid;
+            }
+    }
+    return wipeoff_grid_t(num_doppler_bins, volk_gnsssdr::hugepage_vector<std::complex<float>>(fft_size));
+}
+
+
+void Acquisition_Grid_Pool::release(magnitude_grid_t&& grid)
+{
+    if (grid.empty())
+        {
+            return;
+        }
+    const grid_dims dims{grid.size(), grid.front().size()};
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_magnitude_grids[dims].push_back(std::move(grid));
+}
+
+
+void Acquisition_Grid_Pool::release(wipeoff_grid_t&& grid)
+{
+    if (grid.empty())
+        {
+            return;
+        }
+    const grid_dims dims{grid.size(), grid.front().size()};
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_wipeoff_grids[dims].push_back(std::move(grid));
+}
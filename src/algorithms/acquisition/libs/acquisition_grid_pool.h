@@ -0,0 +1,80 @@
+/*!
+ * \file acquisition_grid_pool.h
+ * \brief Process-wide pool of acquisition grid buffers shared by all channels
+ * \author Carles Fernandez, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQUISITION_GRID_POOL_H
+#define GNSS_SDR_ACQUISITION_GRID_POOL_H
+
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <complex>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/** \addtogroup Acquisition
+ * \{ */
+/** \addtogroup acquisition_libs acquisition_libs
+ * \{ */
+
+
+/*!
+ * \brief Free-list pool for the large acquisition grid buffers.
+ *
+ * Each pcps_acquisition instance needs a Doppler wipeoff grid and a
+ * magnitude grid only while it is actually searching, which for a tracking
+ * channel is a tiny fraction of the time. Instead of every channel holding
+ * its grids permanently, channels lease the buffers here when a search
+ * starts and return them when the channel leaves acquisition, so the total
+ * grid memory is bounded by the number of concurrent searches rather than
+ * by the number of channels. Buffers are recycled by exact dimensions;
+ * unmatched requests allocate a fresh buffer outside the pool lock.
+ */
+class Acquisition_Grid_Pool
+{
+public:
+    using magnitude_grid_t = volk_gnsssdr::vector<volk_gnsssdr::hugepage_vector<float>>;
+    using wipeoff_grid_t = volk_gnsssdr::vector<volk_gnsssdr::hugepage_vector<std::complex<float>>>;
+
+    static Acquisition_Grid_Pool& get_instance();
+
+    //! Returns a magnitude grid of the requested dimensions, recycled if possible
+    magnitude_grid_t lease_magnitude_grid(uint32_t num_doppler_bins, uint32_t fft_size);
+
+    //! Returns a Doppler wipeoff grid of the requested dimensions, recycled if
+    //! possible. The content is stale and must be regenerated by the caller
+    wipeoff_grid_t lease_wipeoff_grid(uint32_t num_doppler_bins, uint32_t fft_size);
+
+    //! Returns a leased magnitude grid to the pool
+    void release(magnitude_grid_t&& grid);
+
+    //! Returns a leased wipeoff grid to the pool
+    void release(wipeoff_grid_t&& grid);
+
+private:
+    Acquisition_Grid_Pool() = default;
+
+    using grid_dims = std::pair<std::size_t, std::size_t>;  // (Doppler bins, FFT size)
+
+    std::map<grid_dims, std::vector<magnitude_grid_t>> d_magnitude_grids;
+    std::map<grid_dims, std::vector<wipeoff_grid_t>> d_wipeoff_grids;
+    std::mutex d_mutex;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_ACQUISITION_GRID_POOL_H
@@ -0,0 +1,44 @@
+/*!
+ * \file acquisition_spectrum_cache.cc
+ * \brief Process-wide cache of input-spectrum FFTs shared by acquisition channels
+ * \author Carles Fernandez, 2021. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acquisition_spectrum_cache.h"
+
+
+Acquisition_Spectrum_Cache& Acquisition_Spectrum_Cache::get_instance()
+{
+    static Acquisition_Spectrum_Cache instance;
+    return instance;
+}
+
+
+std::shared_ptr<const volk_gnsssdr::vector<std::complex<float>>> Acquisition_Spectrum_Cache::get_spectrum(
+    const std::string& band_key,
+    uint64_t sample_stamp,
+    uint32_t fft_size,
+    const std::function<void(std::complex<float>*)>& compute_spectrum)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    auto& entry = d_entries[band_key];
+    if (entry.spectrum && entry.sample_stamp == sample_stamp && entry.spectrum->size() == fft_size)
+        {
+            return entry.spectrum;
+        }
+    auto spectrum = std::make_shared<volk_gnsssdr::vector<std::complex<float>>>(fft_size);
+    compute_spectrum(spectrum->data());
+    entry.sample_stamp = sample_stamp;
+    entry.spectrum = spectrum;
+    return entry.spectrum;
+}
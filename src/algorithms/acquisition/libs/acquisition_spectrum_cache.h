@@ -0,0 +1,76 @@
+/*!
+ * \file acquisition_spectrum_cache.h
+ * \brief Process-wide cache of input-spectrum FFTs shared by acquisition channels
+ * \author Carles Fernandez, 2021. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQUISITION_SPECTRUM_CACHE_H
+#define GNSS_SDR_ACQUISITION_SPECTRUM_CACHE_H
+
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/** \addtogroup Acquisition
+ * \{ */
+/** \addtogroup acquisition_libs acquisition_libs
+ * \{ */
+
+
+/*!
+ * \brief Shares the forward FFT of the input snapshot among all acquisition
+ * channels searching the same signal band.
+ *
+ * When several channels acquire satellites of the same band, each snapshot
+ * (identified by its sample stamp) has a single input spectrum. The first
+ * channel asking for it computes the FFT through the provided callback; the
+ * remaining channels get the cached frequency-domain buffer and only perform
+ * the per-satellite code multiplication and inverse transforms.
+ */
+class Acquisition_Spectrum_Cache
+{
+public:
+    static Acquisition_Spectrum_Cache& get_instance();
+
+    /*!
+     * \brief Returns the input spectrum for the given band and sample stamp,
+     * computing it with \a compute_spectrum only if it is not cached yet.
+     */
+    std::shared_ptr<const volk_gnsssdr::vector<std::complex<float>>> get_spectrum(
+        const std::string& band_key,
+        uint64_t sample_stamp,
+        uint32_t fft_size,
+        const std::function<void(std::complex<float>*)>& compute_spectrum);
+
+private:
+    Acquisition_Spectrum_Cache() = default;
+
+    struct Entry
+    {
+        uint64_t sample_stamp{0ULL};
+        std::shared_ptr<const volk_gnsssdr::vector<std::complex<float>>> spectrum;
+    };
+
+    std::map<std::string, Entry> d_entries;
+    std::mutex d_mutex;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_ACQUISITION_SPECTRUM_CACHE_H
@@ -0,0 +1,67 @@
+/*!
+ * \file acquisition_wipeoff_cache.cc
+ * \brief Process-wide cache of Doppler wipeoff grids shared by acquisition channels
+ * \author Carles Fernandez, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acquisition_wipeoff_cache.h"
+#include <algorithm>
+
+namespace
+{
+// distinct parameter sets are few (one per band and Doppler span); the cap
+// only guards against unforeseen configurations churning grid-sized copies
+constexpr std::size_t MAX_CACHED_GRIDS = 8;
+}  // namespace
+
+
+Acquisition_Wipeoff_Cache& Acquisition_Wipeoff_Cache::get_instance()
+{
+    static Acquisition_Wipeoff_Cache instance;
+    return instance;
+}
+
+
+void Acquisition_Wipeoff_Cache::fill(float phase_step_start, float phase_step_delta, uint32_t num_doppler_bins, uint32_t fft_size,
+    wipeoff_grid_t& grid, const std::function<void()>& generate)
+{
+    const cache_key key{phase_step_start, phase_step_delta, num_doppler_bins, fft_size};
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        const auto entry = d_entries.find(key);
+        if (entry != d_entries.end())
+            {
+                for (uint32_t doppler_index = 0; doppler_index < num_doppler_bins; doppler_index++)
+                    {
+                        std::copy(entry->second[doppler_index].begin(), entry->second[doppler_index].end(), grid[doppler_index].data());
+                    }
+                return;
+            }
+    }
+
+    // first channel with these parameters: generate outside the lock (two
+    // concurrent misses just generate twice, the second publish is a no-op)
+    generate();
+
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if ((d_entries.size() >= MAX_CACHED_GRIDS) || (d_entries.find(key) != d_entries.end()))
+        {
+            return;
+        }
+    auto& master = d_entries[key];
+    master.resize(num_doppler_bins);
+    for (uint32_t doppler_index = 0; doppler_index < num_doppler_bins; doppler_index++)
+        {
+            master[doppler_index].assign(grid[doppler_index].data(), grid[doppler_index].data() + fft_size);
+        }
+}
@@ -0,0 +1,77 @@
+/*!
+ * \file acquisition_wipeoff_cache.h
+ * \brief Process-wide cache of Doppler wipeoff grids shared by acquisition channels
+ * \author Carles Fernandez, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQUISITION_WIPEOFF_CACHE_H
+#define GNSS_SDR_ACQUISITION_WIPEOFF_CACHE_H
+
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+/** \addtogroup Acquisition
+ * \{ */
+/** \addtogroup acquisition_libs acquisition_libs
+ * \{ */
+
+
+/*!
+ * \brief Shares the generation of the Doppler wipeoff grid among channels
+ * whose grids are identical.
+ *
+ * The wipeoff grid is fully determined by the starting phase step, the
+ * per-bin phase-step increment, the number of Doppler bins and the FFT size.
+ * All channels of a band share those, and so do channels of co-located bands
+ * decimated from the same conditioner clock when they search the same
+ * Doppler span. The first channel asking for a given parameter set runs the
+ * sincos generation pass and publishes a master copy; the rest fill their
+ * grids with a plain copy, which is much cheaper than regenerating the
+ * complex exponentials.
+ */
+class Acquisition_Wipeoff_Cache
+{
+public:
+    using wipeoff_grid_t = volk_gnsssdr::vector<volk_gnsssdr::hugepage_vector<std::complex<float>>>;
+
+    static Acquisition_Wipeoff_Cache& get_instance();
+
+    /*!
+     * \brief Fills \a grid with the wipeoffs defined by the phase-step
+     * parameters, copying the cached master when available; otherwise \a
+     * generate is invoked (it must write the wipeoffs into \a grid) and a
+     * master copy is published for the channels that follow.
+     */
+    void fill(float phase_step_start, float phase_step_delta, uint32_t num_doppler_bins, uint32_t fft_size,
+        wipeoff_grid_t& grid, const std::function<void()>& generate);
+
+private:
+    Acquisition_Wipeoff_Cache() = default;
+
+    using cache_key = std::tuple<float, float, uint32_t, uint32_t>;
+
+    // master copies live in plain (non-hugepage) memory; they are only read
+    std::map<cache_key, std::vector<std::vector<std::complex<float>>>> d_entries;
+    std::mutex d_mutex;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_ACQUISITION_WIPEOFF_CACHE_H
@@ -0,0 +1,148 @@
+/*!
+ * \file acquisition_worker_pool.cc
+ * \brief Process-wide worker pool executing grid-search jobs from all acquisition channels
+ * \author Carles Fernandez, 2021. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acquisition_worker_pool.h"
+#include <algorithm>
+
+
+Acquisition_Worker_Pool& Acquisition_Worker_Pool::get_instance()
+{
+    static Acquisition_Worker_Pool instance;
+    return instance;
+}
+
+
+Acquisition_Worker_Pool::Acquisition_Worker_Pool() : d_running(true)
+{
+    // leave a couple of cores to the flowgraph scheduler; the submitting
+    // threads also execute work units, so one worker is always enough
+    const auto num_cores = std::thread::hardware_concurrency();
+    const uint32_t num_workers = (num_cores > 2U) ? (num_cores - 2U) : 1U;
+    d_threads.reserve(num_workers);
+    for (uint32_t i = 0; i < num_workers; i++)
+        {
+            d_threads.emplace_back(&Acquisition_Worker_Pool::worker_loop, this);
+        }
+}
+
+
+Acquisition_Worker_Pool::~Acquisition_Worker_Pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_running = false;
+    }
+    d_cv.notify_all();
+    for (auto& thread : d_threads)
+        {
+            if (thread.joinable())
+                {
+                    thread.join();
+                }
+        }
+}
+
+
+uint32_t Acquisition_Worker_Pool::size() const
+{
+    return static_cast<uint32_t>(d_threads.size());
+}
+
+
+bool Acquisition_Worker_Pool::take_work_unit(std::shared_ptr<Job>& job, std::size_t& index)
+{
+    // caller holds d_mutex. Steal from the oldest job with pending units
+    while (!d_jobs.empty() && d_jobs.front()->next >= d_jobs.front()->work_units->size())
+        {
+            d_jobs.pop_front();
+        }
+    for (auto& pending_job : d_jobs)
+        {
+            if (pending_job->next < pending_job->work_units->size())
+                {
+                    job = pending_job;
+                    index = pending_job->next++;
+                    return true;
+                }
+        }
+    return false;
+}
+
+
+void Acquisition_Worker_Pool::finish_work_unit(const std::shared_ptr<Job>& job)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (--job->remaining == 0)
+        {
+            job->done.notify_all();
+        }
+}
+
+
+void Acquisition_Worker_Pool::worker_loop()
+{
+    while (true)
+        {
+            std::shared_ptr<Job> job;
+            std::size_t index = 0;
+            {
+                std::unique_lock<std::mutex> lock(d_mutex);
+                d_cv.wait(lock, [this, &job, &index] { return !d_running || take_work_unit(job, index); });
+                if (!d_running && job == nullptr)
+                    {
+                        return;
+                    }
+            }
+            (*job->work_units)[index]();
+            finish_work_unit(job);
+        }
+}
+
+
+void Acquisition_Worker_Pool::run_and_wait(std::vector<std::function<void()>>& work_units)
+{
+    if (work_units.empty())
+        {
+            return;
+        }
+    auto job = std::make_shared<Job>();
+    job->work_units = &work_units;
+    job->remaining = work_units.size();
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_jobs.push_back(job);
+    }
+    d_cv.notify_all();
+
+    // help with our own job while waiting, so a busy pool cannot stall us
+    while (true)
+        {
+            std::size_t index = 0;
+            {
+                std::lock_guard<std::mutex> lock(d_mutex);
+                if (job->next >= work_units.size())
+                    {
+                        break;
+                    }
+                index = job->next++;
+            }
+            work_units[index]();
+            finish_work_unit(job);
+        }
+
+    std::unique_lock<std::mutex> lock(d_mutex);
+    job->done.wait(lock, [&job] { return job->remaining == 0; });
+}
@@ -0,0 +1,90 @@
+/*!
+ * \file acquisition_worker_pool.h
+ * \brief Process-wide worker pool executing grid-search jobs from all acquisition channels
+ * \author Carles Fernandez, 2021. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQUISITION_WORKER_POOL_H
+#define GNSS_SDR_ACQUISITION_WORKER_POOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** \addtogroup Acquisition
+ * \{ */
+/** \addtogroup acquisition_libs acquisition_libs
+ * \{ */
+
+
+/*!
+ * \brief Work-stealing pool shared by all acquisition channels.
+ *
+ * When most channels are tracking, only a few cold channels search the
+ * Doppler grid and the cores reserved for the rest sit idle. Channels
+ * submit their grid-search work units here instead of spawning their own
+ * threads, so the pool spreads the units of the few searching channels
+ * over all spare cores: worst-case serial time-to-first-fix per channel
+ * becomes parallel time bounded by the total core budget. The submitting
+ * thread also executes units of its own job while it waits, so progress
+ * is guaranteed even when every pool thread is busy serving other
+ * channels.
+ */
+class Acquisition_Worker_Pool
+{
+public:
+    static Acquisition_Worker_Pool& get_instance();
+
+    ~Acquisition_Worker_Pool();
+
+    /*!
+     * \brief Runs the given work units on the pool and blocks until all of
+     * them have completed. Units of the same job never run concurrently
+     * with the same index, but may run on any thread.
+     */
+    void run_and_wait(std::vector<std::function<void()>>& work_units);
+
+    //! Number of worker threads in the pool
+    uint32_t size() const;
+
+private:
+    Acquisition_Worker_Pool();
+
+    struct Job
+    {
+        std::vector<std::function<void()>>* work_units{nullptr};
+        std::size_t next{0};
+        std::size_t remaining{0};
+        std::condition_variable done;
+    };
+
+    void worker_loop();
+    bool take_work_unit(std::shared_ptr<Job>& job, std::size_t& index);
+    void finish_work_unit(const std::shared_ptr<Job>& job);
+
+    std::deque<std::shared_ptr<Job>> d_jobs;
+    std::vector<std::thread> d_threads;
+    mutable std::mutex d_mutex;
+    std::condition_variable d_cv;
+    bool d_running;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_ACQUISITION_WORKER_POOL_H
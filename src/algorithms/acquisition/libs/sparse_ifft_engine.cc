@@ -0,0 +1,125 @@
+/*!
+ * \file sparse_ifft_engine.cc
+ * \brief Subsampled-IFFT correlation peak locator for sparse acquisition
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "sparse_ifft_engine.h"
+#include "MATH_CONSTANTS.h"
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <array>
+
+Sparse_Ifft_Engine::Sparse_Ifft_Engine(uint32_t fft_size)
+    : d_fft_size(fft_size),
+      d_subsampled_size(0U),
+      d_decimation(0U)
+{
+    // Largest power-of-two subsampling factor that divides the FFT length
+    // while keeping enough aliased bins for a usable noise-floor estimate
+    for (uint32_t candidate = 16U; candidate >= 2U; candidate /= 2U)
+        {
+            if ((fft_size % candidate == 0U) && (fft_size / candidate >= 512U))
+                {
+                    d_decimation = candidate;
+                    break;
+                }
+        }
+    if (d_decimation != 0U)
+        {
+            d_subsampled_size = fft_size / d_decimation;
+            d_ifft = gnss_fft_rev_make_unique(d_subsampled_size);
+            d_alias_magnitude = volk_gnsssdr::vector<float>(d_subsampled_size);
+        }
+}
+
+
+bool Sparse_Ifft_Engine::valid() const
+{
+    return d_decimation != 0U;
+}
+
+
+uint32_t Sparse_Ifft_Engine::decimation() const
+{
+    return d_decimation;
+}
+
+
+uint32_t Sparse_Ifft_Engine::locate_peak(const std::complex<float>* spectrum, float& peak_power, float& noise_power)
+{
+    // Inverse transform of the subsampled spectrum. Its m-th output is the
+    // alias sum (1/d) * sum_r x[m + r*M] of the dense output x, M = N/d, so
+    // the code-phase residue of the peak is the argmax of its magnitude
+    gr_complex* subsampled = d_ifft->get_inbuf();
+    for (uint32_t j = 0; j < d_subsampled_size; j++)
+        {
+            subsampled[j] = spectrum[j * d_decimation];
+        }
+    d_ifft->execute();
+    volk_32fc_magnitude_squared_32f(d_alias_magnitude.data(), d_ifft->get_outbuf(), d_subsampled_size);
+
+    uint32_t alias_index = 0U;
+    float alias_max = 0.0F;
+    float alias_sum = 0.0F;
+    float alias_sum_sq = 0.0F;
+    volk_gnsssdr_32f_index_max_stats_32u(&alias_index, &alias_max, &alias_sum, &alias_sum_sq, d_alias_magnitude.data(), d_subsampled_size);
+
+    // The subsampled transform is 1/d of the dense one, so the aliased noise
+    // floor sits d^2 below while holding d folded noise terms: the dense mean
+    // squared magnitude is d times the aliased one (peak bin excluded)
+    noise_power = static_cast<float>(d_decimation) * (alias_sum - alias_max) / static_cast<float>(d_subsampled_size - 1U);
+
+    // Resolve the d-fold code-phase ambiguity: one pass over the full
+    // spectrum accumulates S_c = sum_{k = c mod d} spectrum[k] * e^{j2pi*k*m/N}
+    // per residue class c, from which the d dense candidates follow as
+    // x[m + r*M] = sum_c S_c * e^{j2pi*c*r/d}. The twiddle is advanced
+    // incrementally and refreshed periodically to bound the drift
+    std::array<std::complex<double>, 16> class_sums{};
+    const double phase_step = TWO_PI * static_cast<double>(alias_index) / static_cast<double>(d_fft_size);
+    const std::complex<double> rotator = std::polar(1.0, phase_step);
+    std::complex<double> twiddle(1.0, 0.0);
+    uint32_t residue_class = 0U;
+    for (uint32_t k = 0; k < d_fft_size; k++)
+        {
+            class_sums[residue_class] += std::complex<double>(spectrum[k]) * twiddle;
+            twiddle *= rotator;
+            if (++residue_class == d_decimation)
+                {
+                    residue_class = 0U;
+                }
+            if ((k & 0x3FFU) == 0x3FFU)
+                {
+                    twiddle = std::polar(1.0, phase_step * static_cast<double>(k + 1));
+                }
+        }
+
+    uint32_t best_repetition = 0U;
+    double best_power = 0.0;
+    for (uint32_t r = 0; r < d_decimation; r++)
+        {
+            std::complex<double> candidate(0.0, 0.0);
+            for (uint32_t c = 0; c < d_decimation; c++)
+                {
+                    candidate += class_sums[c] * std::polar(1.0, TWO_PI * static_cast<double>(c * r) / static_cast<double>(d_decimation));
+                }
+            const double candidate_power = std::norm(candidate);
+            if (candidate_power > best_power)
+                {
+                    best_power = candidate_power;
+                    best_repetition = r;
+                }
+        }
+    peak_power = static_cast<float>(best_power);
+    return alias_index + best_repetition * d_subsampled_size;
+}
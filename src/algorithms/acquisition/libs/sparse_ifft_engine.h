@@ -0,0 +1,84 @@
+/*!
+ * \file sparse_ifft_engine.h
+ * \brief Subsampled-IFFT correlation peak locator for sparse acquisition
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_SPARSE_IFFT_ENGINE_H
+#define GNSS_SDR_SPARSE_IFFT_ENGINE_H
+
+#include "gnss_sdr_fft.h"
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <complex>
+#include <cstdint>
+#include <memory>
+
+/** \addtogroup Acquisition
+ * \{ */
+/** \addtogroup acquisition_libs acquisition_libs
+ * \{ */
+
+
+/*!
+ * \brief Locates the correlation peak of a Doppler bin without computing the
+ * full inverse FFT of the product spectrum.
+ *
+ * When the signal is strong, the dense IFFT output of the parallel code phase
+ * search is sparse: a single peak over the noise floor. Subsampling the
+ * product spectrum by a factor \a d and inverting only N/d points yields the
+ * time-domain signal aliased modulo N/d, so the peak still shows up (folded)
+ * at roughly 1/d of the transform cost. The d-fold code-phase ambiguity is
+ * then resolved exactly by evaluating the d alias candidates from one linear
+ * pass over the spectrum, which also recovers the peak power at the same
+ * scale the dense IFFT would have produced. Aliasing adds the d-1 folded
+ * noise contributions on top of the peak, so the effective SNR in the
+ * subsampled domain drops by up to 10*log10(d) dB: this engine is a
+ * strong-signal shortcut, and callers are expected to fall back to the dense
+ * search when the resulting test statistic does not clear the threshold.
+ */
+class Sparse_Ifft_Engine
+{
+public:
+    //! Prepares a subsampled inverse transform for dense grids of \a fft_size points
+    explicit Sparse_Ifft_Engine(uint32_t fft_size);
+
+    //! True when the FFT length admits a suitable subsampling factor
+    bool valid() const;
+
+    //! Subsampling factor in use (0 when not valid)
+    uint32_t decimation() const;
+
+    /*!
+     * \brief Returns the dense-grid index of the correlation peak of the
+     * given product spectrum (code-FFT times signal-FFT, \a fft_size points).
+     *
+     * \a peak_power is set to the squared magnitude the dense unnormalized
+     * IFFT would produce at that index, and \a noise_power to an estimate of
+     * the mean squared magnitude of the dense output away from the peak, so
+     * callers can form the same peak-to-input-power statistic as the dense
+     * search.
+     */
+    uint32_t locate_peak(const std::complex<float>* spectrum, float& peak_power, float& noise_power);
+
+private:
+    volk_gnsssdr::vector<float> d_alias_magnitude;
+    std::unique_ptr<gnss_fft_complex_rev> d_ifft;
+    uint32_t d_fft_size;
+    uint32_t d_subsampled_size;
+    uint32_t d_decimation;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_SPARSE_IFFT_ENGINE_H
@@ -23,6 +23,7 @@
 #include "telemetry_decoder_interface.h"
 #include "tracking_interface.h"
 #include <glog/logging.h>
+#include <algorithm>  // for std::min
 #include <stdexcept>  // for std::invalid_argument
 #include <utility>    // for std::move
 
@@ -50,7 +51,10 @@ Channel::Channel(const ConfigurationInterface* configuration,
     acq_->set_channel(channel_);
     acq_->set_channel_fsm(channel_fsm_);
     trk_->set_channel(channel_);
-    nav_->set_channel(channel_);
+    if (nav_)  // absent in the telemetry-free channel profile
+        {
+            nav_->set_channel(channel_);
+        }
 
     gnss_synchro_ = Gnss_Synchro();
     gnss_synchro_.Channel_ID = channel_;
@@ -58,6 +62,7 @@ Channel::Channel(const ConfigurationInterface* configuration,
     trk_->set_gnss_synchro(&gnss_synchro_);
 
     repeat_ = configuration->property("Acquisition_" + signal_str + std::to_string(channel_) + ".repeat_satellite", repeat_);
+    channel_fsm_->set_repeat_acquisition(repeat_);  // let acquisition notify negative results directly to the FSM
 
     // Provide a warning to the user about the change of parameter name
     if (channel_ == 0)
@@ -93,6 +98,22 @@ Channel::Channel(const ConfigurationInterface* configuration,
 
     acq_->set_threshold(threshold);
 
+    doppler_max_ = configuration->property("Acquisition_" + signal_str + std::to_string(channel_) + ".doppler_max", 0);
+    if (doppler_max_ == 0)
+        {
+            doppler_max_ = configuration->property("Acquisition_" + signal_str + ".doppler_max", 5000);
+        }
+    if (FLAGS_doppler_max != 0)
+        {
+            doppler_max_ = static_cast<uint32_t>(FLAGS_doppler_max);
+        }
+
+    assisted_doppler_span_hz_ = configuration->property("Acquisition_" + signal_str + std::to_string(channel_) + ".assisted_doppler_span_hz", 0);
+    if (assisted_doppler_span_hz_ == 0)
+        {
+            assisted_doppler_span_hz_ = configuration->property("Acquisition_" + signal_str + ".assisted_doppler_span_hz", 1000);
+        }
+
     acq_->init();
 
     channel_fsm_->set_acquisition(acq_);
@@ -121,18 +142,25 @@ void Channel::connect(gr::top_block_sptr top_block)
             throw std::invalid_argument(msg);
         }
 
-    nav_->connect(top_block);
+    if (nav_)
+        {
+            nav_->connect(top_block);
 
-    // Synchronous ports
-    top_block->connect(trk_->get_right_block(), 0, nav_->get_left_block(), 0);
+            // Synchronous ports
+            top_block->connect(trk_->get_right_block(), 0, nav_->get_left_block(), 0);
 
-    // Message ports
-    top_block->msg_connect(nav_->get_left_block(), pmt::mp("telemetry_to_trk"), trk_->get_right_block(), pmt::mp("telemetry_to_trk"));
-    if (glonass_dll_pll_c_aid_tracking_check())
+            // Message ports
+            top_block->msg_connect(nav_->get_left_block(), pmt::mp("telemetry_to_trk"), trk_->get_right_block(), pmt::mp("telemetry_to_trk"));
+            if (glonass_dll_pll_c_aid_tracking_check())
+                {
+                    top_block->msg_connect(nav_->get_left_block(), pmt::mp("preamble_timestamp_samples"), trk_->get_right_block(), pmt::mp("preamble_timestamp_samples"));
+                }
+            DLOG(INFO) << "tracking -> telemetry_decoder";
+        }
+    else
         {
-            top_block->msg_connect(nav_->get_left_block(), pmt::mp("preamble_timestamp_samples"), trk_->get_right_block(), pmt::mp("preamble_timestamp_samples"));
+            DLOG(INFO) << "Channel " << channel_ << " connected without telemetry decoder (telemetry-free profile)";
         }
-    DLOG(INFO) << "tracking -> telemetry_decoder";
 
     // Message ports
     if (!flag_enable_fpga_)
@@ -153,18 +181,23 @@ void Channel::disconnect(gr::top_block_sptr top_block)
             return;
         }
 
-    top_block->disconnect(trk_->get_right_block(), 0, nav_->get_left_block(), 0);
+    if (nav_)
+        {
+            top_block->disconnect(trk_->get_right_block(), 0, nav_->get_left_block(), 0);
+        }
     if (!flag_enable_fpga_)
         {
             acq_->disconnect(top_block);
         }
     trk_->disconnect(top_block);
-    nav_->disconnect(top_block);
-
-    top_block->msg_disconnect(nav_->get_left_block(), pmt::mp("telemetry_to_trk"), trk_->get_right_block(), pmt::mp("telemetry_to_trk"));
-    if (glonass_dll_pll_c_aid_tracking_check())
+    if (nav_)
         {
-            top_block->msg_disconnect(nav_->get_left_block(), pmt::mp("preamble_timestamp_samples"), trk_->get_right_block(), pmt::mp("preamble_timestamp_samples"));
+            nav_->disconnect(top_block);
+            top_block->msg_disconnect(nav_->get_left_block(), pmt::mp("telemetry_to_trk"), trk_->get_right_block(), pmt::mp("telemetry_to_trk"));
+            if (glonass_dll_pll_c_aid_tracking_check())
+                {
+                    top_block->msg_disconnect(nav_->get_left_block(), pmt::mp("preamble_timestamp_samples"), trk_->get_right_block(), pmt::mp("preamble_timestamp_samples"));
+                }
         }
     if (!flag_enable_fpga_)
         {
@@ -208,7 +241,12 @@ gr::basic_block_sptr Channel::get_right_block_acq()
 
 gr::basic_block_sptr Channel::get_right_block()
 {
-    return nav_->get_right_block();
+    if (nav_)
+        {
+            return nav_->get_right_block();
+        }
+    // telemetry-free profile: the tracking output is the channel output
+    return trk_->get_right_block();
 }
 
 
@@ -227,7 +265,10 @@ void Channel::set_signal(const Gnss_Signal& gnss_signal)
         {
             trk_->set_gnss_synchro(&gnss_synchro_);
         }
-    nav_->set_satellite(gnss_signal_.get_satellite());
+    if (nav_)
+        {
+            nav_->set_satellite(gnss_signal_.get_satellite());
+        }
 }
 
 
@@ -246,7 +287,29 @@ void Channel::stop_channel()
 
 void Channel::assist_acquisition_doppler(double Carrier_Doppler_hz)
 {
+    // Joint dual-band acquisition: when the Doppler projected from a band
+    // already in tracking is available, the secondary band only needs to be
+    // verified in a narrow window around it, so the search grid is shrunk to
+    // Acquisition_XS.assisted_doppler_span_hz (0 keeps the full grid) and
+    // restored when the channel falls back to an unassisted search. The
+    // acquisition buffers were sized for the configured doppler_max in the
+    // first init(), so the span is clamped to it
+    if (assisted_doppler_span_hz_ > 0)
+        {
+            if (Carrier_Doppler_hz != 0.0)
+                {
+                    acq_->set_doppler_max(std::min(assisted_doppler_span_hz_, doppler_max_));
+                }
+            else
+                {
+                    acq_->set_doppler_max(doppler_max_);
+                }
+        }
     acq_->set_doppler_center(static_cast<int>(Carrier_Doppler_hz));
+    if (assisted_doppler_span_hz_ > 0)
+        {
+            acq_->init();  // recompute the number of Doppler bins and the wipeoff grid
+        }
 }
 
 
@@ -273,7 +336,7 @@ void Channel::start_acquisition()
 
 bool Channel::glonass_dll_pll_c_aid_tracking_check() const
 {
-    if (glonass_extend_correlation_ms_)
+    if (glonass_extend_correlation_ms_ && nav_)
         {
             const pmt::pmt_t nav_ports_out = nav_->get_left_block()->message_ports_out();
             const pmt::pmt_t trk_ports_in = trk_->get_right_block()->message_ports_in();
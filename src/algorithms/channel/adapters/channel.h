@@ -107,6 +107,8 @@ private:
     std::string role_;
     std::mutex mx_;
     uint32_t channel_;
+    uint32_t doppler_max_;
+    uint32_t assisted_doppler_span_hz_;
     int glonass_extend_correlation_ms_;
     bool connected_;
     bool repeat_;
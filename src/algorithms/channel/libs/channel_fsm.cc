@@ -18,13 +18,15 @@
 
 #include "channel_fsm.h"
 #include "channel_event.h"
+#include "event_log.h"
 #include <glog/logging.h>
 #include <utility>
 
 ChannelFsm::ChannelFsm()
     : queue_(nullptr),
       channel_(0U),
-      state_(0U)
+      state_(0U),
+      repeat_acquisition_(false)
 {
     acq_ = nullptr;
     trk_ = nullptr;
@@ -35,7 +37,8 @@ ChannelFsm::ChannelFsm(std::shared_ptr<AcquisitionInterface> acquisition)
     : acq_(std::move(acquisition)),
       queue_(nullptr),
       channel_(0U),
-      state_(0U)
+      state_(0U),
+      repeat_acquisition_(false)
 {
     trk_ = nullptr;
 }
@@ -45,6 +48,7 @@ bool ChannelFsm::Event_stop_channel()
 {
     std::lock_guard<std::mutex> lk(mx_);
     DLOG(INFO) << "CH = " << channel_ << ". Ev stop channel";
+    Event_Log::get_instance().record(Event_Log::Event::fsm_stop_channel, channel_);
     switch (state_)
         {
         case 0:  // already in stanby
@@ -87,6 +91,7 @@ bool ChannelFsm::Event_start_acquisition()
     state_ = 1;
     start_acquisition();
     DLOG(INFO) << "CH = " << channel_ << ". Ev start acquisition";
+    Event_Log::get_instance().record(Event_Log::Event::fsm_start_acquisition, channel_);
     return true;
 }
 
@@ -101,6 +106,7 @@ bool ChannelFsm::Event_valid_acquisition()
     state_ = 2;
     start_tracking();
     DLOG(INFO) << "CH = " << channel_ << ". Ev valid acquisition";
+    Event_Log::get_instance().record(Event_Log::Event::fsm_valid_acquisition, channel_);
     return true;
 }
 
@@ -115,6 +121,7 @@ bool ChannelFsm::Event_failed_acquisition_repeat()
     state_ = 1;
     start_acquisition();
     DLOG(INFO) << "CH = " << channel_ << ". Ev failed acquisition repeat";
+    Event_Log::get_instance().record(Event_Log::Event::fsm_failed_acquisition, channel_);
     return true;
 }
 
@@ -129,10 +136,21 @@ bool ChannelFsm::Event_failed_acquisition_no_repeat()
     state_ = 3;
     request_satellite();
     DLOG(INFO) << "CH = " << channel_ << ". Ev failed acquisition no repeat";
+    Event_Log::get_instance().record(Event_Log::Event::fsm_failed_acquisition, channel_);
     return true;
 }
 
 
+bool ChannelFsm::Event_failed_acquisition()
+{
+    if (repeat_acquisition_)
+        {
+            return Event_failed_acquisition_repeat();
+        }
+    return Event_failed_acquisition_no_repeat();
+}
+
+
 bool ChannelFsm::Event_failed_tracking_standby()
 {
     std::lock_guard<std::mutex> lk(mx_);
@@ -143,6 +161,7 @@ bool ChannelFsm::Event_failed_tracking_standby()
     state_ = 0U;
     notify_stop_tracking();
     DLOG(INFO) << "CH = " << channel_ << ". Ev failed tracking standby";
+    Event_Log::get_instance().record(Event_Log::Event::fsm_failed_tracking, channel_);
     return true;
 }
 
@@ -182,6 +201,13 @@ void ChannelFsm::set_channel(uint32_t channel)
 }
 
 
+void ChannelFsm::set_repeat_acquisition(bool repeat)
+{
+    std::lock_guard<std::mutex> lk(mx_);
+    repeat_acquisition_ = repeat;
+}
+
+
 void ChannelFsm::stop_acquisition()
 {
     acq_->stop_acquisition();
@@ -197,7 +223,10 @@ void ChannelFsm::stop_tracking()
 void ChannelFsm::start_acquisition()
 {
     acq_->reset();
-    nav_->reset();
+    if (nav_)  // absent in the telemetry-free channel profile
+        {
+            nav_->reset();
+        }
 }
 
 
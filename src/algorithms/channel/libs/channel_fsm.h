@@ -50,6 +50,7 @@ public:
     void set_telemetry(std::shared_ptr<TelemetryDecoderInterface> telemetry);
     void set_queue(Concurrent_Queue<pmt::pmt_t>* queue);
     void set_channel(uint32_t channel);
+    void set_repeat_acquisition(bool repeat);
     void start_acquisition();
 
     // FSM EVENTS
@@ -61,6 +62,14 @@ public:
     virtual bool Event_failed_acquisition_repeat();
     virtual bool Event_failed_acquisition_no_repeat();
 
+    /*!
+     * \brief Negative acquisition event that dispatches to the repeat or
+     * no-repeat handler according to the channel configuration. It allows
+     * acquisition blocks to notify the FSM directly, skipping the message
+     * port round trip through channel_msg_receiver_cc.
+     */
+    bool Event_failed_acquisition();
+
 private:
     void start_tracking();
     void stop_acquisition();
@@ -78,6 +87,7 @@ private:
 
     uint32_t channel_;
     uint32_t state_;
+    bool repeat_acquisition_;
 };
 
 
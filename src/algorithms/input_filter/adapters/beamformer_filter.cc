@@ -19,6 +19,30 @@
 #include "configuration_interface.h"
 #include <glog/logging.h>
 #include <gnuradio/blocks/file_sink.h>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+std::vector<float> parse_float_list(const std::string& s)
+{
+    std::vector<float> v;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ','))
+        {
+            try
+                {
+                    v.push_back(std::stof(item));
+                }
+            catch (const std::exception& e)
+                {
+                    LOG(WARNING) << "Could not parse beamformer weight '" << item << "': " << e.what();
+                }
+        }
+    return v;
+}
+}  // namespace
 
 
 BeamformerFilter::BeamformerFilter(
@@ -37,7 +61,20 @@ BeamformerFilter::BeamformerFilter(
     if (item_type_ == "gr_complex")
         {
             item_size_ = sizeof(gr_complex);
-            beamformer_ = make_beamformer_sptr();
+            // fixed weights from the configuration (comma-separated lists, one
+            // entry per antenna); missing entries default to 1+0j
+            const std::vector<float> w_real = parse_float_list(configuration->property(role + ".weights_real", std::string("")));
+            const std::vector<float> w_imag = parse_float_list(configuration->property(role + ".weights_imag", std::string("")));
+            std::vector<gr_complex> weight_vector(GNSS_SDR_BEAMFORMER_CHANNELS, gr_complex(1.0, 0.0));
+            for (size_t i = 0; i < weight_vector.size(); i++)
+                {
+                    if (i < w_real.size() or i < w_imag.size())
+                        {
+                            weight_vector[i] = gr_complex(i < w_real.size() ? w_real[i] : 0.0F,
+                                i < w_imag.size() ? w_imag[i] : 0.0F);
+                        }
+                }
+            beamformer_ = make_beamformer_sptr(weight_vector);
             DLOG(INFO) << "Item size " << item_size_;
             DLOG(INFO) << "resampler(" << beamformer_->unique_id() << ")";
         }
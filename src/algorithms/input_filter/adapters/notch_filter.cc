@@ -38,12 +38,19 @@ NotchFilter::NotchFilter(const ConfigurationInterface* configuration,
     const int default_length_ = 32;
     const int default_n_segments_est = 12500;
     const int default_n_segments_reset = 5000000;
+    const std::string default_algorithm("time_domain");
+    const int default_fft_size = 4096;
 
     const float pfa = configuration->property(role + ".pfa", default_pfa);
     const float p_c_factor = configuration->property(role + ".p_c_factor", default_p_c_factor);
     const int length_ = configuration->property(role + ".length", default_length_);
     const int n_segments_est = configuration->property(role + ".segments_est", default_n_segments_est);
     const int n_segments_reset = configuration->property(role + ".segments_reset", default_n_segments_reset);
+    // "frequency_domain" selects the overlap-save FFT notch, which trades the
+    // per-sample phase tracking of the default filter for one FFT pair per
+    // fft_size-sample block
+    const std::string algorithm = configuration->property(role + ".algorithm", default_algorithm);
+    const int fft_size = configuration->property(role + ".fft_size", default_fft_size);
 
     dump_filename_ = configuration->property(role + ".dump_filename", default_dump_file);
     item_type_ = configuration->property(role + ".item_type", default_item_type);
@@ -52,9 +59,21 @@ NotchFilter::NotchFilter(const ConfigurationInterface* configuration,
     if (item_type_ == "gr_complex")
         {
             item_size_ = sizeof(gr_complex);
-            notch_filter_ = make_notch_filter(pfa, p_c_factor, length_, n_segments_est, n_segments_reset);
+            if (algorithm == "frequency_domain")
+                {
+                    notch_filter_fd_ = make_notch_filter_fd(pfa, fft_size);
+                    DLOG(INFO) << "input filter(" << notch_filter_fd_->unique_id() << ")";
+                }
+            else
+                {
+                    if (algorithm != "time_domain")
+                        {
+                            LOG(WARNING) << algorithm << " unrecognized notch filter algorithm, using time_domain";
+                        }
+                    notch_filter_ = make_notch_filter(pfa, p_c_factor, length_, n_segments_est, n_segments_reset);
+                    DLOG(INFO) << "input filter(" << notch_filter_->unique_id() << ")";
+                }
             DLOG(INFO) << "Item size " << item_size_;
-            DLOG(INFO) << "input filter(" << notch_filter_->unique_id() << ")";
         }
     else
         {
@@ -82,7 +101,7 @@ void NotchFilter::connect(gr::top_block_sptr top_block)
 {
     if (dump_)
         {
-            top_block->connect(notch_filter_, 0, file_sink_, 0);
+            top_block->connect(filter_block(), 0, file_sink_, 0);
             DLOG(INFO) << "connected notch filter output to file sink";
         }
     else
@@ -96,18 +115,28 @@ void NotchFilter::disconnect(gr::top_block_sptr top_block)
 {
     if (dump_)
         {
-            top_block->disconnect(notch_filter_, 0, file_sink_, 0);
+            top_block->disconnect(filter_block(), 0, file_sink_, 0);
         }
 }
 
 
-gr::basic_block_sptr NotchFilter::get_left_block()
+gr::basic_block_sptr NotchFilter::filter_block()
 {
+    if (notch_filter_fd_)
+        {
+            return notch_filter_fd_;
+        }
     return notch_filter_;
 }
 
 
+gr::basic_block_sptr NotchFilter::get_left_block()
+{
+    return filter_block();
+}
+
+
 gr::basic_block_sptr NotchFilter::get_right_block()
 {
-    return notch_filter_;
+    return filter_block();
 }
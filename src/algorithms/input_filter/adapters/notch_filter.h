@@ -20,6 +20,7 @@
 
 #include "gnss_block_interface.h"
 #include "notch_cc.h"
+#include "notch_fd_cc.h"
 #include <gnuradio/blocks/file_sink.h>
 #include <string>
 #include <vector>
@@ -63,7 +64,9 @@ public:
     gr::basic_block_sptr get_right_block();
 
 private:
+    gr::basic_block_sptr filter_block();
     notch_sptr notch_filter_;
+    notch_fd_sptr notch_filter_fd_;
     gr::blocks::file_sink::sptr file_sink_;
     std::string dump_filename_;
     std::string role_;
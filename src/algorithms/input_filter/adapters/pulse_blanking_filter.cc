@@ -44,6 +44,15 @@ PulseBlankingFilter::PulseBlankingFilter(const ConfigurationInterface* configura
     const int n_segments_est = configuration->property(role_ + ".segments_est", default_n_segments_est);
     const int default_n_segments_reset = 5000000;
     const int n_segments_reset = configuration->property(role_ + ".segments_reset", default_n_segments_reset);
+    // "per_sample" blanks individual samples against a threshold tracked by a
+    // streaming median estimator, instead of zeroing whole length_-sample
+    // segments against the segment-energy statistic
+    const std::string default_algorithm("segment");
+    const std::string algorithm = configuration->property(role_ + ".algorithm", default_algorithm);
+    if (algorithm != "segment" && algorithm != "per_sample")
+        {
+            LOG(WARNING) << algorithm << " unrecognized pulse blanking algorithm, using segment";
+        }
     const double default_if = 0.0;
     const double if_aux = configuration->property(role_ + ".if", default_if);
     const double if_ = configuration->property(role_ + ".IF", if_aux);
@@ -58,7 +67,7 @@ PulseBlankingFilter::PulseBlankingFilter(const ConfigurationInterface* configura
         {
             item_size = sizeof(gr_complex);    // output
             input_size_ = sizeof(gr_complex);  // input
-            pulse_blanking_cc_ = make_pulse_blanking_cc(pfa, length_, n_segments_est, n_segments_reset);
+            pulse_blanking_cc_ = make_pulse_blanking_cc(pfa, length_, n_segments_est, n_segments_reset, algorithm == "per_sample");
         }
     else
         {
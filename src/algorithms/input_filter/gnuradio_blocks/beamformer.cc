@@ -17,48 +17,65 @@
 
 #include "beamformer.h"
 #include <gnuradio/io_signature.h>
+#include <volk/volk.h>
 #include <cstddef>
+#include <utility>
 
 
 beamformer_sptr make_beamformer_sptr()
 {
-    return beamformer_sptr(new beamformer());
+    return beamformer_sptr(new beamformer(std::vector<gr_complex>(GNSS_SDR_BEAMFORMER_CHANNELS, gr_complex(1.0, 0.0))));
 }
 
 
-beamformer::beamformer()
+beamformer_sptr make_beamformer_sptr(std::vector<gr_complex> weight_vector)
+{
+    return beamformer_sptr(new beamformer(std::move(weight_vector)));
+}
+
+
+beamformer::beamformer(std::vector<gr_complex> weight_vector)
     : gr::sync_block("beamformer",
           gr::io_signature::make(GNSS_SDR_BEAMFORMER_CHANNELS, GNSS_SDR_BEAMFORMER_CHANNELS, sizeof(gr_complex)),
-          gr::io_signature::make(1, 1, sizeof(gr_complex)))
+          gr::io_signature::make(1, 1, sizeof(gr_complex))),
+      d_weight_vector(std::move(weight_vector))
 {
+    d_weight_vector.resize(GNSS_SDR_BEAMFORMER_CHANNELS, gr_complex(1.0, 0.0));
+}
+
+
+void beamformer::set_weights(const std::vector<gr_complex> &weight_vector)
+{
+    gr::thread::scoped_lock lock(d_setlock);
+    d_weight_vector = weight_vector;
+    d_weight_vector.resize(GNSS_SDR_BEAMFORMER_CHANNELS, gr_complex(1.0, 0.0));
 }
 
 
 int beamformer::work(int noutput_items, gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
 {
+    gr::thread::scoped_lock lock(d_setlock);
     auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
-    // channel output buffers
-    //  gr_complex *ch1 = (gr_complex *) input_items[0];
-    //  gr_complex *ch2 = (gr_complex *) input_items[1];
-    //  gr_complex *ch3 = (gr_complex *) input_items[2];
-    //  gr_complex *ch4 = (gr_complex *) input_items[3];
-    //  gr_complex *ch5 = (gr_complex *) input_items[4];
-    //  gr_complex *ch6 = (gr_complex *) input_items[5];
-    //  gr_complex *ch7 = (gr_complex *) input_items[6];
-    //  gr_complex *ch8 = (gr_complex *) input_items[7];
+    const auto num_points = static_cast<unsigned int>(noutput_items);
+
+    if (d_weighted_antenna.size() < static_cast<size_t>(noutput_items))
+        {
+            d_weighted_antenna.resize(noutput_items);
+        }
 
-    // NON-VOLK beamforming operation
-    // TODO: Implement VOLK SIMD-accelerated beamformer!
-    gr_complex sum;
-    for (int n = 0; n < noutput_items; n++)
+    // weighted sum across antennas: the SIMD-friendly formulation is one
+    // scale-and-accumulate pass per antenna over the whole sample block,
+    // instead of an inner antenna loop per sample
+    volk_32fc_s32fc_multiply_32fc(out,
+        reinterpret_cast<const gr_complex *>(input_items[0]),
+        d_weight_vector[0], num_points);
+    for (size_t i = 1; i < d_weight_vector.size(); i++)
         {
-            sum = gr_complex(0, 0);
-            for (size_t i = 0; i < weight_vector.size(); i++)
-                {
-                    sum = sum + (reinterpret_cast<const gr_complex *>(input_items[i]))[n] * weight_vector[i];
-                }
-            out[n] = sum;
+            volk_32fc_s32fc_multiply_32fc(d_weighted_antenna.data(),
+                reinterpret_cast<const gr_complex *>(input_items[i]),
+                d_weight_vector[i], num_points);
+            volk_32fc_x2_add_32fc(out, out, d_weighted_antenna.data(), num_points);
         }
 
     return noutput_items;
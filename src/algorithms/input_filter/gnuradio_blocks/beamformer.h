@@ -19,7 +19,9 @@
 #define GNSS_SDR_BEAMFORMER_H
 
 #include "gnss_block_interface.h"
+#include <gnuradio/gr_complex.h>
 #include <gnuradio/sync_block.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
 #include <vector>
 
 /** \addtogroup Input_Filter
@@ -34,6 +36,8 @@ using beamformer_sptr = gnss_shared_ptr<beamformer>;
 
 beamformer_sptr make_beamformer_sptr();
 
+beamformer_sptr make_beamformer_sptr(std::vector<gr_complex> weight_vector);
+
 const int GNSS_SDR_BEAMFORMER_CHANNELS = 8;
 
 /*!
@@ -46,10 +50,16 @@ public:
     int work(int noutput_items, gr_vector_const_void_star &input_items,
         gr_vector_void_star &output_items);
 
+    //! Replaces the antenna weights. Thread-safe, so an external controller
+    //! (e.g. a null-steering loop) can retune the beam while the flowgraph runs
+    void set_weights(const std::vector<gr_complex> &weight_vector);
+
 private:
     friend beamformer_sptr make_beamformer_sptr();
-    beamformer();
-    std::vector<gr_complex> weight_vector = std::vector<gr_complex>(GNSS_SDR_BEAMFORMER_CHANNELS, gr_complex(1.0, 0.0));
+    friend beamformer_sptr make_beamformer_sptr(std::vector<gr_complex> weight_vector);
+    explicit beamformer(std::vector<gr_complex> weight_vector);
+    std::vector<gr_complex> d_weight_vector;
+    volk_gnsssdr::vector<gr_complex> d_weighted_antenna;  // scratch for the per-antenna scaled samples
 };
 
 
@@ -0,0 +1,103 @@
+/*!
+ * \file notch_fd_cc.cc
+ * \brief Implements a frequency-domain overlap-save notch filter
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "notch_fd_cc.h"
+#include <boost/math/distributions/chi_squared.hpp>
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <algorithm>
+#include <cmath>
+
+
+notch_fd_sptr make_notch_filter_fd(float pfa, int32_t fft_size)
+{
+    return notch_fd_sptr(new NotchFd(pfa, fft_size));
+}
+
+
+NotchFd::NotchFd(float pfa, int32_t fft_size)
+    : gr::block("NotchFd",
+          gr::io_signature::make(1, 1, sizeof(gr_complex)),
+          gr::io_signature::make(1, 1, sizeof(gr_complex))),
+      pfa_(pfa),
+      inv_size_(1.0F / static_cast<float>(fft_size)),
+      fft_size_(fft_size),
+      overlap_(fft_size / 8),
+      hop_(fft_size - fft_size / 8)
+{
+    const int32_t alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
+    set_alignment(std::max(1, alignment_multiple));
+    // Per-bin power of a noise-only bin follows a chi-squared distribution
+    // with 2 degrees of freedom around the floor estimate
+    boost::math::chi_squared_distribution<float> my_dist_(2);
+    const float thres_factor = boost::math::quantile(boost::math::complement(my_dist_, pfa_)) / 2.0F;
+    thres_dB_ = 10.0F * std::log10(thres_factor);
+    power_spect_ = volk_gnsssdr::vector<float>(fft_size_);
+    mask_ = volk_gnsssdr::vector<float>(fft_size_);
+    d_fft_ = gnss_fft_fwd_make_unique(fft_size_);
+    d_ifft_ = gnss_fft_rev_make_unique(fft_size_);
+    // the first overlap_ input samples of each block come from history
+    set_history(overlap_ + 1);
+}
+
+
+int NotchFd::general_work(int noutput_items, gr_vector_int &ninput_items,
+    gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
+{
+    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
+    auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
+
+    int32_t index_out = 0;
+    float sig2dB = 0.0;
+
+    while ((index_out + hop_) <= noutput_items && (index_out + fft_size_) <= ninput_items[0])
+        {
+            // in points overlap_ samples into the past, so this window holds
+            // overlap_ already-emitted samples followed by hop_ new ones
+            std::copy(in + index_out, in + index_out + fft_size_, d_fft_->get_inbuf());
+            d_fft_->execute();
+            gr_complex *bins = d_fft_->get_outbuf();
+
+            volk_32fc_s32f_power_spectrum_32f(power_spect_.data(), bins, 1.0, fft_size_);
+            volk_32f_s32f_calc_spectral_noise_floor_32f(&sig2dB, power_spect_.data(), 15.0, fft_size_);
+            const float thr = sig2dB + thres_dB_;
+
+            // 0 / (1 / fft_size) mask absorbing the inverse FFT scaling; bins
+            // adjacent to an excised one are cleared too, so a chirp sweeping
+            // through a bin during the block does not leak at its edges
+            for (int32_t bin = 0; bin < fft_size_; bin++)
+                {
+                    mask_[bin] = (power_spect_[bin] > thr) ? 0.0F : inv_size_;
+                }
+            for (int32_t bin = 0; bin < fft_size_; bin++)
+                {
+                    if (power_spect_[bin] > thr)
+                        {
+                            mask_[(bin + fft_size_ - 1) % fft_size_] = 0.0F;
+                            mask_[(bin + 1) % fft_size_] = 0.0F;
+                        }
+                }
+            volk_32fc_32f_multiply_32fc(d_ifft_->get_inbuf(), bins, mask_.data(), fft_size_);
+            d_ifft_->execute();
+
+            // overlap-save: the head of the inverse transform carries the
+            // circular wrap-around and is discarded
+            std::copy(d_ifft_->get_outbuf() + overlap_, d_ifft_->get_outbuf() + fft_size_, out + index_out);
+            index_out += hop_;
+        }
+    consume_each(index_out);
+    return index_out;
+}
@@ -0,0 +1,85 @@
+/*!
+ * \file notch_fd_cc.h
+ * \brief Implements a frequency-domain overlap-save notch filter
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * Instead of tracking the interference phase sample by sample, this block
+ * transforms fixed-size sample blocks to the frequency domain, zeroes the
+ * bins whose power exceeds a threshold over the estimated noise floor, and
+ * transforms back, discarding the overlapped samples contaminated by the
+ * circular convolution. One FFT pair per block replaces the per-sample
+ * complex exponential of the time-domain notch, which makes a large
+ * difference at tens of MS/s with several interferers present.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ *
+ */
+
+#ifndef GNSS_SDR_NOTCH_FD_CC_H
+#define GNSS_SDR_NOTCH_FD_CC_H
+
+#include "gnss_block_interface.h"
+#include "gnss_sdr_fft.h"
+#include <gnuradio/block.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cstdint>
+#include <memory>
+
+/** \addtogroup Input_Filter
+ * \{ */
+/** \addtogroup Input_filter_gnuradio_blocks
+ * \{ */
+
+
+class NotchFd;
+
+using notch_fd_sptr = gnss_shared_ptr<NotchFd>;
+
+notch_fd_sptr make_notch_filter_fd(
+    float pfa,
+    int32_t fft_size);
+
+/*!
+ * \brief This class implements an overlap-save frequency-domain notch filter
+ * for complex data
+ *
+ * Each block of fft_size samples overlaps the previous one by fft_size / 8
+ * samples; the overlapped head of every inverse transform is discarded
+ */
+class NotchFd : public gr::block
+{
+public:
+    ~NotchFd() = default;
+
+    int general_work(int noutput_items, gr_vector_int &ninput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    friend notch_fd_sptr make_notch_filter_fd(float pfa, int32_t fft_size);
+    NotchFd(float pfa, int32_t fft_size);
+
+    std::unique_ptr<gnss_fft_complex_fwd> d_fft_;
+    std::unique_ptr<gnss_fft_complex_rev> d_ifft_;
+    volk_gnsssdr::vector<float> power_spect_;
+    volk_gnsssdr::vector<float> mask_;
+    float pfa_;
+    float thres_dB_;   // detection threshold over the noise floor, in dB
+    float inv_size_;   // 1 / fft_size, folded into the mask
+    int32_t fft_size_;
+    int32_t overlap_;  // samples discarded at the head of each inverse FFT
+    int32_t hop_;      // fft_size - overlap, new samples per block
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_NOTCH_FD_CC_H
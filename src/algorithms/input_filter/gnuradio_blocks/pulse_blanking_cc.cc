@@ -9,7 +9,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -21,22 +21,131 @@
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
 #include <algorithm>
+#include <cmath>
+
+
+P2QuantileEstimator::P2QuantileEstimator(float quantile)
+    : p_(quantile),
+      count_(0)
+{
+    np_[0] = 0.0F;
+    np_[1] = 2.0F * p_;
+    np_[2] = 4.0F * p_;
+    np_[3] = 2.0F + 2.0F * p_;
+    np_[4] = 4.0F;
+    dnp_[0] = 0.0F;
+    dnp_[1] = p_ / 2.0F;
+    dnp_[2] = p_;
+    dnp_[3] = (1.0F + p_) / 2.0F;
+    dnp_[4] = 1.0F;
+}
+
+
+void P2QuantileEstimator::update(float x)
+{
+    if (count_ < 5)
+        {
+            q_[count_] = x;
+            count_++;
+            if (count_ == 5)
+                {
+                    std::sort(q_, q_ + 5);
+                    for (int32_t i = 0; i < 5; i++)
+                        {
+                            n_[i] = i;
+                        }
+                }
+            return;
+        }
+
+    int32_t k;
+    if (x < q_[0])
+        {
+            q_[0] = x;
+            k = 0;
+        }
+    else if (x < q_[1])
+        {
+            k = 0;
+        }
+    else if (x < q_[2])
+        {
+            k = 1;
+        }
+    else if (x < q_[3])
+        {
+            k = 2;
+        }
+    else if (x <= q_[4])
+        {
+            k = 3;
+        }
+    else
+        {
+            q_[4] = x;
+            k = 3;
+        }
+    for (int32_t i = k + 1; i < 5; i++)
+        {
+            n_[i]++;
+        }
+    for (int32_t i = 0; i < 5; i++)
+        {
+            np_[i] += dnp_[i];
+        }
+    for (int32_t i = 1; i < 4; i++)
+        {
+            const float d = np_[i] - static_cast<float>(n_[i]);
+            if ((d >= 1.0F && n_[i + 1] - n_[i] > 1) || (d <= -1.0F && n_[i - 1] - n_[i] < -1))
+                {
+                    const auto s = static_cast<int32_t>((d >= 0.0F) ? 1 : -1);
+                    const auto sf = static_cast<float>(s);
+                    // piecewise-parabolic prediction of the new marker height
+                    const auto nm = static_cast<float>(n_[i - 1]);
+                    const auto ni = static_cast<float>(n_[i]);
+                    const auto np = static_cast<float>(n_[i + 1]);
+                    float qn = q_[i] + sf / (np - nm) * ((ni - nm + sf) * (q_[i + 1] - q_[i]) / (np - ni) + (np - ni - sf) * (q_[i] - q_[i - 1]) / (ni - nm));
+                    if (qn <= q_[i - 1] || qn >= q_[i + 1])
+                        {
+                            // fall back to linear prediction if not monotonic
+                            qn = q_[i] + sf * (q_[i + s] - q_[i]) / (static_cast<float>(n_[i + s]) - ni);
+                        }
+                    q_[i] = qn;
+                    n_[i] += s;
+                }
+        }
+    count_++;
+}
+
+
+float P2QuantileEstimator::value() const
+{
+    return q_[2];
+}
+
+
+bool P2QuantileEstimator::valid() const
+{
+    return count_ >= 5;
+}
 
 
 pulse_blanking_cc_sptr make_pulse_blanking_cc(float pfa, int32_t length,
-    int32_t n_segments_est, int32_t n_segments_reset)
+    int32_t n_segments_est, int32_t n_segments_reset, bool per_sample)
 {
-    return pulse_blanking_cc_sptr(new pulse_blanking_cc(pfa, length, n_segments_est, n_segments_reset));
+    return pulse_blanking_cc_sptr(new pulse_blanking_cc(pfa, length, n_segments_est, n_segments_reset, per_sample));
 }
 
 
 pulse_blanking_cc::pulse_blanking_cc(float pfa,
     int32_t length,
     int32_t n_segments_est,
-    int32_t n_segments_reset)
+    int32_t n_segments_reset,
+    bool per_sample)
     : gr::block("pulse_blanking_cc",
           gr::io_signature::make(1, 1, sizeof(gr_complex)),
           gr::io_signature::make(1, 1, sizeof(gr_complex))),
+      median_est_(0.5),
       noise_power_estimation_(0.0),
       pfa_(pfa),
       length_(length),
@@ -44,28 +153,79 @@ pulse_blanking_cc::pulse_blanking_cc(float pfa,
       n_segments_est_(n_segments_est),
       n_segments_reset_(n_segments_reset),
       n_deg_fred_(2 * length),
-      last_filtered_(false)
+      last_filtered_(false),
+      per_sample_(per_sample)
 {
     const int32_t alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
     set_alignment(std::max(1, alignment_multiple));
-    boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred_);
-    thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa_));
+    if (per_sample_)
+        {
+            // single-sample magnitude-squared of complex noise has 2 degrees
+            // of freedom
+            boost::math::chi_squared_distribution<float> my_dist_(2);
+            thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa_)) / 2.0F;
+        }
+    else
+        {
+            boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred_);
+            thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa_));
+        }
     zeros_ = volk_gnsssdr::vector<gr_complex>(length_);
 }
 
 
+int pulse_blanking_cc::per_sample_work(int noutput_items, const gr_complex *in, gr_complex *out)
+{
+    volk_32fc_magnitude_squared_32f(magnitude_.data(), in, noutput_items);
+
+    // the median of |x|^2 is a pulse-robust noise power estimate: it is
+    // unaffected by strong pulses up to a 50 % duty cycle, and needs no
+    // segment bookkeeping or estimation restarts. Updating the P-square
+    // markers on a decimated subset keeps the tracking cost negligible
+    for (int32_t i = 0; i < noutput_items; i += 16)
+        {
+            median_est_.update(magnitude_[i]);
+        }
+    if (!median_est_.valid())
+        {
+            std::copy(in, in + noutput_items, out);
+            consume_each(noutput_items);
+            return noutput_items;
+        }
+    // |x|^2 of complex Gaussian noise is exponential: median = sigma^2 ln(2)
+    noise_power_estimation_ = median_est_.value() / 0.6931472F;
+    const float thr = noise_power_estimation_ * thres_;
+
+    // branchless 0/1 mask, auto-vectorized by the compiler
+    for (int32_t i = 0; i < noutput_items; i++)
+        {
+            const float keep = (magnitude_[i] <= thr) ? 1.0F : 0.0F;
+            out[i] = in[i] * keep;
+        }
+    consume_each(noutput_items);
+    return noutput_items;
+}
+
+
 int pulse_blanking_cc::general_work(int noutput_items, gr_vector_int &ninput_items __attribute__((unused)),
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
     const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
     auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
-    auto magnitude = volk_gnsssdr::vector<float>(noutput_items);
-    volk_32fc_magnitude_squared_32f(magnitude.data(), in, noutput_items);
+    if (magnitude_.size() < static_cast<size_t>(noutput_items))
+        {
+            magnitude_.resize(noutput_items);
+        }
+    if (per_sample_)
+        {
+            return per_sample_work(noutput_items, in, out);
+        }
+    volk_32fc_magnitude_squared_32f(magnitude_.data(), in, noutput_items);
     int32_t sample_index = 0;
     float segment_energy;
     while ((sample_index + length_) < noutput_items)
         {
-            volk_32f_accumulator_s32f(&segment_energy, (magnitude.data() + sample_index), length_);
+            volk_32f_accumulator_s32f(&segment_energy, (magnitude_.data() + sample_index), length_);
             if ((n_segments_ < n_segments_est_) && (last_filtered_ == false))
                 {
                     noise_power_estimation_ = (static_cast<float>(n_segments_) * noise_power_estimation_ + segment_energy / static_cast<float>(n_deg_fred_)) / static_cast<float>(n_segments_ + 1);
@@ -39,7 +39,31 @@ pulse_blanking_cc_sptr make_pulse_blanking_cc(
     float pfa,
     int32_t length,
     int32_t n_segments_est,
-    int32_t n_segments_reset);
+    int32_t n_segments_reset,
+    bool per_sample = false);
+
+/*!
+ * \brief Streaming quantile estimator (Jain & Chlamtac P-square algorithm)
+ *
+ * Tracks a single quantile of a data stream with five markers, O(1) time and
+ * memory per update, without keeping a sample window
+ */
+class P2QuantileEstimator
+{
+public:
+    explicit P2QuantileEstimator(float quantile);
+    void update(float x);
+    float value() const;
+    bool valid() const;
+
+private:
+    float p_;       // target quantile
+    float q_[5];    // marker heights
+    float np_[5];   // desired marker positions
+    float dnp_[5];  // desired position increments
+    int32_t n_[5];  // actual marker positions
+    int32_t count_;
+};
 
 class pulse_blanking_cc : public gr::block
 {
@@ -50,9 +74,12 @@ public:
         gr_vector_const_void_star &input_items, gr_vector_void_star &output_items);
 
 private:
-    friend pulse_blanking_cc_sptr make_pulse_blanking_cc(float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
-    pulse_blanking_cc(float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
+    friend pulse_blanking_cc_sptr make_pulse_blanking_cc(float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, bool per_sample);
+    pulse_blanking_cc(float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, bool per_sample);
+    int per_sample_work(int noutput_items, const gr_complex *in, gr_complex *out);
     volk_gnsssdr::vector<gr_complex> zeros_;
+    volk_gnsssdr::vector<float> magnitude_;
+    P2QuantileEstimator median_est_;
     float noise_power_estimation_;
     float thres_;
     float pfa_;
@@ -62,6 +89,7 @@ private:
     int32_t n_segments_reset_;
     int32_t n_deg_fred_;
     bool last_filtered_;
+    bool per_sample_;
 };
 
 
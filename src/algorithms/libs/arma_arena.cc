@@ -0,0 +1,80 @@
+/*!
+ * \file arma_arena.cc
+ * \brief Per-thread bump arena for per-epoch Armadillo working matrices
+ * \author Javier Arribas, 2021. jarribas(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "arma_arena.h"
+#include <algorithm>
+
+namespace
+{
+// 64 KiB of doubles per block: ample for the state dimensions used in
+// tracking and PVT, while keeping a whole epoch's temporaries in one block
+constexpr std::size_t ARENA_BLOCK_ELEMS = 8192;
+}  // namespace
+
+
+Arma_Arena& Arma_Arena::get_thread_instance()
+{
+    thread_local Arma_Arena instance;
+    return instance;
+}
+
+
+double* Arma_Arena::allocate(std::size_t n_elem)
+{
+    while (d_block_index < d_blocks.size())
+        {
+            Block& block = d_blocks[d_block_index];
+            if (d_offset + n_elem <= block.size)
+                {
+                    double* ptr = block.data.get() + d_offset;
+                    d_offset += n_elem;
+                    return ptr;
+                }
+            d_block_index++;
+            d_offset = 0;
+        }
+    // no existing block fits: append one (oversized requests get a dedicated block)
+    const std::size_t block_size = std::max(n_elem, ARENA_BLOCK_ELEMS);
+    d_blocks.push_back(Block{std::unique_ptr<double[]>(new double[block_size]), block_size});
+    d_block_index = d_blocks.size() - 1;
+    d_offset = n_elem;
+    return d_blocks.back().data.get();
+}
+
+
+arma::mat Arma_Arena::mat(arma::uword n_rows, arma::uword n_cols)
+{
+    return arma::mat(allocate(static_cast<std::size_t>(n_rows) * n_cols), n_rows, n_cols, false, true);
+}
+
+
+arma::vec Arma_Arena::vec(arma::uword n_elem)
+{
+    return arma::vec(allocate(n_elem), n_elem, false, true);
+}
+
+
+Arma_Arena::Mark Arma_Arena::mark() const
+{
+    return Mark{d_block_index, d_offset};
+}
+
+
+void Arma_Arena::release(const Mark& m)
+{
+    d_block_index = m.block;
+    d_offset = m.offset;
+}
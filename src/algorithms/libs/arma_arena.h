@@ -0,0 +1,118 @@
+/*!
+ * \file arma_arena.h
+ * \brief Per-thread bump arena for per-epoch Armadillo working matrices
+ * \author Javier Arribas, 2021. jarribas(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ARMA_ARENA_H
+#define GNSS_SDR_ARMA_ARENA_H
+
+#include <armadillo>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+/*!
+ * \brief Per-thread bump allocator handing out auxiliary memory for
+ * Armadillo matrices.
+ *
+ * Blocks that allocate fresh arma::mat / arma::vec working objects on every
+ * epoch hammer the global allocator from all channel threads at once. This
+ * arena hands out chunks of thread-local memory with a simple bump pointer,
+ * and the matrices are built over it with Armadillo's auxiliary-memory
+ * constructor (strict, so they can never be resized onto the heap). Memory is
+ * reclaimed in stack order through Arma_Arena_Scope; matrices obtained inside
+ * a scope must not outlive it.
+ */
+class Arma_Arena
+{
+public:
+    //! Arena of the calling thread (created on first use)
+    static Arma_Arena& get_thread_instance();
+
+    //! Uninitialized n_rows x n_cols matrix over arena memory (call .zeros() if needed)
+    arma::mat mat(arma::uword n_rows, arma::uword n_cols);
+
+    //! Uninitialized column vector over arena memory
+    arma::vec vec(arma::uword n_elem);
+
+private:
+    friend class Arma_Arena_Scope;
+
+    struct Mark
+    {
+        std::size_t block{0};
+        std::size_t offset{0};
+    };
+
+    Arma_Arena() = default;
+    double* allocate(std::size_t n_elem);
+    Mark mark() const;
+    void release(const Mark& m);
+
+    struct Block
+    {
+        std::unique_ptr<double[]> data;
+        std::size_t size{0};
+    };
+
+    std::vector<Block> d_blocks;
+    std::size_t d_block_index{0};
+    std::size_t d_offset{0};
+};
+
+
+/*!
+ * \brief RAII scope that rewinds the calling thread's arena on destruction.
+ *
+ * Declare one at the top of a per-epoch function and draw the function's
+ * working matrices from it; everything is handed back when it goes out of
+ * scope. Scopes nest in stack order.
+ */
+class Arma_Arena_Scope
+{
+public:
+    Arma_Arena_Scope()
+        : d_arena(Arma_Arena::get_thread_instance()),
+          d_mark(d_arena.mark())
+    {
+    }
+
+    ~Arma_Arena_Scope()
+    {
+        d_arena.release(d_mark);
+    }
+
+    Arma_Arena_Scope(const Arma_Arena_Scope&) = delete;
+    Arma_Arena_Scope& operator=(const Arma_Arena_Scope&) = delete;
+    Arma_Arena_Scope(Arma_Arena_Scope&&) = delete;
+    Arma_Arena_Scope& operator=(Arma_Arena_Scope&&) = delete;
+
+    arma::mat mat(arma::uword n_rows, arma::uword n_cols) { return d_arena.mat(n_rows, n_cols); }
+    arma::vec vec(arma::uword n_elem) { return d_arena.vec(n_elem); }
+
+private:
+    Arma_Arena& d_arena;
+    Arma_Arena::Mark d_mark;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_ARMA_ARENA_H
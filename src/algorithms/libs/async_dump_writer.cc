@@ -0,0 +1,185 @@
+/*!
+ * \file async_dump_writer.cc
+ * \brief Implementation of a process-wide asynchronous writer shared by the
+ * binary dump facilities of the processing blocks
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "async_dump_writer.h"
+#include <glog/logging.h>
+#include <utility>
+
+
+Async_Dump_Writer& Async_Dump_Writer::get_instance()
+{
+    static Async_Dump_Writer instance;
+    return instance;
+}
+
+
+Async_Dump_Writer::~Async_Dump_Writer()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (writer_thread_.joinable())
+        {
+            writer_thread_.join();
+        }
+}
+
+
+void Async_Dump_Writer::start_writer_thread()
+{
+    // caller holds mutex_
+    if (!running_)
+        {
+            running_ = true;
+            writer_thread_ = std::thread(&Async_Dump_Writer::writer_loop, this);
+        }
+}
+
+
+int Async_Dump_Writer::open_stream(const std::string& filename)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    start_writer_thread();
+    const int stream_id = next_stream_id_++;
+    Record record;
+    record.op = Op::open;
+    record.stream_id = stream_id;
+    record.filename = filename;
+    queue_.push_back(std::move(record));
+    open_streams_.insert(stream_id);
+    stream_bytes_[stream_id] = 0ULL;
+    cv_.notify_one();
+    return stream_id;
+}
+
+
+bool Async_Dump_Writer::write(int stream_id, const void* data, std::size_t size)
+{
+    if (stream_id < 0 || size == 0)
+        {
+            return false;
+        }
+    if (queued_bytes_.load() + size > max_queued_bytes)
+        {
+            dropped_records_++;
+            return false;
+        }
+    Record record;
+    record.stream_id = stream_id;
+    const auto* bytes = static_cast<const char*>(data);
+    record.payload.assign(bytes, bytes + size);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (open_streams_.count(stream_id) == 0)
+            {
+                return false;
+            }
+        queue_.push_back(std::move(record));
+        stream_bytes_[stream_id] += size;
+    }
+    queued_bytes_ += size;
+    cv_.notify_one();
+    return true;
+}
+
+
+uint64_t Async_Dump_Writer::close_stream(int stream_id)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (open_streams_.count(stream_id) == 0)
+        {
+            return 0ULL;
+        }
+    Record record;
+    record.op = Op::close;
+    record.stream_id = stream_id;
+    queue_.push_back(std::move(record));
+    cv_.notify_one();
+    closed_cv_.wait(lock, [this, stream_id] { return open_streams_.count(stream_id) == 0; });
+    return stream_bytes_[stream_id];
+}
+
+
+uint64_t Async_Dump_Writer::dropped_records() const
+{
+    return dropped_records_.load();
+}
+
+
+void Async_Dump_Writer::writer_loop()
+{
+    while (true)
+        {
+            std::deque<Record> batch;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return !running_ || !queue_.empty(); });
+                if (queue_.empty() && !running_)
+                    {
+                        return;
+                    }
+                batch.swap(queue_);
+            }
+            for (auto& record : batch)
+                {
+                    switch (record.op)
+                        {
+                        case Op::open:
+                            {
+                                std::ofstream file;
+                                file.open(record.filename.c_str(), std::ios::out | std::ios::binary);
+                                if (!file.is_open())
+                                    {
+                                        LOG(WARNING) << "Async dump writer could not open " << record.filename;
+                                    }
+                                std::lock_guard<std::mutex> lock(mutex_);
+                                streams_[record.stream_id] = std::move(file);
+                                break;
+                            }
+                        case Op::data:
+                            {
+                                const auto stream_it = streams_.find(record.stream_id);
+                                if (stream_it != streams_.end() && stream_it->second.is_open())
+                                    {
+                                        stream_it->second.write(record.payload.data(), static_cast<std::streamsize>(record.payload.size()));
+                                    }
+                                queued_bytes_ -= record.payload.size();
+                                break;
+                            }
+                        case Op::close:
+                            {
+                                const auto stream_it = streams_.find(record.stream_id);
+                                if (stream_it != streams_.end())
+                                    {
+                                        if (stream_it->second.is_open())
+                                            {
+                                                stream_it->second.flush();
+                                                stream_it->second.close();
+                                            }
+                                    }
+                                std::lock_guard<std::mutex> lock(mutex_);
+                                streams_.erase(record.stream_id);
+                                open_streams_.erase(record.stream_id);
+                                closed_cv_.notify_all();
+                                break;
+                            }
+                        }
+                }
+        }
+}
@@ -0,0 +1,117 @@
+/*!
+ * \file async_dump_writer.h
+ * \brief Interface of a process-wide asynchronous writer shared by the
+ * binary dump facilities of the processing blocks
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ASYNC_DUMP_WRITER_H
+#define GNSS_SDR_ASYNC_DUMP_WRITER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+/*!
+ * \brief Process-wide asynchronous writer for the binary dumps of the
+ * processing blocks.
+ *
+ * Blocks that dump their internal variables (tracking, observables, PVT)
+ * used to write synchronously in the signal path, so enabling dumps for
+ * debugging changed the timing of the receiver under study. Producers now
+ * enqueue one self-contained record per epoch here and return immediately;
+ * a single writer thread drains the queue and performs the buffered file
+ * writes. Records are dropped (and counted) instead of blocking the signal
+ * path when the queue exceeds its byte budget.
+ *
+ * close_stream() blocks until every record of the stream is on disk and
+ * the file is closed, so the .mat conversions that re-read the dumps at
+ * block destruction see complete files.
+ */
+class Async_Dump_Writer
+{
+public:
+    static Async_Dump_Writer& get_instance();
+
+    //! Opens a stream writing to the given file (truncating it) and
+    //! returns its handle, or -1 if the file cannot be opened
+    int open_stream(const std::string& filename);
+
+    //! Enqueues a copy of one record for the stream. Returns false when
+    //! the record is dropped because the queue budget is exceeded
+    bool write(int stream_id, const void* data, std::size_t size);
+
+    //! Flushes and closes the stream, blocking until its records are on
+    //! disk. Returns the number of bytes written to the file
+    uint64_t close_stream(int stream_id);
+
+    //! Number of records dropped so far because of backpressure
+    uint64_t dropped_records() const;
+
+private:
+    Async_Dump_Writer() = default;
+    ~Async_Dump_Writer();
+
+    enum class Op : uint8_t
+    {
+        data,
+        open,
+        close
+    };
+
+    struct Record
+    {
+        std::vector<char> payload;
+        std::string filename;
+        int stream_id{-1};
+        Op op{Op::data};
+    };
+
+    void writer_loop();
+    void start_writer_thread();
+
+    // drop records instead of blocking the signal path above this budget
+    static const std::size_t max_queued_bytes = 64UL * 1024UL * 1024UL;
+
+    std::map<int, std::ofstream> streams_;      // touched by the writer thread; map mutations under mutex_
+    std::map<int, uint64_t> stream_bytes_;      // bytes accepted per stream, guarded by mutex_
+    std::set<int> open_streams_;                // guarded by mutex_
+    std::deque<Record> queue_;                  // guarded by mutex_
+    std::thread writer_thread_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable closed_cv_;
+    std::atomic<std::size_t> queued_bytes_{0};
+    std::atomic<uint64_t> dropped_records_{0ULL};
+    int next_stream_id_{0};
+    bool running_{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_ASYNC_DUMP_WRITER_H
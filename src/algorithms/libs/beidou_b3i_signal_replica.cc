@@ -17,6 +17,7 @@
  */
 
 #include "beidou_b3i_signal_replica.h"
+#include "gnss_code_library.h"
 #include <array>
 #include <bitset>
 #include <string>
@@ -195,6 +196,13 @@ void beidou_b3i_code_gen_complex(own::span<std::complex<float>> dest, int32_t pr
 
 void beidou_b3i_code_gen_complex_sampled(own::span<std::complex<float>> dest, uint32_t prn, int sampling_freq, uint32_t chip_shift)
 {
+    auto& code_library = Gnss_Code_Library::get_instance();
+    const std::string cache_key = Gnss_Code_Library::make_key("B3I", prn, sampling_freq, chip_shift, dest.size());
+    if (code_library.copy_if_cached(cache_key, dest))
+        {
+            return;
+        }
+
     constexpr int32_t codeFreqBasis = 10230000;  // chips per second
     constexpr int32_t codeLength = 10230;
     constexpr float tc = 1.0 / static_cast<float>(codeFreqBasis);  // B3I chip period in sec
@@ -234,4 +242,6 @@ void beidou_b3i_code_gen_complex_sampled(own::span<std::complex<float>> dest, ui
                     dest[i] = code_aux[codeValueIndex];  // repeat the chip -> upsample
                 }
         }
+
+    code_library.store(cache_key, dest);
 }
@@ -0,0 +1,102 @@
+/*!
+ * \file columnar_dump_writer.h
+ * \brief Interface of a chunked columnar dump format for per-epoch,
+ * per-channel double records
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_COLUMNAR_DUMP_WRITER_H
+#define GNSS_SDR_COLUMNAR_DUMP_WRITER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+/*!
+ * \brief Chunked columnar dump of per-epoch, per-channel double records.
+ *
+ * The legacy .dat dumps interleave every field of every channel per epoch,
+ * so reading one field over a long run means touching the whole file. This
+ * writer stages a configurable number of epochs in memory and flushes them
+ * as one chunk in which each field occupies a contiguous block, so a
+ * single-field scan reads only 1/num_fields of the data, sequentially. A
+ * footer indexes every chunk by file offset and first/last time of week,
+ * allowing readers to seek straight to a time window. All file output goes
+ * through the shared Async_Dump_Writer, off the signal path.
+ *
+ * File layout (native endianness, like the rest of the binary dumps):
+ *   header : magic "GNSSOBSC", version, num_fields, num_channels,
+ *            epochs_per_chunk (uint32_t each)
+ *   chunks : num_fields blocks of num_epochs x num_channels doubles,
+ *            epoch-major inside each block
+ *   footer : per chunk {offset u64, num_epochs u32, codec u32,
+ *            first_tow_s f64, last_tow_s f64}, then a trailer
+ *            {footer offset u64, num_chunks u64, magic} closing the file
+ *
+ * The codec field is 0 (raw) for every chunk; it is kept in the index so a
+ * compressed variant can be added without a format break.
+ */
+class Columnar_Dump_Writer
+{
+public:
+    Columnar_Dump_Writer() = default;
+    ~Columnar_Dump_Writer();
+
+    //! Opens the output file (truncating it) and writes the header.
+    //! Returns false if the file cannot be opened
+    bool open(const std::string& filename, uint32_t num_fields, uint32_t num_channels, uint32_t epochs_per_chunk = 1024U);
+
+    //! Appends one epoch. values holds num_channels x num_fields doubles,
+    //! channel-major with the field index running fastest (the layout the
+    //! producers already build for the legacy dump record)
+    void append_epoch(const double* values, double tow_s);
+
+    //! Flushes the pending chunk, writes the footer and closes the file.
+    //! Returns the number of bytes accepted for writing
+    uint64_t close();
+
+private:
+    struct Chunk_Index_Entry
+    {
+        uint64_t offset;
+        uint32_t num_epochs;
+        uint32_t codec;
+        double first_tow_s;
+        double last_tow_s;
+    };
+
+    void flush_chunk();
+
+    std::vector<std::vector<double>> columns_;  // one staging buffer per field
+    std::vector<Chunk_Index_Entry> index_;
+    std::string filename_;
+    uint64_t file_offset_{0};
+    uint32_t num_fields_{0};
+    uint32_t num_channels_{0};
+    uint32_t epochs_per_chunk_{0};
+    uint32_t epochs_in_chunk_{0};
+    double first_tow_s_{0.0};
+    double last_tow_s_{0.0};
+    int stream_id_{-1};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_COLUMNAR_DUMP_WRITER_H
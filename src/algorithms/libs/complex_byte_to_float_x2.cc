@@ -18,7 +18,7 @@
 
 #include "complex_byte_to_float_x2.h"
 #include <gnuradio/io_signature.h>
-#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
 #include <algorithm>  // for max
 
 
@@ -32,7 +32,7 @@ complex_byte_to_float_x2::complex_byte_to_float_x2() : sync_block("complex_byte_
                                                            gr::io_signature::make(1, 1, sizeof(lv_8sc_t)),  // lv_8sc_t is a Volk's typedef for std::complex<signed char>
                                                            gr::io_signature::make(2, 2, sizeof(float)))
 {
-    const auto alignment_multiple = static_cast<int>(volk_get_alignment() / sizeof(float));
+    const auto alignment_multiple = static_cast<int>(volk_gnsssdr_get_alignment() / sizeof(float));
     set_alignment(std::max(1, alignment_multiple));
 }
 
@@ -45,6 +45,6 @@ int complex_byte_to_float_x2::work(int noutput_items,
     auto *out0 = reinterpret_cast<float *>(output_items[0]);
     auto *out1 = reinterpret_cast<float *>(output_items[1]);
     const float scalar = 1;
-    volk_8ic_s32f_deinterleave_32f_x2(out0, out1, in, scalar, noutput_items);
+    volk_gnsssdr_8ic_s32f_deinterleave_32f_x2(out0, out1, in, scalar, noutput_items);
     return noutput_items;
 }
@@ -18,7 +18,7 @@
 
 #include "cshort_to_float_x2.h"
 #include <gnuradio/io_signature.h>
-#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
 #include <algorithm>  // for max
 
 
@@ -32,7 +32,7 @@ cshort_to_float_x2::cshort_to_float_x2() : sync_block("cshort_to_float_x2",
                                                gr::io_signature::make(1, 1, sizeof(lv_16sc_t)),  // lv_8sc_t is a Volk's typedef for std::complex<signed char>
                                                gr::io_signature::make(2, 2, sizeof(float)))
 {
-    const auto alignment_multiple = static_cast<int>(volk_get_alignment() / sizeof(lv_16sc_t));
+    const auto alignment_multiple = static_cast<int>(volk_gnsssdr_get_alignment() / sizeof(lv_16sc_t));
     set_alignment(std::max(1, alignment_multiple));
 }
 
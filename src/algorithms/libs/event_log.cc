@@ -0,0 +1,186 @@
+/*!
+ * \file event_log.cc
+ * \brief Implementation of a process-wide binary event log with nanosecond
+ * timestamps for the hot-path events of the receiver
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "event_log.h"
+#include <glog/logging.h>
+#include <chrono>
+#include <utility>
+
+namespace
+{
+// hand the thread batch to the flusher at this size or age, so rare
+// events do not sit in an idle thread buffer for long
+constexpr std::size_t thread_buffer_records = 64;
+constexpr uint64_t thread_buffer_max_age_ns = 100000000ULL;  // 100 ms
+
+// drop events instead of blocking the signal path above this budget
+constexpr std::size_t max_queued_records = 1048576;  // 32 MiB
+
+uint64_t steady_now_ns()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+}  // namespace
+
+
+Event_Log& Event_Log::get_instance()
+{
+    static Event_Log instance;
+    return instance;
+}
+
+
+Event_Log::Thread_Buffer::~Thread_Buffer()
+{
+    Event_Log::get_instance().push(std::move(records));
+}
+
+
+void Event_Log::enable(const std::string& filename)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_)
+        {
+            return;
+        }
+    file_.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file_.is_open())
+        {
+            LOG(WARNING) << "Could not open event log file " << filename << ". Event logging disabled";
+            return;
+        }
+    const char magic[8] = {'G', 'N', 'S', 'S', 'E', 'V', 'T', '1'};
+    const auto wall_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+                                                   .count());
+    const uint64_t steady_ns = steady_now_ns();
+    file_.write(magic, sizeof(magic));
+    file_.write(reinterpret_cast<const char*>(&wall_ns), sizeof(wall_ns));
+    file_.write(reinterpret_cast<const char*>(&steady_ns), sizeof(steady_ns));
+    running_ = true;
+    flusher_thread_ = std::thread(&Event_Log::flusher_loop, this);
+    enabled_.store(true, std::memory_order_release);
+    LOG(INFO) << "Binary event log enabled, writing to " << filename;
+}
+
+
+void Event_Log::record(Event event, uint32_t channel, uint32_t prn, double value_a, double value_b)
+{
+    if (!enabled())
+        {
+            return;
+        }
+    thread_local Thread_Buffer buffer;
+    Record rec{};
+    rec.timestamp_ns = steady_now_ns();
+    rec.event_id = static_cast<uint32_t>(event);
+    rec.channel = static_cast<uint16_t>(channel);
+    rec.prn = static_cast<uint16_t>(prn);
+    rec.value_a = value_a;
+    rec.value_b = value_b;
+    if (buffer.records.empty())
+        {
+            buffer.records.reserve(thread_buffer_records);
+            buffer.first_timestamp_ns = rec.timestamp_ns;
+        }
+    buffer.records.push_back(rec);
+    if ((buffer.records.size() >= thread_buffer_records) or
+        ((rec.timestamp_ns - buffer.first_timestamp_ns) > thread_buffer_max_age_ns))
+        {
+            push(std::move(buffer.records));
+            buffer.records.clear();  // leave the moved-from vector in a known state
+        }
+}
+
+
+void Event_Log::push(std::vector<Record>&& records)
+{
+    if (records.empty())
+        {
+            return;
+        }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_ or (queued_records_ + records.size() > max_queued_records))
+            {
+                dropped_events_ += records.size();
+                return;
+            }
+        queued_records_ += records.size();
+        queue_.push_back(std::move(records));
+    }
+    cv_.notify_one();
+}
+
+
+void Event_Log::flusher_loop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_ or !queue_.empty())
+        {
+            if (queue_.empty())
+                {
+                    // nothing in flight: surface the tail, so the file can be
+                    // decoded while the receiver is still running
+                    file_.flush();
+                    cv_.wait(lock, [this] { return !queue_.empty() or !running_; });
+                    continue;
+                }
+            std::vector<Record> batch = std::move(queue_.front());
+            queue_.pop_front();
+            lock.unlock();
+            file_.write(reinterpret_cast<const char*>(batch.data()), static_cast<std::streamsize>(batch.size() * sizeof(Record)));
+            lock.lock();
+            // decremented only once the batch is written, so observing
+            // queued_records_ == 0 under the mutex means every record handed
+            // over so far has reached the file
+            queued_records_ -= batch.size();
+        }
+    file_.flush();
+    file_.close();
+}
+
+
+uint64_t Event_Log::dropped_events() const
+{
+    return dropped_events_.load();
+}
+
+
+Event_Log::~Event_Log()
+{
+    enabled_.store(false);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_)
+            {
+                return;
+            }
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (flusher_thread_.joinable())
+        {
+            flusher_thread_.join();
+        }
+    if (dropped_events_.load() > 0ULL)
+        {
+            LOG(INFO) << "Event log dropped " << dropped_events_.load() << " events due to backpressure";
+        }
+}
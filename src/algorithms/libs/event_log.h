@@ -0,0 +1,131 @@
+/*!
+ * \file event_log.h
+ * \brief Interface of a process-wide binary event log with nanosecond
+ * timestamps for the hot-path events of the receiver
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_EVENT_LOG_H
+#define GNSS_SDR_EVENT_LOG_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+/*!
+ * \brief Process-wide binary log for hot-path events.
+ *
+ * Text logging of per-event lines (acquisition results, channel FSM
+ * transitions, loss of lock) formats the message and takes the logging
+ * sink mutex in the signal path, so during reacquisition storms the
+ * logging itself perturbs the timing under study. When enabled
+ * (GNSS-SDR.event_log_filename), hot-path call sites append one
+ * fixed-size binary record instead: records are buffered per thread and
+ * handed in batches to a background flusher, so the cost per event is a
+ * timestamp read and a 32-byte copy. Text logs remain in use for
+ * control-plane messages.
+ *
+ * File format: an 8-byte magic ("GNSSEVT1"), the wall-clock and
+ * monotonic-clock times at enable time (two uint64 nanosecond counts,
+ * allowing the decoder to map monotonic stamps to wall time), then a
+ * stream of Event_Log::Record. All fields are native-endian. The log can
+ * be inspected with src/utils/scripts/decode_event_log.py.
+ */
+class Event_Log
+{
+public:
+    //! Event identifiers stored in Record::event_id
+    enum class Event : uint32_t
+    {
+        acquisition_positive = 1,  //!< value_a: test statistic, value_b: Doppler [Hz]
+        acquisition_negative = 2,  //!< value_a: test statistic, value_b: Doppler [Hz]
+        loss_of_lock = 3,          //!< value_a: C/N0 [dB-Hz], value_b: carrier lock test
+        fsm_start_acquisition = 4,
+        fsm_valid_acquisition = 5,
+        fsm_failed_acquisition = 6,
+        fsm_failed_tracking = 7,
+        fsm_stop_channel = 8
+    };
+
+    //! Fixed-size (32-byte) event record
+    struct Record
+    {
+        uint64_t timestamp_ns;  //!< monotonic clock, nanoseconds
+        uint32_t event_id;
+        uint16_t channel;
+        uint16_t prn;
+        double value_a;
+        double value_b;
+    };
+
+    static Event_Log& get_instance();
+
+    //! Opens the log file, writes its header and starts the flusher
+    //! thread. Call once from the control plane before the flowgraph runs
+    void enable(const std::string& filename);
+
+    //! True once enable() has succeeded. Cheap enough for hot-path gating
+    inline bool enabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    //! Appends one event. A no-op until enable() is called
+    void record(Event event, uint32_t channel, uint32_t prn = 0U, double value_a = 0.0, double value_b = 0.0);
+
+    //! Number of events dropped so far because of backpressure
+    uint64_t dropped_events() const;
+
+private:
+    friend class EventLogTest;  // waits for the queue to drain and flushes the file in the unit test
+    Event_Log() = default;
+    ~Event_Log();
+
+    // per-thread batch, flushed on size, age, or thread exit
+    struct Thread_Buffer
+    {
+        ~Thread_Buffer();
+        std::vector<Record> records;
+        uint64_t first_timestamp_ns{0ULL};
+    };
+
+    void push(std::vector<Record>&& records);
+    void flusher_loop();
+
+    std::deque<std::vector<Record>> queue_;  // guarded by mutex_
+    std::ofstream file_;                     // touched by the flusher thread only, after enable()
+    std::thread flusher_thread_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::atomic<bool> enabled_{false};
+    std::atomic<uint64_t> dropped_events_{0ULL};
+    std::size_t queued_records_{0};  // guarded by mutex_
+    bool running_{false};            // guarded by mutex_
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_EVENT_LOG_H
@@ -18,6 +18,7 @@
 
 #include "galileo_e1_signal_replica.h"
 #include "Galileo_E1.h"
+#include "gnss_code_library.h"
 #include "gnss_signal_replica.h"
 #include <cmath>
 #include <cstddef>  // for size_t
@@ -108,6 +109,32 @@ void galileo_e1_code_gen_sinboc11_float(own::span<float> dest, const std::array<
 }
 
 
+void galileo_e1_code_gen_cboc_components_float(own::span<float> dest_boc11, own::span<float> dest_boc61, const std::array<char, 3>& signal_id, uint32_t prn)
+{
+    const auto codeLength = dest_boc11.size();
+    const std::string galileo_signal = signal_id.data();
+    // E1-B adds its BOC(6,1) component, E1-C subtracts it (Galileo ICD);
+    // the sign is folded into the component so the caller can always
+    // combine with positive weights
+    const float boc61_sign = (galileo_signal.rfind("1C") != std::string::npos && galileo_signal.length() >= 2) ? -1.0F : 1.0F;
+
+    std::array<int32_t, 4092> primary_code_E1_chips{};
+    galileo_e1_code_gen_int(primary_code_E1_chips, signal_id, prn);  // generate Galileo E1 code, 1 sample per chip
+
+    std::vector<int32_t> sinboc_11(codeLength);
+    std::vector<int32_t> sinboc_61(codeLength);
+
+    galileo_e1_sinboc_11_gen_int(sinboc_11, primary_code_E1_chips);  // generate sinboc(1,1) 12 samples per chip
+    galileo_e1_sinboc_61_gen_int(sinboc_61, primary_code_E1_chips);  // generate sinboc(6,1) 12 samples per chip
+
+    for (size_t i = 0; i < codeLength; i++)
+        {
+            dest_boc11[i] = static_cast<float>(sinboc_11[i]);
+            dest_boc61[i] = boc61_sign * static_cast<float>(sinboc_61[i]);
+        }
+}
+
+
 void galileo_e1_gen_float(own::span<float> dest, own::span<int> prn, const std::array<char, 3>& signal_id)
 {
     const auto codeLength = dest.size();
@@ -210,6 +237,14 @@ void galileo_e1_code_gen_complex_sampled(own::span<std::complex<float>> dest, co
 {
     constexpr int32_t codeFreqBasis = GALILEO_E1_CODE_CHIP_RATE_CPS;  // Hz
     const std::string galileo_signal = signal_id.data();
+
+    auto& code_library = Gnss_Code_Library::get_instance();
+    const std::string cache_key = Gnss_Code_Library::make_key(galileo_signal + (cboc ? "_cboc" : "_boc") + (secondary_flag ? "_sec" : ""), prn, sampling_freq, chip_shift, dest.size());
+    if (code_library.copy_if_cached(cache_key, dest))
+        {
+            return;
+        }
+
     auto samplesPerCode = static_cast<uint32_t>(static_cast<double>(sampling_freq) /
                                                 (static_cast<double>(codeFreqBasis) / GALILEO_E1_B_CODE_LENGTH_CHIPS));
 
@@ -225,6 +260,8 @@ void galileo_e1_code_gen_complex_sampled(own::span<std::complex<float>> dest, co
         {
             dest[ii] = std::complex<float>(real_code[ii], 0.0F);
         }
+
+    code_library.store(cache_key, dest);
 }
 
 
@@ -42,6 +42,15 @@ namespace own = gsl;
  */
 void galileo_e1_code_gen_sinboc11_float(own::span<float> dest, const std::array<char, 3>& signal_id, uint32_t prn);
 
+/*!
+ * \brief This function generates the two subcarrier components of the Galileo
+ * E1 CBOC(6,1,1/11) modulation at 12 samples per chip: the sinboc(1,1)
+ * component into dest_boc11 and the sinboc(6,1) component into dest_boc61,
+ * with the E1C sign already folded into the latter. Both spans must hold
+ * 12 * 4092 samples.
+ */
+void galileo_e1_code_gen_cboc_components_float(own::span<float> dest_boc11, own::span<float> dest_boc61, const std::array<char, 3>& signal_id, uint32_t prn);
+
 /*!
  * \brief This function generates Galileo E1 code (can select E1B or E1C, cboc or sinboc
  * and the sample frequency sampling_freq).
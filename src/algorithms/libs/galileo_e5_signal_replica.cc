@@ -21,9 +21,11 @@
 #include "galileo_e5_signal_replica.h"
 #include "Galileo_E5a.h"
 #include "Galileo_E5b.h"
+#include "gnss_code_library.h"
 #include "gnss_signal_replica.h"
 #include <gnuradio/gr_complex.h>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -99,6 +101,13 @@ void galileo_e5_a_code_gen_complex_sampled(own::span<std::complex<float>> dest,
     int32_t sampling_freq,
     uint32_t chip_shift)
 {
+    auto& code_library = Gnss_Code_Library::get_instance();
+    const std::string cache_key = Gnss_Code_Library::make_key(std::string("E5a_") + signal_id.data(), prn, sampling_freq, chip_shift, dest.size());
+    if (code_library.copy_if_cached(cache_key, dest))
+        {
+            return;
+        }
+
     constexpr uint32_t codeLength = GALILEO_E5A_CODE_LENGTH_CHIPS;
     constexpr int32_t codeFreqBasis = GALILEO_E5A_CODE_CHIP_RATE_CPS;
 
@@ -119,6 +128,8 @@ void galileo_e5_a_code_gen_complex_sampled(own::span<std::complex<float>> dest,
         {
             dest[(i + delay) % samplesPerCode] = code_aux[i];
         }
+
+    code_library.store(cache_key, dest);
 }
 
 
@@ -193,6 +204,13 @@ void galileo_e5_b_code_gen_complex_sampled(own::span<std::complex<float>> dest,
     int32_t sampling_freq,
     uint32_t chip_shift)
 {
+    auto& code_library = Gnss_Code_Library::get_instance();
+    const std::string cache_key = Gnss_Code_Library::make_key(std::string("E5b_") + signal_id.data(), prn, sampling_freq, chip_shift, dest.size());
+    if (code_library.copy_if_cached(cache_key, dest))
+        {
+            return;
+        }
+
     constexpr uint32_t codeLength = GALILEO_E5B_CODE_LENGTH_CHIPS;
     constexpr int32_t codeFreqBasis = GALILEO_E5B_CODE_CHIP_RATE_CPS;
 
@@ -213,4 +231,6 @@ void galileo_e5_b_code_gen_complex_sampled(own::span<std::complex<float>> dest,
         {
             dest[(i + delay) % samplesPerCode] = code_aux[i];
         }
+
+    code_library.store(cache_key, dest);
 }
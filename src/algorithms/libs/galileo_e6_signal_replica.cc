@@ -19,7 +19,9 @@
 
 #include "galileo_e6_signal_replica.h"
 #include "Galileo_E6.h"
+#include "gnss_code_library.h"
 #include "gnss_signal_replica.h"
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -83,6 +85,13 @@ void galileo_e6_b_code_gen_complex_sampled(own::span<std::complex<float>> dest,
     int32_t sampling_freq,
     uint32_t chip_shift)
 {
+    auto& code_library = Gnss_Code_Library::get_instance();
+    const std::string cache_key = Gnss_Code_Library::make_key("E6B", prn, sampling_freq, chip_shift, dest.size());
+    if (code_library.copy_if_cached(cache_key, dest))
+        {
+            return;
+        }
+
     constexpr uint32_t codeLength = GALILEO_E6_B_CODE_LENGTH_CHIPS;
     constexpr int32_t codeFreqBasis = GALILEO_E6_B_CODE_CHIP_RATE_CPS;
 
@@ -103,6 +112,8 @@ void galileo_e6_b_code_gen_complex_sampled(own::span<std::complex<float>> dest,
         {
             dest[(i + delay) % samplesPerCode] = code_aux[i];
         }
+
+    code_library.store(cache_key, dest);
 }
 
 
@@ -164,6 +175,13 @@ void galileo_e6_c_code_gen_complex_sampled(own::span<std::complex<float>> dest,
     int32_t sampling_freq,
     uint32_t chip_shift)
 {
+    auto& code_library = Gnss_Code_Library::get_instance();
+    const std::string cache_key = Gnss_Code_Library::make_key("E6C", prn, sampling_freq, chip_shift, dest.size());
+    if (code_library.copy_if_cached(cache_key, dest))
+        {
+            return;
+        }
+
     constexpr uint32_t codeLength = GALILEO_E6_C_CODE_LENGTH_CHIPS;
     constexpr int32_t codeFreqBasis = GALILEO_E6_C_CODE_CHIP_RATE_CPS;
 
@@ -184,6 +202,8 @@ void galileo_e6_c_code_gen_complex_sampled(own::span<std::complex<float>> dest,
         {
             dest[(i + delay) % samplesPerCode] = code_aux[i];
         }
+
+    code_library.store(cache_key, dest);
 }
 
 
@@ -364,6 +364,40 @@ arma::vec cart2geo(const arma::vec &XYZ, int elipsoid_selection)
 }
 
 
+void cart2geo_batch(const double *x, const double *y, const double *z, std::size_t num_points,
+    double *latitude_rad, double *longitude_rad, double *height, int elipsoid_selection)
+{
+    const std::array<double, 5> a{6378388.0, 6378160.0, 6378135.0, 6378137.0, 6378137.0};
+    const std::array<double, 5> f{1.0 / 297.0, 1.0 / 298.247, 1.0 / 298.26, 1.0 / 298.257222101, 1.0 / 298.257223563};
+
+    const double f_e = f[elipsoid_selection];
+    const double ex2 = (2.0 - f_e) * f_e / ((1.0 - f_e) * (1.0 - f_e));
+    const double c = a[elipsoid_selection] * sqrt(1.0 + ex2);
+
+    // same fixed-point iteration as cart2geo, but with a fixed iteration
+    // count instead of a convergence test: for terrestrial points the scalar
+    // version reaches its 1e-12 m tolerance in a handful of iterations, and
+    // identical control flow on every point keeps the loop vectorizable
+    const int num_iterations = 8;
+
+    for (std::size_t i = 0; i < num_points; i++)
+        {
+            longitude_rad[i] = atan2(y[i], x[i]);
+            const double rho = sqrt(x[i] * x[i] + y[i] * y[i]);
+            double phi = atan(z[i] / ((rho * (1.0 - (2.0 - f_e)) * f_e)));
+            double h = 0.1;
+            for (int iteration = 0; iteration < num_iterations; iteration++)
+                {
+                    const double N = c / sqrt(1.0 + ex2 * (cos(phi) * cos(phi)));
+                    phi = atan(z[i] / ((rho * (1.0 - (2.0 - f_e) * f_e * N / (N + h)))));
+                    h = rho / cos(phi) - N;
+                }
+            latitude_rad[i] = phi;
+            height[i] = h;
+        }
+}
+
+
 void ECEF_to_Geo(const arma::vec &r_eb_e, const arma::vec &v_eb_e, const arma::mat &C_b_e, arma::vec &LLH, arma::vec &v_eb_n, arma::mat &C_b_n)
 {
     // Compute the Latitude of the ECEF position
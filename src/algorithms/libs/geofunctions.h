@@ -24,6 +24,7 @@
 #endif
 
 #include <armadillo>
+#include <cstddef>
 
 /** \addtogroup Algorithms_Library
  * \{ */
@@ -91,6 +92,19 @@ arma::vec Gravity_ECEF(const arma::vec &r_eb_e);  //!< Calculates acceleration d
  */
 arma::vec cart2geo(const arma::vec &XYZ, int elipsoid_selection);
 
+/*!
+ * \brief Batched version of cart2geo for arrays of points.
+ *
+ *  Takes the coordinates in structure-of-arrays layout and writes latitude
+ *  and longitude in radians and height in the units of the input. The inner
+ *  loops are branch-free with a fixed iteration count, so the compiler can
+ *  auto-vectorize them (AVX2 / NEON doubles); results match cart2geo to
+ *  within its own convergence tolerance. Intended for bulk conversions such
+ *  as post-processing grids, where calling cart2geo per point dominates.
+ */
+void cart2geo_batch(const double *x, const double *y, const double *z, std::size_t num_points,
+    double *latitude_rad, double *longitude_rad, double *height, int elipsoid_selection);
+
 arma::vec LLH_to_deg(const arma::vec &LLH);
 
 double degtorad(double angleInDegrees);
@@ -17,8 +17,10 @@
  */
 
 #include "glonass_l2_signal_replica.h"
+#include "gnss_code_library.h"
 #include <array>
 #include <bitset>
+#include <string>
 
 const auto AUX_CEIL = [](float x) { return static_cast<int32_t>(static_cast<int64_t>((x) + 1)); };
 
@@ -82,6 +84,13 @@ void glonass_l2_ca_code_gen_complex(own::span<std::complex<float>> dest, uint32_
  */
 void glonass_l2_ca_code_gen_complex_sampled(own::span<std::complex<float>> dest, int32_t sampling_freq, uint32_t chip_shift)
 {
+    auto& code_library = Gnss_Code_Library::get_instance();
+    const std::string cache_key = Gnss_Code_Library::make_key("2G", 0, sampling_freq, chip_shift, dest.size());
+    if (code_library.copy_if_cached(cache_key, dest))
+        {
+            return;
+        }
+
     constexpr int32_t codeFreqBasis = 511000;  // chips per second
     constexpr int32_t codeLength = 511;
     constexpr float tc = 1.0 / static_cast<float>(codeFreqBasis);  // C/A chip period in sec
@@ -120,4 +129,6 @@ void glonass_l2_ca_code_gen_complex_sampled(own::span<std::complex<float>> dest,
                     dest[i] = code_aux[codeValueIndex];  // repeat the chip -> upsample
                 }
         }
+
+    code_library.store(cache_key, dest);
 }
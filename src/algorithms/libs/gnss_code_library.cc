@@ -0,0 +1,162 @@
+/*!
+ * \file gnss_code_library.cc
+ * \brief Process-wide cache of sampled GNSS code replicas
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_code_library.h"
+#include <algorithm>
+#include <array>
+#include <utility>
+
+
+namespace
+{
+// Expansion table for the packed representation: one byte holds four samples
+// at two bits each (bit 0: real sign, bit 1: imaginary sign, set = negative),
+// so a whole cache line of replica is rebuilt with four table copies. Two
+// tables cover the two sample alphabets: {+/-1, +/-1j} for the complex codes
+// (E5/E5b AltBOC sidebands) and {+/-1} for the real-valued ones
+using lut_entry = std::array<std::complex<float>, 4>;
+
+std::array<lut_entry, 256> make_unpack_lut(bool imag_is_zero)
+{
+    std::array<lut_entry, 256> lut{};
+    for (int byte = 0; byte < 256; byte++)
+        {
+            for (int sample = 0; sample < 4; sample++)
+                {
+                    const float re = ((byte >> (2 * sample)) & 0x01) != 0 ? -1.0F : 1.0F;
+                    const float im = imag_is_zero ? 0.0F : (((byte >> (2 * sample + 1)) & 0x01) != 0 ? -1.0F : 1.0F);
+                    lut[byte][sample] = std::complex<float>(re, im);
+                }
+        }
+    return lut;
+}
+}  // namespace
+
+
+Gnss_Code_Library& Gnss_Code_Library::get_instance()
+{
+    static Gnss_Code_Library instance;
+    return instance;
+}
+
+
+std::string Gnss_Code_Library::make_key(const std::string& signal, uint32_t prn,
+    int32_t sampling_freq, uint32_t chip_shift, std::size_t num_samples)
+{
+    return signal + '_' + std::to_string(prn) + '_' + std::to_string(sampling_freq) + '_' + std::to_string(chip_shift) + '_' + std::to_string(num_samples);
+}
+
+
+bool Gnss_Code_Library::try_pack(own::span<const std::complex<float>> code, Packed_Code& packed)
+{
+    // Only unit-valued samples can be packed exactly. The sampled generators
+    // emit the chip values themselves (nearest-neighbour resampling), so
+    // BPSK and AltBOC sideband replicas qualify, while shaped codes such as
+    // E1 CBOC do not and stay in the raw store
+    bool imag_is_zero = true;
+    for (const auto& sample : code)
+        {
+            if (sample.imag() != 0.0F)
+                {
+                    imag_is_zero = false;
+                    break;
+                }
+        }
+    for (const auto& sample : code)
+        {
+            if (sample.real() != 1.0F && sample.real() != -1.0F)
+                {
+                    return false;
+                }
+            if (!imag_is_zero && sample.imag() != 1.0F && sample.imag() != -1.0F)
+                {
+                    return false;
+                }
+        }
+
+    packed.num_samples = code.size();
+    packed.imag_is_zero = imag_is_zero;
+    packed.bits.assign((code.size() + 3) / 4, 0);
+    for (std::size_t i = 0; i < code.size(); i++)
+        {
+            uint8_t sample_bits = code[i].real() < 0.0F ? 0x01 : 0x00;
+            if (!imag_is_zero && code[i].imag() < 0.0F)
+                {
+                    sample_bits |= 0x02;
+                }
+            packed.bits[i / 4] |= static_cast<uint8_t>(sample_bits << (2 * (i % 4)));
+        }
+    return true;
+}
+
+
+void Gnss_Code_Library::unpack(const Packed_Code& packed, own::span<std::complex<float>> dest)
+{
+    static const std::array<lut_entry, 256> complex_lut = make_unpack_lut(false);
+    static const std::array<lut_entry, 256> real_lut = make_unpack_lut(true);
+    const auto& lut = packed.imag_is_zero ? real_lut : complex_lut;
+
+    std::size_t i = 0;
+    for (const std::size_t whole_bytes = packed.num_samples / 4; i < whole_bytes; i++)
+        {
+            const lut_entry& samples = lut[packed.bits[i]];
+            std::copy(samples.begin(), samples.end(), dest.begin() + static_cast<std::ptrdiff_t>(4 * i));
+        }
+    const lut_entry& tail = lut[packed.bits.empty() ? 0 : packed.bits.back()];
+    for (std::size_t j = 4 * i; j < packed.num_samples; j++)
+        {
+            dest[j] = tail[j % 4];
+        }
+}
+
+
+bool Gnss_Code_Library::copy_if_cached(const std::string& key, own::span<std::complex<float>> dest)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto packed_it = packed_codes_.find(key);
+    if (packed_it != packed_codes_.end())
+        {
+            if (packed_it->second.num_samples != static_cast<std::size_t>(dest.size()))
+                {
+                    return false;
+                }
+            unpack(packed_it->second, dest);
+            return true;
+        }
+    const auto it = codes_.find(key);
+    if (it == codes_.end() || it->second.size() != static_cast<std::size_t>(dest.size()))
+        {
+            return false;
+        }
+    std::copy(it->second.begin(), it->second.end(), dest.begin());
+    return true;
+}
+
+
+void Gnss_Code_Library::store(const std::string& key, own::span<const std::complex<float>> code)
+{
+    Packed_Code packed;
+    const bool packable = try_pack(code, packed);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (packable)
+        {
+            packed_codes_[key] = std::move(packed);
+        }
+    else
+        {
+            codes_[key].assign(code.begin(), code.end());
+        }
+}
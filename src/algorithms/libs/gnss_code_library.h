@@ -0,0 +1,96 @@
+/*!
+ * \file gnss_code_library.h
+ * \brief Process-wide cache of sampled GNSS code replicas
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_CODE_LIBRARY_H
+#define GNSS_SDR_GNSS_CODE_LIBRARY_H
+
+#include <complex>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#if HAS_STD_SPAN
+#include <span>
+namespace own = std;
+#else
+#include <gsl/gsl-lite.hpp>
+namespace own = gsl;
+#endif
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+/*!
+ * \brief Process-wide memoized library of sampled code replicas.
+ *
+ * Sampled replica generation (notably the Galileo E5/E6 memory codes) is
+ * deterministic in the PRN, signal, sampling frequency and chip shift, yet
+ * it is redone at every channel construction and every set_local_code call.
+ * The *_code_gen_complex_sampled generators consult this cache first and
+ * store their output on a miss, so 40 channels spinning up only pay for each
+ * distinct replica once and later reacquisitions get it for free.
+ *
+ * Replicas whose samples are unit-valued (the BPSK codes and the E5 AltBOC
+ * sidebands, i.e. everything except shaped codes like E1 CBOC) are kept
+ * bit-packed at two bits per sample and expanded through a byte-indexed
+ * table on copy-out, a 16x memory reduction that keeps even a full
+ * constellation of wideband E5 replicas resident in L2.
+ */
+class Gnss_Code_Library
+{
+public:
+    static Gnss_Code_Library& get_instance();
+
+    //! Builds the cache key for a sampled replica
+    static std::string make_key(const std::string& signal, uint32_t prn,
+        int32_t sampling_freq, uint32_t chip_shift, std::size_t num_samples);
+
+    //! Copies the cached replica into dest. Returns false on a cache miss
+    bool copy_if_cached(const std::string& key, own::span<std::complex<float>> dest);
+
+    //! Stores a freshly generated replica under the given key
+    void store(const std::string& key, own::span<const std::complex<float>> code);
+
+    Gnss_Code_Library(const Gnss_Code_Library&) = delete;
+    Gnss_Code_Library& operator=(const Gnss_Code_Library&) = delete;
+
+private:
+    Gnss_Code_Library() = default;
+
+    // two bits per sample: bit 0 real sign, bit 1 imaginary sign (set = negative)
+    struct Packed_Code
+    {
+        std::vector<uint8_t> bits;
+        std::size_t num_samples = 0;
+        bool imag_is_zero = true;
+    };
+
+    static bool try_pack(own::span<const std::complex<float>> code, Packed_Code& packed);
+    static void unpack(const Packed_Code& packed, own::span<std::complex<float>> dest);
+
+    std::map<std::string, std::vector<std::complex<float>>> codes_;
+    std::map<std::string, Packed_Code> packed_codes_;
+    std::mutex mutex_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_CODE_LIBRARY_H
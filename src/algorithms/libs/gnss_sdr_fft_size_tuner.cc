@@ -0,0 +1,135 @@
+/*!
+ * \file gnss_sdr_fft_size_tuner.cc
+ * \brief Measured-performance selection of padded FFT lengths
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_fft_size_tuner.h"
+#include "gnss_sdr_fft.h"
+#include <glog/logging.h>
+#include <algorithm>  // for sort, unique, fill_n
+#include <chrono>     // for steady_clock
+#include <limits>     // for numeric_limits
+#include <map>        // for map
+#include <mutex>      // for mutex, lock_guard
+#include <vector>     // for vector
+
+namespace
+{
+uint32_t next_power_of_two(uint32_t n)
+{
+    uint32_t pow2 = 1U;
+    while (pow2 < n)
+        {
+            pow2 <<= 1U;
+        }
+    return pow2;
+}
+
+
+// 7-smooth sizes (2^a * 3^b * 5^c * 7^d) in [required_size, bound], plus
+// required_size itself and the bounding power of two
+std::vector<uint32_t> candidate_sizes(uint32_t required_size)
+{
+    const uint64_t bound = next_power_of_two(required_size);
+    std::vector<uint32_t> candidates;
+    candidates.push_back(required_size);
+    for (uint64_t f7 = 1; f7 <= bound; f7 *= 7)
+        {
+            for (uint64_t f5 = f7; f5 <= bound; f5 *= 5)
+                {
+                    for (uint64_t f3 = f5; f3 <= bound; f3 *= 3)
+                        {
+                            uint64_t size = f3;
+                            while (size < required_size)
+                                {
+                                    size *= 2;
+                                }
+                            if (size <= bound)
+                                {
+                                    candidates.push_back(static_cast<uint32_t>(size));
+                                }
+                        }
+                }
+        }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    // bound the startup benchmark cost: keep the smallest candidates (the
+    // least padding) and the bounding power of two
+    const size_t max_candidates = 8;
+    if (candidates.size() > max_candidates)
+        {
+            const uint32_t pow2_bound = candidates.back();
+            candidates.resize(max_candidates - 1);
+            candidates.push_back(pow2_bound);
+        }
+    return candidates;
+}
+
+
+double measure_transform_us(uint32_t fft_size)
+{
+    const int num_iterations = 4;
+    const auto fwd = gnss_fft_fwd_make_unique(fft_size);
+    const auto rev = gnss_fft_rev_make_unique(fft_size);
+    std::fill_n(fwd->get_inbuf(), fft_size, gr_complex(1.0, -1.0));
+    std::fill_n(rev->get_inbuf(), fft_size, gr_complex(1.0, -1.0));
+    // one untimed pass absorbs cache warm-up effects
+    fwd->execute();
+    rev->execute();
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_iterations; i++)
+        {
+            fwd->execute();
+            rev->execute();
+        }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(stop - start).count() / static_cast<double>(num_iterations);
+}
+}  // namespace
+
+
+uint32_t gnss_fft_select_fast_size(uint32_t required_size)
+{
+    if (required_size == 0U)
+        {
+            return 0U;
+        }
+    static std::map<uint32_t, uint32_t> decision_cache;
+    static std::mutex cache_mutex;
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    const auto cached = decision_cache.find(required_size);
+    if (cached != decision_cache.end())
+        {
+            return cached->second;
+        }
+
+    uint32_t best_size = required_size;
+    double best_us = std::numeric_limits<double>::max();
+    for (const auto candidate : candidate_sizes(required_size))
+        {
+            const double elapsed_us = measure_transform_us(candidate);
+            LOG(INFO) << "FFT size tuner: length " << candidate << " measured at "
+                      << elapsed_us << " us per forward+inverse transform";
+            // candidates are sorted, so on a tie the smaller size is kept
+            if (elapsed_us < best_us)
+                {
+                    best_us = elapsed_us;
+                    best_size = candidate;
+                }
+        }
+    LOG(INFO) << "FFT size tuner: selected length " << best_size
+              << " for required length " << required_size;
+    decision_cache[required_size] = best_size;
+    return best_size;
+}
@@ -0,0 +1,51 @@
+/*!
+ * \file gnss_sdr_fft_size_tuner.h
+ * \brief Measured-performance selection of padded FFT lengths
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * The acquisition FFT length derived from the sampling rate and the coherent
+ * integration time can land on sizes with large prime factors, which FFTW
+ * computes much slower than nearby smooth sizes (e.g. a 37500-point
+ * transform vs. a 40960-point one). Since the PCPS correlation already
+ * zero-pads code and input up to the transform length, the length can be
+ * padded to any larger size; this helper benchmarks a short list of smooth
+ * candidate sizes at startup and returns the fastest one.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SDR_FFT_SIZE_TUNER_H
+#define GNSS_SDR_GNSS_SDR_FFT_SIZE_TUNER_H
+
+#include <cstdint>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+/*!
+ * \brief Returns the fastest measured transform length >= required_size.
+ *
+ * Candidates are the required size itself, the 7-smooth sizes
+ * (2^a * 3^b * 5^c * 7^d) up to the next power of two, and the next power of
+ * two. Each candidate is timed with a few forward and inverse transforms;
+ * the measured table is written to the log. Decisions are cached per length
+ * for the lifetime of the process, so every channel sharing a transform
+ * length pays the benchmark only once. Thread-safe.
+ */
+uint32_t gnss_fft_select_fast_size(uint32_t required_size);
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SDR_FFT_SIZE_TUNER_H
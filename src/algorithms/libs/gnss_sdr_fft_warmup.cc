@@ -0,0 +1,41 @@
+/*!
+ * \file gnss_sdr_fft_warmup.cc
+ * \brief Startup warm-up of FFT plans used by acquisition and tracking blocks
+ * \author Carles Fernandez Prades, 2021. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_fft_warmup.h"
+#include "gnss_sdr_fft.h"
+#include <glog/logging.h>
+#include <chrono>
+
+
+void gnss_fft_plan_warmup(const std::vector<uint32_t>& fft_sizes)
+{
+    for (const auto fft_size : fft_sizes)
+        {
+            if (fft_size == 0U)
+                {
+                    continue;
+                }
+            const auto start = std::chrono::steady_clock::now();
+            {
+                const auto fwd = gnss_fft_fwd_make_unique(fft_size);
+                const auto rev = gnss_fft_rev_make_unique(fft_size);
+            }
+            const auto stop = std::chrono::steady_clock::now();
+            const double elapsed_ms = std::chrono::duration<double, std::milli>(stop - start).count();
+            LOG(INFO) << "FFT plan warm-up for length " << fft_size
+                      << " took " << elapsed_ms << " ms";
+        }
+}
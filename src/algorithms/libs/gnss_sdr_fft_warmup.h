@@ -0,0 +1,45 @@
+/*!
+ * \file gnss_sdr_fft_warmup.h
+ * \brief Startup warm-up of FFT plans used by acquisition and tracking blocks
+ * \author Carles Fernandez Prades, 2021. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SDR_FFT_WARMUP_H
+#define GNSS_SDR_GNSS_SDR_FFT_WARMUP_H
+
+#include <cstdint>
+#include <vector>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+/*!
+ * \brief Creates (and immediately releases) forward and inverse FFT plans for
+ * the given transform lengths, so that FFTW planning happens once at receiver
+ * startup instead of on the first acquisition of every channel.
+ *
+ * The underlying GNU Radio FFT wrapper persists FFTW wisdom on disk, so the
+ * first run of a given configuration pays the planning cost here and
+ * subsequent process starts reuse the cached wisdom. The time spent planning
+ * each length is reported in the log, which makes the startup saving
+ * measurable.
+ */
+void gnss_fft_plan_warmup(const std::vector<uint32_t>& fft_sizes);
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SDR_FFT_WARMUP_H
@@ -27,6 +27,8 @@ DEFINE_string(c, "-", "Path to the configuration file (if set, overrides --confi
 DEFINE_string(config_file, std::string(GNSSSDR_INSTALL_DIR "/share/gnss-sdr/conf/default.conf"),
     "Path to the configuration file.");
 
+DEFINE_bool(compiled_config, false, "If set to true, the resolved configuration is cached in a binary snapshot next to the configuration file after the first boot, and reused on later boots while the file is unchanged.");
+
 DEFINE_string(s, "-",
     "If defined, path to the file containing the signal samples (overrides the configuration file and --signal_source).");
 
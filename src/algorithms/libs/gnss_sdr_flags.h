@@ -29,8 +29,9 @@
  * \{ */
 
 
-DECLARE_string(c);            //!< Path to the configuration file.
-DECLARE_string(config_file);  //!< Path to the configuration file.
+DECLARE_string(c);              //!< Path to the configuration file.
+DECLARE_string(config_file);    //!< Path to the configuration file.
+DECLARE_bool(compiled_config);  //!< Cache the parsed configuration in a binary snapshot and reuse it on later boots.
 
 DECLARE_string(log_dir);  //!< Path to the folder in which logging will be stored.
 
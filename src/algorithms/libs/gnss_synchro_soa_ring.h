@@ -0,0 +1,238 @@
+/*!
+ * \file gnss_synchro_soa_ring.h
+ * \brief This class implements a structure-of-arrays ring buffer for the
+ * Gnss_Synchro history kept by the observables block
+ *
+ * It stores the full Gnss_Synchro objects next to flat per-channel arrays
+ * holding the fields read by the observables interpolation (sample counter,
+ * RX time, carrier phase, carrier Doppler and TOW). Sample counters grow
+ * monotonically in push order, so the nearest-element search runs a binary
+ * search over the flat counter array instead of striding across full
+ * structs.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SYNCHRO_SOA_RING_H
+#define GNSS_SDR_GNSS_SYNCHRO_SOA_RING_H
+
+#include "gnss_synchro.h"
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+class Gnss_synchro_soa_ring
+{
+public:
+    Gnss_synchro_soa_ring() = default;                                  //!< Default constructor
+    Gnss_synchro_soa_ring(unsigned int max_size, unsigned int nchann);  //!< nchann = number of channels; max_size = channel capacity
+    unsigned int size(unsigned int ch) const;                           //!< Returns the number of available elements in a channel
+    const Gnss_Synchro& get(unsigned int ch, unsigned int pos) const;   //!< Returns a const reference to an element (pos 0 is the oldest) without bound checking
+    const Gnss_Synchro& front(unsigned int ch) const;                   //!< Returns a const reference to the oldest element in a channel
+    void push_back(unsigned int ch, const Gnss_Synchro& new_data);      //!< Inserts an element at the end of the ring, dropping the oldest one if the channel is full
+    void clear(unsigned int ch);                                        //!< Removes all the elements of a channel (sets size to 0). Capacity is not modified
+
+    double rx_time(unsigned int ch, unsigned int pos) const;              //!< RX_time of an element, read from the flat array
+    double carrier_phase_rads(unsigned int ch, unsigned int pos) const;   //!< Carrier_phase_rads of an element, read from the flat array
+    double carrier_doppler_hz(unsigned int ch, unsigned int pos) const;   //!< Carrier_Doppler_hz of an element, read from the flat array
+    uint32_t tow_at_symbol_ms(unsigned int ch, unsigned int pos) const;   //!< TOW_at_current_symbol_ms of an element, read from the flat array
+    uint64_t sample_counter(unsigned int ch, unsigned int pos) const;     //!< Tracking_sample_counter of an element, read from the flat array
+
+    /*!
+     * \brief Finds the element whose Tracking_sample_counter is closest
+     * to rx_clock.
+     *
+     * Sample counters grow monotonically in push order, so the bracketing
+     * elements are located with a binary search over the logical positions
+     * instead of a full scan, bounding the work at O(log size).
+     *
+     * Returns its position (0 is the oldest element) and writes the absolute
+     * distance in samples to abs_diff, or returns -1 if the channel is empty.
+     */
+    int32_t nearest_sample_counter(unsigned int ch, uint64_t rx_clock, int64_t& abs_diff) const;
+
+private:
+    // one ring per channel: elements are written sequentially through the
+    // physical slots, so the arrays stay contiguous and chronological
+    // neighbors sit in adjacent slots (modulo the capacity)
+    struct Channel_history
+    {
+        std::vector<Gnss_Synchro> data;
+        std::vector<uint64_t> sample_counter;
+        std::vector<double> rx_time;
+        std::vector<double> carrier_phase_rads;
+        std::vector<double> carrier_doppler_hz;
+        std::vector<uint32_t> tow_at_symbol_ms;
+        unsigned int start = 0;  // physical slot of the oldest element
+        unsigned int count = 0;  // number of valid elements
+    };
+
+    unsigned int slot(unsigned int ch, unsigned int pos) const;  // logical position to physical slot
+
+    std::vector<Channel_history> d_history;
+    unsigned int d_max_size = 0;
+};
+
+
+inline Gnss_synchro_soa_ring::Gnss_synchro_soa_ring(unsigned int max_size, unsigned int nchann)
+    : d_max_size(max_size)
+{
+    d_history.resize(nchann);
+    for (auto& ch : d_history)
+        {
+            ch.data.resize(max_size);
+            ch.sample_counter.resize(max_size);
+            ch.rx_time.resize(max_size);
+            ch.carrier_phase_rads.resize(max_size);
+            ch.carrier_doppler_hz.resize(max_size);
+            ch.tow_at_symbol_ms.resize(max_size);
+        }
+}
+
+
+inline unsigned int Gnss_synchro_soa_ring::size(unsigned int ch) const
+{
+    return d_history[ch].count;
+}
+
+
+inline unsigned int Gnss_synchro_soa_ring::slot(unsigned int ch, unsigned int pos) const
+{
+    return (d_history[ch].start + pos) % d_max_size;
+}
+
+
+inline const Gnss_Synchro& Gnss_synchro_soa_ring::get(unsigned int ch, unsigned int pos) const
+{
+    return d_history[ch].data[slot(ch, pos)];
+}
+
+
+inline const Gnss_Synchro& Gnss_synchro_soa_ring::front(unsigned int ch) const
+{
+    return d_history[ch].data[d_history[ch].start];
+}
+
+
+inline void Gnss_synchro_soa_ring::push_back(unsigned int ch, const Gnss_Synchro& new_data)
+{
+    Channel_history& hist = d_history[ch];
+    unsigned int pos;
+    if (hist.count < d_max_size)
+        {
+            pos = (hist.start + hist.count) % d_max_size;
+            hist.count++;
+        }
+    else
+        {
+            pos = hist.start;
+            hist.start = (hist.start + 1) % d_max_size;
+        }
+    hist.data[pos] = new_data;
+    hist.sample_counter[pos] = new_data.Tracking_sample_counter;
+    hist.rx_time[pos] = new_data.RX_time;
+    hist.carrier_phase_rads[pos] = new_data.Carrier_phase_rads;
+    hist.carrier_doppler_hz[pos] = new_data.Carrier_Doppler_hz;
+    hist.tow_at_symbol_ms[pos] = new_data.TOW_at_current_symbol_ms;
+}
+
+
+inline void Gnss_synchro_soa_ring::clear(unsigned int ch)
+{
+    d_history[ch].start = 0;
+    d_history[ch].count = 0;
+}
+
+
+inline double Gnss_synchro_soa_ring::rx_time(unsigned int ch, unsigned int pos) const
+{
+    return d_history[ch].rx_time[slot(ch, pos)];
+}
+
+
+inline double Gnss_synchro_soa_ring::carrier_phase_rads(unsigned int ch, unsigned int pos) const
+{
+    return d_history[ch].carrier_phase_rads[slot(ch, pos)];
+}
+
+
+inline double Gnss_synchro_soa_ring::carrier_doppler_hz(unsigned int ch, unsigned int pos) const
+{
+    return d_history[ch].carrier_doppler_hz[slot(ch, pos)];
+}
+
+
+inline uint32_t Gnss_synchro_soa_ring::tow_at_symbol_ms(unsigned int ch, unsigned int pos) const
+{
+    return d_history[ch].tow_at_symbol_ms[slot(ch, pos)];
+}
+
+
+inline uint64_t Gnss_synchro_soa_ring::sample_counter(unsigned int ch, unsigned int pos) const
+{
+    return d_history[ch].sample_counter[slot(ch, pos)];
+}
+
+
+inline int32_t Gnss_synchro_soa_ring::nearest_sample_counter(unsigned int ch, uint64_t rx_clock, int64_t& abs_diff) const
+{
+    const Channel_history& hist = d_history[ch];
+    abs_diff = std::numeric_limits<int64_t>::max();
+    if (hist.count == 0)
+        {
+            return -1;
+        }
+    // first logical position whose counter is not below rx_clock
+    unsigned int lo = 0;
+    unsigned int hi = hist.count;
+    while (lo < hi)
+        {
+            const unsigned int mid = lo + (hi - lo) / 2;
+            if (hist.sample_counter[slot(ch, mid)] < rx_clock)
+                {
+                    lo = mid + 1;
+                }
+            else
+                {
+                    hi = mid;
+                }
+        }
+    // the nearest element is either that one or its predecessor
+    int32_t nearest_element = -1;
+    if (lo > 0)
+        {
+            const int64_t diff = static_cast<int64_t>(rx_clock) - static_cast<int64_t>(hist.sample_counter[slot(ch, lo - 1)]);
+            abs_diff = diff;
+            nearest_element = static_cast<int32_t>(lo - 1);
+        }
+    if (lo < hist.count)
+        {
+            const int64_t diff = static_cast<int64_t>(hist.sample_counter[slot(ch, lo)]) - static_cast<int64_t>(rx_clock);
+            if (abs_diff > diff)
+                {
+                    abs_diff = diff;
+                    nearest_element = static_cast<int32_t>(lo);
+                }
+        }
+    return nearest_element;
+}
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SYNCHRO_SOA_RING_H
@@ -17,9 +17,11 @@
 
 #include "gps_l2c_signal_replica.h"
 #include "GPS_L2C.h"
+#include "gnss_code_library.h"
 #include <array>
 #include <cmath>
 #include <memory>
+#include <string>
 
 
 uint32_t gps_l2c_m_shift(uint32_t x)
@@ -28,13 +30,41 @@ uint32_t gps_l2c_m_shift(uint32_t x)
 }
 
 
+namespace
+{
+/*
+ * The M-code family is fixed by IS-GPS-200, so the shift register runs once
+ * per process and every later request is a table copy. The table is built
+ * lazily on first use instead of at compile time because a constexpr
+ * evaluation of 50 x 10230 chips exceeds the default constant-evaluation
+ * step limits of some supported compilers
+ */
+const std::array<std::array<int8_t, GPS_L2_M_CODE_LENGTH_CHIPS>, 50>& l2c_m_code_table()
+{
+    static const auto table = []() {
+        std::array<std::array<int8_t, GPS_L2_M_CODE_LENGTH_CHIPS>, 50> chips{};
+        for (uint32_t prn = 1; prn <= 50; prn++)
+            {
+                uint32_t x = GPS_L2C_M_INIT_REG[prn - 1];
+                for (int32_t n = 0; n < GPS_L2_M_CODE_LENGTH_CHIPS; n++)
+                    {
+                        chips[prn - 1][n] = static_cast<int8_t>(x & 1U);
+                        x = gps_l2c_m_shift(x);
+                    }
+            }
+        return chips;
+    }();
+    return table;
+}
+}  // namespace
+
+
 void gps_l2c_m_code(own::span<int32_t> dest, uint32_t prn)
 {
-    uint32_t x = GPS_L2C_M_INIT_REG[prn - 1];
+    const auto& chips = l2c_m_code_table()[prn - 1];
     for (int32_t n = 0; n < GPS_L2_M_CODE_LENGTH_CHIPS; n++)
         {
-            dest[n] = static_cast<int32_t>(x & 1U);
-            x = gps_l2c_m_shift(x);
+            dest[n] = chips[n];
         }
 }
 
@@ -74,6 +104,13 @@ void gps_l2c_m_code_gen_float(own::span<float> dest, uint32_t prn)
  */
 void gps_l2c_m_code_gen_complex_sampled(own::span<std::complex<float>> dest, uint32_t prn, int32_t sampling_freq)
 {
+    auto& code_library = Gnss_Code_Library::get_instance();
+    const std::string cache_key = Gnss_Code_Library::make_key("2S", prn, sampling_freq, 0, dest.size());
+    if (code_library.copy_if_cached(cache_key, dest))
+        {
+            return;
+        }
+
     constexpr int32_t codeLength = GPS_L2_M_CODE_LENGTH_CHIPS;
     constexpr float tc = 1.0F / static_cast<float>(GPS_L2_M_CODE_RATE_CPS);  // L2C chip period in sec
 
@@ -105,4 +142,6 @@ void gps_l2c_m_code_gen_complex_sampled(own::span<std::complex<float>> dest, uin
                     dest[i] = std::complex<float>(0.0, 1.0F - 2.0F * code_aux[codeValueIndex]);  // repeat the chip -> upsample
                 }
         }
+
+    code_library.store(cache_key, dest);
 }
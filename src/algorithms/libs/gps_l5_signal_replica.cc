@@ -17,9 +17,11 @@
 
 #include "gps_l5_signal_replica.h"
 #include "GPS_L5.h"
+#include "gnss_code_library.h"
 #include <array>
 #include <cmath>
 #include <deque>
+#include <string>
 
 std::deque<bool> l5i_xa_shift(const std::deque<bool>& xa)  // GPS-IS-705E Figure 3-4 pp. 15
 {
@@ -192,6 +194,13 @@ void gps_l5i_code_gen_float(own::span<float> dest, uint32_t prn)
  */
 void gps_l5i_code_gen_complex_sampled(own::span<std::complex<float>> dest, uint32_t prn, int32_t sampling_freq)
 {
+    auto& code_library = Gnss_Code_Library::get_instance();
+    const std::string cache_key = Gnss_Code_Library::make_key("L5I", prn, sampling_freq, 0, dest.size());
+    if (code_library.copy_if_cached(cache_key, dest))
+        {
+            return;
+        }
+
     constexpr int32_t codeLength = GPS_L5I_CODE_LENGTH_CHIPS;
     constexpr float tc = 1.0 / static_cast<float>(GPS_L5I_CODE_RATE_CPS);  // L5I primary chip period in sec
 
@@ -223,6 +232,8 @@ void gps_l5i_code_gen_complex_sampled(own::span<std::complex<float>> dest, uint3
                     dest[i] = std::complex<float>(1.0F - 2.0F * code_aux[codeValueIndex], 0.0);  // repeat the chip -> upsample
                 }
         }
+
+    code_library.store(cache_key, dest);
 }
 
 
@@ -261,6 +272,13 @@ void gps_l5q_code_gen_float(own::span<float> dest, uint32_t prn)
  */
 void gps_l5q_code_gen_complex_sampled(own::span<std::complex<float>> dest, uint32_t prn, int32_t sampling_freq)
 {
+    auto& code_library = Gnss_Code_Library::get_instance();
+    const std::string cache_key = Gnss_Code_Library::make_key("L5Q", prn, sampling_freq, 0, dest.size());
+    if (code_library.copy_if_cached(cache_key, dest))
+        {
+            return;
+        }
+
     std::array<int32_t, GPS_L5Q_CODE_LENGTH_CHIPS> code_aux{};
     if (prn > 0 and prn < 51)
         {
@@ -295,4 +313,6 @@ void gps_l5q_code_gen_complex_sampled(own::span<std::complex<float>> dest, uint3
                     dest[i] = std::complex<float>(0.0, 1.0F - 2.0F * code_aux[codeValueIndex]);  // repeat the chip -> upsample
                 }
         }
+
+    code_library.store(cache_key, dest);
 }
@@ -17,58 +17,50 @@
  */
 
 #include "gps_sdr_signal_replica.h"
+#include "gnss_code_library.h"
 #include <array>
-#include <bitset>
+#include <string>
 
 const auto AUX_CEIL = [](float x) { return static_cast<int32_t>(static_cast<int64_t>((x) + 1)); };
 
-void gps_l1_ca_code_gen_int(own::span<int32_t> dest, int32_t prn, uint32_t chip_shift)
+namespace
 {
-    constexpr uint32_t code_length = 1023;
-    std::bitset<code_length> G1{};
-    std::bitset<code_length> G2{};
-    auto G1_register = std::bitset<10>{}.set();  // All true
-    auto G2_register = std::bitset<10>{}.set();  // All true
-    uint32_t lcv;
-    uint32_t lcv2;
-    uint32_t delay;
-    int32_t prn_idx;
-    bool feedback1;
-    bool feedback2;
-    bool aux;
+constexpr uint32_t CA_CODE_LENGTH = 1023;
+
+struct Ca_Code_Table
+{
+    int8_t chips[51][CA_CODE_LENGTH];
+};
+
+/*
+ * Runs the G1/G2 shift registers at compile time. The whole C/A family is
+ * fixed by the ICD, so the chip sequences are baked into the binary and
+ * runtime code generation reduces to a rotated table lookup
+ */
+constexpr Ca_Code_Table generate_ca_code_table()
+{
+    Ca_Code_Table table{};
+    bool G1[CA_CODE_LENGTH] = {};
+    bool G2[CA_CODE_LENGTH] = {};
+    bool G1_register[10] = {true, true, true, true, true, true, true, true, true, true};
+    bool G2_register[10] = {true, true, true, true, true, true, true, true, true, true};
 
     // G2 Delays as defined in GPS-ISD-200D
-    const std::array<int32_t, 51> delays = {5 /*PRN1*/, 6, 7, 8, 17, 18, 139, 140, 141, 251, 252, 254, 255, 256, 257, 258, 469, 470, 471, 472,
+    constexpr int32_t delays[51] = {5 /*PRN1*/, 6, 7, 8, 17, 18, 139, 140, 141, 251, 252, 254, 255, 256, 257, 258, 469, 470, 471, 472,
         473, 474, 509, 512, 513, 514, 515, 516, 859, 860, 861, 862 /*PRN32*/,
         145 /*PRN120*/, 175, 52, 21, 237, 235, 886, 657, 634, 762,
         355, 1012, 176, 603, 130, 359, 595, 68, 386 /*PRN138*/};
 
-    // compute delay array index for given PRN number
-    if (120 <= prn && prn <= 138)
-        {
-            prn_idx = prn - 88;  // SBAS PRNs are at array indices 31 to 50 (offset: -120+33-1 =-88)
-        }
-    else
-        {
-            prn_idx = prn - 1;
-        }
-
-    // A simple error check
-    if ((prn_idx < 0) || (prn_idx > 51))
-        {
-            return;
-        }
-
     // Generate G1 & G2 Register
-    for (lcv = 0; lcv < code_length; lcv++)
+    for (uint32_t lcv = 0; lcv < CA_CODE_LENGTH; lcv++)
         {
             G1[lcv] = G1_register[0];
             G2[lcv] = G2_register[0];
 
-            feedback1 = G1_register[7] xor G1_register[0];
-            feedback2 = G2_register[8] xor G2_register[7] xor G2_register[4] xor G2_register[2] xor G2_register[1] xor G2_register[0];
+            const bool feedback1 = G1_register[7] xor G1_register[0];
+            const bool feedback2 = G2_register[8] xor G2_register[7] xor G2_register[4] xor G2_register[2] xor G2_register[1] xor G2_register[0];
 
-            for (lcv2 = 0; lcv2 < 9; lcv2++)
+            for (uint32_t lcv2 = 0; lcv2 < 9; lcv2++)
                 {
                     G1_register[lcv2] = G1_register[lcv2 + 1];
                     G2_register[lcv2] = G2_register[lcv2 + 1];
@@ -78,25 +70,50 @@ void gps_l1_ca_code_gen_int(own::span<int32_t> dest, int32_t prn, uint32_t chip_
             G2_register[9] = feedback2;
         }
 
-    // Set the delay
-    delay = code_length - delays[prn_idx];
-    delay += chip_shift;
-    delay %= code_length;
-
-    // Generate PRN from G1 and G2 Registers
-    for (lcv = 0; lcv < code_length; lcv++)
+    // Generate each PRN from the G1 and G2 sequences and its G2 delay
+    for (int32_t prn_idx = 0; prn_idx < 51; prn_idx++)
         {
-            aux = G1[(lcv + chip_shift) % code_length] xor G2[delay];
-            if (aux == true)
+            uint32_t delay = CA_CODE_LENGTH - static_cast<uint32_t>(delays[prn_idx]);
+            delay %= CA_CODE_LENGTH;
+            for (uint32_t lcv = 0; lcv < CA_CODE_LENGTH; lcv++)
                 {
-                    dest[lcv] = 1;
+                    table.chips[prn_idx][lcv] = (G1[lcv] xor G2[delay]) ? 1 : -1;
+                    delay++;
+                    delay %= CA_CODE_LENGTH;
                 }
-            else
-                {
-                    dest[lcv] = -1;
-                }
-            delay++;
-            delay %= code_length;
+        }
+    return table;
+}
+
+alignas(64) constexpr Ca_Code_Table CA_CODE_TABLE = generate_ca_code_table();
+}  // namespace
+
+
+void gps_l1_ca_code_gen_int(own::span<int32_t> dest, int32_t prn, uint32_t chip_shift)
+{
+    constexpr uint32_t code_length = CA_CODE_LENGTH;
+    int32_t prn_idx;
+
+    // compute table index for given PRN number
+    if (120 <= prn && prn <= 138)
+        {
+            prn_idx = prn - 88;  // SBAS PRNs are at array indices 31 to 50 (offset: -120+33-1 =-88)
+        }
+    else
+        {
+            prn_idx = prn - 1;
+        }
+
+    // A simple error check
+    if ((prn_idx < 0) || (prn_idx > 50))
+        {
+            return;
+        }
+
+    // The chip shift is a pure rotation of the precomputed sequence
+    for (uint32_t lcv = 0; lcv < code_length; lcv++)
+        {
+            dest[lcv] = CA_CODE_TABLE.chips[prn_idx][(lcv + chip_shift) % code_length];
         }
 }
 
@@ -135,6 +152,13 @@ void gps_l1_ca_code_gen_complex(own::span<std::complex<float>> dest, int32_t prn
  */
 void gps_l1_ca_code_gen_complex_sampled(own::span<std::complex<float>> dest, uint32_t prn, int32_t sampling_freq, uint32_t chip_shift)
 {
+    auto& code_library = Gnss_Code_Library::get_instance();
+    const std::string cache_key = Gnss_Code_Library::make_key("1C", prn, sampling_freq, chip_shift, dest.size());
+    if (code_library.copy_if_cached(cache_key, dest))
+        {
+            return;
+        }
+
     // This function is based on the GNU software GPS for MATLAB in the Kay Borre book
     constexpr int32_t codeFreqBasis = 1023000;  // chips per second
     constexpr int32_t codeLength = 1023;
@@ -173,4 +197,6 @@ void gps_l1_ca_code_gen_complex_sampled(own::span<std::complex<float>> dest, uin
                     dest[i] = code_aux[codeValueIndex];  // repeat the chip -> upsample
                 }
         }
+
+    code_library.store(cache_key, dest);
 }
@@ -164,6 +164,79 @@ void convert_32fc_16ic(void *dest, const void *src, uint32_t num_items)
 }
 
 
+// Fused convert+scale helpers: dest = src * scale in a single pass over the
+// vector. The VOLK int-to-float kernels divide by their scalar while the
+// float-to-int kernels multiply by it, hence the reciprocal below
+void convert_8i_32f_scaled(void *dest, const void *src, uint32_t num_items, float scale)
+{
+    volk_8i_s32f_convert_32f(reinterpret_cast<float *>(dest),
+        reinterpret_cast<const int8_t *>(src), 1.0F / scale, num_items);
+}
+
+
+void convert_16i_32f_scaled(void *dest, const void *src, uint32_t num_items, float scale)
+{
+    volk_16i_s32f_convert_32f(reinterpret_cast<float *>(dest),
+        reinterpret_cast<const int16_t *>(src), 1.0F / scale, num_items);
+}
+
+
+void convert_32f_8i_scaled(void *dest, const void *src, uint32_t num_items, float scale)
+{
+    volk_32f_s32f_convert_8i(reinterpret_cast<int8_t *>(dest),
+        reinterpret_cast<const float *>(src), scale, num_items);
+}
+
+
+void convert_32f_16i_scaled(void *dest, const void *src, uint32_t num_items, float scale)
+{
+    volk_32f_s32f_convert_16i(reinterpret_cast<int16_t *>(dest),
+        reinterpret_cast<const float *>(src), scale, num_items);
+}
+
+
+void scale_32f(void *dest, const void *src, uint32_t num_items, float scale)
+{
+    volk_32f_s32f_multiply_32f(reinterpret_cast<float *>(dest),
+        reinterpret_cast<const float *>(src), scale, num_items);
+}
+
+
+void convert_8ic_32fc_scaled(void *dest, const void *src, uint32_t num_items, float scale)
+{
+    volk_8i_s32f_convert_32f(reinterpret_cast<float *>(dest),
+        reinterpret_cast<const int8_t *>(src), 1.0F / scale, 2 * num_items);
+}
+
+
+void convert_16ic_32fc_scaled(void *dest, const void *src, uint32_t num_items, float scale)
+{
+    volk_16i_s32f_convert_32f(reinterpret_cast<float *>(dest),
+        reinterpret_cast<const int16_t *>(src), 1.0F / scale, 2 * num_items);
+}
+
+
+void convert_32fc_8ic_scaled(void *dest, const void *src, uint32_t num_items, float scale)
+{
+    volk_32f_s32f_convert_8i(reinterpret_cast<int8_t *>(dest),
+        reinterpret_cast<const float *>(src), scale, 2 * num_items);
+}
+
+
+void convert_32fc_16ic_scaled(void *dest, const void *src, uint32_t num_items, float scale)
+{
+    volk_32f_s32f_convert_16i(reinterpret_cast<int16_t *>(dest),
+        reinterpret_cast<const float *>(src), scale, 2 * num_items);
+}
+
+
+void scale_32fc(void *dest, const void *src, uint32_t num_items, float scale)
+{
+    volk_32f_s32f_multiply_32f(reinterpret_cast<float *>(dest),
+        reinterpret_cast<const float *>(src), scale, 2 * num_items);
+}
+
+
 item_type_converter_t make_vector_converter(const std::string &input_type,
     const std::string &output_type)
 {
@@ -373,3 +446,112 @@ item_type_converter_t make_vector_converter(const std::string &input_type,
 
     throw std::runtime_error("make_vector_converter: invalid conversion : " + input_type + " to " + output_type);
 }
+
+
+item_type_converter_t make_vector_scaling_converter(const std::string &input_type,
+    const std::string &output_type, float scale)
+{
+    if (not item_type_valid(input_type) or not item_type_valid(output_type))
+        {
+            throw std::runtime_error("make_vector_scaling_converter: invalid item types : " + input_type + " " + output_type);
+        }
+
+    if (input_type == "byte" and output_type == "float")
+        {
+#ifdef DO_NOT_USE_LAMBDAS
+            return std::bind(convert_8i_32f_scaled, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, scale);  // NOLINT(modernize-avoid-bind)
+#else
+            return [=](auto &&arg1, auto &&arg2, auto &&arg3) { return convert_8i_32f_scaled(arg1, arg2, arg3, scale); };
+#endif
+        }
+    if (input_type == "ibyte" and output_type == "gr_complex")
+        {
+#ifdef DO_NOT_USE_LAMBDAS
+            return std::bind(convert_8i_32f_scaled, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, scale);  // NOLINT(modernize-avoid-bind)
+#else
+            return [=](auto &&arg1, auto &&arg2, auto &&arg3) { return convert_8i_32f_scaled(arg1, arg2, arg3, scale); };
+#endif
+        }
+    if (input_type == "cbyte" and output_type == "gr_complex")
+        {
+#ifdef DO_NOT_USE_LAMBDAS
+            return std::bind(convert_8ic_32fc_scaled, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, scale);  // NOLINT(modernize-avoid-bind)
+#else
+            return [=](auto &&arg1, auto &&arg2, auto &&arg3) { return convert_8ic_32fc_scaled(arg1, arg2, arg3, scale); };
+#endif
+        }
+    if (input_type == "short" and output_type == "float")
+        {
+#ifdef DO_NOT_USE_LAMBDAS
+            return std::bind(convert_16i_32f_scaled, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, scale);  // NOLINT(modernize-avoid-bind)
+#else
+            return [=](auto &&arg1, auto &&arg2, auto &&arg3) { return convert_16i_32f_scaled(arg1, arg2, arg3, scale); };
+#endif
+        }
+    if (input_type == "ishort" and output_type == "gr_complex")
+        {
+#ifdef DO_NOT_USE_LAMBDAS
+            return std::bind(convert_16i_32f_scaled, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, scale);  // NOLINT(modernize-avoid-bind)
+#else
+            return [=](auto &&arg1, auto &&arg2, auto &&arg3) { return convert_16i_32f_scaled(arg1, arg2, arg3, scale); };
+#endif
+        }
+    if (input_type == "cshort" and output_type == "gr_complex")
+        {
+#ifdef DO_NOT_USE_LAMBDAS
+            return std::bind(convert_16ic_32fc_scaled, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, scale);  // NOLINT(modernize-avoid-bind)
+#else
+            return [=](auto &&arg1, auto &&arg2, auto &&arg3) { return convert_16ic_32fc_scaled(arg1, arg2, arg3, scale); };
+#endif
+        }
+    if (input_type == "float" and output_type == "byte")
+        {
+#ifdef DO_NOT_USE_LAMBDAS
+            return std::bind(convert_32f_8i_scaled, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, scale);  // NOLINT(modernize-avoid-bind)
+#else
+            return [=](auto &&arg1, auto &&arg2, auto &&arg3) { return convert_32f_8i_scaled(arg1, arg2, arg3, scale); };
+#endif
+        }
+    if (input_type == "float" and output_type == "short")
+        {
+#ifdef DO_NOT_USE_LAMBDAS
+            return std::bind(convert_32f_16i_scaled, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, scale);  // NOLINT(modernize-avoid-bind)
+#else
+            return [=](auto &&arg1, auto &&arg2, auto &&arg3) { return convert_32f_16i_scaled(arg1, arg2, arg3, scale); };
+#endif
+        }
+    if (input_type == "float" and output_type == "float")
+        {
+#ifdef DO_NOT_USE_LAMBDAS
+            return std::bind(scale_32f, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, scale);  // NOLINT(modernize-avoid-bind)
+#else
+            return [=](auto &&arg1, auto &&arg2, auto &&arg3) { return scale_32f(arg1, arg2, arg3, scale); };
+#endif
+        }
+    if (input_type == "gr_complex" and (output_type == "cbyte" or output_type == "ibyte"))
+        {
+#ifdef DO_NOT_USE_LAMBDAS
+            return std::bind(convert_32fc_8ic_scaled, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, scale);  // NOLINT(modernize-avoid-bind)
+#else
+            return [=](auto &&arg1, auto &&arg2, auto &&arg3) { return convert_32fc_8ic_scaled(arg1, arg2, arg3, scale); };
+#endif
+        }
+    if (input_type == "gr_complex" and (output_type == "cshort" or output_type == "ishort"))
+        {
+#ifdef DO_NOT_USE_LAMBDAS
+            return std::bind(convert_32fc_16ic_scaled, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, scale);  // NOLINT(modernize-avoid-bind)
+#else
+            return [=](auto &&arg1, auto &&arg2, auto &&arg3) { return convert_32fc_16ic_scaled(arg1, arg2, arg3, scale); };
+#endif
+        }
+    if (input_type == "gr_complex" and output_type == "gr_complex")
+        {
+#ifdef DO_NOT_USE_LAMBDAS
+            return std::bind(scale_32fc, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, scale);  // NOLINT(modernize-avoid-bind)
+#else
+            return [=](auto &&arg1, auto &&arg2, auto &&arg3) { return scale_32fc(arg1, arg2, arg3, scale); };
+#endif
+        }
+
+    throw std::runtime_error("make_vector_scaling_converter: invalid conversion : " + input_type + " to " + output_type);
+}
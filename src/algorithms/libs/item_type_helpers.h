@@ -79,6 +79,26 @@ bool item_type_is_complex(const std::string &item_type);
 item_type_converter_t make_vector_converter(const std::string &input_type,
     const std::string &output_type);
 
+/*!
+ * \brief Create a function that converts and scales in a single pass
+ *
+ * \description Same conventions as make_vector_converter, with the output
+ * additionally multiplied by scale inside the underlying VOLK kernel, so
+ * normalizing a vector does not cost a second pass over it.
+ *
+ * \param input_type - String representation of the input item type
+ * \param output_type - String representation of the output item type
+ * \param scale - Multiplicative factor applied during the conversion (must
+ *  be non-zero)
+ *
+ * Only conversions with a floating point side are supported: integer types
+ * to "float" / "gr_complex", "float" / "gr_complex" to integer types, and
+ * "float" / "gr_complex" to themselves. Any other combination throws
+ * std::runtime_error.
+ */
+item_type_converter_t make_vector_scaling_converter(const std::string &input_type,
+    const std::string &output_type, float scale);
+
 
 /** \} */
 /** \} */
@@ -0,0 +1,146 @@
+/*!
+ * \file latency_tracer.cc
+ * \brief Implementation of a process-wide tracer of the wall-clock latency
+ * from sample ingest to the downstream processing stages
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "latency_tracer.h"
+#include <glog/logging.h>
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// interval between periodic percentile summaries in the log
+const std::chrono::seconds report_period(30);
+}  // namespace
+
+
+Latency_Tracer& Latency_Tracer::get_instance()
+{
+    static Latency_Tracer instance;
+    return instance;
+}
+
+
+void Latency_Tracer::enable()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    last_report_time_ = std::chrono::steady_clock::now();
+    enabled_.store(true, std::memory_order_relaxed);
+    LOG(INFO) << "Latency tracer enabled";
+}
+
+
+void Latency_Tracer::set_anchor(uint64_t sample_count, double fs)
+{
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(mutex_);
+    anchor_time_ = now;
+    anchor_sample_ = sample_count;
+    fs_ = fs;
+    anchored_ = true;
+}
+
+
+void Latency_Tracer::record_stage(const std::string& stage_name, uint64_t sample_count)
+{
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!anchored_ || fs_ <= 0.0)
+        {
+            return;
+        }
+    // reconstruct the ingest time of the epoch's sample stamp from the anchor
+    const double sample_offset_s = (static_cast<double>(sample_count) - static_cast<double>(anchor_sample_)) / fs_;
+    const double elapsed_since_anchor_ms = std::chrono::duration<double, std::milli>(now - anchor_time_).count();
+    const double latency_ms = std::max(elapsed_since_anchor_ms - sample_offset_s * 1e3, 0.0);
+
+    Stage_Stats& stats = stages_[stage_name];
+    const auto bucket = std::min(static_cast<size_t>(latency_ms), num_buckets);
+    stats.histogram_ms[bucket]++;
+    stats.count++;
+    stats.sum_ms += latency_ms;
+    stats.max_ms = std::max(stats.max_ms, latency_ms);
+
+    if (now - last_report_time_ >= report_period)
+        {
+            last_report_time_ = now;
+            for (const auto& stage : stages_)
+                {
+                    LOG(INFO) << "Latency " << stage.first
+                              << ": mean " << stage.second.sum_ms / static_cast<double>(stage.second.count)
+                              << " ms, p50 " << percentile(stage.second, 0.50)
+                              << " ms, p90 " << percentile(stage.second, 0.90)
+                              << " ms, p99 " << percentile(stage.second, 0.99)
+                              << " ms, max " << stage.second.max_ms
+                              << " ms (" << stage.second.count << " epochs)";
+                }
+        }
+}
+
+
+double Latency_Tracer::age_ms(uint64_t sample_count)
+{
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!anchored_ || fs_ <= 0.0)
+        {
+            return -1.0;
+        }
+    const double sample_offset_s = (static_cast<double>(sample_count) - static_cast<double>(anchor_sample_)) / fs_;
+    const double elapsed_since_anchor_ms = std::chrono::duration<double, std::milli>(now - anchor_time_).count();
+    return elapsed_since_anchor_ms - sample_offset_s * 1e3;
+}
+
+
+void Latency_Tracer::write_report()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!enabled_.load(std::memory_order_relaxed) || stages_.empty())
+        {
+            return;
+        }
+    LOG(INFO) << "Latency report (sample ingest to stage output):";
+    for (const auto& stage : stages_)
+        {
+            LOG(INFO) << "  " << stage.first
+                      << ": mean " << stage.second.sum_ms / static_cast<double>(stage.second.count)
+                      << " ms, p50 " << percentile(stage.second, 0.50)
+                      << " ms, p90 " << percentile(stage.second, 0.90)
+                      << " ms, p99 " << percentile(stage.second, 0.99)
+                      << " ms, max " << stage.second.max_ms
+                      << " ms (" << stage.second.count << " epochs)";
+        }
+}
+
+
+double Latency_Tracer::percentile(const Stage_Stats& stats, double fraction)
+{
+    if (stats.count == 0)
+        {
+            return 0.0;
+        }
+    const auto target = static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(stats.count)));
+    uint64_t cumulative = 0;
+    for (size_t bucket = 0; bucket <= num_buckets; bucket++)
+        {
+            cumulative += stats.histogram_ms[bucket];
+            if (cumulative >= target)
+                {
+                    return static_cast<double>(bucket);
+                }
+        }
+    return static_cast<double>(num_buckets);
+}
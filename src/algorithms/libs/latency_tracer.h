@@ -0,0 +1,108 @@
+/*!
+ * \file latency_tracer.h
+ * \brief Interface of a process-wide tracer of the wall-clock latency from
+ * sample ingest to the downstream processing stages
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_LATENCY_TRACER_H
+#define GNSS_SDR_LATENCY_TRACER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+/*!
+ * \brief Process-wide collector of per-stage processing latencies.
+ *
+ * The sample counter block anchors the absolute sample count to the wall
+ * clock as the conditioned stream flows by; downstream stages (tracking,
+ * observables, PVT) report the sample stamp of each emitted epoch, and the
+ * tracer converts the stamp into an ingest time and accumulates the
+ * elapsed wall-clock time per stage in a millisecond histogram. Percentile
+ * summaries (p50 / p90 / p99 / max) are logged periodically and in the
+ * final report, so a blown latency budget can be attributed to a stage.
+ *
+ * Disabled by default; enabled with GNSS-SDR.enable_latency_trace=true.
+ * When disabled the per-epoch cost is a single relaxed atomic load.
+ */
+class Latency_Tracer
+{
+public:
+    static Latency_Tracer& get_instance();
+
+    //! Turns the tracer on (GNSS-SDR.enable_latency_trace)
+    void enable();
+
+    inline bool enabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    //! Ties the absolute sample count to the wall clock; called by the
+    //! sample counter block while the stream flows by
+    void set_anchor(uint64_t sample_count, double fs);
+
+    //! Records the latency of one epoch of a stage, given the absolute
+    //! sample stamp the epoch refers to
+    void record_stage(const std::string& stage_name, uint64_t sample_count);
+
+    //! Wall-clock age in ms of an epoch with the given absolute sample
+    //! stamp, or a negative value if the tracer is disabled or not yet
+    //! anchored. Used by deadline-aware consumers to detect stale epochs
+    double age_ms(uint64_t sample_count);
+
+    //! Logs the per-stage percentile summary
+    void write_report();
+
+private:
+    Latency_Tracer() = default;
+
+    // 1 ms resolution up to 2 s, which is plenty for a 100 ms budget;
+    // later epochs land in the overflow bucket but keep max_ms exact
+    static const size_t num_buckets = 2000;
+
+    struct Stage_Stats
+    {
+        std::array<uint64_t, num_buckets + 1> histogram_ms{};
+        uint64_t count = 0;
+        double sum_ms = 0.0;
+        double max_ms = 0.0;
+    };
+
+    static double percentile(const Stage_Stats& stats, double fraction);
+
+    std::map<std::string, Stage_Stats> stages_;
+    std::chrono::steady_clock::time_point anchor_time_;
+    std::chrono::steady_clock::time_point last_report_time_;
+    std::mutex mutex_;
+    uint64_t anchor_sample_ = 0;
+    double fs_ = 0.0;
+    std::atomic<bool> enabled_{false};
+    bool anchored_ = false;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_LATENCY_TRACER_H
@@ -262,6 +262,9 @@ const int MAXBAND = 10;   //!<    max SBAS band of IGP
 const int MAXNIGP = 201;  //!<    max number of IGP in SBAS band
 const int MAXNGEO = 4;    //!<    max number of GEO satellites
 
+const int SBSIGP_NLAT = 35;  //!<    SBAS IGP index rows (lat -85..85 deg, 5 deg step)
+const int SBSIGP_NLON = 72;  //!<    SBAS IGP index columns (lon -180..175 deg, 5 deg step)
+
 const int MAXSOLMSG = 8191;  //!<    max length of solution message
 const int MAXERRMSG = 4096;  //!<    max length of error/warning message
 
@@ -613,6 +616,7 @@ typedef struct
     int nsat;              /* number of satellites */
     int tlat;              /* system latency (s) */
     sbssatp_t sat[MAXSAT]; /* satellite correction */
+    short satidx[MAXSAT];  /* sat number -> sat[] slot+1 (0:none), kept by sbs_index_sat() */
 } sbssat_t;
 
 
@@ -790,6 +794,8 @@ typedef struct
     pcv_t pcvs[MAXSAT];           /* satellite antenna pcv */
     sbssat_t sbssat;              /* SBAS satellite corrections */
     sbsion_t sbsion[MAXBAND + 1]; /* SBAS ionosphere corrections */
+    short sbsigpidx[SBSIGP_NLAT * SBSIGP_NLON];
+    /* IGP (lat,lon) grid slot -> band*MAXNIGP+igp+1 (0:none), kept by sbs_index_igp() */
     dgps_t dgps[MAXSAT];          /* DGPS corrections */
     ssr_t ssr[MAXSAT];            /* SSR corrections */
     lexeph_t lexeph[MAXSAT];      /* LEX ephemeris */
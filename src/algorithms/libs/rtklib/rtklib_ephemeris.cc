@@ -34,6 +34,12 @@
 #include "rtklib_preceph.h"
 #include "rtklib_rtkcmn.h"
 #include "rtklib_sbas.h"
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 /* constants -----------------------------------------------------------------*/
@@ -786,6 +792,99 @@ int ephclk(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
 }
 
 
+/* per-satellite ephemeris evaluation cache ------------------------------------
+ * the full broadcast model is evaluated at two node times one second apart
+ * and intermediate epochs are served by cubic Hermite interpolation of
+ * position and clock. satellite motion is smooth at this scale, so the
+ * interpolation error is orders of magnitude below the broadcast ephemeris
+ * accuracy while the iterative Kepler solution (or the GLONASS numerical
+ * integration) runs at most once per second per satellite regardless of the
+ * solution rate. the cache is thread local: satellite indexing alone is not
+ * enough once two solver instances run concurrently (e.g. an A/B fork, where
+ * the B set shadows the A set's satellite assignment). the satposs workers
+ * live in a persistent pool and each one always takes the same slice of the
+ * satellite list, so its thread-local entries keep hitting across calls */
+namespace
+{
+const double EPH_CACHE_STEP = 1.0; /* node spacing (s) */
+
+struct Eph_Cache_Entry
+{
+    gtime_t t0{};    /* time of the first node */
+    double key = 0.0;  /* toe of the cached ephemeris */
+    int iode = -1;   /* IODE of the cached ephemeris */
+    int sys = 0;     /* navigation system of the cached ephemeris */
+    double pos0[3]{};
+    double vel0[3]{};
+    double pos1[3]{};
+    double vel1[3]{};
+    double dts0 = 0.0;
+    double ddts0 = 0.0;
+    double dts1 = 0.0;
+    double ddts1 = 0.0;
+    double var = 0.0;
+    bool valid = false;
+};
+
+thread_local std::array<Eph_Cache_Entry, MAXSAT> eph_cache{};
+
+/* evaluate position, velocity, clock bias and drift of one cache node. the
+   node velocities steer the Hermite polynomial, so they use central
+   differences, whose truncation error is well below the one of the one-sided
+   differences used in the uncached path */
+template <typename EphType, typename Model>
+void eph_cache_node(Model model, const EphType *data, gtime_t t,
+    double *pos, double *vel, double *dts, double *ddts, double *var)
+{
+    const double tt = 1e-3;
+    double posb[3];
+    double post[3];
+    double dtsb[1];
+    double dtst[1];
+    int i;
+
+    model(t, data, pos, dts, var);
+    model(timeadd(t, -tt), data, posb, dtsb, var);
+    model(timeadd(t, tt), data, post, dtst, var);
+    for (i = 0; i < 3; i++)
+        {
+            vel[i] = (post[i] - posb[i]) / (2.0 * tt);
+        }
+    *ddts = (dtst[0] - dtsb[0]) / (2.0 * tt);
+}
+
+/* serve a query from the cache entry by cubic Hermite interpolation */
+void eph_cache_interp(const Eph_Cache_Entry &entry, double tq, double *rs, double *dts)
+{
+    const double h = EPH_CACHE_STEP;
+    const double s = tq / h;
+    const double s2 = s * s;
+    const double s3 = s2 * s;
+    const double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+    const double h10 = s3 - 2.0 * s2 + s;
+    const double h01 = -2.0 * s3 + 3.0 * s2;
+    const double h11 = s3 - s2;
+    const double g00 = (6.0 * s2 - 6.0 * s) / h;
+    const double g10 = 3.0 * s2 - 4.0 * s + 1.0;
+    const double g01 = (-6.0 * s2 + 6.0 * s) / h;
+    const double g11 = 3.0 * s2 - 2.0 * s;
+    int i;
+
+    for (i = 0; i < 3; i++)
+        {
+            rs[i] = h00 * entry.pos0[i] + h10 * h * entry.vel0[i] +
+                    h01 * entry.pos1[i] + h11 * h * entry.vel1[i];
+            rs[i + 3] = g00 * entry.pos0[i] + g10 * entry.vel0[i] +
+                        g01 * entry.pos1[i] + g11 * entry.vel1[i];
+        }
+    dts[0] = h00 * entry.dts0 + h10 * h * entry.ddts0 +
+             h01 * entry.dts1 + h11 * h * entry.ddts1;
+    dts[1] = g00 * entry.dts0 + g10 * entry.ddts0 +
+             g01 * entry.dts1 + g11 * entry.ddts1;
+}
+}  // namespace
+
+
 /* satellite position and clock by broadcast ephemeris -----------------------*/
 int ephpos(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     int iode, double *rs, double *dts, double *var, int *svh)
@@ -812,23 +911,55 @@ int ephpos(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
                     return 0;
                 }
 
-            eph2pos(time, eph, rs, dts, var);
-            time = timeadd(time, tt);
-            eph2pos(time, eph, rst, dtst, var);
+            Eph_Cache_Entry &entry = eph_cache[sat - 1];
+            double tq = timediff(time, entry.t0);
+            if (!entry.valid || entry.sys != sys || entry.iode != eph->iode ||
+                entry.key != eph->toes || tq < 0.0 || tq > EPH_CACHE_STEP)
+                {
+                    entry.t0 = time;
+                    entry.sys = sys;
+                    entry.iode = eph->iode;
+                    entry.key = eph->toes;
+                    eph_cache_node(eph2pos, eph, entry.t0,
+                        entry.pos0, entry.vel0, &entry.dts0, &entry.ddts0, &entry.var);
+                    eph_cache_node(eph2pos, eph, timeadd(entry.t0, EPH_CACHE_STEP),
+                        entry.pos1, entry.vel1, &entry.dts1, &entry.ddts1, &entry.var);
+                    entry.valid = true;
+                    tq = 0.0;
+                }
+            eph_cache_interp(entry, tq, rs, dts);
+            *var = entry.var;
             *svh = eph->svh;
+            return 1;
         }
-    else if (sys == SYS_GLO)
+    if (sys == SYS_GLO)
         {
             if (!(geph = selgeph(teph, sat, iode, nav)))
                 {
                     return 0;
                 }
-            geph2pos(time, geph, rs, dts, var);
-            time = timeadd(time, tt);
-            geph2pos(time, geph, rst, dtst, var);
+            Eph_Cache_Entry &entry = eph_cache[sat - 1];
+            double tq = timediff(time, entry.t0);
+            if (!entry.valid || entry.sys != sys || entry.iode != geph->iode ||
+                entry.key != static_cast<double>(geph->toe.time) || tq < 0.0 || tq > EPH_CACHE_STEP)
+                {
+                    entry.t0 = time;
+                    entry.sys = sys;
+                    entry.iode = geph->iode;
+                    entry.key = static_cast<double>(geph->toe.time);
+                    eph_cache_node(geph2pos, geph, entry.t0,
+                        entry.pos0, entry.vel0, &entry.dts0, &entry.ddts0, &entry.var);
+                    eph_cache_node(geph2pos, geph, timeadd(entry.t0, EPH_CACHE_STEP),
+                        entry.pos1, entry.vel1, &entry.dts1, &entry.ddts1, &entry.var);
+                    entry.valid = true;
+                    tq = 0.0;
+                }
+            eph_cache_interp(entry, tq, rs, dts);
+            *var = entry.var;
             *svh = geph->svh;
+            return 1;
         }
-    else if (sys == SYS_SBS)
+    if (sys == SYS_SBS)
         {
             if (!(seph = selseph(teph, sat, nav)))
                 {
@@ -861,20 +992,11 @@ int satpos_sbas(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     double *rs, double *dts, double *var, int *svh)
 {
     const sbssatp_t *sbs;
-    int i;
 
     trace(4, "satpos_sbas: time=%s sat=%2d\n", time_str(time, 3), sat);
 
     /* search sbas satellite correciton */
-    for (i = 0; i < nav->sbssat.nsat; i++)
-        {
-            sbs = nav->sbssat.sat + i;
-            if (sbs->sat == sat)
-                {
-                    break;
-                }
-        }
-    if (i >= nav->sbssat.nsat)
+    if (!(sbs = sbsgetsatp(&nav->sbssat, sat)))
         {
             trace(2, "no sbas correction for orbit: %s sat=%2d\n", time_str(time, 0), sat);
             ephpos(time, teph, sat, nav, -1, rs, dts, var, svh);
@@ -1112,73 +1234,217 @@ int satpos(gtime_t time, gtime_t teph, int sat, int ephopt,
  *          any pseudorange and broadcast ephemeris are always needed to get
  *          signal transmission time
  *-----------------------------------------------------------------------------*/
+/* persistent worker pool for satposs ----------------------------------------
+ * the workers are spawned once and reused for every epoch: spawning fresh
+ * std::threads per call would hand each satellite to a thread with an empty
+ * thread-local ephemeris cache, so no lookup would ever hit. worker w always
+ * processes the w-th slice of the satellite list, so the satellite-to-thread
+ * mapping is stable between calls and the caches stay warm. calls are
+ * serialized, so concurrent solver instances simply take turns */
+namespace
+{
+class Eph_Worker_Pool
+{
+public:
+    static Eph_Worker_Pool &get_instance()
+    {
+        static Eph_Worker_Pool instance;
+        return instance;
+    }
+
+    unsigned int num_workers() const
+    {
+        return static_cast<unsigned int>(workers_.size());
+    }
+
+    /* run fn(k) for every k in [0, n) across the workers and wait */
+    void parallel_for(int n, const std::function<void(int)> &fn)
+    {
+        std::lock_guard<std::mutex> call_lock(call_mutex_);
+        std::unique_lock<std::mutex> lock(mutex_);
+        n_ = n;
+        fn_ = &fn;
+        pending_ = static_cast<int>(workers_.size());
+        generation_++;
+        cv_.notify_all();
+        done_cv_.wait(lock, [this] { return pending_ == 0; });
+        fn_ = nullptr;
+    }
+
+private:
+    Eph_Worker_Pool()
+    {
+        unsigned int num_threads = std::thread::hardware_concurrency();
+        if (num_threads > 4U)
+            {
+                num_threads = 4U;
+            }
+        if (num_threads < 2U)
+            {
+                return; /* no pool; the caller falls back to its serial loop */
+            }
+        workers_.reserve(num_threads);
+        for (unsigned int w = 0; w < num_threads; w++)
+            {
+                workers_.emplace_back(&Eph_Worker_Pool::worker_loop, this, w);
+            }
+    }
+
+    ~Eph_Worker_Pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            running_ = false;
+        }
+        cv_.notify_all();
+        for (auto &worker : workers_)
+            {
+                worker.join();
+            }
+    }
+
+    void worker_loop(unsigned int w)
+    {
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;)
+            {
+                cv_.wait(lock, [&] { return generation_ != seen || !running_; });
+                if (!running_)
+                    {
+                        return;
+                    }
+                seen = generation_;
+                const int n = n_;
+                const std::function<void(int)> *fn = fn_;
+                lock.unlock();
+                const int num = static_cast<int>(workers_.size());
+                const int chunk = (n + num - 1) / num;
+                const int begin = static_cast<int>(w) * chunk;
+                const int end = (begin + chunk < n) ? begin + chunk : n;
+                for (int k = begin; k < end; k++)
+                    {
+                        (*fn)(k);
+                    }
+                lock.lock();
+                if (--pending_ == 0)
+                    {
+                        done_cv_.notify_all();
+                    }
+            }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex call_mutex_; /* one parallel_for at a time */
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable done_cv_;
+    const std::function<void(int)> *fn_{nullptr}; /* guarded by mutex_ */
+    uint64_t generation_{0};                      /* guarded by mutex_ */
+    int n_{0};                                    /* guarded by mutex_ */
+    int pending_{0};                              /* guarded by mutex_ */
+    bool running_{true};                          /* guarded by mutex_ */
+};
+}  // namespace
+
+
 void satposs(gtime_t teph, const obsd_t *obs, int n, const nav_t *nav,
     int ephopt, double *rs, double *dts, double *var, int *svh)
 {
     std::vector<gtime_t> time(MAXOBS);
-    double dt;
-    double pr;
+    std::vector<unsigned char> brdc_clk(MAXOBS, 0);
     int i;
-    int j;
 
     trace(3, "satposs : teph=%s n=%d ephopt=%d\n", time_str(teph, 3), n, ephopt);
 
-    for (i = 0; i < n && i < MAXOBS; i++)
+    const int nsat = (n < MAXOBS) ? n : MAXOBS;
+
+    /* model one satellite; each iteration only reads nav and writes its own
+       slice of rs/dts/var/svh, so iterations are independent of each other */
+    auto model_sat = [&](int k) {
+        double dt;
+        double pr;
+        int j;
+        for (j = 0; j < 6; j++)
+            {
+                rs[j + k * 6] = 0.0;
+            }
+        for (j = 0; j < 2; j++)
+            {
+                dts[j + k * 2] = 0.0;
+            }
+        var[k] = 0.0;
+        svh[k] = 0;
+
+        /* search any pseudorange */
+        for (j = 0, pr = 0.0; j < NFREQ; j++)
+            {
+                if ((pr = obs[k].P[j]) != 0.0)
+                    {
+                        break;
+                    }
+            }
+
+        if (j >= NFREQ)
+            {
+                trace(2, "no pseudorange %s sat=%2d\n", time_str(obs[k].time, 3), obs[k].sat);
+                return;
+            }
+        /* transmission time by satellite clock */
+        time[k] = timeadd(obs[k].time, -pr / SPEED_OF_LIGHT_M_S);
+
+        /* satellite clock bias by broadcast ephemeris */
+        if (!ephclk(time[k], teph, obs[k].sat, nav, &dt))
+            {
+                trace(3, "no broadcast clock %s sat=%2d\n", time_str(time[k], 3), obs[k].sat);
+                return;
+            }
+        time[k] = timeadd(time[k], -dt);
+
+        /* satellite position and clock at transmission time */
+        if (!satpos(time[k], teph, obs[k].sat, ephopt, nav, rs + k * 6, dts + k * 2, var + k,
+                svh + k))
+            {
+                trace(3, "no ephemeris %s sat=%2d\n", time_str(time[k], 3), obs[k].sat);
+                return;
+            }
+        /* if no precise clock available, use broadcast clock instead */
+        if (dts[k * 2] == 0.0)
+            {
+                if (!ephclk(time[k], teph, obs[k].sat, nav, dts + k * 2))
+                    {
+                        return;
+                    }
+                dts[1 + k * 2] = 0.0;
+                brdc_clk[k] = 1;
+            }
+    };
+
+    /* split the satellites across the persistent workers when the epoch
+       carries enough of them to pay for the hand-off */
+    Eph_Worker_Pool &pool = Eph_Worker_Pool::get_instance();
+    if (nsat < 16 || pool.num_workers() < 2U)
         {
-            for (j = 0; j < 6; j++)
+            for (i = 0; i < nsat; i++)
                 {
-                    rs[j + i * 6] = 0.0;
+                    model_sat(i);
                 }
-            for (j = 0; j < 2; j++)
-                {
-                    dts[j + i * 2] = 0.0;
-                }
-            var[i] = 0.0;
-            svh[i] = 0;
-
-            /* search any pseudorange */
-            for (j = 0, pr = 0.0; j < NFREQ; j++)
-                {
-                    if ((pr = obs[i].P[j]) != 0.0)
-                        {
-                            break;
-                        }
-                }
-
-            if (j >= NFREQ)
-                {
-                    trace(2, "no pseudorange %s sat=%2d\n", time_str(obs[i].time, 3), obs[i].sat);
-                    continue;
-                }
-            /* transmission time by satellite clock */
-            time[i] = timeadd(obs[i].time, -pr / SPEED_OF_LIGHT_M_S);
-
-            /* satellite clock bias by broadcast ephemeris */
-            if (!ephclk(time[i], teph, obs[i].sat, nav, &dt))
-                {
-                    trace(3, "no broadcast clock %s sat=%2d\n", time_str(time[i], 3), obs[i].sat);
-                    continue;
-                }
-            time[i] = timeadd(time[i], -dt);
+        }
+    else
+        {
+            pool.parallel_for(nsat, model_sat);
+        }
 
-            /* satellite position and clock at transmission time */
-            if (!satpos(time[i], teph, obs[i].sat, ephopt, nav, rs + i * 6, dts + i * 2, var + i,
-                    svh + i))
-                {
-                    trace(3, "no ephemeris %s sat=%2d\n", time_str(time[i], 3), obs[i].sat);
-                    continue;
-                }
-            /* if no precise clock available, use broadcast clock instead */
-            if (dts[i * 2] == 0.0)
+    /* apply the broadcast clock variance outside the workers to keep the
+       write to *var single-threaded */
+    for (i = 0; i < nsat; i++)
+        {
+            if (brdc_clk[i])
                 {
-                    if (!ephclk(time[i], teph, obs[i].sat, nav, dts + i * 2))
-                        {
-                            continue;
-                        }
-                    dts[1 + i * 2] = 0.0;
                     *var = std::pow(STD_BRDCCLK, 2.0);
                 }
         }
+
     for (i = 0; i < n && i < MAXOBS; i++)
         {
             trace(4, "%s sat=%2d rs=%13.3f %13.3f %13.3f dts=%12.3f var=%7.3f svh=%02X\n",
@@ -713,6 +713,20 @@ int estpos(const obsd_t *obs, int n, const double *rs, const double *dts,
             x[i] = sol->rr[i];
         }
 
+    /* warm-start the clock states from the previous epoch: the receiver
+       clock bias is the largest initial residual by far (hundreds of km in
+       range units), so re-acquiring it from zero costs the Gauss-Newton
+       loop several iterations that a converged previous solution already
+       paid for. sol->stat has been reset by pntpos at this point, so use
+       the carried-over position as the evidence of a previous fix */
+    if (std::sqrt(x[0] * x[0] + x[1] * x[1] + x[2] * x[2]) >= 0.1)
+        {
+            for (i = 3; i < NX; i++)
+                {
+                    x[i] = sol->dtr[i - 3] * SPEED_OF_LIGHT_M_S;
+                }
+        }
+
     // Rough first estimation to initialize the algorithm
     if (opt->bancroft_init && (std::sqrt(x[0] * x[0] + x[1] * x[1] + x[2] * x[2]) < 0.1))
         {
@@ -1093,11 +1107,7 @@ int pntpos(const obsd_t *obs, int n, const nav_t *nav,
     double *rs;
     double *dts;
     double *var;
-    double *azel_;
-    double *resp;
-    int i;
     int stat;
-    std::vector<int> vsat(MAXOBS, 0);
     std::vector<int> svh(MAXOBS, 0);
 
     sol->stat = SOLQ_NONE;
@@ -1111,13 +1121,10 @@ int pntpos(const obsd_t *obs, int n, const nav_t *nav,
     trace(3, "pntpos  : tobs=%s n=%d\n", time_str(obs[0].time, 3), n);
 
     sol->time = obs[0].time;
-    msg[0] = '\0';
 
     rs = mat(6, n);
     dts = mat(2, n);
     var = mat(1, n);
-    azel_ = zeros(2, n);
-    resp = mat(1, n);
 
     if (opt_.mode != PMODE_SINGLE)
         { /* for precise positioning */
@@ -1130,13 +1137,59 @@ int pntpos(const obsd_t *obs, int n, const nav_t *nav,
     /* satellite positions, velocities and clocks */
     satposs(sol->time, obs, n, nav, opt_.sateph, rs, dts, var, svh.data());
 
+    stat = pntpos_sat(obs, n, nav, &opt_, sol, azel, ssat, msg, rs, dts, var, svh.data());
+
+    free(rs);
+    free(dts);
+    free(var);
+    return stat;
+}
+
+
+/* single-point positioning with precomputed satellite positions ---------------
+ * same as pntpos() but taking the satposs() outputs for the observation set
+ * (rs, dts, var, svh) as inputs, so several solutions evaluated over subsets
+ * of the same epoch can share one satellite position computation
+ *-----------------------------------------------------------------------------*/
+int pntpos_sat(const obsd_t *obs, int n, const nav_t *nav,
+    const prcopt_t *opt, sol_t *sol, double *azel, ssat_t *ssat,
+    char *msg, const double *rs, const double *dts, const double *var,
+    const int *svh)
+{
+    prcopt_t opt_ = *opt;
+    double *azel_;
+    double *resp;
+    int i;
+    int stat;
+    std::vector<int> vsat(MAXOBS, 0);
+
+    sol->stat = SOLQ_NONE;
+
+    if (n <= 0)
+        {
+            std::strncpy(msg, "no observation data", 20);
+            return 0;
+        }
+
+    sol->time = obs[0].time;
+    msg[0] = '\0';
+
+    azel_ = zeros(2, n);
+    resp = mat(1, n);
+
+    if (opt_.mode != PMODE_SINGLE)
+        { /* for precise positioning */
+            opt_.ionoopt = IONOOPT_BRDC;
+            opt_.tropopt = TROPOPT_SAAS;
+        }
+
     /* estimate receiver position with pseudorange */
-    stat = estpos(obs, n, rs, dts, var, svh.data(), nav, &opt_, sol, azel_, vsat.data(), resp, msg);
+    stat = estpos(obs, n, rs, dts, var, svh, nav, &opt_, sol, azel_, vsat.data(), resp, msg);
 
     /* raim fde */
     if (!stat && n >= 6 && opt->posopt[4])
         {
-            stat = raim_fde(obs, n, rs, dts, var, svh.data(), nav, &opt_, sol, azel_, vsat.data(), resp, msg);
+            stat = raim_fde(obs, n, rs, dts, var, svh, nav, &opt_, sol, azel_, vsat.data(), resp, msg);
         }
     /* estimate receiver velocity with doppler */
     if (stat)
@@ -1173,9 +1226,6 @@ int pntpos(const obsd_t *obs, int n, const nav_t *nav,
                     ssat[obs[i].sat - 1].resp[0] = resp[i];
                 }
         }
-    free(rs);
-    free(dts);
-    free(var);
     free(azel_);
     free(resp);
     return stat;
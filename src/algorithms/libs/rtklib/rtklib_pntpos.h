@@ -142,4 +142,15 @@ int pntpos(const obsd_t *obs, int n, const nav_t *nav,
     const prcopt_t *opt, sol_t *sol, double *azel, ssat_t *ssat,
     char *msg);
 
+/*!
+ * \brief single-point positioning with precomputed satellite positions
+ * same as pntpos() but taking the satposs() outputs for the observation set
+ * (rs, dts, var, svh) as inputs, so several solutions evaluated over subsets
+ * of the same epoch can share one satellite position computation
+ */
+int pntpos_sat(const obsd_t *obs, int n, const nav_t *nav,
+    const prcopt_t *opt, sol_t *sol, double *azel, ssat_t *ssat,
+    char *msg, const double *rs, const double *dts, const double *var,
+    const int *svh);
+
 #endif  // GNSS_SDR_RTKLIB_PNTPOS_H
@@ -42,6 +42,7 @@
 
 #include "rtklib_preceph.h"
 #include "rtklib_rtkcmn.h"
+#include "rtklib_sp3_store.h"
 #include <cstring>
 #include <vector>
 
@@ -162,20 +163,103 @@ int addpeph(nav_t *nav, peph_t *peph)
 }
 
 
-/* read sp3 body -------------------------------------------------------------*/
-void readsp3b(FILE *fp, char type, int *sats __attribute__((unused)), int ns, const double *bfact,
-    char *tsys, int index, int opt, nav_t *nav)
+/* decode one sp3 P/V record into a precise ephemeris epoch ------------------*/
+int decode_sp3_record(const char *buff, const double *bfact, int opt,
+    peph_t *peph, int *pred_o, int *pred_c, int *v)
 {
-    peph_t peph;
-    gtime_t time;
     double val;
     double std;
     double base;
-    int i;
     int j;
     int sat;
     int sys;
     int prn;
+
+    if (strlen(buff) < 4 || (buff[0] != 'P' && buff[0] != 'V'))
+        {
+            return 0;
+        }
+
+    sys = buff[1] == ' ' ? SYS_GPS : code2sys(buff[1]);
+    prn = static_cast<int>(str2num(buff, 2, 2));
+    if (sys == SYS_SBS)
+        {
+            prn += 100;
+        }
+    else if (sys == SYS_QZS)
+        {
+            prn += 192; /* extension to sp3-c */
+        }
+
+    if (!(sat = satno(sys, prn)))
+        {
+            return 0;
+        }
+
+    if (buff[0] == 'P')
+        {
+            *pred_c = strlen(buff) >= 76 && buff[75] == 'P';
+            *pred_o = strlen(buff) >= 80 && buff[79] == 'P';
+        }
+    for (j = 0; j < 4; j++)
+        {
+            /* read option for predicted value */
+            if (j < 3 && (opt & 1) && *pred_o)
+                {
+                    continue;
+                }
+            if (j < 3 && (opt & 2) && !*pred_o)
+                {
+                    continue;
+                }
+            if (j == 3 && (opt & 1) && *pred_c)
+                {
+                    continue;
+                }
+            if (j == 3 && (opt & 2) && !*pred_c)
+                {
+                    continue;
+                }
+
+            val = str2num(buff, 4 + j * 14, 14);
+            std = str2num(buff, 61 + j * 3, j < 3 ? 2 : 3);
+
+            if (buff[0] == 'P')
+                { /* position */
+                    if (val != 0.0 && fabs(val - 999999.999999) >= 1e-6)
+                        {
+                            peph->pos[sat - 1][j] = val * (j < 3 ? 1000.0 : 1e-6);
+                            *v = 1; /* valid epoch */
+                        }
+                    if ((base = bfact[j < 3 ? 0 : 1]) > 0.0 && std > 0.0)
+                        {
+                            peph->std[sat - 1][j] = static_cast<float>(std::pow(base, std) * (j < 3 ? 1e-3 : 1e-12));
+                        }
+                }
+            else if (*v)
+                { /* velocity */
+                    if (val != 0.0 && fabs(val - 999999.999999) >= 1e-6)
+                        {
+                            peph->vel[sat - 1][j] = val * (j < 3 ? 0.1 : 1e-10);
+                        }
+                    if ((base = bfact[j < 3 ? 0 : 1]) > 0.0 && std > 0.0)
+                        {
+                            peph->vst[sat - 1][j] = static_cast<float>(std::pow(base, std) * (j < 3 ? 1e-7 : 1e-16));
+                        }
+                }
+        }
+    return 1;
+}
+
+
+/* read sp3 body -------------------------------------------------------------*/
+void readsp3b(FILE *fp, char type, int *sats __attribute__((unused)), int ns, const double *bfact,
+    char *tsys, int index, int opt, nav_t *nav)
+{
+    peph_t peph;
+    gtime_t time;
+    int i;
+    int j;
     int n = ns * (type == 'P' ? 1 : 2);
     int pred_o;
     int pred_c;
@@ -220,79 +304,7 @@ void readsp3b(FILE *fp, char type, int *sats __attribute__((unused)), int ns, co
                 }
             for (i = pred_o = pred_c = v = 0; i < n && fgets(buff, sizeof(buff), fp); i++)
                 {
-                    if (strlen(buff) < 4 || (buff[0] != 'P' && buff[0] != 'V'))
-                        {
-                            continue;
-                        }
-
-                    sys = buff[1] == ' ' ? SYS_GPS : code2sys(buff[1]);
-                    prn = static_cast<int>(str2num(buff, 2, 2));
-                    if (sys == SYS_SBS)
-                        {
-                            prn += 100;
-                        }
-                    else if (sys == SYS_QZS)
-                        {
-                            prn += 192; /* extension to sp3-c */
-                        }
-
-                    if (!(sat = satno(sys, prn)))
-                        {
-                            continue;
-                        }
-
-                    if (buff[0] == 'P')
-                        {
-                            pred_c = strlen(buff) >= 76 && buff[75] == 'P';
-                            pred_o = strlen(buff) >= 80 && buff[79] == 'P';
-                        }
-                    for (j = 0; j < 4; j++)
-                        {
-                            /* read option for predicted value */
-                            if (j < 3 && (opt & 1) && pred_o)
-                                {
-                                    continue;
-                                }
-                            if (j < 3 && (opt & 2) && !pred_o)
-                                {
-                                    continue;
-                                }
-                            if (j == 3 && (opt & 1) && pred_c)
-                                {
-                                    continue;
-                                }
-                            if (j == 3 && (opt & 2) && !pred_c)
-                                {
-                                    continue;
-                                }
-
-                            val = str2num(buff, 4 + j * 14, 14);
-                            std = str2num(buff, 61 + j * 3, j < 3 ? 2 : 3);
-
-                            if (buff[0] == 'P')
-                                { /* position */
-                                    if (val != 0.0 && fabs(val - 999999.999999) >= 1e-6)
-                                        {
-                                            peph.pos[sat - 1][j] = val * (j < 3 ? 1000.0 : 1e-6);
-                                            v = 1; /* valid epoch */
-                                        }
-                                    if ((base = bfact[j < 3 ? 0 : 1]) > 0.0 && std > 0.0)
-                                        {
-                                            peph.std[sat - 1][j] = static_cast<float>(std::pow(base, std) * (j < 3 ? 1e-3 : 1e-12));
-                                        }
-                                }
-                            else if (v)
-                                { /* velocity */
-                                    if (val != 0.0 && fabs(val - 999999.999999) >= 1e-6)
-                                        {
-                                            peph.vel[sat - 1][j] = val * (j < 3 ? 0.1 : 1e-10);
-                                        }
-                                    if ((base = bfact[j < 3 ? 0 : 1]) > 0.0 && std > 0.0)
-                                        {
-                                            peph.vst[sat - 1][j] = static_cast<float>(std::pow(base, std) * (j < 3 ? 1e-7 : 1e-16));
-                                        }
-                                }
-                        }
+                    decode_sp3_record(buff, bfact, opt, &peph, &pred_o, &pred_c, &v);
                 }
             if (v)
                 {
@@ -416,6 +428,21 @@ void readsp3(const char *file, nav_t *nav, int opt)
     /* expand wild card in file path */
     n = expath(file, efiles, MAXEXFILE);
 
+    /* a single file can be served lazily from the memory-mapped store; several
+       files need the full parse so that combpeph() can merge them */
+    if (n == 1 && (ext = strrchr(efiles[0], '.')) &&
+        (strstr(ext + 1, "sp3") || strstr(ext + 1, ".SP3") ||
+            strstr(ext + 1, "eph") || strstr(ext + 1, ".EPH")) &&
+        sp3_store_open(efiles[0], opt))
+        {
+            for (i = 0; i < MAXEXFILE; i++)
+                {
+                    free(efiles[i]);
+                }
+            return;
+        }
+    sp3_store_close(); /* a full parse supersedes any previous lazy store */
+
     for (i = j = 0; i < n; i++)
         {
             if (!(ext = strrchr(efiles[i], '.')))
@@ -633,11 +660,13 @@ int pephpos(gtime_t time, int sat, const nav_t *nav, double *rs,
     double t[NMAX + 1];
     double p[3][NMAX + 1];
     double c[2];
-    double *pos;
+    const double *pos;
     double std = 0.0;
     double s[3];
     double sinl;
     double cosl;
+    const peph_t *peph = nav->peph;
+    int ne = nav->ne;
     int i;
     int j;
     int k;
@@ -647,18 +676,25 @@ int pephpos(gtime_t time, int sat, const nav_t *nav, double *rs,
 
     rs[0] = rs[1] = rs[2] = dts[0] = 0.0;
 
-    if (nav->ne < NMAX + 1 ||
-        timediff(time, nav->peph[0].time) < -MAXDTE ||
-        timediff(time, nav->peph[nav->ne - 1].time) > MAXDTE)
+    /* the lazy store serves a recentered interpolation window instead of the
+       full heap array */
+    if (sp3_store_active())
+        {
+            peph = sp3_store_window(time, &ne);
+        }
+
+    if (ne < NMAX + 1 ||
+        timediff(time, peph[0].time) < -MAXDTE ||
+        timediff(time, peph[ne - 1].time) > MAXDTE)
         {
             trace(3, "no prec ephem %s sat=%2d\n", time_str(time, 0), sat);
             return 0;
         }
     /* binary search */
-    for (i = 0, j = nav->ne - 1; i < j;)
+    for (i = 0, j = ne - 1; i < j;)
         {
             k = (i + j) / 2;
-            if (timediff(nav->peph[k].time, time) < 0.0)
+            if (timediff(peph[k].time, time) < 0.0)
                 {
                     i = k + 1;
                 }
@@ -675,15 +711,15 @@ int pephpos(gtime_t time, int sat, const nav_t *nav, double *rs,
         {
             i = 0;
         }
-    else if (i + NMAX >= nav->ne)
+    else if (i + NMAX >= ne)
         {
-            i = nav->ne - NMAX - 1;
+            i = ne - NMAX - 1;
         }
 
     for (j = 0; j <= NMAX; j++)
         {
-            t[j] = timediff(nav->peph[i + j].time, time);
-            if (norm_rtk(nav->peph[i + j].pos[sat - 1], 3) <= 0.0)
+            t[j] = timediff(peph[i + j].time, time);
+            if (norm_rtk(peph[i + j].pos[sat - 1], 3) <= 0.0)
                 {
                     trace(3, "prec ephem outage %s sat=%2d\n", time_str(time, 0), sat);
                     return 0;
@@ -691,7 +727,7 @@ int pephpos(gtime_t time, int sat, const nav_t *nav, double *rs,
         }
     for (j = 0; j <= NMAX; j++)
         {
-            pos = nav->peph[i + j].pos[sat - 1];
+            pos = peph[i + j].pos[sat - 1];
 #if 0
             p[0][j] = pos[0];
             p[1][j] = pos[1];
@@ -712,7 +748,7 @@ int pephpos(gtime_t time, int sat, const nav_t *nav, double *rs,
         {
             for (i = 0; i < 3; i++)
                 {
-                    s[i] = nav->peph[index].std[sat - 1][i];
+                    s[i] = peph[index].std[sat - 1][i];
                 }
             std = norm_rtk(s, 3);
 
@@ -728,30 +764,30 @@ int pephpos(gtime_t time, int sat, const nav_t *nav, double *rs,
             *vare = std::pow(std, 2.0);
         }
     /* linear interpolation for clock */
-    t[0] = timediff(time, nav->peph[index].time);
-    t[1] = timediff(time, nav->peph[index + 1].time);
-    c[0] = nav->peph[index].pos[sat - 1][3];
-    c[1] = nav->peph[index + 1].pos[sat - 1][3];
+    t[0] = timediff(time, peph[index].time);
+    t[1] = timediff(time, peph[index + 1].time);
+    c[0] = peph[index].pos[sat - 1][3];
+    c[1] = peph[index + 1].pos[sat - 1][3];
 
     if (t[0] <= 0.0)
         {
             if ((dts[0] = c[0]) != 0.0)
                 {
-                    std = nav->peph[index].std[sat - 1][3] * SPEED_OF_LIGHT_M_S - EXTERR_CLK * t[0];
+                    std = peph[index].std[sat - 1][3] * SPEED_OF_LIGHT_M_S - EXTERR_CLK * t[0];
                 }
         }
     else if (t[1] >= 0.0)
         {
             if ((dts[0] = c[1]) != 0.0)
                 {
-                    std = nav->peph[index + 1].std[sat - 1][3] * SPEED_OF_LIGHT_M_S + EXTERR_CLK * t[1];
+                    std = peph[index + 1].std[sat - 1][3] * SPEED_OF_LIGHT_M_S + EXTERR_CLK * t[1];
                 }
         }
     else if (c[0] != 0.0 && c[1] != 0.0)
         {
             dts[0] = (c[1] * t[0] - c[0] * t[1]) / (t[0] - t[1]);
             i = t[0] < -t[1] ? 0 : 1;
-            std = nav->peph[index + i].std[sat - 1][3] + EXTERR_CLK * fabs(t[i]);
+            std = peph[index + i].std[sat - 1][3] + EXTERR_CLK * fabs(t[i]);
         }
     else
         {
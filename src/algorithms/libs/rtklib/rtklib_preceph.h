@@ -58,6 +58,9 @@ int readsp3h(FILE *fp, gtime_t *time, char *type, int *sats,
 
 int addpeph(nav_t *nav, peph_t *peph);
 
+int decode_sp3_record(const char *buff, const double *bfact, int opt,
+    peph_t *peph, int *pred_o, int *pred_c, int *v);
+
 void readsp3b(FILE *fp, char type, int *sats, int ns, const double *bfact,
     char *tsys, int index, int opt, nav_t *nav);
 
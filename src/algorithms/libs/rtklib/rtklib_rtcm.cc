@@ -33,6 +33,7 @@
 
 #include "rtklib_rtcm.h"
 #include "rtklib_rtkcmn.h"
+#include <cstring>
 
 // extern int encode_rtcm3(rtcm_t *rtcm, int type, int sync);
 
@@ -341,6 +342,63 @@ int input_rtcm3(rtcm_t *rtcm, unsigned char data)
 }
 
 
+/* input rtcm 3 message from buffer --------------------------------------------
+ * locate the next complete rtcm 3 frame directly in a read buffer, check its
+ * parity in place and decode it, avoiding the one-call-per-byte
+ * synchronization path of input_rtcm3()
+ * args   : rtcm_t *rtcm IO   rtcm control struct
+ *          unsigned char *buff I input buffer
+ *          int    n     I    number of bytes available in buff
+ *          int    *nused O   bytes consumed (skipped garbage plus the decoded
+ *                            frame; 0 or the garbage length when the buffer
+ *                            ends with a partial frame, which the caller must
+ *                            keep for the next call)
+ * return : status (same as input_rtcm3(); 0 also when more data is needed)
+ *-----------------------------------------------------------------------------*/
+int input_rtcm3_buff(rtcm_t *rtcm, const unsigned char *buff, int n, int *nused)
+{
+    int i = 0;
+    int len;
+
+    /* synchronize frame */
+    while (i < n && buff[i] != RTCM3PREAMB)
+        {
+            i++;
+        }
+    if (i == n)
+        { /* no preamble: the whole buffer is garbage */
+            *nused = n;
+            return 0;
+        }
+    if (n - i < 3)
+        { /* wait for the message header */
+            *nused = i;
+            return 0;
+        }
+    len = getbitu(buff + i, 14, 10) + 3; /* length without parity */
+    if (n - i < len + 3)
+        { /* wait for the rest of the frame */
+            *nused = i;
+            return 0;
+        }
+    /* check parity in place, before any copy */
+    if (rtk_crc24q(buff + i, len) != getbitu(buff + i, len * 8, 24))
+        {
+            trace(2, "rtcm3 parity error: len=%d\n", len);
+            *nused = i + 1; /* resynchronize past this preamble */
+            return 0;
+        }
+    /* single copy of the complete frame into the decoder buffer */
+    memcpy(rtcm->buff, buff + i, len + 3);
+    rtcm->len = len;
+    rtcm->nbyte = 0;
+    *nused = i + len + 3;
+
+    /* decode rtcm3 message */
+    return decode_rtcm3(rtcm);
+}
+
+
 /* input rtcm 2 message from file ----------------------------------------------
  * fetch next rtcm 2 message and input a message from file
  * args   : rtcm_t *rtcm IO   rtcm control struct
@@ -47,6 +47,11 @@ int init_rtcm(rtcm_t *rtcm);
 void free_rtcm(rtcm_t *rtcm);
 int input_rtcm2(rtcm_t *rtcm, unsigned char data);
 int input_rtcm3(rtcm_t *rtcm, unsigned char data);
+
+/* input rtcm 3 message from buffer: locates the next complete frame directly
+   in a read buffer, checks its parity in place and decodes it, avoiding the
+   one-call-per-byte synchronization path of input_rtcm3() */
+int input_rtcm3_buff(rtcm_t *rtcm, const unsigned char *buff, int n, int *nused);
 int input_rtcm2f(rtcm_t *rtcm, FILE *fp);
 int input_rtcm3f(rtcm_t *rtcm, FILE *fp);
 int gen_rtcm2(rtcm_t *rtcm, int type, int sync);
@@ -31,11 +31,13 @@
 
 #include "rtklib_rtkcmn.h"
 #include <glog/logging.h>
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstring>
 #include <dirent.h>
 #include <iomanip>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
@@ -1064,6 +1066,109 @@ double *eye(int n)
 }
 
 
+/* per-thread epoch arena ------------------------------------------------------
+ * bump allocator backing Rtk_Arena_Scope. Blocks grow to the working-set
+ * size of one solver epoch and are then reused, so steady-state operation
+ * performs no heap allocation inside the linear algebra helpers
+ *-----------------------------------------------------------------------------*/
+namespace
+{
+struct Rtk_Arena
+{
+    struct Block
+    {
+        std::unique_ptr<double[]> data;
+        std::size_t size = 0;
+    };
+    std::vector<Block> blocks;
+    std::size_t block_index = 0;
+    std::size_t offset = 0;
+
+    double *allocate(std::size_t n_elem)
+    {
+        while (block_index < blocks.size() && blocks[block_index].size - offset < n_elem)
+            {
+                block_index++;
+                offset = 0;
+            }
+        if (block_index == blocks.size())
+            {
+                const std::size_t block_size = std::max<std::size_t>(n_elem, 4096);
+                blocks.push_back({std::unique_ptr<double[]>(new double[block_size]), block_size});
+            }
+        double *p = blocks[block_index].data.get() + offset;
+        offset += n_elem;
+        return p;
+    }
+};
+
+thread_local Rtk_Arena rtk_arena;
+}  // namespace
+
+
+Rtk_Arena_Scope::Rtk_Arena_Scope()
+    : d_block(rtk_arena.block_index),
+      d_offset(rtk_arena.offset)
+{
+}
+
+
+Rtk_Arena_Scope::~Rtk_Arena_Scope()
+{
+    rtk_arena.block_index = d_block;
+    rtk_arena.offset = d_offset;
+}
+
+
+double *Rtk_Arena_Scope::mat(int n, int m)
+{
+    if (n <= 0 || m <= 0)
+        {
+            return nullptr;
+        }
+    return rtk_arena.allocate(static_cast<std::size_t>(n) * m);
+}
+
+
+double *Rtk_Arena_Scope::zeros(int n, int m)
+{
+    double *p = mat(n, m);
+    if (p)
+        {
+            memset(p, 0, sizeof(double) * n * m);
+        }
+    return p;
+}
+
+
+double *Rtk_Arena_Scope::eye(int n)
+{
+    double *p = zeros(n, n);
+    int i;
+
+    if (p)
+        {
+            for (i = 0; i < n; i++)
+                {
+                    p[i + i * n] = 1.0;
+                }
+        }
+    return p;
+}
+
+
+int *Rtk_Arena_Scope::imat(int n, int m)
+{
+    if (n <= 0 || m <= 0)
+        {
+            return nullptr;
+        }
+    /* integer scratch lives in the same double-aligned blocks */
+    const std::size_t n_doubles = (sizeof(int) * n * m + sizeof(double) - 1) / sizeof(double);
+    return reinterpret_cast<int *>(rtk_arena.allocate(n_doubles));
+}
+
+
 /* inner product ---------------------------------------------------------------
  * inner product of vectors
  * args   : double *a,*b     I   vector a,b (n x 1)
@@ -1172,19 +1277,18 @@ void matmul(const char *tr, int n, int k, int m, double alpha,
  *-----------------------------------------------------------------------------*/
 int matinv(double *A, int n)
 {
+    Rtk_Arena_Scope arena;
     double *work;
     int info;
     int lwork = n * 16;
-    int *ipiv = imat(n, 1);
+    int *ipiv = arena.imat(n, 1);
 
-    work = mat(lwork, 1);
+    work = arena.mat(lwork, 1);
     dgetrf_(&n, &n, A, &n, ipiv, &info);
     if (!info)
         {
             dgetri_(&n, A, &n, ipiv, work, &lwork, &info);
         }
-    free(ipiv);
-    free(work);
     return info;
 }
 
@@ -1203,9 +1307,10 @@ int matinv(double *A, int n)
 int solve(const char *tr, const double *A, const double *Y, int n,
     int m, double *X)
 {
-    double *B = mat(n, n);
+    Rtk_Arena_Scope arena;
+    double *B = arena.mat(n, n);
     int info;
-    int *ipiv = imat(n, 1);
+    int *ipiv = arena.imat(n, 1);
 
     matcpy(B, A, n, n);
     matcpy(X, Y, n, m);
@@ -1214,8 +1319,6 @@ int solve(const char *tr, const double *A, const double *Y, int n,
         {
             dgetrs_(const_cast<char *>(tr), &n, &m, B, &n, ipiv, X, &n, &info);
         }
-    free(ipiv);
-    free(B);
     return info;
 }
 
@@ -1236,6 +1339,7 @@ int solve(const char *tr, const double *A, const double *Y, int n,
 int lsq(const double *A, const double *y, int n, int m, double *x,
     double *Q)
 {
+    Rtk_Arena_Scope arena;
     double *Ay;
     int info;
 
@@ -1243,14 +1347,13 @@ int lsq(const double *A, const double *y, int n, int m, double *x,
         {
             return -1;
         }
-    Ay = mat(n, 1);
+    Ay = arena.mat(n, 1);
     matmul("NN", n, 1, m, 1.0, A, y, 0.0, Ay); /* Ay=A*y */
     matmul("NT", n, n, m, 1.0, A, A, 0.0, Q);  /* Q=A*A' */
     if (!(info = matinv(Q, n)))
         {
             matmul("NN", n, 1, n, 1.0, Q, Ay, 0.0, x); /* x=Q^-1*Ay */
         }
-    free(Ay);
     return info;
 }
 
@@ -1276,10 +1379,11 @@ int filter_(const double *x, const double *P, const double *H,
     const double *v, const double *R, int n, int m,
     double *xp, double *Pp)
 {
-    double *F = mat(n, m);
-    double *Q = mat(m, m);
-    double *K = mat(n, m);
-    double *I = eye(n);
+    Rtk_Arena_Scope arena;
+    double *F = arena.mat(n, m);
+    double *Q = arena.mat(m, m);
+    double *K = arena.mat(n, m);
+    double *I = arena.eye(n);
     int info;
 
     matcpy(Q, R, m, m);
@@ -1293,10 +1397,6 @@ int filter_(const double *x, const double *P, const double *H,
             matmul("NT", n, n, m, -1.0, K, H, 1.0, I); /* Pp=(I-K*H')*P */
             matmul("NN", n, n, n, 1.0, I, P, 0.0, Pp);
         }
-    free(F);
-    free(Q);
-    free(K);
-    free(I);
     return info;
 }
 
@@ -1315,7 +1415,8 @@ int filter(double *x, double *P, const double *H, const double *v,
     int info;
     int *ix;
 
-    ix = imat(n, 1);
+    Rtk_Arena_Scope arena;
+    ix = arena.imat(n, 1);
     for (i = k = 0; i < n; i++)
         {
             if (x[i] != 0.0 && P[i + i * n] > 0.0)
@@ -1323,10 +1424,10 @@ int filter(double *x, double *P, const double *H, const double *v,
                     ix[k++] = i;
                 }
         }
-    x_ = mat(k, 1);
-    xp_ = mat(k, 1);
-    P_ = mat(k, k);
-    Pp_ = mat(k, k);
+    x_ = arena.mat(k, 1);
+    xp_ = arena.mat(k, 1);
+    P_ = arena.mat(k, k);
+    Pp_ = arena.mat(k, k);
     for (i = 0; i < k; i++)
         {
             for (j = 0; j < k; j++)
@@ -1334,7 +1435,7 @@ int filter(double *x, double *P, const double *H, const double *v,
                     Pp_[i * k + j] = 0.0;
                 }
         }
-    H_ = mat(k, m);
+    H_ = arena.mat(k, m);
     for (i = 0; i < k; i++)
         {
             x_[i] = x[ix[i]];
@@ -1356,12 +1457,6 @@ int filter(double *x, double *P, const double *H, const double *v,
                     P[ix[i] + ix[j] * n] = Pp_[i + j * k];
                 }
         }
-    free(ix);
-    free(x_);
-    free(xp_);
-    free(P_);
-    free(Pp_);
-    free(H_);
     return info;
 }
 
@@ -1385,9 +1480,10 @@ int filter(double *x, double *P, const double *H, const double *v,
 int smoother(const double *xf, const double *Qf, const double *xb,
     const double *Qb, int n, double *xs, double *Qs)
 {
-    double *invQf = mat(n, n);
-    double *invQb = mat(n, n);
-    double *xx = mat(n, 1);
+    Rtk_Arena_Scope arena;
+    double *invQf = arena.mat(n, n);
+    double *invQb = arena.mat(n, n);
+    double *xx = arena.mat(n, 1);
     int i;
     int info = -1;
 
@@ -1406,9 +1502,6 @@ int smoother(const double *xf, const double *Qf, const double *xb,
                     matmul("NN", n, 1, n, 1.0, Qs, xx, 0.0, xs);
                 }
         }
-    free(invQf);
-    free(invQb);
-    free(xx);
     return info;
 }
 
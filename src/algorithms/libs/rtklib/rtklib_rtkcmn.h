@@ -139,6 +139,29 @@ double *mat(int n, int m);
 int *imat(int n, int m);
 double *zeros(int n, int m);
 double *eye(int n);
+
+/* per-thread epoch arena for linear algebra temporaries ----------------------
+ * hands out bump-allocated scratch matrices for the helpers below (matinv,
+ * solve, lsq, filter, smoother), replacing one malloc/free round-trip per
+ * temporary with a pointer bump. Scopes nest in stack order and release
+ * their memory on destruction; pointers obtained from a scope must not
+ * outlive it */
+class Rtk_Arena_Scope
+{
+public:
+    Rtk_Arena_Scope();
+    ~Rtk_Arena_Scope();
+    Rtk_Arena_Scope(const Rtk_Arena_Scope &) = delete;
+    Rtk_Arena_Scope &operator=(const Rtk_Arena_Scope &) = delete;
+    double *mat(int n, int m);   /* uninitialized n x m scratch matrix */
+    double *zeros(int n, int m); /* zero-initialized n x m scratch matrix */
+    double *eye(int n);          /* n x n identity scratch matrix */
+    int *imat(int n, int m);     /* uninitialized n x m integer scratch matrix */
+
+private:
+    std::size_t d_block;
+    std::size_t d_offset;
+};
 double dot(const double *a, const double *b, int n);
 double norm_rtk(const double *a, int n);
 void cross3(const double *a, const double *b, double *c);
@@ -36,6 +36,7 @@
 #include "rtklib_rtkpos.h"
 #include "rtklib_sbas.h"
 #include "rtklib_solution.h"
+#include "rtklib_sp3_store.h"
 #include "rtklib_stream.h"
 #include <cstring>
 
@@ -386,6 +387,57 @@ int decoderaw(rtksvr_t *svr, int index)
 
     rtksvrlock(svr);
 
+    if (svr->format[index] == STRFMT_RTCM3)
+        {
+            /* frame-oriented path: complete frames are located (and their
+               parity checked) directly in the read buffer and enter the
+               decoder with a single copy each, instead of one state-machine
+               call per byte. A trailing partial frame stays in the read
+               buffer until the next cycle */
+            int pos = 0;
+            int nused = 0;
+            obs = &svr->rtcm[index].obs;
+            nav = &svr->rtcm[index].nav;
+            while (pos < svr->nb[index])
+                {
+                    ret = input_rtcm3_buff(svr->rtcm + index, svr->buff[index] + pos, svr->nb[index] - pos, &nused);
+                    pos += nused;
+                    sat = svr->rtcm[index].ephsat;
+
+                    /* update rtk server */
+                    if (ret > 0)
+                        {
+                            updatesvr(svr, ret, obs, nav, sat, sbsmsg, index, fobs);
+                        }
+
+                    /* observation data received */
+                    if (ret == 1)
+                        {
+                            if (fobs < MAXOBSBUF)
+                                {
+                                    fobs++;
+                                }
+                            else
+                                {
+                                    svr->prcout++;
+                                }
+                        }
+                    if (nused == 0)
+                        { /* partial frame: wait for more data */
+                            break;
+                        }
+                }
+            if (pos > 0 && pos < svr->nb[index])
+                {
+                    memmove(svr->buff[index], svr->buff[index] + pos, svr->nb[index] - pos);
+                }
+            svr->nb[index] -= pos;
+
+            rtksvrunlock(svr);
+
+            return fobs;
+        }
+
     for (i = 0; i < svr->nb[index]; i++)
         {
             /* input rtcm/receiver raw data from stream */
@@ -396,13 +448,6 @@ int decoderaw(rtksvr_t *svr, int index)
                     nav = &svr->rtcm[index].nav;
                     sat = svr->rtcm[index].ephsat;
                 }
-            else if (svr->format[index] == STRFMT_RTCM3)
-                {
-                    ret = input_rtcm3(svr->rtcm + index, svr->buff[index][i]);
-                    obs = &svr->rtcm[index].obs;
-                    nav = &svr->rtcm[index].nav;
-                    sat = svr->rtcm[index].ephsat;
-                }
             else
                 {
                     // Disabled !!
@@ -472,9 +517,10 @@ void decodefile(rtksvr_t *svr, int index)
 
     if (svr->format[index] == STRFMT_SP3)
         { /* precise ephemeris */
-            /* read sp3 precise ephemeris */
+            /* read sp3 precise ephemeris (single files are memory-mapped and
+               parsed lazily by the sp3 store instead of filling nav) */
             readsp3(file, &nav, 0);
-            if (nav.ne <= 0)
+            if (nav.ne <= 0 && !sp3_store_active())
                 {
                     tracet(1, "sp3 file read error: %s\n", file);
                     return;
@@ -482,12 +528,15 @@ void decodefile(rtksvr_t *svr, int index)
             /* update precise ephemeris */
             rtksvrlock(svr);
 
-            if (svr->nav.peph)
+            if (nav.ne > 0)
                 {
-                    free(svr->nav.peph);
+                    if (svr->nav.peph)
+                        {
+                            free(svr->nav.peph);
+                        }
+                    svr->nav.ne = svr->nav.nemax = nav.ne;
+                    svr->nav.peph = nav.peph;
                 }
-            svr->nav.ne = svr->nav.nemax = nav.ne;
-            svr->nav.peph = nav.peph;
             svr->ftime[index] = utc2gpst(timeget());
             std::strncpy(svr->files[index], file, MAXSTRPATH);
 
@@ -554,7 +603,7 @@ void *rtksvrthread(void *arg)
                     q = svr->buff[i] + svr->buffsize;
 
                     /* read receiver raw/rtcm data from input stream */
-                    if ((n = strread(svr->stream + i, p, static_cast<int>(q[0]) - static_cast<int>(p[0]))) <= 0)
+                    if ((n = strread(svr->stream + i, p, static_cast<int>(q - p))) <= 0)
                         {
                             continue;
                         }
@@ -562,12 +611,9 @@ void *rtksvrthread(void *arg)
                     strwrite(svr->stream + i + 5, p, n);
                     svr->nb[i] += n;
 
-                    /* save peek buffer */
-                    rtksvrlock(svr);
-                    n = n < svr->buffsize - svr->npb[i] ? n : svr->buffsize - svr->npb[i];
-                    memcpy(svr->pbuf[i] + svr->npb[i], p, n);
-                    svr->npb[i] += n;
-                    rtksvrunlock(svr);
+                    /* note: the original code also copied the data into a peek
+                       buffer (svr->pbuf) here, but nothing reads it in this
+                       build, so that extra per-cycle copy is skipped */
                 }
             for (i = 0; i < 3; i++)
                 {
@@ -530,6 +530,79 @@ int decode_sbstype26(const sbsmsg_t *msg, sbsion_t *sbsion)
 }
 
 
+/* igp index grid slot of an igp latitude/longitude --------------------------*/
+int sbsigpslot(int lat, int lon)
+{
+    if (lat < -85 || lat > 85 || lon < -180 || lon > 175 || lat % 5 || lon % 5)
+        {
+            return -1;
+        }
+    return (lat + 85) / 5 * SBSIGP_NLON + (lon + 180) / 5;
+}
+
+
+/* update satellite correction index -------------------------------------------
+ * rebuild the satellite number to correction slot index after a type 1 prn
+ * mask update, so that the per-epoch correction functions look the slot up
+ * directly instead of scanning the mask
+ * args   : sbssat_t *sbssat IO  satellite correction parameters
+ * return : none
+ *-----------------------------------------------------------------------------*/
+void sbs_index_sat(sbssat_t *sbssat)
+{
+    int i;
+    int sat;
+
+    trace(4, "sbs_index_sat: nsat=%d\n", sbssat->nsat);
+
+    for (i = 0; i < MAXSAT; i++)
+        {
+            sbssat->satidx[i] = 0;
+        }
+    for (i = 0; i < sbssat->nsat && i < MAXSAT; i++)
+        {
+            sat = sbssat->sat[i].sat;
+            if (1 <= sat && sat <= MAXSAT)
+                {
+                    sbssat->satidx[sat - 1] = static_cast<short>(i + 1);
+                }
+        }
+}
+
+
+/* update ionospheric grid point index -----------------------------------------
+ * rebuild the (lat,lon) to igp slot index after a type 18 igp mask update, so
+ * that searchigp() resolves the four igps around the pierce point directly
+ * instead of scanning every band
+ * args   : nav_t *nav       IO  navigation data
+ * return : none
+ *-----------------------------------------------------------------------------*/
+void sbs_index_igp(nav_t *nav)
+{
+    int band;
+    int j;
+    int slot;
+
+    trace(4, "sbs_index_igp:\n");
+
+    for (slot = 0; slot < SBSIGP_NLAT * SBSIGP_NLON; slot++)
+        {
+            nav->sbsigpidx[slot] = 0;
+        }
+    for (band = 0; band <= MAXBAND; band++)
+        {
+            for (j = 0; j < nav->sbsion[band].nigp && j < MAXNIGP; j++)
+                {
+                    slot = sbsigpslot(nav->sbsion[band].igp[j].lat, nav->sbsion[band].igp[j].lon);
+                    if (slot >= 0)
+                        {
+                            nav->sbsigpidx[slot] = static_cast<short>(band * MAXNIGP + j + 1);
+                        }
+                }
+        }
+}
+
+
 /* update sbas corrections -----------------------------------------------------
  * update sbas correction parameters in navigation data with a sbas message
  * args   : sbsmg_t  *msg    I   sbas message
@@ -558,6 +631,10 @@ int sbsupdatecorr(const sbsmsg_t *msg, nav_t *nav)
             break;
         case 1:
             stat = decode_sbstype1(msg, &nav->sbssat);
+            if (stat)
+                {
+                    sbs_index_sat(&nav->sbssat);
+                }
             break;
         case 2:
         case 3:
@@ -576,6 +653,10 @@ int sbsupdatecorr(const sbsmsg_t *msg, nav_t *nav)
             break;
         case 18:
             stat = decode_sbstype18(msg, nav->sbsion);
+            if (stat)
+                {
+                    sbs_index_igp(nav);
+                }
             break;
         case 24:
             stat = decode_sbstype24(msg, &nav->sbssat);
@@ -838,9 +919,11 @@ void sbsoutmsg(FILE *fp, sbsmsg_t *sbsmsg)
 
 /* search igps ---------------------------------------------------------------*/
 void searchigp(gtime_t time __attribute__((unused)), const double *pos, const sbsion_t *ion,
-    const sbsigp_t **igp, double *x, double *y)
+    const short *igpidx, const sbsigp_t **igp, double *x, double *y)
 {
     int i;
+    int slot;
+    int v;
     int latp[2];
     int lonp[4];
     double lat = pos[0] * R2D;
@@ -902,6 +985,24 @@ void searchigp(gtime_t time __attribute__((unused)), const double *pos, const sb
                     lonp[i] = -180;
                 }
         }
+    if (igpidx)
+        {
+            /* direct slot lookup in the index kept by sbs_index_igp() */
+            for (i = 0; i < 4; i++)
+                {
+                    slot = sbsigpslot(latp[i % 2], lonp[i]);
+                    if (slot < 0 || (v = igpidx[slot]) == 0)
+                        {
+                            continue;
+                        }
+                    p = ion[(v - 1) / MAXNIGP].igp + (v - 1) % MAXNIGP;
+                    if (p->t0.time != 0 && p->give > 0)
+                        {
+                            igp[i] = p;
+                        }
+                }
+            return;
+        }
     for (i = 0; i <= MAXBAND; i++)
         {
             for (p = ion[i].igp; p < ion[i].igp + ion[i].nigp; p++)
@@ -976,7 +1077,7 @@ int sbsioncorr(gtime_t time, const nav_t *nav, const double *pos,
     fp = ionppp(pos, azel, re, hion, posp);
 
     /* search igps around ipp */
-    searchigp(time, posp, nav->sbsion, igp, &x, &y);
+    searchigp(time, posp, nav->sbsion, nav->sbsigpidx, igp, &x, &y);
 
     /* weight of igps */
     if (igp[0] && igp[1] && igp[2] && igp[3])
@@ -1148,6 +1249,27 @@ double sbstropcorr(gtime_t time, const double *pos, const double *azel,
 }
 
 
+/* correction slot of a satellite --------------------------------------------*/
+const sbssatp_t *sbsgetsatp(const sbssat_t *sbssat, int sat)
+{
+    const sbssatp_t *p;
+
+    if (1 <= sat && sat <= MAXSAT && sbssat->satidx[sat - 1] > 0)
+        {
+            return sbssat->sat + sbssat->satidx[sat - 1] - 1;
+        }
+    /* mask filled without passing through sbsupdatecorr(): scan it linearly */
+    for (p = sbssat->sat; p < sbssat->sat + sbssat->nsat; p++)
+        {
+            if (p->sat == sat)
+                {
+                    return p;
+                }
+        }
+    return nullptr;
+}
+
+
 /* long term correction ------------------------------------------------------*/
 int sbslongcorr(gtime_t time, int sat, const sbssat_t *sbssat,
     double *drs, double *ddts)
@@ -1158,12 +1280,9 @@ int sbslongcorr(gtime_t time, int sat, const sbssat_t *sbssat,
 
     trace(3, "sbslongcorr: sat=%2d\n", sat);
 
-    for (p = sbssat->sat; p < sbssat->sat + sbssat->nsat; p++)
+    p = sbsgetsatp(sbssat, sat);
+    if (p && p->lcorr.t0.time != 0)
         {
-            if (p->sat != sat || p->lcorr.t0.time == 0)
-                {
-                    continue;
-                }
             t = timediff(time, p->lcorr.t0);
             if (fabs(t) > MAXSBSAGEL)
                 {
@@ -1202,35 +1321,27 @@ int sbsfastcorr(gtime_t time, int sat, const sbssat_t *sbssat,
 
     trace(3, "sbsfastcorr: sat=%2d\n", sat);
 
-    for (p = sbssat->sat; p < sbssat->sat + sbssat->nsat; p++)
+    p = sbsgetsatp(sbssat, sat);
+    if (p && p->fcorr.t0.time != 0)
         {
-            if (p->sat != sat)
-                {
-                    continue;
-                }
-            if (p->fcorr.t0.time == 0)
-                {
-                    break;
-                }
             t = timediff(time, p->fcorr.t0) + sbssat->tlat;
 
             /* expire age of correction or UDRE==14 (not monitored) */
-            if (fabs(t) > MAXSBSAGEF || p->fcorr.udre >= 15)
+            if (fabs(t) <= MAXSBSAGEF && p->fcorr.udre < 15)
                 {
-                    continue;
-                }
-            *prc = p->fcorr.prc;
+                    *prc = p->fcorr.prc;
 #ifdef RRCENA
-            if (p->fcorr.ai > 0 && fabs(t) <= 8.0 * p->fcorr.dt)
-                {
-                    *prc += p->fcorr.rrc * t;
-                }
+                    if (p->fcorr.ai > 0 && fabs(t) <= 8.0 * p->fcorr.dt)
+                        {
+                            *prc += p->fcorr.rrc * t;
+                        }
 #endif
-            *var = varfcorr(p->fcorr.udre) + degfcorr(p->fcorr.ai) * t * t / 2.0;
+                    *var = varfcorr(p->fcorr.udre) + degfcorr(p->fcorr.ai) * t * t / 2.0;
 
-            trace(5, "sbsfastcorr: sat=%3d prc=%7.2f sig=%7.2f t=%5.0f\n", sat,
-                *prc, sqrt(*var), t);
-            return 1;
+                    trace(5, "sbsfastcorr: sat=%3d prc=%7.2f sig=%7.2f t=%5.0f\n", sat,
+                        *prc, sqrt(*var), t);
+                    return 1;
+                }
         }
     trace(2, "no sbas fast correction: %s sat=%2d\n", time_str(time, 0), sat);
     return 0;
@@ -114,6 +114,11 @@ int decode_sbstype24(const sbsmsg_t *msg, sbssat_t *sbssat);
 int decode_sbstype25(const sbsmsg_t *msg, sbssat_t *sbssat);
 int decode_sbstype26(const sbsmsg_t *msg, sbsion_t *sbsion);
 
+int sbsigpslot(int lat, int lon);
+void sbs_index_sat(sbssat_t *sbssat);
+void sbs_index_igp(nav_t *nav);
+const sbssatp_t *sbsgetsatp(const sbssat_t *sbssat, int sat);
+
 int sbsupdatecorr(const sbsmsg_t *msg, nav_t *nav);
 void readmsgs(const char *file, int sel, gtime_t ts, gtime_t te, sbs_t *sbs);
 int cmpmsgs(const void *p1, const void *p2);
@@ -122,7 +127,7 @@ int sbsreadmsgt(const char *file, int sel, gtime_t ts, gtime_t te,
 int sbsreadmsg(const char *file, int sel, sbs_t *sbs);
 void sbsoutmsg(FILE *fp, sbsmsg_t *sbsmsg);
 void searchigp(gtime_t time, const double *pos, const sbsion_t *ion,
-    const sbsigp_t **igp, double *x, double *y);
+    const short *igpidx, const sbsigp_t **igp, double *x, double *y);
 int sbsioncorr(gtime_t time, const nav_t *nav, const double *pos,
     const double *azel, double *delay, double *var);
 
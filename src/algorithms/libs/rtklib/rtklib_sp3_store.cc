@@ -0,0 +1,292 @@
+/*!
+ * \file rtklib_sp3_store.cc
+ * \brief memory-mapped lazy store for sp3 precise ephemeris files
+ * \authors <ul>
+ *          <li> 2026, Carles Fernandez
+ *          </ul>
+ *
+ * This is a derived work from RTKLIB http://www.rtklib.com/
+ * The original source code at https://github.com/tomojitakasu/RTKLIB is
+ * released under the BSD 2-clause license with an additional exclusive clause
+ * that does not apply here. This additional clause is reproduced below:
+ *
+ * " The software package includes some companion executive binaries or shared
+ * libraries necessary to execute APs on Windows. These licenses succeed to the
+ * original ones of these software. "
+ *
+ * Neither the executive binaries nor the shared libraries are required by, used
+ * or included in GNSS-SDR.
+ *
+ * -----------------------------------------------------------------------------
+ * Copyright (C) 2026, Carles Fernandez
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtklib_sp3_store.h"
+#include "rtklib_preceph.h"
+#include "rtklib_rtkcmn.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+/* single store instance: rtksvr feeds at most one precise ephemeris stream */
+namespace
+{
+struct Sp3_Store
+{
+    const char *map = nullptr; /* memory-mapped file content */
+    size_t size = 0;
+    double bfact[2] = {0.0, 0.0};
+    int opt = 0;
+    std::vector<size_t> epoch_offset; /* byte offset of each '*' epoch header */
+    std::vector<gtime_t> epoch_time;
+    std::vector<peph_t> window; /* hot interpolation window */
+    std::atomic<int> window_start{-1};
+    lock_t lock = PTHREAD_MUTEX_INITIALIZER;
+    int active = 0;
+};
+
+Sp3_Store sp3_store;
+
+
+/* copy one line of the mapping into a NUL-terminated buffer and advance */
+const char *get_line(const char *p, const char *end, char *buff, size_t nmax)
+{
+    const char *eol = static_cast<const char *>(memchr(p, '\n', end - p));
+    size_t len = (eol ? eol : end) - p;
+    if (len >= nmax)
+        {
+            len = nmax - 1;
+        }
+    memcpy(buff, p, len);
+    buff[len] = '\0';
+    return eol ? eol + 1 : end;
+}
+
+
+/* parse epochs [start, start+count) of the mapping into the window */
+void fill_window(int start, int count)
+{
+    char buff[1024];
+    int k;
+    int pred_o;
+    int pred_c;
+    int v;
+
+    for (k = 0; k < count; k++)
+        {
+            peph_t &peph = sp3_store.window[k];
+            peph = peph_t{};
+            peph.time = sp3_store.epoch_time[start + k];
+            peph.index = 0;
+
+            const char *p = sp3_store.map + sp3_store.epoch_offset[start + k];
+            const char *end = sp3_store.map + sp3_store.size;
+            p = get_line(p, end, buff, sizeof(buff)); /* skip the epoch header */
+            pred_o = pred_c = v = 0;
+            while (p < end)
+                {
+                    const char *next = get_line(p, end, buff, sizeof(buff));
+                    if (buff[0] == '*' || !strncmp(buff, "EOF", 3))
+                        {
+                            break;
+                        }
+                    decode_sp3_record(buff, sp3_store.bfact, sp3_store.opt, &peph, &pred_o, &pred_c, &v);
+                    p = next;
+                }
+        }
+}
+}  // namespace
+
+
+/* map and index an sp3 file; returns number of epochs, 0 on error -----------*/
+int sp3_store_open(const char *file, int opt)
+{
+    gtime_t time = {0, 0};
+    gtime_t t;
+    std::vector<int> sats(MAXSAT);
+    struct stat st
+    {
+    };
+    FILE *fp;
+    void *map;
+    const char *p;
+    const char *end;
+    const char *line;
+    char type = ' ';
+    char tsys[4] = "";
+    char buff[1024];
+    int fd;
+    int ns;
+
+    trace(3, "sp3_store_open: file=%s opt=%d\n", file, opt);
+
+    sp3_store_close();
+
+    if ((fd = open(file, O_RDONLY | O_CLOEXEC)) < 0)
+        {
+            trace(2, "sp3 file open error %s\n", file);
+            return 0;
+        }
+    if (fstat(fd, &st) < 0 || st.st_size <= 0)
+        {
+            close(fd);
+            return 0;
+        }
+    map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); /* the mapping keeps its own reference */
+    if (map == MAP_FAILED)
+        {
+            trace(2, "sp3 file mmap error %s\n", file);
+            return 0;
+        }
+    sp3_store.map = static_cast<const char *>(map);
+    sp3_store.size = static_cast<size_t>(st.st_size);
+
+    /* reuse the sp3 header parser on the mapping */
+    if (!(fp = fmemopen(const_cast<char *>(sp3_store.map), sp3_store.size, "r")))
+        {
+            sp3_store_close();
+            return 0;
+        }
+    ns = readsp3h(fp, &time, &type, sats.data(), sp3_store.bfact, tsys);
+    fclose(fp);
+    if (ns <= 0)
+        {
+            sp3_store_close();
+            return 0;
+        }
+
+    /* index the byte offset and time of each epoch header */
+    p = sp3_store.map;
+    end = p + sp3_store.size;
+    while (p < end)
+        {
+            line = p;
+            p = get_line(p, end, buff, sizeof(buff));
+            if (!strncmp(buff, "EOF", 3))
+                {
+                    break;
+                }
+            if (buff[0] != '*')
+                {
+                    continue;
+                }
+            if (str2time(buff, 3, 28, &t))
+                {
+                    trace(2, "sp3 invalid epoch %31.31s\n", buff);
+                    continue;
+                }
+            if (!strcmp(tsys, "UTC"))
+                {
+                    t = utc2gpst(t); /* utc->gpst */
+                }
+            sp3_store.epoch_offset.push_back(line - sp3_store.map);
+            sp3_store.epoch_time.push_back(t);
+        }
+    if (sp3_store.epoch_time.empty())
+        {
+            sp3_store_close();
+            return 0;
+        }
+
+    sp3_store.opt = opt;
+    sp3_store.window.assign(std::min(static_cast<int>(sp3_store.epoch_time.size()), NMAX + 1), peph_t{});
+    sp3_store.window_start.store(-1, std::memory_order_relaxed);
+    sp3_store.active = 1;
+
+    trace(2, "sp3_store_open: file=%s ne=%d\n", file, static_cast<int>(sp3_store.epoch_time.size()));
+    return static_cast<int>(sp3_store.epoch_time.size());
+}
+
+
+/* release the mapping and deactivate the store ------------------------------*/
+void sp3_store_close(void)
+{
+    if (sp3_store.map)
+        {
+            munmap(const_cast<char *>(sp3_store.map), sp3_store.size);
+        }
+    sp3_store.map = nullptr;
+    sp3_store.size = 0;
+    sp3_store.epoch_offset.clear();
+    sp3_store.epoch_time.clear();
+    sp3_store.window.clear();
+    sp3_store.window_start.store(-1, std::memory_order_relaxed);
+    sp3_store.active = 0;
+}
+
+
+/* 1 if a store is currently serving precise ephemeris -----------------------*/
+int sp3_store_active(void)
+{
+    return sp3_store.active;
+}
+
+
+/* recenter the hot window on time and return it -----------------------------*/
+const peph_t *sp3_store_window(gtime_t time, int *ne)
+{
+    int i;
+    int j;
+    int k;
+    int index;
+    int start;
+
+    if (!sp3_store.active)
+        {
+            *ne = 0;
+            return nullptr;
+        }
+    const int nepoch = static_cast<int>(sp3_store.epoch_time.size());
+    const int nw = static_cast<int>(sp3_store.window.size());
+
+    /* binary search, as pephpos does over the full array */
+    for (i = 0, j = nepoch - 1; i < j;)
+        {
+            k = (i + j) / 2;
+            if (timediff(sp3_store.epoch_time[k], time) < 0.0)
+                {
+                    i = k + 1;
+                }
+            else
+                {
+                    j = k;
+                }
+        }
+    index = i <= 0 ? 0 : i - 1;
+    start = index - (NMAX + 1) / 2;
+    if (start < 0)
+        {
+            start = 0;
+        }
+    else if (start + nw > nepoch)
+        {
+            start = nepoch - nw;
+        }
+
+    /* concurrent callers of the same epoch (e.g. the satposs worker threads)
+       agree on the window start, so only the first one pays for the reparse */
+    if (sp3_store.window_start.load(std::memory_order_acquire) != start)
+        {
+            rtk_lock(&sp3_store.lock);
+            if (sp3_store.window_start.load(std::memory_order_relaxed) != start)
+                {
+                    fill_window(start, nw);
+                    sp3_store.window_start.store(start, std::memory_order_release);
+                }
+            rtk_unlock(&sp3_store.lock);
+        }
+    *ne = nw;
+    return sp3_store.window.data();
+}
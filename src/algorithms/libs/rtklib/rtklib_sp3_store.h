@@ -0,0 +1,59 @@
+/*!
+ * \file rtklib_sp3_store.h
+ * \brief memory-mapped lazy store for sp3 precise ephemeris files
+ * \authors <ul>
+ *          <li> 2026, Carles Fernandez
+ *          </ul>
+ *
+ * This is a derived work from RTKLIB http://www.rtklib.com/
+ * The original source code at https://github.com/tomojitakasu/RTKLIB is
+ * released under the BSD 2-clause license with an additional exclusive clause
+ * that does not apply here. This additional clause is reproduced below:
+ *
+ * " The software package includes some companion executive binaries or shared
+ * libraries necessary to execute APs on Windows. These licenses succeed to the
+ * original ones of these software. "
+ *
+ * Neither the executive binaries nor the shared libraries are required by, used
+ * or included in GNSS-SDR.
+ *
+ * -----------------------------------------------------------------------------
+ * Copyright (C) 2026, Carles Fernandez
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ *
+ * References :
+ *    [1] S.Hilla, The Extended Standard Product 3 Orbit Format (SP3-c),
+ *        12 February, 2007
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_RTKLIB_SP3_STORE_H
+#define GNSS_SDR_RTKLIB_SP3_STORE_H
+
+#include "rtklib.h"
+
+/* Instead of parsing an sp3 file into a heap array of peph_t covering every
+ * epoch, the store memory-maps the file, indexes the byte offset of each epoch
+ * header and parses records lazily: only the NMAX+1 epochs of the active
+ * interpolation window are kept materialized. Long-duration PPP runs with
+ * multi-day products keep their resident set bounded by the window size and
+ * skip the full startup parse. */
+
+/* map and index an sp3 file; returns number of epochs, 0 on error */
+int sp3_store_open(const char *file, int opt);
+
+/* release the mapping and deactivate the store */
+void sp3_store_close(void);
+
+/* 1 if a store is currently serving precise ephemeris */
+int sp3_store_active(void);
+
+/* recenter the hot window on time and return it; *ne receives the number of
+ * epochs in the window (0 if the store is inactive) */
+const peph_t *sp3_store_window(gtime_t time, int *ne);
+
+#endif  // GNSS_SDR_RTKLIB_SP3_STORE_H
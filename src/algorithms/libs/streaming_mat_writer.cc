@@ -0,0 +1,281 @@
+/*!
+ * \file streaming_mat_writer.cc
+ * \brief Implementation of a streaming MAT-file (v5) writer with incremental
+ * flush
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "streaming_mat_writer.h"
+#include <array>
+#include <cstring>
+
+namespace
+{
+// MAT-file Level 5 data type and array class identifiers
+const uint32_t MI_INT8 = 1;
+const uint32_t MI_UINT8 = 2;
+const uint32_t MI_INT16 = 3;
+const uint32_t MI_UINT16 = 4;
+const uint32_t MI_INT32 = 5;
+const uint32_t MI_UINT32 = 6;
+const uint32_t MI_SINGLE = 7;
+const uint32_t MI_DOUBLE = 9;
+const uint32_t MI_INT64 = 12;
+const uint32_t MI_UINT64 = 13;
+const uint32_t MI_MATRIX = 14;
+
+const uint32_t MX_DOUBLE_CLASS = 6;
+const uint32_t MX_SINGLE_CLASS = 7;
+const uint32_t MX_INT8_CLASS = 8;
+const uint32_t MX_UINT8_CLASS = 9;
+const uint32_t MX_INT16_CLASS = 10;
+const uint32_t MX_UINT16_CLASS = 11;
+const uint32_t MX_INT32_CLASS = 12;
+const uint32_t MX_UINT32_CLASS = 13;
+const uint32_t MX_INT64_CLASS = 14;
+const uint32_t MX_UINT64_CLASS = 15;
+}  // namespace
+
+
+Streaming_Mat_Writer::~Streaming_Mat_Writer()
+{
+    close();
+}
+
+
+uint32_t Streaming_Mat_Writer::mat_data_type(Mat_Type type)
+{
+    switch (type)
+        {
+        case Mat_Type::mat_int8:
+            return MI_INT8;
+        case Mat_Type::mat_uint8:
+            return MI_UINT8;
+        case Mat_Type::mat_int16:
+            return MI_INT16;
+        case Mat_Type::mat_uint16:
+            return MI_UINT16;
+        case Mat_Type::mat_int32:
+            return MI_INT32;
+        case Mat_Type::mat_uint32:
+            return MI_UINT32;
+        case Mat_Type::mat_single:
+            return MI_SINGLE;
+        case Mat_Type::mat_int64:
+            return MI_INT64;
+        case Mat_Type::mat_uint64:
+            return MI_UINT64;
+        case Mat_Type::mat_double:
+        default:
+            return MI_DOUBLE;
+        }
+}
+
+
+uint32_t Streaming_Mat_Writer::mat_class(Mat_Type type)
+{
+    switch (type)
+        {
+        case Mat_Type::mat_int8:
+            return MX_INT8_CLASS;
+        case Mat_Type::mat_uint8:
+            return MX_UINT8_CLASS;
+        case Mat_Type::mat_int16:
+            return MX_INT16_CLASS;
+        case Mat_Type::mat_uint16:
+            return MX_UINT16_CLASS;
+        case Mat_Type::mat_int32:
+            return MX_INT32_CLASS;
+        case Mat_Type::mat_uint32:
+            return MX_UINT32_CLASS;
+        case Mat_Type::mat_single:
+            return MX_SINGLE_CLASS;
+        case Mat_Type::mat_int64:
+            return MX_INT64_CLASS;
+        case Mat_Type::mat_uint64:
+            return MX_UINT64_CLASS;
+        case Mat_Type::mat_double:
+        default:
+            return MX_DOUBLE_CLASS;
+        }
+}
+
+
+std::size_t Streaming_Mat_Writer::mat_element_size(Mat_Type type)
+{
+    switch (type)
+        {
+        case Mat_Type::mat_int8:
+        case Mat_Type::mat_uint8:
+            return 1;
+        case Mat_Type::mat_int16:
+        case Mat_Type::mat_uint16:
+            return 2;
+        case Mat_Type::mat_int32:
+        case Mat_Type::mat_uint32:
+        case Mat_Type::mat_single:
+            return 4;
+        case Mat_Type::mat_int64:
+        case Mat_Type::mat_uint64:
+        case Mat_Type::mat_double:
+        default:
+            return 8;
+        }
+}
+
+
+bool Streaming_Mat_Writer::open(const std::string& filename)
+{
+    file_.open(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file_.is_open())
+        {
+            return false;
+        }
+    // 128-byte header: 116 bytes of descriptive text, 8 bytes of subsystem
+    // data offset (zero), version 0x0100 and the endianness indicator
+    std::array<char, 116> text{};
+    const char* description = "MATLAB 5.0 MAT-file, Created by: GNSS-SDR";
+    std::memset(text.data(), ' ', text.size());
+    std::memcpy(text.data(), description, std::strlen(description));
+    file_.write(text.data(), text.size());
+    const std::array<char, 8> subsys{};
+    file_.write(subsys.data(), subsys.size());
+    const uint16_t version = 0x0100;
+    file_.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    const std::array<char, 2> endian_indicator{'I', 'M'};
+    file_.write(endian_indicator.data(), endian_indicator.size());
+    return file_.good();
+}
+
+
+bool Streaming_Mat_Writer::begin_variable(const std::string& name, Mat_Type type, std::size_t rows)
+{
+    if (!file_.is_open() || variable_open_ || rows == 0)
+        {
+            return false;
+        }
+    rows_ = rows;
+    elements_ = 0;
+    element_size_ = mat_element_size(type);
+
+    // miMATRIX tag; the total number of bytes is patched in end_variable()
+    matrix_tag_pos_ = file_.tellp();
+    uint32_t tag[2] = {MI_MATRIX, 0};
+    file_.write(reinterpret_cast<const char*>(tag), sizeof(tag));
+
+    // array flags sub-element
+    const uint32_t flags[4] = {MI_UINT32, 8, mat_class(type), 0};
+    file_.write(reinterpret_cast<const char*>(flags), sizeof(flags));
+
+    // dimensions sub-element; the number of columns is patched in end_variable()
+    dimensions_pos_ = file_.tellp();
+    const uint32_t dimensions[4] = {MI_INT32, 8, static_cast<uint32_t>(rows), 0};
+    file_.write(reinterpret_cast<const char*>(dimensions), sizeof(dimensions));
+
+    // array name sub-element, padded to an 8-byte boundary
+    const uint32_t name_tag[2] = {MI_INT8, static_cast<uint32_t>(name.size())};
+    file_.write(reinterpret_cast<const char*>(name_tag), sizeof(name_tag));
+    file_.write(name.data(), static_cast<std::streamsize>(name.size()));
+    pad_to_8_bytes();
+
+    // real part sub-element tag; the data size is patched in end_variable()
+    data_tag_pos_ = file_.tellp();
+    tag[0] = mat_data_type(type);
+    tag[1] = 0;
+    file_.write(reinterpret_cast<const char*>(tag), sizeof(tag));
+
+    variable_open_ = file_.good();
+    return variable_open_;
+}
+
+
+bool Streaming_Mat_Writer::append(const void* data, std::size_t num_elements)
+{
+    if (!variable_open_ || num_elements == 0)
+        {
+            return false;
+        }
+    file_.write(static_cast<const char*>(data), static_cast<std::streamsize>(num_elements * element_size_));
+    elements_ += num_elements;
+    return file_.good();
+}
+
+
+bool Streaming_Mat_Writer::end_variable()
+{
+    if (!variable_open_)
+        {
+            return false;
+        }
+    variable_open_ = false;
+    pad_to_8_bytes();
+    const std::streampos end_pos = file_.tellp();
+
+    // patch the real part data size
+    const auto data_bytes = static_cast<uint32_t>(elements_ * element_size_);
+    file_.seekp(data_tag_pos_ + std::streamoff(4));
+    file_.write(reinterpret_cast<const char*>(&data_bytes), sizeof(data_bytes));
+
+    // patch the number of columns
+    const auto columns = static_cast<uint32_t>(elements_ / rows_);
+    file_.seekp(dimensions_pos_ + std::streamoff(12));
+    file_.write(reinterpret_cast<const char*>(&columns), sizeof(columns));
+
+    // patch the total size of the miMATRIX element
+    const auto matrix_bytes = static_cast<uint32_t>(end_pos - matrix_tag_pos_ - std::streamoff(8));
+    file_.seekp(matrix_tag_pos_ + std::streamoff(4));
+    file_.write(reinterpret_cast<const char*>(&matrix_bytes), sizeof(matrix_bytes));
+
+    file_.seekp(end_pos);
+    file_.flush();
+    return file_.good();
+}
+
+
+bool Streaming_Mat_Writer::write_variable(const std::string& name, Mat_Type type, std::size_t rows, const void* data, std::size_t num_elements)
+{
+    if (!begin_variable(name, type, rows))
+        {
+            return false;
+        }
+    if (!append(data, num_elements))
+        {
+            return false;
+        }
+    return end_variable();
+}
+
+
+void Streaming_Mat_Writer::close()
+{
+    if (variable_open_)
+        {
+            end_variable();
+        }
+    if (file_.is_open())
+        {
+            file_.close();
+        }
+}
+
+
+void Streaming_Mat_Writer::pad_to_8_bytes()
+{
+    const auto position = static_cast<uint64_t>(file_.tellp());
+    const std::size_t remainder = position % 8;
+    if (remainder != 0)
+        {
+            const std::array<char, 8> zeros{};
+            file_.write(zeros.data(), static_cast<std::streamsize>(8 - remainder));
+        }
+}
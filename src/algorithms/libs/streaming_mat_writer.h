@@ -0,0 +1,103 @@
+/*!
+ * \file streaming_mat_writer.h
+ * \brief Interface of a streaming MAT-file (v5) writer with incremental flush
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * This writer produces uncompressed Level 5 MAT-files (readable by MATLAB,
+ * GNU Octave and matio) without building the variables in memory first:
+ * a variable is opened with a fixed number of rows, data is appended in
+ * fixed-size chunks that go straight to disk, and the element sizes in the
+ * file are patched when the variable is closed. Memory usage is bounded by
+ * the chunk size chosen by the caller, regardless of the variable length.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_STREAMING_MAT_WRITER_H
+#define GNSS_SDR_STREAMING_MAT_WRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+/*!
+ * \brief Streaming writer of uncompressed Level 5 MAT-files.
+ *
+ * Variables are numeric 2-D arrays written column-major, one at a time:
+ * call begin_variable() with the number of rows, append() the data in
+ * chunks, and end_variable() to patch the sizes once the final number of
+ * columns is known. write_variable() is a shortcut for data that is
+ * already in memory (scalars, small arrays).
+ */
+class Streaming_Mat_Writer
+{
+public:
+    enum class Mat_Type
+    {
+        mat_int8,
+        mat_uint8,
+        mat_int16,
+        mat_uint16,
+        mat_int32,
+        mat_uint32,
+        mat_single,
+        mat_int64,
+        mat_uint64,
+        mat_double
+    };
+
+    Streaming_Mat_Writer() = default;
+    ~Streaming_Mat_Writer();  //!< Closes any open variable and the file
+
+    //! Creates the file and writes the MAT-file header
+    bool open(const std::string& filename);
+
+    //! Starts a new variable with a fixed number of rows and a growing number of columns
+    bool begin_variable(const std::string& name, Mat_Type type, std::size_t rows);
+
+    //! Appends num_elements items (column-major) to the open variable
+    bool append(const void* data, std::size_t num_elements);
+
+    //! Finishes the open variable, patching its size fields in the file
+    bool end_variable();
+
+    //! Writes a complete variable in one call
+    bool write_variable(const std::string& name, Mat_Type type, std::size_t rows, const void* data, std::size_t num_elements);
+
+    //! Finishes any open variable and closes the file
+    void close();
+
+private:
+    static uint32_t mat_data_type(Mat_Type type);
+    static uint32_t mat_class(Mat_Type type);
+    static std::size_t mat_element_size(Mat_Type type);
+    void pad_to_8_bytes();
+
+    std::ofstream file_;
+    std::streampos matrix_tag_pos_{};
+    std::streampos dimensions_pos_{};
+    std::streampos data_tag_pos_{};
+    std::size_t rows_{0};
+    std::size_t elements_{0};
+    std::size_t element_size_{0};
+    bool variable_open_{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_STREAMING_MAT_WRITER_H
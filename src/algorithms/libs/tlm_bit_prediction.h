@@ -0,0 +1,43 @@
+/*!
+ * \file tlm_bit_prediction.h
+ * \brief Class that stores data bit signs forecast by a telemetry decoder
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_TLM_BIT_PREDICTION_H
+#define GNSS_SDR_TLM_BIT_PREDICTION_H
+
+#include <cstdint>
+#include <vector>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+/*!
+ * \brief Data bit signs forecast by a telemetry decoder, sent through the
+ * telemetry_to_trk message port so that the tracking block can extend the
+ * coherent integration across the predicted bit boundaries.
+ */
+class TlmBitPrediction
+{
+public:
+    uint64_t first_bit_sample_counter = 0ULL;  //!< Tracking_sample_counter at the end of the first predicted bit
+    std::vector<float> bit_signs;              //!< predicted sign (+1.0 or -1.0) of each upcoming data bit
+};
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_TLM_BIT_PREDICTION_H
@@ -0,0 +1,95 @@
+/*!
+ * \file half_precision.h
+ * \brief Defines scalar conversions between IEEE 754 binary32 and binary16
+ *
+ * The binary16 values are carried in uint16_t so that no compiler support for
+ * a native half type is required. Conversion to half uses round-to-nearest,
+ * ties-to-even; values above the binary16 range become infinity and NaN is
+ * canonicalized to 0x7E00, so the results do not depend on the platform.
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+
+#ifndef INCLUDED_VOLK_GNSSSDR_HALF_PRECISION_H
+#define INCLUDED_VOLK_GNSSSDR_HALF_PRECISION_H
+
+#include <stdint.h>
+#include <string.h>
+
+static inline uint16_t float_to_half(float value)
+{
+    uint32_t bits;
+    uint32_t sign;
+    memcpy(&bits, &value, sizeof(bits));
+    sign = (bits >> 16) & 0x8000u;
+    bits &= 0x7FFFFFFFu;
+
+    if (bits >= 0x47800000u) /* above binary16 range, infinity or NaN */
+        {
+            return (uint16_t)(sign | ((bits > 0x7F800000u) ? 0x7E00u : 0x7C00u));
+        }
+    if (bits < 0x38800000u) /* binary16 subnormal or zero */
+        {
+            const uint32_t shift = 126u - (bits >> 23);
+            const uint32_t mant = (bits & 0x007FFFFFu) | 0x00800000u;
+            uint32_t half;
+            uint32_t rem;
+            uint32_t halfway;
+            if (shift > 24u)
+                {
+                    return (uint16_t)sign;
+                }
+            half = mant >> shift;
+            rem = mant & ((1u << shift) - 1u);
+            halfway = 1u << (shift - 1u);
+            if ((rem > halfway) || ((rem == halfway) && (half & 1u)))
+                {
+                    half++;
+                }
+            return (uint16_t)(sign | half);
+        }
+    /* normal range: rebias the exponent and round the mantissa to 10 bits */
+    bits += 0x00000FFFu + ((bits >> 13) & 1u);
+    return (uint16_t)(sign | ((bits - 0x38000000u) >> 13));
+}
+
+
+static inline float half_to_float(uint16_t value)
+{
+    const uint32_t sign = ((uint32_t)(value & 0x8000u)) << 16;
+    const uint32_t em = value & 0x7FFFu;
+    uint32_t bits;
+    float result;
+    if (em >= 0x7C00u) /* infinity or NaN */
+        {
+            bits = sign | 0x7F800000u | (((uint32_t)(em & 0x03FFu)) << 13);
+        }
+    else if (em >= 0x0400u) /* normal */
+        {
+            bits = sign | ((em + 0x1C000u) << 13);
+        }
+    else if (em == 0u) /* signed zero */
+        {
+            bits = sign;
+        }
+    else /* subnormal: renormalize into a binary32 normal */
+        {
+            uint32_t exponent = 113u;
+            uint32_t mant = em;
+            while ((mant & 0x0400u) == 0u)
+                {
+                    mant <<= 1;
+                    exponent--;
+                }
+            bits = sign | (exponent << 23) | ((mant & 0x03FFu) << 13);
+        }
+    memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+#endif /* INCLUDED_VOLK_GNSSSDR_HALF_PRECISION_H */
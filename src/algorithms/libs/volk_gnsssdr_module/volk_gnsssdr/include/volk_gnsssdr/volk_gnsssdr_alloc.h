@@ -19,6 +19,9 @@
 #include <limits>
 #include <new>
 #include <vector>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
 
 namespace volk_gnsssdr
 {
@@ -68,6 +71,86 @@ bool operator!=(alloc<T> const&, alloc<U> const&) { return false; }
 template <class T>
 using vector = std::vector<T, alloc<T> >;
 
+
+/*!
+ * \brief C++11 allocator backing allocations with 2 MB huge pages when available
+ *
+ * \details
+ *   Large, long-lived buffers (acquisition grids, resampled code replicas)
+ *   backed by regular 4 kB pages put pressure on the TLB when many channels
+ *   run in parallel. This allocator requests anonymous huge pages via
+ *   mmap(MAP_HUGETLB); if none are reserved in the system it falls back to
+ *   regular pages hinted with madvise(MADV_HUGEPAGE), so it is always safe
+ *   to use. On non-Linux platforms it behaves exactly like
+ *   volk_gnsssdr::alloc. Memory returned by mmap is page-aligned, which
+ *   satisfies any SIMD alignment requirement.
+ */
+template <class T>
+struct hugepage_alloc
+{
+    typedef T value_type;
+
+    hugepage_alloc() = default;
+
+    template <class U>
+    constexpr hugepage_alloc(hugepage_alloc<U> const&) noexcept {}
+
+#ifdef __linux__
+    static std::size_t round_to_huge_page(std::size_t bytes)
+    {
+        const std::size_t huge_page_size = 2UL * 1024UL * 1024UL;
+        return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) throw std::bad_alloc();
+
+        const std::size_t bytes = round_to_huge_page(n * sizeof(T));
+        void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p == MAP_FAILED)
+            {
+                // no huge pages reserved: map regular pages and let the
+                // kernel promote them to transparent huge pages if it can
+                p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (p == MAP_FAILED) throw std::bad_alloc();
+#ifdef MADV_HUGEPAGE
+                madvise(p, bytes, MADV_HUGEPAGE);
+#endif
+            }
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        if (p != nullptr) munmap(p, round_to_huge_page(n * sizeof(T)));
+    }
+#else
+    T* allocate(std::size_t n) { return alloc<T>().allocate(n); }
+
+    void deallocate(T* p, std::size_t n) noexcept { alloc<T>().deallocate(p, n); }
+#endif
+};
+
+template <class T, class U>
+bool operator==(hugepage_alloc<T> const&, hugepage_alloc<U> const&) { return true; }
+
+template <class T, class U>
+bool operator!=(hugepage_alloc<T> const&, hugepage_alloc<U> const&) { return false; }
+
+
+/*!
+ * \brief type alias for std::vector using volk_gnsssdr::hugepage_alloc
+ *
+ * \details
+ * example code:
+ *   volk_gnsssdr::hugepage_vector<float> v(100); // vector backed by 2 MB pages when available
+ */
+template <class T>
+using hugepage_vector = std::vector<T, hugepage_alloc<T> >;
+
 }  // namespace volk_gnsssdr
 
 #endif  // INCLUDED_VOLK_GNSSSDR_ALLOC_H
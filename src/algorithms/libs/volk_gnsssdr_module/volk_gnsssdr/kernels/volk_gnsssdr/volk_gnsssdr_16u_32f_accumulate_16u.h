@@ -0,0 +1,63 @@
+/*!
+ * \file volk_gnsssdr_16u_32f_accumulate_16u.h
+ * \brief VOLK_GNSSSDR kernel: accumulates a float vector into binary16 storage.
+ *
+ * VOLK_GNSSSDR kernel that adds a vector of 32-bit floats onto an accumulator
+ * stored as IEEE 754 binary16 values, widening and re-packing on the fly.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_16u_32f_accumulate_16u
+ *
+ * \b Overview
+ *
+ * Computes outputVector[n] = pack(widen(accumulator[n]) + inputVector[n]),
+ * where pack/widen convert between IEEE 754 binary16 (carried in uint16_t)
+ * and binary32. \p outputVector may alias \p accumulator, which gives an
+ * in-place noncoherent sum over a half-precision magnitude grid: each
+ * integration round reads and writes 2 bytes per cell instead of 4.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_16u_32f_accumulate_16u(uint16_t* outputVector, const uint16_t* accumulator, const float* inputVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li accumulator:  Buffer holding the binary16 running sums.
+ * \li inputVector:  The 32-bit float addend vector.
+ * \li num_points:   The number of data values to be accumulated.
+ *
+ * \b Outputs
+ * \li outputVector: pointer to a vector holding the updated binary16 sums.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_16u_32f_accumulate_16u_H
+#define INCLUDED_volk_gnsssdr_16u_32f_accumulate_16u_H
+
+#include <volk_gnsssdr/half_precision.h>
+#include <stdint.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_16u_32f_accumulate_16u_generic(uint16_t* outputVector, const uint16_t* accumulator, const float* inputVector, unsigned int num_points)
+{
+    unsigned int i;
+    for (i = 0; i < num_points; i++)
+        {
+            outputVector[i] = float_to_half(half_to_float(accumulator[i]) + inputVector[i]);
+        }
+}
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_gnsssdr_16u_32f_accumulate_16u_H */
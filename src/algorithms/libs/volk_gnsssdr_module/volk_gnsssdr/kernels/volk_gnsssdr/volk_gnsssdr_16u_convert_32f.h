@@ -0,0 +1,62 @@
+/*!
+ * \file volk_gnsssdr_16u_convert_32f.h
+ * \brief VOLK_GNSSSDR kernel: widens IEEE 754 binary16 values to 32-bit floats.
+ *
+ * VOLK_GNSSSDR kernel that widens half-precision (binary16) values carried in
+ * uint16_t back into a vector of 32-bit floats.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_16u_convert_32f
+ *
+ * \b Overview
+ *
+ * Widens a vector of IEEE 754 binary16 values carried in uint16_t into
+ * 32-bit floats. This is the read path of the half-precision storage used
+ * for the acquisition magnitude grids; the widening is exact, so a
+ * pack/widen round trip only loses the initial rounding to 11 significant
+ * bits.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_16u_convert_32f(float* outputVector, const uint16_t* inputVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector:  Buffer holding the binary16 bit patterns.
+ * \li num_points:   The number of data values to be converted.
+ *
+ * \b Outputs
+ * \li outputVector: pointer to a vector holding the widened floats.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_16u_convert_32f_H
+#define INCLUDED_volk_gnsssdr_16u_convert_32f_H
+
+#include <volk_gnsssdr/half_precision.h>
+#include <stdint.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_16u_convert_32f_generic(float* outputVector, const uint16_t* inputVector, unsigned int num_points)
+{
+    unsigned int i;
+    for (i = 0; i < num_points; i++)
+        {
+            outputVector[i] = half_to_float(inputVector[i]);
+        }
+}
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_gnsssdr_16u_convert_32f_H */
@@ -0,0 +1,63 @@
+/*!
+ * \file volk_gnsssdr_32f_convert_16u.h
+ * \brief VOLK_GNSSSDR kernel: packs 32-bit float values into IEEE 754 binary16.
+ *
+ * VOLK_GNSSSDR kernel that packs a vector of 32-bit floats into half-precision
+ * (binary16) values carried in uint16_t, halving the storage footprint.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_32f_convert_16u
+ *
+ * \b Overview
+ *
+ * Packs a vector of 32-bit floats into IEEE 754 binary16 values carried in
+ * uint16_t, with round-to-nearest-even. Values beyond the binary16 range
+ * become infinity. The kernel exists to halve the memory traffic of large
+ * float buffers whose dynamic range fits in half precision, such as the
+ * acquisition magnitude grids; the conversion itself is memory-bound, so
+ * no SIMD protokernels are provided.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_32f_convert_16u(uint16_t* outputVector, const float* inputVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector:  The 32-bit float input data buffer.
+ * \li num_points:   The number of data values to be converted.
+ *
+ * \b Outputs
+ * \li outputVector: pointer to a vector holding the binary16 bit patterns.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32f_convert_16u_H
+#define INCLUDED_volk_gnsssdr_32f_convert_16u_H
+
+#include <volk_gnsssdr/half_precision.h>
+#include <stdint.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_32f_convert_16u_generic(uint16_t* outputVector, const float* inputVector, unsigned int num_points)
+{
+    unsigned int i;
+    for (i = 0; i < num_points; i++)
+        {
+            outputVector[i] = float_to_half(inputVector[i]);
+        }
+}
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_gnsssdr_32f_convert_16u_H */
@@ -0,0 +1,347 @@
+/*!
+ * \file volk_gnsssdr_32f_index_max_stats_32u.h
+ * \brief VOLK_GNSSSDR kernel: returns the index of the max value, the max
+ * value itself, the sum and the sum of squares of a float vector in a single
+ * pass.
+ *
+ * VOLK_GNSSSDR kernel that fuses the peak search and the first- and
+ * second-order statistics of a float vector, loading every element once
+ * instead of traversing the vector separately for each reduction. It is
+ * used to reduce the acquisition magnitude grid, where the peak, the noise
+ * floor estimate and the grid variance are all needed.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_32f_index_max_stats_32u
+ *
+ * \b Overview
+ *
+ * Computes, in one pass over \p src0: the index of the maximum value, the
+ * maximum value, the sum of all values, and the sum of the squared values.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_32f_index_max_stats_32u(uint32_t* target, float* max_value, float* sum, float* sum_sq, const float* src0, uint32_t num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li src0:       The input vector of floats.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li target:     The index of the maximum value in the vector.
+ * \li max_value:  The maximum value in the vector.
+ * \li sum:        The sum of all the values in the vector.
+ * \li sum_sq:     The sum of the squared values in the vector.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32f_index_max_stats_32u_H
+#define INCLUDED_volk_gnsssdr_32f_index_max_stats_32u_H
+
+#include <volk_gnsssdr/volk_gnsssdr_common.h>
+#include <inttypes.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_32f_index_max_stats_32u_generic(uint32_t* target, float* max_value, float* sum, float* sum_sq, const float* src0, uint32_t num_points)
+{
+    if (num_points > 0)
+        {
+            float max = src0[0];
+            uint32_t index = 0;
+            float accumulator = 0.0f;
+            float sq_accumulator = 0.0f;
+            uint32_t i = 0;
+
+            for (i = 0; i < num_points; ++i)
+                {
+                    const float val = src0[i];
+                    accumulator += val;
+                    sq_accumulator += val * val;
+                    if (val > max)
+                        {
+                            index = i;
+                            max = val;
+                        }
+                }
+            target[0] = index;
+            max_value[0] = max;
+            sum[0] = accumulator;
+            sum_sq[0] = sq_accumulator;
+        }
+}
+
+#endif /*LV_HAVE_GENERIC*/
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32f_index_max_stats_32u_a_avx(uint32_t* target, float* max_value, float* sum, float* sum_sq, const float* src0, uint32_t num_points)
+{
+    if (num_points > 0)
+        {
+            uint32_t number = 0;
+            const uint32_t quarterPoints = num_points / 8;
+
+            float* inputPtr = (float*)src0;
+
+            __m256 indexIncrementValues = _mm256_set1_ps(8);
+            __m256 currentIndexes = _mm256_set_ps(-1, -2, -3, -4, -5, -6, -7, -8);
+
+            float max = src0[0];
+            float index = 0;
+            float accumulator = 0.0f;
+            float sq_accumulator = 0.0f;
+            __m256 maxValues = _mm256_set1_ps(max);
+            __m256 maxValuesIndex = _mm256_setzero_ps();
+            __m256 sumValues = _mm256_setzero_ps();
+            __m256 sumSqValues = _mm256_setzero_ps();
+            __m256 compareResults;
+            __m256 currentValues;
+
+            __VOLK_ATTR_ALIGNED(32)
+            float maxValuesBuffer[8];
+            __VOLK_ATTR_ALIGNED(32)
+            float maxIndexesBuffer[8];
+            __VOLK_ATTR_ALIGNED(32)
+            float sumBuffer[8];
+            __VOLK_ATTR_ALIGNED(32)
+            float sumSqBuffer[8];
+
+            for (; number < quarterPoints; number++)
+                {
+                    currentValues = _mm256_load_ps(inputPtr);
+                    inputPtr += 8;
+                    sumValues = _mm256_add_ps(sumValues, currentValues);
+                    sumSqValues = _mm256_add_ps(sumSqValues, _mm256_mul_ps(currentValues, currentValues));
+                    currentIndexes = _mm256_add_ps(currentIndexes, indexIncrementValues);
+                    compareResults = _mm256_cmp_ps(maxValues, currentValues, 0x1e);
+                    maxValuesIndex = _mm256_blendv_ps(currentIndexes, maxValuesIndex, compareResults);
+                    maxValues = _mm256_blendv_ps(currentValues, maxValues, compareResults);
+                }
+
+            // Calculate the largest value from the remaining 8 points
+            _mm256_store_ps(maxValuesBuffer, maxValues);
+            _mm256_store_ps(maxIndexesBuffer, maxValuesIndex);
+            _mm256_store_ps(sumBuffer, sumValues);
+            _mm256_store_ps(sumSqBuffer, sumSqValues);
+
+            for (number = 0; number < 8; number++)
+                {
+                    if (maxValuesBuffer[number] > max)
+                        {
+                            index = maxIndexesBuffer[number];
+                            max = maxValuesBuffer[number];
+                        }
+                    accumulator += sumBuffer[number];
+                    sq_accumulator += sumSqBuffer[number];
+                }
+
+            number = quarterPoints * 8;
+            for (; number < num_points; number++)
+                {
+                    const float val = src0[number];
+                    accumulator += val;
+                    sq_accumulator += val * val;
+                    if (val > max)
+                        {
+                            index = number;
+                            max = val;
+                        }
+                }
+            target[0] = (uint32_t)index;
+            max_value[0] = max;
+            sum[0] = accumulator;
+            sum_sq[0] = sq_accumulator;
+        }
+}
+
+#endif /*LV_HAVE_AVX*/
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32f_index_max_stats_32u_u_avx(uint32_t* target, float* max_value, float* sum, float* sum_sq, const float* src0, uint32_t num_points)
+{
+    if (num_points > 0)
+        {
+            uint32_t number = 0;
+            const uint32_t quarterPoints = num_points / 8;
+
+            float* inputPtr = (float*)src0;
+
+            __m256 indexIncrementValues = _mm256_set1_ps(8);
+            __m256 currentIndexes = _mm256_set_ps(-1, -2, -3, -4, -5, -6, -7, -8);
+
+            float max = src0[0];
+            float index = 0;
+            float accumulator = 0.0f;
+            float sq_accumulator = 0.0f;
+            __m256 maxValues = _mm256_set1_ps(max);
+            __m256 maxValuesIndex = _mm256_setzero_ps();
+            __m256 sumValues = _mm256_setzero_ps();
+            __m256 sumSqValues = _mm256_setzero_ps();
+            __m256 compareResults;
+            __m256 currentValues;
+
+            __VOLK_ATTR_ALIGNED(32)
+            float maxValuesBuffer[8];
+            __VOLK_ATTR_ALIGNED(32)
+            float maxIndexesBuffer[8];
+            __VOLK_ATTR_ALIGNED(32)
+            float sumBuffer[8];
+            __VOLK_ATTR_ALIGNED(32)
+            float sumSqBuffer[8];
+
+            for (; number < quarterPoints; number++)
+                {
+                    currentValues = _mm256_loadu_ps(inputPtr);
+                    inputPtr += 8;
+                    sumValues = _mm256_add_ps(sumValues, currentValues);
+                    sumSqValues = _mm256_add_ps(sumSqValues, _mm256_mul_ps(currentValues, currentValues));
+                    currentIndexes = _mm256_add_ps(currentIndexes, indexIncrementValues);
+                    compareResults = _mm256_cmp_ps(maxValues, currentValues, 0x1e);
+                    maxValuesIndex = _mm256_blendv_ps(currentIndexes, maxValuesIndex, compareResults);
+                    maxValues = _mm256_blendv_ps(currentValues, maxValues, compareResults);
+                }
+
+            // Calculate the largest value from the remaining 8 points
+            _mm256_store_ps(maxValuesBuffer, maxValues);
+            _mm256_store_ps(maxIndexesBuffer, maxValuesIndex);
+            _mm256_store_ps(sumBuffer, sumValues);
+            _mm256_store_ps(sumSqBuffer, sumSqValues);
+
+            for (number = 0; number < 8; number++)
+                {
+                    if (maxValuesBuffer[number] > max)
+                        {
+                            index = maxIndexesBuffer[number];
+                            max = maxValuesBuffer[number];
+                        }
+                    accumulator += sumBuffer[number];
+                    sq_accumulator += sumSqBuffer[number];
+                }
+
+            number = quarterPoints * 8;
+            for (; number < num_points; number++)
+                {
+                    const float val = src0[number];
+                    accumulator += val;
+                    sq_accumulator += val * val;
+                    if (val > max)
+                        {
+                            index = number;
+                            max = val;
+                        }
+                }
+            target[0] = (uint32_t)index;
+            max_value[0] = max;
+            sum[0] = accumulator;
+            sum_sq[0] = sq_accumulator;
+        }
+}
+
+#endif /*LV_HAVE_AVX*/
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_32f_index_max_stats_32u_neon(uint32_t* target, float* max_value, float* sum, float* sum_sq, const float* src0, uint32_t num_points)
+{
+    if (num_points > 0)
+        {
+            uint32_t number = 0;
+            const uint32_t quarterPoints = num_points / 4;
+
+            float* inputPtr = (float*)src0;
+
+            float32x4_t indexIncrementValues = vdupq_n_f32(4);
+            __VOLK_ATTR_ALIGNED(16)
+            float currentIndexes_float[4] = {-4.0f, -3.0f, -2.0f, -1.0f};
+            float32x4_t currentIndexes = vld1q_f32(currentIndexes_float);
+
+            float max = src0[0];
+            float index = 0;
+            float accumulator = 0.0f;
+            float sq_accumulator = 0.0f;
+            float32x4_t maxValues = vdupq_n_f32(max);
+            float32x4_t maxValuesIndex = vmovq_n_f32(0);
+            float32x4_t sumValues = vmovq_n_f32(0);
+            float32x4_t sumSqValues = vmovq_n_f32(0);
+            uint32x4_t compareResults;
+            float32x4_t currentValues;
+
+            __VOLK_ATTR_ALIGNED(16)
+            float maxValuesBuffer[4];
+            __VOLK_ATTR_ALIGNED(16)
+            float maxIndexesBuffer[4];
+            __VOLK_ATTR_ALIGNED(16)
+            float sumBuffer[4];
+            __VOLK_ATTR_ALIGNED(16)
+            float sumSqBuffer[4];
+
+            for (; number < quarterPoints; number++)
+                {
+                    currentValues = vld1q_f32(inputPtr);
+                    inputPtr += 4;
+                    sumValues = vaddq_f32(sumValues, currentValues);
+                    sumSqValues = vmlaq_f32(sumSqValues, currentValues, currentValues);
+                    currentIndexes = vaddq_f32(currentIndexes, indexIncrementValues);
+                    compareResults = vcgtq_f32(currentValues, maxValues);
+                    maxValuesIndex = vbslq_f32(compareResults, currentIndexes, maxValuesIndex);
+                    maxValues = vbslq_f32(compareResults, currentValues, maxValues);
+                }
+
+            // Calculate the largest value from the remaining 4 points
+            vst1q_f32(maxValuesBuffer, maxValues);
+            vst1q_f32(maxIndexesBuffer, maxValuesIndex);
+            vst1q_f32(sumBuffer, sumValues);
+            vst1q_f32(sumSqBuffer, sumSqValues);
+
+            for (number = 0; number < 4; number++)
+                {
+                    if (maxValuesBuffer[number] > max)
+                        {
+                            index = maxIndexesBuffer[number];
+                            max = maxValuesBuffer[number];
+                        }
+                    accumulator += sumBuffer[number];
+                    sq_accumulator += sumSqBuffer[number];
+                }
+
+            number = quarterPoints * 4;
+            for (; number < num_points; number++)
+                {
+                    const float val = src0[number];
+                    accumulator += val;
+                    sq_accumulator += val * val;
+                    if (val > max)
+                        {
+                            index = number;
+                            max = val;
+                        }
+                }
+            target[0] = (uint32_t)index;
+            max_value[0] = max;
+            sum[0] = accumulator;
+            sum_sq[0] = sq_accumulator;
+        }
+}
+
+#endif /*LV_HAVE_NEON*/
+
+#endif /*INCLUDED_volk_gnsssdr_32f_index_max_stats_32u_H*/
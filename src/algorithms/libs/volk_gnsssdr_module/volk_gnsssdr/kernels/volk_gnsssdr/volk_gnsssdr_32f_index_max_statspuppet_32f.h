@@ -0,0 +1,107 @@
+/*!
+ * \file volk_gnsssdr_32f_index_max_statspuppet_32f.h
+ * \brief Volk puppet for the fused max/argmax/sum/sum-of-squares kernel.
+ *
+ * Volk puppet for integrating the fused reduction kernel into volk's test
+ * system. The scalar outputs are packed into the first elements of the
+ * result vector.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32f_index_max_statspuppet_32f_H
+#define INCLUDED_volk_gnsssdr_32f_index_max_statspuppet_32f_H
+
+#include "volk_gnsssdr/volk_gnsssdr_32f_index_max_stats_32u.h"
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <inttypes.h>
+#include <string.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_32f_index_max_statspuppet_32f_generic(float* result, const float* in, unsigned int num_points)
+{
+    uint32_t index = 0;
+    float max = 0.0f;
+    float sum = 0.0f;
+    float sum_sq = 0.0f;
+    memset(result, 0, sizeof(float) * num_points);
+    volk_gnsssdr_32f_index_max_stats_32u_generic(&index, &max, &sum, &sum_sq, in, num_points);
+    if (num_points > 3)
+        {
+            result[0] = (float)index;
+            result[1] = max;
+            result[2] = sum;
+            result[3] = sum_sq;
+        }
+}
+#endif  // Generic
+
+
+#ifdef LV_HAVE_AVX
+static inline void volk_gnsssdr_32f_index_max_statspuppet_32f_a_avx(float* result, const float* in, unsigned int num_points)
+{
+    uint32_t index = 0;
+    float max = 0.0f;
+    float sum = 0.0f;
+    float sum_sq = 0.0f;
+    memset(result, 0, sizeof(float) * num_points);
+    volk_gnsssdr_32f_index_max_stats_32u_a_avx(&index, &max, &sum, &sum_sq, in, num_points);
+    if (num_points > 3)
+        {
+            result[0] = (float)index;
+            result[1] = max;
+            result[2] = sum;
+            result[3] = sum_sq;
+        }
+}
+#endif  // AVX
+
+
+#ifdef LV_HAVE_AVX
+static inline void volk_gnsssdr_32f_index_max_statspuppet_32f_u_avx(float* result, const float* in, unsigned int num_points)
+{
+    uint32_t index = 0;
+    float max = 0.0f;
+    float sum = 0.0f;
+    float sum_sq = 0.0f;
+    memset(result, 0, sizeof(float) * num_points);
+    volk_gnsssdr_32f_index_max_stats_32u_u_avx(&index, &max, &sum, &sum_sq, in, num_points);
+    if (num_points > 3)
+        {
+            result[0] = (float)index;
+            result[1] = max;
+            result[2] = sum;
+            result[3] = sum_sq;
+        }
+}
+#endif  // AVX
+
+
+#ifdef LV_HAVE_NEON
+static inline void volk_gnsssdr_32f_index_max_statspuppet_32f_neon(float* result, const float* in, unsigned int num_points)
+{
+    uint32_t index = 0;
+    float max = 0.0f;
+    float sum = 0.0f;
+    float sum_sq = 0.0f;
+    memset(result, 0, sizeof(float) * num_points);
+    volk_gnsssdr_32f_index_max_stats_32u_neon(&index, &max, &sum, &sum_sq, in, num_points);
+    if (num_points > 3)
+        {
+            result[0] = (float)index;
+            result[1] = max;
+            result[2] = sum;
+            result[3] = sum_sq;
+        }
+}
+#endif  // NEON
+
+#endif  // INCLUDED_volk_gnsssdr_32f_index_max_statspuppet_32f_H
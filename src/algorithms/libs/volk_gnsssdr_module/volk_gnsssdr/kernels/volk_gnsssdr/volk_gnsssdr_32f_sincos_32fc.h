@@ -734,4 +734,74 @@ static inline void volk_gnsssdr_32f_sincos_32fc_neon(lv_32fc_t* out, const float
 #endif /* LV_HAVE_NEON  */
 
 
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+/* Adapted from the SSE4.1 version above. Vector-length agnostic: the
+ *  governing predicate handles the tail, so no scalar epilogue is needed.
+ *  Based on algorithms from:
+ *   Naoki Shibata, "Efficient Evaluation Methods of Elementary Functions Suitable for SIMD Computation,"
+ *   Computer Science Research and Development, May 2010, Volume 25, Issue 1, pp 25-32. DOI 10.1007/s00450-010-0108-2  */
+static inline void volk_gnsssdr_32f_sincos_32fc_sve(lv_32fc_t* out, const float* in, unsigned int num_points)
+{
+    const unsigned int n_elems = (unsigned int)svcntw();
+    unsigned int n;
+    unsigned int i;
+
+    const svfloat32_t m4pi = svdup_f32(1.273239545f);
+    const svfloat32_t pio4A = svdup_f32(0.78515625f);
+    const svfloat32_t pio4B = svdup_f32(0.241876e-3f);
+    const svfloat32_t ffours = svdup_f32(4.0f);
+    const svfloat32_t ftwos = svdup_f32(2.0f);
+    const svfloat32_t fones = svdup_f32(1.0f);
+
+    const svfloat32_t cp1 = svdup_f32(1.0f);
+    const svfloat32_t cp2 = svdup_f32(0.83333333e-1f);
+    const svfloat32_t cp3 = svdup_f32(0.2777778e-2f);
+    const svfloat32_t cp4 = svdup_f32(0.49603e-4f);
+    const svfloat32_t cp5 = svdup_f32(0.551e-6f);
+
+    for (n = 0; n < num_points; n += n_elems)
+        {
+            const svbool_t pg = svwhilelt_b32_s32((int32_t)n, (int32_t)num_points);
+            const svfloat32_t aVal = svld1_f32(pg, in + n);
+            const svbool_t aNeg = svcmplt_n_f32(pg, aVal, 0.0f);
+            svfloat32_t s = svabs_f32_x(pg, aVal);
+            const svint32_t q = svcvt_s32_f32_x(pg, svrintm_f32_x(pg, svmul_f32_x(pg, s, m4pi)));
+            const svint32_t r = svadd_s32_x(pg, q, svand_n_s32_x(pg, q, 1));
+            const svfloat32_t rf = svcvt_f32_s32_x(pg, r);
+
+            s = svmls_f32_x(pg, s, rf, pio4A);
+            s = svmls_f32_x(pg, s, rf, pio4B);
+
+            s = svmul_n_f32_x(pg, s, 0.125f);  // The constant is 2^-N, for 3 times argument reduction
+            s = svmul_f32_x(pg, s, s);
+            // Evaluate Taylor series
+            s = svmul_f32_x(pg, svadd_f32_x(pg, svmul_f32_x(pg, svsub_f32_x(pg, svmul_f32_x(pg, svadd_f32_x(pg, svmul_f32_x(pg, svsub_f32_x(pg, svmul_f32_x(pg, s, cp5), cp4), s), cp3), s), cp2), s), cp1), s);
+
+            for (i = 0; i < 3; i++)
+                {
+                    s = svmul_f32_x(pg, s, svsub_f32_x(pg, ffours, s));
+                }
+            s = svmul_n_f32_x(pg, s, 0.5f);
+
+            svfloat32_t sine = svsqrt_f32_x(pg, svmul_f32_x(pg, svsub_f32_x(pg, ftwos, s), s));
+            svfloat32_t cosine = svsub_f32_x(pg, fones, s);
+
+            const svbool_t condition1 = svcmpne_n_s32(pg, svand_n_s32_x(pg, svadd_n_s32_x(pg, q, 1), 2), 0);
+            const svbool_t condition2 = sveor_b_z(pg, svcmpne_n_s32(pg, svand_n_s32_x(pg, q, 4), 0), aNeg);
+            const svbool_t condition3 = svcmpne_n_s32(pg, svand_n_s32_x(pg, svadd_n_s32_x(pg, q, 2), 4), 0);
+
+            const svfloat32_t sine0 = sine;
+            sine = svsel_f32(condition1, cosine, sine);
+            sine = svneg_f32_m(sine, condition2, sine);
+            cosine = svsel_f32(condition1, sine0, cosine);
+            cosine = svneg_f32_m(cosine, condition3, cosine);
+
+            svst2_f32(pg, (float*)(out + n), svcreate2_f32(cosine, sine));
+        }
+}
+
+#endif /* LV_HAVE_SVE  */
+
+
 #endif /* INCLUDED_volk_gnsssdr_32f_sincos_32fc_H  */
@@ -599,4 +599,43 @@ static inline void volk_gnsssdr_32f_xn_resampler_32f_xn_neon(float** result, con
 
 #endif
 
+
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+static inline void volk_gnsssdr_32f_xn_resampler_32f_xn_sve(float** result, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_out_vectors, unsigned int num_points)
+{
+    // vector-length agnostic: the governing predicate handles the tail, so no
+    // scalar epilogue is needed
+    const unsigned int n_elems = (unsigned int)svcntw();
+    const float code_length_chips_f = (float)code_length_chips;
+    const svfloat32_t code_phase_step_chips_reg = svdup_f32(code_phase_step_chips);
+    const svfloat32_t code_length_chips_reg_f = svdup_f32(code_length_chips_f);
+    const svint32_t code_length_chips_reg_i = svdup_s32((int32_t)code_length_chips);
+    int current_correlator_tap;
+    unsigned int n;
+    for (current_correlator_tap = 0; current_correlator_tap < num_out_vectors; current_correlator_tap++)
+        {
+            const svfloat32_t aux2 = svdup_f32(shifts_chips[current_correlator_tap] - rem_code_phase_chips);
+            for (n = 0; n < num_points; n += n_elems)
+                {
+                    const svbool_t pg = svwhilelt_b32_s32((int32_t)n, (int32_t)num_points);
+                    const svfloat32_t indexn = svcvt_f32_s32_x(pg, svindex_s32((int32_t)n, 1));
+                    svfloat32_t aux = svmla_f32_x(pg, aux2, code_phase_step_chips_reg, indexn);
+                    aux = svrintm_f32_x(pg, aux);  // floor
+                    // fmod via truncated division
+                    svfloat32_t c = svdiv_f32_x(pg, aux, code_length_chips_reg_f);
+                    const svint32_t i = svcvt_s32_f32_x(pg, c);  // convert truncates
+                    const svfloat32_t cTrunc = svmul_f32_x(pg, svcvt_f32_s32_x(pg, i), code_length_chips_reg_f);
+                    svint32_t local_code_chip_index_reg = svcvt_s32_f32_x(pg, svsub_f32_x(pg, aux, cTrunc));
+                    // Take into account that in multitap correlators, the shifts can be negative!
+                    const svbool_t negatives = svcmplt_n_s32(pg, local_code_chip_index_reg, 0);
+                    local_code_chip_index_reg = svadd_s32_m(negatives, local_code_chip_index_reg, code_length_chips_reg_i);
+                    const svfloat32_t code = svld1_gather_s32index_f32(pg, local_code, local_code_chip_index_reg);
+                    svst1_f32(pg, &result[current_correlator_tap][n], code);
+                }
+        }
+}
+
+#endif
+
 #endif /*INCLUDED_volk_gnsssdr_32f_xn_resampler_32f_xn_H*/
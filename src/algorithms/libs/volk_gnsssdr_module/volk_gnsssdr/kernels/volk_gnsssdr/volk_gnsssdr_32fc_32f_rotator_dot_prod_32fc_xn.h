@@ -152,7 +152,7 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_generic_reload
 #ifdef LV_HAVE_AVX
 #include <volk_gnsssdr/volk_gnsssdr_avx_intrinsics.h>
 #include <immintrin.h>
-static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+static inline __VOLK_ATTR_INLINE void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx_ntaps(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
 {
 #ifndef WIN32
     unsigned int number = 0;
@@ -313,13 +313,35 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx(lv_32fc_
 #endif
 }
 
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    // Re-dispatch on the tap counts used by the tracking loops so the
+    // always-inlined worker sees a compile-time constant and the per-tap
+    // accumulator arrays are fully unrolled into registers
+    switch (num_a_vectors)
+        {
+        case 3:
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx_ntaps(result, in_common, phase_inc, phase, in_a, 3, num_points);
+            break;
+        case 5:
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx_ntaps(result, in_common, phase_inc, phase, in_a, 5, num_points);
+            break;
+        case 7:
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx_ntaps(result, in_common, phase_inc, phase, in_a, 7, num_points);
+            break;
+        default:
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx_ntaps(result, in_common, phase_inc, phase, in_a, num_a_vectors, num_points);
+            break;
+        }
+}
+
 #endif /* LV_HAVE_AVX */
 
 
 #ifdef LV_HAVE_AVX
 #include <volk_gnsssdr/volk_gnsssdr_avx_intrinsics.h>
 #include <immintrin.h>
-static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+static inline __VOLK_ATTR_INLINE void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx_ntaps(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
 {
 #ifndef WIN32
     unsigned int number = 0;
@@ -480,7 +502,452 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx(lv_32fc_
 #endif
 }
 
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    // Re-dispatch on the tap counts used by the tracking loops so the
+    // always-inlined worker sees a compile-time constant and the per-tap
+    // accumulator arrays are fully unrolled into registers
+    switch (num_a_vectors)
+        {
+        case 3:
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx_ntaps(result, in_common, phase_inc, phase, in_a, 3, num_points);
+            break;
+        case 5:
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx_ntaps(result, in_common, phase_inc, phase, in_a, 5, num_points);
+            break;
+        case 7:
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx_ntaps(result, in_common, phase_inc, phase, in_a, 7, num_points);
+            break;
+        default:
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx_ntaps(result, in_common, phase_inc, phase, in_a, num_a_vectors, num_points);
+            break;
+        }
+}
+
 
 #endif /* LV_HAVE_AVX */
 
+
+#ifdef LV_HAVE_AVX512F
+#include <volk_gnsssdr/volk_gnsssdr_avx512_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx512f(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+#ifndef WIN32
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int tailPoints = num_points % 16;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t _phase = (*phase);
+
+    // duplicate each of the 16 real taps over the re/im pair of its sample
+    const __m512i tap_lo_idx = _mm512_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m512i tap_hi_idx = _mm512_setr_epi32(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+
+    __m512 a0Val, a1Val;
+    __m512 tapVal[num_a_vectors];
+    __m512 dotProdVal0[num_a_vectors];
+    __m512 dotProdVal1[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm512_setzero_ps();
+            dotProdVal1[vec_ind] = _mm512_setzero_ps();
+        }
+
+    // Set up the complex rotator: z0 holds phases 0..7, z1 phases 8..15
+    __m512 z0, z1;
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t phase_vec[16];
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            phase_vec[vec_ind] = _phase;
+            _phase *= phase_inc;
+        }
+
+    z0 = _mm512_load_ps((float*)phase_vec);
+    z1 = _mm512_load_ps((float*)(phase_vec + 8));
+
+    lv_32fc_t dz = phase_inc;
+    dz *= dz;
+    dz *= dz;
+    dz *= dz;
+    dz *= dz;  // dz = phase_inc^16;
+
+    for (vec_ind = 0; vec_ind < 8; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+
+    __m512 dz_reg = _mm512_load_ps((float*)phase_vec);
+    dz_reg = _mm512_complexnormalise_ps(dz_reg);
+
+    for (; number < sixteenthPoints; number++)
+        {
+            a0Val = _mm512_loadu_ps(aPtr);
+            a1Val = _mm512_loadu_ps(aPtr + 16);
+
+            a0Val = _mm512_complexmul_ps(a0Val, z0);
+            a1Val = _mm512_complexmul_ps(a1Val, z1);
+
+            z0 = _mm512_complexmul_ps(z0, dz_reg);
+            z1 = _mm512_complexmul_ps(z1, dz_reg);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    tapVal[vec_ind] = _mm512_loadu_ps(bPtr[vec_ind]);  // t0|t1|...|t15
+                    dotProdVal0[vec_ind] = _mm512_fmadd_ps(a0Val, _mm512_permutexvar_ps(tap_lo_idx, tapVal[vec_ind]), dotProdVal0[vec_ind]);
+                    dotProdVal1[vec_ind] = _mm512_fmadd_ps(a1Val, _mm512_permutexvar_ps(tap_hi_idx, tapVal[vec_ind]), dotProdVal1[vec_ind]);
+                    bPtr[vec_ind] += 16;
+                }
+
+            // Force the rotators back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    z0 = _mm512_complexnormalise_ps(z0);
+                    z1 = _mm512_complexnormalise_ps(z1);
+                }
+
+            aPtr += 32;
+        }
+
+    z0 = _mm512_complexnormalise_ps(z0);
+    _mm512_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+
+    if (tailPoints > 0)
+        {
+            // masked tail: phases beyond the tail are zero and the masked
+            // loads never touch memory past the end of the input vectors
+            for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+                {
+                    if ((unsigned int)vec_ind < tailPoints)
+                        {
+                            phase_vec[vec_ind] = _phase;
+                            _phase *= phase_inc;
+                        }
+                    else
+                        {
+                            phase_vec[vec_ind] = lv_cmake(0.0f, 0.0f);
+                        }
+                }
+            const __mmask16 m_lo = (__mmask16)((tailPoints >= 8) ? 0xFFFF : ((1U << (2 * tailPoints)) - 1));
+            const __mmask16 m_hi = (__mmask16)((tailPoints > 8) ? ((1U << (2 * (tailPoints - 8))) - 1) : 0);
+            const __mmask16 m_tap = (__mmask16)((1U << tailPoints) - 1);
+
+            z0 = _mm512_load_ps((float*)phase_vec);
+            z1 = _mm512_load_ps((float*)(phase_vec + 8));
+            a0Val = _mm512_complexmul_ps(_mm512_maskz_loadu_ps(m_lo, aPtr), z0);
+            a1Val = _mm512_complexmul_ps(_mm512_maskz_loadu_ps(m_hi, aPtr + 16), z1);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    tapVal[vec_ind] = _mm512_maskz_loadu_ps(m_tap, bPtr[vec_ind]);
+                    dotProdVal0[vec_ind] = _mm512_fmadd_ps(a0Val, _mm512_permutexvar_ps(tap_lo_idx, tapVal[vec_ind]), dotProdVal0[vec_ind]);
+                    dotProdVal1[vec_ind] = _mm512_fmadd_ps(a1Val, _mm512_permutexvar_ps(tap_hi_idx, tapVal[vec_ind]), dotProdVal1[vec_ind]);
+                }
+        }
+
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t dotProductVector[8];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm512_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm512_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0.0f, 0.0f);
+            for (i = 0; i < 8; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    *phase = _phase;
+#else
+    volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_generic_reload(result, in_common, phase_inc, phase, in_a, num_a_vectors, num_points);
+#endif
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <volk_gnsssdr/volk_gnsssdr_avx512_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx512f(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+#ifndef WIN32
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int tailPoints = num_points % 16;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t _phase = (*phase);
+
+    // duplicate each of the 16 real taps over the re/im pair of its sample
+    const __m512i tap_lo_idx = _mm512_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m512i tap_hi_idx = _mm512_setr_epi32(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+
+    __m512 a0Val, a1Val;
+    __m512 tapVal[num_a_vectors];
+    __m512 dotProdVal0[num_a_vectors];
+    __m512 dotProdVal1[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm512_setzero_ps();
+            dotProdVal1[vec_ind] = _mm512_setzero_ps();
+        }
+
+    // Set up the complex rotator: z0 holds phases 0..7, z1 phases 8..15
+    __m512 z0, z1;
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t phase_vec[16];
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            phase_vec[vec_ind] = _phase;
+            _phase *= phase_inc;
+        }
+
+    z0 = _mm512_load_ps((float*)phase_vec);
+    z1 = _mm512_load_ps((float*)(phase_vec + 8));
+
+    lv_32fc_t dz = phase_inc;
+    dz *= dz;
+    dz *= dz;
+    dz *= dz;
+    dz *= dz;  // dz = phase_inc^16;
+
+    for (vec_ind = 0; vec_ind < 8; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+
+    __m512 dz_reg = _mm512_load_ps((float*)phase_vec);
+    dz_reg = _mm512_complexnormalise_ps(dz_reg);
+
+    for (; number < sixteenthPoints; number++)
+        {
+            a0Val = _mm512_load_ps(aPtr);
+            a1Val = _mm512_load_ps(aPtr + 16);
+
+            a0Val = _mm512_complexmul_ps(a0Val, z0);
+            a1Val = _mm512_complexmul_ps(a1Val, z1);
+
+            z0 = _mm512_complexmul_ps(z0, dz_reg);
+            z1 = _mm512_complexmul_ps(z1, dz_reg);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    tapVal[vec_ind] = _mm512_loadu_ps(bPtr[vec_ind]);  // t0|t1|...|t15
+                    dotProdVal0[vec_ind] = _mm512_fmadd_ps(a0Val, _mm512_permutexvar_ps(tap_lo_idx, tapVal[vec_ind]), dotProdVal0[vec_ind]);
+                    dotProdVal1[vec_ind] = _mm512_fmadd_ps(a1Val, _mm512_permutexvar_ps(tap_hi_idx, tapVal[vec_ind]), dotProdVal1[vec_ind]);
+                    bPtr[vec_ind] += 16;
+                }
+
+            // Force the rotators back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    z0 = _mm512_complexnormalise_ps(z0);
+                    z1 = _mm512_complexnormalise_ps(z1);
+                }
+
+            aPtr += 32;
+        }
+
+    z0 = _mm512_complexnormalise_ps(z0);
+    _mm512_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+
+    if (tailPoints > 0)
+        {
+            // masked tail: phases beyond the tail are zero and the masked
+            // loads never touch memory past the end of the input vectors
+            for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+                {
+                    if ((unsigned int)vec_ind < tailPoints)
+                        {
+                            phase_vec[vec_ind] = _phase;
+                            _phase *= phase_inc;
+                        }
+                    else
+                        {
+                            phase_vec[vec_ind] = lv_cmake(0.0f, 0.0f);
+                        }
+                }
+            const __mmask16 m_lo = (__mmask16)((tailPoints >= 8) ? 0xFFFF : ((1U << (2 * tailPoints)) - 1));
+            const __mmask16 m_hi = (__mmask16)((tailPoints > 8) ? ((1U << (2 * (tailPoints - 8))) - 1) : 0);
+            const __mmask16 m_tap = (__mmask16)((1U << tailPoints) - 1);
+
+            z0 = _mm512_load_ps((float*)phase_vec);
+            z1 = _mm512_load_ps((float*)(phase_vec + 8));
+            a0Val = _mm512_complexmul_ps(_mm512_maskz_loadu_ps(m_lo, aPtr), z0);
+            a1Val = _mm512_complexmul_ps(_mm512_maskz_loadu_ps(m_hi, aPtr + 16), z1);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    tapVal[vec_ind] = _mm512_maskz_loadu_ps(m_tap, bPtr[vec_ind]);
+                    dotProdVal0[vec_ind] = _mm512_fmadd_ps(a0Val, _mm512_permutexvar_ps(tap_lo_idx, tapVal[vec_ind]), dotProdVal0[vec_ind]);
+                    dotProdVal1[vec_ind] = _mm512_fmadd_ps(a1Val, _mm512_permutexvar_ps(tap_hi_idx, tapVal[vec_ind]), dotProdVal1[vec_ind]);
+                }
+        }
+
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t dotProductVector[8];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm512_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm512_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0.0f, 0.0f);
+            for (i = 0; i < 8; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    *phase = _phase;
+#else
+    volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_generic_reload(result, in_common, phase_inc, phase, in_a, num_a_vectors, num_points);
+#endif
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_sve(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    // vector-length agnostic: n_elems complex samples are processed per vector
+    const unsigned int n_elems = (unsigned int)svcntw();
+    const svbool_t all = svptrue_b32();
+    int vec_ind;
+    unsigned int n;
+    unsigned int j;
+    unsigned int iter = 0;
+
+    // Staging buffers for the wiped (de-interleaved) signal: one bounded chunk
+    // lets the per-tap dot products run vectorized without arrays of sizeless
+    // SVE types, which the ACLE forbids
+    float wiped_re[512];
+    float wiped_im[512];
+    // phase ladder covering one vector (maximum SVE length: 2048 bits)
+    float ladder_re[64];
+    float ladder_im[64];
+
+    const float* aPtr = (const float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+            result[vec_ind] = lv_cmake(0.0f, 0.0f);
+        }
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+
+    lv_32fc_t p = _phase;
+    lv_32fc_t dz = lv_cmake(1.0f, 0.0f);
+    for (j = 0; j < n_elems; j++)
+        {
+            ladder_re[j] = lv_creal(p);
+            ladder_im[j] = lv_cimag(p);
+            p *= phase_inc;
+            dz *= phase_inc;  // dz = phase_inc^n_elems
+        }
+
+    svfloat32_t rot_re = svld1_f32(all, ladder_re);
+    svfloat32_t rot_im = svld1_f32(all, ladder_im);
+    const svfloat32_t dz_re = svdup_f32(lv_creal(dz));
+    const svfloat32_t dz_im = svdup_f32(lv_cimag(dz));
+
+    const unsigned int full_vecs = num_points / n_elems;
+    const unsigned int chunk_vecs = 512 / n_elems;
+    unsigned int v = 0;
+    while (v < full_vecs)
+        {
+            const unsigned int this_vecs = ((full_vecs - v) < chunk_vecs) ? (full_vecs - v) : chunk_vecs;
+            // carrier wipe-off into the staging buffers
+            for (j = 0; j < this_vecs; j++)
+                {
+                    const svfloat32x2_t in = svld2_f32(all, aPtr);
+                    const svfloat32_t in_re = svget2_f32(in, 0);
+                    const svfloat32_t in_im = svget2_f32(in, 1);
+                    svst1_f32(all, wiped_re + j * n_elems, svmls_f32_x(all, svmul_f32_x(all, in_re, rot_re), in_im, rot_im));
+                    svst1_f32(all, wiped_im + j * n_elems, svmla_f32_x(all, svmul_f32_x(all, in_re, rot_im), in_im, rot_re));
+                    // advance the rotator by one vector of samples
+                    const svfloat32_t t = svmls_f32_x(all, svmul_f32_x(all, rot_re, dz_re), rot_im, dz_im);
+                    rot_im = svmla_f32_x(all, svmul_f32_x(all, rot_re, dz_im), rot_im, dz_re);
+                    rot_re = t;
+                    // Force the rotators back onto the unit circle
+                    if ((++iter % 64) == 0)
+                        {
+                            const svfloat32_t norm = svsqrt_f32_x(all, svmla_f32_x(all, svmul_f32_x(all, rot_re, rot_re), rot_im, rot_im));
+                            rot_re = svdiv_f32_x(all, rot_re, norm);
+                            rot_im = svdiv_f32_x(all, rot_im, norm);
+                        }
+                    aPtr += 2 * n_elems;
+                }
+            // per-tap dot products over the chunk
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    svfloat32_t acc_re = svdup_f32(0.0f);
+                    svfloat32_t acc_im = svdup_f32(0.0f);
+                    for (j = 0; j < this_vecs; j++)
+                        {
+                            const svfloat32_t taps = svld1_f32(all, bPtr[vec_ind] + j * n_elems);
+                            acc_re = svmla_f32_x(all, acc_re, svld1_f32(all, wiped_re + j * n_elems), taps);
+                            acc_im = svmla_f32_x(all, acc_im, svld1_f32(all, wiped_im + j * n_elems), taps);
+                        }
+                    result[vec_ind] += lv_cmake(svaddv_f32(all, acc_re), svaddv_f32(all, acc_im));
+                    bPtr[vec_ind] += this_vecs * n_elems;
+                }
+            v += this_vecs;
+        }
+
+    // recover the scalar phase of the first unprocessed sample (lane 0)
+    _phase = lv_cmake(svlasta_f32(svpfalse_b(), rot_re), svlasta_f32(svpfalse_b(), rot_im));
+#ifdef __cplusplus
+    _phase /= std::abs(_phase);
+#else
+    _phase /= hypotf(lv_creal(_phase), lv_cimag(_phase));
+#endif
+
+    for (n = full_vecs * n_elems; n < num_points; n++)
+        {
+            wo = in_common[n] * _phase;
+            _phase *= phase_inc;
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][n];
+                }
+        }
+
+    *phase = _phase;
+}
+
+#endif /* LV_HAVE_SVE */
+
 #endif /* INCLUDED_volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_H */
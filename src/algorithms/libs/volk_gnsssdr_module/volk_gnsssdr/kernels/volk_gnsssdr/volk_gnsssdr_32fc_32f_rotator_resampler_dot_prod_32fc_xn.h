@@ -0,0 +1,632 @@
+/*!
+ * \file volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn.h
+ * \brief VOLK_GNSSSDR kernel: rotates a common complex vector, resamples a real
+ * local code at N shifts on the fly, and accumulates the products in N float
+ * complex outputs.
+ *
+ * VOLK_GNSSSDR kernel that fuses the code resampling and the rotator dot
+ * product in a single pass. The resampled code tap is computed inside the
+ * accumulation loop instead of being materialized in temporary buffers, so
+ * the sample block is streamed through memory only once. It is optimized to
+ * perform the N tap correlation process in GNSS receivers when the resampled
+ * codes cannot be reused between calls.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn
+ *
+ * \b Overview
+ *
+ * Rotates the reference complex vector at a fixed rate per sample from an
+ * initial \p phase offset, multiplies it by the local code resampled at an
+ * arbitrary number of shifts, and accumulates the results into the output
+ * vector. Equivalent to volk_gnsssdr_32f_xn_resampler_32f_xn followed by
+ * volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn, but without the
+ * intermediate resampled-code buffers, halving the memory traffic of the
+ * correlation hot path.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li in_common:             Pointer to the vector to be rotated, multiplied and accumulated (reference vector).
+ * \li phase_inc:             Phase increment = lv_cmake(cos(phase_step_rad), sin(phase_step_rad))
+ * \li phase:                 Initial phase = lv_cmake(cos(initial_phase_rad), sin(initial_phase_rad))
+ * \li local_code:            Vector with the original local code, one tap per chip.
+ * \li rem_code_phase_chips:  Remnant code phase at the sample zero, in chips.
+ * \li code_phase_step_chips: Phase increment per sample, in chips.
+ * \li shifts_chips:          Vector of \p num_a_vectors shifts, in chips, of the local code replicas.
+ * \li code_length_chips:     Code length in chips.
+ * \li num_a_vectors:         Number of replicas to be correlated and accumulated.
+ * \li num_points:            Number of complex values to be rotated, multiplied together, accumulated and stored into \p result.
+ *
+ * \b Outputs
+ * \li phase:                 Final phase.
+ * \li result:                Vector of \p num_a_vectors accumulated correlator outputs.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_H
+#define INCLUDED_volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_H
+
+
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+#include <volk_gnsssdr/volk_gnsssdr_malloc.h>
+#include <math.h>
+#include <stdlib.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_generic(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    lv_32fc_t tmp32_1;
+    int local_code_chip_index;
+    int n_vec;
+    unsigned int n;
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            result[n_vec] = lv_cmake(0.0f, 0.0f);
+        }
+    for (n = 0; n < num_points; n++)
+        {
+            tmp32_1 = *in_common++ * (*phase);
+
+            // Regenerate phase
+            if (n % 256 == 0)
+                {
+#ifdef __cplusplus
+                    (*phase) /= std::abs((*phase));
+#else
+                    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+#endif
+                }
+
+            (*phase) *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    // resample the code for the current tap on the fly
+                    local_code_chip_index = (int)floor(code_phase_step_chips * (float)n + shifts_chips[n_vec] - rem_code_phase_chips);
+                    // Take into account that in multitap correlators, the shifts can be negative!
+                    if (local_code_chip_index < 0) local_code_chip_index += (int)code_length_chips * (abs(local_code_chip_index) / code_length_chips + 1);
+                    local_code_chip_index = local_code_chip_index % code_length_chips;
+                    result[n_vec] += tmp32_1 * local_code[local_code_chip_index];
+                }
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <volk_gnsssdr/volk_gnsssdr_avx_intrinsics.h>
+#include <immintrin.h>
+static inline __VOLK_ATTR_INLINE void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_u_avx_ntaps(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+#ifndef WIN32
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    unsigned int k = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    const float* aPtr = (const float*)in_common;
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+    int local_code_chip_index_;
+
+    // resampler constants
+    const __m256 eights = _mm256_set1_ps(8.0f);
+    const __m256 code_phase_step_chips_reg = _mm256_set1_ps(code_phase_step_chips);
+    const __m256 zeros = _mm256_setzero_ps();
+    const __m256 code_length_chips_reg_f = _mm256_set1_ps((float)code_length_chips);
+    const __m256 n0 = _mm256_set_ps(7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);
+    __m256 indexn = n0;
+
+    __VOLK_ATTR_ALIGNED(32)
+    int local_code_chip_index[8];
+    __VOLK_ATTR_ALIGNED(32)
+    float code_gather[8];
+
+    __m256i local_code_chip_index_reg, it;
+    __m256 aux, aux3, c, cTrunc, base, negatives;
+    __m256 a0Val, a1Val, xVal, xloVal, xhiVal, b0Val, b1Val;
+
+    // per-tap constant shift, in chips
+    __m256 aux2[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            aux2[vec_ind] = _mm256_sub_ps(_mm256_set1_ps(shifts_chips[vec_ind]), _mm256_set1_ps(rem_code_phase_chips));
+        }
+
+    __m256 dotProdVal0[num_a_vectors];
+    __m256 dotProdVal1[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm256_setzero_ps();
+            dotProdVal1[vec_ind] = _mm256_setzero_ps();
+        }
+
+    // Set up the complex rotator
+    __m256 z0, z1;
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_vec[8];
+    for (vec_ind = 0; vec_ind < 8; ++vec_ind)
+        {
+            phase_vec[vec_ind] = _phase;
+            _phase *= phase_inc;
+        }
+
+    z0 = _mm256_load_ps((float*)phase_vec);
+    z1 = _mm256_load_ps((float*)(phase_vec + 4));
+
+    lv_32fc_t dz = phase_inc;
+    dz *= dz;
+    dz *= dz;
+    dz *= dz;  // dz = phase_inc^8;
+
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+
+    __m256 dz_reg = _mm256_load_ps((float*)phase_vec);
+    dz_reg = _mm256_complexnormalise_ps(dz_reg);
+
+    for (; number < eighthPoints; number++)
+        {
+            a0Val = _mm256_loadu_ps(aPtr);
+            a1Val = _mm256_loadu_ps(aPtr + 8);
+
+            a0Val = _mm256_complexmul_ps(a0Val, z0);
+            a1Val = _mm256_complexmul_ps(a1Val, z1);
+
+            z0 = _mm256_complexmul_ps(z0, dz_reg);
+            z1 = _mm256_complexmul_ps(z1, dz_reg);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    // resample the code for the current tap on the fly
+                    aux = _mm256_mul_ps(code_phase_step_chips_reg, indexn);
+                    aux = _mm256_add_ps(aux, aux2[vec_ind]);
+                    // floor
+                    aux = _mm256_floor_ps(aux);
+
+                    // fmod
+                    c = _mm256_div_ps(aux, code_length_chips_reg_f);
+                    it = _mm256_cvttps_epi32(c);
+                    cTrunc = _mm256_cvtepi32_ps(it);
+                    base = _mm256_mul_ps(cTrunc, code_length_chips_reg_f);
+                    local_code_chip_index_reg = _mm256_cvttps_epi32(_mm256_sub_ps(aux, base));
+
+                    // no negatives
+                    c = _mm256_cvtepi32_ps(local_code_chip_index_reg);
+                    negatives = _mm256_cmp_ps(c, zeros, 0x01);
+                    aux3 = _mm256_and_ps(code_length_chips_reg_f, negatives);
+                    aux = _mm256_add_ps(c, aux3);
+                    local_code_chip_index_reg = _mm256_cvttps_epi32(aux);
+
+                    _mm256_store_si256((__m256i*)local_code_chip_index, local_code_chip_index_reg);
+                    for (k = 0; k < 8; ++k)
+                        {
+                            code_gather[k] = local_code[local_code_chip_index[k]];
+                        }
+
+                    xVal = _mm256_load_ps(code_gather);                // t0|t1|t2|t3|t4|t5|t6|t7
+                    xloVal = _mm256_unpacklo_ps(xVal, xVal);           // t0|t0|t1|t1|t4|t4|t5|t5
+                    xhiVal = _mm256_unpackhi_ps(xVal, xVal);           // t2|t2|t3|t3|t6|t6|t7|t7
+                    b0Val = _mm256_permute2f128_ps(xloVal, xhiVal, 0x20);  // t0|t0|t1|t1|t2|t2|t3|t3
+                    b1Val = _mm256_permute2f128_ps(xloVal, xhiVal, 0x31);  // t4|t4|t5|t5|t6|t6|t7|t7
+
+                    dotProdVal0[vec_ind] = _mm256_add_ps(_mm256_mul_ps(a0Val, b0Val), dotProdVal0[vec_ind]);
+                    dotProdVal1[vec_ind] = _mm256_add_ps(_mm256_mul_ps(a1Val, b1Val), dotProdVal1[vec_ind]);
+                }
+
+            // Force the rotators back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    z0 = _mm256_complexnormalise_ps(z0);
+                    z1 = _mm256_complexnormalise_ps(z1);
+                }
+
+            indexn = _mm256_add_ps(indexn, eights);
+            aPtr += 16;
+        }
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t dotProductVector[4];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm256_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0.0f, 0.0f);
+            for (i = 0; i < 4; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    z0 = _mm256_complexnormalise_ps(z0);
+    _mm256_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= phase_inc;
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    local_code_chip_index_ = (int)floor(code_phase_step_chips * (float)number + shifts_chips[vec_ind] - rem_code_phase_chips);
+                    // Take into account that in multitap correlators, the shifts can be negative!
+                    if (local_code_chip_index_ < 0) local_code_chip_index_ += (int)code_length_chips * (abs(local_code_chip_index_) / code_length_chips + 1);
+                    local_code_chip_index_ = local_code_chip_index_ % code_length_chips;
+                    result[vec_ind] += wo * local_code[local_code_chip_index_];
+                }
+        }
+
+    *phase = _phase;
+#else
+    volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_generic(result, in_common, phase_inc, phase, local_code, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+#endif
+}
+
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_u_avx(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    // Re-dispatch on the tap counts used by the tracking loops so the
+    // always-inlined worker sees a compile-time constant and the per-tap
+    // accumulator arrays are fully unrolled into registers
+    switch (num_a_vectors)
+        {
+        case 3:
+            volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_u_avx_ntaps(result, in_common, phase_inc, phase, local_code, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, 3, num_points);
+            break;
+        case 5:
+            volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_u_avx_ntaps(result, in_common, phase_inc, phase, local_code, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, 5, num_points);
+            break;
+        case 7:
+            volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_u_avx_ntaps(result, in_common, phase_inc, phase, local_code, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, 7, num_points);
+            break;
+        default:
+            volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_u_avx_ntaps(result, in_common, phase_inc, phase, local_code, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+            break;
+        }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX
+#include <volk_gnsssdr/volk_gnsssdr_avx_intrinsics.h>
+#include <immintrin.h>
+static inline __VOLK_ATTR_INLINE void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_a_avx_ntaps(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+#ifndef WIN32
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    unsigned int k = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    const float* aPtr = (const float*)in_common;
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+    int local_code_chip_index_;
+
+    // resampler constants
+    const __m256 eights = _mm256_set1_ps(8.0f);
+    const __m256 code_phase_step_chips_reg = _mm256_set1_ps(code_phase_step_chips);
+    const __m256 zeros = _mm256_setzero_ps();
+    const __m256 code_length_chips_reg_f = _mm256_set1_ps((float)code_length_chips);
+    const __m256 n0 = _mm256_set_ps(7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);
+    __m256 indexn = n0;
+
+    __VOLK_ATTR_ALIGNED(32)
+    int local_code_chip_index[8];
+    __VOLK_ATTR_ALIGNED(32)
+    float code_gather[8];
+
+    __m256i local_code_chip_index_reg, it;
+    __m256 aux, aux3, c, cTrunc, base, negatives;
+    __m256 a0Val, a1Val, xVal, xloVal, xhiVal, b0Val, b1Val;
+
+    // per-tap constant shift, in chips
+    __m256 aux2[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            aux2[vec_ind] = _mm256_sub_ps(_mm256_set1_ps(shifts_chips[vec_ind]), _mm256_set1_ps(rem_code_phase_chips));
+        }
+
+    __m256 dotProdVal0[num_a_vectors];
+    __m256 dotProdVal1[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm256_setzero_ps();
+            dotProdVal1[vec_ind] = _mm256_setzero_ps();
+        }
+
+    // Set up the complex rotator
+    __m256 z0, z1;
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_vec[8];
+    for (vec_ind = 0; vec_ind < 8; ++vec_ind)
+        {
+            phase_vec[vec_ind] = _phase;
+            _phase *= phase_inc;
+        }
+
+    z0 = _mm256_load_ps((float*)phase_vec);
+    z1 = _mm256_load_ps((float*)(phase_vec + 4));
+
+    lv_32fc_t dz = phase_inc;
+    dz *= dz;
+    dz *= dz;
+    dz *= dz;  // dz = phase_inc^8;
+
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+
+    __m256 dz_reg = _mm256_load_ps((float*)phase_vec);
+    dz_reg = _mm256_complexnormalise_ps(dz_reg);
+
+    for (; number < eighthPoints; number++)
+        {
+            a0Val = _mm256_load_ps(aPtr);
+            a1Val = _mm256_load_ps(aPtr + 8);
+
+            a0Val = _mm256_complexmul_ps(a0Val, z0);
+            a1Val = _mm256_complexmul_ps(a1Val, z1);
+
+            z0 = _mm256_complexmul_ps(z0, dz_reg);
+            z1 = _mm256_complexmul_ps(z1, dz_reg);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    // resample the code for the current tap on the fly
+                    aux = _mm256_mul_ps(code_phase_step_chips_reg, indexn);
+                    aux = _mm256_add_ps(aux, aux2[vec_ind]);
+                    // floor
+                    aux = _mm256_floor_ps(aux);
+
+                    // fmod
+                    c = _mm256_div_ps(aux, code_length_chips_reg_f);
+                    it = _mm256_cvttps_epi32(c);
+                    cTrunc = _mm256_cvtepi32_ps(it);
+                    base = _mm256_mul_ps(cTrunc, code_length_chips_reg_f);
+                    local_code_chip_index_reg = _mm256_cvttps_epi32(_mm256_sub_ps(aux, base));
+
+                    // no negatives
+                    c = _mm256_cvtepi32_ps(local_code_chip_index_reg);
+                    negatives = _mm256_cmp_ps(c, zeros, 0x01);
+                    aux3 = _mm256_and_ps(code_length_chips_reg_f, negatives);
+                    aux = _mm256_add_ps(c, aux3);
+                    local_code_chip_index_reg = _mm256_cvttps_epi32(aux);
+
+                    _mm256_store_si256((__m256i*)local_code_chip_index, local_code_chip_index_reg);
+                    for (k = 0; k < 8; ++k)
+                        {
+                            code_gather[k] = local_code[local_code_chip_index[k]];
+                        }
+
+                    xVal = _mm256_load_ps(code_gather);                // t0|t1|t2|t3|t4|t5|t6|t7
+                    xloVal = _mm256_unpacklo_ps(xVal, xVal);           // t0|t0|t1|t1|t4|t4|t5|t5
+                    xhiVal = _mm256_unpackhi_ps(xVal, xVal);           // t2|t2|t3|t3|t6|t6|t7|t7
+                    b0Val = _mm256_permute2f128_ps(xloVal, xhiVal, 0x20);  // t0|t0|t1|t1|t2|t2|t3|t3
+                    b1Val = _mm256_permute2f128_ps(xloVal, xhiVal, 0x31);  // t4|t4|t5|t5|t6|t6|t7|t7
+
+                    dotProdVal0[vec_ind] = _mm256_add_ps(_mm256_mul_ps(a0Val, b0Val), dotProdVal0[vec_ind]);
+                    dotProdVal1[vec_ind] = _mm256_add_ps(_mm256_mul_ps(a1Val, b1Val), dotProdVal1[vec_ind]);
+                }
+
+            // Force the rotators back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    z0 = _mm256_complexnormalise_ps(z0);
+                    z1 = _mm256_complexnormalise_ps(z1);
+                }
+
+            indexn = _mm256_add_ps(indexn, eights);
+            aPtr += 16;
+        }
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t dotProductVector[4];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm256_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0.0f, 0.0f);
+            for (i = 0; i < 4; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    z0 = _mm256_complexnormalise_ps(z0);
+    _mm256_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= phase_inc;
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    local_code_chip_index_ = (int)floor(code_phase_step_chips * (float)number + shifts_chips[vec_ind] - rem_code_phase_chips);
+                    // Take into account that in multitap correlators, the shifts can be negative!
+                    if (local_code_chip_index_ < 0) local_code_chip_index_ += (int)code_length_chips * (abs(local_code_chip_index_) / code_length_chips + 1);
+                    local_code_chip_index_ = local_code_chip_index_ % code_length_chips;
+                    result[vec_ind] += wo * local_code[local_code_chip_index_];
+                }
+        }
+
+    *phase = _phase;
+#else
+    volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_generic(result, in_common, phase_inc, phase, local_code, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+#endif
+}
+
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_a_avx(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    // Re-dispatch on the tap counts used by the tracking loops so the
+    // always-inlined worker sees a compile-time constant and the per-tap
+    // accumulator arrays are fully unrolled into registers
+    switch (num_a_vectors)
+        {
+        case 3:
+            volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_a_avx_ntaps(result, in_common, phase_inc, phase, local_code, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, 3, num_points);
+            break;
+        case 5:
+            volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_a_avx_ntaps(result, in_common, phase_inc, phase, local_code, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, 5, num_points);
+            break;
+        case 7:
+            volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_a_avx_ntaps(result, in_common, phase_inc, phase, local_code, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, 7, num_points);
+            break;
+        default:
+            volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_a_avx_ntaps(result, in_common, phase_inc, phase, local_code, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+            break;
+        }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_sve(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    // vector-length agnostic: n_elems complex samples are processed per vector
+    const unsigned int n_elems = (unsigned int)svcntw();
+    const svbool_t all = svptrue_b32();
+    int vec_ind;
+    unsigned int n;
+    unsigned int j;
+    unsigned int iter = 0;
+
+    // phase ladder covering one vector (maximum SVE length: 2048 bits)
+    float ladder_re[64];
+    float ladder_im[64];
+
+    const float* aPtr = (const float*)in_common;
+
+    // resampler constants
+    const float code_length_chips_f = (float)code_length_chips;
+    const svfloat32_t code_phase_step_chips_reg = svdup_f32(code_phase_step_chips);
+    const svfloat32_t code_length_chips_reg_f = svdup_f32(code_length_chips_f);
+    const svint32_t code_length_chips_reg_i = svdup_s32((int32_t)code_length_chips);
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+    int local_code_chip_index_;
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            result[vec_ind] = lv_cmake(0.0f, 0.0f);
+        }
+
+    lv_32fc_t p = _phase;
+    lv_32fc_t dz = lv_cmake(1.0f, 0.0f);
+    for (j = 0; j < n_elems; j++)
+        {
+            ladder_re[j] = lv_creal(p);
+            ladder_im[j] = lv_cimag(p);
+            p *= phase_inc;
+            dz *= phase_inc;  // dz = phase_inc^n_elems
+        }
+
+    svfloat32_t rot_re = svld1_f32(all, ladder_re);
+    svfloat32_t rot_im = svld1_f32(all, ladder_im);
+    const svfloat32_t dz_re = svdup_f32(lv_creal(dz));
+    const svfloat32_t dz_im = svdup_f32(lv_cimag(dz));
+
+    const unsigned int full_vecs = num_points / n_elems;
+    for (n = 0; n < full_vecs; n++)
+        {
+            // carrier wipe-off
+            const svfloat32x2_t in = svld2_f32(all, aPtr);
+            const svfloat32_t in_re = svget2_f32(in, 0);
+            const svfloat32_t in_im = svget2_f32(in, 1);
+            const svfloat32_t w_re = svmls_f32_x(all, svmul_f32_x(all, in_re, rot_re), in_im, rot_im);
+            const svfloat32_t w_im = svmla_f32_x(all, svmul_f32_x(all, in_re, rot_im), in_im, rot_re);
+            // advance the rotator by one vector of samples
+            const svfloat32_t t = svmls_f32_x(all, svmul_f32_x(all, rot_re, dz_re), rot_im, dz_im);
+            rot_im = svmla_f32_x(all, svmul_f32_x(all, rot_re, dz_im), rot_im, dz_re);
+            rot_re = t;
+            // Force the rotators back onto the unit circle
+            if ((++iter % 64) == 0)
+                {
+                    const svfloat32_t norm = svsqrt_f32_x(all, svmla_f32_x(all, svmul_f32_x(all, rot_re, rot_re), rot_im, rot_im));
+                    rot_re = svdiv_f32_x(all, rot_re, norm);
+                    rot_im = svdiv_f32_x(all, rot_im, norm);
+                }
+            const svfloat32_t indexn = svcvt_f32_s32_x(all, svindex_s32((int32_t)(n * n_elems), 1));
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    // resample the code for the current tap on the fly
+                    svfloat32_t aux = svmla_f32_x(all, svdup_f32(shifts_chips[vec_ind] - rem_code_phase_chips), code_phase_step_chips_reg, indexn);
+                    aux = svrintm_f32_x(all, aux);  // floor
+                    // fmod via truncated division
+                    const svfloat32_t c = svdiv_f32_x(all, aux, code_length_chips_reg_f);
+                    const svint32_t i = svcvt_s32_f32_x(all, c);  // convert truncates
+                    const svfloat32_t cTrunc = svmul_f32_x(all, svcvt_f32_s32_x(all, i), code_length_chips_reg_f);
+                    svint32_t local_code_chip_index_reg = svcvt_s32_f32_x(all, svsub_f32_x(all, aux, cTrunc));
+                    // Take into account that in multitap correlators, the shifts can be negative!
+                    const svbool_t negatives = svcmplt_n_s32(all, local_code_chip_index_reg, 0);
+                    local_code_chip_index_reg = svadd_s32_m(negatives, local_code_chip_index_reg, code_length_chips_reg_i);
+                    const svfloat32_t code = svld1_gather_s32index_f32(all, local_code, local_code_chip_index_reg);
+                    result[vec_ind] += lv_cmake(svaddv_f32(all, svmul_f32_x(all, w_re, code)), svaddv_f32(all, svmul_f32_x(all, w_im, code)));
+                }
+            aPtr += 2 * n_elems;
+        }
+
+    // recover the scalar phase of the first unprocessed sample (lane 0)
+    _phase = lv_cmake(svlasta_f32(svpfalse_b(), rot_re), svlasta_f32(svpfalse_b(), rot_im));
+#ifdef __cplusplus
+    _phase /= std::abs(_phase);
+#else
+    _phase /= hypotf(lv_creal(_phase), lv_cimag(_phase));
+#endif
+
+    for (n = full_vecs * n_elems; n < num_points; n++)
+        {
+            wo = in_common[n] * _phase;
+            _phase *= phase_inc;
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    local_code_chip_index_ = (int)floor(code_phase_step_chips * (float)n + shifts_chips[vec_ind] - rem_code_phase_chips);
+                    // Take into account that in multitap correlators, the shifts can be negative!
+                    if (local_code_chip_index_ < 0) local_code_chip_index_ += (int)code_length_chips * (abs(local_code_chip_index_) / code_length_chips + 1);
+                    local_code_chip_index_ = local_code_chip_index_ % code_length_chips;
+                    result[vec_ind] += wo * local_code[local_code_chip_index_];
+                }
+        }
+
+    *phase = _phase;
+}
+
+#endif /* LV_HAVE_SVE */
+
+#endif /* INCLUDED_volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_H */
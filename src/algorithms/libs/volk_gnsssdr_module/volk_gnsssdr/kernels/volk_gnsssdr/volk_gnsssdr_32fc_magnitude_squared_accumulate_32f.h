@@ -0,0 +1,168 @@
+/*!
+ * \file volk_gnsssdr_32fc_magnitude_squared_accumulate_32f.h
+ * \brief VOLK_GNSSSDR kernel: accumulates the squared magnitude of a complex vector.
+ *
+ * VOLK_GNSSSDR kernel that adds the squared magnitude of a complex float
+ * vector onto a float accumulator in a single pass.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_32fc_magnitude_squared_accumulate_32f
+ *
+ * \b Overview
+ *
+ * Computes accumulator[n] += real(in[n])^2 + imag(in[n])^2. Fusing the
+ * squared magnitude with the accumulation reads the accumulator once and
+ * writes it once, instead of staging the magnitudes in a temporary vector
+ * that is immediately re-read, which matters when the accumulator (e.g. a
+ * noncoherent acquisition grid) is streamed through the cache every dwell.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_32fc_magnitude_squared_accumulate_32f(float* accumulator, const lv_32fc_t* complexVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li complexVector: The complex input vector.
+ * \li num_points:    The number of values to be accumulated.
+ *
+ * \b Outputs
+ * \li accumulator: Buffer holding the running sums, updated in place.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32fc_magnitude_squared_accumulate_32f_H
+#define INCLUDED_volk_gnsssdr_32fc_magnitude_squared_accumulate_32f_H
+
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_32fc_magnitude_squared_accumulate_32f_generic(float* accumulator, const lv_32fc_t* complexVector, unsigned int num_points)
+{
+    const float* complexVectorPtr = (const float*)complexVector;
+    unsigned int i;
+    for (i = 0; i < num_points; i++)
+        {
+            const float real = *complexVectorPtr++;
+            const float imag = *complexVectorPtr++;
+            accumulator[i] += real * real + imag * imag;
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+
+static inline void volk_gnsssdr_32fc_magnitude_squared_accumulate_32f_u_sse3(float* accumulator, const lv_32fc_t* complexVector, unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float* complexVectorPtr = (const float*)complexVector;
+    float* accumulatorPtr = accumulator;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++)
+        {
+            __m128 cplxValue1 = _mm_loadu_ps(complexVectorPtr);
+            complexVectorPtr += 4;
+            __m128 cplxValue2 = _mm_loadu_ps(complexVectorPtr);
+            complexVectorPtr += 4;
+
+            cplxValue1 = _mm_mul_ps(cplxValue1, cplxValue1);
+            cplxValue2 = _mm_mul_ps(cplxValue2, cplxValue2);
+
+            const __m128 result = _mm_hadd_ps(cplxValue1, cplxValue2);
+            _mm_storeu_ps(accumulatorPtr, _mm_add_ps(_mm_loadu_ps(accumulatorPtr), result));
+            accumulatorPtr += 4;
+        }
+
+    for (number = quarterPoints * 4; number < num_points; number++)
+        {
+            const float real = *complexVectorPtr++;
+            const float imag = *complexVectorPtr++;
+            *accumulatorPtr++ += real * real + imag * imag;
+        }
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+
+static inline void volk_gnsssdr_32fc_magnitude_squared_accumulate_32f_a_sse3(float* accumulator, const lv_32fc_t* complexVector, unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float* complexVectorPtr = (const float*)complexVector;
+    float* accumulatorPtr = accumulator;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++)
+        {
+            __m128 cplxValue1 = _mm_load_ps(complexVectorPtr);
+            complexVectorPtr += 4;
+            __m128 cplxValue2 = _mm_load_ps(complexVectorPtr);
+            complexVectorPtr += 4;
+
+            cplxValue1 = _mm_mul_ps(cplxValue1, cplxValue1);
+            cplxValue2 = _mm_mul_ps(cplxValue2, cplxValue2);
+
+            const __m128 result = _mm_hadd_ps(cplxValue1, cplxValue2);
+            _mm_store_ps(accumulatorPtr, _mm_add_ps(_mm_load_ps(accumulatorPtr), result));
+            accumulatorPtr += 4;
+        }
+
+    for (number = quarterPoints * 4; number < num_points; number++)
+        {
+            const float real = *complexVectorPtr++;
+            const float imag = *complexVectorPtr++;
+            *accumulatorPtr++ += real * real + imag * imag;
+        }
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_32fc_magnitude_squared_accumulate_32f_neon(float* accumulator, const lv_32fc_t* complexVector, unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float* complexVectorPtr = (const float*)complexVector;
+    float* accumulatorPtr = accumulator;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++)
+        {
+            const float32x4x2_t cplxValue = vld2q_f32(complexVectorPtr);
+            complexVectorPtr += 8;
+            float32x4_t magSq = vmulq_f32(cplxValue.val[0], cplxValue.val[0]);
+            magSq = vmlaq_f32(magSq, cplxValue.val[1], cplxValue.val[1]);
+            vst1q_f32(accumulatorPtr, vaddq_f32(vld1q_f32(accumulatorPtr), magSq));
+            accumulatorPtr += 4;
+        }
+
+    for (number = quarterPoints * 4; number < num_points; number++)
+        {
+            const float real = *complexVectorPtr++;
+            const float imag = *complexVectorPtr++;
+            *accumulatorPtr++ += real * real + imag * imag;
+        }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_32fc_magnitude_squared_accumulate_32f_H */
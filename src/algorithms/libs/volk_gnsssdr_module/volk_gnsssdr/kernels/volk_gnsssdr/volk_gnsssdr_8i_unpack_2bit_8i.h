@@ -0,0 +1,145 @@
+/*!
+ * \file volk_gnsssdr_8i_unpack_2bit_8i.h
+ * \brief VOLK_GNSSSDR kernel: unpacks 2-bit packed bytes into 8-bit samples.
+ * \authors <ul>
+ *          <li> Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *          </ul>
+ *
+ * VOLK_GNSSSDR kernel that expands bytes holding four 2-bit samples into
+ * sign-mapped 8-bit samples
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8i_unpack_2bit_8i
+ *
+ * \b Overview
+ *
+ * Unpacks bytes that hold four 2-bit two's complement samples, least
+ * significant pair first, and maps each sample s to (2 * s + 1), so the
+ * output alphabet is {-3, -1, 1, 3}.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8i_unpack_2bit_8i(int8_t* outputVector, const int8_t* inputVector, unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The packed input bytes (num_points / 4 bytes are read).
+ * \li num_points: Number of output samples; must be a multiple of 4.
+ *
+ * \b Outputs
+ * \li outputVector: The unpacked samples.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8i_unpack_2bit_8i_H
+#define INCLUDED_volk_gnsssdr_8i_unpack_2bit_8i_H
+
+#include <stdint.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8i_unpack_2bit_8i_generic(int8_t* outputVector, const int8_t* inputVector, unsigned int num_points)
+{
+    /* (2 * s + 1) for the four 2-bit two's complement values */
+    const int8_t map[4] = {1, 3, -3, -1};
+    const unsigned int num_bytes = num_points / 4;
+    unsigned int i;
+    int8_t byte;
+    int8_t* outPtr = outputVector;
+    for (i = 0; i < num_bytes; i++)
+        {
+            byte = inputVector[i];
+            *outPtr++ = map[byte & 3];
+            *outPtr++ = map[(byte >> 2) & 3];
+            *outPtr++ = map[(byte >> 4) & 3];
+            *outPtr++ = map[(byte >> 6) & 3];
+        }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8i_unpack_2bit_8i_u_ssse3(int8_t* outputVector, const int8_t* inputVector, unsigned int num_points)
+{
+    const unsigned int sse_iters = (num_points / 4) / 16;
+    const __m128i lut = _mm_setr_epi8(1, 3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask = _mm_set1_epi8(3);
+    const int8_t* inPtr = inputVector;
+    int8_t* outPtr = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            const __m128i packed = _mm_loadu_si128((const __m128i*)inPtr);
+            /* one byte vector per 2-bit field, mapped through the table */
+            const __m128i v0 = _mm_shuffle_epi8(lut, _mm_and_si128(packed, mask));
+            const __m128i v1 = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(packed, 2), mask));
+            const __m128i v2 = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(packed, 4), mask));
+            const __m128i v3 = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(packed, 6), mask));
+            /* interleave back to v0[i], v1[i], v2[i], v3[i] per input byte */
+            const __m128i lo01 = _mm_unpacklo_epi8(v0, v1);
+            const __m128i lo23 = _mm_unpacklo_epi8(v2, v3);
+            const __m128i hi01 = _mm_unpackhi_epi8(v0, v1);
+            const __m128i hi23 = _mm_unpackhi_epi8(v2, v3);
+            _mm_storeu_si128((__m128i*)outPtr, _mm_unpacklo_epi16(lo01, lo23));
+            _mm_storeu_si128((__m128i*)(outPtr + 16), _mm_unpackhi_epi16(lo01, lo23));
+            _mm_storeu_si128((__m128i*)(outPtr + 32), _mm_unpacklo_epi16(hi01, hi23));
+            _mm_storeu_si128((__m128i*)(outPtr + 48), _mm_unpackhi_epi16(hi01, hi23));
+            inPtr += 16;
+            outPtr += 64;
+        }
+
+    volk_gnsssdr_8i_unpack_2bit_8i_generic(outPtr, inPtr, num_points - sse_iters * 64);
+}
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8i_unpack_2bit_8i_a_ssse3(int8_t* outputVector, const int8_t* inputVector, unsigned int num_points)
+{
+    const unsigned int sse_iters = (num_points / 4) / 16;
+    const __m128i lut = _mm_setr_epi8(1, 3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask = _mm_set1_epi8(3);
+    const int8_t* inPtr = inputVector;
+    int8_t* outPtr = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            const __m128i packed = _mm_load_si128((const __m128i*)inPtr);
+            const __m128i v0 = _mm_shuffle_epi8(lut, _mm_and_si128(packed, mask));
+            const __m128i v1 = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(packed, 2), mask));
+            const __m128i v2 = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(packed, 4), mask));
+            const __m128i v3 = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(packed, 6), mask));
+            const __m128i lo01 = _mm_unpacklo_epi8(v0, v1);
+            const __m128i lo23 = _mm_unpacklo_epi8(v2, v3);
+            const __m128i hi01 = _mm_unpackhi_epi8(v0, v1);
+            const __m128i hi23 = _mm_unpackhi_epi8(v2, v3);
+            _mm_store_si128((__m128i*)outPtr, _mm_unpacklo_epi16(lo01, lo23));
+            _mm_store_si128((__m128i*)(outPtr + 16), _mm_unpackhi_epi16(lo01, lo23));
+            _mm_store_si128((__m128i*)(outPtr + 32), _mm_unpacklo_epi16(hi01, hi23));
+            _mm_store_si128((__m128i*)(outPtr + 48), _mm_unpackhi_epi16(hi01, hi23));
+            inPtr += 16;
+            outPtr += 64;
+        }
+
+    volk_gnsssdr_8i_unpack_2bit_8i_generic(outPtr, inPtr, num_points - sse_iters * 64);
+}
+#endif /* LV_HAVE_SSSE3 */
+
+#endif /* INCLUDED_volk_gnsssdr_8i_unpack_2bit_8i_H */
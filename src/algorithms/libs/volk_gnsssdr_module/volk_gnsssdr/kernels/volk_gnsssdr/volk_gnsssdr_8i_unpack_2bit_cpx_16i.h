@@ -0,0 +1,166 @@
+/*!
+ * \file volk_gnsssdr_8i_unpack_2bit_cpx_16i.h
+ * \brief VOLK_GNSSSDR kernel: unpacks 2-bit packed complex bytes into
+ * interleaved 16-bit samples.
+ * \authors <ul>
+ *          <li> Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *          </ul>
+ *
+ * VOLK_GNSSSDR kernel that expands bytes holding two 2-bit complex samples
+ * into sign-mapped interleaved 16-bit samples
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8i_unpack_2bit_cpx_16i
+ *
+ * \b Overview
+ *
+ * Unpacks bytes that hold two 2-bit complex samples, most significant nibble
+ * first, with each nibble packed as Q1 Q0 I1 I0 (I/Q swapped on output).
+ * Each byte b expands to the four samples I = (b >> 4) & 3, Q = (b >> 6) & 3,
+ * I = b & 3, Q = (b >> 2) & 3, every 2-bit two's complement value s mapped to
+ * (2 * s + 1), so the output alphabet is {-3, -1, 1, 3}. This is the packing
+ * used by the Two_Bit_Cpx_File_Signal_Source.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8i_unpack_2bit_cpx_16i(int16_t* outputVector, const int8_t* inputVector, unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The packed input bytes (num_points / 4 bytes are read).
+ * \li num_points: Number of output (real) samples; must be a multiple of 4.
+ *
+ * \b Outputs
+ * \li outputVector: The unpacked interleaved samples.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8i_unpack_2bit_cpx_16i_H
+#define INCLUDED_volk_gnsssdr_8i_unpack_2bit_cpx_16i_H
+
+#include <stdint.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8i_unpack_2bit_cpx_16i_generic(int16_t* outputVector, const int8_t* inputVector, unsigned int num_points)
+{
+    /* (2 * s + 1) for the four 2-bit two's complement values */
+    const int16_t map[4] = {1, 3, -3, -1};
+    const unsigned int num_bytes = num_points / 4;
+    unsigned int i;
+    int8_t byte;
+    int16_t* outPtr = outputVector;
+    for (i = 0; i < num_bytes; i++)
+        {
+            byte = inputVector[i];
+            *outPtr++ = map[(byte >> 4) & 3];
+            *outPtr++ = map[(byte >> 6) & 3];
+            *outPtr++ = map[byte & 3];
+            *outPtr++ = map[(byte >> 2) & 3];
+        }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8i_unpack_2bit_cpx_16i_u_ssse3(int16_t* outputVector, const int8_t* inputVector, unsigned int num_points)
+{
+    const unsigned int sse_iters = (num_points / 4) / 16;
+    const __m128i lut = _mm_setr_epi8(1, 3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask = _mm_set1_epi8(3);
+    const __m128i zero = _mm_setzero_si128();
+    const int8_t* inPtr = inputVector;
+    int16_t* outPtr = outputVector;
+    unsigned int number;
+    unsigned int part;
+    __m128i interleaved[4];
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            const __m128i packed = _mm_loadu_si128((const __m128i*)inPtr);
+            /* one byte vector per 2-bit field, mapped through the table */
+            const __m128i v0 = _mm_shuffle_epi8(lut, _mm_and_si128(packed, mask));
+            const __m128i v1 = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(packed, 2), mask));
+            const __m128i v2 = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(packed, 4), mask));
+            const __m128i v3 = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(packed, 6), mask));
+            /* interleave back to v2[i], v3[i], v0[i], v1[i] per input byte */
+            const __m128i lo23 = _mm_unpacklo_epi8(v2, v3);
+            const __m128i lo01 = _mm_unpacklo_epi8(v0, v1);
+            const __m128i hi23 = _mm_unpackhi_epi8(v2, v3);
+            const __m128i hi01 = _mm_unpackhi_epi8(v0, v1);
+            interleaved[0] = _mm_unpacklo_epi16(lo23, lo01);
+            interleaved[1] = _mm_unpackhi_epi16(lo23, lo01);
+            interleaved[2] = _mm_unpacklo_epi16(hi23, hi01);
+            interleaved[3] = _mm_unpackhi_epi16(hi23, hi01);
+            /* sign-extend the 8-bit results to 16 bits */
+            for (part = 0; part < 4; part++)
+                {
+                    _mm_storeu_si128((__m128i*)outPtr, _mm_srai_epi16(_mm_unpacklo_epi8(zero, interleaved[part]), 8));
+                    _mm_storeu_si128((__m128i*)(outPtr + 8), _mm_srai_epi16(_mm_unpackhi_epi8(zero, interleaved[part]), 8));
+                    outPtr += 16;
+                }
+            inPtr += 16;
+        }
+
+    volk_gnsssdr_8i_unpack_2bit_cpx_16i_generic(outPtr, inPtr, num_points - sse_iters * 64);
+}
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8i_unpack_2bit_cpx_16i_a_ssse3(int16_t* outputVector, const int8_t* inputVector, unsigned int num_points)
+{
+    const unsigned int sse_iters = (num_points / 4) / 16;
+    const __m128i lut = _mm_setr_epi8(1, 3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask = _mm_set1_epi8(3);
+    const __m128i zero = _mm_setzero_si128();
+    const int8_t* inPtr = inputVector;
+    int16_t* outPtr = outputVector;
+    unsigned int number;
+    unsigned int part;
+    __m128i interleaved[4];
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            const __m128i packed = _mm_load_si128((const __m128i*)inPtr);
+            const __m128i v0 = _mm_shuffle_epi8(lut, _mm_and_si128(packed, mask));
+            const __m128i v1 = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(packed, 2), mask));
+            const __m128i v2 = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(packed, 4), mask));
+            const __m128i v3 = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(packed, 6), mask));
+            const __m128i lo23 = _mm_unpacklo_epi8(v2, v3);
+            const __m128i lo01 = _mm_unpacklo_epi8(v0, v1);
+            const __m128i hi23 = _mm_unpackhi_epi8(v2, v3);
+            const __m128i hi01 = _mm_unpackhi_epi8(v0, v1);
+            interleaved[0] = _mm_unpacklo_epi16(lo23, lo01);
+            interleaved[1] = _mm_unpackhi_epi16(lo23, lo01);
+            interleaved[2] = _mm_unpacklo_epi16(hi23, hi01);
+            interleaved[3] = _mm_unpackhi_epi16(hi23, hi01);
+            for (part = 0; part < 4; part++)
+                {
+                    _mm_store_si128((__m128i*)outPtr, _mm_srai_epi16(_mm_unpacklo_epi8(zero, interleaved[part]), 8));
+                    _mm_store_si128((__m128i*)(outPtr + 8), _mm_srai_epi16(_mm_unpackhi_epi8(zero, interleaved[part]), 8));
+                    outPtr += 16;
+                }
+            inPtr += 16;
+        }
+
+    volk_gnsssdr_8i_unpack_2bit_cpx_16i_generic(outPtr, inPtr, num_points - sse_iters * 64);
+}
+#endif /* LV_HAVE_SSSE3 */
+
+#endif /* INCLUDED_volk_gnsssdr_8i_unpack_2bit_cpx_16i_H */
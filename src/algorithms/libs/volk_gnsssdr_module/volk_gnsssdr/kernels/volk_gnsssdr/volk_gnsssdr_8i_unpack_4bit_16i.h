@@ -0,0 +1,138 @@
+/*!
+ * \file volk_gnsssdr_8i_unpack_4bit_16i.h
+ * \brief VOLK_GNSSSDR kernel: unpacks 4-bit packed bytes into 16-bit samples.
+ * \authors <ul>
+ *          <li> Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *          </ul>
+ *
+ * VOLK_GNSSSDR kernel that expands bytes holding two 4-bit samples into
+ * sign-mapped 16-bit samples
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8i_unpack_4bit_16i
+ *
+ * \b Overview
+ *
+ * Unpacks bytes that hold two 4-bit two's complement samples, least
+ * significant nibble first, and maps each sample s to (2 * s + 1), so the
+ * output alphabet is the odd values in [-15, 15]. This is the packing used
+ * by the Four_Bit_Cpx_File_Signal_Source.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8i_unpack_4bit_16i(int16_t* outputVector, const int8_t* inputVector, unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The packed input bytes (num_points / 2 bytes are read).
+ * \li num_points: Number of output samples; must be a multiple of 2.
+ *
+ * \b Outputs
+ * \li outputVector: The unpacked samples.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8i_unpack_4bit_16i_H
+#define INCLUDED_volk_gnsssdr_8i_unpack_4bit_16i_H
+
+#include <stdint.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8i_unpack_4bit_16i_generic(int16_t* outputVector, const int8_t* inputVector, unsigned int num_points)
+{
+    /* (2 * s + 1) for the sixteen 4-bit two's complement values */
+    const int16_t map[16] = {1, 3, 5, 7, 9, 11, 13, 15, -15, -13, -11, -9, -7, -5, -3, -1};
+    const unsigned int num_bytes = num_points / 2;
+    unsigned int i;
+    int8_t byte;
+    int16_t* outPtr = outputVector;
+    for (i = 0; i < num_bytes; i++)
+        {
+            byte = inputVector[i];
+            *outPtr++ = map[byte & 0x0F];
+            *outPtr++ = map[(byte >> 4) & 0x0F];
+        }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8i_unpack_4bit_16i_u_ssse3(int16_t* outputVector, const int8_t* inputVector, unsigned int num_points)
+{
+    const unsigned int sse_iters = (num_points / 2) / 16;
+    const __m128i lut = _mm_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, -15, -13, -11, -9, -7, -5, -3, -1);
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i zero = _mm_setzero_si128();
+    const int8_t* inPtr = inputVector;
+    int16_t* outPtr = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            const __m128i packed = _mm_loadu_si128((const __m128i*)inPtr);
+            /* map both nibbles through the table and restore their order */
+            const __m128i vlo = _mm_shuffle_epi8(lut, _mm_and_si128(packed, mask));
+            const __m128i vhi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(packed, 4), mask));
+            const __m128i lo = _mm_unpacklo_epi8(vlo, vhi);
+            const __m128i hi = _mm_unpackhi_epi8(vlo, vhi);
+            /* sign-extend the 8-bit results to 16 bits */
+            _mm_storeu_si128((__m128i*)outPtr, _mm_srai_epi16(_mm_unpacklo_epi8(zero, lo), 8));
+            _mm_storeu_si128((__m128i*)(outPtr + 8), _mm_srai_epi16(_mm_unpackhi_epi8(zero, lo), 8));
+            _mm_storeu_si128((__m128i*)(outPtr + 16), _mm_srai_epi16(_mm_unpacklo_epi8(zero, hi), 8));
+            _mm_storeu_si128((__m128i*)(outPtr + 24), _mm_srai_epi16(_mm_unpackhi_epi8(zero, hi), 8));
+            inPtr += 16;
+            outPtr += 32;
+        }
+
+    volk_gnsssdr_8i_unpack_4bit_16i_generic(outPtr, inPtr, num_points - sse_iters * 32);
+}
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8i_unpack_4bit_16i_a_ssse3(int16_t* outputVector, const int8_t* inputVector, unsigned int num_points)
+{
+    const unsigned int sse_iters = (num_points / 2) / 16;
+    const __m128i lut = _mm_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, -15, -13, -11, -9, -7, -5, -3, -1);
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i zero = _mm_setzero_si128();
+    const int8_t* inPtr = inputVector;
+    int16_t* outPtr = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            const __m128i packed = _mm_load_si128((const __m128i*)inPtr);
+            const __m128i vlo = _mm_shuffle_epi8(lut, _mm_and_si128(packed, mask));
+            const __m128i vhi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(packed, 4), mask));
+            const __m128i lo = _mm_unpacklo_epi8(vlo, vhi);
+            const __m128i hi = _mm_unpackhi_epi8(vlo, vhi);
+            _mm_store_si128((__m128i*)outPtr, _mm_srai_epi16(_mm_unpacklo_epi8(zero, lo), 8));
+            _mm_store_si128((__m128i*)(outPtr + 8), _mm_srai_epi16(_mm_unpackhi_epi8(zero, lo), 8));
+            _mm_store_si128((__m128i*)(outPtr + 16), _mm_srai_epi16(_mm_unpacklo_epi8(zero, hi), 8));
+            _mm_store_si128((__m128i*)(outPtr + 24), _mm_srai_epi16(_mm_unpackhi_epi8(zero, hi), 8));
+            inPtr += 16;
+            outPtr += 32;
+        }
+
+    volk_gnsssdr_8i_unpack_4bit_16i_generic(outPtr, inPtr, num_points - sse_iters * 32);
+}
+#endif /* LV_HAVE_SSSE3 */
+
+#endif /* INCLUDED_volk_gnsssdr_8i_unpack_4bit_16i_H */
@@ -0,0 +1,195 @@
+/*!
+ * \file volk_gnsssdr_8ic_s32f_deinterleave_32f_x2.h
+ * \brief VOLK_GNSSSDR kernel: deinterleaves a complex 8-bit integer vector into two scaled float vectors.
+ * \authors <ul>
+ *          <li> Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *          </ul>
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8ic_s32f_deinterleave_32f_x2
+ *
+ * \b Overview
+ *
+ * Deinterleaves a complex vector of 8-bit integer components into
+ * two vectors of 32-bit floats (I & Q), dividing each component by
+ * a scalar normalization factor.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8ic_s32f_deinterleave_32f_x2(float* iBuffer, float* qBuffer, const lv_8sc_t* complexVector, const float scalar, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li complexVector: The complex 8-bit integer input data buffer.
+ * \li scalar:        The value to be divided against each sample.
+ * \li num_points:    The number of complex data values to be deinterleaved.
+ *
+ * \b Outputs
+ * \li iBuffer:       The I buffer output data.
+ * \li qBuffer:       The Q buffer output data.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8ic_s32f_deinterleave_32f_x2_H
+#define INCLUDED_volk_gnsssdr_8ic_s32f_deinterleave_32f_x2_H
+
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8ic_s32f_deinterleave_32f_x2_generic(float* iBuffer, float* qBuffer, const lv_8sc_t* complexVector, const float scalar, unsigned int num_points)
+{
+    const int8_t* complexVectorPtr = (const int8_t*)complexVector;
+    float* iBufferPtr = iBuffer;
+    float* qBufferPtr = qBuffer;
+    const float invScalar = 1.0f / scalar;
+    unsigned int number;
+    for (number = 0; number < num_points; number++)
+        {
+            *iBufferPtr++ = (float)(*complexVectorPtr++) * invScalar;
+            *qBufferPtr++ = (float)(*complexVectorPtr++) * invScalar;
+        }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+
+static inline void volk_gnsssdr_8ic_s32f_deinterleave_32f_x2_a_sse4_1(float* iBuffer, float* qBuffer, const lv_8sc_t* complexVector, const float scalar, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 8;
+    unsigned int number;
+    const int8_t* complexVectorPtr = (const int8_t*)complexVector;
+    float* iBufferPtr = iBuffer;
+    float* qBufferPtr = qBuffer;
+    const float invScalar = 1.0f / scalar;
+    const __m128 invScalarVal = _mm_set_ps1(invScalar);
+    const __m128i iMoveMask = _mm_set_epi8(0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 14, 12, 10, 8, 6, 4, 2, 0);
+    const __m128i qMoveMask = _mm_set_epi8(0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 15, 13, 11, 9, 7, 5, 3, 1);
+    __m128i complexVal, iComplexVal, qComplexVal;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            complexVal = _mm_load_si128((const __m128i*)complexVectorPtr);  // 8 complex samples
+            complexVectorPtr += 16;
+
+            iComplexVal = _mm_shuffle_epi8(complexVal, iMoveMask);
+            qComplexVal = _mm_shuffle_epi8(complexVal, qMoveMask);
+
+            _mm_store_ps(iBufferPtr, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(iComplexVal)), invScalarVal));
+            iBufferPtr += 4;
+            _mm_store_ps(iBufferPtr, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(iComplexVal, 4))), invScalarVal));
+            iBufferPtr += 4;
+
+            _mm_store_ps(qBufferPtr, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(qComplexVal)), invScalarVal));
+            qBufferPtr += 4;
+            _mm_store_ps(qBufferPtr, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(qComplexVal, 4))), invScalarVal));
+            qBufferPtr += 4;
+        }
+    for (number = sse_iters * 8; number < num_points; number++)
+        {
+            *iBufferPtr++ = (float)(*complexVectorPtr++) * invScalar;
+            *qBufferPtr++ = (float)(*complexVectorPtr++) * invScalar;
+        }
+}
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+
+static inline void volk_gnsssdr_8ic_s32f_deinterleave_32f_x2_u_sse4_1(float* iBuffer, float* qBuffer, const lv_8sc_t* complexVector, const float scalar, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 8;
+    unsigned int number;
+    const int8_t* complexVectorPtr = (const int8_t*)complexVector;
+    float* iBufferPtr = iBuffer;
+    float* qBufferPtr = qBuffer;
+    const float invScalar = 1.0f / scalar;
+    const __m128 invScalarVal = _mm_set_ps1(invScalar);
+    const __m128i iMoveMask = _mm_set_epi8(0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 14, 12, 10, 8, 6, 4, 2, 0);
+    const __m128i qMoveMask = _mm_set_epi8(0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 15, 13, 11, 9, 7, 5, 3, 1);
+    __m128i complexVal, iComplexVal, qComplexVal;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            complexVal = _mm_loadu_si128((const __m128i*)complexVectorPtr);  // 8 complex samples
+            complexVectorPtr += 16;
+
+            iComplexVal = _mm_shuffle_epi8(complexVal, iMoveMask);
+            qComplexVal = _mm_shuffle_epi8(complexVal, qMoveMask);
+
+            _mm_storeu_ps(iBufferPtr, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(iComplexVal)), invScalarVal));
+            iBufferPtr += 4;
+            _mm_storeu_ps(iBufferPtr, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(iComplexVal, 4))), invScalarVal));
+            iBufferPtr += 4;
+
+            _mm_storeu_ps(qBufferPtr, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(qComplexVal)), invScalarVal));
+            qBufferPtr += 4;
+            _mm_storeu_ps(qBufferPtr, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(qComplexVal, 4))), invScalarVal));
+            qBufferPtr += 4;
+        }
+    for (number = sse_iters * 8; number < num_points; number++)
+        {
+            *iBufferPtr++ = (float)(*complexVectorPtr++) * invScalar;
+            *qBufferPtr++ = (float)(*complexVectorPtr++) * invScalar;
+        }
+}
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8ic_s32f_deinterleave_32f_x2_neon(float* iBuffer, float* qBuffer, const lv_8sc_t* complexVector, const float scalar, unsigned int num_points)
+{
+    const unsigned int neon_iters = num_points / 8;
+    unsigned int number;
+    const int8_t* complexVectorPtr = (const int8_t*)complexVector;
+    float* iBufferPtr = iBuffer;
+    float* qBufferPtr = qBuffer;
+    const float invScalar = 1.0f / scalar;
+    const float32x4_t invScalarVal = vdupq_n_f32(invScalar);
+    int8x8x2_t c8;
+    int16x8_t i16, q16;
+
+    for (number = 0; number < neon_iters; number++)
+        {
+            c8 = vld2_s8(complexVectorPtr);  // deinterleaves 8 complex samples
+            complexVectorPtr += 16;
+            __VOLK_GNSSSDR_PREFETCH(complexVectorPtr + 16);
+
+            i16 = vmovl_s8(c8.val[0]);
+            q16 = vmovl_s8(c8.val[1]);
+
+            vst1q_f32(iBufferPtr, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(i16))), invScalarVal));
+            iBufferPtr += 4;
+            vst1q_f32(iBufferPtr, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(i16))), invScalarVal));
+            iBufferPtr += 4;
+
+            vst1q_f32(qBufferPtr, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(q16))), invScalarVal));
+            qBufferPtr += 4;
+            vst1q_f32(qBufferPtr, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(q16))), invScalarVal));
+            qBufferPtr += 4;
+        }
+    for (number = neon_iters * 8; number < num_points; number++)
+        {
+            *iBufferPtr++ = (float)(*complexVectorPtr++) * invScalar;
+            *qBufferPtr++ = (float)(*complexVectorPtr++) * invScalar;
+        }
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8ic_s32f_deinterleave_32f_x2_H */
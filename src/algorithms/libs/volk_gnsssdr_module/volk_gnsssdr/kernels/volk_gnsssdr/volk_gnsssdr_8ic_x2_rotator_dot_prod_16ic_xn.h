@@ -0,0 +1,316 @@
+/*!
+ * \file volk_gnsssdr_8ic_x2_rotator_dot_prod_16ic_xn.h
+ * \brief VOLK_GNSSSDR kernel: multiplies N 8-bit complex vectors by a common
+ * 8-bit complex vector, phase rotated, and accumulates the results in N
+ * 16-bit complex outputs through widening 32-bit accumulators.
+ *
+ * VOLK_GNSSSDR kernel that multiplies N 8 bits complex vectors by a common
+ * 8 bits complex vector, which is phase-rotated by phase offset and phase
+ * increment, and accumulates the results in N 16 bits complex outputs.
+ * The products are widened to 32 bits before accumulation, so no
+ * intermediate saturation occurs; the final sums are saturated to the
+ * 16-bit output range. It allows working directly on 8-bit IF sample
+ * streams without up-converting to 16ic or float, quadrupling the samples
+ * per register with respect to the float correlator.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8ic_x2_rotator_dot_prod_16ic_xn
+ *
+ * \b Overview
+ *
+ * Rotates and multiplies the reference complex vector with an arbitrary number of other complex vectors,
+ * accumulates the results and stores them in the output vector.
+ * The rotation is done at a fixed rate per sample, from an initial \p phase offset.
+ * This function can be used for Doppler wipe-off and multiple correlator on 8-bit sample streams.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8ic_x2_rotator_dot_prod_16ic_xn(lv_16sc_t* result, const lv_8sc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_8sc_t** in_a, int num_a_vectors, unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li in_common:     Pointer to one of the vectors to be rotated, multiplied and accumulated (reference vector).
+ * \li phase_inc:     Phase increment = lv_cmake(cos(phase_step_rad), sin(phase_step_rad))
+ * \li phase:         Initial phase = lv_cmake(cos(initial_phase_rad), sin(initial_phase_rad))
+ * \li in_a:          Pointer to an array of pointers to multiple vectors to be multiplied and accumulated.
+ * \li num_a_vectors: Number of vectors to be multiplied by the reference vector and accumulated.
+ * \li num_points:    Number of complex values to be multiplied together, accumulated and stored into \p result.
+ *
+ * \b Outputs
+ * \li phase:         Final phase.
+ * \li result:        Vector of \p num_a_vectors components with the multiple vectors of \p in_a rotated, multiplied by \p in_common and accumulated.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8ic_x2_rotator_dot_prod_16ic_xn_H
+#define INCLUDED_volk_gnsssdr_8ic_x2_rotator_dot_prod_16ic_xn_H
+
+
+#include <volk_gnsssdr/saturation_arithmetic.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+#include <volk_gnsssdr/volk_gnsssdr_malloc.h>
+#include <math.h>
+#include <stdint.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8ic_x2_rotator_dot_prod_16ic_xn_generic(lv_16sc_t* result, const lv_8sc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_8sc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    lv_8sc_t tmp8;
+    lv_32fc_t tmp32;
+    lv_16sc_t tmp16;
+    int n_vec;
+    unsigned int n;
+    int32_t s_re;
+    int32_t s_im;
+    int32_t* acc_re = (int32_t*)volk_gnsssdr_malloc(num_a_vectors * sizeof(int32_t), volk_gnsssdr_get_alignment());
+    int32_t* acc_im = (int32_t*)volk_gnsssdr_malloc(num_a_vectors * sizeof(int32_t), volk_gnsssdr_get_alignment());
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            acc_re[n_vec] = 0;
+            acc_im[n_vec] = 0;
+        }
+    for (n = 0; n < num_points; n++)
+        {
+            tmp8 = *in_common++;
+            tmp32 = lv_cmake((float)lv_creal(tmp8), (float)lv_cimag(tmp8)) * (*phase);
+            tmp16 = lv_cmake((int16_t)rintf(lv_creal(tmp32)), (int16_t)rintf(lv_cimag(tmp32)));
+
+            // Regenerate phase
+            if (n % 256 == 0)
+                {
+#ifdef __cplusplus
+                    (*phase) /= std::abs((*phase));
+#else
+                    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+#endif
+                }
+
+            (*phase) *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    const lv_8sc_t tmp = in_a[n_vec][n];
+                    // widening accumulation: the 16-bit x 8-bit products cannot
+                    // overflow the 32-bit accumulators over any realistic
+                    // integration length
+                    acc_re[n_vec] += (int32_t)lv_creal(tmp16) * (int32_t)lv_creal(tmp) - (int32_t)lv_cimag(tmp16) * (int32_t)lv_cimag(tmp);
+                    acc_im[n_vec] += (int32_t)lv_creal(tmp16) * (int32_t)lv_cimag(tmp) + (int32_t)lv_cimag(tmp16) * (int32_t)lv_creal(tmp);
+                }
+        }
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            // saturate the final sums to the 16-bit output range
+            s_re = acc_re[n_vec];
+            s_im = acc_im[n_vec];
+            if (s_re > INT16_MAX) s_re = INT16_MAX;
+            if (s_re < INT16_MIN) s_re = INT16_MIN;
+            if (s_im > INT16_MAX) s_im = INT16_MAX;
+            if (s_im < INT16_MIN) s_im = INT16_MIN;
+            result[n_vec] = lv_cmake((int16_t)s_re, (int16_t)s_im);
+        }
+    volk_gnsssdr_free(acc_re);
+    volk_gnsssdr_free(acc_im);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+
+static inline void volk_gnsssdr_8ic_x2_rotator_dot_prod_16ic_xn_a_sse4_1(lv_16sc_t* result, const lv_8sc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_8sc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 4;
+    int n_vec;
+    int i;
+    unsigned int number;
+    unsigned int n;
+    const lv_8sc_t** _in_a = in_a;
+    const lv_8sc_t* _in_common = in_common;
+    lv_16sc_t* _out = result;
+    lv_8sc_t tmp8;
+    lv_32fc_t tmp32;
+    lv_16sc_t tmp16;
+    int32_t s_re;
+    int32_t s_im;
+
+    __VOLK_ATTR_ALIGNED(16)
+    int32_t sumVector[4];
+
+    __m128i* realcacc = (__m128i*)volk_gnsssdr_malloc(num_a_vectors * sizeof(__m128i), volk_gnsssdr_get_alignment());
+    __m128i* imagcacc = (__m128i*)volk_gnsssdr_malloc(num_a_vectors * sizeof(__m128i), volk_gnsssdr_get_alignment());
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            realcacc[n_vec] = _mm_setzero_si128();
+            imagcacc[n_vec] = _mm_setzero_si128();
+        }
+
+    __m128i a16, b, y, y_conj, y_swap;
+    // negates the imaginary lanes: y_conj = c0, -d0, c1, -d1, ...
+    const __m128i conj_mask = _mm_set_epi16(-1, 1, -1, 1, -1, 1, -1, 1);
+
+    // phase rotation registers
+    __m128 pa, pb, two_phase_acc_reg, two_phase_inc_reg;
+    __m128i pc1, pc2;
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t two_phase_inc[2];
+    two_phase_inc[0] = phase_inc * phase_inc;
+    two_phase_inc[1] = phase_inc * phase_inc;
+    two_phase_inc_reg = _mm_load_ps((float*)two_phase_inc);
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t two_phase_acc[2];
+    two_phase_acc[0] = (*phase);
+    two_phase_acc[1] = (*phase) * phase_inc;
+    two_phase_acc_reg = _mm_load_ps((float*)two_phase_acc);
+    __m128 yl, yh, tmp1, tmp2, tmp3;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            // load (1 byte imag, 1 byte real) x 4 and widen to 16-bit lanes
+            a16 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*)_in_common));
+            __VOLK_GNSSSDR_PREFETCH(_in_common + 16);
+
+            // Phase rotation on operand in_common starts here:
+            pa = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(a16));  // first two complex samples as floats
+            // complex 32fc multiplication b=a*two_phase_acc_reg
+            yl = _mm_moveldup_ps(two_phase_acc_reg);  // Load yl with cr,cr,dr,dr
+            yh = _mm_movehdup_ps(two_phase_acc_reg);  // Load yh with ci,ci,di,di
+            tmp1 = _mm_mul_ps(pa, yl);                // tmp1 = ar*cr,ai*cr,br*dr,bi*dr
+            pa = _mm_shuffle_ps(pa, pa, 0xB1);        // Re-arrange x to be ai,ar,bi,br
+            tmp2 = _mm_mul_ps(pa, yh);                // tmp2 = ai*ci,ar*ci,bi*di,br*di
+            pb = _mm_addsub_ps(tmp1, tmp2);           // ar*cr-ai*ci, ai*cr+ar*ci, br*dr-bi*di, bi*dr+br*di
+            pc1 = _mm_cvtps_epi32(pb);                // convert from 32fc to 32ic
+
+            // complex 32fc multiplication two_phase_acc_reg=two_phase_acc_reg*two_phase_inc_reg
+            yl = _mm_moveldup_ps(two_phase_acc_reg);                            // Load yl with cr,cr,dr,dr
+            yh = _mm_movehdup_ps(two_phase_acc_reg);                            // Load yh with ci,ci,di,di
+            tmp1 = _mm_mul_ps(two_phase_inc_reg, yl);                           // tmp1 = ar*cr,ai*cr,br*dr,bi*dr
+            tmp3 = _mm_shuffle_ps(two_phase_inc_reg, two_phase_inc_reg, 0xB1);  // Re-arrange x to be ai,ar,bi,br
+            tmp2 = _mm_mul_ps(tmp3, yh);                                        // tmp2 = ai*ci,ar*ci,bi*di,br*di
+            two_phase_acc_reg = _mm_addsub_ps(tmp1, tmp2);                      // ar*cr-ai*ci, ai*cr+ar*ci, br*dr-bi*di, bi*dr+br*di
+
+            // next two samples
+            pa = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(a16, 8)));
+            // complex 32fc multiplication b=a*two_phase_acc_reg
+            yl = _mm_moveldup_ps(two_phase_acc_reg);  // Load yl with cr,cr,dr,dr
+            yh = _mm_movehdup_ps(two_phase_acc_reg);  // Load yh with ci,ci,di,di
+            tmp1 = _mm_mul_ps(pa, yl);                // tmp1 = ar*cr,ai*cr,br*dr,bi*dr
+            pa = _mm_shuffle_ps(pa, pa, 0xB1);        // Re-arrange x to be ai,ar,bi,br
+            tmp2 = _mm_mul_ps(pa, yh);                // tmp2 = ai*ci,ar*ci,bi*di,br*di
+            pb = _mm_addsub_ps(tmp1, tmp2);           // ar*cr-ai*ci, ai*cr+ar*ci, br*dr-bi*di, bi*dr+br*di
+            pc2 = _mm_cvtps_epi32(pb);                // convert from 32fc to 32ic
+
+            // complex 32fc multiplication two_phase_acc_reg=two_phase_acc_reg*two_phase_inc_reg
+            yl = _mm_moveldup_ps(two_phase_acc_reg);                            // Load yl with cr,cr,dr,dr
+            yh = _mm_movehdup_ps(two_phase_acc_reg);                            // Load yh with ci,ci,di,di
+            tmp1 = _mm_mul_ps(two_phase_inc_reg, yl);                           // tmp1 = ar*cr,ai*cr,br*dr,bi*dr
+            tmp3 = _mm_shuffle_ps(two_phase_inc_reg, two_phase_inc_reg, 0xB1);  // Re-arrange x to be ai,ar,bi,br
+            tmp2 = _mm_mul_ps(tmp3, yh);                                        // tmp2 = ai*ci,ar*ci,bi*di,br*di
+            two_phase_acc_reg = _mm_addsub_ps(tmp1, tmp2);                      // ar*cr-ai*ci, ai*cr+ar*ci, br*dr-bi*di, bi*dr+br*di
+
+            // store four rotated in_common samples in the register b
+            b = _mm_packs_epi32(pc1, pc2);  // convert from 32ic to 16ic
+
+            _in_common += 4;
+
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    // load (1 byte imag, 1 byte real) x 4 and widen to 16-bit lanes
+                    y = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*)&(_in_a[n_vec][number * 4])));
+
+                    y_conj = _mm_sign_epi16(y, conj_mask);                                                // c0, -d0, c1, -d1, ...
+                    y_swap = _mm_shufflehi_epi16(_mm_shufflelo_epi16(y, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));  // d0, c0, d1, c1, ...
+
+                    // madd pairs the lanes: one 32-bit complex product component per complex sample
+                    realcacc[n_vec] = _mm_add_epi32(realcacc[n_vec], _mm_madd_epi16(b, y_conj));  // a*c - b*d
+                    imagcacc[n_vec] = _mm_add_epi32(imagcacc[n_vec], _mm_madd_epi16(b, y_swap));  // a*d + b*c
+                }
+            // Regenerate phase
+            if ((number % 128) == 0)
+                {
+                    tmp1 = _mm_mul_ps(two_phase_acc_reg, two_phase_acc_reg);
+                    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+                    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+                    tmp2 = _mm_sqrt_ps(tmp1);
+                    two_phase_acc_reg = _mm_div_ps(two_phase_acc_reg, tmp2);
+                }
+        }
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            s_re = 0;
+            s_im = 0;
+            _mm_store_si128((__m128i*)sumVector, realcacc[n_vec]);
+            for (i = 0; i < 4; ++i)
+                {
+                    s_re += sumVector[i];
+                }
+            _mm_store_si128((__m128i*)sumVector, imagcacc[n_vec]);
+            for (i = 0; i < 4; ++i)
+                {
+                    s_im += sumVector[i];
+                }
+            // saturate the final sums to the 16-bit output range
+            if (s_re > INT16_MAX) s_re = INT16_MAX;
+            if (s_re < INT16_MIN) s_re = INT16_MIN;
+            if (s_im > INT16_MAX) s_im = INT16_MAX;
+            if (s_im < INT16_MIN) s_im = INT16_MIN;
+            _out[n_vec] = lv_cmake((int16_t)s_re, (int16_t)s_im);
+        }
+    volk_gnsssdr_free(realcacc);
+    volk_gnsssdr_free(imagcacc);
+
+    tmp1 = _mm_mul_ps(two_phase_acc_reg, two_phase_acc_reg);
+    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+    tmp2 = _mm_sqrt_ps(tmp1);
+    two_phase_acc_reg = _mm_div_ps(two_phase_acc_reg, tmp2);
+
+    _mm_store_ps((float*)two_phase_acc, two_phase_acc_reg);
+    (*phase) = two_phase_acc[0];
+
+    for (n = sse_iters * 4; n < num_points; n++)
+        {
+            tmp8 = in_common[n];
+            tmp32 = lv_cmake((float)lv_creal(tmp8), (float)lv_cimag(tmp8)) * (*phase);
+            tmp16 = lv_cmake((int16_t)rintf(lv_creal(tmp32)), (int16_t)rintf(lv_cimag(tmp32)));
+            (*phase) *= phase_inc;
+
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    const lv_8sc_t tmp = in_a[n_vec][n];
+                    const int32_t p_re = (int32_t)lv_creal(tmp16) * (int32_t)lv_creal(tmp) - (int32_t)lv_cimag(tmp16) * (int32_t)lv_cimag(tmp);
+                    const int32_t p_im = (int32_t)lv_creal(tmp16) * (int32_t)lv_cimag(tmp) + (int32_t)lv_cimag(tmp16) * (int32_t)lv_creal(tmp);
+                    _out[n_vec] = lv_cmake(sat_adds16i(lv_creal(_out[n_vec]), (int16_t)p_re),
+                        sat_adds16i(lv_cimag(_out[n_vec]), (int16_t)p_im));
+                }
+        }
+}
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+
+static inline void volk_gnsssdr_8ic_x2_rotator_dot_prod_16ic_xn_u_sse4_1(lv_16sc_t* result, const lv_8sc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_8sc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    // the 64-bit loads used by the aligned version have no alignment
+    // requirement, so it is reused as is
+    volk_gnsssdr_8ic_x2_rotator_dot_prod_16ic_xn_a_sse4_1(result, in_common, phase_inc, phase, in_a, num_a_vectors, num_points);
+}
+#endif /* LV_HAVE_SSE4_1 */
+
+#endif /* INCLUDED_volk_gnsssdr_8ic_x2_rotator_dot_prod_16ic_xn_H */
@@ -0,0 +1,259 @@
+/*!
+ * \file volk_gnsssdr_s32f_sincos_32fc_xn.h
+ * \brief VOLK_GNSSSDR kernel: Computes a family of complex exponentials with
+ * evenly spaced phase increments.
+ *
+ * VOLK_GNSSSDR kernel that generates N complex carriers whose per-sample phase
+ * increments form an arithmetic progression, as needed for the Doppler wipeoff
+ * grid in acquisition.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_s32f_sincos_32fc_xn
+ *
+ * \b Overview
+ *
+ * VOLK_GNSSSDR kernel that fills \p num_out_vectors complex vectors with unit
+ * carriers starting at phase zero, where vector \p n has a per-sample phase
+ * increment of <tt>phase_inc_start + n * phase_inc_step</tt>.
+ *
+ * Instead of running a full sine/cosine evaluation per vector, the kernel
+ * evaluates sine and cosine only for the first carrier and for the
+ * inter-carrier delta <tt>exp(j * phase_inc_step * i)</tt>; every further
+ * carrier is obtained from the previous one by an element-wise complex
+ * product. This turns the N-carrier grid generation into a single sincos
+ * pass plus N-1 complex multiplications per sample.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_s32f_sincos_32fc_xn(lv_32fc_t** out, const float phase_inc_start, const float phase_inc_step, int num_out_vectors, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li phase_inc_start:  Phase increment per sample of the first carrier, in radians.
+ * \li phase_inc_step:   Phase increment difference between consecutive carriers, in radians.
+ * \li num_out_vectors:  Number of carriers to generate.
+ * \li num_points:       Number of samples per carrier.
+ *
+ * \b Outputs
+ * \li out:              Array of pointers to the output vectors, out[n][i] = exp(j * (phase_inc_start + n * phase_inc_step) * i)
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_s32f_sincos_32fc_xn_H
+#define INCLUDED_volk_gnsssdr_s32f_sincos_32fc_xn_H
+
+#include <volk_gnsssdr/volk_gnsssdr_common.h>
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+#include <volk_gnsssdr/volk_gnsssdr_malloc.h>
+#include <math.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_s32f_sincos_32fc_xn_generic(lv_32fc_t** out, const float phase_inc_start, const float phase_inc_step, int num_out_vectors, unsigned int num_points)
+{
+    lv_32fc_t* delta = (lv_32fc_t*)volk_gnsssdr_malloc(num_points * sizeof(lv_32fc_t), volk_gnsssdr_get_alignment());
+    float phase0 = 0.0f;
+    float phase_d = 0.0f;
+    int n;
+    unsigned int i;
+    if (num_out_vectors <= 0)
+        {
+            volk_gnsssdr_free(delta);
+            return;
+        }
+    // One true sincos pass for the first carrier and for the inter-carrier delta
+    for (i = 0; i < num_points; i++)
+        {
+            out[0][i] = lv_cmake((float)cosf(phase0), (float)sinf(phase0));
+            delta[i] = lv_cmake((float)cosf(phase_d), (float)sinf(phase_d));
+            phase0 += phase_inc_start;
+            phase_d += phase_inc_step;
+        }
+    // Every further carrier is the previous one rotated by the delta carrier
+    for (n = 1; n < num_out_vectors; n++)
+        {
+            for (i = 0; i < num_points; i++)
+                {
+                    out[n][i] = out[n - 1][i] * delta[i];
+                }
+        }
+    volk_gnsssdr_free(delta);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk_gnsssdr/volk_gnsssdr_avx_intrinsics.h>
+
+static inline void volk_gnsssdr_s32f_sincos_32fc_xn_u_avx(lv_32fc_t** out, const float phase_inc_start, const float phase_inc_step, int num_out_vectors, unsigned int num_points)
+{
+    const unsigned int avx_iters = num_points / 4;
+    lv_32fc_t* delta = (lv_32fc_t*)volk_gnsssdr_malloc(num_points * sizeof(lv_32fc_t), volk_gnsssdr_get_alignment());
+    float phase0 = 0.0f;
+    float phase_d = 0.0f;
+    int n;
+    unsigned int i;
+    if (num_out_vectors <= 0)
+        {
+            volk_gnsssdr_free(delta);
+            return;
+        }
+    for (i = 0; i < num_points; i++)
+        {
+            out[0][i] = lv_cmake((float)cosf(phase0), (float)sinf(phase0));
+            delta[i] = lv_cmake((float)cosf(phase_d), (float)sinf(phase_d));
+            phase0 += phase_inc_start;
+            phase_d += phase_inc_step;
+        }
+    for (n = 1; n < num_out_vectors; n++)
+        {
+            const float* prev = (const float*)out[n - 1];
+            const float* rot = (const float*)delta;
+            float* next = (float*)out[n];
+            for (i = 0; i < avx_iters; i++)
+                {
+                    __m256 a = _mm256_loadu_ps(prev);
+                    __m256 b = _mm256_loadu_ps(rot);
+                    __m256 c = _mm256_complexmul_ps(a, b);
+                    if ((n & 63) == 0)
+                        {
+                            // keep the recurrence on the unit circle
+                            c = _mm256_complexnormalise_ps(c);
+                        }
+                    _mm256_storeu_ps(next, c);
+                    prev += 8;
+                    rot += 8;
+                    next += 8;
+                }
+            for (i = avx_iters * 4; i < num_points; i++)
+                {
+                    out[n][i] = out[n - 1][i] * delta[i];
+                }
+        }
+    _mm256_zeroupper();
+    volk_gnsssdr_free(delta);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk_gnsssdr/volk_gnsssdr_avx_intrinsics.h>
+
+static inline void volk_gnsssdr_s32f_sincos_32fc_xn_a_avx(lv_32fc_t** out, const float phase_inc_start, const float phase_inc_step, int num_out_vectors, unsigned int num_points)
+{
+    const unsigned int avx_iters = num_points / 4;
+    lv_32fc_t* delta = (lv_32fc_t*)volk_gnsssdr_malloc(num_points * sizeof(lv_32fc_t), volk_gnsssdr_get_alignment());
+    float phase0 = 0.0f;
+    float phase_d = 0.0f;
+    int n;
+    unsigned int i;
+    if (num_out_vectors <= 0)
+        {
+            volk_gnsssdr_free(delta);
+            return;
+        }
+    for (i = 0; i < num_points; i++)
+        {
+            out[0][i] = lv_cmake((float)cosf(phase0), (float)sinf(phase0));
+            delta[i] = lv_cmake((float)cosf(phase_d), (float)sinf(phase_d));
+            phase0 += phase_inc_start;
+            phase_d += phase_inc_step;
+        }
+    for (n = 1; n < num_out_vectors; n++)
+        {
+            const float* prev = (const float*)out[n - 1];
+            const float* rot = (const float*)delta;
+            float* next = (float*)out[n];
+            for (i = 0; i < avx_iters; i++)
+                {
+                    __m256 a = _mm256_load_ps(prev);
+                    __m256 b = _mm256_load_ps(rot);
+                    __m256 c = _mm256_complexmul_ps(a, b);
+                    if ((n & 63) == 0)
+                        {
+                            // keep the recurrence on the unit circle
+                            c = _mm256_complexnormalise_ps(c);
+                        }
+                    _mm256_store_ps(next, c);
+                    prev += 8;
+                    rot += 8;
+                    next += 8;
+                }
+            for (i = avx_iters * 4; i < num_points; i++)
+                {
+                    out[n][i] = out[n - 1][i] * delta[i];
+                }
+        }
+    _mm256_zeroupper();
+    volk_gnsssdr_free(delta);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_s32f_sincos_32fc_xn_neon(lv_32fc_t** out, const float phase_inc_start, const float phase_inc_step, int num_out_vectors, unsigned int num_points)
+{
+    const unsigned int neon_iters = num_points / 4;
+    lv_32fc_t* delta = (lv_32fc_t*)volk_gnsssdr_malloc(num_points * sizeof(lv_32fc_t), volk_gnsssdr_get_alignment());
+    float phase0 = 0.0f;
+    float phase_d = 0.0f;
+    int n;
+    unsigned int i;
+    if (num_out_vectors <= 0)
+        {
+            volk_gnsssdr_free(delta);
+            return;
+        }
+    for (i = 0; i < num_points; i++)
+        {
+            out[0][i] = lv_cmake((float)cosf(phase0), (float)sinf(phase0));
+            delta[i] = lv_cmake((float)cosf(phase_d), (float)sinf(phase_d));
+            phase0 += phase_inc_start;
+            phase_d += phase_inc_step;
+        }
+    for (n = 1; n < num_out_vectors; n++)
+        {
+            const float* prev = (const float*)out[n - 1];
+            const float* rot = (const float*)delta;
+            float* next = (float*)out[n];
+            for (i = 0; i < neon_iters; i++)
+                {
+                    float32x4x2_t a_val = vld2q_f32(prev);
+                    float32x4x2_t b_val = vld2q_f32(rot);
+                    float32x4x2_t c_val;
+                    c_val.val[0] = vmlsq_f32(vmulq_f32(a_val.val[0], b_val.val[0]), a_val.val[1], b_val.val[1]);
+                    c_val.val[1] = vmlaq_f32(vmulq_f32(a_val.val[0], b_val.val[1]), a_val.val[1], b_val.val[0]);
+                    vst2q_f32(next, c_val);
+                    prev += 8;
+                    rot += 8;
+                    next += 8;
+                }
+            for (i = neon_iters * 4; i < num_points; i++)
+                {
+                    out[n][i] = out[n - 1][i] * delta[i];
+                }
+        }
+    volk_gnsssdr_free(delta);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_s32f_sincos_32fc_xn_H */
@@ -0,0 +1,115 @@
+/*!
+ * \file volk_gnsssdr_s32f_sincosxnpuppet_32fc.h
+ * \brief VOLK_GNSSSDR puppet for the batched sincos kernel.
+ *
+ * VOLK_GNSSSDR puppet for integrating the batched carrier generation kernel
+ * into the test system
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_s32f_sincosxnpuppet_32fc_H
+#define INCLUDED_volk_gnsssdr_s32f_sincosxnpuppet_32fc_H
+
+
+#include "volk_gnsssdr/volk_gnsssdr_s32f_sincos_32fc_xn.h"
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+#include <volk_gnsssdr/volk_gnsssdr_malloc.h>
+#include <string.h>
+
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_s32f_sincosxnpuppet_32fc_generic(lv_32fc_t* out, const float phase_inc, unsigned int num_points)
+{
+    int num_out_vectors = 3;
+    int n;
+    lv_32fc_t** carriers = (lv_32fc_t**)volk_gnsssdr_malloc(sizeof(lv_32fc_t*) * num_out_vectors, volk_gnsssdr_get_alignment());
+    for (n = 0; n < num_out_vectors; n++)
+        {
+            carriers[n] = (lv_32fc_t*)volk_gnsssdr_malloc(sizeof(lv_32fc_t) * num_points, volk_gnsssdr_get_alignment());
+        }
+    volk_gnsssdr_s32f_sincos_32fc_xn_generic(carriers, phase_inc, 0.1f, num_out_vectors, num_points);
+    memcpy((lv_32fc_t*)out, (lv_32fc_t*)carriers[num_out_vectors - 1], sizeof(lv_32fc_t) * num_points);
+    for (n = 0; n < num_out_vectors; n++)
+        {
+            volk_gnsssdr_free(carriers[n]);
+        }
+    volk_gnsssdr_free(carriers);
+}
+
+#endif /* LV_HAVE_GENERIC  */
+
+
+#ifdef LV_HAVE_AVX
+static inline void volk_gnsssdr_s32f_sincosxnpuppet_32fc_u_avx(lv_32fc_t* out, const float phase_inc, unsigned int num_points)
+{
+    int num_out_vectors = 3;
+    int n;
+    lv_32fc_t** carriers = (lv_32fc_t**)volk_gnsssdr_malloc(sizeof(lv_32fc_t*) * num_out_vectors, volk_gnsssdr_get_alignment());
+    for (n = 0; n < num_out_vectors; n++)
+        {
+            carriers[n] = (lv_32fc_t*)volk_gnsssdr_malloc(sizeof(lv_32fc_t) * num_points, volk_gnsssdr_get_alignment());
+        }
+    volk_gnsssdr_s32f_sincos_32fc_xn_u_avx(carriers, phase_inc, 0.1f, num_out_vectors, num_points);
+    memcpy((lv_32fc_t*)out, (lv_32fc_t*)carriers[num_out_vectors - 1], sizeof(lv_32fc_t) * num_points);
+    for (n = 0; n < num_out_vectors; n++)
+        {
+            volk_gnsssdr_free(carriers[n]);
+        }
+    volk_gnsssdr_free(carriers);
+}
+
+#endif /* LV_HAVE_AVX  */
+
+
+#ifdef LV_HAVE_AVX
+static inline void volk_gnsssdr_s32f_sincosxnpuppet_32fc_a_avx(lv_32fc_t* out, const float phase_inc, unsigned int num_points)
+{
+    int num_out_vectors = 3;
+    int n;
+    lv_32fc_t** carriers = (lv_32fc_t**)volk_gnsssdr_malloc(sizeof(lv_32fc_t*) * num_out_vectors, volk_gnsssdr_get_alignment());
+    for (n = 0; n < num_out_vectors; n++)
+        {
+            carriers[n] = (lv_32fc_t*)volk_gnsssdr_malloc(sizeof(lv_32fc_t) * num_points, volk_gnsssdr_get_alignment());
+        }
+    volk_gnsssdr_s32f_sincos_32fc_xn_a_avx(carriers, phase_inc, 0.1f, num_out_vectors, num_points);
+    memcpy((lv_32fc_t*)out, (lv_32fc_t*)carriers[num_out_vectors - 1], sizeof(lv_32fc_t) * num_points);
+    for (n = 0; n < num_out_vectors; n++)
+        {
+            volk_gnsssdr_free(carriers[n]);
+        }
+    volk_gnsssdr_free(carriers);
+}
+
+#endif /* LV_HAVE_AVX  */
+
+
+#ifdef LV_HAVE_NEON
+static inline void volk_gnsssdr_s32f_sincosxnpuppet_32fc_neon(lv_32fc_t* out, const float phase_inc, unsigned int num_points)
+{
+    int num_out_vectors = 3;
+    int n;
+    lv_32fc_t** carriers = (lv_32fc_t**)volk_gnsssdr_malloc(sizeof(lv_32fc_t*) * num_out_vectors, volk_gnsssdr_get_alignment());
+    for (n = 0; n < num_out_vectors; n++)
+        {
+            carriers[n] = (lv_32fc_t*)volk_gnsssdr_malloc(sizeof(lv_32fc_t) * num_points, volk_gnsssdr_get_alignment());
+        }
+    volk_gnsssdr_s32f_sincos_32fc_xn_neon(carriers, phase_inc, 0.1f, num_out_vectors, num_points);
+    memcpy((lv_32fc_t*)out, (lv_32fc_t*)carriers[num_out_vectors - 1], sizeof(lv_32fc_t) * num_points);
+    for (n = 0; n < num_out_vectors; n++)
+        {
+            volk_gnsssdr_free(carriers[n]);
+        }
+    volk_gnsssdr_free(carriers);
+}
+#endif /* LV_HAVE_NEON  */
+
+#endif /* INCLUDED_volk_gnsssdr_s32f_sincosxnpuppet_32fc_H */
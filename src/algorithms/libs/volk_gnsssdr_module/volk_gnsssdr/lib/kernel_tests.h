@@ -57,21 +57,29 @@ std::vector<volk_gnsssdr_test_case_t> init_test_list(volk_gnsssdr_test_params_t
     QA(VOLK_INIT_TEST(volk_gnsssdr_8i_accumulator_s8i, test_params_more_iters))
     QA(VOLK_INIT_TEST(volk_gnsssdr_8i_index_max_16u, test_params_more_iters))
     QA(VOLK_INIT_TEST(volk_gnsssdr_8i_max_s8i, test_params_more_iters))
+    QA(VOLK_INIT_TEST(volk_gnsssdr_8i_unpack_2bit_8i, test_params_more_iters))
+    QA(VOLK_INIT_TEST(volk_gnsssdr_8i_unpack_2bit_cpx_16i, test_params_more_iters))
+    QA(VOLK_INIT_TEST(volk_gnsssdr_8i_unpack_4bit_16i, test_params_more_iters))
     QA(VOLK_INIT_TEST(volk_gnsssdr_8i_x2_add_8i, test_params_more_iters))
     QA(VOLK_INIT_TEST(volk_gnsssdr_8ic_conjugate_8ic, test_params_more_iters))
     QA(VOLK_INIT_TEST(volk_gnsssdr_8ic_magnitude_squared_8i, test_params_more_iters))
+    QA(VOLK_INIT_TEST(volk_gnsssdr_8ic_s32f_deinterleave_32f_x2, test_params))
     QA(VOLK_INIT_TEST(volk_gnsssdr_8ic_x2_dot_prod_8ic, test_params))
     QA(VOLK_INIT_TEST(volk_gnsssdr_8ic_x2_multiply_8ic, test_params))
     QA(VOLK_INIT_TEST(volk_gnsssdr_8u_x2_multiply_8u, test_params_more_iters))
     QA(VOLK_INIT_TEST(volk_gnsssdr_64f_accumulator_64f, test_params))
     QA(VOLK_INIT_TEST(volk_gnsssdr_32f_sincos_32fc, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_gnsssdr_32f_index_max_32u, test_params))
+    QA(VOLK_INIT_TEST(volk_gnsssdr_32f_convert_16u, test_params))
+    QA(VOLK_INIT_TEST(volk_gnsssdr_16u_convert_32f, test_params))
+    QA(VOLK_INIT_TEST(volk_gnsssdr_16u_32f_accumulate_16u, test_params))
     QA(VOLK_INIT_TEST(volk_gnsssdr_32fc_convert_8ic, test_params))
     QA(VOLK_INIT_TEST(volk_gnsssdr_32fc_convert_16ic, test_params_more_iters))
     QA(VOLK_INIT_TEST(volk_gnsssdr_16ic_x2_dot_prod_16ic, test_params))
     QA(VOLK_INIT_TEST(volk_gnsssdr_16ic_x2_multiply_16ic, test_params_more_iters))
     QA(VOLK_INIT_TEST(volk_gnsssdr_16ic_convert_32fc, test_params_more_iters))
     QA(VOLK_INIT_TEST(volk_gnsssdr_16ic_conjugate_16ic, test_params_more_iters))
+    QA(VOLK_INIT_TEST(volk_gnsssdr_16ic_s32f_deinterleave_32f_x2, test_params))
     QA(VOLK_INIT_PUPP(volk_gnsssdr_s32f_sincospuppet_32fc, volk_gnsssdr_s32f_sincos_32fc, test_params_inacc2))
     QA(VOLK_INIT_PUPP(volk_gnsssdr_16ic_rotatorpuppet_16ic, volk_gnsssdr_16ic_s32fc_x2_rotator_16ic, test_params_int1))
     QA(VOLK_INIT_PUPP(volk_gnsssdr_16ic_resamplerfastpuppet_16ic, volk_gnsssdr_16ic_resampler_fast_16ic, test_params))
@@ -87,6 +95,10 @@ std::vector<volk_gnsssdr_test_case_t> init_test_list(volk_gnsssdr_test_params_t
     QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_x2_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn, test_params_inacc))
     QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_32f_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn, test_params_inacc));
     QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_32f_high_dynamic_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn, test_params_inacc));
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn, test_params_inacc));
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_8ic_x2_rotator_dotprodxnpuppet_16ic, volk_gnsssdr_8ic_x2_rotator_dot_prod_16ic_xn, test_params_int16));
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_32f_index_max_statspuppet_32f, volk_gnsssdr_32f_index_max_stats_32u, test_params_inacc2));
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_s32f_sincosxnpuppet_32fc, volk_gnsssdr_s32f_sincos_32fc_xn, test_params_inacc2));
 
     return test_cases;
 }
@@ -28,7 +28,20 @@ void volk_gnsssdr_get_config_path(char *path, bool read)
     const char *suffix2 = "/volk_gnsssdr/volk_gnsssdr_config";  // non-hidden
     char *home = NULL;
 
-    // allows config redirection via env variable
+    // allows config redirection via env variable; the module-specific
+    // variable takes precedence so a machine-optimal table for this module
+    // does not clash with the one used by the VOLK library
+    home = getenv("VOLK_GNSSSDR_CONFIGPATH");
+    if (home != NULL)
+        {
+            strncpy(path, home, 512);
+            strcat(path, suffix2);
+            if (!read || (access(path, F_OK) != -1))
+                {
+                    return;
+                }
+        }
+
     home = getenv("VOLK_CONFIGPATH");
     if (home != NULL)
         {
@@ -110,7 +123,7 @@ size_t volk_gnsssdr_load_preferences(volk_gnsssdr_arch_pref_t **prefs_res)
                 }
             prefs = (volk_gnsssdr_arch_pref_t *)new_prefs;
             volk_gnsssdr_arch_pref_t *p = prefs + n_arch_prefs;
-            if (sscanf(line, "%s %s %s", p->name, p->impl_a, p->impl_u) == 3 && !strncmp(p->name, "volk_gnsssdr_", 5))
+            if (sscanf(line, "%s %s %s", p->name, p->impl_a, p->impl_u) == 3 && !strncmp(p->name, "volk_gnsssdr_", 13))
                 {
                     n_arch_prefs++;
                 }
@@ -37,12 +37,31 @@ HybridObservables::HybridObservables(const ConfigurationInterface* configuration
     Obs_Conf conf{};
     conf.dump = dump_;
     conf.dump_mat = dump_mat_;
+    conf.dump_columnar = configuration->property(role + ".dump_columnar", conf.dump_columnar);
     conf.dump_filename = dump_filename_;
     conf.nchannels_in = in_streams_;
     conf.nchannels_out = out_streams_;
     conf.observable_interval_ms = configuration->property("GNSS-SDR.observable_interval_ms", conf.observable_interval_ms);
+    conf.output_interval_ms = configuration->property(role + ".output_interval_ms", conf.output_interval_ms);
     conf.enable_carrier_smoothing = configuration->property(role + ".enable_carrier_smoothing", conf.enable_carrier_smoothing);
     conf.always_output_gs = configuration->property("PVT.an_output_enabled", conf.always_output_gs) || configuration->property(role + ".always_output_gs", conf.always_output_gs);
+    conf.telemetry_free = configuration->property("Channels.telemetry_free", conf.telemetry_free);
+    if (conf.telemetry_free)
+        {
+            LOG(INFO) << "Observables configured for telemetry-free channels: receiver-relative timescale, no pseudoranges";
+        }
+#if ENABLE_FPGA
+    conf.fpga_epoch_source = configuration->property("GNSS-SDR.fpga_epoch_source", conf.fpga_epoch_source);
+    if (conf.fpga_epoch_source)
+        {
+            // the sample-counter stream is not instantiated (see
+            // GNSSFlowgraph::connect_fpga_sample_counter), so its input port
+            // is dropped and the FPGA counter registers are read directly
+            conf.nchannels_in = in_streams_ - 1;
+            conf.fs = static_cast<double>(configuration->property("GNSS-SDR.internal_fs_sps", 0));
+            LOG(INFO) << "Observables epoch alignment taken directly from the FPGA sample counter";
+        }
+#endif
 
     if (FLAGS_carrier_smoothing_factor == DEFAULT_CARRIER_SMOOTHING_FACTOR)
         {
@@ -55,6 +74,16 @@ HybridObservables::HybridObservables(const ConfigurationInterface* configuration
         }
     observables_ = hybrid_observables_gs_make(conf);
     DLOG(INFO) << "Observables block ID (" << observables_->unique_id() << ")";
+
+    if (configuration->property(role + ".enable_screening", false))
+        {
+            const double threshold_sigma = configuration->property(role + ".screening_threshold_sigma", 4.0);
+            const double slip_threshold_m = configuration->property(role + ".screening_slip_threshold_m", 3.0);
+            const int min_channels = configuration->property(role + ".screening_min_channels", 5);
+            screening_ = obs_screening_gs_make(out_streams_, threshold_sigma, slip_threshold_m, static_cast<uint32_t>(min_channels));
+            LOG(INFO) << "Observables screening enabled: threshold " << threshold_sigma
+                      << " sigma, cycle-slip threshold " << slip_threshold_m << " m";
+        }
 }
 
 
@@ -63,6 +92,15 @@ void HybridObservables::connect(gr::top_block_sptr top_block)
     if (top_block)
         { /* top_block is not null */
         };
+    if (screening_)
+        {
+            for (unsigned int i = 0; i < out_streams_; i++)
+                {
+                    top_block->connect(observables_, static_cast<int>(i), screening_, static_cast<int>(i));
+                }
+            DLOG(INFO) << "connected observables to screening block";
+            return;
+        }
     // Nothing to connect internally
     DLOG(INFO) << "nothing to connect internally";
 }
@@ -73,7 +111,14 @@ void HybridObservables::disconnect(gr::top_block_sptr top_block)
     if (top_block)
         { /* top_block is not null */
         };
-    // Nothing to disconnect
+    if (screening_)
+        {
+            for (unsigned int i = 0; i < out_streams_; i++)
+                {
+                    top_block->disconnect(observables_, static_cast<int>(i), screening_, static_cast<int>(i));
+                }
+        }
+    // Nothing else to disconnect
 }
 
 
@@ -85,5 +130,9 @@ gr::basic_block_sptr HybridObservables::get_left_block()
 
 gr::basic_block_sptr HybridObservables::get_right_block()
 {
+    if (screening_)
+        {
+            return screening_;
+        }
     return observables_;
 }
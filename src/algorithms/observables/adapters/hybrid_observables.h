@@ -22,6 +22,7 @@
 
 #include "gnss_synchro.h"
 #include "hybrid_observables_gs.h"
+#include "obs_screening_gs.h"
 #include "observables_interface.h"
 #include <gnuradio/gr_complex.h>     // for gr_complex
 #include <gnuradio/runtime_types.h>  // for basic_block_sptr, top_block_sptr
@@ -79,6 +80,7 @@ public:
 
 private:
     hybrid_observables_gs_sptr observables_;
+    obs_screening_gs_sptr screening_;  // optional multipath / outlier pre-filter
     std::string dump_filename_;
     std::string role_;
     unsigned int in_streams_;
@@ -17,21 +17,25 @@
 
 #include "hybrid_observables_gs.h"
 #include "MATH_CONSTANTS.h"  // for SPEED_OF_LIGHT_M_S, TWO_PI
-#include "gnss_circular_deque.h"
+#include "async_dump_writer.h"
+#include "columnar_dump_writer.h"
 #include "gnss_frequencies.h"
 #include "gnss_sdr_create_directory.h"
 #include "gnss_sdr_filesystem.h"
 #include "gnss_sdr_make_unique.h"
 #include "gnss_synchro.h"
+#include "gnss_synchro_soa_ring.h"
+#include "latency_tracer.h"
+#include "streaming_mat_writer.h"
 #include <glog/logging.h>
 #include <gnuradio/io_signature.h>
-#include <matio.h>
 #include <pmt/pmt.h>
 #include <algorithm>  // for std::min
 #include <array>
 #include <cmath>      // for round
 #include <cstdlib>    // for size_t, llabs
 #include <exception>  // for exception
+#include <fstream>    // for ifstream (used by save_matfile)
 #include <iostream>   // for cerr, cout
 #include <limits>     // for numeric_limits
 #include <utility>    // for move
@@ -65,9 +69,12 @@ hybrid_observables_gs::hybrid_observables_gs(const Obs_Conf &conf_)
       d_smooth_filter_M(static_cast<double>(conf_.smoothing_factor)),
       d_T_rx_step_s(static_cast<double>(conf_.observable_interval_ms) / 1000.0),
       d_last_rx_clock_round20ms_error(0.0),
+      d_clock_steering_corr_s(0.0),
       d_T_rx_TOW_ms(0U),
       d_T_rx_step_ms(conf_.observable_interval_ms),
       d_T_status_report_timer_ms(0),
+      d_T_out_decim_factor(1U),
+      d_T_out_epoch_counter(0U),
       d_nchannels_in(conf_.nchannels_in),
       d_nchannels_out(conf_.nchannels_out),
       d_T_rx_TOW_set(false),
@@ -91,7 +98,22 @@ hybrid_observables_gs::hybrid_observables_gs(const Obs_Conf &conf_)
     // Send Channel status to gnss_flowgraph
     this->message_port_register_out(pmt::mp("status"));
 
-    d_gnss_synchro_history = std::make_unique<Gnss_circular_deque<Gnss_Synchro>>(1000, d_nchannels_out);
+    d_gnss_synchro_history = std::make_unique<Gnss_synchro_soa_ring>(1000, d_nchannels_out);
+
+    // optional decimated output: the interpolation keeps running at the
+    // observable interval, only the emission towards the PVT block is decimated
+    if (conf_.output_interval_ms > d_T_rx_step_ms)
+        {
+            if (conf_.output_interval_ms % d_T_rx_step_ms != 0)
+                {
+                    std::cerr << "Configuration parameter Observables.output_interval_ms should be a multiple of GNSS-SDR.observable_interval_ms. Ignoring it.\n";
+                }
+            else
+                {
+                    d_T_out_decim_factor = conf_.output_interval_ms / d_T_rx_step_ms;
+                    LOG(INFO) << "Observables output decimated to " << conf_.output_interval_ms << " ms (interpolation at " << d_T_rx_step_ms << " ms)";
+                }
+        }
 
     d_Rx_clock_buffer.set_capacity(std::min(std::max(200U / d_T_rx_step_ms, 3U), 10U));
     d_Rx_clock_buffer.clear();
@@ -99,11 +121,29 @@ hybrid_observables_gs::hybrid_observables_gs(const Obs_Conf &conf_)
     d_channel_last_pll_lock = std::vector<bool>(d_nchannels_out, false);
     d_channel_last_pseudorange_smooth = std::vector<double>(d_nchannels_out, 0.0);
     d_channel_last_carrier_phase_rads = std::vector<double>(d_nchannels_out, 0.0);
+    d_channel_wavelength_m = std::vector<double>(d_nchannels_out, 0.0);
+    d_channel_smoothing_epochs = std::vector<uint32_t>(d_nchannels_out, 0);
+    d_channel_smoothing_last_prn = std::vector<uint32_t>(d_nchannels_out, 0);
 
     d_SourceTagTimestamps = std::vector<std::queue<GnssTime>>(d_nchannels_out);
 
     set_tag_propagation_policy(TPP_DONT);  // no tag propagation, the time tag will be adjusted and regenerated in work()
 
+#if ENABLE_FPGA
+    if (d_conf.fpga_epoch_source)
+        {
+            d_fpga_epoch_counter = std::make_unique<Fpga_Epoch_Counter>();
+            if (!d_fpga_epoch_counter->open_device())
+                {
+                    std::cerr << "GNSS-SDR cannot open the FPGA sample counter device for the Observables block\n";
+                    throw std::exception();
+                }
+            d_samples_per_epoch = static_cast<uint32_t>(std::round(d_conf.fs * static_cast<double>(d_T_rx_step_ms) / 1e3));
+            LOG(INFO) << "Observables epoch alignment taken directly from the FPGA sample counter ("
+                      << d_samples_per_epoch << " samples per epoch)";
+        }
+#endif
+
     // ############# ENABLE DATA FILE LOG #################
     if (d_dump)
         {
@@ -136,16 +176,23 @@ hybrid_observables_gs::hybrid_observables_gs(const Obs_Conf &conf_)
                     std::cerr << "GNSS-SDR cannot create dump file for the Observables block. Wrong permissions?\n";
                     d_dump = false;
                 }
-            d_dump_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
-            try
-                {
-                    d_dump_file.open(d_dump_filename.c_str(), std::ios::out | std::ios::binary);
-                    LOG(INFO) << "Observables dump enabled Log file: " << d_dump_filename.c_str();
-                }
-            catch (const std::ofstream::failure &e)
+            d_dump_stream_id = Async_Dump_Writer::get_instance().open_stream(d_dump_filename);
+            LOG(INFO) << "Observables dump enabled Log file: " << d_dump_filename.c_str();
+            if (conf_.dump_columnar)
                 {
-                    LOG(WARNING) << "Exception opening observables dump file " << e.what();
-                    d_dump = false;
+                    // columnar companion file next to the legacy .dat dump
+                    std::string columnar_filename = d_dump_filename;
+                    columnar_filename.replace(columnar_filename.find_last_of('.'), std::string::npos, ".obsc");
+                    d_columnar_dump = std::make_unique<Columnar_Dump_Writer>();
+                    if (d_columnar_dump->open(columnar_filename, 7U, d_nchannels_out))
+                        {
+                            LOG(INFO) << "Observables columnar dump enabled Log file: " << columnar_filename;
+                        }
+                    else
+                        {
+                            std::cerr << "GNSS-SDR cannot create the columnar dump file for the Observables block. Wrong permissions?\n";
+                            d_columnar_dump.reset();
+                        }
                 }
         }
 }
@@ -154,18 +201,19 @@ hybrid_observables_gs::hybrid_observables_gs(const Obs_Conf &conf_)
 hybrid_observables_gs::~hybrid_observables_gs()
 {
     DLOG(INFO) << "Observables block destructor called.";
-    if (d_dump_file.is_open())
+    if (d_columnar_dump)
         {
-            const auto pos = d_dump_file.tellp();
-            try
-                {
-                    d_dump_file.close();
-                }
-            catch (const std::exception &ex)
-                {
-                    LOG(WARNING) << "Exception in destructor closing the dump file " << ex.what();
-                }
-            if (pos == 0)
+            // flushes the pending chunk and writes the footer index
+            d_columnar_dump->close();
+            d_columnar_dump.reset();
+        }
+    if (d_dump_stream_id >= 0)
+        {
+            // blocks until the data is on disk, so save_matfile() below
+            // re-reads a complete file
+            const uint64_t bytes_written = Async_Dump_Writer::get_instance().close_stream(d_dump_stream_id);
+            d_dump_stream_id = -1;
+            if (bytes_written == 0)
                 {
                     errorlib::error_code ec;
                     if (!fs::remove(fs::path(d_dump_filename), ec))
@@ -211,8 +259,22 @@ void hybrid_observables_gs::msg_handler_pvt_to_observables(const pmt::pmt_t &msg
                             d_gnss_synchro_history->clear(n);
                         }
 
+                    // the coarse correction steps the receiver time, so the sample
+                    // clock model has to be rebuilt from scratch
+                    d_clock_steering_kf.reset();
+                    d_clock_steering_corr_s = 0.0;
+
                     LOG(INFO) << "Corrected new RX Time offset: " << static_cast<int>(round(new_rx_clock_offset_s * 1000.0)) << "[ms]";
                 }
+            if (pmt::any_ref(msg).type().hash_code() == d_pair_type_hash_code)
+                {
+                    // per-epoch clock measurement from the PVT solver: (offset [s], drift [ppm]).
+                    // The offset is measured on the already-steered observables, so the
+                    // correction in effect is added back to recover the raw clock offset
+                    const auto clock_measurement = wht::any_cast<std::pair<double, double>>(pmt::any_ref(msg));
+                    d_clock_steering_kf.update(d_clock_steering_corr_s + clock_measurement.first);
+                    d_clock_steering_kf.update_drift(clock_measurement.second * 1.0e-6);
+                }
             if (pmt::any_ref(msg).type().hash_code() == d_int_type_hash_code)
                 {
                     const auto command_from_pvt = wht::any_cast<int>(pmt::any_ref(msg));
@@ -272,31 +334,49 @@ int32_t hybrid_observables_gs::save_matfile() const
             return 1;
         }
 
-    auto RX_time = std::vector<std::vector<double>>(d_nchannels_out, std::vector<double>(num_epoch));
-    auto TOW_at_current_symbol_s = std::vector<std::vector<double>>(d_nchannels_out, std::vector<double>(num_epoch));
-    auto Carrier_Doppler_hz = std::vector<std::vector<double>>(d_nchannels_out, std::vector<double>(num_epoch));
-    auto Carrier_phase_cycles = std::vector<std::vector<double>>(d_nchannels_out, std::vector<double>(num_epoch));
-    auto Pseudorange_m = std::vector<std::vector<double>>(d_nchannels_out, std::vector<double>(num_epoch));
-    auto PRN = std::vector<std::vector<double>>(d_nchannels_out, std::vector<double>(num_epoch));
-    auto Flag_valid_pseudorange = std::vector<std::vector<double>>(d_nchannels_out, std::vector<double>(num_epoch));
+    // WRITE MAT FILE
+    std::string filename = d_dump_filename;
+    if (filename.size() > 4)
+        {
+            filename.erase(filename.end() - 4, filename.end());
+        }
+    filename.append(".mat");
+    Streaming_Mat_Writer mat_writer;
+    if (!mat_writer.open(filename))
+        {
+            std::cerr << "Problem creating .mat file " << filename << '\n';
+            return 1;
+        }
 
+    // one pass over the dump file per variable, in bounded chunks of epochs
+    const std::array<const char *, 7> var_names = {"RX_time", "TOW_at_current_symbol_s", "Carrier_Doppler_hz",
+        "Carrier_phase_cycles", "Pseudorange_m", "PRN", "Flag_valid_pseudorange"};
+    const int64_t epochs_per_chunk = 1024;
+    auto chunk = std::vector<double>(epochs_per_chunk * number_of_double_vars * d_nchannels_out);
+    auto column = std::vector<double>(epochs_per_chunk * d_nchannels_out);
     try
         {
-            if (dump_file.is_open())
+            for (int32_t var = 0; var < number_of_double_vars; var++)
                 {
-                    for (int64_t i = 0; i < num_epoch; i++)
+                    dump_file.seekg(0, std::ios::beg);
+                    mat_writer.begin_variable(var_names[var], Streaming_Mat_Writer::Mat_Type::mat_double, d_nchannels_out);
+                    int64_t epoch = 0;
+                    while (epoch < num_epoch)
                         {
-                            for (uint32_t chan = 0; chan < d_nchannels_out; chan++)
+                            const int64_t epochs_in_chunk = std::min(epochs_per_chunk, num_epoch - epoch);
+                            dump_file.read(reinterpret_cast<char *>(chunk.data()), epochs_in_chunk * epoch_size_bytes);
+                            std::size_t k = 0;
+                            for (int64_t i = 0; i < epochs_in_chunk; i++)
                                 {
-                                    dump_file.read(reinterpret_cast<char *>(&RX_time[chan][i]), sizeof(double));
-                                    dump_file.read(reinterpret_cast<char *>(&TOW_at_current_symbol_s[chan][i]), sizeof(double));
-                                    dump_file.read(reinterpret_cast<char *>(&Carrier_Doppler_hz[chan][i]), sizeof(double));
-                                    dump_file.read(reinterpret_cast<char *>(&Carrier_phase_cycles[chan][i]), sizeof(double));
-                                    dump_file.read(reinterpret_cast<char *>(&Pseudorange_m[chan][i]), sizeof(double));
-                                    dump_file.read(reinterpret_cast<char *>(&PRN[chan][i]), sizeof(double));
-                                    dump_file.read(reinterpret_cast<char *>(&Flag_valid_pseudorange[chan][i]), sizeof(double));
+                                    for (uint32_t chan = 0; chan < d_nchannels_out; chan++)
+                                        {
+                                            column[k++] = chunk[(i * d_nchannels_out + chan) * number_of_double_vars + var];
+                                        }
                                 }
+                            mat_writer.append(column.data(), k);
+                            epoch += epochs_in_chunk;
                         }
+                    mat_writer.end_variable();
                 }
             dump_file.close();
         }
@@ -305,73 +385,7 @@ int32_t hybrid_observables_gs::save_matfile() const
             std::cerr << "Problem reading dump file:" << e.what() << '\n';
             return 1;
         }
-
-    auto RX_time_aux = std::vector<double>(d_nchannels_out * num_epoch);
-    auto TOW_at_current_symbol_s_aux = std::vector<double>(d_nchannels_out * num_epoch);
-    auto Carrier_Doppler_hz_aux = std::vector<double>(d_nchannels_out * num_epoch);
-    auto Carrier_phase_cycles_aux = std::vector<double>(d_nchannels_out * num_epoch);
-    auto Pseudorange_m_aux = std::vector<double>(d_nchannels_out * num_epoch);
-    auto PRN_aux = std::vector<double>(d_nchannels_out * num_epoch);
-    auto Flag_valid_pseudorange_aux = std::vector<double>(d_nchannels_out * num_epoch);
-
-    uint32_t k = 0U;
-    for (int64_t j = 0; j < num_epoch; j++)
-        {
-            for (uint32_t i = 0; i < d_nchannels_out; i++)
-                {
-                    RX_time_aux[k] = RX_time[i][j];
-                    TOW_at_current_symbol_s_aux[k] = TOW_at_current_symbol_s[i][j];
-                    Carrier_Doppler_hz_aux[k] = Carrier_Doppler_hz[i][j];
-                    Carrier_phase_cycles_aux[k] = Carrier_phase_cycles[i][j];
-                    Pseudorange_m_aux[k] = Pseudorange_m[i][j];
-                    PRN_aux[k] = PRN[i][j];
-                    Flag_valid_pseudorange_aux[k] = Flag_valid_pseudorange[i][j];
-                    k++;
-                }
-        }
-
-    // WRITE MAT FILE
-    mat_t *matfp;
-    matvar_t *matvar;
-    std::string filename = d_dump_filename;
-    if (filename.size() > 4)
-        {
-            filename.erase(filename.end() - 4, filename.end());
-        }
-    filename.append(".mat");
-    matfp = Mat_CreateVer(filename.c_str(), nullptr, MAT_FT_MAT73);
-    if (reinterpret_cast<int64_t *>(matfp) != nullptr)
-        {
-            std::array<size_t, 2> dims{static_cast<size_t>(d_nchannels_out), static_cast<size_t>(num_epoch)};
-            matvar = Mat_VarCreate("RX_time", MAT_C_DOUBLE, MAT_T_DOUBLE, 2, dims.data(), RX_time_aux.data(), MAT_F_DONT_COPY_DATA);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("TOW_at_current_symbol_s", MAT_C_DOUBLE, MAT_T_DOUBLE, 2, dims.data(), TOW_at_current_symbol_s_aux.data(), MAT_F_DONT_COPY_DATA);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("Carrier_Doppler_hz", MAT_C_DOUBLE, MAT_T_DOUBLE, 2, dims.data(), Carrier_Doppler_hz_aux.data(), MAT_F_DONT_COPY_DATA);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("Carrier_phase_cycles", MAT_C_DOUBLE, MAT_T_DOUBLE, 2, dims.data(), Carrier_phase_cycles_aux.data(), MAT_F_DONT_COPY_DATA);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("Pseudorange_m", MAT_C_DOUBLE, MAT_T_DOUBLE, 2, dims.data(), Pseudorange_m_aux.data(), MAT_F_DONT_COPY_DATA);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("PRN", MAT_C_DOUBLE, MAT_T_DOUBLE, 2, dims.data(), PRN_aux.data(), MAT_F_DONT_COPY_DATA);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("Flag_valid_pseudorange", MAT_C_DOUBLE, MAT_T_DOUBLE, 2, dims.data(), Flag_valid_pseudorange_aux.data(), MAT_F_DONT_COPY_DATA);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-        }
-    Mat_Close(matfp);
+    mat_writer.close();
 
     return 0;
 }
@@ -385,24 +399,17 @@ double hybrid_observables_gs::compute_T_rx_s(const Gnss_Synchro &a) const
 
 bool hybrid_observables_gs::interp_trk_obs(Gnss_Synchro &interpolated_obs, uint32_t ch, uint64_t rx_clock) const
 {
-    int32_t nearest_element = -1;
     int64_t old_abs_diff = std::numeric_limits<int64_t>::max();
-    for (uint32_t i = 0; i < d_gnss_synchro_history->size(ch); i++)
-        {
-            const int64_t abs_diff = llabs(static_cast<int64_t>(rx_clock) - static_cast<int64_t>(d_gnss_synchro_history->get(ch, i).Tracking_sample_counter));
-            if (old_abs_diff > abs_diff)
-                {
-                    old_abs_diff = abs_diff;
-                    nearest_element = static_cast<int32_t>(i);
-                }
-        }
+    // binary search over the monotonic sample counter array
+    const int32_t nearest_element = d_gnss_synchro_history->nearest_sample_counter(ch, rx_clock, old_abs_diff);
 
     if (nearest_element != -1 and nearest_element != static_cast<int32_t>(d_gnss_synchro_history->size(ch)))
         {
+            const uint64_t nearest_sample_counter = d_gnss_synchro_history->sample_counter(ch, nearest_element);
             if ((static_cast<double>(old_abs_diff) / static_cast<double>(d_gnss_synchro_history->get(ch, nearest_element).fs)) < d_T_rx_step_s)
                 {
                     int32_t neighbor_element;
-                    if (rx_clock > d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter)
+                    if (rx_clock > nearest_sample_counter)
                         {
                             neighbor_element = nearest_element + 1;
                         }
@@ -414,17 +421,13 @@ bool hybrid_observables_gs::interp_trk_obs(Gnss_Synchro &interpolated_obs, uint3
                         {
                             int32_t t1_idx;
                             int32_t t2_idx;
-                            if (rx_clock > d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter)
+                            if (rx_clock > nearest_sample_counter)
                                 {
-                                    // std::cout << "S1= " << d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter
-                                    //           << " Si=" << rx_clock << " S2=" << d_gnss_synchro_history->get(ch, neighbor_element).Tracking_sample_counter << '\n';
                                     t1_idx = nearest_element;
                                     t2_idx = neighbor_element;
                                 }
                             else
                                 {
-                                    // std::cout << "inv S1= " << d_gnss_synchro_history->get(ch, neighbor_element).Tracking_sample_counter
-                                    //           << " Si=" << rx_clock << " S2=" << d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter << '\n';
                                     t1_idx = neighbor_element;
                                     t2_idx = nearest_element;
                                 }
@@ -435,34 +438,35 @@ bool hybrid_observables_gs::interp_trk_obs(Gnss_Synchro &interpolated_obs, uint3
                             // 2nd: Linear interpolation: y(t) = y(t1) + (y(t2) - y(t1)) * (t - t1) / (t2 - t1)
                             const double T_rx_s = static_cast<double>(rx_clock) / static_cast<double>(interpolated_obs.fs);
 
-                            const double time_factor = (T_rx_s - d_gnss_synchro_history->get(ch, t1_idx).RX_time) /
-                                                       (d_gnss_synchro_history->get(ch, t2_idx).RX_time -
-                                                           d_gnss_synchro_history->get(ch, t1_idx).RX_time);
+                            const double t1_rx_time = d_gnss_synchro_history->rx_time(ch, t1_idx);
+                            const double time_factor = (T_rx_s - t1_rx_time) /
+                                                       (d_gnss_synchro_history->rx_time(ch, t2_idx) - t1_rx_time);
 
                             // CARRIER PHASE INTERPOLATION
-                            interpolated_obs.Carrier_phase_rads = d_gnss_synchro_history->get(ch, t1_idx).Carrier_phase_rads + (d_gnss_synchro_history->get(ch, t2_idx).Carrier_phase_rads - d_gnss_synchro_history->get(ch, t1_idx).Carrier_phase_rads) * time_factor;
+                            interpolated_obs.Carrier_phase_rads = d_gnss_synchro_history->carrier_phase_rads(ch, t1_idx) + (d_gnss_synchro_history->carrier_phase_rads(ch, t2_idx) - d_gnss_synchro_history->carrier_phase_rads(ch, t1_idx)) * time_factor;
                             // CARRIER DOPPLER INTERPOLATION
-                            interpolated_obs.Carrier_Doppler_hz = d_gnss_synchro_history->get(ch, t1_idx).Carrier_Doppler_hz + (d_gnss_synchro_history->get(ch, t2_idx).Carrier_Doppler_hz - d_gnss_synchro_history->get(ch, t1_idx).Carrier_Doppler_hz) * time_factor;
+                            interpolated_obs.Carrier_Doppler_hz = d_gnss_synchro_history->carrier_doppler_hz(ch, t1_idx) + (d_gnss_synchro_history->carrier_doppler_hz(ch, t2_idx) - d_gnss_synchro_history->carrier_doppler_hz(ch, t1_idx)) * time_factor;
                             // TOW INTERPOLATION
                             // check TOW rollover
-                            if ((d_gnss_synchro_history->get(ch, t2_idx).TOW_at_current_symbol_ms - d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms) > 0)
+                            const uint32_t t1_tow_ms = d_gnss_synchro_history->tow_at_symbol_ms(ch, t1_idx);
+                            const uint32_t t2_tow_ms = d_gnss_synchro_history->tow_at_symbol_ms(ch, t2_idx);
+                            if ((t2_tow_ms - t1_tow_ms) > 0)
                                 {
-                                    interpolated_obs.interp_TOW_ms = static_cast<double>(d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms) + (static_cast<double>(d_gnss_synchro_history->get(ch, t2_idx).TOW_at_current_symbol_ms) - static_cast<double>(d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms)) * time_factor;
+                                    interpolated_obs.interp_TOW_ms = static_cast<double>(t1_tow_ms) + (static_cast<double>(t2_tow_ms) - static_cast<double>(t1_tow_ms)) * time_factor;
                                 }
                             else
                                 {
                                     // TOW rollover situation
-                                    interpolated_obs.interp_TOW_ms = static_cast<double>(d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms) + (static_cast<double>(d_gnss_synchro_history->get(ch, t2_idx).TOW_at_current_symbol_ms + 604800000) - static_cast<double>(d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms)) * time_factor;
+                                    interpolated_obs.interp_TOW_ms = static_cast<double>(t1_tow_ms) + (static_cast<double>(t2_tow_ms + 604800000) - static_cast<double>(t1_tow_ms)) * time_factor;
                                 }
 
                             // LOG(INFO) << "Channel " << ch << " int idx: " << t1_idx << " TOW Int: " << interpolated_obs.interp_TOW_ms
-                            //           << " TOW p1 : " << d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms
-                            //           << " TOW p2: "
-                            //           << d_gnss_synchro_history->get(ch, t2_idx).TOW_at_current_symbol_ms
+                            //           << " TOW p1 : " << t1_tow_ms
+                            //           << " TOW p2: " << t2_tow_ms
                             //           << " t2-t1: "
-                            //           << d_gnss_synchro_history->get(ch, t2_idx).RX_time - d_gnss_synchro_history->get(ch, t1_idx).RX_time
+                            //           << d_gnss_synchro_history->rx_time(ch, t2_idx) - t1_rx_time
                             //           << " trx - t1: "
-                            //           << T_rx_s - d_gnss_synchro_history->get(ch, t1_idx).RX_time;
+                            //           << T_rx_s - t1_rx_time;
                             // std::cout << "Rx samplestamp: " << T_rx_s << " Channel " << ch << " interp buff idx " << nearest_element
                             //           << " ,diff: " << old_abs_diff << " samples (" << static_cast<double>(old_abs_diff) / static_cast<double>(d_gnss_synchro_history->get(ch, nearest_element).fs) << " s)\n";
                             return true;
@@ -479,6 +483,18 @@ bool hybrid_observables_gs::interp_trk_obs(Gnss_Synchro &interpolated_obs, uint3
 
 void hybrid_observables_gs::forecast(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items_required)
 {
+#if ENABLE_FPGA
+    if (d_conf.fpga_epoch_source)
+        {
+            // no sample-counter stream: the epoch pulse comes from the FPGA
+            // counter interrupt inside general_work()
+            for (int32_t n = 0; n < static_cast<int32_t>(d_nchannels_in); n++)
+                {
+                    ninput_items_required[n] = 0;
+                }
+            return;
+        }
+#endif
     for (int32_t n = 0; n < static_cast<int32_t>(d_nchannels_in) - 1; n++)
         {
             ninput_items_required[n] = 0;
@@ -488,6 +504,29 @@ void hybrid_observables_gs::forecast(int noutput_items __attribute__((unused)),
 }
 
 
+#if ENABLE_FPGA
+bool hybrid_observables_gs::start()
+{
+    if (d_fpga_epoch_counter)
+        {
+            // program the interrupt interval in the FPGA counter module
+            d_fpga_epoch_counter->set_samples_per_epoch(d_samples_per_epoch);
+        }
+    return true;
+}
+
+
+bool hybrid_observables_gs::stop()
+{
+    if (d_fpga_epoch_counter)
+        {
+            d_fpga_epoch_counter->close_device();
+        }
+    return true;
+}
+#endif
+
+
 void hybrid_observables_gs::update_TOW(const std::vector<Gnss_Synchro> &data)
 {
     // 1. Set the TOW using the minimum TOW in the observables.
@@ -501,7 +540,7 @@ void hybrid_observables_gs::update_TOW(const std::vector<Gnss_Synchro> &data)
             uint32_t TOW_ref = 0U;
             for (it = data.cbegin(); it != data.cend(); it++)
                 {
-                    if (it->Flag_valid_word)
+                    if (it->Flag_valid_word or d_conf.telemetry_free)
                         {
                             if (it->TOW_at_current_symbol_ms > TOW_ref)
                                 {
@@ -565,33 +604,72 @@ void hybrid_observables_gs::smooth_pseudoranges(std::vector<Gnss_Synchro> &data)
     std::vector<Gnss_Synchro>::iterator it;
     for (it = data.begin(); it != data.end(); it++)
         {
-            if (it->Flag_valid_pseudorange)
+            const int32_t ch = it->Channel_ID;
+            // restart the filter whenever the pseudorange stream breaks, the channel
+            // is reassigned, or the tracking carrier lock detector reports a slip
+            const bool slip = d_channel_last_pll_lock[ch] and !it->Flag_carrier_lock;
+            if (!it->Flag_valid_pseudorange or slip or it->PRN != d_channel_smoothing_last_prn[ch])
+                {
+                    d_channel_smoothing_epochs[ch] = 0;
+                }
+            d_channel_last_pll_lock[ch] = it->Flag_carrier_lock;
+            if (!it->Flag_valid_pseudorange)
                 {
-                    // 0. get wavelength for the current signal
+                    continue;
+                }
+            if (d_channel_smoothing_epochs[ch] == 0)
+                {
+                    // (re)initialization: cache the carrier wavelength of this channel
+                    // and seed the filter with the raw pseudorange
                     double wavelength_m = 0.0;
                     const auto it_freq_map = SIGNAL_FREQ_MAP.find(std::string(it->Signal, 2));
                     if (it_freq_map != SIGNAL_FREQ_MAP.cend())
                         {
                             wavelength_m = SPEED_OF_LIGHT_M_S / it_freq_map->second;
                         }
-
-                    // todo: propagate the PLL lock status in Gnss_Synchro
-                    // 1. check if last PLL lock status was false and initialize last d_channel_last_pseudorange_smooth
-                    if (d_channel_last_pll_lock[it->Channel_ID] == true)
-                        {
-                            // 2. Compute the smoothed pseudorange for this channel
-                            // Hatch filter algorithm (https://insidegnss.com/can-you-list-all-the-properties-of-the-carrier-smoothing-filter/)
-                            const double r_sm = d_channel_last_pseudorange_smooth[it->Channel_ID];
-                            const double factor = ((d_smooth_filter_M - 1.0) / d_smooth_filter_M);
-                            it->Pseudorange_m = factor * r_sm + (1.0 / d_smooth_filter_M) * it->Pseudorange_m + wavelength_m * (factor / TWO_PI) * (it->Carrier_phase_rads - d_channel_last_carrier_phase_rads[it->Channel_ID]);
-                        }
-                    d_channel_last_pseudorange_smooth[it->Channel_ID] = it->Pseudorange_m;
-                    d_channel_last_carrier_phase_rads[it->Channel_ID] = it->Carrier_phase_rads;
-                    d_channel_last_pll_lock[it->Channel_ID] = it->Flag_valid_pseudorange;
+                    d_channel_wavelength_m[ch] = wavelength_m;
+                    d_channel_smoothing_last_prn[ch] = it->PRN;
                 }
             else
                 {
-                    d_channel_last_pll_lock[it->Channel_ID] = false;
+                    // Hatch filter algorithm (https://insidegnss.com/can-you-list-all-the-properties-of-the-carrier-smoothing-filter/)
+                    // The window grows with the filter age until the configured smoothing
+                    // factor is reached, so the output converges quickly after a reset
+                    // while keeping the update O(1) per channel
+                    const double M = std::min(static_cast<double>(d_channel_smoothing_epochs[ch] + 1), d_smooth_filter_M);
+                    const double factor = (M - 1.0) / M;
+                    const double r_sm = d_channel_last_pseudorange_smooth[ch];
+                    it->Pseudorange_m = factor * r_sm + (1.0 / M) * it->Pseudorange_m + d_channel_wavelength_m[ch] * (factor / TWO_PI) * (it->Carrier_phase_rads - d_channel_last_carrier_phase_rads[ch]);
+                }
+            d_channel_last_pseudorange_smooth[ch] = it->Pseudorange_m;
+            d_channel_last_carrier_phase_rads[ch] = it->Carrier_phase_rads;
+            if (d_channel_smoothing_epochs[ch] < static_cast<uint32_t>(d_smooth_filter_M))
+                {
+                    d_channel_smoothing_epochs[ch]++;
+                }
+        }
+}
+
+
+void hybrid_observables_gs::apply_clock_steering(std::vector<Gnss_Synchro> &data)
+{
+    // Remove the modelled receiver clock offset from the code and phase
+    // observables, with the same sign convention as the receiver clock offset
+    // correction applied in the PVT block (RINEX 3.04, Table 1). The epoch
+    // timestamps are kept on the receiver time grid, so the PVT solver starts
+    // every epoch with a near-zero clock state instead of re-estimating the
+    // whole oscillator offset
+    d_clock_steering_corr_s = d_clock_steering_kf.get_offset_s();
+    for (auto &it : data)
+        {
+            if (it.Flag_valid_pseudorange)
+                {
+                    it.Pseudorange_m -= d_clock_steering_corr_s * SPEED_OF_LIGHT_M_S;
+                    const auto it_freq_map = SIGNAL_FREQ_MAP.find(std::string(it.Signal, 2));
+                    if (it_freq_map != SIGNAL_FREQ_MAP.cend())
+                        {
+                            it.Carrier_phase_rads -= d_clock_steering_corr_s * it_freq_map->second * TWO_PI;
+                        }
                 }
         }
 }
@@ -655,7 +733,17 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
 
     // Push receiver clock into history buffer (connected to the last of the input channels)
     // The clock buffer gives time to the channels to compute the tracking observables
+#if ENABLE_FPGA
+    if (d_conf.fpga_epoch_source)
+        {
+            // epoch alignment straight from the FPGA counter: one register
+            // read per interrupt instead of a stream item through the scheduler
+            d_Rx_clock_buffer.push_back(d_fpga_epoch_counter->wait_and_read());
+        }
+    else if (ninput_items[d_nchannels_in - 1] > 0)
+#else
     if (ninput_items[d_nchannels_in - 1] > 0)
+#endif
         {
             d_Rx_clock_buffer.push_back(in[d_nchannels_in - 1][0].Tracking_sample_counter);
 
@@ -718,7 +806,7 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
             for (int32_t m = 0; m < ninput_items[n]; m++)
                 {
                     // Push the valid tracking Gnss_Synchros to their corresponding deque
-                    if (in[n][m].Flag_valid_word)
+                    if (in[n][m].Flag_valid_word or d_conf.telemetry_free)
                         {
                             if (d_gnss_synchro_history->size(n) > 0)
                                 {
@@ -729,8 +817,17 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
                                             // LOG(INFO) << "Channel " << d_gnss_synchro_history->front(n).Channel_ID << " changed satellite to PRN " << in[n][m].PRN;
                                         }
                                 }
-                            d_gnss_synchro_history->push_back(n, in[n][m]);
-                            d_gnss_synchro_history->back(n).RX_time = compute_T_rx_s(in[n][m]);
+                            Gnss_Synchro new_obs = in[n][m];
+                            new_obs.RX_time = compute_T_rx_s(in[n][m]);
+                            if (d_conf.telemetry_free and !new_obs.Flag_valid_word)
+                                {
+                                    // no telemetry decoder in the chain: place the epoch on a
+                                    // receiver-relative timescale so the interpolation and the
+                                    // output cadence keep working. The valid-word flag stays
+                                    // down, so no pseudorange is ever formed from this stamp
+                                    new_obs.TOW_at_current_symbol_ms = static_cast<uint32_t>(new_obs.RX_time * 1000.0);
+                                }
+                            d_gnss_synchro_history->push_back(n, new_obs);
                         }
                 }
             consume(n, ninput_items[n]);
@@ -783,11 +880,24 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
                     smooth_pseudoranges(epoch_data);
                 }
 
+            // Sample clock steering (active once the PVT block publishes
+            // per-epoch clock measurements, see PVT.enable_clock_steering)
+            d_clock_steering_kf.predict(d_T_rx_step_s);
+            if (d_clock_steering_kf.is_initialized())
+                {
+                    apply_clock_steering(epoch_data);
+                }
+
             // output the observables set to the PVT block
             for (uint32_t n = 0; n < d_nchannels_out; n++)
                 {
                     out[n][0] = epoch_data[n];
                 }
+
+            if ((n_valid > 0) && Latency_Tracer::get_instance().enabled())
+                {
+                    Latency_Tracer::get_instance().record_stage("observables", d_Rx_clock_buffer.front());
+                }
             // report channel status every second
             d_T_status_report_timer_ms += d_T_rx_step_ms;
             if (d_T_status_report_timer_ms >= 1000)
@@ -804,31 +914,27 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
             if (d_dump)
                 {
                     // MULTIPLEXED FILE RECORDING - Record results to file
-                    try
+                    // stage the epoch into one contiguous record for the
+                    // shared asynchronous writer, keeping the file layout
+                    // expected by save_matfile()
+                    std::vector<double> record;
+                    record.reserve(static_cast<std::size_t>(d_nchannels_out) * 7);
+                    for (uint32_t i = 0; i < d_nchannels_out; i++)
                         {
-                            double tmp_double;
-                            for (uint32_t i = 0; i < d_nchannels_out; i++)
-                                {
-                                    tmp_double = out[i][0].RX_time;
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].interp_TOW_ms / 1000.0;
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].Carrier_Doppler_hz;
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].Carrier_phase_rads / TWO_PI;
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].Pseudorange_m;
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = static_cast<double>(out[i][0].PRN);
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = static_cast<double>(out[i][0].Flag_valid_pseudorange);
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                }
+                            record.push_back(out[i][0].RX_time);
+                            record.push_back(out[i][0].interp_TOW_ms / 1000.0);
+                            record.push_back(out[i][0].Carrier_Doppler_hz);
+                            record.push_back(out[i][0].Carrier_phase_rads / TWO_PI);
+                            record.push_back(out[i][0].Pseudorange_m);
+                            record.push_back(static_cast<double>(out[i][0].PRN));
+                            record.push_back(static_cast<double>(out[i][0].Flag_valid_pseudorange));
                         }
-                    catch (const std::ofstream::failure &e)
+                    Async_Dump_Writer::get_instance().write(d_dump_stream_id, record.data(), record.size() * sizeof(double));
+                    if (d_columnar_dump)
                         {
-                            LOG(WARNING) << "Exception writing observables dump file " << e.what();
-                            d_dump = false;
+                            // same per-epoch record, transposed into per-field
+                            // blocks and indexed by TOW inside the writer
+                            d_columnar_dump->append_epoch(record.data(), static_cast<double>(d_T_rx_TOW_ms) / 1000.0);
                         }
                 }
 
@@ -836,7 +942,16 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
                 {
                     // LOG(INFO) << "OBS: diff time: " << out[0][0].RX_time * 1000.0 - old_time_debug;
                     // old_time_debug = out[0][0].RX_time * 1000.0;
-                    return 1;
+                    // optional output decimation: the TOW update, pseudoranges and
+                    // carrier smoothing above run every epoch, so the carrier phase
+                    // of the emitted epochs stays continuous
+                    d_T_out_epoch_counter++;
+                    if (d_T_out_epoch_counter >= d_T_out_decim_factor)
+                        {
+                            d_T_out_epoch_counter = 0;
+                            return 1;
+                        }
+                    return 0;
                 }
         }
     if (d_always_output_gs)
@@ -20,19 +20,23 @@
 #ifndef GNSS_SDR_HYBRID_OBSERVABLES_GS_H
 #define GNSS_SDR_HYBRID_OBSERVABLES_GS_H
 
+#include "clock_steering_kf.h"
 #include "gnss_block_interface.h"
 #include "gnss_time.h"  // for timetags produced by Tracking
 #include "obs_conf.h"
+#if ENABLE_FPGA
+#include "fpga_epoch_counter.h"
+#endif
 #include <boost/circular_buffer.hpp>  // for boost::circular_buffer
 #include <gnuradio/block.h>           // for block
 #include <gnuradio/types.h>           // for gr_vector_int
 #include <cstddef>                    // for size_t
 #include <cstdint>                    // for int32_t
-#include <fstream>                    // for std::ofstream
 #include <memory>                     // for std::shared, std:unique_ptr
 #include <queue>                      // for std::queue
 #include <string>                     // for std::string
 #include <typeinfo>                   // for typeid
+#include <utility>                    // for std::pair
 #include <vector>                     // for std::vector
 
 /** \addtogroup Observables
@@ -42,12 +46,11 @@
  * \{ */
 
 
+class Columnar_Dump_Writer;
 class Gnss_Synchro;
+class Gnss_synchro_soa_ring;
 class hybrid_observables_gs;
 
-template <class T>
-class Gnss_circular_deque;
-
 using hybrid_observables_gs_sptr = gnss_shared_ptr<hybrid_observables_gs>;
 
 hybrid_observables_gs_sptr hybrid_observables_gs_make(const Obs_Conf& conf_);
@@ -62,6 +65,10 @@ public:
     void forecast(int noutput_items, gr_vector_int& ninput_items_required);
     int general_work(int noutput_items, gr_vector_int& ninput_items,
         gr_vector_const_void_star& input_items, gr_vector_void_star& output_items);
+#if ENABLE_FPGA
+    bool start() override;
+    bool stop() override;
+#endif
 
 private:
     friend hybrid_observables_gs_sptr hybrid_observables_gs_make(const Obs_Conf& conf_);
@@ -70,6 +77,7 @@ private:
 
     const size_t d_double_type_hash_code = typeid(double).hash_code();
     const size_t d_int_type_hash_code = typeid(int).hash_code();
+    const size_t d_pair_type_hash_code = typeid(std::pair<double, double>).hash_code();
 
     void msg_handler_pvt_to_observables(const pmt::pmt_t& msg);
     double compute_T_rx_s(const Gnss_Synchro& a) const;
@@ -77,13 +85,23 @@ private:
     void update_TOW(const std::vector<Gnss_Synchro>& data);
     void compute_pranges(std::vector<Gnss_Synchro>& data) const;
     void smooth_pseudoranges(std::vector<Gnss_Synchro>& data);
+    void apply_clock_steering(std::vector<Gnss_Synchro>& data);
 
     void set_tag_timestamp_in_sdr_timeframe(const std::vector<Gnss_Synchro>& data, uint64_t rx_clock);
     int32_t save_matfile() const;
 
     Obs_Conf d_conf;
 
-    std::unique_ptr<Gnss_circular_deque<Gnss_Synchro>> d_gnss_synchro_history;  // Tracking observable history
+    Clock_Steering_Kf d_clock_steering_kf;  // sample clock model, fed by per-epoch PVT clock measurements
+
+    std::unique_ptr<Gnss_synchro_soa_ring> d_gnss_synchro_history;  // Tracking observable history
+
+#if ENABLE_FPGA
+    // direct FPGA epoch source (GNSS-SDR.fpga_epoch_source): replaces the
+    // sample-counter stream with one register read per counter interrupt
+    std::unique_ptr<Fpga_Epoch_Counter> d_fpga_epoch_counter;
+    uint32_t d_samples_per_epoch{0};
+#endif
 
     boost::circular_buffer<uint64_t> d_Rx_clock_buffer;  // time history
 
@@ -93,18 +111,27 @@ private:
     std::vector<bool> d_channel_last_pll_lock;
     std::vector<double> d_channel_last_pseudorange_smooth;
     std::vector<double> d_channel_last_carrier_phase_rads;
+    std::vector<double> d_channel_wavelength_m;          // cached per channel, looked up once per satellite assignment
+    std::vector<uint32_t> d_channel_smoothing_epochs;    // ramp-up counter, saturates at the smoothing factor
+    std::vector<uint32_t> d_channel_smoothing_last_prn;  // to restart the filter when the channel is reassigned
+
+    // optional chunked columnar companion dump (Observables.dump_columnar)
+    std::unique_ptr<Columnar_Dump_Writer> d_columnar_dump;
 
     std::string d_dump_filename;
 
-    std::ofstream d_dump_file;
+    int d_dump_stream_id = -1;  // handle into the shared Async_Dump_Writer
 
     double d_smooth_filter_M;
     double d_T_rx_step_s;
     double d_last_rx_clock_round20ms_error;
+    double d_clock_steering_corr_s;  // clock offset removed from the current epoch observables
 
     uint32_t d_T_rx_TOW_ms;
     uint32_t d_T_rx_step_ms;
     uint32_t d_T_status_report_timer_ms;
+    uint32_t d_T_out_decim_factor;
+    uint32_t d_T_out_epoch_counter;
     uint32_t d_nchannels_in;
     uint32_t d_nchannels_out;
 
@@ -0,0 +1,185 @@
+/*!
+ * \file obs_screening_gs.cc
+ * \brief Implementation of the observables screening block (multipath /
+ * outlier pre-filter between Observables and PVT)
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "obs_screening_gs.h"
+#include "MATH_CONSTANTS.h"
+#include "gnss_frequencies.h"
+#include "gnss_synchro.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <algorithm>  // for std::max
+#include <cmath>
+#include <string>
+
+namespace
+{
+// IIR constant tracking the slowly varying part of the CMC combination
+// (carrier ambiguity plus twice the ionospheric delay)
+constexpr double CMC_SMOOTHING_ALPHA = 0.05;
+// never flag below this residual, whatever the ensemble scatter says
+constexpr double RESIDUAL_FLOOR_M = 3.0;
+}  // namespace
+
+
+obs_screening_gs_sptr obs_screening_gs_make(uint32_t nchannels,
+    double threshold_sigma,
+    double slip_threshold_m,
+    uint32_t min_channels)
+{
+    return obs_screening_gs_sptr(new obs_screening_gs(nchannels, threshold_sigma, slip_threshold_m, min_channels));
+}
+
+
+obs_screening_gs::obs_screening_gs(uint32_t nchannels,
+    double threshold_sigma,
+    double slip_threshold_m,
+    uint32_t min_channels) : gr::sync_block("obs_screening_gs",
+                                 gr::io_signature::make(nchannels, nchannels, sizeof(Gnss_Synchro)),
+                                 gr::io_signature::make(nchannels, nchannels, sizeof(Gnss_Synchro))),
+                             d_cmc_avg(nchannels, 0.0),
+                             d_cmc_last(nchannels, 0.0),
+                             d_prn(nchannels, 0),
+                             d_epochs_filtered(nchannels, 0),
+                             d_state_valid(nchannels, false),
+                             d_residuals(nchannels),
+                             d_residual_channel(nchannels),
+                             d_threshold_sigma(threshold_sigma),
+                             d_slip_threshold_m(slip_threshold_m),
+                             d_nchannels(nchannels),
+                             d_min_channels(min_channels)
+{
+    // the timetags attached by the observables block must stay on their channel
+    set_tag_propagation_policy(TPP_ONE_TO_ONE);
+}
+
+
+obs_screening_gs::~obs_screening_gs()
+{
+    LOG(INFO) << "Observables screening: " << d_epochs_screened << " epochs screened, "
+              << d_pseudoranges_flagged << " pseudoranges flagged, "
+              << d_slips_detected << " cycle-slip candidates";
+}
+
+
+int obs_screening_gs::work(int noutput_items, gr_vector_const_void_star& input_items,
+    gr_vector_void_star& output_items)
+{
+    for (int epoch = 0; epoch < noutput_items; epoch++)
+        {
+            int n_valid = 0;
+            for (uint32_t ch = 0; ch < d_nchannels; ch++)
+                {
+                    const auto& in = reinterpret_cast<const Gnss_Synchro**>(&input_items[0])[ch][epoch];
+                    auto& out = reinterpret_cast<Gnss_Synchro**>(&output_items[0])[ch][epoch];
+                    out = in;
+
+                    if (!in.Flag_valid_pseudorange)
+                        {
+                            d_state_valid[ch] = false;
+                            continue;
+                        }
+
+                    const auto freq_it = SIGNAL_FREQ_MAP.find(std::string(in.Signal, 2));
+                    if (freq_it == SIGNAL_FREQ_MAP.end())
+                        {
+                            continue;  // unknown signal: pass through unscreened
+                        }
+                    const double lambda_m = SPEED_OF_LIGHT_M_S / freq_it->second;
+                    const double cmc_m = in.Pseudorange_m - (in.Carrier_phase_rads / TWO_PI) * lambda_m;
+
+                    if (!d_state_valid[ch] or d_prn[ch] != in.PRN)
+                        {
+                            // (re)initialize the channel filter; the first epoch
+                            // only seeds the CMC average, it is not screened
+                            d_cmc_avg[ch] = cmc_m;
+                            d_cmc_last[ch] = cmc_m;
+                            d_prn[ch] = in.PRN;
+                            d_epochs_filtered[ch] = 0;
+                            d_state_valid[ch] = true;
+                            continue;
+                        }
+
+                    if (std::fabs(cmc_m - d_cmc_last[ch]) > d_slip_threshold_m)
+                        {
+                            // carrier jumped with respect to the code: treat as a
+                            // cycle-slip candidate, drop the epoch and re-seed
+                            out.Flag_valid_pseudorange = false;
+                            d_cmc_avg[ch] = cmc_m;
+                            d_cmc_last[ch] = cmc_m;
+                            d_epochs_filtered[ch] = 0;
+                            d_slips_detected++;
+                            continue;
+                        }
+
+                    d_cmc_last[ch] = cmc_m;
+                    d_cmc_avg[ch] += CMC_SMOOTHING_ALPHA * (cmc_m - d_cmc_avg[ch]);
+                    if (d_epochs_filtered[ch] < 50)
+                        {
+                            // let the average converge before trusting residuals
+                            d_epochs_filtered[ch]++;
+                            continue;
+                        }
+                    d_residuals[n_valid] = static_cast<float>(cmc_m - d_cmc_avg[ch]);
+                    d_residual_channel[n_valid] = static_cast<int>(ch);
+                    n_valid++;
+                }
+
+            if (static_cast<uint32_t>(n_valid) < d_min_channels)
+                {
+                    continue;  // not enough redundancy to screen safely
+                }
+            d_epochs_screened++;
+
+            // iterative leave-worst-out screening: a gross outlier inflates
+            // the ensemble standard deviation enough to mask itself, so the
+            // suspect is always tested against the statistics of the others.
+            // Stopping at d_min_channels keeps redundancy for the PVT solver.
+            int n = n_valid;
+            while (n > static_cast<int>(d_min_channels))
+                {
+                    float stddev = 0.0;
+                    float mean = 0.0;
+                    volk_32f_stddev_and_mean_32f_x2(&stddev, &mean, d_residuals.data(), n);
+                    int worst = 0;
+                    for (int k = 1; k < n; k++)
+                        {
+                            if (std::fabs(d_residuals[k] - mean) > std::fabs(d_residuals[worst] - mean))
+                                {
+                                    worst = k;
+                                }
+                        }
+                    std::swap(d_residuals[worst], d_residuals[n - 1]);
+                    std::swap(d_residual_channel[worst], d_residual_channel[n - 1]);
+                    volk_32f_stddev_and_mean_32f_x2(&stddev, &mean, d_residuals.data(), n - 1);
+                    const float threshold = std::max(static_cast<float>(RESIDUAL_FLOOR_M),
+                        static_cast<float>(d_threshold_sigma) * stddev);
+                    if (std::fabs(d_residuals[n - 1] - mean) <= threshold)
+                        {
+                            break;
+                        }
+                    auto& out = reinterpret_cast<Gnss_Synchro**>(&output_items[0])[d_residual_channel[n - 1]][epoch];
+                    out.Flag_valid_pseudorange = false;
+                    d_pseudoranges_flagged++;
+                    DLOG(INFO) << "Screening: channel " << d_residual_channel[n - 1]
+                               << " PRN " << out.PRN << " CMC residual "
+                               << d_residuals[n - 1] - mean << " m exceeds " << threshold << " m";
+                    n--;
+                }
+        }
+    return noutput_items;
+}
@@ -0,0 +1,96 @@
+/*!
+ * \file obs_screening_gs.h
+ * \brief Interface of the observables screening block (multipath / outlier
+ * pre-filter between Observables and PVT)
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_OBS_SCREENING_GS_H
+#define GNSS_SDR_OBS_SCREENING_GS_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/sync_block.h>
+#include <cstdint>
+#include <vector>
+
+/** \addtogroup Observables
+ * \{ */
+/** \addtogroup Observables_gnuradio_blocks
+ * \{ */
+
+
+class obs_screening_gs;
+
+using obs_screening_gs_sptr = gnss_shared_ptr<obs_screening_gs>;
+
+obs_screening_gs_sptr obs_screening_gs_make(uint32_t nchannels,
+    double threshold_sigma,
+    double slip_threshold_m,
+    uint32_t min_channels);
+
+/*!
+ * \brief This class screens the observables vector for multipath-contaminated
+ * pseudoranges and carrier cycle slips before they reach the PVT block.
+ *
+ * It tracks the code-minus-carrier (CMC) combination per channel and, at each
+ * epoch, compares the CMC residuals across the whole channel vector: channels
+ * whose residual departs from the ensemble by more than a configurable number
+ * of standard deviations get their pseudorange invalidated for that epoch, so
+ * the RAIM iterations inside the PVT solver do not have to discover (and
+ * re-solve around) the outlier themselves. A CMC jump beyond the cycle-slip
+ * threshold resets the channel filter and drops that single epoch.
+ */
+class obs_screening_gs : public gr::sync_block
+{
+public:
+    ~obs_screening_gs() override;
+
+    int work(int noutput_items, gr_vector_const_void_star& input_items,
+        gr_vector_void_star& output_items) override;
+
+private:
+    friend obs_screening_gs_sptr obs_screening_gs_make(uint32_t nchannels,
+        double threshold_sigma,
+        double slip_threshold_m,
+        uint32_t min_channels);
+
+    obs_screening_gs(uint32_t nchannels,
+        double threshold_sigma,
+        double slip_threshold_m,
+        uint32_t min_channels);
+
+    // per-channel CMC filter state
+    std::vector<double> d_cmc_avg;
+    std::vector<double> d_cmc_last;
+    std::vector<uint32_t> d_prn;
+    std::vector<uint32_t> d_epochs_filtered;
+    std::vector<bool> d_state_valid;
+
+    // scratch buffers for the cross-channel statistics, reused every epoch
+    std::vector<float> d_residuals;
+    std::vector<int> d_residual_channel;
+
+    double d_threshold_sigma;
+    double d_slip_threshold_m;
+
+    uint64_t d_epochs_screened = 0;
+    uint64_t d_pseudoranges_flagged = 0;
+    uint64_t d_slips_detected = 0;
+
+    uint32_t d_nchannels;
+    uint32_t d_min_channels;
+};
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_OBS_SCREENING_GS_H
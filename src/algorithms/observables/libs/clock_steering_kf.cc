@@ -0,0 +1,123 @@
+/*!
+ * \file clock_steering_kf.cc
+ * \brief Kalman Filter for the receiver sample clock offset and drift
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "clock_steering_kf.h"
+
+
+void Clock_Steering_Kf::predict(double dt_s)
+{
+    if (!d_initialized || dt_s <= 0.0)
+        {
+            return;
+        }
+    // constant-drift model: F = [1 dt; 0 1]
+    d_x0 += d_x1 * dt_s;
+
+    // P = F P F' + Q, with the drift random walk integrated into the offset
+    const double q_drift = DRIFT_PROCESS_SD_S_S * DRIFT_PROCESS_SD_S_S;
+    const double q_offset = OFFSET_PROCESS_SD_S * OFFSET_PROCESS_SD_S;
+    d_P00 += dt_s * (2.0 * d_P01 + dt_s * d_P11) + q_drift * dt_s * dt_s * dt_s / 3.0 + q_offset * dt_s;
+    d_P01 += dt_s * d_P11 + q_drift * dt_s * dt_s / 2.0;
+    d_P11 += q_drift * dt_s;
+}
+
+
+void Clock_Steering_Kf::update(double measured_offset_s)
+{
+    if (!d_initialized)
+        {
+            d_x0 = measured_offset_s;
+            d_x1 = 0.0;
+            d_P00 = MEASUREMENT_SD_S * MEASUREMENT_SD_S;
+            d_P01 = 0.0;
+            d_P11 = INITIAL_DRIFT_SD_S_S * INITIAL_DRIFT_SD_S_S;
+            d_num_updates = 1ULL;
+            d_initialized = true;
+            return;
+        }
+    // scalar measurement of the offset state: H = [1 0]
+    const double S = d_P00 + MEASUREMENT_SD_S * MEASUREMENT_SD_S;
+    const double K0 = d_P00 / S;
+    const double K1 = d_P01 / S;
+    const double innovation = measured_offset_s - d_x0;
+    d_x0 += K0 * innovation;
+    d_x1 += K1 * innovation;
+    d_P11 -= K1 * d_P01;
+    d_P01 *= (1.0 - K0);
+    d_P00 *= (1.0 - K0);
+    d_num_updates++;
+}
+
+
+void Clock_Steering_Kf::update_drift(double measured_drift_s_s)
+{
+    if (!d_initialized)
+        {
+            return;
+        }
+    // scalar measurement of the drift state: H = [0 1]
+    const double S = d_P11 + DRIFT_MEASUREMENT_SD_S_S * DRIFT_MEASUREMENT_SD_S_S;
+    const double K0 = d_P01 / S;
+    const double K1 = d_P11 / S;
+    const double innovation = measured_drift_s_s - d_x1;
+    d_x0 += K0 * innovation;
+    d_x1 += K1 * innovation;
+    d_P00 -= K0 * d_P01;
+    d_P01 -= K0 * d_P11;
+    d_P11 *= (1.0 - K1);
+}
+
+
+void Clock_Steering_Kf::reset()
+{
+    d_x0 = 0.0;
+    d_x1 = 0.0;
+    d_P00 = 0.0;
+    d_P01 = 0.0;
+    d_P11 = 0.0;
+    d_num_updates = 0ULL;
+    d_initialized = false;
+}
+
+
+bool Clock_Steering_Kf::is_initialized() const
+{
+    return d_initialized;
+}
+
+
+uint64_t Clock_Steering_Kf::get_num_updates() const
+{
+    return d_num_updates;
+}
+
+
+double Clock_Steering_Kf::get_offset_s() const
+{
+    return d_x0;
+}
+
+
+double Clock_Steering_Kf::get_drift_s_s() const
+{
+    return d_x1;
+}
+
+
+double Clock_Steering_Kf::get_drift_ppm() const
+{
+    return d_x1 * 1.0e6;
+}
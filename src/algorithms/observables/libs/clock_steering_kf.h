@@ -0,0 +1,87 @@
+/*!
+ * \file clock_steering_kf.h
+ * \brief Kalman Filter for the receiver sample clock offset and drift
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_CLOCK_STEERING_KF_H
+#define GNSS_SDR_CLOCK_STEERING_KF_H
+
+#include <cstdint>
+
+/** \addtogroup Observables
+ * \{ */
+/** \addtogroup Observables_libs observables_libs
+ * Utilities for GNSS observables configuration.
+ * \{ */
+
+/*!
+ * \brief Two-state Kalman Filter modelling the receiver sample clock:
+ * clock offset [s] and clock drift [s/s] with respect to GNSS time.
+ *
+ * The filter is updated incrementally, one scalar clock offset measurement
+ * per PVT epoch, so the per-epoch cost is a handful of multiplications and
+ * no matrix algebra is required. The drift state tracks the oscillator
+ * frequency error (e.g. the temperature ramp of a TCXO front end), which
+ * maps directly into a common carrier Doppler bias.
+ */
+class Clock_Steering_Kf
+{
+public:
+    Clock_Steering_Kf() = default;
+
+    //! Propagates the clock model dt_s seconds forward
+    void predict(double dt_s);
+
+    //! Updates the filter with a clock offset measured by the PVT solver.
+    //! The first call initializes the filter state
+    void update(double measured_offset_s);
+
+    //! Updates the drift state with the clock drift solved by the PVT
+    //! Doppler (velocity) solution, which observes the oscillator frequency
+    //! error directly and speeds up convergence after temperature ramps
+    void update_drift(double measured_drift_s_s);
+
+    //! Discards the filter state (e.g. after a coarse receiver time correction)
+    void reset();
+
+    bool is_initialized() const;
+    uint64_t get_num_updates() const;
+    double get_offset_s() const;
+    double get_drift_s_s() const;
+    double get_drift_ppm() const;
+
+private:
+    // measurement and process noise, sized for a consumer-grade TCXO:
+    // PVT clock offset accuracy of a few meters, and a drift random walk
+    // fast enough to follow warm-up and temperature ramps (~0.1 ppm/min)
+    static constexpr double MEASUREMENT_SD_S = 1.0e-8;          // 10 ns (~3 m)
+    static constexpr double DRIFT_MEASUREMENT_SD_S_S = 1.0e-9;  // ~0.3 m/s in the Doppler solution
+    static constexpr double OFFSET_PROCESS_SD_S = 1.0e-9;       // white FM, per sqrt(s)
+    static constexpr double DRIFT_PROCESS_SD_S_S = 5.0e-9;      // drift random walk, per sqrt(s)
+    static constexpr double INITIAL_DRIFT_SD_S_S = 5.0e-6;      // 5 ppm oscillator tolerance
+
+    // state vector: x0 = clock offset [s], x1 = clock drift [s/s]
+    double d_x0{0.0};
+    double d_x1{0.0};
+    // symmetric 2x2 covariance
+    double d_P00{0.0};
+    double d_P01{0.0};
+    double d_P11{0.0};
+    uint64_t d_num_updates{0ULL};
+    bool d_initialized{false};
+};
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_CLOCK_STEERING_KF_H
@@ -37,10 +37,26 @@ public:
     uint32_t nchannels_in{0U};
     uint32_t nchannels_out{0U};
     uint32_t observable_interval_ms{20U};
+    uint32_t output_interval_ms{0U};  // if set to a multiple of observable_interval_ms, the output towards the PVT block is decimated to this interval
     bool enable_carrier_smoothing{false};
     bool always_output_gs{false};
+    // the channels run without telemetry decoder (Channels.telemetry_free):
+    // undecoded epochs are accepted and placed on a receiver-relative
+    // timescale, so phase/Doppler/C-N0 observables keep flowing at the
+    // configured rate while no pseudorange is ever formed
+    bool telemetry_free{false};
+    // FPGA builds only (GNSS-SDR.fpga_epoch_source): take the epoch
+    // alignment straight from the FPGA sample counter registers instead of
+    // consuming the software sample-counter stream, removing that stream
+    // (and its buffer) from the flowgraph. fs is needed to program the
+    // interrupt interval
+    bool fpga_epoch_source{false};
+    double fs{0.0};
     bool dump{false};
     bool dump_mat{false};
+    // chunked columnar companion dump (.obsc): per-field contiguous blocks
+    // with a footer index by time of week, for fast single-field scans
+    bool dump_columnar{false};
 };
 
 /** \} */
@@ -20,6 +20,7 @@
 #include "direct_resampler_conditioner_cb.h"
 #include "direct_resampler_conditioner_cc.h"
 #include "direct_resampler_conditioner_cs.h"
+#include "polyphase_resampler_cc.h"
 #include <glog/logging.h>
 #include <gnuradio/blocks/file_sink.h>
 #include <volk/volk.h>  // for lv_8sc_t
@@ -54,10 +55,32 @@ DirectResamplerConditioner::DirectResamplerConditioner(
             std::cout << aux_warn << '\n';
         }
 
+    // .method selects the resampling algorithm: "nearest" (default) keeps the
+    // sample-dropping conditioner; "polyphase" applies an anti-alias polyphase
+    // FIR. With "nearest", .nthreads > 1 splits each block across a small
+    // worker pool (gr_complex only; results are bit-exact with one thread)
+    const std::string method = configuration->property(role + ".method", std::string("nearest"));
+    const int nthreads = configuration->property(role + ".nthreads", 1);
+    if (item_type_ != "gr_complex" && (method == "polyphase" || nthreads > 1))
+        {
+            LOG(WARNING) << "The " << role << ".method and " << role << ".nthreads options are only available for gr_complex items; ignored";
+        }
+
     if (item_type_ == "gr_complex")
         {
             item_size_ = sizeof(gr_complex);
-            resampler_ = direct_resampler_make_conditioner_cc(sample_freq_in_, sample_freq_out_);
+            if (method == "polyphase")
+                {
+                    resampler_ = polyphase_make_resampler_cc(sample_freq_in_, sample_freq_out_);
+                }
+            else
+                {
+                    if (method != "nearest")
+                        {
+                            LOG(WARNING) << method << " unrecognized resampling method, using nearest";
+                        }
+                    resampler_ = direct_resampler_make_conditioner_cc(sample_freq_in_, sample_freq_out_, static_cast<unsigned int>(std::max(nthreads, 1)));
+                }
             DLOG(INFO) << "sample_freq_in " << sample_freq_in_;
             DLOG(INFO) << "sample_freq_out" << sample_freq_out_;
             DLOG(INFO) << "Item size " << item_size_;
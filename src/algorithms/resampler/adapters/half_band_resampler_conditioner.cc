@@ -0,0 +1,130 @@
+/*!
+ * \file half_band_resampler_conditioner.cc
+ * \brief Implementation of an adapter of a half-band decimator cascade
+ * to a SignalConditionerInterface
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "half_band_resampler_conditioner.h"
+#include "configuration_interface.h"
+#include "half_band_resampler_cc.h"
+#include <glog/logging.h>
+#include <gnuradio/blocks/file_sink.h>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+
+HalfBandResamplerConditioner::HalfBandResamplerConditioner(
+    const ConfigurationInterface* configuration,
+    const std::string& role,
+    unsigned int in_stream,
+    unsigned int out_stream)
+    : role_(role),
+      in_stream_(in_stream),
+      out_stream_(out_stream),
+      dump_(configuration->property(role + ".dump", false))
+{
+    const std::string default_item_type("gr_complex");
+    const std::string default_dump_file("./data/signal_conditioner.dat");
+    const double fs_in_deprecated = configuration->property("GNSS-SDR.internal_fs_hz", 2048000.0);
+    const double fs_in = configuration->property("GNSS-SDR.internal_fs_sps", fs_in_deprecated);
+    item_type_ = configuration->property(role + ".item_type", default_item_type);
+    dump_filename_ = configuration->property(role + ".dump_filename", default_dump_file);
+    sample_freq_in_ = configuration->property(role_ + ".sample_freq_in", 4000000.0);
+    sample_freq_out_ = configuration->property(role_ + ".sample_freq_out", fs_in);
+
+    if (std::fabs(fs_in - sample_freq_out_) > std::numeric_limits<double>::epsilon())
+        {
+            std::string aux_warn = "CONFIGURATION WARNING: Parameters GNSS-SDR.internal_fs_sps and " + role_ + ".sample_freq_out are not set to the same value!";
+            LOG(WARNING) << aux_warn;
+            std::cout << aux_warn << '\n';
+        }
+
+    // this conditioner only decimates by powers of two; round the requested
+    // ratio to the nearest 2^stages and warn if it does not match exactly
+    const double ratio = sample_freq_in_ / sample_freq_out_;
+    auto stages = static_cast<uint32_t>(std::max(1.0, std::round(std::log2(ratio))));
+    const double effective_ratio = std::pow(2.0, static_cast<double>(stages));
+    if (std::fabs(ratio - effective_ratio) > ratio * 1e-6)
+        {
+            std::string aux_warn = "CONFIGURATION WARNING: " + role_ + " Half_Band_Resampler requires a power-of-two decimation ratio; requested " + std::to_string(ratio) + ", using " + std::to_string(effective_ratio);
+            LOG(WARNING) << aux_warn;
+            std::cout << aux_warn << '\n';
+        }
+
+    if (item_type_ == "gr_complex")
+        {
+            item_size_ = sizeof(gr_complex);
+            resampler_ = half_band_make_resampler_cc(stages);
+            DLOG(INFO) << "sample_freq_in " << sample_freq_in_;
+            DLOG(INFO) << "sample_freq_out" << sample_freq_out_;
+            DLOG(INFO) << "half-band stages " << stages;
+            DLOG(INFO) << "Item size " << item_size_;
+            DLOG(INFO) << "resampler(" << resampler_->unique_id() << ")";
+        }
+    else
+        {
+            LOG(WARNING) << item_type_ << " unrecognized item type for resampler";
+            item_size_ = sizeof(gr_complex);
+        }
+    if (dump_)
+        {
+            DLOG(INFO) << "Dumping output into file " << dump_filename_;
+            file_sink_ = gr::blocks::file_sink::make(item_size_, dump_filename_.c_str());
+            DLOG(INFO) << "file_sink(" << file_sink_->unique_id() << ")";
+        }
+    if (in_stream_ > 1)
+        {
+            LOG(ERROR) << "This implementation only supports one input stream";
+        }
+    if (out_stream_ > 1)
+        {
+            LOG(ERROR) << "This implementation only supports one output stream";
+        }
+}
+
+
+void HalfBandResamplerConditioner::connect(gr::top_block_sptr top_block)
+{
+    if (dump_)
+        {
+            top_block->connect(resampler_, 0, file_sink_, 0);
+            DLOG(INFO) << "connected resampler to file sink";
+        }
+    else
+        {
+            DLOG(INFO) << "nothing to connect internally";
+        }
+}
+
+
+void HalfBandResamplerConditioner::disconnect(gr::top_block_sptr top_block)
+{
+    if (dump_)
+        {
+            top_block->disconnect(resampler_, 0, file_sink_, 0);
+        }
+}
+
+
+gr::basic_block_sptr HalfBandResamplerConditioner::get_left_block()
+{
+    return resampler_;
+}
+
+
+gr::basic_block_sptr HalfBandResamplerConditioner::get_right_block()
+{
+    return resampler_;
+}
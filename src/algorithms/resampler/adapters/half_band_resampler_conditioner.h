@@ -0,0 +1,89 @@
+/*!
+ * \file half_band_resampler_conditioner.h
+ * \brief Interface of an adapter of a half-band decimator cascade
+ * to a SignalConditionerInterface
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#ifndef GNSS_SDR_HALF_BAND_RESAMPLER_CONDITIONER_H
+#define GNSS_SDR_HALF_BAND_RESAMPLER_CONDITIONER_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/hier_block2.h>
+#include <string>
+
+/** \addtogroup Resampler
+ * \{ */
+/** \addtogroup Resampler_adapters
+ * \{ */
+
+
+class ConfigurationInterface;
+
+/*!
+ * \brief Interface of an adapter of a half-band decimator cascade to a
+ * SignalConditionerInterface
+ *
+ * Decimates by a power of two (e.g. 80 -> 4 MS/s is five 2:1 stages). Each
+ * stage is a half-band FIR, so most of its taps are zero and the cascade is
+ * much cheaper than a single anti-alias FIR running at the input rate.
+ */
+class HalfBandResamplerConditioner : public GNSSBlockInterface
+{
+public:
+    HalfBandResamplerConditioner(const ConfigurationInterface* configuration,
+        const std::string& role, unsigned int in_stream,
+        unsigned int out_stream);
+
+    ~HalfBandResamplerConditioner() = default;
+
+    inline std::string role() override
+    {
+        return role_;
+    }
+
+    //! Returns "Half_Band_Resampler"
+    inline std::string implementation() override
+    {
+        return "Half_Band_Resampler";
+    }
+
+    inline size_t item_size() override
+    {
+        return item_size_;
+    }
+
+    void connect(gr::top_block_sptr top_block) override;
+    void disconnect(gr::top_block_sptr top_block) override;
+    gr::basic_block_sptr get_left_block() override;
+    gr::basic_block_sptr get_right_block() override;
+
+private:
+    gr::block_sptr resampler_;
+    gr::block_sptr file_sink_;
+    std::string role_;
+    std::string item_type_;
+    std::string dump_filename_;
+    double sample_freq_in_;
+    double sample_freq_out_;
+    size_t item_size_;
+    unsigned int in_stream_;
+    unsigned int out_stream_;
+    bool dump_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_HALF_BAND_RESAMPLER_CONDITIONER_H
@@ -0,0 +1,169 @@
+/*!
+ * \file cuda_fft_resampler.cu
+ * \brief FFT-domain rational resampler for NVIDIA CUDA GPUs
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "cuda_fft_resampler.h"
+#include <algorithm>
+#include <cstdio>
+
+#define CUDA_NUM_THREADS 256
+
+
+// Builds the output spectrum from the input spectrum. Both are in the usual
+// FFT layout (bin 0 = DC, negative frequencies in the upper half). The
+// passband is the lower min(size_in, size_out) bins split between both
+// halves; its upper edge is shaped with a raised cosine of taper_bins bins
+// to avoid ringing, the rest is zeroed. The 1 / size_in factor normalizes
+// the unscaled forward transform so the passband gain is one
+__global__ void spectral_map_kernel(const cufftComplex* in, cufftComplex* out,
+    int size_in, int size_out, int taper_bins, float scale)
+{
+    const int k = blockIdx.x * blockDim.x + threadIdx.x;
+    if (k >= size_out)
+        {
+            return;
+        }
+
+    // signed frequency index of this output bin
+    const int f = (k <= size_out / 2) ? k : k - size_out;
+    const int half_band = min(size_in, size_out) / 2;
+
+    float gain = 0.0f;
+    const int abs_f = abs(f);
+    if (abs_f < half_band - taper_bins)
+        {
+            gain = scale;
+        }
+    else if (abs_f < half_band)
+        {
+            // raised-cosine rolloff over the last taper_bins of the passband
+            const float x = static_cast<float>(abs_f - (half_band - taper_bins)) / static_cast<float>(taper_bins);
+            gain = scale * 0.5f * (1.0f + __cosf(x * static_cast<float>(M_PI)));
+        }
+
+    if (gain != 0.0f)
+        {
+            // the same signed frequency in the input spectrum
+            const int k_in = (f >= 0) ? f : f + size_in;
+            out[k].x = in[k_in].x * gain;
+            out[k].y = in[k_in].y * gain;
+        }
+    else
+        {
+            out[k].x = 0.0f;
+            out[k].y = 0.0f;
+        }
+}
+
+
+cuda_fft_resampler::~cuda_fft_resampler()
+{
+    free();
+}
+
+
+bool cuda_fft_resampler::init(int fft_size_in, int fft_size_out)
+{
+    d_fft_size_in = fft_size_in;
+    d_fft_size_out = fft_size_out;
+    // shape the top ~3% of the narrower band; at least a few bins so short
+    // transforms still get a smooth edge
+    d_taper_bins = std::max(8, std::min(fft_size_in, fft_size_out) / 32);
+
+    const int spectrum_size = std::max(fft_size_in, fft_size_out);
+    if (cudaMalloc(reinterpret_cast<void**>(&d_input_gpu), sizeof(cufftComplex) * fft_size_in) != cudaSuccess)
+        {
+            return false;
+        }
+    if (cudaMalloc(reinterpret_cast<void**>(&d_spectrum_gpu), sizeof(cufftComplex) * spectrum_size) != cudaSuccess)
+        {
+            return false;
+        }
+    if (cudaMalloc(reinterpret_cast<void**>(&d_output_gpu), sizeof(cufftComplex) * fft_size_out) != cudaSuccess)
+        {
+            return false;
+        }
+    if (cufftPlan1d(&d_plan_fwd, fft_size_in, CUFFT_C2C, 1) != CUFFT_SUCCESS)
+        {
+            fprintf(stderr, "cuFFT error: could not create the %d-point forward plan\n", fft_size_in);
+            return false;
+        }
+    if (cufftPlan1d(&d_plan_inv, fft_size_out, CUFFT_C2C, 1) != CUFFT_SUCCESS)
+        {
+            fprintf(stderr, "cuFFT error: could not create the %d-point inverse plan\n", fft_size_out);
+            return false;
+        }
+    d_initialized = true;
+    return true;
+}
+
+
+bool cuda_fft_resampler::resample_block(const std::complex<float>* input, std::complex<float>* output)
+{
+    if (!d_initialized)
+        {
+            return false;
+        }
+    if (cudaMemcpy(d_input_gpu, input, sizeof(cufftComplex) * d_fft_size_in,
+            cudaMemcpyHostToDevice) != cudaSuccess)
+        {
+            return false;
+        }
+    if (cufftExecC2C(d_plan_fwd, d_input_gpu, d_input_gpu, CUFFT_FORWARD) != CUFFT_SUCCESS)
+        {
+            return false;
+        }
+    const int num_blocks = (d_fft_size_out + CUDA_NUM_THREADS - 1) / CUDA_NUM_THREADS;
+    spectral_map_kernel<<<num_blocks, CUDA_NUM_THREADS>>>(d_input_gpu, d_spectrum_gpu,
+        d_fft_size_in, d_fft_size_out, d_taper_bins,
+        1.0f / static_cast<float>(d_fft_size_in));
+    if (cufftExecC2C(d_plan_inv, d_spectrum_gpu, d_output_gpu, CUFFT_INVERSE) != CUFFT_SUCCESS)
+        {
+            return false;
+        }
+    // synchronous copy-back also waits for the kernel and the transforms
+    if (cudaMemcpy(output, d_output_gpu, sizeof(cufftComplex) * d_fft_size_out,
+            cudaMemcpyDeviceToHost) != cudaSuccess)
+        {
+            return false;
+        }
+    return true;
+}
+
+
+void cuda_fft_resampler::free()
+{
+    if (d_initialized)
+        {
+            cufftDestroy(d_plan_fwd);
+            cufftDestroy(d_plan_inv);
+            d_initialized = false;
+        }
+    if (d_input_gpu != nullptr)
+        {
+            cudaFree(d_input_gpu);
+            d_input_gpu = nullptr;
+        }
+    if (d_spectrum_gpu != nullptr)
+        {
+            cudaFree(d_spectrum_gpu);
+            d_spectrum_gpu = nullptr;
+        }
+    if (d_output_gpu != nullptr)
+        {
+            cudaFree(d_output_gpu);
+            d_output_gpu = nullptr;
+        }
+}
@@ -0,0 +1,77 @@
+/*!
+ * \file cuda_fft_resampler.h
+ * \brief FFT-domain rational resampler for NVIDIA CUDA GPUs
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * Converts blocks of fft_size_in complex samples into blocks of fft_size_out
+ * complex samples spanning the same time interval by zero-padding or
+ * truncating the spectrum between a forward and an inverse cuFFT transform.
+ * The caller chooses fft_size_out / fft_size_in equal to the exact rational
+ * resampling ratio, so consecutive blocks line up on the output sample grid
+ * without any per-block phase correction.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_CUDA_FFT_RESAMPLER_H
+#define GNSS_SDR_CUDA_FFT_RESAMPLER_H
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <cufft.h>
+#include <complex>
+
+/** \addtogroup Resampler
+ * \{ */
+/** \addtogroup Resampler_gnuradio_blocks
+ * \{ */
+
+
+/*!
+ * \brief Spectral-domain rational resampler backed by cuFFT
+ */
+class cuda_fft_resampler
+{
+public:
+    cuda_fft_resampler() = default;
+    ~cuda_fft_resampler();
+
+    //! Creates the cuFFT plans and the device buffers. Returns false on any
+    //! CUDA error; in that case the object must not be used
+    bool init(int fft_size_in, int fft_size_out);
+
+    /*!
+     * Resamples one block: forward FFT of fft_size_in input samples,
+     * spectral zero-padding or truncation with a raised-cosine band-edge
+     * taper, inverse FFT of fft_size_out samples. Blocking call; the output
+     * is on the host when it returns
+     */
+    bool resample_block(const std::complex<float>* input, std::complex<float>* output);
+
+    //! Releases plans and device memory; called by the destructor
+    void free();
+
+private:
+    cufftHandle d_plan_fwd{};
+    cufftHandle d_plan_inv{};
+    cufftComplex* d_input_gpu = nullptr;     // time domain, fft_size_in
+    cufftComplex* d_spectrum_gpu = nullptr;  // frequency domain, max of both sizes
+    cufftComplex* d_output_gpu = nullptr;    // time domain, fft_size_out
+    int d_fft_size_in = 0;
+    int d_fft_size_out = 0;
+    int d_taper_bins = 0;  // width of the raised-cosine edge at each band side
+    bool d_initialized = false;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_CUDA_FFT_RESAMPLER_H
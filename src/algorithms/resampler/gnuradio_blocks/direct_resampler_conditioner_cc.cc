@@ -10,7 +10,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -22,25 +22,37 @@
 #include <volk/volk.h>  // for gr_complex
 #include <algorithm>    // for min
 
+namespace
+{
+// below this size the partitioning overhead is not worth paying
+constexpr int min_partitioned_items = 8192;
+}  // namespace
+
 direct_resampler_conditioner_cc_sptr direct_resampler_make_conditioner_cc(
-    double sample_freq_in, double sample_freq_out)
+    double sample_freq_in, double sample_freq_out, unsigned int nthreads)
 {
     return direct_resampler_conditioner_cc_sptr(
         new direct_resampler_conditioner_cc(sample_freq_in,
-            sample_freq_out));
+            sample_freq_out,
+            nthreads));
 }
 
 
 direct_resampler_conditioner_cc::direct_resampler_conditioner_cc(
     double sample_freq_in,
-    double sample_freq_out)
+    double sample_freq_out,
+    unsigned int nthreads)
     : gr::block("direct_resampler_conditioner_cc",
           gr::io_signature::make(1, 1, sizeof(gr_complex)),
           gr::io_signature::make(1, 1, sizeof(gr_complex))),
+      d_generation(0),
+      d_pending(0),
+      d_shutdown(false),
       d_sample_freq_in(sample_freq_in),
       d_sample_freq_out(sample_freq_out),
       d_phase(0),
-      d_lphase(0)
+      d_lphase(0),
+      d_nthreads(std::max(1U, std::min(nthreads, 8U)))
 {
     // Computes the phase step multiplying the resampling ratio by 2^32 = 4294967296
     const double two_32 = 4294967296.0;
@@ -57,6 +69,85 @@ direct_resampler_conditioner_cc::direct_resampler_conditioner_cc(
 #else
     this->set_relative_rate(sample_freq_out / sample_freq_in);
 #endif
+
+    if (d_nthreads > 1)
+        {
+            d_ranges.resize(d_nthreads - 1);
+            for (unsigned int i = 0; i < d_nthreads - 1; i++)
+                {
+                    d_workers.emplace_back(&direct_resampler_conditioner_cc::worker_loop, this, i);
+                }
+        }
+}
+
+
+direct_resampler_conditioner_cc::~direct_resampler_conditioner_cc()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mtx);
+        d_shutdown = true;
+    }
+    d_cv.notify_all();
+    for (auto &worker : d_workers)
+        {
+            worker.join();
+        }
+}
+
+
+void direct_resampler_conditioner_cc::worker_loop(unsigned int index)
+{
+    uint64_t seen_generation = 0;
+    while (true)
+        {
+            std::function<void(uint64_t, uint64_t)> segment;
+            std::pair<uint64_t, uint64_t> range;
+            {
+                std::unique_lock<std::mutex> lock(d_mtx);
+                d_cv.wait(lock, [&] { return d_shutdown || d_generation > seen_generation; });
+                if (d_shutdown)
+                    {
+                        return;
+                    }
+                seen_generation = d_generation;
+                segment = d_segment;
+                range = d_ranges[index];
+            }
+            if (range.first < range.second)
+                {
+                    segment(range.first, range.second);
+                }
+            {
+                std::lock_guard<std::mutex> lock(d_mtx);
+                d_pending--;
+            }
+            d_done_cv.notify_one();
+        }
+}
+
+
+void direct_resampler_conditioner_cc::run_segments(const std::function<void(uint64_t, uint64_t)> &segment, uint64_t total_items)
+{
+    const uint64_t chunk = (total_items + d_nthreads - 1) / d_nthreads;
+    {
+        std::lock_guard<std::mutex> lock(d_mtx);
+        d_segment = segment;
+        for (unsigned int i = 0; i < d_nthreads - 1; i++)
+            {
+                const uint64_t ka = std::min((i + 1) * chunk, total_items);
+                const uint64_t kb = std::min((i + 2) * chunk, total_items);
+                d_ranges[i] = {ka, kb};
+            }
+        d_pending = d_nthreads - 1;
+        d_generation++;
+    }
+    d_cv.notify_all();
+
+    // this thread takes the first segment
+    segment(0, std::min(chunk, total_items));
+
+    std::unique_lock<std::mutex> lock(d_mtx);
+    d_done_cv.wait(lock, [&] { return d_pending == 0; });
 }
 
 
@@ -72,6 +163,89 @@ void direct_resampler_conditioner_cc::forecast(int noutput_items,
 }
 
 
+int direct_resampler_conditioner_cc::partitioned_work(int noutput_items,
+    gr_vector_int &ninput_items, const gr_complex *in, gr_complex *out)
+{
+    const uint64_t two_32 = uint64_t(1) << 32;
+    const uint64_t p0 = d_phase;
+    const uint64_t lp0 = d_lphase;
+    const uint64_t step = d_phase_step;
+    const auto total = static_cast<uint64_t>(noutput_items);
+    uint64_t consumed;
+
+    if (d_sample_freq_in >= d_sample_freq_out)
+        {
+            // The scalar loop emits output k at the iteration where the 32-bit
+            // phase accumulator wraps for the (k+1)-th time, which is
+            // n_k = ceil(((k + 1 - e0) * 2^32 - p0) / step) with e0 = 1 if the
+            // entry state emits immediately. Seeding each segment at its own
+            // n_k makes the segments independent and bit-exact
+            const uint64_t e0 = (p0 <= lp0) ? 1 : 0;
+            auto first_iteration = [=](uint64_t k) -> uint64_t {
+                if (k + 1 <= e0)
+                    {
+                        return 0;
+                    }
+                return ((k + 1 - e0) * two_32 - p0 + step - 1) / step;
+            };
+            auto segment = [=](uint64_t ka, uint64_t kb) {
+                const uint64_t n0 = (ka == 0) ? 0 : first_iteration(ka - 1) + 1;
+                uint32_t phase = static_cast<uint32_t>(p0 + n0 * step);
+                uint32_t lphase = (n0 == 0) ? static_cast<uint32_t>(lp0) : static_cast<uint32_t>(p0 + (n0 - 1) * step);
+                const gr_complex *pin = in + n0;
+                const auto pstep = static_cast<uint32_t>(step);
+                for (uint64_t k = ka; k < kb;)
+                    {
+                        if (phase <= lphase)
+                            {
+                                out[k] = *pin;
+                                k++;
+                            }
+                        lphase = phase;
+                        phase += pstep;
+                        pin++;
+                    }
+            };
+            run_segments(segment, total);
+            const uint64_t iterations = first_iteration(total - 1) + 1;
+            d_lphase = static_cast<uint32_t>(p0 + (iterations - 1) * step);
+            d_phase = static_cast<uint32_t>(p0 + iterations * step);
+            consumed = iterations;
+        }
+    else
+        {
+            // In the interpolation loop output k reads input
+            // floor((p0 + (k + 1) * step) / 2^32)
+            auto input_index = [=](uint64_t k) -> uint64_t {
+                return (p0 + (k + 1) * step) >> 32;
+            };
+            auto segment = [=](uint64_t ka, uint64_t kb) {
+                uint32_t phase = static_cast<uint32_t>(p0 + ka * step);
+                uint32_t lphase = (ka == 0) ? static_cast<uint32_t>(lp0) : static_cast<uint32_t>(p0 + (ka - 1) * step);
+                const gr_complex *pin = in + ((ka == 0) ? 0 : input_index(ka - 1));
+                const auto pstep = static_cast<uint32_t>(step);
+                for (uint64_t k = ka; k < kb; k++)
+                    {
+                        lphase = phase;
+                        phase += pstep;
+                        if (phase <= lphase)
+                            {
+                                pin++;
+                            }
+                        out[k] = *pin;
+                    }
+            };
+            run_segments(segment, total);
+            consumed = input_index(total - 1);
+            d_lphase = static_cast<uint32_t>(p0 + (total - 1) * step);
+            d_phase = static_cast<uint32_t>(p0 + total * step);
+        }
+
+    consume_each(std::min(static_cast<int>(consumed), ninput_items[0]));
+    return noutput_items;
+}
+
+
 int direct_resampler_conditioner_cc::general_work(int noutput_items,
     gr_vector_int &ninput_items, gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
@@ -79,6 +253,11 @@ int direct_resampler_conditioner_cc::general_work(int noutput_items,
     const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
     auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
 
+    if (d_nthreads > 1 && noutput_items >= min_partitioned_items)
+        {
+            return partitioned_work(noutput_items, ninput_items, in, out);
+        }
+
     int lcv = 0;
     int count = 0;
 
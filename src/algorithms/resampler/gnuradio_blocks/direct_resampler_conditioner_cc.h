@@ -16,7 +16,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -27,7 +27,14 @@
 
 #include "gnss_block_interface.h"
 #include <gnuradio/block.h>
+#include <gnuradio/gr_complex.h>
+#include <condition_variable>
 #include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 
 /** \addtogroup Resampler
  * \{ */
@@ -41,17 +48,21 @@ using direct_resampler_conditioner_cc_sptr = gnss_shared_ptr<direct_resampler_co
 
 direct_resampler_conditioner_cc_sptr direct_resampler_make_conditioner_cc(
     double sample_freq_in,
-    double sample_freq_out);
+    double sample_freq_out,
+    unsigned int nthreads = 1);
 
 /*!
  * \brief This class implements a direct resampler conditioner for complex data
  *
- * Direct resampling without interpolation
+ * Direct resampling without interpolation. With nthreads > 1, each output
+ * block is split across a small pool of worker threads; the phase accumulator
+ * of every segment is seeded analytically, so the result is bit-exact with
+ * the single-threaded loop.
  */
 class direct_resampler_conditioner_cc : public gr::block
 {
 public:
-    ~direct_resampler_conditioner_cc() = default;
+    ~direct_resampler_conditioner_cc();
     inline unsigned int sample_freq_in() const
     {
         return d_sample_freq_in;
@@ -71,17 +82,40 @@ public:
 private:
     friend direct_resampler_conditioner_cc_sptr direct_resampler_make_conditioner_cc(
         double sample_freq_in,
-        double sample_freq_out);
+        double sample_freq_out,
+        unsigned int nthreads);
 
     direct_resampler_conditioner_cc(
         double sample_freq_in,
-        double sample_freq_out);
+        double sample_freq_out,
+        unsigned int nthreads);
+
+    //! work-partitioned resampling with analytically seeded segments
+    int partitioned_work(int noutput_items, gr_vector_int &ninput_items,
+        const gr_complex *in, gr_complex *out);
+
+    //! run segment(ka, kb) over [0, total_items) split across the pool
+    void run_segments(const std::function<void(uint64_t, uint64_t)> &segment, uint64_t total_items);
+
+    void worker_loop(unsigned int index);
+
+    // worker pool (only populated when nthreads > 1)
+    std::vector<std::thread> d_workers;
+    std::vector<std::pair<uint64_t, uint64_t>> d_ranges;
+    std::function<void(uint64_t, uint64_t)> d_segment;
+    std::mutex d_mtx;
+    std::condition_variable d_cv;
+    std::condition_variable d_done_cv;
+    uint64_t d_generation;
+    unsigned int d_pending;
+    bool d_shutdown;
 
     double d_sample_freq_in;   // Sampling frequency of the input signal
     double d_sample_freq_out;  // Sampling frequency of the output signal
     uint32_t d_phase;
     uint32_t d_lphase;
     uint32_t d_phase_step;
+    unsigned int d_nthreads;
 };
 
 
@@ -0,0 +1,142 @@
+/*!
+ * \file gpu_fft_resampler_cc.cc
+ * \brief Arbitrary rational resampler with gr_complex input and gr_complex
+ *        output, computed in the frequency domain on a CUDA GPU
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#include "gpu_fft_resampler_cc.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+
+gpu_fft_resampler_cc_sptr gpu_fft_make_resampler_cc(double sample_freq_in,
+    double sample_freq_out,
+    int target_fft_size)
+{
+    return gpu_fft_resampler_cc_sptr(new gpu_fft_resampler_cc(sample_freq_in,
+        sample_freq_out, target_fft_size));
+}
+
+
+gpu_fft_resampler_cc::gpu_fft_resampler_cc(double sample_freq_in,
+    double sample_freq_out,
+    int target_fft_size)
+    : gr::block("gpu_fft_resampler_cc",
+          gr::io_signature::make(1, 1, sizeof(gr_complex)),
+          gr::io_signature::make(1, 1, sizeof(gr_complex)))
+{
+    // lab clocks are rational multiples of the nominal rate, so a denominator
+    // of 10^6 is enough to represent e.g. 99.999 MHz -> 100 MHz exactly
+    to_rational(sample_freq_out / sample_freq_in, 1000000, d_p, d_q);
+    const double achieved = static_cast<double>(d_p) / static_cast<double>(d_q);
+    DLOG(INFO) << "GPU FFT resampler ratio " << d_p << "/" << d_q
+               << " (requested " << sample_freq_out / sample_freq_in << ", achieved " << achieved << ")";
+
+    // k blocks of q input samples per transform: one block discarded at each
+    // end, k - 2 blocks kept. Small q (simple ratios) gets k raised until the
+    // transform reaches the requested size; large q (nearly unity ratios)
+    // already exceeds it with the minimum k
+    const int k = std::max(4, (target_fft_size + d_q - 1) / d_q);
+    d_fft_size_in = k * d_q;
+    d_fft_size_out = k * d_p;
+    d_hop_in = (k - 2) * d_q;
+    d_hop_out = (k - 2) * d_p;
+    d_block_out.resize(d_fft_size_out);
+
+    if (!d_resampler.init(d_fft_size_in, d_fft_size_out))
+        {
+            throw std::runtime_error("cuda_fft_resampler initialization failed");
+        }
+
+    // each transform needs 2 * q samples of context around the hop
+    this->set_history(2 * d_q + 1);
+    this->set_output_multiple(d_hop_out);
+}
+
+
+void gpu_fft_resampler_cc::to_rational(double ratio, int max_den, int &p, int &q)
+{
+    // continued-fraction expansion, stopped at the denominator limit
+    int p0 = 0;
+    int q0 = 1;
+    int p1 = 1;
+    int q1 = 0;
+    double x = ratio;
+    for (int i = 0; i < 64; i++)
+        {
+            const auto a = static_cast<int>(std::floor(x));
+            if (q0 + static_cast<int64_t>(a) * q1 > max_den)
+                {
+                    break;
+                }
+            const int p2 = a * p1 + p0;
+            const int q2 = a * q1 + q0;
+            p0 = p1;
+            q0 = q1;
+            p1 = p2;
+            q1 = q2;
+            const double frac = x - static_cast<double>(a);
+            if (frac < 1e-12)
+                {
+                    break;
+                }
+            x = 1.0 / frac;
+        }
+    p = p1;
+    q = q1;
+}
+
+
+void gpu_fft_resampler_cc::forecast(int noutput_items, gr_vector_int &ninput_items_required)
+{
+    const int nblocks = noutput_items / d_hop_out;
+    ninput_items_required[0] = nblocks * d_hop_in + 2 * d_q;
+}
+
+
+int gpu_fft_resampler_cc::general_work(int noutput_items,
+    gr_vector_int &ninput_items,
+    gr_vector_const_void_star &input_items,
+    gr_vector_void_star &output_items)
+{
+    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
+    auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
+
+    const int nblocks = std::min(noutput_items / d_hop_out,
+        (ninput_items[0] - 2 * d_q) / d_hop_in);
+
+    for (int b = 0; b < nblocks; b++)
+        {
+            // in points 2 * q samples into the past thanks to set_history(),
+            // so each transform sees q context samples on each side of the hop
+            if (!d_resampler.resample_block(in + static_cast<int64_t>(b) * d_hop_in, d_block_out.data()))
+                {
+                    LOG(WARNING) << "GPU FFT resampler block failed, output truncated";
+                    consume_each(b * d_hop_in);
+                    return b * d_hop_out;
+                }
+            std::memcpy(out + static_cast<int64_t>(b) * d_hop_out,
+                d_block_out.data() + d_p,
+                sizeof(gr_complex) * d_hop_out);
+        }
+
+    consume_each(nblocks * d_hop_in);
+    return nblocks * d_hop_out;
+}
@@ -0,0 +1,99 @@
+/*!
+ * \file gpu_fft_resampler_cc.h
+ * \brief Arbitrary rational resampler with gr_complex input and gr_complex
+ *        output, computed in the frequency domain on a CUDA GPU
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * The output/input rate ratio is approximated by a reduced fraction p/q and
+ * the stream is processed overlap-save: blocks of k*q input samples are
+ * transformed with cuFFT, the spectrum is zero-padded or truncated, and the
+ * inverse transform of k*p samples covers exactly the same time interval, so
+ * q input samples always map to p output samples and the output grid is
+ * jitter-free by construction. One block of q input samples is discarded at
+ * each end of every transform to absorb the circular-convolution wrap-around
+ * of the implicit band-limiting filter.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GPU_FFT_RESAMPLER_CC_H
+#define GNSS_SDR_GPU_FFT_RESAMPLER_CC_H
+
+#include "cuda_fft_resampler.h"
+#include "gnss_block_interface.h"
+#include <gnuradio/block.h>
+#include <vector>
+
+/** \addtogroup Resampler
+ * \{ */
+/** \addtogroup Resampler_gnuradio_blocks
+ * \{ */
+
+
+class gpu_fft_resampler_cc;
+
+using gpu_fft_resampler_cc_sptr = gnss_shared_ptr<gpu_fft_resampler_cc>;
+
+gpu_fft_resampler_cc_sptr gpu_fft_make_resampler_cc(double sample_freq_in,
+    double sample_freq_out,
+    int target_fft_size);
+
+/*!
+ * \brief GPU FFT overlap-save arbitrary resampler for complex data
+ */
+class gpu_fft_resampler_cc : public gr::block
+{
+public:
+    ~gpu_fft_resampler_cc() = default;
+
+    inline int fft_size_in() const
+    {
+        return d_fft_size_in;
+    }
+
+    inline int fft_size_out() const
+    {
+        return d_fft_size_out;
+    }
+
+    void forecast(int noutput_items, gr_vector_int &ninput_items_required);
+
+    int general_work(int noutput_items,
+        gr_vector_int &ninput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    friend gpu_fft_resampler_cc_sptr gpu_fft_make_resampler_cc(double sample_freq_in,
+        double sample_freq_out,
+        int target_fft_size);
+
+    gpu_fft_resampler_cc(double sample_freq_in,
+        double sample_freq_out,
+        int target_fft_size);
+
+    //! best rational approximation of ratio with denominator up to max_den
+    static void to_rational(double ratio, int max_den, int &p, int &q);
+
+    cuda_fft_resampler d_resampler;
+    std::vector<gr_complex> d_block_out;  // one inverse transform, fft_size_out
+    int d_p = 0;             // output samples per q input samples
+    int d_q = 0;             // input samples per p output samples
+    int d_fft_size_in = 0;   // k * q
+    int d_fft_size_out = 0;  // k * p
+    int d_hop_in = 0;        // input samples consumed per transform, (k - 2) * q
+    int d_hop_out = 0;       // output samples produced per transform, (k - 2) * p
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GPU_FFT_RESAMPLER_CC_H
@@ -0,0 +1,152 @@
+/*!
+ * \file half_band_resampler_cc.cc
+ * \brief Cascade of 2:1 half-band decimators with gr_complex input and
+ *        gr_complex output
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#include "half_band_resampler_cc.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <algorithm>
+#include <cmath>
+
+
+half_band_resampler_cc_sptr half_band_make_resampler_cc(uint32_t stages)
+{
+    return half_band_resampler_cc_sptr(new half_band_resampler_cc(stages));
+}
+
+
+half_band_resampler_cc::half_band_resampler_cc(uint32_t stages)
+    : gr::sync_decimator("half_band_resampler_cc",
+          gr::io_signature::make(1, 1, sizeof(gr_complex)),
+          gr::io_signature::make(1, 1, sizeof(gr_complex)),
+          1U << stages),
+      d_stages(stages)
+{
+    // windowed-sinc half-band prototype of length 4 * half_taps - 1 with
+    // cutoff at a quarter of the input rate. Only the even taps are computed:
+    // all the odd ones vanish except the center, which is handled separately
+    // as 0.5 times a delayed odd-phase sample
+    const uint32_t ntaps = 4 * half_taps - 1;
+    const double center = static_cast<double>(ntaps - 1) / 2.0;
+    d_taps.resize(2 * half_taps);
+    double sum = 0.0;
+    for (uint32_t m = 0; m < 2 * half_taps; m++)
+        {
+            const uint32_t n = 2 * m;
+            const double t = (static_cast<double>(n) - center) / 2.0;
+            const double s = std::sin(M_PI * t) / (M_PI * t);  // t is never zero at even n
+            const double w = 0.42 - 0.5 * std::cos(2.0 * M_PI * static_cast<double>(n) / static_cast<double>(ntaps - 1)) + 0.08 * std::cos(4.0 * M_PI * static_cast<double>(n) / static_cast<double>(ntaps - 1));  // Blackman
+            d_taps[m] = static_cast<float>(0.5 * s * w);
+            sum += d_taps[m];
+        }
+    // the even branch and the center tap each contribute 0.5 to the DC gain
+    for (auto &tap : d_taps)
+        {
+            tap = static_cast<float>(tap * 0.5 / sum);
+        }
+
+    d_state.resize(stages);
+    for (auto &state : d_state)
+        {
+            state.even_tail.assign(2 * half_taps - 1, gr_complex(0.0, 0.0));
+            state.odd_tail.assign(half_taps, gr_complex(0.0, 0.0));
+        }
+}
+
+
+void half_band_resampler_cc::process_stage(uint32_t stage, const gr_complex *in, int num_in, gr_complex *out)
+{
+    const int num_out = num_in / 2;
+    const auto even_hist = static_cast<int>(2 * half_taps - 1);
+    const auto odd_hist = static_cast<int>(half_taps);
+    stage_state &state = d_state[stage];
+
+    // split the input into its two phases, prefixed with the tails of the
+    // previous call so every output sees a full filter window
+    d_even.resize(even_hist + num_out);
+    d_odd.resize(odd_hist + num_out);
+    std::copy(state.even_tail.begin(), state.even_tail.end(), d_even.begin());
+    std::copy(state.odd_tail.begin(), state.odd_tail.end(), d_odd.begin());
+    for (int i = 0; i < num_out; i++)
+        {
+            d_even[even_hist + i] = in[2 * i];
+            d_odd[odd_hist + i] = in[2 * i + 1];
+        }
+
+    // y[k] = (even phase) * (even taps) + 0.5 * (delayed odd sample); the
+    // compressed tap vector is symmetric, so no reversal is needed
+    for (int k = 0; k < num_out; k++)
+        {
+            gr_complex acc;
+            volk_32fc_32f_dot_prod_32fc(&acc, &d_even[k], d_taps.data(), 2 * half_taps);
+            out[k] = acc + 0.5F * d_odd[k];
+        }
+
+    std::copy(d_even.end() - even_hist, d_even.end(), state.even_tail.begin());
+    std::copy(d_odd.end() - odd_hist, d_odd.end(), state.odd_tail.begin());
+}
+
+
+template <uint32_t Stages>
+int half_band_resampler_cc::work_stages(int noutput_items, const gr_complex *in, gr_complex *out)
+{
+    const uint32_t nstages = (Stages != 0) ? Stages : d_stages;
+    int num_in = noutput_items * static_cast<int>(1U << nstages);
+
+    const gr_complex *stage_in = in;
+    for (uint32_t s = 0; s < nstages; s++)
+        {
+            gr_complex *stage_out = (s == nstages - 1) ? out : d_buf[s % 2].data();
+            process_stage(s, stage_in, num_in, stage_out);
+            num_in /= 2;
+            stage_in = stage_out;
+        }
+    return noutput_items;
+}
+
+
+int half_band_resampler_cc::work(int noutput_items,
+    gr_vector_const_void_star &input_items,
+    gr_vector_void_star &output_items)
+{
+    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
+    auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
+
+    // the first intermediate buffer holds half the input of the first stage
+    const auto max_intermediate = static_cast<size_t>(noutput_items) * (1U << (d_stages - 1));
+    if (d_stages > 1 && d_buf[0].size() < max_intermediate)
+        {
+            d_buf[0].resize(max_intermediate);
+            d_buf[1].resize(max_intermediate / 2);
+        }
+
+    switch (d_stages)
+        {
+        case 1:
+            return work_stages<1>(noutput_items, in, out);
+        case 2:
+            return work_stages<2>(noutput_items, in, out);
+        case 3:
+            return work_stages<3>(noutput_items, in, out);
+        case 4:
+            return work_stages<4>(noutput_items, in, out);
+        case max_specialized_stages:
+            return work_stages<max_specialized_stages>(noutput_items, in, out);
+        default:
+            return work_stages<0>(noutput_items, in, out);
+        }
+}
@@ -0,0 +1,100 @@
+/*!
+ * \file half_band_resampler_cc.h
+ *
+ * \brief Cascade of 2:1 half-band decimators with gr_complex input and
+ *        gr_complex output
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * Large power-of-two decimation ratios are implemented as a cascade of
+ * identical half-band stages. In a half-band filter every odd tap except the
+ * center one is exactly zero, so each stage only computes the even polyphase
+ * branch (one VOLK dot product per output) plus a scaled delayed sample,
+ * which needs far fewer multiplies than a single FIR with the same alias
+ * rejection at the full input rate.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_HALF_BAND_RESAMPLER_CC_H
+#define GNSS_SDR_HALF_BAND_RESAMPLER_CC_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/sync_decimator.h>
+#include <cstdint>
+#include <vector>
+
+/** \addtogroup Resampler
+ * \{ */
+/** \addtogroup Resampler_gnuradio_blocks
+ * \{ */
+
+
+class half_band_resampler_cc;
+
+using half_band_resampler_cc_sptr = gnss_shared_ptr<half_band_resampler_cc>;
+
+half_band_resampler_cc_sptr half_band_make_resampler_cc(uint32_t stages);
+
+/*!
+ * \brief This class implements a 2^stages : 1 decimator for complex data
+ * as a cascade of identical half-band filters
+ */
+class half_band_resampler_cc : public gr::sync_decimator
+{
+public:
+    ~half_band_resampler_cc() = default;
+
+    //! Number of cascaded 2:1 stages; the overall decimation is 2^stages
+    inline uint32_t stages() const
+    {
+        return d_stages;
+    }
+
+    int work(int noutput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    friend half_band_resampler_cc_sptr half_band_make_resampler_cc(uint32_t stages);
+
+    explicit half_band_resampler_cc(uint32_t stages);
+
+    //! number of non-zero even taps per stage (prototype length is 4 * half_taps - 1)
+    static constexpr uint32_t half_taps = 16;
+    //! deepest cascade with a dedicated template instantiation
+    static constexpr uint32_t max_specialized_stages = 5;
+
+    //! per-stage filter memory carried across work() calls
+    struct stage_state
+    {
+        std::vector<gr_complex> even_tail;  // last 2 * half_taps - 1 even-phase inputs
+        std::vector<gr_complex> odd_tail;   // last half_taps odd-phase inputs
+    };
+
+    void process_stage(uint32_t stage, const gr_complex *in, int num_in, gr_complex *out);
+
+    //! runs the cascade with a compile-time stage count (Stages == 0 falls
+    //! back to the runtime count) so the stage loop unrolls completely
+    template <uint32_t Stages>
+    int work_stages(int noutput_items, const gr_complex *in, gr_complex *out);
+
+    std::vector<float> d_taps;  // non-zero even taps, symmetric
+    std::vector<stage_state> d_state;
+    std::vector<gr_complex> d_even;     // deinterleave scratch, even phase + history
+    std::vector<gr_complex> d_odd;      // deinterleave scratch, odd phase + history
+    std::vector<gr_complex> d_buf[2];   // ping-pong buffers between stages
+    uint32_t d_stages;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_HALF_BAND_RESAMPLER_CC_H
@@ -0,0 +1,158 @@
+/*!
+ * \file polyphase_resampler_cc.cc
+ * \brief Polyphase FIR rational resampler with gr_complex input and
+ *        gr_complex output
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#include "polyphase_resampler_cc.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+//! closest rational approximation num/den of x with den <= max_denominator,
+//! by truncating the continued-fraction expansion
+void rational_approximation(double x, uint32_t max_denominator, uint32_t &num, uint32_t &den)
+{
+    uint64_t p0 = 0;
+    uint64_t q0 = 1;
+    uint64_t p1 = 1;
+    uint64_t q1 = 0;
+    double frac = x;
+    for (int i = 0; i < 64; i++)
+        {
+            const auto a = static_cast<uint64_t>(std::floor(frac));
+            const uint64_t p2 = a * p1 + p0;
+            const uint64_t q2 = a * q1 + q0;
+            if (q2 > max_denominator)
+                {
+                    break;
+                }
+            p0 = p1;
+            q0 = q1;
+            p1 = p2;
+            q1 = q2;
+            const double rem = frac - static_cast<double>(a);
+            if (rem < 1e-12)
+                {
+                    break;
+                }
+            frac = 1.0 / rem;
+        }
+    num = static_cast<uint32_t>(std::max(p1, uint64_t(1)));
+    den = static_cast<uint32_t>(std::max(q1, uint64_t(1)));
+}
+}  // namespace
+
+
+polyphase_resampler_cc_sptr polyphase_make_resampler_cc(
+    double sample_freq_in, double sample_freq_out)
+{
+    return polyphase_resampler_cc_sptr(
+        new polyphase_resampler_cc(sample_freq_in,
+            sample_freq_out));
+}
+
+
+polyphase_resampler_cc::polyphase_resampler_cc(
+    double sample_freq_in,
+    double sample_freq_out)
+    : gr::block("polyphase_resampler_cc",
+          gr::io_signature::make(1, 1, sizeof(gr_complex)),
+          gr::io_signature::make(1, 1, sizeof(gr_complex))),
+      d_arm(0)
+{
+    rational_approximation(sample_freq_out / sample_freq_in, 1024, d_interpolation, d_decimation);
+
+    // windowed-sinc prototype at the upsampled rate fs_in * L, cut at the
+    // narrower of the input and output Nyquist frequencies
+    const uint32_t L = d_interpolation;
+    const uint32_t M = d_decimation;
+    const size_t ntaps = static_cast<size_t>(taps_per_arm) * L;
+    const double cutoff = 0.5 / static_cast<double>(std::max(L, M));
+    const double center = static_cast<double>(ntaps - 1) / 2.0;
+    std::vector<double> prototype(ntaps);
+    double sum = 0.0;
+    for (size_t i = 0; i < ntaps; i++)
+        {
+            const double t = static_cast<double>(i) - center;
+            const double s = (t == 0.0) ? (2.0 * cutoff) : (std::sin(2.0 * M_PI * cutoff * t) / (M_PI * t));
+            const double w = 0.54 - 0.46 * std::cos(2.0 * M_PI * static_cast<double>(i) / static_cast<double>(ntaps - 1));  // Hamming
+            prototype[i] = s * w;
+            sum += prototype[i];
+        }
+    // unity DC gain after the interpolation by L
+    const double scale = static_cast<double>(L) / sum;
+
+    // arm l holds prototype taps l, l+L, l+2L, ... reversed, so each output
+    // is one dot product against an ascending window of input samples
+    d_arms.resize(L);
+    for (uint32_t l = 0; l < L; l++)
+        {
+            d_arms[l].resize(taps_per_arm);
+            for (uint32_t j = 0; j < taps_per_arm; j++)
+                {
+                    d_arms[l][j] = static_cast<float>(prototype[(taps_per_arm - 1 - j) * L + l] * scale);
+                }
+        }
+
+    set_history(taps_per_arm);
+#ifdef GR_GREATER_38
+    this->set_relative_rate(static_cast<uint64_t>(L), static_cast<uint64_t>(M));
+#else
+    this->set_relative_rate(static_cast<double>(L) / static_cast<double>(M));
+#endif
+}
+
+
+void polyphase_resampler_cc::forecast(int noutput_items,
+    gr_vector_int &ninput_items_required)
+{
+    const int nreqd = static_cast<int>((static_cast<uint64_t>(noutput_items) * d_decimation) / d_interpolation) + static_cast<int>(taps_per_arm) + 1;
+    for (auto &nreq : ninput_items_required)
+        {
+            nreq = nreqd;
+        }
+}
+
+
+int polyphase_resampler_cc::general_work(int noutput_items,
+    gr_vector_int &ninput_items, gr_vector_const_void_star &input_items,
+    gr_vector_void_star &output_items)
+{
+    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
+    auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
+
+    int produced = 0;
+    int pos = 0;
+    uint32_t arm = d_arm;
+
+    // with set_history(taps_per_arm), in[pos] is the oldest sample of the
+    // window that produces the current output
+    while (produced < noutput_items && pos + static_cast<int>(taps_per_arm) <= ninput_items[0])
+        {
+            volk_32fc_32f_dot_prod_32fc(&out[produced], &in[pos], d_arms[arm].data(), taps_per_arm);
+            produced++;
+            arm += d_decimation;
+            pos += static_cast<int>(arm / d_interpolation);
+            arm %= d_interpolation;
+        }
+
+    d_arm = arm;
+    consume_each(pos);
+    return produced;
+}
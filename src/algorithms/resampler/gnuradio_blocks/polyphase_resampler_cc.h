@@ -0,0 +1,96 @@
+/*!
+ * \file polyphase_resampler_cc.h
+ *
+ * \brief Polyphase FIR rational resampler with gr_complex input and
+ *        gr_complex output
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * This block resamples by a rational factor L/M with a windowed-sinc
+ * anti-alias prototype filter decomposed into L polyphase arms. Each output
+ * sample is a single VOLK dot product of one arm against the input window,
+ * so unlike the nearest-neighbour conditioner it rejects the aliases folded
+ * into the band by decimation.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_POLYPHASE_RESAMPLER_CC_H
+#define GNSS_SDR_POLYPHASE_RESAMPLER_CC_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/block.h>
+#include <cstdint>
+#include <vector>
+
+/** \addtogroup Resampler
+ * \{ */
+/** \addtogroup Resampler_gnuradio_blocks
+ * \{ */
+
+
+class polyphase_resampler_cc;
+
+using polyphase_resampler_cc_sptr = gnss_shared_ptr<polyphase_resampler_cc>;
+
+polyphase_resampler_cc_sptr polyphase_make_resampler_cc(
+    double sample_freq_in,
+    double sample_freq_out);
+
+/*!
+ * \brief This class implements a polyphase FIR resampler conditioner for
+ * complex data
+ *
+ * The resampling ratio is approximated by the closest rational L/M with a
+ * bounded denominator
+ */
+class polyphase_resampler_cc : public gr::block
+{
+public:
+    ~polyphase_resampler_cc() = default;
+
+    inline uint32_t interpolation() const
+    {
+        return d_interpolation;
+    }
+
+    inline uint32_t decimation() const
+    {
+        return d_decimation;
+    }
+
+    void forecast(int noutput_items, gr_vector_int &ninput_items_required);
+
+    int general_work(int noutput_items, gr_vector_int &ninput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    friend polyphase_resampler_cc_sptr polyphase_make_resampler_cc(
+        double sample_freq_in,
+        double sample_freq_out);
+
+    polyphase_resampler_cc(
+        double sample_freq_in,
+        double sample_freq_out);
+
+    //! taps of the prototype filter per polyphase arm
+    static constexpr uint32_t taps_per_arm = 16;
+
+    std::vector<std::vector<float>> d_arms;  // per-arm taps, reversed for dot products
+    uint32_t d_interpolation;                // L
+    uint32_t d_decimation;                   // M
+    uint32_t d_arm;                          // current polyphase arm
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_POLYPHASE_RESAMPLER_CC_H
@@ -69,6 +69,7 @@ Ad9361FpgaSignalSource::Ad9361FpgaSignalSource(const ConfigurationInterface *con
       Fstop_(configuration->property(role + ".Fstop", static_cast<float>(0.0))),
       num_freq_bands_(2),
       dma_buff_offset_pos_(0),
+      buffer_occ_watermark_(configuration->property(role + ".buffer_occupancy_watermark", 0)),
       scale_dds_dbfs_(configuration->property(role + ".scale_dds_dbfs", -3.0)),
       phase_dds_deg_(configuration->property(role + ".phase_dds_deg", 0.0)),
       tx_attenuation_db_(configuration->property(role + ".tx_attenuation_db", default_tx_attenuation_db)),
@@ -428,7 +429,7 @@ Ad9361FpgaSignalSource::Ad9361FpgaSignalSource(const ConfigurationInterface *con
                     return;
                 }
 
-            buffer_monitor_fpga = std::make_shared<Fpga_buffer_monitor>(device_io_name_buffer_monitor, num_freq_bands_, dump_, dump_filename);
+            buffer_monitor_fpga = std::make_shared<Fpga_buffer_monitor>(device_io_name_buffer_monitor, num_freq_bands_, dump_, dump_filename, buffer_occ_watermark_);
             thread_buffer_monitor = std::thread([&] { run_buffer_monitor_process(); });
         }
 
@@ -842,10 +843,13 @@ void Ad9361FpgaSignalSource::run_buffer_monitor_process()
 
     std::this_thread::sleep_for(std::chrono::milliseconds(buffer_monitoring_initial_delay_ms));
 
+    // poll faster when the occupancy feeds back into the acquisition scheduling
+    const uint32_t monitor_period_ms = (buffer_occ_watermark_ > 0) ? buffer_monitor_backpressure_period_ms : buffer_monitor_period_ms;
+
     while (enable_ovf_check_buffer_monitor_active)
         {
             buffer_monitor_fpga->check_buffer_overflow_and_monitor_buffer_status();
-            std::this_thread::sleep_for(std::chrono::milliseconds(buffer_monitor_period_ms));
+            std::this_thread::sleep_for(std::chrono::milliseconds(monitor_period_ms));
             std::unique_lock<std::mutex> lock(buffer_monitor_mutex);
             if (enable_ovf_check_buffer_monitor_active_ == false)
                 {
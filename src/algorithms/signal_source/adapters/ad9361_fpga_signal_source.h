@@ -86,6 +86,8 @@ private:
     const uint32_t Gain_control_period_ms = 500;
     // check buffer overflow and perform buffer monitoring every 1s by default
     const uint32_t buffer_monitor_period_ms = 1000;
+    // poll the buffer occupancy faster when acquisition backpressure is enabled
+    const uint32_t buffer_monitor_backpressure_period_ms = 50;
     // buffer overflow and buffer monitoring initial delay
     const uint32_t buffer_monitoring_initial_delay_ms = 2000;
     // sample block size when running in post-processing mode
@@ -140,6 +142,7 @@ private:
     float Fstop_;
     uint32_t num_freq_bands_;
     uint32_t dma_buff_offset_pos_;
+    uint32_t buffer_occ_watermark_;
 
     // DDS configuration for LO generation for external mixer
     double scale_dds_dbfs_;
@@ -56,6 +56,12 @@ CustomUDPSignalSource::CustomUDPSignalSource(const ConfigurationInterface* confi
     const std::string sample_type = configuration->property(role + ".sample_type", default_sample_type);
     item_type_ = configuration->property(role + ".item_type", default_item_type);
 
+    // batched reception reads the payloads directly from the bound UDP socket
+    // with recvmmsg instead of capturing frames with libpcap (Linux only);
+    // busy polling trades CPU for reception latency on the same socket
+    bool use_recvmmsg = configuration->property(role + ".enable_recvmmsg", false);
+    int busy_poll_us = configuration->property(role + ".busy_poll_us", 0);
+
     udp_gnss_rx_source_ = Gr_Complex_Ip_Packet_Source::make(capture_device,
         address,
         port,
@@ -63,7 +69,9 @@ CustomUDPSignalSource::CustomUDPSignalSource(const ConfigurationInterface* confi
         channels_in_udp_,
         sample_type,
         item_size_,
-        IQ_swap_);
+        IQ_swap_,
+        use_recvmmsg,
+        busy_poll_us);
 
     if (channels_in_udp_ >= RF_channels_)
         {
@@ -0,0 +1,62 @@
+/*!
+ * \file file_signal_source_lz4.h
+ * \brief Interface of a class that replays signal samples from a chunked
+ * LZ4-compressed capture file and adapts it to a SignalSourceInterface
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * This class behaves as File_Signal_Source, but reads captures recorded in
+ * the chunked LZ4 container (see lz4_capture_container.h), trading cheap
+ * decompression CPU for several times less disk bandwidth on replay.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_FILE_SIGNAL_SOURCE_LZ4_H
+#define GNSS_SDR_FILE_SIGNAL_SOURCE_LZ4_H
+
+#include "file_source_base.h"
+#include "lz4_file_source.h"
+#include <string>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_adapters
+ * \{ */
+
+
+class ConfigurationInterface;
+
+/*!
+ * \brief Class that replays signal samples from an LZ4-compressed capture
+ * file and adapts it to a SignalSourceInterface
+ */
+class FileSignalSourceLz4 : public FileSourceBase
+{
+public:
+    FileSignalSourceLz4(ConfigurationInterface const* configuration, std::string const& role,
+        unsigned int in_streams, unsigned int out_streams,
+        Concurrent_Queue<pmt::pmt_t>* queue);
+
+    ~FileSignalSourceLz4() = default;
+
+protected:
+    gnss_shared_ptr<gr::block> source() const override;
+    void create_file_source_hook() override;
+    size_t payloadBytes() const override;
+
+private:
+    Lz4FileSource::sptr lz4_source_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_FILE_SIGNAL_SOURCE_LZ4_H
@@ -0,0 +1,53 @@
+/*!
+ * \file file_signal_source_mmap.cc
+ * \brief Implementation of a class that reads signal samples from a
+ * memory-mapped file and adapts it to a SignalSourceInterface
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "file_signal_source_mmap.h"
+#include "gnss_sdr_string_literals.h"
+#include <glog/logging.h>
+
+using namespace std::string_literals;
+
+FileSignalSourceMmap::FileSignalSourceMmap(ConfigurationInterface const* configuration,
+    std::string const& role, unsigned int in_streams, unsigned int out_streams,
+    Concurrent_Queue<pmt::pmt_t>* queue)
+    : FileSourceBase(configuration, role, "File_Signal_Source_Mmap"s, queue, "short"s)
+{
+    if (in_streams > 0)
+        {
+            LOG(ERROR) << "A signal source does not have an input stream";
+        }
+    if (out_streams > 1)
+        {
+            LOG(ERROR) << "This implementation only supports one output stream";
+        }
+}
+
+
+void FileSignalSourceMmap::create_file_source_hook()
+{
+    // the gr file_source created by the base class has already validated the
+    // file; the actual streaming is done by the memory-mapped source instead,
+    // so the skipped samples become a byte offset into the mapping
+    mmap_source_ = MmapFileSource::make(filename(), item_size(), samplesToSkip() * item_size(), repeat());
+    DLOG(INFO) << "mmap_file_source(" << mmap_source_->unique_id() << ")";
+}
+
+
+gnss_shared_ptr<gr::block> FileSignalSourceMmap::source() const
+{
+    return mmap_source_;
+}
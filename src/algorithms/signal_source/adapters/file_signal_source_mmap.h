@@ -0,0 +1,61 @@
+/*!
+ * \file file_signal_source_mmap.h
+ * \brief Interface of a class that reads signal samples from a memory-mapped
+ * file and adapts it to a SignalSourceInterface
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * This class behaves as File_Signal_Source, but streams the samples from a
+ * memory mapping instead of read() calls, which removes the kernel-to-user
+ * copy and keeps the resident set bounded for very large recordings.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_FILE_SIGNAL_SOURCE_MMAP_H
+#define GNSS_SDR_FILE_SIGNAL_SOURCE_MMAP_H
+
+#include "file_source_base.h"
+#include "mmap_file_source.h"
+#include <string>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_adapters
+ * \{ */
+
+
+class ConfigurationInterface;
+
+/*!
+ * \brief Class that reads signal samples from a memory-mapped file
+ * and adapts it to a SignalSourceInterface
+ */
+class FileSignalSourceMmap : public FileSourceBase
+{
+public:
+    FileSignalSourceMmap(ConfigurationInterface const* configuration, std::string const& role,
+        unsigned int in_streams, unsigned int out_streams,
+        Concurrent_Queue<pmt::pmt_t>* queue);
+
+    ~FileSignalSourceMmap() = default;
+
+protected:
+    gnss_shared_ptr<gr::block> source() const override;
+    void create_file_source_hook() override;
+
+private:
+    MmapFileSource::sptr mmap_source_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_FILE_SIGNAL_SOURCE_MMAP_H
@@ -56,7 +56,9 @@ FileSourceBase::FileSourceBase(ConfigurationInterface const* configuration, std:
       is_complex_(false),
       repeat_(configuration->property(role_ + ".repeat"s, false)),
       enable_throttle_control_(configuration->property(role_ + ".enable_throttle_control"s, false)),
-      dump_(configuration->property(role_ + ".dump"s, false))
+      dump_(configuration->property(role_ + ".dump"s, false)),
+      dump_async_(configuration->property(role_ + ".dump_async"s, false)),
+      dump_async_queue_depth_(configuration->property(role_ + ".dump_async_queue_depth"s, 16))
 {
     minimum_tail_s_ = std::max(configuration->property("Acquisition_1C.coherent_integration_time_ms", 0.0) * 0.001 * 2.0, minimum_tail_s_);
     minimum_tail_s_ = std::max(configuration->property("Acquisition_2S.coherent_integration_time_ms", 0.0) * 0.001 * 2.0, minimum_tail_s_);
@@ -381,12 +383,18 @@ size_t FileSourceBase::samplesToSkip() const
 }
 
 
+size_t FileSourceBase::payloadBytes() const
+{
+    // this could throw, but the existence of the file has been proven before we get here.
+    return fs::file_size(filename());
+}
+
+
 size_t FileSourceBase::computeSamplesInFile() const
 {
     auto n_samples = static_cast<size_t>(samples());
 
-    // this could throw, but the existence of the file has been proven before we get here.
-    const auto size = fs::file_size(filename());
+    const auto size = payloadBytes();
 
     const auto to_skip = samplesToSkip();
 
@@ -462,7 +470,16 @@ gnss_shared_ptr<gr::block> FileSourceBase::source() const { return file_source()
 gnss_shared_ptr<gr::block> FileSourceBase::file_source() const { return file_source_; }
 gnss_shared_ptr<gr::block> FileSourceBase::valve() const { return valve_; }
 gnss_shared_ptr<gr::block> FileSourceBase::throttle() const { return throttle_; }
-gnss_shared_ptr<gr::block> FileSourceBase::sink() const { return sink_; }
+gnss_shared_ptr<gr::block> FileSourceBase::sink() const
+{
+#ifdef __linux__
+    if (uring_sink_)
+        {
+            return uring_sink_;
+        }
+#endif
+    return sink_;
+}
 
 
 gr::blocks::file_source::sptr FileSourceBase::create_file_source()
@@ -550,8 +567,31 @@ gr::blocks::file_sink::sptr FileSourceBase::create_sink()
 {
     if (dump_)
         {
-            sink_ = gr::blocks::file_sink::make(source_item_size(), dump_filename_.c_str());
-            DLOG(INFO) << "file_sink(" << sink_->unique_id() << ")";
+#ifdef __linux__
+            if (dump_async_)
+                {
+                    try
+                        {
+                            uring_sink_ = UringDumpSink::make(source_item_size(), dump_filename_, dump_async_queue_depth_);
+                            DLOG(INFO) << "uring_dump_sink(" << uring_sink_->unique_id() << ")";
+                        }
+                    catch (const std::exception& e)
+                        {
+                            LOG(WARNING) << "Cannot create the asynchronous dump sink (" << e.what()
+                                         << "); falling back to the standard file sink";
+                        }
+                }
+            if (!uring_sink_)
+#else
+            if (dump_async_)
+                {
+                    LOG(WARNING) << "The asynchronous dump sink is only available on Linux; using the standard file sink";
+                }
+#endif
+                {
+                    sink_ = gr::blocks::file_sink::make(source_item_size(), dump_filename_.c_str());
+                    DLOG(INFO) << "file_sink(" << sink_->unique_id() << ")";
+                }
 
             // enable subclass hooks
             create_sink_hook();
@@ -20,6 +20,9 @@
 
 #include "concurrent_queue.h"
 #include "signal_source_base.h"
+#ifdef __linux__
+#include "uring_dump_sink.h"  // for asynchronous dump
+#endif
 #include <gnuradio/blocks/file_sink.h>  // for dump
 #include <gnuradio/blocks/file_source.h>
 #include <gnuradio/blocks/throttle.h>
@@ -63,6 +66,12 @@ class ConfigurationInterface;
 //!   .dump     - whether to archive input data
 //!
 //!   .dump_filename - if dumping, path to file for output
+//!
+//!   .dump_async - if dumping, write through io_uring asynchronous I/O instead
+//!                 of the blocking file sink (default false; Linux only)
+//!
+//!   .dump_async_queue_depth - number of in-flight writes for the asynchronous
+//!                 dump (default 16)
 class FileSourceBase : public SignalSourceBase
 {
 public:
@@ -114,6 +123,10 @@ protected:
     //! Compute the number of samples to skip
     virtual size_t samplesToSkip() const;
 
+    //! The number of payload bytes in the file. Subclasses whose file format
+    //  is compressed or framed may override to report the raw stream size
+    virtual size_t payloadBytes() const;
+
     //! Compute the number of samples in the file
     size_t computeSamplesInFile() const;
 
@@ -155,6 +168,9 @@ private:
     gr::blocks::file_source::sptr file_source_;
     gr::blocks::throttle::sptr throttle_;
     gr::blocks::file_sink::sptr sink_;
+#ifdef __linux__
+    UringDumpSink::sptr uring_sink_;
+#endif
 
     // The valve allows only the configured number of samples through, then it closes.
 
@@ -179,6 +195,8 @@ private:
     bool repeat_;
     bool enable_throttle_control_;
     bool dump_;
+    bool dump_async_;
+    int dump_async_queue_depth_;
 };
 
 /** \} */
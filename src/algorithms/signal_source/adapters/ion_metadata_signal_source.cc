@@ -0,0 +1,295 @@
+/*!
+ * \file ion_metadata_signal_source.cc
+ * \brief Signal source driven by an ION GNSS Metadata Standard XML descriptor.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "ion_metadata_signal_source.h"
+#include "configuration_interface.h"
+#include "gnss_sdr_filesystem.h"
+#include "gnss_sdr_string_literals.h"
+#include "gnss_sdr_valve.h"
+#include "unpack_byte_2bit_cpx_samples.h"
+#include "unpack_byte_4bit_samples.h"
+#include <glog/logging.h>
+#include <gnuradio/blocks/interleaved_char_to_complex.h>
+#include <gnuradio/blocks/interleaved_short_to_complex.h>
+#include <pugixml.hpp>
+#include <algorithm>  // for transform
+#include <cctype>     // for toupper
+#include <cstring>    // for strchr
+#include <iostream>
+#include <stdexcept>
+
+using namespace std::string_literals;
+
+namespace
+{
+//! the descriptors qualify their element names with a schema prefix or not,
+//! depending on the producing tool; compare against the local name only
+std::string local_name(const pugi::xml_node &node)
+{
+    const char *name = node.name();
+    const char *colon = std::strchr(name, ':');
+    std::string result(colon != nullptr ? colon + 1 : name);
+    std::transform(result.begin(), result.end(), result.begin(), [](unsigned char c) { return std::tolower(c); });
+    return result;
+}
+
+
+void find_descendants(const pugi::xml_node &node, const std::string &name, std::vector<pugi::xml_node> &found)
+{
+    for (const auto &child : node.children())
+        {
+            if (local_name(child) == name)
+                {
+                    found.push_back(child);
+                }
+            find_descendants(child, name, found);
+        }
+}
+
+
+pugi::xml_node find_descendant(const pugi::xml_node &node, const std::string &name)
+{
+    std::vector<pugi::xml_node> found;
+    find_descendants(node, name, found);
+    return found.empty() ? pugi::xml_node() : found.front();
+}
+
+
+//! frequency elements carry a format attribute selecting the unit
+double frequency_hz(const pugi::xml_node &node)
+{
+    double scale = 1.0;
+    const std::string format = node.attribute("format").as_string("Hz");
+    if (format == "kHz")
+        {
+            scale = 1.0e3;
+        }
+    else if (format == "MHz")
+        {
+            scale = 1.0e6;
+        }
+    else if (format == "GHz")
+        {
+            scale = 1.0e9;
+        }
+    return node.text().as_double(0.0) * scale;
+}
+}  // namespace
+
+
+IonMetadataSignalSource::IonMetadataSignalSource(const ConfigurationInterface* configuration,
+    const std::string& role,
+    unsigned int in_stream,
+    unsigned int out_stream,
+    Concurrent_Queue<pmt::pmt_t>* queue)
+    : SignalSourceBase(configuration, role, "ION_Metadata_Signal_Source"s),
+      d_dump_filename(configuration->property(role + ".dump_filename", "data/ion_metadata_dump.dat"s)),
+      d_sampling_frequency(0.0),
+      d_samples(configuration->property(role + ".samples", uint64_t(0))),
+      d_dump(configuration->property(role + ".dump", false))
+{
+    const auto metadata_filename = configuration->property(role + ".metadata_filename", ""s);
+    if (metadata_filename.empty())
+        {
+            throw std::invalid_argument("ION_Metadata_Signal_Source: " + role + ".metadata_filename must be defined");
+        }
+
+    pugi::xml_document doc;
+    const pugi::xml_parse_result parsed = doc.load_file(metadata_filename.c_str());
+    if (!parsed)
+        {
+            throw std::invalid_argument("ION_Metadata_Signal_Source: cannot parse " + metadata_filename + ": " + parsed.description());
+        }
+    const pugi::xml_node metadata = doc.first_child();
+
+    // data file: the URL is resolved relative to the descriptor location
+    const pugi::xml_node file_node = find_descendant(metadata, "file");
+    const pugi::xml_node url_node = find_descendant(file_node, "url");
+    if (!url_node)
+        {
+            throw std::invalid_argument("ION_Metadata_Signal_Source: no file/url element in " + metadata_filename);
+        }
+    fs::path data_path(url_node.text().as_string());
+    if (data_path.is_relative())
+        {
+            data_path = fs::path(metadata_filename).parent_path() / data_path;
+        }
+    d_data_filename = data_path.string();
+
+    // stream definitions (references carry an idref attribute instead of a
+    // quantization; only definitions describe the sample layout)
+    std::vector<pugi::xml_node> streams;
+    find_descendants(metadata, "stream", streams);
+    std::vector<pugi::xml_node> stream_defs;
+    for (const auto &stream : streams)
+        {
+            if (find_descendant(stream, "quantization"))
+                {
+                    stream_defs.push_back(stream);
+                }
+        }
+    if (stream_defs.empty())
+        {
+            throw std::invalid_argument("ION_Metadata_Signal_Source: no stream definition in " + metadata_filename);
+        }
+    if (stream_defs.size() > 1)
+        {
+            throw std::invalid_argument("ION_Metadata_Signal_Source: " + metadata_filename +
+                                        " describes " + std::to_string(stream_defs.size()) +
+                                        " streams; only single-stream lanes are supported");
+        }
+    const pugi::xml_node stream = stream_defs.front();
+
+    const int quantization = find_descendant(stream, "quantization").text().as_int(0);
+    std::string format = find_descendant(stream, "format").text().as_string("IQ");
+    std::transform(format.begin(), format.end(), format.begin(), [](unsigned char c) { return std::toupper(c); });
+    const std::string encoding = find_descendant(stream, "encoding").text().as_string("sign");
+    const double ratefactor = find_descendant(stream, "ratefactor").text().as_double(1.0);
+
+    const pugi::xml_node freqbase_node = find_descendant(metadata, "freqbase");
+    if (freqbase_node)
+        {
+            d_sampling_frequency = frequency_hz(freqbase_node) * ratefactor;
+        }
+
+    bool reverse_interleaving = false;
+    if (format == "QI")
+        {
+            reverse_interleaving = true;
+        }
+    else if (format != "IQ")
+        {
+            throw std::invalid_argument("ION_Metadata_Signal_Source: stream format " + format +
+                                        " is not supported (only interleaved complex IQ/QI)");
+        }
+
+    // build the unpack chain matching the described layout, reusing the same
+    // blocks the dedicated per-format adapters instantiate
+    switch (quantization)
+        {
+        case 2:
+            d_file_source = gr::blocks::file_source::make(sizeof(char), d_data_filename.c_str(), false);
+            d_chain.push_back(make_unpack_byte_2bit_cpx_samples());
+            d_chain.push_back(gr::blocks::interleaved_short_to_complex::make(false, reverse_interleaving));
+            break;
+        case 4:
+            d_file_source = gr::blocks::file_source::make(sizeof(char), d_data_filename.c_str(), false);
+            d_chain.push_back(make_unpack_byte_4bit_samples());
+            d_chain.push_back(gr::blocks::interleaved_short_to_complex::make(false, reverse_interleaving));
+            break;
+        case 8:
+            if (reverse_interleaving)
+                {
+                    throw std::invalid_argument("ION_Metadata_Signal_Source: QI interleaving is not supported for 8-bit streams");
+                }
+            d_file_source = gr::blocks::file_source::make(sizeof(char), d_data_filename.c_str(), false);
+            d_chain.push_back(gr::blocks::interleaved_char_to_complex::make());
+            break;
+        case 16:
+            d_file_source = gr::blocks::file_source::make(sizeof(int16_t), d_data_filename.c_str(), false);
+            d_chain.push_back(gr::blocks::interleaved_short_to_complex::make(false, reverse_interleaving));
+            break;
+        default:
+            throw std::invalid_argument("ION_Metadata_Signal_Source: " + std::to_string(quantization) +
+                                        "-bit quantization is not supported (only 2, 4, 8 or 16)");
+        }
+
+    if (d_samples > 0)
+        {
+            d_valve = gnss_sdr_make_valve(sizeof(gr_complex), d_samples, queue);
+        }
+
+    std::cout << "ION metadata: " << metadata_filename << " -> " << d_data_filename
+              << " (" << quantization << "-bit " << format << ", encoding " << encoding;
+    if (d_sampling_frequency > 0.0)
+        {
+            std::cout << ", " << d_sampling_frequency << " sps";
+        }
+    std::cout << ")\n";
+    LOG(INFO) << "ION metadata descriptor " << metadata_filename << " selects " << d_data_filename
+              << ": quantization=" << quantization << " format=" << format
+              << " encoding=" << encoding << " fs=" << d_sampling_frequency;
+    const auto fs_in = configuration->property("GNSS-SDR.internal_fs_sps", static_cast<int64_t>(0));
+    if (d_sampling_frequency > 0.0 and fs_in > 0 and static_cast<double>(fs_in) != d_sampling_frequency)
+        {
+            std::cerr << "Warning: the ION descriptor declares " << d_sampling_frequency
+                      << " sps but GNSS-SDR.internal_fs_sps is " << fs_in << "\n";
+        }
+
+    if (in_stream > 0)
+        {
+            LOG(ERROR) << "A signal source does not have an input stream";
+        }
+    if (out_stream > 1)
+        {
+            LOG(ERROR) << "This implementation only supports one output stream";
+        }
+}
+
+
+size_t IonMetadataSignalSource::item_size() { return sizeof(gr_complex); }
+
+
+auto IonMetadataSignalSource::connect(gr::top_block_sptr top_block) -> void
+{
+    gr::basic_block_sptr previous = d_file_source;
+    for (const auto& block : d_chain)
+        {
+            top_block->connect(previous, 0, block, 0);
+            previous = block;
+        }
+    if (d_valve)
+        {
+            top_block->connect(previous, 0, d_valve, 0);
+        }
+    if (d_dump)
+        {
+            d_dump_sink = gr::blocks::file_sink::make(item_size(), d_dump_filename.data());
+            top_block->connect(get_right_block(), 0, d_dump_sink, 0);
+        }
+}
+
+
+auto IonMetadataSignalSource::disconnect(gr::top_block_sptr top_block) -> void
+{
+    if (d_dump)
+        {
+            top_block->disconnect(d_dump_sink);
+        }
+    if (d_valve)
+        {
+            top_block->disconnect(d_valve);
+        }
+    for (const auto& block : d_chain)
+        {
+            top_block->disconnect(block);
+        }
+    top_block->disconnect(d_file_source);
+}
+
+
+auto IonMetadataSignalSource::get_right_block() -> gr::basic_block_sptr
+{
+    if (d_valve)
+        {
+            return d_valve;
+        }
+    if (!d_chain.empty())
+        {
+            return d_chain.back();
+        }
+    return d_file_source;
+}
@@ -68,10 +68,14 @@ LabsatSignalSource::LabsatSignalSource(const ConfigurationInterface* configurati
 
     const bool digital_io_enabled = configuration->property(role + ".digital_io_enabled", false);
 
+    // LS3W files only: number of worker threads unpacking registers in
+    // parallel with the file reads (0: auto, 1: single-threaded decoding)
+    const int ls3w_decoder_threads = configuration->property(role + ".ls3w_decoder_threads", 0);
+
     if (item_type_ == "gr_complex")
         {
             item_size_ = sizeof(gr_complex);
-            labsat23_source_ = labsat23_make_source_sptr(filename_.c_str(), channels_selector_vec_, queue, digital_io_enabled);
+            labsat23_source_ = labsat23_make_source_sptr(filename_.c_str(), channels_selector_vec_, queue, digital_io_enabled, ls3w_decoder_threads);
             DLOG(INFO) << "Item size " << item_size_;
             DLOG(INFO) << "labsat23_source_(" << labsat23_source_->unique_id() << ")";
         }
@@ -0,0 +1,70 @@
+/*!
+ * \file multicast_signal_source.cc
+ * \brief Signal source which reads from the UDP multicast sample transport.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "multicast_signal_source.h"
+#include "configuration_interface.h"
+#include "gnss_sdr_string_literals.h"
+#include <glog/logging.h>
+#include <cstdint>
+
+using namespace std::string_literals;
+
+MulticastSignalSource::MulticastSignalSource(const ConfigurationInterface* configuration,
+    const std::string& role,
+    unsigned int /* in_stream [[maybe_unused]] */,
+    unsigned int /* out_stream [[maybe_unused]] */,
+    Concurrent_Queue<pmt::pmt_t>* /* queue [[maybe_unused]] */)
+    : SignalSourceBase(configuration, role, "Multicast_Signal_Source"s),
+      d_item_size(decode_item_type(configuration->property(role + ".item_type", "gr_complex"s), nullptr, true)),
+      d_dump_filename(configuration->property(role + ".dump_filename", "data/multicast_dump.dat"s)),
+      d_dump(configuration->property(role + ".dump", false))
+{
+    const auto address = configuration->property(role + ".address"s, "239.255.0.1"s);
+    const auto port = configuration->property(role + ".port"s, 21234);
+    const auto reorder_depth = configuration->property(role + ".reorder_depth"s, 32);
+
+    LOG(INFO) << "Subscribing to multicast sample stream at " << address << ":" << port;
+    d_source_block = UdpMulticastSource::make(d_item_size, address, static_cast<uint16_t>(port), reorder_depth);
+}
+
+
+size_t MulticastSignalSource::item_size() { return d_item_size; }
+
+
+auto MulticastSignalSource::connect(gr::top_block_sptr top_block) -> void
+{
+    if (d_dump)
+        {
+            d_dump_sink = gr::blocks::file_sink::make(item_size(), d_dump_filename.data());
+            top_block->connect(get_right_block(), 0, d_dump_sink, 0);
+        }
+}
+
+
+auto MulticastSignalSource::disconnect(gr::top_block_sptr top_block) -> void
+{
+    if (d_dump)
+        {
+            top_block->disconnect(d_dump_sink);
+        }
+    top_block->disconnect(d_source_block);
+}
+
+
+auto MulticastSignalSource::get_right_block() -> gr::basic_block_sptr
+{
+    return d_source_block;
+}
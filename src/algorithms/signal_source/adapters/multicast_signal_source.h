@@ -0,0 +1,80 @@
+/*!
+ * \file multicast_signal_source.h
+ * \brief Signal source which reads from the UDP multicast sample transport.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_MULTICAST_SIGNAL_SOURCE_H
+#define GNSS_SDR_MULTICAST_SIGNAL_SOURCE_H
+
+#include "signal_source_base.h"
+//
+#include "concurrent_queue.h"
+#include "udp_multicast_source.h"
+#include <gnuradio/blocks/file_sink.h>  // for dump
+#include <pmt/pmt.h>
+#include <cstddef>
+#include <string>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_adapters
+ * \{ */
+
+//! This class supports the following properties:
+//!
+//!   .address       - the multicast group published by the capture node
+//!                    (default 239.255.0.1)
+//!   .port          - the UDP port of the transport (default 21234)
+//!   .reorder_depth - how many newer chunks may arrive before a missing one
+//!                    is declared lost and FEC recovery is attempted
+//!                    (default 32)
+//!
+//!   .item_type - data type of the samples (default "gr_complex"); it must
+//!                match the item type of the publishing flowgraph
+//!
+//!   .dump          - whether to archive input data
+//!   .dump_filename - if dumping, path to file for output
+//!
+//! The matching capture-side publisher is enabled on any configuration with
+//! the GNSS-SDR.multicast_relay_address / multicast_relay_port options.
+
+class MulticastSignalSource : public SignalSourceBase
+{
+public:
+    MulticastSignalSource(const ConfigurationInterface* configuration,
+        const std::string& role,
+        unsigned int in_stream,
+        unsigned int out_stream,
+        Concurrent_Queue<pmt::pmt_t>* queue);
+
+    ~MulticastSignalSource() = default;
+
+    size_t item_size() override;
+
+    auto connect(gr::top_block_sptr top_block) -> void override;
+    auto disconnect(gr::top_block_sptr top_block) -> void override;
+    auto get_right_block() -> gr::basic_block_sptr override;
+
+private:
+    UdpMulticastSource::sptr d_source_block;
+    gr::blocks::file_sink::sptr d_dump_sink;
+
+    size_t d_item_size;
+    std::string d_dump_filename;
+    bool d_dump;
+};
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_MULTICAST_SIGNAL_SOURCE_H
@@ -24,12 +24,21 @@
 #include <glog/logging.h>
 #include <uhd/exception.hpp>
 #include <uhd/types/device_addr.hpp>
+#include <uhd/types/time_spec.hpp>
 #include <volk/volk.h>
+#include <chrono>
 #include <iostream>
+#include <thread>
 #include <utility>
 
 using namespace std::string_literals;
 
+namespace
+{
+// seconds between the UNIX epoch (1970-01-01) and the GPS epoch (1980-01-06)
+constexpr int64_t UNIX_TO_GPS_EPOCH_OFFSET_S = 315964800LL;
+}  // namespace
+
 
 UhdSignalSource::UhdSignalSource(const ConfigurationInterface* configuration,
     const std::string& role, unsigned int in_stream, unsigned int out_stream,
@@ -64,6 +73,7 @@ UhdSignalSource::UhdSignalSource(const ConfigurationInterface* configuration,
     RF_channels_ = configuration->property(role + ".RF_channels", 1);
     sample_rate_ = configuration->property(role + ".sampling_frequency", 4.0e6);
     item_type_ = configuration->property(role + ".item_type", default_item_type);
+    hw_time_tags_ = configuration->property(role + ".hw_time_tags", false);
 
     // UHD TRANSPORT PARAMETERS
     // option to manually set device "num_recv_frames"
@@ -219,6 +229,39 @@ UhdSignalSource::UhdSignalSource(const ConfigurationInterface* configuration,
     std::cout << "Sampling Rate for the USRP device: " << uhd_source_->get_samp_rate() << " [sps]...\n";
     LOG(INFO) << "Sampling Rate for the USRP device: " << uhd_source_->get_samp_rate() << " [sps]...";
 
+    // 2.3 align the device clock with GPS time, so the rx_time tags attached
+    // by the driver to the sample stream (at stream start and after every
+    // overflow) carry an absolute timescale
+    if (hw_time_tags_)
+        {
+            const double utc_to_gps_s = configuration->property(role + ".utc_to_gps_offset_s", 18.0);
+            std::vector<std::string> mboard_sensors = uhd_source_->get_mboard_sensor_names(0);
+            bool gpsdo_locked = false;
+            if (std::find(mboard_sensors.begin(), mboard_sensors.end(), "gps_locked") != mboard_sensors.end())
+                {
+                    gpsdo_locked = uhd_source_->get_mboard_sensor("gps_locked", 0).to_bool();
+                }
+            if (gpsdo_locked and std::find(mboard_sensors.begin(), mboard_sensors.end(), "gps_time") != mboard_sensors.end())
+                {
+                    // latch GPS seconds into the device clock at the next PPS edge
+                    const int64_t gps_seconds = uhd_source_->get_mboard_sensor("gps_time", 0).to_int() - UNIX_TO_GPS_EPOCH_OFFSET_S + static_cast<int64_t>(utc_to_gps_s);
+                    uhd_source_->set_time_next_pps(uhd::time_spec_t(static_cast<double>(gps_seconds + 1)));
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+                    std::cout << "UHD device clock aligned with the GPSDO time\n";
+                    LOG(INFO) << "UHD device clock set to " << gps_seconds + 1 << " GPS seconds at the PPS edge";
+                }
+            else
+                {
+                    // no disciplined oscillator available: seed the device clock
+                    // from the host clock. The absolute accuracy is at the ms
+                    // level, still useful to validate the receiver time model
+                    const double unix_s = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+                    uhd_source_->set_time_now(uhd::time_spec_t(unix_s - static_cast<double>(UNIX_TO_GPS_EPOCH_OFFSET_S) + utc_to_gps_s));
+                    std::cout << "No GPSDO lock found: UHD device clock seeded from the host clock\n";
+                    LOG(WARNING) << "hw_time_tags enabled without a locked GPSDO: device clock seeded from the host clock";
+                }
+        }
+
     std::vector<std::string> sensor_names;
 
     for (int i = 0; i < RF_channels_; i++)
@@ -268,6 +311,13 @@ UhdSignalSource::UhdSignalSource(const ConfigurationInterface* configuration,
 
     for (int i = 0; i < RF_channels_; i++)
         {
+            if (hw_time_tags_)
+                {
+                    // the device clock already holds GPS seconds, no extra offset
+                    rx_time_tags_.emplace_back(gnss_sdr_make_rx_time_tags(item_size_, 0.0));
+                    DLOG(INFO) << "rx_time_tags(" << rx_time_tags_.at(i)->unique_id() << ")";
+                }
+
             if (samples_.at(i) != 0ULL)
                 {
                     LOG(INFO) << "RF_channel " << i << " Send STOP signal after " << samples_.at(i) << " samples";
@@ -297,9 +347,18 @@ void UhdSignalSource::connect(gr::top_block_sptr top_block)
 {
     for (int i = 0; i < RF_channels_; i++)
         {
+            gr::basic_block_sptr source_block = uhd_source_;
+            int source_port = i;
+            if (hw_time_tags_)
+                {
+                    top_block->connect(uhd_source_, i, rx_time_tags_.at(i), 0);
+                    DLOG(INFO) << "connected usrp source to rx_time tags block RF Channel " << i;
+                    source_block = rx_time_tags_.at(i);
+                    source_port = 0;
+                }
             if (samples_.at(i) != 0ULL)
                 {
-                    top_block->connect(uhd_source_, i, valve_.at(i), 0);
+                    top_block->connect(source_block, source_port, valve_.at(i), 0);
                     DLOG(INFO) << "connected usrp source to valve RF Channel " << i;
                     if (dump_.at(i))
                         {
@@ -311,7 +370,7 @@ void UhdSignalSource::connect(gr::top_block_sptr top_block)
                 {
                     if (dump_.at(i))
                         {
-                            top_block->connect(uhd_source_, i, file_sink_.at(i), 0);
+                            top_block->connect(source_block, source_port, file_sink_.at(i), 0);
                             DLOG(INFO) << "connected usrp source to file sink RF Channel " << i;
                         }
                 }
@@ -324,9 +383,17 @@ void UhdSignalSource::disconnect(gr::top_block_sptr top_block)
     uhd_source_->stop();
     for (int i = 0; i < RF_channels_; i++)
         {
+            gr::basic_block_sptr source_block = uhd_source_;
+            int source_port = i;
+            if (hw_time_tags_)
+                {
+                    top_block->disconnect(uhd_source_, i, rx_time_tags_.at(i), 0);
+                    source_block = rx_time_tags_.at(i);
+                    source_port = 0;
+                }
             if (samples_.at(i) != 0ULL)
                 {
-                    top_block->disconnect(uhd_source_, i, valve_.at(i), 0);
+                    top_block->disconnect(source_block, source_port, valve_.at(i), 0);
                     LOG(INFO) << "UHD source disconnected";
                     if (dump_.at(i))
                         {
@@ -337,7 +404,7 @@ void UhdSignalSource::disconnect(gr::top_block_sptr top_block)
                 {
                     if (dump_.at(i))
                         {
-                            top_block->disconnect(uhd_source_, i, file_sink_.at(i), 0);
+                            top_block->disconnect(source_block, source_port, file_sink_.at(i), 0);
                         }
                 }
         }
@@ -365,5 +432,9 @@ gr::basic_block_sptr UhdSignalSource::get_right_block(int RF_channel)
         {
             return valve_.at(RF_channel);
         }
+    if (hw_time_tags_)
+        {
+            return rx_time_tags_.at(RF_channel);
+        }
     return uhd_source_;
 }
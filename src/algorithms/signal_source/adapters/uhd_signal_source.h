@@ -18,6 +18,7 @@
 #define GNSS_SDR_UHD_SIGNAL_SOURCE_H
 
 #include "concurrent_queue.h"
+#include "gnss_sdr_rx_time_tags.h"
 #include "signal_source_base.h"
 #include <gnuradio/blocks/file_sink.h>
 #include <gnuradio/hier_block2.h>
@@ -62,6 +63,7 @@ private:
     gr::uhd::usrp_source::sptr uhd_source_;
 
     std::vector<gnss_shared_ptr<gr::block>> valve_;
+    std::vector<gnss_shared_ptr<Gnss_Sdr_Rx_Time_Tags>> rx_time_tags_;
     std::vector<gr::blocks::file_sink::sptr> file_sink_;
     std::vector<double> freq_;
     std::vector<double> gain_;
@@ -89,6 +91,9 @@ private:
     int RF_channels_;
     unsigned int in_stream_;
     unsigned int out_stream_;
+    // translate the USRP hardware rx_time tags into GnssTime timetags, after
+    // aligning the device clock with GPS time (GPSDO or host clock)
+    bool hw_time_tags_;
 };
 
 
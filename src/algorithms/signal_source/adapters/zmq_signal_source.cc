@@ -35,6 +35,8 @@ ZmqSignalSource::ZmqSignalSource(const ConfigurationInterface* configuration,
     auto pass_tags = configuration->property(role + ".pass_tags"s, false);
     auto timeout_ms = configuration->property(role + ".timeout_ms"s, 100);
     auto hwm = configuration->property(role + ".hwm"s, -1);
+    auto zero_copy = configuration->property(role + ".zero_copy"s, false);
+    auto io_threads = configuration->property(role + ".io_threads"s, 1);
 
     auto property = role + ".endpoint"s;
     auto endpoint = configuration->property(property, ""s);
@@ -42,18 +44,28 @@ ZmqSignalSource::ZmqSignalSource(const ConfigurationInterface* configuration,
     if (!endpoint.empty())
         {
             LOG(INFO) << "Connecting to ZMQ pub at " << endpoint;
-            // work around gnuradio interface const-deficiency
-            d_source_block = gr::zeromq::sub_source::make(d_item_size, vlen, const_cast<char*>(endpoint.data()), timeout_ms, pass_tags, hwm);
-
-            // work around another bug. GNU Radio passes tags through the ZMQ block
-            // unconditionally if pass_tags is true, but that flag controls protocol more
-            // than the intent of the block. Since we have the vector-to-stream block,
-            // unconditionally create it, and have it squelch the tags. GNSS-SDR should
-            // not fail if unexpected tags are received
-
-            // vector-to-stream should be coherent even if vlen == 1
-            d_vec_block = gr::blocks::vector_to_stream::make(item_size(), vlen);
-            d_vec_block->set_tag_propagation_policy(gr::block::TPP_DONT);  // GNSS-SDR doesn't do well with tags/
+            if (zero_copy)
+                {
+                    // hold each received message reference-counted and copy it
+                    // once, straight into the output buffer; no internal ring
+                    // and no vector-to-stream pass (the block emits no tags)
+                    d_msg_block = ZmqMsgSource::make(d_item_size, endpoint, timeout_ms, hwm, io_threads);
+                }
+            else
+                {
+                    // work around gnuradio interface const-deficiency
+                    d_source_block = gr::zeromq::sub_source::make(d_item_size, vlen, const_cast<char*>(endpoint.data()), timeout_ms, pass_tags, hwm);
+
+                    // work around another bug. GNU Radio passes tags through the ZMQ block
+                    // unconditionally if pass_tags is true, but that flag controls protocol more
+                    // than the intent of the block. Since we have the vector-to-stream block,
+                    // unconditionally create it, and have it squelch the tags. GNSS-SDR should
+                    // not fail if unexpected tags are received
+
+                    // vector-to-stream should be coherent even if vlen == 1
+                    d_vec_block = gr::blocks::vector_to_stream::make(item_size(), vlen);
+                    d_vec_block->set_tag_propagation_policy(gr::block::TPP_DONT);  // GNSS-SDR doesn't do well with tags/
+                }
         }
     else
         {
@@ -74,7 +86,10 @@ auto ZmqSignalSource::connect(gr::top_block_sptr top_block) -> void
             top_block->connect(get_right_block(), 0, d_dump_sink, 0);
         }
 
-    top_block->connect(d_source_block, 0, d_vec_block, 0);
+    if (!d_msg_block)
+        {
+            top_block->connect(d_source_block, 0, d_vec_block, 0);
+        }
 }
 
 
@@ -85,13 +100,24 @@ auto ZmqSignalSource::disconnect(gr::top_block_sptr top_block) -> void
             top_block->disconnect(d_dump_sink);
         }
 
-    // this might be redundant
-    top_block->disconnect(d_vec_block);
-    top_block->disconnect(d_source_block);
+    if (d_msg_block)
+        {
+            top_block->disconnect(d_msg_block);
+        }
+    else
+        {
+            // this might be redundant
+            top_block->disconnect(d_vec_block);
+            top_block->disconnect(d_source_block);
+        }
 }
 
 
 auto ZmqSignalSource::get_right_block() -> gr::basic_block_sptr
 {
+    if (d_msg_block)
+        {
+            return d_msg_block;
+        }
     return d_vec_block;
 }
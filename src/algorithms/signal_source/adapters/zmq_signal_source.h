@@ -20,6 +20,7 @@
 #include "signal_source_base.h"
 //
 #include "concurrent_queue.h"
+#include "zmq_msg_source.h"
 #include <gnuradio/blocks/file_sink.h>  // for dump
 #include <gnuradio/blocks/vector_to_stream.h>
 #include <gnuradio/zeromq/sub_source.h>
@@ -39,6 +40,10 @@
 //!   .pass_tags  - boolean flag if tags should be propagated (default false)
 //!   .timeout_ms - receive timeout, in milliseconds (default 100)
 //!   .hwm        - ZMQ high water mark (default -1, ZMQ default)
+//!   .zero_copy  - if true, bypass gr::zeromq::sub_source and read the
+//!                 subscription with a single-copy zmq_msg based source
+//!                 (default false); .vlen and .pass_tags do not apply
+//!   .io_threads - number of ZeroMQ I/O threads in zero_copy mode (default 1)
 //!
 //!   .item_type - data type of the samples (default "gr_complex")
 //!
@@ -68,6 +73,7 @@ public:
 private:
     gr::zeromq::sub_source::sptr d_source_block;
     gr::blocks::vector_to_stream::sptr d_vec_block;
+    ZmqMsgSource::sptr d_msg_block;
     gr::blocks::file_sink::sptr d_dump_sink;
 
     size_t d_item_size;
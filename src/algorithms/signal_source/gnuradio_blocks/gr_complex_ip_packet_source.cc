@@ -20,9 +20,13 @@
 #include "gr_complex_ip_packet_source.h"
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
+#include <sys/socket.h>
 #include <array>
+#include <cerrno>
 #include <cstdint>
+#include <cstring>
 #include <utility>
+#include <vector>
 #if HAS_GENERIC_LAMBDA
 #else
 #include <boost/bind/bind.hpp>
@@ -81,7 +85,9 @@ Gr_Complex_Ip_Packet_Source::make(std::string src_device,
     int n_baseband_channels,
     const std::string &wire_sample_type,
     size_t item_size,
-    bool IQ_swap_)
+    bool IQ_swap_,
+    bool use_recvmmsg,
+    int busy_poll_us)
 {
     return gnuradio::get_initial_sptr(new Gr_Complex_Ip_Packet_Source(std::move(src_device),
         origin_address,
@@ -90,7 +96,9 @@ Gr_Complex_Ip_Packet_Source::make(std::string src_device,
         n_baseband_channels,
         wire_sample_type,
         item_size,
-        IQ_swap_));
+        IQ_swap_,
+        use_recvmmsg,
+        busy_poll_us));
 }
 
 
@@ -104,7 +112,9 @@ Gr_Complex_Ip_Packet_Source::Gr_Complex_Ip_Packet_Source(std::string src_device,
     int n_baseband_channels,
     const std::string &wire_sample_type,
     size_t item_size,
-    bool IQ_swap_)
+    bool IQ_swap_,
+    bool use_recvmmsg,
+    int busy_poll_us)
     : gr::sync_block("gr_complex_ip_packet_source",
           gr::io_signature::make(0, 0, 0),
           gr::io_signature::make(1, 4, item_size)),  // 1 to 4 baseband complex channels
@@ -115,11 +125,22 @@ Gr_Complex_Ip_Packet_Source::Gr_Complex_Ip_Packet_Source(std::string src_device,
       fifo_read_ptr(0),
       fifo_write_ptr(0),
       fifo_items(0),
+      d_dropped_packets(0),
+      d_capture_active(false),
       d_sock_raw(0),
       d_udp_port(udp_port),
       d_n_baseband_channels(n_baseband_channels),
-      d_IQ_swap(IQ_swap_)
+      d_busy_poll_us(busy_poll_us),
+      d_IQ_swap(IQ_swap_),
+      d_use_recvmmsg(use_recvmmsg)
 {
+#ifndef __linux__
+    if (d_use_recvmmsg)
+        {
+            std::cout << "Batched UDP reception is only available on Linux, using libpcap capture\n";
+            d_use_recvmmsg = false;
+        }
+#endif
     memset(reinterpret_cast<char *>(&si_me), 0, sizeof(si_me));
     if (wire_sample_type == "cbyte")
         {
@@ -164,13 +185,27 @@ bool Gr_Complex_Ip_Packet_Source::start()
     // open the ethernet device
     if (open() == true)
         {
-            // start pcap capture thread
-            d_pcap_thread = new boost::thread(
+            d_capture_active = true;
+            if (d_use_recvmmsg)
+                {
+                    // start batched UDP reception thread
+                    d_pcap_thread = new boost::thread(
+#if HAS_GENERIC_LAMBDA
+                        [this] { my_recvmmsg_loop_thread(); });
+#else
+                        boost::bind(&Gr_Complex_Ip_Packet_Source::my_recvmmsg_loop_thread, this));
+#endif
+                }
+            else
+                {
+                    // start pcap capture thread
+                    d_pcap_thread = new boost::thread(
 #if HAS_GENERIC_LAMBDA
-                [this] { my_pcap_loop_thread(descr); });
+                        [this] { my_pcap_loop_thread(descr); });
 #else
-                boost::bind(&Gr_Complex_Ip_Packet_Source::my_pcap_loop_thread, this, descr));
+                        boost::bind(&Gr_Complex_Ip_Packet_Source::my_pcap_loop_thread, this, descr));
 #endif
+                }
             return true;
         }
     return false;
@@ -181,12 +216,29 @@ bool Gr_Complex_Ip_Packet_Source::start()
 bool Gr_Complex_Ip_Packet_Source::stop()
 {
     std::cout << "gr_complex_ip_packet_source STOP\n";
-    if (descr != nullptr)
+    d_capture_active = false;
+    if (d_use_recvmmsg)
+        {
+            if (d_pcap_thread != nullptr)
+                {
+                    d_pcap_thread->join();
+                }
+            if (d_sock_raw > 0)
+                {
+                    close(d_sock_raw);
+                    d_sock_raw = 0;
+                }
+        }
+    else if (descr != nullptr)
         {
             pcap_breakloop(descr);
             d_pcap_thread->join();
             pcap_close(descr);
         }
+    if (dropped_packets() > 0)
+        {
+            std::cout << "Total UDP packets dropped on buffer overrun: " << dropped_packets() << '\n';
+        }
     return true;
 }
 
@@ -194,17 +246,20 @@ bool Gr_Complex_Ip_Packet_Source::stop()
 bool Gr_Complex_Ip_Packet_Source::open()
 {
     std::array<char, PCAP_ERRBUF_SIZE> errbuf{};
-    // boost::mutex::scoped_lock lock(d_mutex);  // hold mutex for duration of this function
     gr::thread::scoped_lock guard(d_setlock);
-    // open device for reading
-    descr = pcap_open_live(d_src_device.c_str(), 1500, 1, 1000, errbuf.data());
-    if (descr == nullptr)
+    if (!d_use_recvmmsg)
         {
-            std::cout << "Error opening Ethernet device " << d_src_device << '\n';
-            std::cout << "Fatal Error in pcap_open_live(): " << std::string(errbuf.data()) << '\n';
-            return false;
+            // open device for reading
+            descr = pcap_open_live(d_src_device.c_str(), 1500, 1, 1000, errbuf.data());
+            if (descr == nullptr)
+                {
+                    std::cout << "Error opening Ethernet device " << d_src_device << '\n';
+                    std::cout << "Fatal Error in pcap_open_live(): " << std::string(errbuf.data()) << '\n';
+                    return false;
+                }
         }
-    // bind UDP port to avoid automatic reply with ICMP port unreachable packets from kernel
+    // bind UDP port to avoid automatic reply with ICMP port unreachable packets from kernel;
+    // in batched reception mode the payloads are read from this socket as well
     d_sock_raw = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
     if (d_sock_raw == -1)
         {
@@ -225,6 +280,35 @@ bool Gr_Complex_Ip_Packet_Source::open()
             std::cout << "Error opening UDP socket\n";
             return false;
         }
+#ifdef __linux__
+    if (d_use_recvmmsg)
+        {
+            // buffer over a second of packets in the kernel and time out the
+            // reception periodically so the capture thread can be stopped
+            int rcvbuf_bytes = 16 * 1024 * 1024;
+            if (setsockopt(d_sock_raw, SOL_SOCKET, SO_RCVBUF, &rcvbuf_bytes, sizeof(rcvbuf_bytes)) == -1)
+                {
+                    std::cout << "Cannot set the UDP socket receive buffer size\n";
+                }
+            struct timeval rcv_timeout
+            {
+            };
+            rcv_timeout.tv_usec = 200000;
+            if (setsockopt(d_sock_raw, SOL_SOCKET, SO_RCVTIMEO, &rcv_timeout, sizeof(rcv_timeout)) == -1)
+                {
+                    std::cout << "Cannot set the UDP socket receive timeout\n";
+                }
+#ifdef SO_BUSY_POLL
+            if (d_busy_poll_us > 0)
+                {
+                    if (setsockopt(d_sock_raw, SOL_SOCKET, SO_BUSY_POLL, &d_busy_poll_us, sizeof(d_busy_poll_us)) == -1)
+                        {
+                            std::cout << "Cannot enable busy polling on the UDP socket\n";
+                        }
+                }
+#endif
+        }
+#endif
     return true;
 }
 
@@ -292,37 +376,45 @@ void Gr_Complex_Ip_Packet_Source::pcap_callback(__attribute__((unused)) u_char *
                     int payload_length_bytes = ntohs(uh->len) - 8;  // total udp packet length minus the header length
                     // read the payload bytes and insert them into the shared circular buffer
                     const u_char *udp_payload = (reinterpret_cast<const u_char *>(uh) + sizeof(gr_udp_header));
-                    if (fifo_items <= (FIFO_SIZE - payload_length_bytes))
-                        {
-                            int aligned_write_items = FIFO_SIZE - fifo_write_ptr;
-                            if (aligned_write_items >= payload_length_bytes)
-                                {
-                                    // write all in a single memcpy
-                                    gr::thread::scoped_lock guard(d_setlock);
-                                    memcpy(&fifo_buff[fifo_write_ptr], &udp_payload[0], payload_length_bytes);  // size in bytes
-                                    fifo_write_ptr += payload_length_bytes;
-                                    if (fifo_write_ptr == FIFO_SIZE)
-                                        {
-                                            fifo_write_ptr = 0;
-                                        }
-                                    fifo_items += payload_length_bytes;
-                                }
-                            else
-                                {
-                                    // two step wrap write
-                                    gr::thread::scoped_lock guard(d_setlock);
-                                    memcpy(&fifo_buff[fifo_write_ptr], &udp_payload[0], aligned_write_items);  // size in bytes
-                                    fifo_write_ptr = payload_length_bytes - aligned_write_items;
-                                    memcpy(&fifo_buff[0], &udp_payload[aligned_write_items], fifo_write_ptr);  // size in bytes
-                                    fifo_items += payload_length_bytes;
-                                }
-                        }
-                    else
+                    write_payload_to_fifo(udp_payload, payload_length_bytes);
+                }
+        }
+}
+
+
+void Gr_Complex_Ip_Packet_Source::write_payload_to_fifo(const u_char *payload, int payload_length_bytes)
+{
+    // Single-producer insertion: only the capture thread moves the write
+    // pointer, and work() only consumes bytes already published through
+    // fifo_items, so no lock is required
+    if (fifo_items.load(std::memory_order_acquire) <= (FIFO_SIZE - payload_length_bytes))
+        {
+            int aligned_write_items = FIFO_SIZE - fifo_write_ptr;
+            if (aligned_write_items >= payload_length_bytes)
+                {
+                    // write all in a single memcpy
+                    memcpy(&fifo_buff[fifo_write_ptr], &payload[0], payload_length_bytes);  // size in bytes
+                    fifo_write_ptr += payload_length_bytes;
+                    if (fifo_write_ptr == FIFO_SIZE)
                         {
-                            // notify overflow
-                            std::cout << "o" << std::flush;
+                            fifo_write_ptr = 0;
                         }
                 }
+            else
+                {
+                    // two step wrap write
+                    memcpy(&fifo_buff[fifo_write_ptr], &payload[0], aligned_write_items);  // size in bytes
+                    fifo_write_ptr = payload_length_bytes - aligned_write_items;
+                    memcpy(&fifo_buff[0], &payload[aligned_write_items], fifo_write_ptr);  // size in bytes
+                }
+            // publish the new bytes to work()
+            fifo_items.fetch_add(payload_length_bytes, std::memory_order_release);
+        }
+    else
+        {
+            // notify overflow
+            d_dropped_packets.fetch_add(1, std::memory_order_relaxed);
+            std::cout << "o" << std::flush;
         }
 }
 
@@ -333,6 +425,44 @@ void Gr_Complex_Ip_Packet_Source::my_pcap_loop_thread(pcap_t *pcap_handle)
 }
 
 
+void Gr_Complex_Ip_Packet_Source::my_recvmmsg_loop_thread()
+{
+#ifdef __linux__
+    // read the UDP payloads in batches directly from the bound socket,
+    // skipping the libpcap frame capture and header parsing
+    constexpr int batch_size = 32;
+    constexpr int max_payload_bytes = 1500;
+    std::vector<u_char> payload_buffs(batch_size * max_payload_bytes);
+    std::array<struct mmsghdr, batch_size> msgs{};
+    std::array<struct iovec, batch_size> iovecs{};
+    for (int i = 0; i < batch_size; i++)
+        {
+            iovecs[i].iov_base = &payload_buffs[i * max_payload_bytes];
+            iovecs[i].iov_len = max_payload_bytes;
+            msgs[i].msg_hdr.msg_iov = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+    while (d_capture_active.load(std::memory_order_relaxed))
+        {
+            const int num_received = recvmmsg(d_sock_raw, msgs.data(), batch_size, MSG_WAITFORONE, nullptr);
+            if (num_received < 0)
+                {
+                    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+                        {
+                            continue;  // reception timed out, check for termination
+                        }
+                    std::cout << "Error receiving UDP packets: " << strerror(errno) << '\n';
+                    break;
+                }
+            for (int i = 0; i < num_received; i++)
+                {
+                    write_payload_to_fifo(&payload_buffs[i * max_payload_bytes], static_cast<int>(msgs[i].msg_len));
+                }
+        }
+#endif
+}
+
+
 void Gr_Complex_Ip_Packet_Source::demux_samples(const gr_vector_void_star &output_items, int num_samples_readed)
 {
     if (d_wire_sample_type == 5)
@@ -503,8 +633,8 @@ int Gr_Complex_Ip_Packet_Source::work(int noutput_items,
     gr_vector_void_star &output_items)
 {
     // send samples to next GNU Radio block
-    // boost::mutex::scoped_lock lock(d_mutex);  // hold mutex for duration of this function
-    if (fifo_items == 0)
+    const int available_bytes = fifo_items.load(std::memory_order_acquire);
+    if (available_bytes == 0)
         {
             return 0;
         }
@@ -518,24 +648,23 @@ int Gr_Complex_Ip_Packet_Source::work(int noutput_items,
     int bytes_requested;
 
     bytes_requested = static_cast<int>(static_cast<float>(noutput_items) * d_bytes_per_sample);
-    if (bytes_requested < fifo_items)
+    if (bytes_requested < available_bytes)
         {
             num_samples_readed = noutput_items;  // read all
-            // update fifo items
-            fifo_items = fifo_items - bytes_requested;
         }
     else
         {
-            num_samples_readed = static_cast<int>(static_cast<float>(fifo_items) / d_bytes_per_sample);  // read what we have
-            bytes_requested = fifo_items;
-            // update fifo items
-            fifo_items = 0;
+            num_samples_readed = static_cast<int>(static_cast<float>(available_bytes) / d_bytes_per_sample);  // read what we have
+            bytes_requested = available_bytes;
         }
 
 
     // read all in a single loop
     demux_samples(output_items, num_samples_readed);  // it also increases the fifo read pointer
 
+    // hand the consumed bytes back to the capture thread once they have been demuxed
+    fifo_items.fetch_sub(bytes_requested, std::memory_order_release);
+
     for (uint64_t n = 0; n < output_items.size(); n++)
         {
             produce(static_cast<int>(n), num_samples_readed);
@@ -28,6 +28,8 @@
 #include <net/if.h>
 #include <netinet/if_ether.h>
 #include <pcap.h>
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <sys/ioctl.h>
 
@@ -49,7 +51,9 @@ public:
         int n_baseband_channels,
         const std::string &wire_sample_type,
         size_t item_size,
-        bool IQ_swap_);
+        bool IQ_swap_,
+        bool use_recvmmsg,
+        int busy_poll_us);
     Gr_Complex_Ip_Packet_Source(std::string src_device,
         const std::string &origin_address,
         int udp_port,
@@ -57,9 +61,14 @@ public:
         int n_baseband_channels,
         const std::string &wire_sample_type,
         size_t item_size,
-        bool IQ_swap_);
+        bool IQ_swap_,
+        bool use_recvmmsg,
+        int busy_poll_us);
     ~Gr_Complex_Ip_Packet_Source();
 
+    //! number of UDP payloads discarded because the sample ring buffer was full
+    uint64_t dropped_packets() const { return d_dropped_packets.load(std::memory_order_relaxed); }
+
     // Called by gnuradio to enable drivers, etc for i/o devices.
     bool start();
 
@@ -74,8 +83,11 @@ public:
 private:
     void demux_samples(const gr_vector_void_star &output_items, int num_samples_readed);
     void my_pcap_loop_thread(pcap_t *pcap_handle);
+    void my_recvmmsg_loop_thread();
     void pcap_callback(u_char *args, const struct pcap_pkthdr *pkthdr, const u_char *packet);
     static void static_pcap_callback(u_char *args, const struct pcap_pkthdr *pkthdr, const u_char *packet);
+    //! single-producer insertion into the lock-free sample ring buffer
+    void write_payload_to_fifo(const u_char *payload, int payload_length_bytes);
     /*
      * Opens the ethernet device using libpcap raw capture mode
      * If any of these fail, the function returns the error and exits.
@@ -83,7 +95,6 @@ private:
     bool open();
 
     boost::thread *d_pcap_thread;
-    // boost::mutex d_mutex;
     struct sockaddr_in si_me
     {
     };
@@ -91,15 +102,22 @@ private:
     std::string d_origin_address;
     pcap_t *descr;  // ethernet pcap device descriptor
     char *fifo_buff;
+    // single-producer single-consumer ring buffer: the capture thread owns
+    // the write pointer, work() owns the read pointer, and the byte count is
+    // the only state shared between them
     int fifo_read_ptr;
     int fifo_write_ptr;
-    int fifo_items;
+    std::atomic<int> fifo_items;
+    std::atomic<uint64_t> d_dropped_packets;
+    std::atomic<bool> d_capture_active;
     int d_sock_raw;
     int d_udp_port;
     int d_n_baseband_channels;
     int d_wire_sample_type;
+    int d_busy_poll_us;
     float d_bytes_per_sample;
     bool d_IQ_swap;
+    bool d_use_recvmmsg;
 };
 
 
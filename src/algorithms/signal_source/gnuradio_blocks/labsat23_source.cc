@@ -25,6 +25,8 @@
 #include <algorithm>
 #include <array>
 #include <bitset>
+#include <chrono>
+#include <cstring>
 #include <exception>
 #include <iomanip>
 #include <iostream>
@@ -36,29 +38,42 @@
 #include <boost/endian/conversion.hpp>
 #endif
 
+namespace
+{
+// raw registers handed to each unpack worker in one batch (128 KiB of file data)
+constexpr std::size_t LS3W_CHUNK_REGISTERS = 16384;
+}  // namespace
+
 
-labsat23_source_sptr labsat23_make_source_sptr(const char *signal_file_basename, const std::vector<int> &channel_selector, Concurrent_Queue<pmt::pmt_t> *queue, bool digital_io_enabled)
+labsat23_source_sptr labsat23_make_source_sptr(const char *signal_file_basename, const std::vector<int> &channel_selector, Concurrent_Queue<pmt::pmt_t> *queue, bool digital_io_enabled, int ls3w_decoder_threads)
 {
-    return labsat23_source_sptr(new labsat23_source(signal_file_basename, channel_selector, queue, digital_io_enabled));
+    return labsat23_source_sptr(new labsat23_source(signal_file_basename, channel_selector, queue, digital_io_enabled, ls3w_decoder_threads));
 }
 
 
 labsat23_source::labsat23_source(const char *signal_file_basename,
     const std::vector<int> &channel_selector,
     Concurrent_Queue<pmt::pmt_t> *queue,
-    bool digital_io_enabled) : gr::block("labsat23_source",
-                                   gr::io_signature::make(0, 0, 0),
-                                   gr::io_signature::make(1, 3, sizeof(gr_complex))),
-                               d_queue(queue),
-                               d_channel_selector_config(channel_selector),
-                               d_current_file_number(0),
-                               d_labsat_version(0),
-                               d_channel_selector(0),
-                               d_ref_clock(0),
-                               d_bits_per_sample(0),
-                               d_header_parsed(false),
-                               d_ls3w_digital_io_enabled(digital_io_enabled)
+    bool digital_io_enabled,
+    int ls3w_decoder_threads) : gr::block("labsat23_source",
+                                    gr::io_signature::make(0, 0, 0),
+                                    gr::io_signature::make(1, 3, sizeof(gr_complex))),
+                                d_queue(queue),
+                                d_channel_selector_config(channel_selector),
+                                d_current_file_number(0),
+                                d_labsat_version(0),
+                                d_channel_selector(0),
+                                d_ref_clock(0),
+                                d_bits_per_sample(0),
+                                d_header_parsed(false),
+                                d_ls3w_digital_io_enabled(digital_io_enabled),
+                                d_ls3w_decoder_threads(ls3w_decoder_threads)
 {
+    if (d_ls3w_decoder_threads == 0)
+        {
+            // auto: saturate the disk without starving the flowgraph threads
+            d_ls3w_decoder_threads = std::max(2, std::min(8, static_cast<int>(std::thread::hardware_concurrency()) - 2));
+        }
     d_signal_file_basename = std::string(signal_file_basename);
     std::string signal_file;
     this->set_output_multiple(8);
@@ -92,6 +107,7 @@ labsat23_source::labsat23_source(const char *signal_file_basename,
 
 labsat23_source::~labsat23_source()
 {
+    stop();
     try
         {
             if (binary_input_file.is_open())
@@ -110,6 +126,45 @@ labsat23_source::~labsat23_source()
 }
 
 
+bool labsat23_source::start()
+{
+    if (d_is_ls3w and d_ls3w_decoder_threads > 1)
+        {
+            d_ls3w_shutdown = false;
+            for (int i = 0; i < d_ls3w_decoder_threads; i++)
+                {
+                    d_ls3w_workers.emplace_back(&labsat23_source::ls3w_worker_loop, this);
+                }
+            d_ls3w_reader = std::thread(&labsat23_source::ls3w_reader_loop, this);
+        }
+    return true;
+}
+
+
+bool labsat23_source::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_ls3w_mutex);
+        d_ls3w_shutdown = true;
+    }
+    d_ls3w_cv_worker.notify_all();
+    d_ls3w_cv_deliver.notify_all();
+    if (d_ls3w_reader.joinable())
+        {
+            d_ls3w_reader.join();
+        }
+    for (auto &worker : d_ls3w_workers)
+        {
+            if (worker.joinable())
+                {
+                    worker.join();
+                }
+        }
+    d_ls3w_workers.clear();
+    return true;
+}
+
+
 std::string labsat23_source::generate_filename()
 {
     if (d_signal_file_basename.substr(d_signal_file_basename.length() - 4, 4) == ".ls2" or d_signal_file_basename.substr(d_signal_file_basename.length() - 4, 4) == ".LS2")
@@ -927,6 +982,166 @@ void labsat23_source::decode_ls3w_register(uint64_t input, std::vector<gr_comple
 }
 
 
+void labsat23_source::ls3w_reader_loop()
+{
+    // bound the chunks in flight so a slow consumer does not buffer the file
+    const uint64_t max_in_flight = 2 * static_cast<uint64_t>(d_ls3w_workers.size()) + 2;
+    while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(d_ls3w_mutex);
+                d_ls3w_cv_worker.wait(lock, [&] { return d_ls3w_shutdown or (d_ls3w_chunks_read - d_ls3w_next_delivery < max_in_flight); });
+                if (d_ls3w_shutdown)
+                    {
+                        return;
+                    }
+            }
+            auto chunk = std::make_shared<ls3w_chunk>();
+            chunk->registers.resize(LS3W_CHUNK_REGISTERS);
+            binary_input_file.read(reinterpret_cast<char *>(chunk->registers.data()), LS3W_CHUNK_REGISTERS * sizeof(uint64_t));
+            const auto registers_read = static_cast<std::size_t>(binary_input_file.gcount()) / sizeof(uint64_t);
+            chunk->registers.resize(registers_read);
+            // Labsat3W writes its 64-bit shift register to files in little endian. Convert to host endianness.
+#if HAS_BOOST_ENDIAN
+            for (auto &read_register : chunk->registers)
+                {
+                    boost::endian::little_to_native_inplace(read_register);
+                }
+#else
+            for (auto &read_register : chunk->registers)
+                {
+                    const auto *bytes = reinterpret_cast<const unsigned char *>(&read_register);
+                    uint64_t native = 0ULL;
+                    for (int k = 7; k >= 0; --k)
+                        {
+                            native <<= 8;
+                            native |= uint64_t(bytes[k]);
+                        }
+                    read_register = native;
+                }
+#endif
+            std::lock_guard<std::mutex> lock(d_ls3w_mutex);
+            if (registers_read > 0)
+                {
+                    chunk->index = d_ls3w_chunks_read++;
+                    d_ls3w_raw_chunks.push_back(std::move(chunk));
+                    d_ls3w_cv_worker.notify_all();
+                }
+            if (registers_read < LS3W_CHUNK_REGISTERS)
+                {
+                    d_ls3w_reader_done = true;
+                    d_ls3w_cv_worker.notify_all();
+                    d_ls3w_cv_deliver.notify_all();
+                    return;
+                }
+        }
+}
+
+
+void labsat23_source::ls3w_worker_loop()
+{
+    while (true)
+        {
+            std::shared_ptr<ls3w_chunk> chunk;
+            {
+                std::unique_lock<std::mutex> lock(d_ls3w_mutex);
+                d_ls3w_cv_worker.wait(lock, [&] { return d_ls3w_shutdown or d_ls3w_reader_done or !d_ls3w_raw_chunks.empty(); });
+                if (d_ls3w_shutdown or d_ls3w_raw_chunks.empty())
+                    {
+                        return;
+                    }
+                chunk = std::move(d_ls3w_raw_chunks.front());
+                d_ls3w_raw_chunks.pop_front();
+            }
+            decode_ls3w_chunk(*chunk);
+            {
+                std::lock_guard<std::mutex> lock(d_ls3w_mutex);
+                d_ls3w_decoded_chunks.emplace(chunk->index, std::move(chunk));
+            }
+            d_ls3w_cv_deliver.notify_all();
+        }
+}
+
+
+void labsat23_source::decode_ls3w_chunk(ls3w_chunk &chunk) const
+{
+    const std::size_t n_samples = chunk.registers.size() * static_cast<std::size_t>(d_ls3w_samples_per_register);
+    chunk.samples.resize(d_channel_selector_config.size());
+    std::vector<gr_complex *> out;
+    out.reserve(chunk.samples.size());
+    for (auto &channel : chunk.samples)
+        {
+            channel.resize(n_samples);
+            out.push_back(channel.data());
+        }
+    std::size_t output_pointer = 0;
+    for (const auto read_register : chunk.registers)
+        {
+            decode_ls3w_register(read_register, out, output_pointer);
+            output_pointer += d_ls3w_samples_per_register;
+        }
+}
+
+
+int labsat23_source::ls3w_pipelined_work(int noutput_items, std::vector<gr_complex *> &out)
+{
+    int produced = 0;
+    while (produced < noutput_items)
+        {
+            if (!d_ls3w_front)
+                {
+                    std::unique_lock<std::mutex> lock(d_ls3w_mutex);
+                    const auto next_ready = [&] { return d_ls3w_shutdown or d_ls3w_decoded_chunks.count(d_ls3w_next_delivery) != 0 or (d_ls3w_reader_done and d_ls3w_next_delivery == d_ls3w_chunks_read); };
+                    if (produced > 0)
+                        {
+                            // deliver what we have rather than stalling the flowgraph
+                            if (!next_ready())
+                                {
+                                    return produced;
+                                }
+                        }
+                    else if (!d_ls3w_cv_deliver.wait_for(lock, std::chrono::milliseconds(100), next_ready))
+                        {
+                            return 0;  // decoder busy, try again on the next call
+                        }
+                    if (d_ls3w_shutdown)
+                        {
+                            return produced;
+                        }
+                    if (d_ls3w_reader_done and d_ls3w_next_delivery == d_ls3w_chunks_read)
+                        {
+                            if (produced > 0)
+                                {
+                                    return produced;
+                                }
+                            std::cout << "End of file reached, LabSat source stop.\n";
+                            d_queue->push(pmt::make_any(command_event_make(200, 0)));
+                            return -1;
+                        }
+                    const auto it = d_ls3w_decoded_chunks.find(d_ls3w_next_delivery);
+                    d_ls3w_front = std::move(it->second);
+                    d_ls3w_decoded_chunks.erase(it);
+                    d_ls3w_front_offset = 0;
+                    d_ls3w_next_delivery++;
+                    d_ls3w_cv_worker.notify_all();  // frees a slot for the reader
+                }
+            const std::size_t chunk_samples = d_ls3w_front->samples.front().size();
+            const std::size_t to_copy = std::min(static_cast<std::size_t>(noutput_items - produced), chunk_samples - d_ls3w_front_offset);
+            for (std::size_t ch = 0; ch < d_ls3w_front->samples.size(); ch++)
+                {
+                    std::memcpy(out[ch] + produced, d_ls3w_front->samples[ch].data() + d_ls3w_front_offset, to_copy * sizeof(gr_complex));
+                }
+            d_ls3w_front_offset += to_copy;
+            produced += static_cast<int>(to_copy);
+            if (d_ls3w_front_offset == chunk_samples)
+                {
+                    d_ls3w_front.reset();
+                }
+        }
+    return produced;
+}
+
+
 int labsat23_source::general_work(int noutput_items,
     __attribute__((unused)) gr_vector_int &ninput_items,
     __attribute__((unused)) gr_vector_const_void_star &input_items,
@@ -1068,6 +1283,11 @@ int labsat23_source::general_work(int noutput_items,
         }
     else  // Labsat 3 Wideband
         {
+            if (d_ls3w_decoder_threads > 1)
+                {
+                    // file I/O and bit unpacking run in the decoder pipeline
+                    return ls3w_pipelined_work(noutput_items, out);
+                }
             if (binary_input_file.eof() == false)
                 {
                     // Integer division, any fractional part of the answer is discarded
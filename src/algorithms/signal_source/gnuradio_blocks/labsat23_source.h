@@ -23,10 +23,16 @@
 #include "gnss_block_interface.h"
 #include <gnuradio/block.h>
 #include <pmt/pmt.h>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 /** \addtogroup Signal_Source
@@ -43,7 +49,8 @@ labsat23_source_sptr labsat23_make_source_sptr(
     const char *signal_file_basename,
     const std::vector<int> &channel_selector,
     Concurrent_Queue<pmt::pmt_t> *queue,
-    bool digital_io_enabled);
+    bool digital_io_enabled,
+    int ls3w_decoder_threads);
 
 /*!
  * \brief This class implements conversion between Labsat 2, 3 and 3 Wideband
@@ -54,6 +61,9 @@ class labsat23_source : public gr::block
 public:
     ~labsat23_source();
 
+    bool start();
+    bool stop();
+
     int general_work(int noutput_items,
         gr_vector_int &ninput_items,
         gr_vector_const_void_star &input_items,
@@ -64,12 +74,14 @@ private:
         const char *signal_file_basename,
         const std::vector<int> &channel_selector,
         Concurrent_Queue<pmt::pmt_t> *queue,
-        bool digital_io_enabled);
+        bool digital_io_enabled,
+        int ls3w_decoder_threads);
 
     labsat23_source(const char *signal_file_basename,
         const std::vector<int> &channel_selector,
         Concurrent_Queue<pmt::pmt_t> *queue,
-        bool digital_io_enabled);
+        bool digital_io_enabled,
+        int ls3w_decoder_threads);
 
     std::string generate_filename();
 
@@ -81,6 +93,21 @@ private:
     void decode_samples_one_channel(int16_t input_short, gr_complex *out, int type);
     void decode_ls3w_register(uint64_t input, std::vector<gr_complex *> &out, std::size_t output_pointer) const;
 
+    // Pipelined LS3W decoding: a reader thread deframes 64-bit registers from
+    // the file in chunks while a pool of workers unpacks them into per-channel
+    // sample buffers, delivered to general_work() in file order
+    struct ls3w_chunk
+    {
+        std::vector<uint64_t> registers;
+        std::vector<std::vector<gr_complex>> samples;  // one buffer per selected channel
+        uint64_t index{};
+    };
+
+    void ls3w_reader_loop();
+    void ls3w_worker_loop();
+    void decode_ls3w_chunk(ls3w_chunk &chunk) const;
+    int ls3w_pipelined_work(int noutput_items, std::vector<gr_complex *> &out);
+
     std::ifstream binary_input_file;
     std::string d_signal_file_basename;
     Concurrent_Queue<pmt::pmt_t> *d_queue;
@@ -109,6 +136,22 @@ private:
     int d_ls3w_samples_per_register{};
     bool d_is_ls3w = false;
     bool d_ls3w_digital_io_enabled = false;
+
+    // Pipelined LS3W decoder state, shared under d_ls3w_mutex
+    std::thread d_ls3w_reader;
+    std::vector<std::thread> d_ls3w_workers;
+    std::mutex d_ls3w_mutex;
+    std::condition_variable d_ls3w_cv_worker;
+    std::condition_variable d_ls3w_cv_deliver;
+    std::deque<std::shared_ptr<ls3w_chunk>> d_ls3w_raw_chunks;
+    std::map<uint64_t, std::shared_ptr<ls3w_chunk>> d_ls3w_decoded_chunks;
+    std::shared_ptr<ls3w_chunk> d_ls3w_front;  // chunk being drained by general_work()
+    std::size_t d_ls3w_front_offset{};
+    uint64_t d_ls3w_chunks_read{};
+    uint64_t d_ls3w_next_delivery{};
+    int d_ls3w_decoder_threads;
+    bool d_ls3w_reader_done = false;
+    bool d_ls3w_shutdown = false;
 };
 
 
@@ -0,0 +1,128 @@
+/*!
+ * \file lz4_dump_sink.cc
+ * \brief Implementation of a GNU Radio sink block that records the sample
+ * stream into a chunked LZ4-compressed capture file
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "lz4_dump_sink.h"
+#include "lz4_capture_container.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <lz4.h>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+
+Lz4DumpSink::sptr Lz4DumpSink::make(size_t item_size, const std::string &file_name)
+{
+    return gnuradio::get_initial_sptr(new Lz4DumpSink(item_size, file_name));
+}
+
+
+Lz4DumpSink::Lz4DumpSink(size_t item_size, const std::string &file_name)
+    : gr::sync_block("lz4_dump_sink",
+          gr::io_signature::make(1, 1, item_size),
+          gr::io_signature::make(0, 0, 0)),
+      item_size_(item_size)
+{
+    file_.open(file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file_.is_open())
+        {
+            throw std::runtime_error("lz4_dump_sink: cannot create " + file_name);
+        }
+
+    block_buf_.resize(lz4_capture::default_block_size);
+    compressed_buf_.resize(LZ4_compressBound(static_cast<int>(lz4_capture::default_block_size)));
+
+    lz4_capture::file_header header{};
+    std::memcpy(header.magic, lz4_capture::magic, sizeof(header.magic));
+    header.version = lz4_capture::format_version;
+    header.block_size = lz4_capture::default_block_size;
+    header.item_size = item_size_;
+    file_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+}
+
+
+Lz4DumpSink::~Lz4DumpSink()
+{
+    try
+        {
+            if (block_fill_ > 0)
+                {
+                    flush_block();
+                }
+            // append the block index and the footer so readers can seek in O(1)
+            for (const uint64_t offset : block_offsets_)
+                {
+                    file_.write(reinterpret_cast<const char *>(&offset), sizeof(offset));
+                }
+            lz4_capture::file_footer footer{};
+            footer.uncompressed_bytes = uncompressed_bytes_;
+            footer.n_blocks = block_offsets_.size();
+            std::memcpy(footer.magic, lz4_capture::magic, sizeof(footer.magic));
+            file_.write(reinterpret_cast<const char *>(&footer), sizeof(footer));
+            file_.close();
+        }
+    catch (const std::exception &e)
+        {
+            LOG(WARNING) << "lz4_dump_sink: error closing the capture file: " << e.what();
+        }
+}
+
+
+void Lz4DumpSink::flush_block()
+{
+    const int compressed_size = LZ4_compress_default(block_buf_.data(),
+        compressed_buf_.data(),
+        static_cast<int>(block_fill_),
+        static_cast<int>(compressed_buf_.size()));
+    if (compressed_size <= 0)
+        {
+            LOG(ERROR) << "lz4_dump_sink: block compression failed, dropping "
+                       << block_fill_ << " bytes";
+            block_fill_ = 0;
+            return;
+        }
+    block_offsets_.push_back(static_cast<uint64_t>(file_.tellp()));
+    const auto length = static_cast<uint32_t>(compressed_size);
+    file_.write(reinterpret_cast<const char *>(&length), sizeof(length));
+    file_.write(compressed_buf_.data(), compressed_size);
+    uncompressed_bytes_ += block_fill_;
+    block_fill_ = 0;
+}
+
+
+int Lz4DumpSink::work(int noutput_items,
+    gr_vector_const_void_star &input_items,
+    gr_vector_void_star &output_items __attribute__((unused)))
+{
+    const auto *in = static_cast<const char *>(input_items[0]);
+    size_t remaining = static_cast<size_t>(noutput_items) * item_size_;
+
+    while (remaining > 0)
+        {
+            const size_t chunk = std::min(remaining, block_buf_.size() - block_fill_);
+            std::memcpy(block_buf_.data() + block_fill_, in, chunk);
+            block_fill_ += chunk;
+            in += chunk;
+            remaining -= chunk;
+            if (block_fill_ == block_buf_.size())
+                {
+                    flush_block();
+                }
+        }
+
+    return noutput_items;
+}
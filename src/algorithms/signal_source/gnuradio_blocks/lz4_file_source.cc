@@ -0,0 +1,169 @@
+/*!
+ * \file lz4_file_source.cc
+ * \brief Implementation of a GNU Radio source block that replays a chunked
+ * LZ4-compressed capture file
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "lz4_file_source.h"
+#include "lz4_capture_container.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <lz4.h>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+
+Lz4FileSource::sptr Lz4FileSource::make(const std::string &file_name, size_t item_size, size_t offset_bytes, bool repeat)
+{
+    return gnuradio::get_initial_sptr(new Lz4FileSource(file_name, item_size, offset_bytes, repeat));
+}
+
+
+Lz4FileSource::Lz4FileSource(const std::string &file_name, size_t item_size, size_t offset_bytes, bool repeat)
+    : gr::sync_block("lz4_file_source",
+          gr::io_signature::make(0, 0, 0),
+          gr::io_signature::make(1, 1, item_size)),
+      pos_(offset_bytes),
+      offset_(offset_bytes),
+      item_size_(item_size),
+      repeat_(repeat)
+{
+    file_.open(file_name, std::ios::in | std::ios::binary);
+    if (!file_.is_open())
+        {
+            throw std::runtime_error("lz4_file_source: cannot open " + file_name);
+        }
+
+    lz4_capture::file_header header{};
+    file_.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!file_ || !lz4_capture::check_magic(header.magic) || header.version != lz4_capture::format_version)
+        {
+            throw std::runtime_error("lz4_file_source: " + file_name + " is not a valid LZ4 capture file");
+        }
+    if (header.item_size != 0 && header.item_size != item_size_)
+        {
+            LOG(WARNING) << "lz4_file_source: the capture was recorded with "
+                         << header.item_size << "-byte items but is replayed with "
+                         << item_size_ << "-byte items";
+        }
+    block_size_ = header.block_size;
+
+    // the footer closes the file; the index of block offsets sits right before it
+    lz4_capture::file_footer footer{};
+    file_.seekg(-static_cast<std::streamoff>(sizeof(footer)), std::ios::end);
+    file_.read(reinterpret_cast<char *>(&footer), sizeof(footer));
+    if (!file_ || !lz4_capture::check_magic(footer.magic))
+        {
+            throw std::runtime_error("lz4_file_source: " + file_name + " has no valid footer (truncated capture?)");
+        }
+    uncompressed_bytes_ = footer.uncompressed_bytes;
+    block_offsets_.resize(footer.n_blocks);
+    file_.seekg(-static_cast<std::streamoff>(sizeof(footer) + footer.n_blocks * sizeof(uint64_t)), std::ios::end);
+    file_.read(reinterpret_cast<char *>(block_offsets_.data()), footer.n_blocks * sizeof(uint64_t));
+    if (!file_)
+        {
+            throw std::runtime_error("lz4_file_source: cannot read the block index of " + file_name);
+        }
+
+    block_buf_.resize(block_size_);
+    compressed_buf_.resize(LZ4_compressBound(static_cast<int>(block_size_)));
+
+    DLOG(INFO) << "lz4_file_source: " << file_name << " holds " << uncompressed_bytes_
+               << " raw bytes in " << block_offsets_.size() << " blocks of " << block_size_ << " bytes";
+}
+
+
+bool Lz4FileSource::load_block_for(uint64_t pos)
+{
+    const uint64_t block_index = pos / block_size_;
+    if (block_index == current_block_)
+        {
+            return true;
+        }
+    if (block_index >= block_offsets_.size())
+        {
+            return false;
+        }
+    file_.clear();
+    file_.seekg(static_cast<std::streamoff>(block_offsets_[block_index]), std::ios::beg);
+    uint32_t length = 0;
+    file_.read(reinterpret_cast<char *>(&length), sizeof(length));
+    if (!file_ || length == 0 || length > compressed_buf_.size())
+        {
+            LOG(ERROR) << "lz4_file_source: corrupt block " << block_index;
+            return false;
+        }
+    file_.read(compressed_buf_.data(), length);
+    if (!file_)
+        {
+            LOG(ERROR) << "lz4_file_source: cannot read block " << block_index;
+            return false;
+        }
+    const int decompressed = LZ4_decompress_safe(compressed_buf_.data(),
+        block_buf_.data(),
+        static_cast<int>(length),
+        static_cast<int>(block_buf_.size()));
+    if (decompressed <= 0)
+        {
+            LOG(ERROR) << "lz4_file_source: cannot decompress block " << block_index;
+            return false;
+        }
+    current_block_ = block_index;
+    current_block_bytes_ = static_cast<size_t>(decompressed);
+    return true;
+}
+
+
+int Lz4FileSource::work(int noutput_items,
+    gr_vector_const_void_star &input_items __attribute__((unused)),
+    gr_vector_void_star &output_items)
+{
+    auto *out = static_cast<char *>(output_items[0]);
+    const size_t bytes_needed = static_cast<size_t>(noutput_items) * item_size_;
+    size_t bytes_written = 0;
+
+    while (bytes_written < bytes_needed)
+        {
+            if (pos_ >= uncompressed_bytes_)
+                {
+                    if (!repeat_)
+                        {
+                            break;
+                        }
+                    pos_ = offset_;
+                }
+            if (!load_block_for(pos_))
+                {
+                    break;
+                }
+            const size_t block_offset = pos_ % block_size_;
+            if (block_offset >= current_block_bytes_)
+                {
+                    break;  // truncated last block
+                }
+            const size_t chunk = std::min({current_block_bytes_ - block_offset,
+                bytes_needed - bytes_written,
+                static_cast<size_t>(uncompressed_bytes_ - pos_)});
+            std::memcpy(out + bytes_written, block_buf_.data() + block_offset, chunk);
+            bytes_written += chunk;
+            pos_ += chunk;
+        }
+
+    if (bytes_written == 0)
+        {
+            return -1;  // EOF
+        }
+    return static_cast<int>(bytes_written / item_size_);
+}
@@ -0,0 +1,82 @@
+/*!
+ * \file lz4_file_source.h
+ * \brief Header file of a GNU Radio source block that replays a chunked
+ * LZ4-compressed capture file
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_LZ4_FILE_SOURCE_H
+#define GNSS_SDR_LZ4_FILE_SOURCE_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/sync_block.h>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_gnuradio_blocks
+ * \{ */
+
+/*!
+ * \brief GNU Radio source block that streams samples from a chunked
+ * LZ4-compressed capture (see lz4_capture_container.h).
+ *
+ * The footer index is loaded once at open, so any byte offset in the raw
+ * stream maps to its compressed block in O(1); replay then trades cheap
+ * decompression CPU for 3-4x less disk bandwidth.
+ */
+class Lz4FileSource : virtual public gr::sync_block
+{
+public:
+    using sptr = gnss_shared_ptr<Lz4FileSource>;
+    static sptr make(const std::string &file_name, size_t item_size, size_t offset_bytes, bool repeat);
+
+    ~Lz4FileSource() = default;
+
+    //! total raw payload bytes in the capture, as recorded in the footer
+    uint64_t uncompressed_bytes() const { return uncompressed_bytes_; }
+
+    // gnu radio work cycle function
+    int work(int noutput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    //! private constructor called by function make; throws std::runtime_error
+    //! if the file cannot be opened or is not a valid capture
+    Lz4FileSource(const std::string &file_name, size_t item_size, size_t offset_bytes, bool repeat);
+
+    //! decompress the block holding byte \a pos of the raw stream
+    bool load_block_for(uint64_t pos);
+
+    std::ifstream file_;
+    std::vector<char> block_buf_;       // current decompressed block
+    std::vector<char> compressed_buf_;  // read buffer for one compressed block
+    std::vector<uint64_t> block_offsets_;
+    uint64_t uncompressed_bytes_{0};
+    uint64_t pos_;  // next raw-stream byte to emit
+    uint64_t current_block_{UINT64_MAX};
+    size_t current_block_bytes_{0};
+    size_t offset_;  // first raw-stream byte to emit (skipped header/lead-in)
+    size_t item_size_;
+    uint32_t block_size_;
+    bool repeat_;
+};
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_LZ4_FILE_SOURCE_H
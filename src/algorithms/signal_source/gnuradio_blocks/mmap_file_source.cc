@@ -0,0 +1,136 @@
+/*!
+ * \file mmap_file_source.cc
+ * \brief Implementation of a GNU Radio source block that streams samples from
+ * a memory-mapped file with madvise-driven readahead
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "mmap_file_source.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+
+MmapFileSource::sptr MmapFileSource::make(const std::string &file_name, size_t item_size, size_t offset_bytes, bool repeat)
+{
+    return gnuradio::get_initial_sptr(new MmapFileSource(file_name, item_size, offset_bytes, repeat));
+}
+
+
+MmapFileSource::MmapFileSource(const std::string &file_name, size_t item_size, size_t offset_bytes, bool repeat)
+    : gr::sync_block("mmap_file_source",
+          gr::io_signature::make(0, 0, 0),
+          gr::io_signature::make(1, 1, item_size)),
+      file_name_(file_name),
+      item_size_(item_size),
+      offset_(offset_bytes),
+      window_end_(advise_window_bytes),
+      repeat_(repeat)
+{
+    const int fd = ::open(file_name_.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        {
+            throw std::runtime_error("mmap_file_source: cannot open " + file_name_);
+        }
+    struct stat st
+    {
+    };
+    if (fstat(fd, &st) < 0 || st.st_size <= 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("mmap_file_source: cannot stat " + file_name_);
+        }
+    void *map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // the mapping keeps its own reference
+    if (map == MAP_FAILED)
+        {
+            throw std::runtime_error("mmap_file_source: mmap failed for " + file_name_);
+        }
+    map_ = static_cast<const char *>(map);
+    // emit whole items only
+    map_size_ = (static_cast<size_t>(st.st_size) / item_size_) * item_size_;
+    if (offset_ >= map_size_)
+        {
+            offset_ = 0;
+        }
+    pos_ = offset_;
+
+    madvise(const_cast<char *>(map_), map_size_, MADV_SEQUENTIAL);
+    madvise(const_cast<char *>(map_), std::min(map_size_, advise_window_bytes), MADV_WILLNEED);
+
+    DLOG(INFO) << "mmap_file_source: mapped " << map_size_ << " bytes of " << file_name_;
+}
+
+
+MmapFileSource::~MmapFileSource()
+{
+    if (map_)
+        {
+            munmap(const_cast<char *>(map_), map_size_);
+        }
+}
+
+
+void MmapFileSource::update_readahead()
+{
+    while (pos_ >= window_end_ && window_end_ < map_size_)
+        {
+            // the window below the boundary is fully consumed: release it and
+            // prefetch the next one. madvise works on page granularity, so the
+            // constant window alignment keeps both calls cheap
+            if (window_end_ >= advise_window_bytes)
+                {
+                    madvise(const_cast<char *>(map_) + window_end_ - advise_window_bytes, advise_window_bytes, MADV_DONTNEED);
+                }
+            madvise(const_cast<char *>(map_) + window_end_, std::min(advise_window_bytes, map_size_ - window_end_), MADV_WILLNEED);
+            window_end_ += advise_window_bytes;
+        }
+}
+
+
+int MmapFileSource::work(int noutput_items,
+    gr_vector_const_void_star &input_items __attribute__((unused)),
+    gr_vector_void_star &output_items)
+{
+    auto *out = static_cast<char *>(output_items[0]);
+
+    size_t items = std::min(static_cast<size_t>(noutput_items), (map_size_ - pos_) / item_size_);
+    if (items == 0)
+        {
+            if (!repeat_)
+                {
+                    return -1;  // end of file, signal done
+                }
+            pos_ = offset_;
+            window_end_ = advise_window_bytes;
+            items = std::min(static_cast<size_t>(noutput_items), (map_size_ - pos_) / item_size_);
+            if (items == 0)
+                {
+                    return -1;
+                }
+        }
+
+    // single copy from the page cache into the flowgraph buffer
+    memcpy(out, map_ + pos_, items * item_size_);
+    pos_ += items * item_size_;
+
+    update_readahead();
+
+    return static_cast<int>(items);
+}
@@ -0,0 +1,74 @@
+/*!
+ * \file mmap_file_source.h
+ * \brief Header file of a GNU Radio source block that streams samples from a
+ * memory-mapped file with madvise-driven readahead
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_MMAP_FILE_SOURCE_H
+#define GNSS_SDR_MMAP_FILE_SOURCE_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/sync_block.h>
+#include <cstddef>
+#include <string>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_gnuradio_blocks
+ * \{ */
+
+/*!
+ * \brief GNU Radio source block that maps the input file into memory and
+ * copies samples straight from the page cache into the output buffer.
+ *
+ * The mapping is advised MADV_SEQUENTIAL; as the read position advances, the
+ * next window is prefetched with MADV_WILLNEED and fully consumed windows are
+ * released with MADV_DONTNEED, so the resident set stays bounded even for
+ * multi-TB recordings.
+ */
+class MmapFileSource : virtual public gr::sync_block
+{
+public:
+    using sptr = gnss_shared_ptr<MmapFileSource>;
+    static sptr make(const std::string &file_name, size_t item_size, size_t offset_bytes, bool repeat);
+
+    ~MmapFileSource();
+
+    // gnu radio work cycle function
+    int work(int noutput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    //! private constructor called by function make
+    MmapFileSource(const std::string &file_name, size_t item_size, size_t offset_bytes, bool repeat);
+
+    //! prefetch the upcoming window and drop the ones already consumed
+    void update_readahead();
+
+    static constexpr size_t advise_window_bytes = size_t(64) << 20;
+
+    const std::string file_name_;
+    const char *map_{nullptr};
+    size_t map_size_{0};
+    size_t item_size_;
+    size_t offset_;      // first byte to emit (skipped header/lead-in)
+    size_t pos_{0};      // next byte to emit
+    size_t window_end_;  // next readahead boundary
+    bool repeat_;
+};
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_MMAP_FILE_SOURCE_H
@@ -0,0 +1,56 @@
+/*!
+ * \file udp_multicast_packet.h
+ * \brief Wire format shared by the UDP multicast sample sink and source
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_UDP_MULTICAST_PACKET_H
+#define GNSS_SDR_UDP_MULTICAST_PACKET_H
+
+#include <cstdint>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_gnuradio_blocks
+ * \{ */
+
+/*!
+ * \brief Header prepended to every datagram of the multicast sample transport.
+ *
+ * Every data chunk carries a monotonic sequence number and the absolute item
+ * counter of its first sample, so receivers can reorder datagrams and account
+ * for losses without feedback to the sender. When forward error correction is
+ * enabled, one parity chunk (the XOR of the previous fec_group data payloads)
+ * is interleaved after every fec_group data chunks, letting a receiver rebuild
+ * any single loss per group. All fields are little-endian; the transport is
+ * meant for LAN fan-out between same-endianness nodes.
+ */
+struct Udp_Multicast_Packet_Header
+{
+    uint64_t sample_counter;  // absolute item index of the first payload item (data chunks)
+    uint32_t magic;           // UDP_MULTICAST_MAGIC
+    uint32_t sequence;        // data: chunk sequence number; parity: sequence of the first chunk it protects
+    uint16_t payload_bytes;   // payload length, equal for all chunks of a stream
+    uint8_t flags;            // see UDP_MULTICAST_FLAG_*
+    uint8_t fec_group;        // data chunks per parity chunk (0: FEC disabled)
+};
+
+static_assert(sizeof(Udp_Multicast_Packet_Header) == 24, "unexpected multicast packet header layout");
+
+constexpr uint32_t UDP_MULTICAST_MAGIC = 0x474D4353;  // "GMCS"
+constexpr uint8_t UDP_MULTICAST_FLAG_DATA = 0;
+constexpr uint8_t UDP_MULTICAST_FLAG_PARITY = 1;
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_UDP_MULTICAST_PACKET_H
@@ -0,0 +1,151 @@
+/*!
+ * \file udp_multicast_sink.cc
+ * \brief Implementation of a GNU Radio sink block that publishes the sample
+ * stream to a UDP multicast group with sequence numbers and optional FEC
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "udp_multicast_sink.h"
+#include "udp_multicast_packet.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <algorithm>  // for min
+#include <cstring>    // for memcpy
+#include <stdexcept>
+
+
+UdpMulticastSink::sptr UdpMulticastSink::make(size_t item_size, const std::string &address, uint16_t port, int payload_bytes, int fec_group, int ttl)
+{
+    return gnuradio::get_initial_sptr(new UdpMulticastSink(item_size, address, port, payload_bytes, fec_group, ttl));
+}
+
+
+UdpMulticastSink::UdpMulticastSink(size_t item_size, const std::string &address, uint16_t port, int payload_bytes, int fec_group, int ttl)
+    : gr::sync_block("udp_multicast_sink",
+          gr::io_signature::make(1, 1, item_size),
+          gr::io_signature::make(0, 0, 0)),
+      d_socket(d_io_context),
+      d_item_size(item_size),
+      d_chunk_fill(0),
+      d_chunk_first_sample(0),
+      d_sequence(0),
+      d_chunks_in_group(0),
+      d_fec_group(static_cast<uint8_t>(std::min(fec_group, 255)))
+{
+    // keep every datagram a whole number of items
+    d_payload_bytes = (static_cast<size_t>(payload_bytes) / d_item_size) * d_item_size;
+    if (d_payload_bytes == 0)
+        {
+            throw std::runtime_error("udp_multicast_sink: payload_bytes smaller than one item");
+        }
+
+    boost::system::error_code ec;
+    const boost::asio::ip::address group_address = boost::asio::ip::address::from_string(address, ec);
+    if (ec or !group_address.is_multicast())
+        {
+            throw std::runtime_error("udp_multicast_sink: " + address + " is not a valid multicast address");
+        }
+    d_endpoint = boost::asio::ip::udp::endpoint(group_address, port);
+    d_socket.open(d_endpoint.protocol(), ec);
+    if (ec)
+        {
+            throw std::runtime_error("udp_multicast_sink: cannot open the UDP socket: " + ec.message());
+        }
+    d_socket.set_option(boost::asio::ip::multicast::hops(ttl));
+
+    d_chunk.resize(d_payload_bytes);
+    d_parity.assign(d_payload_bytes, 0);
+    d_packet.resize(sizeof(Udp_Multicast_Packet_Header) + d_payload_bytes);
+
+    DLOG(INFO) << "udp_multicast_sink: publishing " << d_payload_bytes
+               << "-byte chunks to " << address << ":" << port
+               << " (fec_group=" << static_cast<int>(d_fec_group) << ")";
+}
+
+
+UdpMulticastSink::~UdpMulticastSink()
+{
+    boost::system::error_code ec;
+    d_socket.close(ec);
+}
+
+
+void UdpMulticastSink::send_chunk(uint8_t flags, uint32_t sequence, uint64_t sample_counter, const char *payload)
+{
+    Udp_Multicast_Packet_Header header{};
+    header.sample_counter = sample_counter;
+    header.magic = UDP_MULTICAST_MAGIC;
+    header.sequence = sequence;
+    header.payload_bytes = static_cast<uint16_t>(d_payload_bytes);
+    header.flags = flags;
+    header.fec_group = d_fec_group;
+
+    std::memcpy(d_packet.data(), &header, sizeof(header));
+    std::memcpy(d_packet.data() + sizeof(header), payload, d_payload_bytes);
+
+    boost::system::error_code ec;
+    d_socket.send_to(boost::asio::buffer(d_packet), d_endpoint, 0, ec);
+    if (ec)
+        {
+            // transient send errors (e.g. ENOBUFS under bursts) count as a
+            // loss on every receiver; the FEC layer absorbs isolated ones
+            LOG(WARNING) << "udp_multicast_sink: send failed: " << ec.message();
+        }
+}
+
+
+int UdpMulticastSink::work(int noutput_items,
+    gr_vector_const_void_star &input_items,
+    gr_vector_void_star &output_items __attribute__((unused)))
+{
+    const auto *in = static_cast<const char *>(input_items[0]);
+    size_t bytes_left = static_cast<size_t>(noutput_items) * d_item_size;
+
+    while (bytes_left > 0)
+        {
+            if (d_chunk_fill == 0)
+                {
+                    d_chunk_first_sample = this->nitems_read(0) + (static_cast<size_t>(noutput_items) * d_item_size - bytes_left) / d_item_size;
+                }
+            const size_t chunk = std::min(d_payload_bytes - d_chunk_fill, bytes_left);
+            std::memcpy(d_chunk.data() + d_chunk_fill, in, chunk);
+            in += chunk;
+            bytes_left -= chunk;
+            d_chunk_fill += chunk;
+
+            if (d_chunk_fill == d_payload_bytes)
+                {
+                    send_chunk(UDP_MULTICAST_FLAG_DATA, d_sequence, d_chunk_first_sample, d_chunk.data());
+                    d_chunk_fill = 0;
+                    d_sequence++;
+                    if (d_fec_group > 0)
+                        {
+                            for (size_t n = 0; n < d_payload_bytes; n++)
+                                {
+                                    d_parity[n] ^= d_chunk[n];
+                                }
+                            d_chunks_in_group++;
+                            if (d_chunks_in_group == d_fec_group)
+                                {
+                                    // the parity chunk takes the sequence of the first
+                                    // data chunk it protects
+                                    send_chunk(UDP_MULTICAST_FLAG_PARITY, d_sequence - d_fec_group, 0, d_parity.data());
+                                    d_parity.assign(d_payload_bytes, 0);
+                                    d_chunks_in_group = 0;
+                                }
+                        }
+                }
+        }
+
+    return noutput_items;
+}
@@ -0,0 +1,83 @@
+/*!
+ * \file udp_multicast_sink.h
+ * \brief Header file of a GNU Radio sink block that publishes the sample
+ * stream to a UDP multicast group with sequence numbers and optional FEC
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_UDP_MULTICAST_SINK_H
+#define GNSS_SDR_UDP_MULTICAST_SINK_H
+
+#include "gnss_block_interface.h"
+#include <boost/asio.hpp>
+#include <gnuradio/sync_block.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_gnuradio_blocks
+ * \{ */
+
+/*!
+ * \brief GNU Radio sink block that chops the sample stream into fixed-size
+ * chunks and publishes them to a UDP multicast group.
+ *
+ * One multicast stream serves any number of subscribers at constant sender
+ * bandwidth, unlike per-subscriber unicast streams. Each chunk carries the
+ * header described in udp_multicast_packet.h; when fec_group > 0 an XOR
+ * parity chunk is interleaved after every fec_group data chunks, so receivers
+ * can rebuild a single lost chunk per group without retransmissions.
+ */
+class UdpMulticastSink : virtual public gr::sync_block
+{
+public:
+    using sptr = gnss_shared_ptr<UdpMulticastSink>;
+    static sptr make(size_t item_size, const std::string &address, uint16_t port, int payload_bytes, int fec_group, int ttl);
+
+    ~UdpMulticastSink();
+
+    // gnu radio work cycle function
+    int work(int noutput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    //! private constructor called by function make; throws std::runtime_error
+    //! if the multicast socket cannot be opened
+    UdpMulticastSink(size_t item_size, const std::string &address, uint16_t port, int payload_bytes, int fec_group, int ttl);
+
+    void send_chunk(uint8_t flags, uint32_t sequence, uint64_t sample_counter, const char *payload);
+
+    boost::asio::io_context d_io_context;
+    boost::asio::ip::udp::socket d_socket;
+    boost::asio::ip::udp::endpoint d_endpoint;
+
+    std::vector<char> d_chunk;
+    std::vector<char> d_parity;
+    std::vector<char> d_packet;
+
+    size_t d_item_size;
+    size_t d_payload_bytes;
+    size_t d_chunk_fill;
+    uint64_t d_chunk_first_sample;
+    uint32_t d_sequence;
+    uint32_t d_chunks_in_group;
+    uint8_t d_fec_group;
+};
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_UDP_MULTICAST_SINK_H
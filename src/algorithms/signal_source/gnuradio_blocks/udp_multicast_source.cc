@@ -0,0 +1,317 @@
+/*!
+ * \file udp_multicast_source.cc
+ * \brief Implementation of a GNU Radio source block that subscribes to the UDP
+ * multicast sample transport, with reordering, FEC recovery and loss accounting
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "udp_multicast_source.h"
+#include "udp_multicast_packet.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <algorithm>  // for min
+#include <chrono>
+#include <cstring>  // for memcpy
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+//! sequence numbers wrap at 2^32; order decisions must use the difference
+inline int32_t seq_diff(uint32_t a, uint32_t b)
+{
+    return static_cast<int32_t>(a - b);
+}
+}  // namespace
+
+
+UdpMulticastSource::sptr UdpMulticastSource::make(size_t item_size, const std::string &address, uint16_t port, int reorder_depth)
+{
+    return gnuradio::get_initial_sptr(new UdpMulticastSource(item_size, address, port, reorder_depth));
+}
+
+
+UdpMulticastSource::UdpMulticastSource(size_t item_size, const std::string &address, uint16_t port, int reorder_depth)
+    : gr::sync_block("udp_multicast_source",
+          gr::io_signature::make(0, 0, 0),
+          gr::io_signature::make(1, 1, item_size)),
+      d_socket(d_io_context),
+      d_pending_offset(0),
+      d_chunks_delivered(0),
+      d_chunks_recovered(0),
+      d_chunks_lost(0),
+      d_item_size(item_size),
+      d_payload_bytes(0),
+      d_next_sequence(0),
+      d_highest_sequence(0),
+      d_reorder_depth(static_cast<uint32_t>(std::max(reorder_depth, 1))),
+      d_fec_group(0),
+      d_group_broken(false),
+      d_synced(false),
+      d_running(false)
+{
+    boost::system::error_code ec;
+    const boost::asio::ip::address group_address = boost::asio::ip::address::from_string(address, ec);
+    if (ec or !group_address.is_multicast())
+        {
+            throw std::runtime_error("udp_multicast_source: " + address + " is not a valid multicast address");
+        }
+    const boost::asio::ip::udp::endpoint listen_endpoint(boost::asio::ip::address_v4::any(), port);
+    d_socket.open(listen_endpoint.protocol(), ec);
+    if (ec)
+        {
+            throw std::runtime_error("udp_multicast_source: cannot open the UDP socket: " + ec.message());
+        }
+    d_socket.set_option(boost::asio::ip::udp::socket::reuse_address(true));
+    d_socket.bind(listen_endpoint, ec);
+    if (ec)
+        {
+            throw std::runtime_error("udp_multicast_source: cannot bind to port " + std::to_string(port) + ": " + ec.message());
+        }
+    d_socket.set_option(boost::asio::ip::multicast::join_group(group_address), ec);
+    if (ec)
+        {
+            throw std::runtime_error("udp_multicast_source: cannot join group " + address + ": " + ec.message());
+        }
+    DLOG(INFO) << "udp_multicast_source: joined " << address << ":" << port;
+}
+
+
+bool UdpMulticastSource::start()
+{
+    d_running = true;
+    d_rx_thread = std::thread(&UdpMulticastSource::receive_loop, this);
+    return true;
+}
+
+
+bool UdpMulticastSource::stop()
+{
+    d_running = false;
+    boost::system::error_code ec;
+    d_socket.close(ec);  // unblocks the receive thread
+    d_cond.notify_all();
+    if (d_rx_thread.joinable())
+        {
+            d_rx_thread.join();
+        }
+    LOG(INFO) << "udp_multicast_source: delivered " << d_chunks_delivered
+              << " chunks, " << d_chunks_recovered << " recovered by FEC, "
+              << d_chunks_lost << " lost";
+    if (d_chunks_lost > 0)
+        {
+            std::cout << "Multicast source: " << d_chunks_lost << " sample chunks were lost ("
+                      << d_chunks_recovered << " more recovered by FEC)\n";
+        }
+    return true;
+}
+
+
+void UdpMulticastSource::receive_loop()
+{
+    std::vector<char> buffer(sizeof(Udp_Multicast_Packet_Header) + 65535);
+    while (d_running)
+        {
+            boost::system::error_code ec;
+            boost::asio::ip::udp::endpoint sender;
+            const size_t received = d_socket.receive_from(boost::asio::buffer(buffer), sender, 0, ec);
+            if (ec)
+                {
+                    if (d_running)
+                        {
+                            LOG(WARNING) << "udp_multicast_source: receive failed: " << ec.message();
+                        }
+                    continue;
+                }
+            if (received < sizeof(Udp_Multicast_Packet_Header))
+                {
+                    continue;
+                }
+            Udp_Multicast_Packet_Header header{};
+            std::memcpy(&header, buffer.data(), sizeof(header));
+            if (header.magic != UDP_MULTICAST_MAGIC or header.payload_bytes == 0 or received != sizeof(header) + header.payload_bytes)
+                {
+                    continue;
+                }
+            std::vector<char> payload(buffer.begin() + sizeof(header), buffer.begin() + sizeof(header) + header.payload_bytes);
+
+            std::lock_guard<std::mutex> lock(d_mutex);
+            if (!d_synced)
+                {
+                    if (header.flags != UDP_MULTICAST_FLAG_DATA)
+                        {
+                            continue;
+                        }
+                    d_payload_bytes = header.payload_bytes;
+                    d_fec_group = header.fec_group;
+                    d_next_sequence = header.sequence;
+                    d_highest_sequence = header.sequence;
+                    d_group_acc.assign(d_payload_bytes, 0);
+                    // a mid-group join cannot XOR in the chunks it never saw
+                    d_group_broken = (d_fec_group > 0) and (d_next_sequence % d_fec_group != 0);
+                    d_synced = true;
+                    LOG(INFO) << "udp_multicast_source: stream locked at sequence " << header.sequence
+                              << ", " << d_payload_bytes << "-byte chunks, fec_group=" << static_cast<int>(d_fec_group);
+                }
+            if (header.payload_bytes != d_payload_bytes)
+                {
+                    continue;
+                }
+            if (header.flags == UDP_MULTICAST_FLAG_PARITY)
+                {
+                    if (seq_diff(header.sequence + d_fec_group, d_next_sequence) > 0)
+                        {
+                            d_parity[header.sequence] = std::move(payload);
+                        }
+                }
+            else
+                {
+                    if (seq_diff(header.sequence, d_next_sequence) >= 0)
+                        {
+                            d_chunks[header.sequence] = std::move(payload);
+                            if (seq_diff(header.sequence, d_highest_sequence) > 0)
+                                {
+                                    d_highest_sequence = header.sequence;
+                                }
+                        }
+                }
+            d_cond.notify_one();
+        }
+}
+
+
+bool UdpMulticastSource::fetch_next_chunk(bool wait)
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    if (wait)
+        {
+            d_cond.wait_for(lock, std::chrono::milliseconds(100), [this] {
+                return !d_running or (d_synced and (d_chunks.count(d_next_sequence) != 0 or seq_diff(d_highest_sequence, d_next_sequence) > static_cast<int32_t>(d_reorder_depth)));
+            });
+        }
+    if (!d_running or !d_synced)
+        {
+            return false;
+        }
+
+    bool recovered = false;
+    const auto chunk_it = d_chunks.find(d_next_sequence);
+    if (chunk_it != d_chunks.end())
+        {
+            d_pending = std::move(chunk_it->second);
+            d_chunks.erase(chunk_it);
+        }
+    else if (seq_diff(d_highest_sequence, d_next_sequence) > static_cast<int32_t>(d_reorder_depth))
+        {
+            // the chunk is given up for lost: try to rebuild it as the XOR of
+            // the group parity, the already delivered chunks of the group and
+            // the buffered chunks that follow it
+            if (d_fec_group > 0 and !d_group_broken)
+                {
+                    const uint32_t group_first = (d_next_sequence / d_fec_group) * d_fec_group;
+                    const auto parity_it = d_parity.find(group_first);
+                    if (parity_it != d_parity.end())
+                        {
+                            std::vector<char> rebuilt = parity_it->second;
+                            for (size_t n = 0; n < d_payload_bytes; n++)
+                                {
+                                    rebuilt[n] ^= d_group_acc[n];
+                                }
+                            bool all_present = true;
+                            for (uint32_t seq = d_next_sequence + 1; seq_diff(seq, group_first + d_fec_group) < 0; seq++)
+                                {
+                                    const auto it = d_chunks.find(seq);
+                                    if (it == d_chunks.end())
+                                        {
+                                            all_present = false;
+                                            break;
+                                        }
+                                    for (size_t n = 0; n < d_payload_bytes; n++)
+                                        {
+                                            rebuilt[n] ^= it->second[n];
+                                        }
+                                }
+                            if (all_present)
+                                {
+                                    d_pending = std::move(rebuilt);
+                                    d_chunks_recovered++;
+                                    recovered = true;
+                                }
+                        }
+                }
+            if (!recovered)
+                {
+                    // unrecoverable: substitute zero samples so the sample
+                    // count (and every downstream timestamp) stays coherent
+                    d_pending.assign(d_payload_bytes, 0);
+                    d_group_broken = true;
+                    d_chunks_lost++;
+                    LOG(WARNING) << "udp_multicast_source: chunk " << d_next_sequence
+                                 << " lost (" << d_chunks_lost << " so far), replaced with zero samples";
+                }
+        }
+    else
+        {
+            return false;  // timeout, nothing deliverable yet
+        }
+
+    d_chunks_delivered++;
+    if (d_fec_group > 0)
+        {
+            for (size_t n = 0; n < d_payload_bytes; n++)
+                {
+                    d_group_acc[n] ^= d_pending[n];
+                }
+        }
+    d_next_sequence++;
+    if (d_fec_group > 0 and d_next_sequence % d_fec_group == 0)
+        {
+            // the FEC group is complete: its parity cannot be needed any more
+            d_parity.erase(d_next_sequence - d_fec_group);
+            d_group_acc.assign(d_payload_bytes, 0);
+            d_group_broken = false;
+        }
+    d_pending_offset = 0;
+    return true;
+}
+
+
+int UdpMulticastSource::work(int noutput_items,
+    gr_vector_const_void_star &input_items __attribute__((unused)),
+    gr_vector_void_star &output_items)
+{
+    auto *out = static_cast<char *>(output_items[0]);
+    const size_t bytes_needed = static_cast<size_t>(noutput_items) * d_item_size;
+    size_t bytes_written = 0;
+
+    while (bytes_written < bytes_needed)
+        {
+            if (d_pending_offset == d_pending.size())
+                {
+                    // block (up to the reorder timeout) only when nothing has
+                    // been produced yet; once samples are flowing, just drain
+                    // whatever is already deliverable
+                    if (!fetch_next_chunk(bytes_written == 0))
+                        {
+                            break;
+                        }
+                }
+            const size_t chunk = std::min(d_pending.size() - d_pending_offset, bytes_needed - bytes_written);
+            std::memcpy(out + bytes_written, d_pending.data() + d_pending_offset, chunk);
+            bytes_written += chunk;
+            d_pending_offset += chunk;
+        }
+
+    return static_cast<int>(bytes_written / d_item_size);
+}
@@ -0,0 +1,107 @@
+/*!
+ * \file udp_multicast_source.h
+ * \brief Header file of a GNU Radio source block that subscribes to the UDP
+ * multicast sample transport, with reordering, FEC recovery and loss accounting
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_UDP_MULTICAST_SOURCE_H
+#define GNSS_SDR_UDP_MULTICAST_SOURCE_H
+
+#include "gnss_block_interface.h"
+#include <boost/asio.hpp>
+#include <gnuradio/sync_block.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_gnuradio_blocks
+ * \{ */
+
+/*!
+ * \brief GNU Radio source block that joins the multicast group published by
+ * UdpMulticastSink and rebuilds the original sample stream.
+ *
+ * A receive thread files the incoming chunks into a reorder buffer keyed by
+ * sequence number; work() delivers them strictly in order. When a chunk is
+ * still missing after reorder_depth newer chunks have arrived, the block
+ * first tries to rebuild it from the XOR parity of its FEC group; if that is
+ * not possible, the chunk is replaced with zero samples (keeping the sample
+ * count of the stream intact) and accounted as lost.
+ */
+class UdpMulticastSource : virtual public gr::sync_block
+{
+public:
+    using sptr = gnss_shared_ptr<UdpMulticastSource>;
+    static sptr make(size_t item_size, const std::string &address, uint16_t port, int reorder_depth);
+
+    ~UdpMulticastSource() = default;
+
+    bool start() override;
+    bool stop() override;
+
+    // gnu radio work cycle function
+    int work(int noutput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    //! private constructor called by function make; throws std::runtime_error
+    //! if the multicast group cannot be joined
+    UdpMulticastSource(size_t item_size, const std::string &address, uint16_t port, int reorder_depth);
+
+    void receive_loop();
+    //! moves chunk d_next_sequence into d_pending (reordered, FEC-rebuilt or
+    //! zero-filled); false when nothing is deliverable (after the reorder
+    //! timeout if wait is true)
+    bool fetch_next_chunk(bool wait);
+
+    boost::asio::io_context d_io_context;
+    boost::asio::ip::udp::socket d_socket;
+
+    std::thread d_rx_thread;
+    std::mutex d_mutex;
+    std::condition_variable d_cond;
+
+    std::unordered_map<uint32_t, std::vector<char>> d_chunks;  // reorder buffer, keyed by sequence
+    std::unordered_map<uint32_t, std::vector<char>> d_parity;  // keyed by the first sequence of the FEC group
+    std::vector<char> d_group_acc;                             // XOR of the already delivered chunks of the current FEC group
+    std::vector<char> d_pending;                               // chunk being handed to the flowgraph
+    size_t d_pending_offset;
+
+    uint64_t d_chunks_delivered;
+    uint64_t d_chunks_recovered;
+    uint64_t d_chunks_lost;
+
+    size_t d_item_size;
+    size_t d_payload_bytes;  // learned from the first received chunk
+    uint32_t d_next_sequence;
+    uint32_t d_highest_sequence;
+    uint32_t d_reorder_depth;
+    uint8_t d_fec_group;
+    bool d_group_broken;  // an unrecovered loss poisons the XOR state of its FEC group
+    bool d_synced;
+    std::atomic<bool> d_running;
+};
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_UDP_MULTICAST_SOURCE_H
@@ -18,6 +18,7 @@
 
 #include "unpack_2bit_samples.h"
 #include <gnuradio/io_signature.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
 
 struct byte_2bit_struct
 {
@@ -164,16 +165,10 @@ int unpack_2bit_samples::work(int noutput_items,
                 }
             else
                 {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                        }
+                    // Read packed input samples (1 byte = 4 samples, least
+                    // significant pair first)
+                    volk_gnsssdr_8i_unpack_2bit_8i(out, reinterpret_cast<const int8_t *>(in),
+                        static_cast<unsigned int>(ninput_bytes * 4));
                 }
         }
     else
@@ -18,6 +18,7 @@
 
 #include "unpack_byte_4bit_samples.h"
 #include <gnuradio/io_signature.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
 
 unpack_byte_4bit_samples_sptr make_unpack_byte_4bit_samples()
 {
@@ -39,29 +40,7 @@ int unpack_byte_4bit_samples::work(int noutput_items,
 {
     const auto *in = reinterpret_cast<const int8_t *>(input_items[0]);
     auto *out = reinterpret_cast<int16_t *>(output_items[0]);
-    int n = 0;
-    unsigned char tmp_char2;
-    for (int i = 0; i < noutput_items / 2; i++)
-        {
-            tmp_char2 = in[i] & 0x0F;
-            if (tmp_char2 >= 8)
-                {
-                    out[n++] = static_cast<int16_t>(2 * (tmp_char2 - 16) + 1);
-                }
-            else
-                {
-                    out[n++] = static_cast<int16_t>(2 * tmp_char2 + 1);
-                }
-            tmp_char2 = in[i] >> 4;
-            tmp_char2 = tmp_char2 & 0x0F;
-            if (tmp_char2 >= 8)
-                {
-                    out[n++] = static_cast<int16_t>(2 * (tmp_char2 - 16) + 1);
-                }
-            else
-                {
-                    out[n++] = static_cast<int16_t>(2 * tmp_char2 + 1);
-                }
-        }
+    // Read packed input samples (1 byte = 2 samples, least significant nibble first)
+    volk_gnsssdr_8i_unpack_4bit_16i(out, in, static_cast<unsigned int>(noutput_items));
     return noutput_items;
 }
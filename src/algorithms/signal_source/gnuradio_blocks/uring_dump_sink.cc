@@ -0,0 +1,290 @@
+/*!
+ * \file uring_dump_sink.cc
+ * \brief Implementation of a GNU Radio sink block that dumps samples to a
+ * file through io_uring asynchronous writes
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "uring_dump_sink.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+// liburing is not a project dependency, so the three io_uring system calls
+// are wrapped here directly
+int sys_io_uring_setup(unsigned entries, io_uring_params *p)
+{
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, p));
+}
+
+int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags)
+{
+    return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+int sys_io_uring_register(int fd, unsigned opcode, const void *arg, unsigned nr_args)
+{
+    return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+}  // namespace
+
+
+UringDumpSink::sptr UringDumpSink::make(size_t item_size, const std::string &file_name, int queue_depth)
+{
+    return gnuradio::get_initial_sptr(new UringDumpSink(item_size, file_name, queue_depth));
+}
+
+
+UringDumpSink::UringDumpSink(size_t item_size, const std::string &file_name, int queue_depth)
+    : gr::sync_block("uring_dump_sink",
+          gr::io_signature::make(1, 1, item_size),
+          gr::io_signature::make(0, 0, 0)),
+      file_name_(file_name),
+      item_size_(item_size),
+      depth_(static_cast<unsigned>(std::min(std::max(queue_depth, 2), 1024)))
+{
+    file_fd_ = ::open(file_name_.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (file_fd_ < 0)
+        {
+            throw std::runtime_error("uring_dump_sink: cannot open " + file_name_ + ": " + strerror(errno));
+        }
+
+    io_uring_params params{};
+    ring_fd_ = sys_io_uring_setup(depth_, &params);
+    if (ring_fd_ < 0)
+        {
+            const int err = errno;
+            teardown();
+            throw std::runtime_error(std::string("uring_dump_sink: io_uring_setup failed: ") + strerror(err));
+        }
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+
+    sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+    cq_ring_ = mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+    void *sqes = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+    if (sq_ring_ == MAP_FAILED || cq_ring_ == MAP_FAILED || sqes == MAP_FAILED)
+        {
+            sq_ring_ = (sq_ring_ == MAP_FAILED) ? nullptr : sq_ring_;
+            cq_ring_ = (cq_ring_ == MAP_FAILED) ? nullptr : cq_ring_;
+            teardown();
+            throw std::runtime_error("uring_dump_sink: cannot map the io_uring rings");
+        }
+    sqes_ = static_cast<io_uring_sqe *>(sqes);
+
+    auto *sq = static_cast<char *>(sq_ring_);
+    sq_head_ = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+    sq_mask_ = reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+    auto *cq = static_cast<char *>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+    cq_mask_ = reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+
+    if (sys_io_uring_register(ring_fd_, IORING_REGISTER_FILES, &file_fd_, 1) < 0)
+        {
+            const int err = errno;
+            teardown();
+            throw std::runtime_error(std::string("uring_dump_sink: cannot register the dump file: ") + strerror(err));
+        }
+
+    buffers_.resize(static_cast<size_t>(depth_) * buffer_bytes);
+    buffer_len_.resize(depth_, 0);
+    std::vector<iovec> iov(depth_);
+    for (unsigned i = 0; i < depth_; i++)
+        {
+            iov[i].iov_base = buffers_.data() + static_cast<size_t>(i) * buffer_bytes;
+            iov[i].iov_len = buffer_bytes;
+            free_buffers_.push_back(depth_ - 1 - i);
+        }
+    if (sys_io_uring_register(ring_fd_, IORING_REGISTER_BUFFERS, iov.data(), depth_) < 0)
+        {
+            const int err = errno;
+            teardown();
+            throw std::runtime_error(std::string("uring_dump_sink: cannot register the write buffers: ") + strerror(err));
+        }
+
+    DLOG(INFO) << "uring_dump_sink: dumping to " << file_name_ << " with " << depth_
+               << " buffers of " << buffer_bytes << " bytes";
+}
+
+
+UringDumpSink::~UringDumpSink()
+{
+    // flush the partially filled buffer and drain the pending writes
+    if (current_buf_ >= 0 && current_fill_ > 0)
+        {
+            submit(static_cast<unsigned>(current_buf_), static_cast<unsigned>(current_fill_));
+            current_buf_ = -1;
+        }
+    while (in_flight_ > 0)
+        {
+            if (sys_io_uring_enter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR)
+                {
+                    break;
+                }
+            reap_completions();
+        }
+    LOG(INFO) << "uring_dump_sink: " << file_offset_ << " bytes written to " << file_name_;
+    if (dropped_items_ > 0)
+        {
+            LOG(WARNING) << "uring_dump_sink: " << dropped_items_
+                         << " items dropped while dumping to " << file_name_
+                         << " (storage too slow, try a larger queue depth)";
+        }
+    teardown();
+}
+
+
+void UringDumpSink::teardown()
+{
+    if (sq_ring_ != nullptr)
+        {
+            munmap(sq_ring_, sq_ring_size_);
+            sq_ring_ = nullptr;
+        }
+    if (cq_ring_ != nullptr)
+        {
+            munmap(cq_ring_, cq_ring_size_);
+            cq_ring_ = nullptr;
+        }
+    if (sqes_ != nullptr)
+        {
+            munmap(sqes_, sqes_size_);
+            sqes_ = nullptr;
+        }
+    if (ring_fd_ >= 0)
+        {
+            ::close(ring_fd_);
+            ring_fd_ = -1;
+        }
+    if (file_fd_ >= 0)
+        {
+            ::close(file_fd_);
+            file_fd_ = -1;
+        }
+}
+
+
+void UringDumpSink::submit(unsigned buf, unsigned len)
+{
+    // this block is the only submitter, so the tail can be read plainly; a
+    // free slot is guaranteed because at most depth_ writes are in flight
+    const unsigned tail = *sq_tail_;
+    const unsigned idx = tail & *sq_mask_;
+    io_uring_sqe *sqe = &sqes_[idx];
+    *sqe = io_uring_sqe{};
+    sqe->opcode = IORING_OP_WRITE_FIXED;
+    sqe->flags = IOSQE_FIXED_FILE;
+    sqe->fd = 0;  // index into the registered file table
+    sqe->addr = reinterpret_cast<uint64_t>(buffers_.data() + static_cast<size_t>(buf) * buffer_bytes);
+    sqe->len = len;
+    sqe->off = file_offset_;
+    sqe->buf_index = static_cast<uint16_t>(buf);
+    sqe->user_data = buf;
+    sq_array_[idx] = idx;
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+
+    buffer_len_[buf] = len;
+    file_offset_ += len;
+    in_flight_++;
+    if (sys_io_uring_enter(ring_fd_, 1, 0, 0) < 0)
+        {
+            LOG(WARNING) << "uring_dump_sink: io_uring_enter failed: " << strerror(errno);
+        }
+}
+
+
+void UringDumpSink::reap_completions()
+{
+    unsigned head = *cq_head_;
+    while (head != __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE))
+        {
+            const io_uring_cqe *cqe = &cqes_[head & *cq_mask_];
+            const auto buf = static_cast<unsigned>(cqe->user_data);
+            if (cqe->res < 0)
+                {
+                    LOG(WARNING) << "uring_dump_sink: write to " << file_name_
+                                 << " failed: " << strerror(-cqe->res);
+                }
+            else if (static_cast<unsigned>(cqe->res) != buffer_len_[buf])
+                {
+                    LOG(WARNING) << "uring_dump_sink: short write to " << file_name_
+                                 << " (" << cqe->res << " of " << buffer_len_[buf] << " bytes)";
+                }
+            free_buffers_.push_back(buf);
+            in_flight_--;
+            head++;
+        }
+    __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+}
+
+
+int UringDumpSink::work(int noutput_items,
+    gr_vector_const_void_star &input_items,
+    gr_vector_void_star &output_items __attribute__((unused)))
+{
+    const auto *in = static_cast<const char *>(input_items[0]);
+    size_t bytes = static_cast<size_t>(noutput_items) * item_size_;
+
+    while (bytes > 0)
+        {
+            if (current_buf_ < 0)
+                {
+                    reap_completions();
+                    if (free_buffers_.empty())
+                        {
+                            // the whole pool is queued on the device: drop the
+                            // rest of this chunk rather than stalling the
+                            // flowgraph, and keep count of it
+                            dropped_items_ += bytes / item_size_;
+                            if (!dropping_)
+                                {
+                                    LOG(WARNING) << "uring_dump_sink: all write buffers in flight, dropping samples";
+                                    dropping_ = true;
+                                }
+                            break;
+                        }
+                    current_buf_ = static_cast<int>(free_buffers_.back());
+                    free_buffers_.pop_back();
+                    current_fill_ = 0;
+                    dropping_ = false;
+                }
+            const size_t chunk = std::min(bytes, buffer_bytes - current_fill_);
+            memcpy(buffers_.data() + static_cast<size_t>(current_buf_) * buffer_bytes + current_fill_, in, chunk);
+            current_fill_ += chunk;
+            in += chunk;
+            bytes -= chunk;
+            if (current_fill_ == buffer_bytes)
+                {
+                    submit(static_cast<unsigned>(current_buf_), buffer_bytes);
+                    current_buf_ = -1;
+                }
+        }
+
+    return noutput_items;
+}
@@ -0,0 +1,109 @@
+/*!
+ * \file uring_dump_sink.h
+ * \brief Header file of a GNU Radio sink block that dumps samples to a file
+ * through io_uring asynchronous writes
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_URING_DUMP_SINK_H
+#define GNSS_SDR_URING_DUMP_SINK_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/sync_block.h>
+#include <linux/io_uring.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_gnuradio_blocks
+ * \{ */
+
+/*!
+ * \brief GNU Radio sink block that archives the input stream with io_uring.
+ *
+ * Samples are staged into a pool of buffers registered with the kernel and
+ * written with IORING_OP_WRITE_FIXED against a registered file descriptor, so
+ * work() never blocks on disk I/O. If the device cannot keep up and the whole
+ * pool is in flight, incoming samples are discarded and accounted for instead
+ * of stalling the flowgraph; the totals are reported when the block is
+ * destroyed and can be queried with dropped_items().
+ *
+ * Linux-only (requires kernel >= 5.1).
+ */
+class UringDumpSink : virtual public gr::sync_block
+{
+public:
+    using sptr = gnss_shared_ptr<UringDumpSink>;
+    //! \param queue_depth number of staging buffers / in-flight writes (clamped to [2, 1024])
+    static sptr make(size_t item_size, const std::string &file_name, int queue_depth);
+
+    ~UringDumpSink();
+
+    //! number of input items discarded because all write buffers were in flight
+    uint64_t dropped_items() const { return dropped_items_; }
+
+    // gnu radio work cycle function
+    int work(int noutput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    //! private constructor called by function make; throws std::runtime_error
+    //! if the file or the io_uring instance cannot be set up
+    UringDumpSink(size_t item_size, const std::string &file_name, int queue_depth);
+
+    void submit(unsigned buf, unsigned len);
+    void reap_completions();
+    void teardown();
+
+    static constexpr size_t buffer_bytes = size_t(512) * 1024;
+
+    const std::string file_name_;
+    std::vector<char> buffers_;
+    std::vector<unsigned> free_buffers_;
+    std::vector<unsigned> buffer_len_;
+
+    // io_uring submission/completion ring state (kernel-shared mappings)
+    void *sq_ring_{nullptr};
+    void *cq_ring_{nullptr};
+    io_uring_sqe *sqes_{nullptr};
+    size_t sq_ring_size_{0};
+    size_t cq_ring_size_{0};
+    size_t sqes_size_{0};
+    unsigned *sq_head_{nullptr};
+    unsigned *sq_tail_{nullptr};
+    unsigned *sq_mask_{nullptr};
+    unsigned *sq_array_{nullptr};
+    unsigned *cq_head_{nullptr};
+    unsigned *cq_tail_{nullptr};
+    unsigned *cq_mask_{nullptr};
+    io_uring_cqe *cqes_{nullptr};
+
+    uint64_t file_offset_{0};
+    uint64_t dropped_items_{0};
+    size_t item_size_;
+    unsigned depth_;
+    unsigned in_flight_{0};
+    int ring_fd_{-1};
+    int file_fd_{-1};
+    int current_buf_{-1};
+    size_t current_fill_{0};
+    bool dropping_{false};
+};
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_URING_DUMP_SINK_H
@@ -0,0 +1,130 @@
+/*!
+ * \file zmq_msg_source.cc
+ * \brief Implementation of a GNU Radio source block that streams samples from
+ * a ZeroMQ subscription without an intermediate ring buffer
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "zmq_msg_source.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+
+ZmqMsgSource::sptr ZmqMsgSource::make(size_t item_size, const std::string &endpoint, int timeout_ms, int rcv_hwm, int io_threads)
+{
+    return gnuradio::get_initial_sptr(new ZmqMsgSource(item_size, endpoint, timeout_ms, rcv_hwm, io_threads));
+}
+
+
+ZmqMsgSource::ZmqMsgSource(size_t item_size, const std::string &endpoint, int timeout_ms, int rcv_hwm, int io_threads)
+    : gr::sync_block("zmq_msg_source",
+          gr::io_signature::make(0, 0, 0),
+          gr::io_signature::make(1, 1, item_size)),
+      d_item_size(item_size)
+{
+    d_context = zmq_ctx_new();
+    if (d_context == nullptr)
+        {
+            throw std::runtime_error("zmq_msg_source: cannot create the ZeroMQ context");
+        }
+    if (io_threads > 0)
+        {
+            zmq_ctx_set(d_context, ZMQ_IO_THREADS, io_threads);
+        }
+    d_socket = zmq_socket(d_context, ZMQ_SUB);
+    if (d_socket == nullptr)
+        {
+            zmq_ctx_term(d_context);
+            d_context = nullptr;
+            throw std::runtime_error("zmq_msg_source: cannot create the ZeroMQ socket");
+        }
+    // the high-water mark must be set before connecting
+    if (rcv_hwm >= 0)
+        {
+            zmq_setsockopt(d_socket, ZMQ_RCVHWM, &rcv_hwm, sizeof(rcv_hwm));
+        }
+    zmq_setsockopt(d_socket, ZMQ_RCVTIMEO, &timeout_ms, sizeof(timeout_ms));
+    const int linger_ms = 0;
+    zmq_setsockopt(d_socket, ZMQ_LINGER, &linger_ms, sizeof(linger_ms));
+    zmq_setsockopt(d_socket, ZMQ_SUBSCRIBE, "", 0);
+    if (zmq_connect(d_socket, endpoint.c_str()) != 0)
+        {
+            zmq_close(d_socket);
+            zmq_ctx_term(d_context);
+            d_socket = nullptr;
+            d_context = nullptr;
+            throw std::runtime_error("zmq_msg_source: cannot connect to " + endpoint);
+        }
+    DLOG(INFO) << "zmq_msg_source: subscribed to " << endpoint;
+}
+
+
+ZmqMsgSource::~ZmqMsgSource()
+{
+    if (d_msg_pending)
+        {
+            zmq_msg_close(&d_msg);
+        }
+    if (d_socket != nullptr)
+        {
+            zmq_close(d_socket);
+        }
+    if (d_context != nullptr)
+        {
+            zmq_ctx_term(d_context);
+        }
+}
+
+
+int ZmqMsgSource::work(int noutput_items,
+    gr_vector_const_void_star &input_items __attribute__((unused)),
+    gr_vector_void_star &output_items)
+{
+    auto *out = static_cast<char *>(output_items[0]);
+    const size_t bytes_needed = static_cast<size_t>(noutput_items) * d_item_size;
+    size_t bytes_written = 0;
+
+    while (bytes_written < bytes_needed)
+        {
+            if (!d_msg_pending)
+                {
+                    zmq_msg_init(&d_msg);
+                    // block (up to the receive timeout) only when nothing has
+                    // been produced yet; once samples are flowing, just drain
+                    // whatever is already queued
+                    if (zmq_msg_recv(&d_msg, d_socket, (bytes_written > 0) ? ZMQ_DONTWAIT : 0) < 0)
+                        {
+                            zmq_msg_close(&d_msg);
+                            break;
+                        }
+                    d_msg_pending = true;
+                    d_msg_offset = 0;
+                }
+            // the message is held reference-counted until fully consumed, so
+            // this is the only copy between the transport and the flowgraph
+            const size_t chunk = std::min(zmq_msg_size(&d_msg) - d_msg_offset, bytes_needed - bytes_written);
+            memcpy(out + bytes_written, static_cast<const char *>(zmq_msg_data(&d_msg)) + d_msg_offset, chunk);
+            bytes_written += chunk;
+            d_msg_offset += chunk;
+            if (d_msg_offset == zmq_msg_size(&d_msg))
+                {
+                    zmq_msg_close(&d_msg);
+                    d_msg_pending = false;
+                }
+        }
+
+    return static_cast<int>(bytes_written / d_item_size);
+}
@@ -0,0 +1,70 @@
+/*!
+ * \file zmq_msg_source.h
+ * \brief Header file of a GNU Radio source block that streams samples from a
+ * ZeroMQ subscription without an intermediate ring buffer
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ZMQ_MSG_SOURCE_H
+#define GNSS_SDR_ZMQ_MSG_SOURCE_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/sync_block.h>
+#include <zmq.h>
+#include <cstddef>
+#include <string>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_gnuradio_blocks
+ * \{ */
+
+/*!
+ * \brief GNU Radio source block that subscribes to a ZeroMQ publisher and
+ * copies each received message once, straight into the output buffer.
+ *
+ * Unlike gr::zeromq::sub_source there is no internal ring buffer: a message
+ * is held reference-counted (zmq_msg_t) until its samples have been handed to
+ * the flowgraph, so samples move transport buffer -> output buffer in a
+ * single copy. The receive high-water mark and the number of ZeroMQ I/O
+ * threads are configurable. Messages must hold a whole number of items.
+ */
+class ZmqMsgSource : virtual public gr::sync_block
+{
+public:
+    using sptr = gnss_shared_ptr<ZmqMsgSource>;
+    static sptr make(size_t item_size, const std::string &endpoint, int timeout_ms, int rcv_hwm, int io_threads);
+
+    ~ZmqMsgSource();
+
+    // gnu radio work cycle function
+    int work(int noutput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    //! private constructor called by function make; throws std::runtime_error
+    //! if the ZeroMQ context or socket cannot be set up
+    ZmqMsgSource(size_t item_size, const std::string &endpoint, int timeout_ms, int rcv_hwm, int io_threads);
+
+    zmq_msg_t d_msg;
+    void *d_context{nullptr};
+    void *d_socket{nullptr};
+    size_t d_item_size;
+    size_t d_msg_offset{0};
+    bool d_msg_pending{false};
+};
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_ZMQ_MSG_SOURCE_H
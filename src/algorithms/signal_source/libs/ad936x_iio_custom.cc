@@ -18,12 +18,18 @@
 #include <glog/logging.h>
 #include <chrono>
 #include <cmath>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <new>
 #include <string>
 #include <utility>
 #include <vector>
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 ad936x_iio_custom::ad936x_iio_custom(int debug_level_, int log_level_)
 {
     receive_samples = false;
@@ -37,6 +43,8 @@ ad936x_iio_custom::ad936x_iio_custom(int debug_level_, int log_level_)
     log_level = log_level_;
     PPS_mode = false;
     n_channels = 0;
+    buffer_pool = NULL;
+    buffer_pool_bytes = 0;
 }
 
 ad936x_iio_custom::~ad936x_iio_custom()
@@ -46,6 +54,16 @@ ad936x_iio_custom::~ad936x_iio_custom()
 
     // Close device
     if (ctx != NULL) iio_context_destroy(ctx);
+
+#ifdef __linux__
+    if (buffer_pool != NULL)
+        {
+            // drop every reference into the pool before unmapping it
+            free_buffers.clear();
+            used_buffers.clear();
+            munmap(buffer_pool, buffer_pool_bytes);
+        }
+#endif
 }
 
 
@@ -1077,9 +1095,49 @@ bool ad936x_iio_custom::start_sample_rx(bool ppsmode)
     std::cerr << "Allocating memory..\n";
     try
         {
-            for (int n = 0; n < IIO_INPUTRAMFIFOSIZE; n++)
+#ifdef __linux__
+            // back the RAM FIFO with one contiguous mapping on hugepages when
+            // some are preallocated (or transparent hugepages otherwise):
+            // fewer TLB misses while the capture thread copies at full DMA
+            // rate, and no page faults once the pool is touched here
+            if (buffer_pool == NULL)
+                {
+                    buffer_pool_bytes = static_cast<size_t>(IIO_INPUTRAMFIFOSIZE) * sizeof(ad936x_iio_samples);
+                    void *pool = mmap(NULL, buffer_pool_bytes, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                    if (pool == MAP_FAILED)
+                        {
+                            pool = mmap(NULL, buffer_pool_bytes, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#ifdef MADV_HUGEPAGE
+                            if (pool != MAP_FAILED)
+                                {
+                                    madvise(pool, buffer_pool_bytes, MADV_HUGEPAGE);
+                                }
+#endif
+                        }
+                    if (pool != MAP_FAILED)
+                        {
+                            buffer_pool = static_cast<char *>(pool);
+                            memset(buffer_pool, 0, buffer_pool_bytes);  // fault every page in before streaming starts
+                        }
+                }
+            if (buffer_pool != NULL)
                 {
-                    free_buffers.push(std::make_shared<ad936x_iio_samples>());
+                    for (int n = 0; n < IIO_INPUTRAMFIFOSIZE; n++)
+                        {
+                            auto *samples = new (buffer_pool + static_cast<size_t>(n) * sizeof(ad936x_iio_samples)) ad936x_iio_samples();
+                            // the pool owns the storage; it is unmapped in the destructor
+                            free_buffers.push(std::shared_ptr<ad936x_iio_samples>(samples, [](ad936x_iio_samples *) {}));
+                        }
+                }
+            else
+#endif
+                {
+                    for (int n = 0; n < IIO_INPUTRAMFIFOSIZE; n++)
+                        {
+                            free_buffers.push(std::make_shared<ad936x_iio_samples>());
+                        }
                 }
         }
     catch (const std::exception &ex)
@@ -1195,6 +1253,15 @@ void ad936x_iio_custom::capture(const std::vector<std::string> &channels)
               << " scale " << format->scale
               << " repeat " << format->repeat << "\n";
 
+    // queue several DMA blocks in the kernel so the hardware keeps streaming
+    // into the next block while this thread copies the current one out; with
+    // fewer blocks the copy boundary is exactly where samples get lost when
+    // the CPU falls behind (e.g. under thermal throttling)
+    if (iio_device_set_kernel_buffers_count(stream_dev, 8) != 0)
+        {
+            std::cerr << "Could not set the number of kernel buffers, using the driver default.\n";
+        }
+
     rxbuf = iio_device_create_buffer(stream_dev, IIO_DEFAULTAD936XAPIFIFOSIZE_SAMPLES, false);
     if (!rxbuf)
         {
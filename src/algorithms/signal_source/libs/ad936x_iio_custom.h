@@ -139,6 +139,10 @@ private:
     Concurrent_Queue<std::shared_ptr<ad936x_iio_samples>> free_buffers;
     Concurrent_Queue<std::shared_ptr<ad936x_iio_samples>> used_buffers;
 
+    // contiguous hugepage-backed mapping holding the preallocated buffers
+    char *buffer_pool;
+    size_t buffer_pool_bytes;
+
     std::thread capture_samples_thread;
     std::thread overflow_monitor_thread;
     std::thread capture_time_thread;
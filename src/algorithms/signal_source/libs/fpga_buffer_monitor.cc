@@ -34,16 +34,22 @@
 #include <utility>     // for move
 
 
+std::atomic<bool> Fpga_buffer_monitor::d_buffer_near_full(false);
+
+
 Fpga_buffer_monitor::Fpga_buffer_monitor(const std::string &device_name,
     uint32_t num_freq_bands,
     bool dump,
-    std::string dump_filename)
+    std::string dump_filename,
+    uint32_t occ_watermark_samples)
     : d_dump_filename(std::move(dump_filename)),
       d_num_freq_bands(num_freq_bands),
       d_max_buff_occ_freq_band_0(0),
       d_max_buff_occ_freq_band_1(0),
+      d_occ_watermark_samples(occ_watermark_samples),
       d_dump(dump)
 {
+    d_buffer_near_full.store(false, std::memory_order_relaxed);
     // open device descriptor
     if ((d_device_descriptor = open(device_name.c_str(), O_RDWR | O_SYNC)) == -1)
         {
@@ -170,6 +176,35 @@ void Fpga_buffer_monitor::check_buffer_overflow_and_monitor_buffer_status()
                 }
         }
 
+    // backpressure: compare the current buffer occupancy against the watermark
+    if (d_occ_watermark_samples > 0)
+        {
+            uint32_t current_buff_occ = d_map_base[current_buff_occ_freq_band_0_reg_addr] * num_sapmples_per_buffer_element;
+            if (d_num_freq_bands > 1)
+                {
+                    const uint32_t current_buff_occ_freq_band_1 = d_map_base[current_buff_occ_freq_band_1_reg_addr] * num_sapmples_per_buffer_element;
+                    if (current_buff_occ_freq_band_1 > current_buff_occ)
+                        {
+                            current_buff_occ = current_buff_occ_freq_band_1;
+                        }
+                }
+            if (current_buff_occ > d_occ_watermark_samples)
+                {
+                    if (!d_buffer_near_full.load(std::memory_order_relaxed))
+                        {
+                            LOG(WARNING) << "FPGA buffer occupancy (" << current_buff_occ
+                                         << " samples) above watermark, deferring acquisition sweeps";
+                        }
+                    d_buffer_near_full.store(true, std::memory_order_relaxed);
+                }
+            else if (current_buff_occ < d_occ_watermark_samples / 2)
+                {
+                    // hysteresis: release the acquisition backpressure only once
+                    // the buffer has drained well below the watermark
+                    d_buffer_near_full.store(false, std::memory_order_relaxed);
+                }
+        }
+
     // buffer monitor
     if (d_dump == 1)
         {
@@ -25,6 +25,7 @@
 #ifndef GNSS_SDR_FPGA_BUFFER_MONITOR_H
 #define GNSS_SDR_FPGA_BUFFER_MONITOR_H
 
+#include <atomic>   // for std::atomic
 #include <cstdint>  // for int32_t
 #include <fstream>  // for std::ofstream
 #include <string>   // for std::string
@@ -48,7 +49,8 @@ public:
     explicit Fpga_buffer_monitor(const std::string& device_name,
         uint32_t num_freq_bands,
         bool dump,
-        std::string dump_filename);
+        std::string dump_filename,
+        uint32_t occ_watermark_samples = 0);
 
     /*!
      * \brief Destructor
@@ -60,6 +62,18 @@ public:
      */
     void check_buffer_overflow_and_monitor_buffer_status();
 
+    /*!
+     * \brief Lock-free query of the backpressure flag set by the monitor when
+     * the buffer occupancy crosses the configured watermark. Acquisition
+     * blocks use it to defer grid sweeps until the buffer drains, preventing
+     * sample-loss events during bursts of software acquisition work. Always
+     * returns false if no watermark has been configured.
+     */
+    static bool buffer_near_full()
+    {
+        return d_buffer_near_full.load(std::memory_order_relaxed);
+    }
+
 private:
     static const size_t FPGA_PAGE_SIZE = 0x1000;
     static const uint32_t test_register_writeval = 0x55AA;
@@ -81,6 +95,10 @@ private:
     int32_t buffer_monitor_test_register();
     void close_device();
 
+    // backpressure flag shared with the acquisition blocks; there is a single
+    // buffer monitor instance per receiver, hence a static is sufficient
+    static std::atomic<bool> d_buffer_near_full;
+
     std::string d_dump_filename;
     std::ofstream d_dump_file;
 
@@ -92,6 +110,8 @@ private:
     uint32_t d_max_buff_occ_freq_band_0;
     uint32_t d_max_buff_occ_freq_band_1;
 
+    uint32_t d_occ_watermark_samples;
+
     bool d_dump;
 };
 
@@ -0,0 +1,102 @@
+/*!
+ * \file gnss_sdr_rx_time_tags.cc
+ * \brief GNURadio block that converts the rx_time hardware timestamps attached
+ * by gr-uhd to the sample stream into GnssTime timetags
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#include "gnss_sdr_rx_time_tags.h"
+#include "gnss_time.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>  // for io_signature
+#include <pmt/pmt.h>                // for make_any
+#include <pmt/pmt_sugar.h>          // for mp
+#include <cmath>                    // for modf
+#include <cstring>                  // for memcpy
+#include <memory>
+#include <vector>
+
+namespace
+{
+constexpr int64_t SECONDS_PER_WEEK = 604800LL;
+}
+
+
+Gnss_Sdr_Rx_Time_Tags::Gnss_Sdr_Rx_Time_Tags(size_t sizeof_stream_item, double device_time_to_gps_s)
+    : gr::sync_block("RxTimeTags",
+          gr::io_signature::make(1, 20, sizeof_stream_item),
+          gr::io_signature::make(1, 20, sizeof_stream_item)),
+      d_device_time_to_gps_s(device_time_to_gps_s),
+      d_tags_forwarded(0)
+{
+}
+
+
+gnss_shared_ptr<Gnss_Sdr_Rx_Time_Tags> gnss_sdr_make_rx_time_tags(size_t sizeof_stream_item, double device_time_to_gps_s)
+{
+    gnss_shared_ptr<Gnss_Sdr_Rx_Time_Tags> rx_time_tags_(new Gnss_Sdr_Rx_Time_Tags(sizeof_stream_item, device_time_to_gps_s));
+    return rx_time_tags_;
+}
+
+
+int Gnss_Sdr_Rx_Time_Tags::work(int noutput_items,
+    gr_vector_const_void_star& input_items,
+    gr_vector_void_star& output_items)
+{
+    for (size_t ch = 0; ch < output_items.size(); ch++)
+        {
+            std::memcpy(output_items[ch], input_items[ch], noutput_items * input_signature()->sizeof_stream_item(ch));
+
+            // the UHD source attaches an rx_time tag (tuple of integer and
+            // fractional device seconds) to the first sample of the stream and
+            // to the first sample received after an overflow
+            std::vector<gr::tag_t> tags_vec;
+            this->get_tags_in_range(tags_vec, ch, this->nitems_read(ch), this->nitems_read(ch) + noutput_items, pmt::mp("rx_time"));
+            for (const auto& it : tags_vec)
+                {
+                    if (!pmt::is_tuple(it.value) or pmt::length(it.value) != 2)
+                        {
+                            continue;
+                        }
+                    const auto full_secs = static_cast<int64_t>(pmt::to_uint64(pmt::tuple_ref(it.value, 0)));
+                    const double frac_secs = pmt::to_double(pmt::tuple_ref(it.value, 1));
+
+                    double offset_intpart;
+                    const double offset_frac = std::modf(d_device_time_to_gps_s, &offset_intpart);
+                    const int64_t gps_seconds = full_secs + static_cast<int64_t>(offset_intpart);
+
+                    double frac_ms_intpart;
+                    const double frac_ms = std::modf((frac_secs + offset_frac) * 1000.0, &frac_ms_intpart);
+
+                    const std::shared_ptr<GnssTime> tmp_obj = std::make_shared<GnssTime>(GnssTime());
+                    tmp_obj->week = static_cast<int>(gps_seconds / SECONDS_PER_WEEK);
+                    tmp_obj->tow_ms = static_cast<int>((gps_seconds % SECONDS_PER_WEEK) * 1000LL + static_cast<int64_t>(frac_ms_intpart));
+                    tmp_obj->tow_ms_fraction = frac_ms;
+                    tmp_obj->rx_time = 0;
+                    add_item_tag(ch, it.offset, pmt::mp("timetag"), pmt::make_any(tmp_obj));
+                    if (d_tags_forwarded > 0)
+                        {
+                            // after the stream-start tag, a new rx_time tag means the
+                            // device dropped samples; the regenerated timetag lets the
+                            // receiver time model absorb the jump downstream
+                            LOG(WARNING) << "rx_time tag received at sample " << it.offset
+                                         << " (overflow event), re-seeding receiver time with TOW "
+                                         << tmp_obj->tow_ms << " [ms]";
+                        }
+                    d_tags_forwarded++;
+                }
+        }
+
+    return noutput_items;
+}
@@ -0,0 +1,71 @@
+/*!
+ * \file gnss_sdr_rx_time_tags.h
+ * \brief GNURadio block that converts the rx_time hardware timestamps attached
+ * by gr-uhd to the sample stream into GnssTime timetags
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#ifndef GNSS_SDR_GNSS_SDR_RX_TIME_TAGS_H
+#define GNSS_SDR_GNSS_SDR_RX_TIME_TAGS_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/sync_block.h>  // for sync_block
+#include <gnuradio/types.h>       // for gr_vector_const_void_star
+#include <cstddef>                // for size_t
+#include <cstdint>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_libs
+ * \{ */
+
+
+class Gnss_Sdr_Rx_Time_Tags;
+
+gnss_shared_ptr<Gnss_Sdr_Rx_Time_Tags> gnss_sdr_make_rx_time_tags(
+    size_t sizeof_stream_item,
+    double device_time_to_gps_s);
+
+/*!
+ * \brief This class translates the rx_time stream tags produced by the gr-uhd
+ * source (at stream start and after every overflow) into the GnssTime timetags
+ * consumed by the tracking, observables and PVT blocks.
+ *
+ * The device clock is assumed to hold GPS seconds (see the hw_time_tags option
+ * of the UHD signal source); device_time_to_gps_s is an additional offset added
+ * to the tag timestamps before the week/TOW split, for devices whose clock was
+ * aligned to a different origin.
+ */
+class Gnss_Sdr_Rx_Time_Tags : public gr::sync_block
+{
+public:
+    int work(int noutput_items,
+        gr_vector_const_void_star& input_items,
+        gr_vector_void_star& output_items);
+
+private:
+    friend gnss_shared_ptr<Gnss_Sdr_Rx_Time_Tags> gnss_sdr_make_rx_time_tags(
+        size_t sizeof_stream_item,
+        double device_time_to_gps_s);
+
+    Gnss_Sdr_Rx_Time_Tags(size_t sizeof_stream_item, double device_time_to_gps_s);
+
+    double d_device_time_to_gps_s;
+    uint64_t d_tags_forwarded;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SDR_RX_TIME_TAGS_H
@@ -0,0 +1,73 @@
+/*!
+ * \file lz4_capture_container.h
+ * \brief On-disk layout of the chunked LZ4-compressed signal capture format.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * The container is a sequence of independently compressed blocks of a fixed
+ * uncompressed size, each prefixed by its compressed length, followed by an
+ * index of block offsets and a fixed-size footer:
+ *
+ *   [header][u32 len | block]...[u64 offset]...[footer]
+ *
+ * A reader locates the footer at (end - sizeof(footer)), loads the index and
+ * can then seek to any sample offset in O(1): the block holding byte N of the
+ * raw stream is simply block N / block_size.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_LZ4_CAPTURE_CONTAINER_H
+#define GNSS_SDR_LZ4_CAPTURE_CONTAINER_H
+
+#include <cstdint>
+#include <cstring>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_libs
+ * \{ */
+
+namespace lz4_capture
+{
+//! magic bytes opening the file and closing the footer
+constexpr char magic[8] = {'G', 'S', 'D', 'R', 'L', 'Z', '4', '\0'};
+
+constexpr uint32_t format_version = 1;
+
+//! uncompressed bytes per block; 1 MiB keeps the index small (8 bytes per
+//! MiB of raw capture) while staying well inside the L2 cache per refill
+constexpr uint32_t default_block_size = 1 << 20;
+
+//! all fields are little-endian and naturally aligned (no padding)
+struct file_header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t block_size;  // uncompressed bytes per block (last block may be short)
+    uint64_t item_size;   // bytes per stream item, for sanity checking on replay
+};
+
+struct file_footer
+{
+    uint64_t uncompressed_bytes;  // total raw payload bytes in the capture
+    uint64_t n_blocks;            // number of blocks (and of index entries)
+    char magic[8];
+};
+
+inline bool check_magic(const char *bytes)
+{
+    return std::memcmp(bytes, magic, sizeof(magic)) == 0;
+}
+}  // namespace lz4_capture
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_LZ4_CAPTURE_CONTAINER_H
@@ -30,6 +30,7 @@
 #include <gnuradio/io_signature.h>
 #include <pmt/pmt.h>        // for make_any
 #include <pmt/pmt_sugar.h>  // for mp
+#include <algorithm>        // for min
 #include <cstddef>          // for size_t
 #include <cstdlib>          // for abs
 #include <exception>        // for exception
@@ -76,8 +77,6 @@ beidou_b1i_telemetry_decoder_gs::beidou_b1i_telemetry_decoder_gs(
                             d_enable_navdata_monitor(conf.enable_navdata_monitor),
                             d_dump_crc_stats(conf.dump_crc_stats)
 {
-    // prevent telemetry symbols accumulation in output buffers
-    this->set_max_noutput_items(1);
     // Ephemeris data port out
     this->message_port_register_out(pmt::mp("telemetry"));
     // Control messages to tracking block
@@ -108,6 +107,7 @@ beidou_b1i_telemetry_decoder_gs::beidou_b1i_telemetry_decoder_gs(
         }
 
     d_symbol_history.set_capacity(d_required_symbols);
+    d_data_bits.reserve(BEIDOU_DNAV_WORDS_SUBFRAME * BEIDOU_DNAV_WORD_LENGTH_BITS);
 
     if (d_dump_crc_stats)
         {
@@ -242,8 +242,8 @@ void beidou_b1i_telemetry_decoder_gs::decode_word(
 void beidou_b1i_telemetry_decoder_gs::decode_subframe(float *frame_symbols)
 {
     // 1. Transform from symbols to bits
-    std::string data_bits;
-    data_bits.reserve(BEIDOU_DNAV_WORDS_SUBFRAME * BEIDOU_DNAV_WORD_LENGTH_BITS);
+    std::string &data_bits = d_data_bits;
+    data_bits.clear();
     std::array<int32_t, 30> dec_word_bits{};
 
     // Decode each word in subframe
@@ -431,37 +431,44 @@ void beidou_b1i_telemetry_decoder_gs::reset()
 }
 
 
-int beidou_b1i_telemetry_decoder_gs::general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items __attribute__((unused)),
+int beidou_b1i_telemetry_decoder_gs::general_work(int noutput_items, gr_vector_int &ninput_items,
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
-    int32_t corr_value = 0;
-    int32_t preamble_diff = 0;
-
     auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);            // Get the output buffer pointer
     const auto **in = reinterpret_cast<const Gnss_Synchro **>(&input_items[0]);  // Get the input buffer pointer
 
+    // process every symbol the scheduler delivered in a single call instead
+    // of paying one work() round-trip per symbol
+    const int nsym = std::min(noutput_items, ninput_items[0]);
+    int nout = 0;
+    for (int i = 0; i < nsym; i++)
+        {
+            if (process_symbol(in[0][i], out[0][nout]))
+                {
+                    nout++;
+                }
+        }
+    consume_each(nsym);
+    return nout;
+}
+
+
+bool beidou_b1i_telemetry_decoder_gs::process_symbol(const Gnss_Synchro &in_sym, Gnss_Synchro &out_sym)
+{
+    int32_t corr_value = 0;
+    int32_t preamble_diff = 0;
+
     Gnss_Synchro current_symbol{};  // structure to save the synchronization information and send the output object to the next block
     // 1. Copy the current tracking output
-    current_symbol = in[0][0];
+    current_symbol = in_sym;
     d_symbol_history.push_back(current_symbol.Prompt_I);  // add new symbol to the symbol queue
     d_sample_counter++;                                   // count for the processed samples
-    consume_each(1);
     d_flag_preamble = false;
 
     if (d_symbol_history.size() >= d_required_symbols)
         {
             // ******* preamble correlation ********
-            for (int32_t i = 0; i < d_samples_per_preamble; i++)
-                {
-                    if (d_symbol_history[i] < 0)  // symbols clipping
-                        {
-                            corr_value -= d_preamble_samples[i];
-                        }
-                    else
-                        {
-                            corr_value += d_preamble_samples[i];
-                        }
-                }
+            corr_value = correlate_preamble(d_symbol_history, d_preamble_samples.data(), d_samples_per_preamble);
         }
     // ******* frame sync ******************
     if (d_stat == 0)  // no preamble information
@@ -670,8 +677,8 @@ int beidou_b1i_telemetry_decoder_gs::general_work(int noutput_items __attribute_
                 }
 
             // 3. Make the output (copy the object contents to the GNURadio reserved memory)
-            *out[0] = current_symbol;
-            return 1;
+            out_sym = current_symbol;
+            return true;
         }
-    return 0;
+    return false;
 }
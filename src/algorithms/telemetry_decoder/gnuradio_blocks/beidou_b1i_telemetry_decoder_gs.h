@@ -41,6 +41,7 @@
  * \{ */
 
 
+class Gnss_Synchro;
 class beidou_b1i_telemetry_decoder_gs;
 
 using beidou_b1i_telemetry_decoder_gs_sptr = gnss_shared_ptr<beidou_b1i_telemetry_decoder_gs>;
@@ -79,11 +80,18 @@ private:
     void decode_word(int32_t word_counter, const float *enc_word_symbols, int32_t *dec_word_symbols);
     void decode_bch15_11_01(const int32_t *bits, std::array<int32_t, 15> &decbits);
 
+    //! processes one tracking symbol; returns true if out_sym carries a valid output
+    bool process_symbol(const Gnss_Synchro &in_sym, Gnss_Synchro &out_sym);
+
     // Preamble decoding
     std::array<int32_t, BEIDOU_DNAV_PREAMBLE_LENGTH_SYMBOLS> d_preamble_samples{};
 
     std::array<float, BEIDOU_DNAV_PREAMBLE_PERIOD_SYMBOLS> d_subframe_symbols{};
 
+    // scratch buffer reused by decode_subframe, allocated once to avoid
+    // per-subframe heap traffic
+    std::string d_data_bits;
+
     // Storage for incoming data
     boost::circular_buffer<float> d_symbol_history;
 
@@ -37,6 +37,7 @@
 #include <glog/logging.h>            // for LOG, DLOG
 #include <gnuradio/io_signature.h>   // for gr::io_signature::make
 #include <pmt/pmt_sugar.h>           // for pmt::mp
+#include <algorithm>                 // for std::min
 #include <array>                     // for std::array
 #include <cmath>                     // for std::fmod, std::abs
 #include <cstddef>                   // for size_t
@@ -108,8 +109,6 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
                       d_there_are_e6_channels(conf.there_are_e6_channels),
                       d_use_ced(conf.use_ced)
 {
-    // prevent telemetry symbols accumulation in output buffers
-    this->set_max_noutput_items(1);
     // Ephemeris data port out
     this->message_port_register_out(pmt::mp("telemetry"));
     // Control messages to tracking block
@@ -224,6 +223,9 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
         }
 
     d_page_part_symbols = std::vector<float>(d_frame_length_symbols);
+    d_page_symbols_soft_value = std::vector<float>(d_frame_length_symbols);
+    d_page_bits = std::vector<int32_t>(d_frame_length_symbols / 2);
+    d_page_String.reserve(d_frame_length_symbols / 2);
 
     for (int32_t i = 0; i < d_bits_per_preamble; i++)
         {
@@ -353,7 +355,7 @@ void galileo_telemetry_decoder_gs::deinterleaver(int32_t rows, int32_t cols, con
 void galileo_telemetry_decoder_gs::decode_INAV_word(float *page_part_symbols, int32_t frame_length)
 {
     // 1. De-interleave
-    std::vector<float> page_part_symbols_soft_value(frame_length);
+    std::vector<float> &page_part_symbols_soft_value = d_page_symbols_soft_value;
     deinterleaver(GALILEO_INAV_INTERLEAVER_ROWS, GALILEO_INAV_INTERLEAVER_COLS, page_part_symbols, page_part_symbols_soft_value.data());
 
     // 2. Viterbi decoder
@@ -366,12 +368,12 @@ void galileo_telemetry_decoder_gs::decode_INAV_word(float *page_part_symbols, in
                 }
         }
     const int32_t decoded_length = frame_length / 2;
-    std::vector<int32_t> page_part_bits(decoded_length);
+    std::vector<int32_t> &page_part_bits = d_page_bits;
     d_viterbi->decode(page_part_bits, page_part_symbols_soft_value);
 
     // 3. Call the Galileo page decoder
-    std::string page_String;
-    page_String.reserve(decoded_length);
+    std::string &page_String = d_page_String;
+    page_String.clear();
     for (int32_t i = 0; i < decoded_length; i++)
         {
             if (page_part_bits[i] > 0)
@@ -506,7 +508,7 @@ void galileo_telemetry_decoder_gs::decode_INAV_word(float *page_part_symbols, in
 void galileo_telemetry_decoder_gs::decode_FNAV_word(float *page_symbols, int32_t frame_length)
 {
     // 1. De-interleave
-    std::vector<float> page_symbols_soft_value(frame_length);
+    std::vector<float> &page_symbols_soft_value = d_page_symbols_soft_value;
     deinterleaver(GALILEO_FNAV_INTERLEAVER_ROWS, GALILEO_FNAV_INTERLEAVER_COLS, page_symbols, page_symbols_soft_value.data());
 
     // 2. Viterbi decoder
@@ -520,12 +522,12 @@ void galileo_telemetry_decoder_gs::decode_FNAV_word(float *page_symbols, int32_t
         }
 
     const int32_t decoded_length = frame_length / 2;
-    std::vector<int32_t> page_bits(decoded_length);
+    std::vector<int32_t> &page_bits = d_page_bits;
     d_viterbi->decode(page_bits, page_symbols_soft_value);
 
     // 3. Call the Galileo page decoder
-    std::string page_String;
-    page_String.reserve(decoded_length);
+    std::string &page_String = d_page_String;
+    page_String.clear();
     for (int32_t i = 0; i < decoded_length; i++)
         {
             if (page_bits[i] > 0)
@@ -581,7 +583,7 @@ void galileo_telemetry_decoder_gs::decode_FNAV_word(float *page_symbols, int32_t
 void galileo_telemetry_decoder_gs::decode_CNAV_word(uint64_t time_stamp, float *page_symbols, int32_t page_length)
 {
     // 1. De-interleave
-    std::vector<float> page_symbols_soft_value(page_length);
+    std::vector<float> &page_symbols_soft_value = d_page_symbols_soft_value;
     deinterleaver(GALILEO_CNAV_INTERLEAVER_ROWS, GALILEO_CNAV_INTERLEAVER_COLS, page_symbols, page_symbols_soft_value.data());
 
     // 2. Viterbi decoder
@@ -594,12 +596,12 @@ void galileo_telemetry_decoder_gs::decode_CNAV_word(uint64_t time_stamp, float *
                 }
         }
     const int32_t decoded_length = page_length / 2;
-    std::vector<int32_t> page_bits(decoded_length);
+    std::vector<int32_t> &page_bits = d_page_bits;
     d_viterbi->decode(page_bits, page_symbols_soft_value);
 
     // 3. Call the Galileo page decoder
-    std::string page_String;
-    page_String.reserve(decoded_length);
+    std::string &page_String = d_page_String;
+    page_String.clear();
     for (int32_t i = 0; i < decoded_length; i++)
         {
             if (page_bits[i] > 0)
@@ -741,15 +743,33 @@ void galileo_telemetry_decoder_gs::set_channel(int32_t channel)
 }
 
 
-int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items __attribute__((unused)),
+int galileo_telemetry_decoder_gs::general_work(int noutput_items, gr_vector_int &ninput_items,
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
     auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);            // Get the output buffer pointer
     const auto **in = reinterpret_cast<const Gnss_Synchro **>(&input_items[0]);  // Get the input buffer pointer
 
+    // process every symbol the scheduler delivered in a single call instead
+    // of paying one work() round-trip per symbol
+    const int nsym = std::min(noutput_items, ninput_items[0]);
+    int nout = 0;
+    for (int i = 0; i < nsym; i++)
+        {
+            if (process_symbol(in[0][i], this->nitems_read(0) + static_cast<uint64_t>(i), out[0][nout]))
+                {
+                    nout++;
+                }
+        }
+    consume_each(nsym);
+    return nout;
+}
+
+
+bool galileo_telemetry_decoder_gs::process_symbol(const Gnss_Synchro &in_sym, uint64_t abs_in_index, Gnss_Synchro &out_sym)
+{
     Gnss_Synchro current_symbol{};  // structure to save the synchronization information and send the output object to the next block
     // 1. Copy the current tracking output
-    current_symbol = in[0][0];
+    current_symbol = in_sym;
     d_band = current_symbol.Signal[0];
 
     // add new symbol to the symbol queue
@@ -759,7 +779,7 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
 
     // Time Tags from signal source (optional feature)
     std::vector<gr::tag_t> tags_vec;
-    this->get_tags_in_range(tags_vec, 0, this->nitems_read(0), this->nitems_read(0) + 1);  // telemetry decoder consumes symbols one-by-one
+    this->get_tags_in_range(tags_vec, 0, abs_in_index, abs_in_index + 1);  // telemetry decoder consumes symbols one-by-one
     if (!tags_vec.empty())
         {
             for (const auto &it : tags_vec)
@@ -800,7 +820,6 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
                 }
         }
 
-    consume_each(1);
     d_flag_preamble = false;
 
     // check if there is a problem with the telemetry of the current satellite
@@ -824,17 +843,7 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
             if (d_symbol_history.size() > d_required_symbols)
                 {
                     // ******* preamble correlation ********
-                    for (int32_t i = 0; i < d_samples_per_preamble; i++)
-                        {
-                            if (d_symbol_history[i] < 0.0)  // symbols clipping
-                                {
-                                    corr_value -= d_preamble_samples[i];
-                                }
-                            else
-                                {
-                                    corr_value += d_preamble_samples[i];
-                                }
-                        }
+                    corr_value = correlate_preamble(d_symbol_history, d_preamble_samples.data(), d_samples_per_preamble);
                     if (std::abs(corr_value) >= d_samples_per_preamble)
                         {
                             d_preamble_index = d_symbol_counter;  // record the preamble sample stamp
@@ -848,17 +857,7 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
             if (d_symbol_history.size() > d_required_symbols)
                 {
                     // ******* preamble correlation ********
-                    for (int32_t i = 0; i < d_samples_per_preamble; i++)
-                        {
-                            if (d_symbol_history[i] < 0.0)  // symbols clipping
-                                {
-                                    corr_value -= d_preamble_samples[i];
-                                }
-                            else
-                                {
-                                    corr_value += d_preamble_samples[i];
-                                }
-                        }
+                    corr_value = correlate_preamble(d_symbol_history, d_preamble_samples.data(), d_samples_per_preamble);
                     if (std::abs(corr_value) >= d_samples_per_preamble)
                         {
                             // check preamble separation
@@ -1285,8 +1284,8 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
                         }
                 }
             // 3. Make the output (copy the object contents to the GNURadio reserved memory)
-            *out[0] = current_symbol;
-            return 1;
+            out_sym = current_symbol;
+            return true;
         }
-    return 0;
+    return false;
 }
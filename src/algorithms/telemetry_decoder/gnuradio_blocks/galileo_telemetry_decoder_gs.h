@@ -46,6 +46,7 @@
 
 class Viterbi_Decoder;               // forward declaration
 class Tlm_CRC_Stats;                 // forward declaration
+class Gnss_Synchro;                  // forward declaration
 class galileo_telemetry_decoder_gs;  // forward declaration
 
 using galileo_telemetry_decoder_gs_sptr = gnss_shared_ptr<galileo_telemetry_decoder_gs>;
@@ -86,9 +87,17 @@ private:
     void decode_FNAV_word(float *page_symbols, int32_t frame_length);
     void decode_CNAV_word(uint64_t time_stamp, float *page_symbols, int32_t page_length);
 
+    //! processes one tracking symbol; returns true if out_sym carries a valid output
+    bool process_symbol(const Gnss_Synchro &in_sym, uint64_t abs_in_index, Gnss_Synchro &out_sym);
+
     std::unique_ptr<Viterbi_Decoder> d_viterbi;
     std::vector<int32_t> d_preamble_samples;
     std::vector<float> d_page_part_symbols;
+    // scratch buffers reused by the page decoders, allocated once to avoid
+    // per-page heap traffic
+    std::vector<float> d_page_symbols_soft_value;
+    std::vector<int32_t> d_page_bits;
+    std::string d_page_String;
 
     std::string d_dump_filename;
     std::ofstream d_dump_file;
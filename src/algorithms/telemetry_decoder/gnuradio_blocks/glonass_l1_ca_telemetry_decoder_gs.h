@@ -83,6 +83,9 @@ private:
 
     void decode_string(const double *symbols, int32_t frame_length);
 
+    //! processes one tracking symbol and writes the corresponding output to out_sym
+    void process_symbol(const Gnss_Synchro &in_sym, Gnss_Synchro &out_sym);
+
     // Help with coherent tracking
 
     // Preamble decoding
@@ -91,6 +94,12 @@ private:
     // Storage for incoming data
     boost::circular_buffer<Gnss_Synchro> d_symbol_history;
 
+    // scratch buffers reused by decode_string, allocated once to avoid
+    // per-string heap traffic
+    std::string d_bi_binary_code;
+    std::string d_relative_code;
+    std::string d_data_bits;
+
     // Navigation Message variable
     Glonass_Gnav_Navigation_Message d_nav;
 
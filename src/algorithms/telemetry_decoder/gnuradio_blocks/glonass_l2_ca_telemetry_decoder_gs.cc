@@ -26,6 +26,8 @@
 #include <gnuradio/io_signature.h>
 #include <pmt/pmt.h>        // for make_any
 #include <pmt/pmt_sugar.h>  // for mp
+#include <algorithm>        // for min
+#include <array>            // for array
 #include <cmath>            // for floor, round
 #include <cstddef>          // for size_t
 #include <cstdlib>          // for abs
@@ -63,8 +65,6 @@ glonass_l2_ca_telemetry_decoder_gs::glonass_l2_ca_telemetry_decoder_gs(
                             d_enable_navdata_monitor(conf.enable_navdata_monitor),
                             d_dump_crc_stats(conf.dump_crc_stats)
 {
-    // prevent telemetry symbols accumulation in output buffers
-    this->set_max_noutput_items(1);
     // Ephemeris data port out
     this->message_port_register_out(pmt::mp("telemetry"));
     // Control messages to tracking block
@@ -101,6 +101,9 @@ glonass_l2_ca_telemetry_decoder_gs::glonass_l2_ca_telemetry_decoder_gs(
         }
 
     d_symbol_history.set_capacity(GLONASS_GNAV_STRING_SYMBOLS);
+    d_bi_binary_code.reserve(GLONASS_GNAV_STRING_SYMBOLS / GLONASS_GNAV_TELEMETRY_SYMBOLS_PER_BIT);
+    d_relative_code.reserve(GLONASS_GNAV_STRING_BITS);
+    d_data_bits.reserve(GLONASS_GNAV_STRING_BITS + 1);
 
     if (d_dump_crc_stats)
         {
@@ -158,12 +161,12 @@ void glonass_l2_ca_telemetry_decoder_gs::decode_string(const double *frame_symbo
     int32_t chip_acc_counter = 0;
 
     // 1. Transform from symbols to bits
-    std::string bi_binary_code;
-    bi_binary_code.reserve(frame_length / GLONASS_GNAV_TELEMETRY_SYMBOLS_PER_BIT);
-    std::string relative_code;
-    relative_code.reserve(GLONASS_GNAV_STRING_BITS);
-    std::string data_bits;
-    data_bits.reserve(GLONASS_GNAV_STRING_BITS + 1);
+    std::string &bi_binary_code = d_bi_binary_code;
+    bi_binary_code.clear();
+    std::string &relative_code = d_relative_code;
+    relative_code.clear();
+    std::string &data_bits = d_data_bits;
+    data_bits.clear();
 
     // Group samples into bi-binary code
     for (int32_t i = 0; i < (frame_length); i++)
@@ -307,38 +310,46 @@ void glonass_l2_ca_telemetry_decoder_gs::set_channel(int32_t channel)
 }
 
 
-int glonass_l2_ca_telemetry_decoder_gs::general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items __attribute__((unused)),
+int glonass_l2_ca_telemetry_decoder_gs::general_work(int noutput_items, gr_vector_int &ninput_items,
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
-    int32_t corr_value = 0;
-    int32_t preamble_diff = 0;
-
     auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);            // Get the output buffer pointer
     const auto **in = reinterpret_cast<const Gnss_Synchro **>(&input_items[0]);  // Get the input buffer pointer
 
+    // process every symbol the scheduler delivered in a single call instead
+    // of paying one work() round-trip per symbol
+    const int nsym = std::min(noutput_items, ninput_items[0]);
+    for (int i = 0; i < nsym; i++)
+        {
+            process_symbol(in[0][i], out[0][i]);
+        }
+    consume_each(nsym);
+    return nsym;
+}
+
+
+void glonass_l2_ca_telemetry_decoder_gs::process_symbol(const Gnss_Synchro &in_sym, Gnss_Synchro &out_sym)
+{
+    int32_t corr_value = 0;
+    int32_t preamble_diff = 0;
+
     Gnss_Synchro current_symbol{};  // structure to save the synchronization information and send the output object to the next block
     // 1. Copy the current tracking output
-    current_symbol = in[0][0];
+    current_symbol = in_sym;
     d_symbol_history.push_back(current_symbol);  // add new symbol to the symbol queue
     d_sample_counter++;                          // count for the processed samples
-    consume_each(1);
 
     d_flag_preamble = false;
 
     if (static_cast<int32_t>(d_symbol_history.size()) >= d_symbols_per_preamble)
         {
             // ******* preamble correlation ********
+            std::array<float, GLONASS_GNAV_PREAMBLE_LENGTH_SYMBOLS> prompt_history{};
             for (int32_t i = 0; i < d_symbols_per_preamble; i++)
                 {
-                    if (d_symbol_history[i].Prompt_I < 0.0)  // symbols clipping
-                        {
-                            corr_value -= d_preambles_symbols[i];
-                        }
-                    else
-                        {
-                            corr_value += d_preambles_symbols[i];
-                        }
+                    prompt_history[i] = static_cast<float>(d_symbol_history[i].Prompt_I);
                 }
+            corr_value = correlate_preamble(prompt_history.data(), d_preambles_symbols.data(), d_symbols_per_preamble);
         }
 
     // ******* frame sync ******************
@@ -504,7 +515,5 @@ int glonass_l2_ca_telemetry_decoder_gs::general_work(int noutput_items __attribu
         }
 
     // 3. Make the output (copy the object contents to the GNURadio reserved memory)
-    *out[0] = current_symbol;
-
-    return 1;
+    out_sym = current_symbol;
 }
@@ -81,9 +81,18 @@ private:
 
     void decode_string(const double *symbols, int32_t frame_length);
 
+    //! processes one tracking symbol and writes the corresponding output to out_sym
+    void process_symbol(const Gnss_Synchro &in_sym, Gnss_Synchro &out_sym);
+
     // Storage for incoming data
     boost::circular_buffer<Gnss_Synchro> d_symbol_history;
 
+    // scratch buffers reused by decode_string, allocated once to avoid
+    // per-string heap traffic
+    std::string d_bi_binary_code;
+    std::string d_relative_code;
+    std::string d_data_bits;
+
     std::array<int32_t, GLONASS_GNAV_PREAMBLE_LENGTH_SYMBOLS> d_preambles_symbols{};
 
     // Navigation Message variable
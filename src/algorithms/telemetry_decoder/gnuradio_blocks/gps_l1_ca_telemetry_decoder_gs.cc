@@ -23,11 +23,13 @@
 #include "gps_ephemeris.h"         // for Gps_Ephemeris
 #include "gps_iono.h"              // for Gps_Iono
 #include "gps_utc_model.h"         // for Gps_Utc_Model
+#include "tlm_bit_prediction.h"    // for TlmBitPrediction
 #include "tlm_utils.h"
 #include <glog/logging.h>
 #include <gnuradio/io_signature.h>
 #include <pmt/pmt.h>        // for make_any
 #include <pmt/pmt_sugar.h>  // for mp
+#include <algorithm>        // for min
 #include <bitset>           // for bitset
 #include <cmath>            // for round
 #include <cstddef>          // for size_t
@@ -95,8 +97,6 @@ gps_l1_ca_telemetry_decoder_gs::gps_l1_ca_telemetry_decoder_gs(
                             d_enable_navdata_monitor(conf.enable_navdata_monitor),
                             d_dump_crc_stats(conf.dump_crc_stats)
 {
-    // prevent telemetry symbols accumulation in output buffers
-    this->set_max_noutput_items(1);
     // Ephemeris data port out
     this->message_port_register_out(pmt::mp("telemetry"));
     // Control messages to tracking block
@@ -184,12 +184,15 @@ gps_l1_ca_telemetry_decoder_gs::~gps_l1_ca_telemetry_decoder_gs()
 }
 
 
-bool gps_l1_ca_telemetry_decoder_gs::gps_word_parityCheck(uint32_t gpsword)
+uint32_t gps_l1_ca_telemetry_decoder_gs::compute_word_parity(uint32_t gpsword)
 {
     // XOR as many bits in parallel as possible.  The magic constants pick
     //   up bits which are to be XOR'ed together to implement the GPS parity
-    //   check algorithm described in IS-GPS-200M.  This avoids lengthy shift-
-    //   and-xor loops.
+    //   algorithm described in IS-GPS-200M.  This avoids lengthy shift-
+    //   and-xor loops.  The parity computation only involves bits 6 to 31
+    //   (the data bits and the two trailing parity bits of the previous
+    //   word), so the same routine serves for checking a received word and
+    //   for re-encoding a predicted one.
     const uint32_t d1 = gpsword & 0xFBFFBF00U;
     const uint32_t d2 = my_rotl::rotl(gpsword, 1U) & 0x07FFBF01U;
     const uint32_t d3 = my_rotl::rotl(gpsword, 2U) & 0xFC0F8100U;
@@ -199,14 +202,14 @@ bool gps_l1_ca_telemetry_decoder_gs::gps_word_parityCheck(uint32_t gpsword)
     const uint32_t d7 = my_rotl::rotl(gpsword, 6U) & 0x00003000U;
     const uint32_t t = d1 ^ d2 ^ d3 ^ d4 ^ d5 ^ d6 ^ d7;
     // Now XOR the 5 6-bit fields together to produce the 6-bit final result.
-    uint32_t parity = t ^ my_rotl::rotl(t, 6U) ^ my_rotl::rotl(t, 12U) ^ my_rotl::rotl(t, 18U) ^ my_rotl::rotl(t, 24U);
-    parity = parity & 0x3FU;
-    if (parity == (gpsword & 0x3FU))
-        {
-            return true;
-        }
+    const uint32_t parity = t ^ my_rotl::rotl(t, 6U) ^ my_rotl::rotl(t, 12U) ^ my_rotl::rotl(t, 18U) ^ my_rotl::rotl(t, 24U);
+    return parity & 0x3FU;
+}
 
-    return false;
+
+bool gps_l1_ca_telemetry_decoder_gs::gps_word_parityCheck(uint32_t gpsword)
+{
+    return compute_word_parity(gpsword) == (gpsword & 0x3FU);
 }
 
 
@@ -317,6 +320,7 @@ bool gps_l1_ca_telemetry_decoder_gs::decode_subframe(bool flag_invert)
                     // add word to subframe
                     // insert the word in the correct position of the subframe
                     std::memcpy(&subframe[word_index * GPS_WORD_LENGTH], &GPS_frame_4bytes, sizeof(uint32_t));
+                    d_subframe_words[word_index] = GPS_frame_4bytes;  // keep the raw words for publish_bit_prediction()
                     word_index++;
                     d_prev_GPS_frame_4bytes = GPS_frame_4bytes;  // save the actual frame
                     GPS_frame_4bytes = 0;
@@ -408,6 +412,83 @@ bool gps_l1_ca_telemetry_decoder_gs::decode_subframe(bool flag_invert)
 }
 
 
+void gps_l1_ca_telemetry_decoder_gs::publish_bit_prediction(const Gnss_Synchro &current_symbol)
+{
+    // The first two words of the upcoming subframe are deterministic: the TLM
+    // word is repeated from one subframe to the next (word 10 forces its two
+    // trailing parity bits to zero, so the parity chain restarts at every
+    // subframe), the truncated TOW of the HOW advances by one count and the
+    // subframe ID cycles from 1 to 5.  Re-encoding them yields 60 bits
+    // (1.2 s) known in advance, which the tracking block can use to extend
+    // the coherent integration across the data bit boundaries (see
+    // dll_pll_veml_tracking::msg_handler_telemetry_to_trk)
+    const uint32_t tlm_word = d_subframe_words[0];
+    const uint32_t how_word = d_subframe_words[1];
+
+    // HOW data bits of the upcoming subframe (kept shifted by 6, as stored)
+    uint32_t tow_trunc = (how_word >> 13U) & 0x1FFFFU;
+    tow_trunc = (tow_trunc + 1U) % 100800U;  // 6-second counts in a week
+    const uint32_t subframe_id = (how_word >> 8U) & 0x7U;
+    const uint32_t next_subframe_id = (subframe_id % 5U) + 1U;
+    uint32_t how_data = (tow_trunc << 13U) | (how_word & 0x1800U) | (next_subframe_id << 8U);
+
+    // parity chain: the HOW follows the TLM word within the same subframe
+    const uint32_t prev_bits = ((tlm_word & 0x2U) << 30U) | ((tlm_word & 0x1U) << 30U);
+
+    // solve the two non-information bits of the HOW so that its two trailing
+    // parity bits are zero, as required by IS-GPS-200M (the parity equations
+    // are triangular in these two bits, so a solution always exists)
+    uint32_t how_parity = 0;
+    for (uint32_t non_info_bits = 0; non_info_bits < 4U; non_info_bits++)
+        {
+            const uint32_t candidate = how_data | (non_info_bits << 6U);
+            const uint32_t parity = compute_word_parity(prev_bits | candidate);
+            if ((parity & 0x3U) == 0U)
+                {
+                    how_data = candidate;
+                    how_parity = parity;
+                    break;
+                }
+        }
+
+    // assemble the predicted symbol signs, in transmission order. The TLM
+    // word is broadcast verbatim because its preceding parity bits are zero
+    const auto prediction = std::make_shared<TlmBitPrediction>();
+    prediction->bit_signs.reserve(2 * GPS_WORD_BITS);
+    for (int32_t i = GPS_WORD_BITS - 1; i >= 0; i--)
+        {
+            const bool bit = ((tlm_word >> static_cast<uint32_t>(i)) & 0x1U) == 1U;
+            prediction->bit_signs.push_back(bit ? 1.0F : -1.0F);
+        }
+    const bool invert_how = ((tlm_word & 0x1U) == 1U);  // the HOW data bits are broadcast XORed with the last parity bit of the TLM word
+    for (int32_t i = GPS_WORD_BITS - 1; i >= 6; i--)
+        {
+            const bool bit = (((how_data >> static_cast<uint32_t>(i)) & 0x1U) == 1U) != invert_how;
+            prediction->bit_signs.push_back(bit ? 1.0F : -1.0F);
+        }
+    for (int32_t i = 5; i >= 0; i--)
+        {
+            const bool bit = ((how_parity >> static_cast<uint32_t>(i)) & 0x1U) == 1U;
+            prediction->bit_signs.push_back(bit ? 1.0F : -1.0F);
+        }
+    if (d_flag_PLL_180_deg_phase_locked)
+        {
+            // tracking sees the symbols with inverted polarity
+            for (auto &sign : prediction->bit_signs)
+                {
+                    sign = -sign;
+                }
+        }
+
+    // the first predicted bit starts right after the current symbol, which is
+    // the last one of the subframe just decoded
+    const auto samples_per_bit = static_cast<uint64_t>(std::llround(static_cast<double>(current_symbol.fs) * GPS_L1_CA_BIT_PERIOD_MS / 1000.0));
+    prediction->first_bit_sample_counter = current_symbol.Tracking_sample_counter + samples_per_bit;
+
+    this->message_port_pub(pmt::mp("telemetry_to_trk"), pmt::make_any(prediction));
+}
+
+
 void gps_l1_ca_telemetry_decoder_gs::reset()
 {
     gr::thread::scoped_lock lock(d_setlock);  // require mutex with work function called by the scheduler
@@ -420,15 +501,33 @@ void gps_l1_ca_telemetry_decoder_gs::reset()
 }
 
 
-int gps_l1_ca_telemetry_decoder_gs::general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items __attribute__((unused)),
+int gps_l1_ca_telemetry_decoder_gs::general_work(int noutput_items, gr_vector_int &ninput_items,
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
     auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);            // Get the output buffer pointer
     const auto **in = reinterpret_cast<const Gnss_Synchro **>(&input_items[0]);  // Get the input buffer pointer
 
+    // process every symbol the scheduler delivered in a single call instead
+    // of paying one work() round-trip per 20 ms symbol
+    const int nsym = std::min(noutput_items, ninput_items[0]);
+    int nout = 0;
+    for (int i = 0; i < nsym; i++)
+        {
+            if (process_symbol(in[0][i], this->nitems_read(0) + static_cast<uint64_t>(i), this->nitems_written(0) + static_cast<uint64_t>(nout), out[0][nout]))
+                {
+                    nout++;
+                }
+        }
+    consume_each(nsym);
+    return nout;
+}
+
+
+bool gps_l1_ca_telemetry_decoder_gs::process_symbol(const Gnss_Synchro &in_sym, uint64_t abs_in_index, uint64_t abs_out_index, Gnss_Synchro &out_sym)
+{
     Gnss_Synchro current_symbol{};
     // 1. Copy the current tracking output
-    current_symbol = in[0][0];
+    current_symbol = in_sym;
     if (d_symbol_history.empty())
         {
             // Tracking synchronizes the tlm bit boundaries by acquiring the preamble
@@ -451,7 +550,6 @@ int gps_l1_ca_telemetry_decoder_gs::general_work(int noutput_items __attribute__
     d_symbol_history.push_back(current_symbol.Prompt_I);
 
     d_sample_counter++;  // count for the processed symbols
-    consume_each(1);
     d_flag_preamble = false;
     // check if there is a problem with the telemetry of the current satellite
     if (d_stat < 2 && d_sent_tlm_failed_msg == false)
@@ -474,17 +572,7 @@ int gps_l1_ca_telemetry_decoder_gs::general_work(int noutput_items __attribute__
                 if (d_symbol_history.size() >= d_required_symbols)
                     {
                         // ******* preamble correlation ********
-                        for (int32_t i = 0; i < GPS_CA_PREAMBLE_LENGTH_BITS; i++)
-                            {
-                                if (d_symbol_history[i] < 0.0)  // symbols clipping
-                                    {
-                                        corr_value -= d_preamble_samples[i];
-                                    }
-                                else
-                                    {
-                                        corr_value += d_preamble_samples[i];
-                                    }
-                            }
+                        corr_value = correlate_preamble(d_symbol_history, d_preamble_samples.data(), GPS_CA_PREAMBLE_LENGTH_BITS);
                     }
                 if (abs(corr_value) >= d_samples_per_preamble)
                     {
@@ -564,6 +652,7 @@ int gps_l1_ca_telemetry_decoder_gs::general_work(int noutput_items __attribute__
                     d_TOW_at_current_symbol_ms = static_cast<uint32_t>(d_nav.get_TOW() * 1000.0);
                     d_TOW_at_Preamble_ms = static_cast<uint32_t>(d_nav.get_TOW() * 1000.0);
                     d_flag_TOW_set = true;
+                    publish_bit_prediction(current_symbol);
                 }
             else
                 {
@@ -605,7 +694,8 @@ int gps_l1_ca_telemetry_decoder_gs::general_work(int noutput_items __attribute__
 
             // time tags
             std::vector<gr::tag_t> tags_vec;
-            this->get_tags_in_range(tags_vec, 0, this->nitems_read(0), this->nitems_read(0) + 1);
+            // the original one-symbol work() consumed before looking the tag up, so the range is one past the current symbol
+            this->get_tags_in_range(tags_vec, 0, abs_in_index + 1, abs_in_index + 2);
             for (const auto &it : tags_vec)
                 {
                     try
@@ -615,7 +705,7 @@ int gps_l1_ca_telemetry_decoder_gs::general_work(int noutput_items __attribute__
                                     const auto timetag = wht::any_cast<const std::shared_ptr<GnssTime>>(pmt::any_ref(it.value));
                                     // std::cout << "[" << this->nitems_written(0) + 1 << "] TLM RX TimeTag Week: " << timetag->week << ", TOW: " << timetag->tow_ms << " [ms], TOW fraction: " << timetag->tow_ms_fraction
                                     //           << " [ms], DELTA TLM TOW: " << static_cast<double>(timetag->tow_ms - current_symbol.TOW_at_current_symbol_ms) + timetag->tow_ms_fraction << " [ms] \n";
-                                    add_item_tag(0, this->nitems_written(0) + 1, pmt::mp("timetag"), pmt::make_any(timetag));
+                                    add_item_tag(0, abs_out_index + 1, pmt::mp("timetag"), pmt::make_any(timetag));
                                 }
                             else
                                 {
@@ -653,10 +743,10 @@ int gps_l1_ca_telemetry_decoder_gs::general_work(int noutput_items __attribute__
                 }
 
             // 3. Make the output (copy the object contents to the GNU Radio reserved memory)
-            *out[0] = current_symbol;
+            out_sym = current_symbol;
 
-            return 1;
+            return true;
         }
 
-    return 0;
+    return false;
 }
@@ -74,14 +74,22 @@ private:
     gps_l1_ca_telemetry_decoder_gs(const Gnss_Satellite &satellite, const Tlm_Conf &conf);
 
     bool gps_word_parityCheck(uint32_t gpsword);
+    uint32_t compute_word_parity(uint32_t gpsword);
     bool decode_subframe(bool flag_invert);
 
+    //! processes one tracking symbol; returns true if out_sym carries a valid output
+    bool process_symbol(const Gnss_Synchro &in_sym, uint64_t abs_in_index, uint64_t abs_out_index, Gnss_Synchro &out_sym);
+
+    //! forecasts the TLM and HOW bits of the upcoming subframe and sends them to tracking
+    void publish_bit_prediction(const Gnss_Synchro &current_symbol);
+
     Gps_Navigation_Message d_nav;
     Gnss_Satellite d_satellite;
     Nav_Message_Packet d_nav_msg_packet;
     std::unique_ptr<Tlm_CRC_Stats> d_Tlm_CRC_Stats;
 
     std::array<int32_t, GPS_CA_PREAMBLE_LENGTH_BITS> d_preamble_samples{};
+    std::array<uint32_t, GPS_SUBFRAME_BITS / GPS_WORD_BITS> d_subframe_words{};
 
     std::string d_dump_filename;
     std::ofstream d_dump_file;
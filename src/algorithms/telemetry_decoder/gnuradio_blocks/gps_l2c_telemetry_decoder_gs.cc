@@ -28,6 +28,7 @@
 #include <gnuradio/io_signature.h>
 #include <pmt/pmt.h>        // for make_any
 #include <pmt/pmt_sugar.h>  // for mp
+#include <algorithm>        // for min
 #include <bitset>           // for bitset
 #include <cmath>            // for round
 #include <cstddef>          // for size_t
@@ -48,6 +49,7 @@ gps_l2c_telemetry_decoder_gs::gps_l2c_telemetry_decoder_gs(
     const Tlm_Conf &conf) : gr::block("gps_l2c_telemetry_decoder_gs",
                                 gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)),
                                 gr::io_signature::make(1, 1, sizeof(Gnss_Synchro))),
+                            d_cnav_decoder(conf.dump_crc_stats),
                             d_dump_filename(conf.dump_filename),
                             d_TOW_at_current_symbol(0),
                             d_TOW_at_Preamble(0),
@@ -63,8 +65,6 @@ gps_l2c_telemetry_decoder_gs::gps_l2c_telemetry_decoder_gs(
                             d_enable_navdata_monitor(conf.enable_navdata_monitor),
                             d_dump_crc_stats(conf.dump_crc_stats)
 {
-    // prevent telemetry symbols accumulation in output buffers
-    this->set_max_noutput_items(1);
     // Ephemeris data port out
     this->message_port_register_out(pmt::mp("telemetry"));
     // Control messages to tracking block
@@ -83,9 +83,6 @@ gps_l2c_telemetry_decoder_gs::gps_l2c_telemetry_decoder_gs(
     d_satellite = Gnss_Satellite(satellite.get_system(), satellite.get_PRN());
     DLOG(INFO) << "GPS L2C M TELEMETRY PROCESSING: satellite " << d_satellite;
 
-    // initialize the CNAV frame decoder (libswiftcnav)
-    cnav_msg_decoder_init(&d_cnav_decoder);
-
     if (d_dump_crc_stats)
         {
             // initialize the telemetry CRC statistics class
@@ -184,32 +181,47 @@ void gps_l2c_telemetry_decoder_gs::reset()
 }
 
 
-int gps_l2c_telemetry_decoder_gs::general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items __attribute__((unused)),
+int gps_l2c_telemetry_decoder_gs::general_work(int noutput_items, gr_vector_int &ninput_items,
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
     // get pointers on in- and output gnss-synchro objects
     auto *out = reinterpret_cast<Gnss_Synchro *>(output_items[0]);            // Get the output buffer pointer
     const auto *in = reinterpret_cast<const Gnss_Synchro *>(input_items[0]);  // Get the input buffer pointer
 
-    bool flag_new_cnav_frame = false;
-    cnav_msg_t msg;
-    uint32_t delay = 0;
-
-    // add the symbol to the decoder
-    const uint8_t symbol_clip = static_cast<uint8_t>(in[0].Prompt_I > 0) * 255;
-    flag_new_cnav_frame = cnav_msg_decoder_add_symbol(&d_cnav_decoder, symbol_clip, &msg, &delay);
-    if (d_dump_crc_stats && (d_cnav_decoder.part1.message_lock || d_cnav_decoder.part2.message_lock))
+    // process every symbol the scheduler delivered in a single call instead
+    // of paying one work() round-trip per symbol
+    const int nsym = std::min(noutput_items, ninput_items[0]);
+    for (int i = 0; i < nsym; i++)
         {
-            // update CRC statistics
-            d_Tlm_CRC_Stats->update_CRC_stats((d_cnav_decoder.part1.crc_ok || d_cnav_decoder.part2.crc_ok));
-            d_cnav_decoder.part1.message_lock = false;
-            d_cnav_decoder.part2.message_lock = false;
+            process_symbol(in[i], out[i]);
         }
+    consume_each(nsym);
+    return nsym;
+}
 
-    consume_each(1);  // one by one
 
+void gps_l2c_telemetry_decoder_gs::process_symbol(const Gnss_Synchro &in_sym, Gnss_Synchro &out_sym)
+{
     // check if there is a problem with the telemetry of the current satellite
     d_sample_counter++;  // count for the processed symbols
+
+    // queue the symbol to the decoder worker thread, so the Viterbi update
+    // never runs on the scheduler thread, and collect its pending results
+    const uint8_t symbol_clip = static_cast<uint8_t>(in_sym.Prompt_I > 0) * 255;
+    d_cnav_decoder.push_symbol(symbol_clip, d_sample_counter);
+
+    if (d_dump_crc_stats)
+        {
+            bool crc_ok = false;
+            while (d_cnav_decoder.try_pop_crc(crc_ok))
+                {
+                    // update CRC statistics
+                    d_Tlm_CRC_Stats->update_CRC_stats(crc_ok);
+                }
+        }
+
+    Tlm_CNAV_Async_Decoder::Frame frame;
+    const bool flag_new_cnav_frame = d_cnav_decoder.try_pop_frame(frame);
     if (d_sent_tlm_failed_msg == false)
         {
             if ((d_sample_counter - d_last_valid_preamble) > d_max_symbols_without_valid_frame)
@@ -224,25 +236,18 @@ int gps_l2c_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
     Gnss_Synchro current_synchro_data{};  // structure to save the synchronization information and send the output object to the next block
 
     // 1. Copy the current tracking output
-    current_synchro_data = in[0];
+    current_synchro_data = in_sym;
 
     // 2. Add the telemetry decoder information
     // check if new CNAV frame is available
     if (flag_new_cnav_frame == true)
         {
-            if (d_cnav_decoder.part1.invert == true || d_cnav_decoder.part2.invert == true)
-                {
-                    d_flag_PLL_180_deg_phase_locked = true;
-                }
-            else
-                {
-                    d_flag_PLL_180_deg_phase_locked = false;
-                }
+            d_flag_PLL_180_deg_phase_locked = frame.invert;
             std::bitset<GPS_L2_CNAV_DATA_PAGE_BITS> raw_bits;
             // Expand packet bits to bitsets. Notice the reverse order of the bits sequence, required by the CNAV message decoder
             for (uint32_t i = 0; i < GPS_L2_CNAV_DATA_PAGE_BITS; i++)
                 {
-                    raw_bits[GPS_L2_CNAV_DATA_PAGE_BITS - 1 - i] = ((msg.raw_msg[i / 8] >> (7 - i % 8)) & 1U);
+                    raw_bits[GPS_L2_CNAV_DATA_PAGE_BITS - 1 - i] = ((frame.msg.raw_msg[i / 8] >> (7 - i % 8)) & 1U);
                 }
 
             if (d_enable_navdata_monitor)
@@ -275,13 +280,15 @@ int gps_l2c_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
                 }
 
             // update TOW at the preamble instant
-            d_TOW_at_Preamble = static_cast<double>(msg.tow);
-            d_last_valid_preamble = d_sample_counter;
+            d_TOW_at_Preamble = static_cast<double>(frame.msg.tow);
+            d_last_valid_preamble = frame.symbol_counter;
             // The time of the last input symbol can be computed from the message ToW and
             // delay by the formulae:
             // \code
             // symbolTime_ms = msg->tow * 6000 + *pdelay * 20 + (12 * 20); 12 symbols of the encoder's transitory
-            d_TOW_at_current_symbol = static_cast<double>(msg.tow) * 6.0 + static_cast<double>(delay) * GPS_L2_M_PERIOD_S + 12 * GPS_L2_M_PERIOD_S;
+            // The frame may have completed a few symbols ago in the worker thread,
+            // so refer its ToW to the current symbol
+            d_TOW_at_current_symbol = static_cast<double>(frame.msg.tow) * 6.0 + static_cast<double>(frame.delay) * GPS_L2_M_PERIOD_S + 12 * GPS_L2_M_PERIOD_S + static_cast<double>(d_sample_counter - frame.symbol_counter) * GPS_L2_M_PERIOD_S;
             // d_TOW_at_current_symbol = floor(d_TOW_at_current_symbol * 1000.0) / 1000.0;
             d_flag_valid_word = true;
 
@@ -343,6 +350,5 @@ int gps_l2c_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
         }
 
     // 3. Make the output (copy the object contents to the GNURadio reserved memory)
-    out[0] = current_synchro_data;
-    return 1;
+    out_sym = current_synchro_data;
 }
@@ -22,6 +22,7 @@
 #include "gnss_satellite.h"
 #include "gps_cnav_navigation_message.h"
 #include "nav_message_packet.h"
+#include "tlm_cnav_async_decoder.h"
 #include "tlm_conf.h"
 #include "tlm_crc_stats.h"
 #include <gnuradio/block.h>
@@ -31,17 +32,13 @@
 #include <memory>  // for std::unique_ptr
 #include <string>
 
-extern "C"
-{
-#include "cnav_msg.h"
-}
-
 /** \addtogroup Telemetry_Decoder
  * \{ */
 /** \addtogroup Telemetry_Decoder_gnuradio_blocks
  * \{ */
 
 
+class Gnss_Synchro;
 class gps_l2c_telemetry_decoder_gs;
 
 using gps_l2c_telemetry_decoder_gs_sptr = gnss_shared_ptr<gps_l2c_telemetry_decoder_gs>;
@@ -74,9 +71,12 @@ private:
 
     gps_l2c_telemetry_decoder_gs(const Gnss_Satellite &satellite, const Tlm_Conf &conf);
 
+    //! processes one tracking symbol and writes the corresponding output to out_sym
+    void process_symbol(const Gnss_Synchro &in_sym, Gnss_Synchro &out_sym);
+
     Gnss_Satellite d_satellite;
 
-    cnav_msg_decoder_t d_cnav_decoder{};
+    Tlm_CNAV_Async_Decoder d_cnav_decoder;
 
     Gps_CNAV_Navigation_Message d_CNAV_Message;
 
@@ -27,6 +27,7 @@
 #include <gnuradio/io_signature.h>
 #include <pmt/pmt.h>        // for make_any
 #include <pmt/pmt_sugar.h>  // for mp
+#include <algorithm>        // for std::min
 #include <bitset>           // for std::bitset
 #include <cstddef>          // for size_t
 #include <cstdlib>          // for std::llabs
@@ -45,6 +46,7 @@ gps_l5_telemetry_decoder_gs::gps_l5_telemetry_decoder_gs(
     const Tlm_Conf &conf) : gr::block("gps_l5_telemetry_decoder_gs",
                                 gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)),
                                 gr::io_signature::make(1, 1, sizeof(Gnss_Synchro))),
+                            d_cnav_decoder(conf.dump_crc_stats),
                             d_dump_filename(conf.dump_filename),
                             d_sample_counter(0),
                             d_last_valid_preamble(0),
@@ -60,8 +62,6 @@ gps_l5_telemetry_decoder_gs::gps_l5_telemetry_decoder_gs(
                             d_enable_navdata_monitor(conf.enable_navdata_monitor),
                             d_dump_crc_stats(conf.dump_crc_stats)
 {
-    // prevent telemetry symbols accumulation in output buffers
-    this->set_max_noutput_items(1);
     // Ephemeris data port out
     this->message_port_register_out(pmt::mp("telemetry"));
     // Control messages to tracking block
@@ -80,9 +80,6 @@ gps_l5_telemetry_decoder_gs::gps_l5_telemetry_decoder_gs(
     d_satellite = Gnss_Satellite(satellite.get_system(), satellite.get_PRN());
     DLOG(INFO) << "GPS L5 TELEMETRY PROCESSING: satellite " << d_satellite;
 
-    // initialize the CNAV frame decoder (libswiftcnav)
-    cnav_msg_decoder_init(&d_cnav_decoder);
-
     if (d_dump_crc_stats)
         {
             // initialize the telemetry CRC statistics class
@@ -186,18 +183,35 @@ void gps_l5_telemetry_decoder_gs::reset()
 }
 
 
-int gps_l5_telemetry_decoder_gs::general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items __attribute__((unused)),
+int gps_l5_telemetry_decoder_gs::general_work(int noutput_items, gr_vector_int &ninput_items,
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
     // get pointers on in- and output gnss-synchro objects
     auto *out = reinterpret_cast<Gnss_Synchro *>(output_items[0]);            // Get the output buffer pointer
     const auto *in = reinterpret_cast<const Gnss_Synchro *>(input_items[0]);  // Get the input buffer pointer
 
+    // process every symbol the scheduler delivered in a single call instead
+    // of paying one work() round-trip per symbol
+    const int nsym = std::min(noutput_items, ninput_items[0]);
+    int nout = 0;
+    for (int i = 0; i < nsym; i++)
+        {
+            if (process_symbol(in[i], out[nout]))
+                {
+                    nout++;
+                }
+        }
+    consume_each(nsym);
+    return nout;
+}
+
+
+bool gps_l5_telemetry_decoder_gs::process_symbol(const Gnss_Synchro &in_sym, Gnss_Synchro &out_sym)
+{
     // UPDATE GNSS SYNCHRO DATA
     Gnss_Synchro current_synchro_data{};  // structure to save the synchronization information and send the output object to the next block
     // 1. Copy the current tracking output
-    current_synchro_data = in[0];
-    consume_each(1);  // one by one
+    current_synchro_data = in_sym;
 
     // check if there is a problem with the telemetry of the current satellite
     d_sample_counter++;  // count for the processed symbols
@@ -211,35 +225,33 @@ int gps_l5_telemetry_decoder_gs::general_work(int noutput_items __attribute__((u
                 }
         }
 
-    cnav_msg_t msg;
-    uint32_t delay;
     const auto symbol_clip = static_cast<uint8_t>(current_synchro_data.Prompt_Q > 0) * 255;
     // 2. Add the telemetry decoder information
-    // check if new CNAV frame is available
-    bool new_page = cnav_msg_decoder_add_symbol(&d_cnav_decoder, symbol_clip, &msg, &delay);
-    if (d_dump_crc_stats && (d_cnav_decoder.part1.message_lock || d_cnav_decoder.part2.message_lock))
+    // queue the symbol to the decoder worker thread, so the Viterbi update
+    // never runs on the scheduler thread, and collect its pending results
+    d_cnav_decoder.push_symbol(symbol_clip, d_sample_counter);
+    if (d_dump_crc_stats)
         {
-            // update CRC statistics
-            d_Tlm_CRC_Stats->update_CRC_stats((d_cnav_decoder.part1.crc_ok || d_cnav_decoder.part2.crc_ok));
-            d_cnav_decoder.part1.message_lock = false;
-            d_cnav_decoder.part2.message_lock = false;
+            bool crc_ok = false;
+            while (d_cnav_decoder.try_pop_crc(crc_ok))
+                {
+                    // update CRC statistics
+                    d_Tlm_CRC_Stats->update_CRC_stats(crc_ok);
+                }
         }
 
+    // check if new CNAV frame is available
+    Tlm_CNAV_Async_Decoder::Frame frame;
+    const bool new_page = d_cnav_decoder.try_pop_frame(frame);
+
     if (new_page)
         {
-            if (d_cnav_decoder.part1.invert == true || d_cnav_decoder.part2.invert == true)
-                {
-                    d_flag_PLL_180_deg_phase_locked = true;
-                }
-            else
-                {
-                    d_flag_PLL_180_deg_phase_locked = false;
-                }
+            d_flag_PLL_180_deg_phase_locked = frame.invert;
             std::bitset<GPS_L5_CNAV_DATA_PAGE_BITS> raw_bits;
             // Expand packet bits to bitsets. Notice the reverse order of the bits sequence, required by the CNAV message decoder
             for (uint32_t i = 0; i < GPS_L5_CNAV_DATA_PAGE_BITS; i++)
                 {
-                    raw_bits[GPS_L5_CNAV_DATA_PAGE_BITS - 1 - i] = ((msg.raw_msg[i / 8] >> (7 - i % 8)) & 1U);
+                    raw_bits[GPS_L5_CNAV_DATA_PAGE_BITS - 1 - i] = ((frame.msg.raw_msg[i / 8] >> (7 - i % 8)) & 1U);
                 }
 
             if (d_enable_navdata_monitor)
@@ -272,7 +284,7 @@ int gps_l5_telemetry_decoder_gs::general_work(int noutput_items __attribute__((u
                 }
 
             // update TOW at the preamble instant
-            d_TOW_at_Preamble_ms = msg.tow * 6000;
+            d_TOW_at_Preamble_ms = frame.msg.tow * 6000;
 
             // The time of the last input symbol can be computed from the message ToW and
             // delay by the formulae:
@@ -281,19 +293,21 @@ int gps_l5_telemetry_decoder_gs::general_work(int noutput_items __attribute__((u
 
             // check TOW update consistency
             const uint32_t last_d_TOW_at_current_symbol_ms = d_TOW_at_current_symbol_ms;
-            d_TOW_at_current_symbol_ms = msg.tow * 6000 + (delay + 12) * GPS_L5I_SYMBOL_PERIOD_MS;
+            // The frame may have completed a few symbols ago in the worker thread,
+            // so refer its ToW to the current symbol
+            d_TOW_at_current_symbol_ms = frame.msg.tow * 6000 + (frame.delay + 12 + static_cast<uint32_t>(d_sample_counter - frame.symbol_counter)) * GPS_L5I_SYMBOL_PERIOD_MS;
             if (last_d_TOW_at_current_symbol_ms != 0 && std::llabs(static_cast<int64_t>(d_TOW_at_current_symbol_ms) - static_cast<int64_t>(last_d_TOW_at_current_symbol_ms)) > static_cast<int64_t>(GPS_L5I_SYMBOL_PERIOD_MS))
                 {
                     DLOG(INFO) << "Warning: GPS L5 TOW update in ch " << d_channel
                                << " does not match the TLM TOW counter " << static_cast<int64_t>(d_TOW_at_current_symbol_ms) - static_cast<int64_t>(last_d_TOW_at_current_symbol_ms) << " ms "
-                               << " with delay: " << delay << " msg tow: " << msg.tow * 6000 << " ms \n";
+                               << " with delay: " << frame.delay << " msg tow: " << frame.msg.tow * 6000 << " ms \n";
 
                     d_TOW_at_current_symbol_ms = 0;
                     d_flag_valid_word = false;
                 }
             else
                 {
-                    d_last_valid_preamble = d_sample_counter;
+                    d_last_valid_preamble = frame.symbol_counter;
                     d_flag_valid_word = true;
                 }
 
@@ -359,8 +373,8 @@ int gps_l5_telemetry_decoder_gs::general_work(int noutput_items __attribute__((u
                 }
 
             // 3. Make the output (copy the object contents to the GNURadio reserved memory)
-            out[0] = current_synchro_data;
-            return 1;
+            out_sym = current_synchro_data;
+            return true;
         }
-    return 0;
+    return false;
 }
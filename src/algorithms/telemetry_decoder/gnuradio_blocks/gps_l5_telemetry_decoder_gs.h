@@ -22,6 +22,7 @@
 #include "gnss_satellite.h"               // for Gnss_Satellite
 #include "gps_cnav_navigation_message.h"  // for Gps_CNAV_Navigation_Message
 #include "nav_message_packet.h"
+#include "tlm_cnav_async_decoder.h"
 #include "tlm_conf.h"
 #include "tlm_crc_stats.h"
 #include <boost/circular_buffer.hpp>
@@ -32,17 +33,13 @@
 #include <memory>  // for std::unique_ptr
 #include <string>
 
-extern "C"
-{
-#include "cnav_msg.h"
-}
-
 /** \addtogroup Telemetry_Decoder
  * \{ */
 /** \addtogroup Telemetry_Decoder_gnuradio_blocks
  * \{ */
 
 
+class Gnss_Synchro;
 class gps_l5_telemetry_decoder_gs;
 
 using gps_l5_telemetry_decoder_gs_sptr = gnss_shared_ptr<gps_l5_telemetry_decoder_gs>;
@@ -72,7 +69,10 @@ private:
 
     gps_l5_telemetry_decoder_gs(const Gnss_Satellite &satellite, const Tlm_Conf &conf);
 
-    cnav_msg_decoder_t d_cnav_decoder{};
+    //! processes one tracking symbol; returns true if out_sym carries a valid output
+    bool process_symbol(const Gnss_Synchro &in_sym, Gnss_Synchro &out_sym);
+
+    Tlm_CNAV_Async_Decoder d_cnav_decoder;
 
     Gnss_Satellite d_satellite;
 
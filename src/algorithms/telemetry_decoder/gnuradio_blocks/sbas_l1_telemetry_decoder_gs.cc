@@ -20,7 +20,7 @@
 #include <glog/logging.h>
 #include <gnuradio/io_signature.h>
 #include <pmt/pmt_sugar.h>  // for mp
-#include <algorithm>        // for copy
+#include <algorithm>        // for copy, min
 #include <array>
 #include <cmath>      // for abs
 #include <exception>  // for exception
@@ -50,8 +50,6 @@ sbas_l1_telemetry_decoder_gs::sbas_l1_telemetry_decoder_gs(
                  d_channel(0),
                  d_block_size(D_SAMPLES_PER_SYMBOL * D_SYMBOLS_PER_BIT * D_BLOCK_SIZE_IN_BITS)
 {
-    // prevent telemetry symbols accumulation in output buffers
-    this->set_max_noutput_items(1);
     // Ephemeris data port out
     this->message_port_register_out(pmt::mp("telemetry"));
     // Control messages to tracking block
@@ -395,7 +393,7 @@ void sbas_l1_telemetry_decoder_gs::Crc_Verifier::zerropad_front_and_convert_to_b
 }
 
 
-int sbas_l1_telemetry_decoder_gs::general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items __attribute__((unused)),
+int sbas_l1_telemetry_decoder_gs::general_work(int noutput_items, gr_vector_int &ninput_items,
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
     VLOG(FLOW) << "general_work(): "
@@ -404,14 +402,28 @@ int sbas_l1_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
     auto *out = reinterpret_cast<Gnss_Synchro *>(output_items[0]);            // Get the output buffer pointer
     const auto *in = reinterpret_cast<const Gnss_Synchro *>(input_items[0]);  // Get the input buffer pointer
 
+    // process every symbol the scheduler delivered in a single call instead
+    // of paying one work() round-trip per symbol
+    const int nsym = std::min(noutput_items, ninput_items[0]);
+    for (int i = 0; i < nsym; i++)
+        {
+            process_symbol(in[i], out[i]);
+        }
+    consume_each(nsym);  // tell scheduler input items consumed
+    return nsym;         // tell scheduler output items produced
+}
+
+
+void sbas_l1_telemetry_decoder_gs::process_symbol(const Gnss_Synchro &in_sym, Gnss_Synchro &out_sym)
+{
     Gnss_Synchro current_symbol{};  // structure to save the synchronization information and send the output object to the next block
     // 1. Copy the current tracking output
-    current_symbol = in[0];
+    current_symbol = in_sym;
     // copy correlation samples into samples vector
     d_sample_buf.push_back(current_symbol.Prompt_I);  // add new symbol to the symbol queue
 
     // store the time stamp of the first sample in the processed sample block
-    const double sample_stamp = static_cast<double>(in[0].Tracking_sample_counter) / static_cast<double>(in[0].fs);
+    const double sample_stamp = static_cast<double>(in_sym.Tracking_sample_counter) / static_cast<double>(in_sym.fs);
 
     // decode only if enough samples in buffer
     if (d_sample_buf.size() >= d_block_size)
@@ -470,7 +482,5 @@ int sbas_l1_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
     // UPDATE GNSS SYNCHRO DATA
     // actually the SBAS telemetry decoder doesn't support ranging
     current_symbol.Flag_valid_word = false;  // indicate to observable block that this synchro object isn't valid for pseudorange computation
-    out[0] = current_symbol;
-    consume_each(1);  // tell scheduler input items consumed
-    return 1;         // tell scheduler output items produced
+    out_sym = current_symbol;
 }
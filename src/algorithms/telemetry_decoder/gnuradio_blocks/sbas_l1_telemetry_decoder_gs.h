@@ -37,6 +37,7 @@
  * \{ */
 
 
+class Gnss_Synchro;
 class Viterbi_Decoder_Sbas;
 
 class sbas_l1_telemetry_decoder_gs;
@@ -75,6 +76,9 @@ private:
     void viterbi_decoder(double *page_part_symbols, int32_t *page_part_bits);
     void align_samples();
 
+    //! processes one tracking symbol and writes the corresponding output to out_sym
+    void process_symbol(const Gnss_Synchro &in_sym, Gnss_Synchro &out_sym);
+
     static const int32_t D_SAMPLES_PER_SYMBOL = 2;
     static const int32_t D_SYMBOLS_PER_BIT = 2;
     static const int32_t D_BLOCK_SIZE_IN_BITS = 30;
@@ -0,0 +1,78 @@
+/*!
+ * \file tlm_cnav_async_decoder.cc
+ * \brief Runs the libswiftcnav CNAV frame decoder in a worker thread
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "tlm_cnav_async_decoder.h"
+
+Tlm_CNAV_Async_Decoder::Tlm_CNAV_Async_Decoder(bool record_crc) : d_stop(false),
+                                                                  d_record_crc(record_crc)
+{
+    cnav_msg_decoder_init(&d_cnav_decoder);
+    d_worker = std::thread(&Tlm_CNAV_Async_Decoder::run, this);
+}
+
+
+Tlm_CNAV_Async_Decoder::~Tlm_CNAV_Async_Decoder()
+{
+    d_stop = true;
+    if (d_worker.joinable())
+        {
+            d_worker.join();
+        }
+}
+
+
+void Tlm_CNAV_Async_Decoder::push_symbol(uint8_t symbol, uint64_t symbol_counter)
+{
+    d_symbol_queue.push(Symbol{symbol, symbol_counter});
+}
+
+
+bool Tlm_CNAV_Async_Decoder::try_pop_frame(Frame& frame)
+{
+    return d_frame_queue.try_pop(frame);
+}
+
+
+bool Tlm_CNAV_Async_Decoder::try_pop_crc(bool& crc_ok)
+{
+    return d_crc_queue.try_pop(crc_ok);
+}
+
+
+void Tlm_CNAV_Async_Decoder::run()
+{
+    Symbol item;
+    while (!d_stop)
+        {
+            if (!d_symbol_queue.timed_wait_and_pop(item, 50))
+                {
+                    continue;
+                }
+            Frame frame;
+            const bool new_frame = cnav_msg_decoder_add_symbol(&d_cnav_decoder, item.symbol, &frame.msg, &frame.delay);
+            if (d_record_crc && (d_cnav_decoder.part1.message_lock || d_cnav_decoder.part2.message_lock))
+                {
+                    d_crc_queue.push(d_cnav_decoder.part1.crc_ok || d_cnav_decoder.part2.crc_ok);
+                    d_cnav_decoder.part1.message_lock = false;
+                    d_cnav_decoder.part2.message_lock = false;
+                }
+            if (new_frame)
+                {
+                    frame.symbol_counter = item.symbol_counter;
+                    frame.invert = (d_cnav_decoder.part1.invert || d_cnav_decoder.part2.invert);
+                    d_frame_queue.push(frame);
+                }
+        }
+}
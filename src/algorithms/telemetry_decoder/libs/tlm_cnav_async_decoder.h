@@ -0,0 +1,104 @@
+/*!
+ * \file tlm_cnav_async_decoder.h
+ * \brief Runs the libswiftcnav CNAV frame decoder in a worker thread
+ *
+ * The GPS L2C and L5 telemetry blocks feed one symbol per work() call to
+ * the convolutional decoder. Running the Viterbi update inline lengthens
+ * the critical path of the tracking to observables chain, so this class
+ * moves it to a dedicated thread: symbols are queued from work(), and
+ * completed frames (plus CRC check events) are collected back on the
+ * scheduler thread with non-blocking pops.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_TLM_CNAV_ASYNC_DECODER_H
+#define GNSS_SDR_TLM_CNAV_ASYNC_DECODER_H
+
+#include "concurrent_queue.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+extern "C"
+{
+#include "cnav_msg.h"
+}
+
+/** \addtogroup Telemetry_Decoder
+ * \{ */
+/** \addtogroup Telemetry_Decoder_libs
+ * \{ */
+
+
+/*!
+ * \brief Class that decodes CNAV frames asynchronously in a worker thread
+ */
+class Tlm_CNAV_Async_Decoder
+{
+public:
+    /*!
+     * \brief A decoded CNAV frame, tagged with the symbol count at which it
+     * was completed so the caller can refer its ToW to the current symbol
+     */
+    struct Frame
+    {
+        cnav_msg_t msg{};
+        uint32_t delay{};
+        uint64_t symbol_counter{};
+        bool invert{};
+    };
+
+    /*!
+     * \brief Constructor. If record_crc is set, the outcome of every frame
+     * CRC check is queued for collection with try_pop_crc()
+     */
+    explicit Tlm_CNAV_Async_Decoder(bool record_crc);
+
+    ~Tlm_CNAV_Async_Decoder();
+
+    /*!
+     * \brief Queue one hard symbol (0 or 255) to the decoder. Never blocks
+     */
+    void push_symbol(uint8_t symbol, uint64_t symbol_counter);
+
+    /*!
+     * \brief Collect a decoded frame, if any. Never blocks
+     */
+    bool try_pop_frame(Frame& frame);
+
+    /*!
+     * \brief Collect the outcome of a frame CRC check, if any. Never blocks
+     */
+    bool try_pop_crc(bool& crc_ok);
+
+private:
+    struct Symbol
+    {
+        uint8_t symbol{};
+        uint64_t symbol_counter{};
+    };
+
+    void run();
+
+    Concurrent_Queue<Symbol> d_symbol_queue;
+    Concurrent_Queue<Frame> d_frame_queue;
+    Concurrent_Queue<bool> d_crc_queue;
+    cnav_msg_decoder_t d_cnav_decoder{};
+    std::thread d_worker;
+    std::atomic<bool> d_stop;
+    bool d_record_crc;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_TLM_CNAV_ASYNC_DECODER_H
@@ -17,6 +17,7 @@
 #include "tlm_utils.h"
 #include "gnss_sdr_filesystem.h"
 #include <matio.h>
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <fstream>
@@ -136,3 +137,29 @@ bool tlm_remove_file(const std::string &file_to_remove)
     errorlib::error_code ec;
     return fs::remove(fs::path(file_to_remove), ec);
 }
+
+
+int32_t correlate_preamble(const float *symbols, const int32_t *preamble_samples, int32_t length)
+{
+    int32_t corr_value = 0;
+    for (int32_t i = 0; i < length; i++)
+        {
+            // symbols clipping
+            corr_value += (symbols[i] < 0.0F) ? -preamble_samples[i] : preamble_samples[i];
+        }
+    return corr_value;
+}
+
+
+int32_t correlate_preamble(const boost::circular_buffer<float> &symbol_history, const int32_t *preamble_samples, int32_t length)
+{
+    const auto segment_one = symbol_history.array_one();
+    const int32_t n1 = std::min(static_cast<int32_t>(segment_one.second), length);
+    int32_t corr_value = correlate_preamble(segment_one.first, preamble_samples, n1);
+    if (n1 < length)
+        {
+            const auto segment_two = symbol_history.array_two();
+            corr_value += correlate_preamble(segment_two.first, preamble_samples + n1, length - n1);
+        }
+    return corr_value;
+}
@@ -17,6 +17,8 @@
 #ifndef GNSS_SDR_TLM_UTILS_H
 #define GNSS_SDR_TLM_UTILS_H
 
+#include <boost/circular_buffer.hpp>
+#include <cstdint>
 #include <string>
 
 /** \addtogroup Telemetry_Decoder
@@ -28,6 +30,19 @@ int save_tlm_matfile(const std::string &dumpfile);
 
 bool tlm_remove_file(const std::string &file_to_remove);
 
+/*!
+ * \brief Correlates a hard-clipped symbol sequence against a +1/-1 preamble
+ * pattern. The conditional negation compiles to a sign select, so the loop
+ * vectorizes instead of branching on every symbol
+ */
+int32_t correlate_preamble(const float *symbols, const int32_t *preamble_samples, int32_t length);
+
+/*!
+ * \brief Overload operating directly on the (possibly wrapped) symbol history
+ * kept by the telemetry decoder blocks
+ */
+int32_t correlate_preamble(const boost::circular_buffer<float> &symbol_history, const int32_t *preamble_samples, int32_t length);
+
 /** \} */
 /** \} */
 #endif  // GNSS_SDR_TLM_UTILS_H
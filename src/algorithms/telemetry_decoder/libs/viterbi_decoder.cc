@@ -17,6 +17,13 @@
 #include "viterbi_decoder.h"
 #include <volk_gnsssdr/volk_gnsssdr.h>  // for volk_gnsssdr_32f_index_max_32u
 #include <algorithm>                    // for std::copy
+#include <cmath>                        // for std::lround
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 Viterbi_Decoder::Viterbi_Decoder(int32_t KK,
     int32_t nn,
@@ -41,11 +48,41 @@ Viterbi_Decoder::Viterbi_Decoder(int32_t KK,
     d_state1 = std::vector<int32_t>(d_states);
     nsc_transit(d_out0, d_state0, 0);
     nsc_transit(d_out1, d_state1, 1);
+
+    // The butterfly ACS over 8-bit path metrics is laid out for the 64-state,
+    // rate 1/2 code (Galileo I/NAV, F/NAV and SBAS); anything else takes the
+    // float trellis below
+    d_use_8bit = (d_states == 64) && (d_nn == 2);
+    if (d_use_8bit)
+        {
+            d_pm8_prev = std::vector<uint8_t>(d_states);
+            d_pm8_next = std::vector<uint8_t>(d_states);
+            d_bm_sel_even = std::vector<uint8_t>(d_states);
+            d_bm_sel_odd = std::vector<uint8_t>(d_states);
+            d_decisions = std::vector<uint64_t>(d_LL + d_mm);
+            // State n at time t+1 is reached from states (2n) mod 64 and
+            // (2n + 1) mod 64 with input bit n >> 5. Cache the output symbol
+            // of each of the two branches so the per-section branch metrics
+            // can be splatted with a table lookup
+            for (int32_t n = 0; n < d_states; n++)
+                {
+                    const int32_t pred_even = (2 * n) % d_states;
+                    const int32_t pred_odd = (2 * n + 1) % d_states;
+                    const bool bit = (n >> (d_mm - 1)) != 0;
+                    d_bm_sel_even[n] = static_cast<uint8_t>(bit ? d_out1[pred_even] : d_out0[pred_even]);
+                    d_bm_sel_odd[n] = static_cast<uint8_t>(bit ? d_out1[pred_odd] : d_out0[pred_odd]);
+                }
+        }
 }
 
 
 void Viterbi_Decoder::decode(std::vector<int32_t>& output_u_int, const std::vector<float>& input_c)
 {
+    if (d_use_8bit)
+        {
+            decode_8bit(output_u_int, input_c);
+            return;
+        }
     int32_t i;
     int32_t t;
     int32_t state;
@@ -120,6 +157,162 @@ void Viterbi_Decoder::decode(std::vector<int32_t>& output_u_int, const std::vect
 }
 
 
+void Viterbi_Decoder::decode_8bit(std::vector<int32_t>& output_u_int, const std::vector<float>& input_c)
+{
+    const int32_t sections = d_LL + d_mm;
+    int32_t i;
+    int32_t t;
+    int32_t n;
+
+    // force the all-zeros start state with a large initial advantage
+    std::fill(d_pm8_prev.begin(), d_pm8_prev.end(), 0);
+    d_pm8_prev[0] = 127;
+
+    uint8_t bm8[4];
+    uint8_t bm_even[64];
+    uint8_t bm_odd[64];
+
+    // quantize the branch metrics to 5 bits with a single scale for the whole
+    // block, so relative symbol amplitudes (the soft information) survive and
+    // the path metric spread stays below the 8-bit saturation limit
+    float max_range = 0.0F;
+    for (t = 0; t < sections; t++)
+        {
+            float range = 0.0F;
+            for (i = 0; i < d_nn - 1; i++)
+                {
+                    range += std::fabs(input_c[d_nn * t + i]);
+                }
+            max_range = std::max(max_range, range);
+        }
+    const float scale = (max_range > 0.0F) ? 31.0F / max_range : 0.0F;
+
+    for (t = 0; t < sections; t++)
+        {
+            std::copy(input_c.begin() + d_nn * t, input_c.begin() + d_nn * t + (d_nn - 1), d_rec_array.begin());
+
+            for (i = 0; i < d_number_symbols; i++)
+                {
+                    d_metric_c[i] = this->Gamma(i);
+                }
+            const float gamma_min = *std::min_element(d_metric_c.begin(), d_metric_c.end());
+            for (i = 0; i < d_number_symbols; i++)
+                {
+                    bm8[i] = static_cast<uint8_t>(std::lround((d_metric_c[i] - gamma_min) * scale));
+                }
+            for (n = 0; n < 64; n++)
+                {
+                    bm_even[n] = bm8[d_bm_sel_even[n]];
+                    bm_odd[n] = bm8[d_bm_sel_odd[n]];
+                }
+
+            uint64_t decision = 0;
+#if defined(__SSE2__)
+            // split the previous metrics into the even / odd predecessors of
+            // each butterfly; states 0-31 and 32-63 share the same pairs
+            const __m128i low_byte = _mm_set1_epi16(0x00FF);
+            const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(d_pm8_prev.data()));
+            const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(d_pm8_prev.data() + 16));
+            const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(d_pm8_prev.data() + 32));
+            const __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(d_pm8_prev.data() + 48));
+            const __m128i even[2] = {_mm_packus_epi16(_mm_and_si128(v0, low_byte), _mm_and_si128(v1, low_byte)),
+                _mm_packus_epi16(_mm_and_si128(v2, low_byte), _mm_and_si128(v3, low_byte))};
+            const __m128i odd[2] = {_mm_packus_epi16(_mm_srli_epi16(v0, 8), _mm_srli_epi16(v1, 8)),
+                _mm_packus_epi16(_mm_srli_epi16(v2, 8), _mm_srli_epi16(v3, 8))};
+            __m128i pm_min = _mm_set1_epi8(-1);
+            for (int32_t block = 0; block < 4; block++)
+                {
+                    const __m128i cand0 = _mm_adds_epu8(even[block & 1], _mm_loadu_si128(reinterpret_cast<const __m128i*>(bm_even + 16 * block)));
+                    const __m128i cand1 = _mm_adds_epu8(odd[block & 1], _mm_loadu_si128(reinterpret_cast<const __m128i*>(bm_odd + 16 * block)));
+                    const __m128i survivor = _mm_max_epu8(cand0, cand1);
+                    decision |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(survivor, cand1)))) << (16 * block);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(d_pm8_next.data() + 16 * block), survivor);
+                    pm_min = _mm_min_epu8(pm_min, survivor);
+                }
+            // normalize: subtract the smallest metric from all survivors
+            pm_min = _mm_min_epu8(pm_min, _mm_srli_si128(pm_min, 8));
+            pm_min = _mm_min_epu8(pm_min, _mm_srli_si128(pm_min, 4));
+            pm_min = _mm_min_epu8(pm_min, _mm_srli_si128(pm_min, 2));
+            pm_min = _mm_min_epu8(pm_min, _mm_srli_si128(pm_min, 1));
+            const __m128i norm = _mm_set1_epi8(static_cast<char>(_mm_cvtsi128_si32(pm_min) & 0xFF));
+            for (int32_t block = 0; block < 4; block++)
+                {
+                    const __m128i pm = _mm_loadu_si128(reinterpret_cast<const __m128i*>(d_pm8_next.data() + 16 * block));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(d_pm8_next.data() + 16 * block), _mm_subs_epu8(pm, norm));
+                }
+#elif defined(__ARM_NEON)
+            const uint8x16x2_t pair0 = vld2q_u8(d_pm8_prev.data());
+            const uint8x16x2_t pair1 = vld2q_u8(d_pm8_prev.data() + 32);
+            const uint8x16_t even[2] = {pair0.val[0], pair1.val[0]};
+            const uint8x16_t odd[2] = {pair0.val[1], pair1.val[1]};
+            const uint8x16_t bit_select = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+            uint8x16_t pm_min = vdupq_n_u8(255);
+            for (int32_t block = 0; block < 4; block++)
+                {
+                    const uint8x16_t cand0 = vqaddq_u8(even[block & 1], vld1q_u8(bm_even + 16 * block));
+                    const uint8x16_t cand1 = vqaddq_u8(odd[block & 1], vld1q_u8(bm_odd + 16 * block));
+                    const uint8x16_t survivor = vmaxq_u8(cand0, cand1);
+                    uint8x16_t mask = vandq_u8(vceqq_u8(survivor, cand1), bit_select);
+                    uint8x8_t folded = vpadd_u8(vget_low_u8(mask), vget_high_u8(mask));
+                    folded = vpadd_u8(folded, folded);
+                    folded = vpadd_u8(folded, folded);
+                    const uint64_t block_mask = static_cast<uint64_t>(vget_lane_u8(folded, 0)) | (static_cast<uint64_t>(vget_lane_u8(folded, 1)) << 8);
+                    decision |= block_mask << (16 * block);
+                    vst1q_u8(d_pm8_next.data() + 16 * block, survivor);
+                    pm_min = vminq_u8(pm_min, survivor);
+                }
+            uint8x8_t fold_min = vpmin_u8(vget_low_u8(pm_min), vget_high_u8(pm_min));
+            fold_min = vpmin_u8(fold_min, fold_min);
+            fold_min = vpmin_u8(fold_min, fold_min);
+            fold_min = vpmin_u8(fold_min, fold_min);
+            const uint8x16_t norm = vdupq_n_u8(vget_lane_u8(fold_min, 0));
+            for (int32_t block = 0; block < 4; block++)
+                {
+                    vst1q_u8(d_pm8_next.data() + 16 * block, vqsubq_u8(vld1q_u8(d_pm8_next.data() + 16 * block), norm));
+                }
+#else
+            uint8_t pm_min = 255;
+            for (n = 0; n < 64; n++)
+                {
+                    const int32_t cand0 = std::min(static_cast<int32_t>(d_pm8_prev[(2 * n) % 64]) + bm_even[n], 255);
+                    const int32_t cand1 = std::min(static_cast<int32_t>(d_pm8_prev[(2 * n + 1) % 64]) + bm_odd[n], 255);
+                    uint8_t survivor = static_cast<uint8_t>(cand0);
+                    if (cand1 >= cand0)
+                        {
+                            survivor = static_cast<uint8_t>(cand1);
+                            decision |= static_cast<uint64_t>(1) << n;
+                        }
+                    d_pm8_next[n] = survivor;
+                    pm_min = std::min(pm_min, survivor);
+                }
+            for (n = 0; n < 64; n++)
+                {
+                    d_pm8_next[n] = static_cast<uint8_t>(d_pm8_next[n] - pm_min);
+                }
+#endif
+            d_decisions[t] = decision;
+            d_pm8_prev.swap(d_pm8_next);
+        }
+
+    // trace-back operation: the decision bit of state n selects between its
+    // predecessors (2n) mod 64 and (2n + 1) mod 64, and the bit that led into
+    // state n is its most significant state bit
+    int32_t state = 0;
+
+    // tail, no need to output
+    for (t = sections - 1; t >= d_LL; t--)
+        {
+            state = (2 * state + static_cast<int32_t>((d_decisions[t] >> state) & 1U)) % 64;
+        }
+
+    for (t = d_LL - 1; t >= 0; t--)
+        {
+            output_u_int[t] = state >> (d_mm - 1);
+            state = (2 * state + static_cast<int32_t>((d_decisions[t] >> state) & 1U)) % 64;
+        }
+}
+
+
 void Viterbi_Decoder::reset()
 {
     d_out0 = std::vector<int32_t>(d_states);
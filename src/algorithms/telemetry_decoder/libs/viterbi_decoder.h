@@ -101,6 +101,13 @@ private:
         int32_t input,
         int32_t state_in) const;
 
+    /*
+     * Add-compare-select over saturating 8-bit path metrics, processing the
+     * 64-state butterflies with SSE2/NEON when available. Only valid for the
+     * KK = 7, rate 1/2 code shared by Galileo and SBAS.
+     */
+    void decode_8bit(std::vector<int32_t>& output_u_int, const std::vector<float>& input_c);
+
     std::vector<float> d_prev_section{};
     std::vector<float> d_next_section{};
 
@@ -115,6 +122,12 @@ private:
     std::vector<int32_t> d_state0;
     std::vector<int32_t> d_state1;
 
+    std::vector<uint8_t> d_pm8_prev;
+    std::vector<uint8_t> d_pm8_next;
+    std::vector<uint8_t> d_bm_sel_even;
+    std::vector<uint8_t> d_bm_sel_odd;
+    std::vector<uint64_t> d_decisions;
+
     float d_MAXLOG = 1e7;  // Define infinity
     int32_t d_KK{};
     int32_t d_nn{};
@@ -123,6 +136,7 @@ private:
     int32_t d_mm{};
     int32_t d_states{};
     int32_t d_number_symbols{};
+    bool d_use_8bit{};
 };
 
 /** \} */
@@ -25,8 +25,11 @@
 #include "glonass_l1_ca_dll_pll_tracking.h"
 #include "GLONASS_L1_L2_CA.h"
 #include "configuration_interface.h"
-#include "gnss_sdr_flags.h"
+#include "display.h"
+#include "dll_pll_conf.h"
 #include <glog/logging.h>
+#include <algorithm>
+#include <array>
 
 
 GlonassL1CaDllPllTracking::GlonassL1CaDllPllTracking(
@@ -40,46 +43,50 @@ GlonassL1CaDllPllTracking::GlonassL1CaDllPllTracking(
       in_streams_(in_streams),
       out_streams_(out_streams)
 {
-    // ################# CONFIGURATION PARAMETERS ########################
-    const std::string default_item_type("gr_complex");
-    std::string item_type = configuration->property(role_ + ".item_type", default_item_type);
-    int fs_in_deprecated = configuration->property("GNSS-SDR.internal_fs_hz", 2048000);
-    int fs_in = configuration->property("GNSS-SDR.internal_fs_sps", fs_in_deprecated);
-    bool dump = configuration->property(role_ + ".dump", false);
-    float pll_bw_hz = configuration->property(role_ + ".pll_bw_hz", static_cast<float>(50.0));
-    if (FLAGS_pll_bw_hz != 0.0)
+    Dll_Pll_Conf trk_params = Dll_Pll_Conf();
+    trk_params.SetFromConfiguration(configuration, role_);
+
+    const auto vector_length = static_cast<int>(std::round(trk_params.fs_in / (GLONASS_L1_CA_CODE_RATE_CPS / GLONASS_L1_CA_CODE_LENGTH_CHIPS)));
+    trk_params.vector_length = vector_length;
+    if (trk_params.extend_correlation_symbols < 1)
+        {
+            trk_params.extend_correlation_symbols = 1;
+            std::cout << TEXT_RED << "WARNING: GLONASS L1 C/A. extend_correlation_symbols must be bigger than 1. Coherent integration has been set to 1 symbol (1 ms)" << TEXT_RESET << '\n';
+        }
+    else if (trk_params.extend_correlation_symbols > 10)
         {
-            pll_bw_hz = static_cast<float>(FLAGS_pll_bw_hz);
+            // the GNAV meander symbol spans 10 ms; longer coherent integration
+            // would cross symbol transitions
+            trk_params.extend_correlation_symbols = 10;
+            std::cout << TEXT_RED << "WARNING: GLONASS L1 C/A. extend_correlation_symbols must be lower than 11. Coherent integration has been set to 10 symbols (10 ms)" << TEXT_RESET << '\n';
         }
-    float dll_bw_hz = configuration->property(role_ + ".dll_bw_hz", static_cast<float>(2.0));
-    if (FLAGS_dll_bw_hz != 0.0)
+    trk_params.track_pilot = configuration->property(role_ + ".track_pilot", false);
+    if (trk_params.track_pilot)
         {
-            dll_bw_hz = static_cast<float>(FLAGS_dll_bw_hz);
+            trk_params.track_pilot = false;
+            std::cout << TEXT_RED << "WARNING: GLONASS L1 C/A does not have pilot signal. Data tracking has been enabled" << TEXT_RESET << '\n';
         }
-    float early_late_space_chips = configuration->property(role_ + ".early_late_space_chips", static_cast<float>(0.5));
-    const std::string default_dump_filename("./track_ch");
-    std::string dump_filename = configuration->property(role_ + ".dump_filename", default_dump_filename);
-    const auto vector_length = static_cast<int>(std::round(fs_in / (GLONASS_L1_CA_CODE_RATE_CPS / GLONASS_L1_CA_CODE_LENGTH_CHIPS)));
+    if ((trk_params.extend_correlation_symbols > 1) and (trk_params.pll_bw_narrow_hz > trk_params.pll_bw_hz or trk_params.dll_bw_narrow_hz > trk_params.dll_bw_hz))
+        {
+            std::cout << TEXT_RED << "WARNING: GLONASS L1 C/A. PLL or DLL narrow tracking bandwidth is higher than wide tracking one" << TEXT_RESET << '\n';
+        }
+
+    trk_params.system = 'R';
+    const std::array<char, 3> sig{'1', 'G', '\0'};
+    std::copy_n(sig.data(), 3, trk_params.signal);
 
-    // ################# MAKE TRACKING GNURadio object ###################
+    // ################# Make a GNU Radio Tracking block object ################
     DLOG(INFO) << "role " << role_;
-    if (item_type == "gr_complex")
+    if (trk_params.item_type == "gr_complex")
         {
-            tracking_sptr_ = glonass_l1_ca_dll_pll_make_tracking_cc(
-                fs_in,
-                vector_length,
-                dump,
-                dump_filename,
-                pll_bw_hz,
-                dll_bw_hz,
-                early_late_space_chips);
+            tracking_sptr_ = dll_pll_veml_make_tracking(trk_params);
             DLOG(INFO) << "tracking(" << tracking_sptr_->unique_id() << ")";
         }
     else
         {
             item_size_ = 0;
             tracking_sptr_ = nullptr;
-            LOG(WARNING) << item_type << " unknown tracking item type.";
+            LOG(WARNING) << trk_params.item_type << " unknown tracking item type.";
         }
 
     if (in_streams_ > 1)
@@ -95,6 +102,7 @@ GlonassL1CaDllPllTracking::GlonassL1CaDllPllTracking(
 
 void GlonassL1CaDllPllTracking::stop_tracking()
 {
+    tracking_sptr_->stop_tracking();
 }
 
 
@@ -24,7 +24,7 @@
 #ifndef GNSS_SDR_GLONASS_L2_CA_DLL_PLL_TRACKING_H
 #define GNSS_SDR_GLONASS_L2_CA_DLL_PLL_TRACKING_H
 
-#include "glonass_l2_ca_dll_pll_tracking_cc.h"
+#include "dll_pll_veml_tracking.h"
 #include "tracking_interface.h"
 #include <string>
 
@@ -90,7 +90,7 @@ public:
     void stop_tracking() override;
 
 private:
-    glonass_l2_ca_dll_pll_tracking_cc_sptr tracking_sptr_;
+    dll_pll_veml_tracking_sptr tracking_sptr_;
     std::string role_;
     size_t item_size_;
     unsigned int channel_;
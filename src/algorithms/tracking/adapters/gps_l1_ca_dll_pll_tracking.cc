@@ -51,10 +51,18 @@ GpsL1CaDllPllTracking::GpsL1CaDllPllTracking(
             trk_params.extend_correlation_symbols = 1;
             std::cout << TEXT_RED << "WARNING: GPS L1 C/A. extend_correlation_symbols must be bigger than 1. Coherent integration has been set to 1 symbol (1 ms)" << TEXT_RESET << '\n';
         }
-    else if (trk_params.extend_correlation_symbols > 20)
+    else if (trk_params.extend_correlation_symbols > 60)
         {
-            trk_params.extend_correlation_symbols = 20;
-            std::cout << TEXT_RED << "WARNING: GPS L1 C/A. extend_correlation_symbols must be lower than 21. Coherent integration has been set to 20 symbols (20 ms)" << TEXT_RESET << '\n';
+            trk_params.extend_correlation_symbols = 60;
+            std::cout << TEXT_RED << "WARNING: GPS L1 C/A. extend_correlation_symbols must be lower than 61. Coherent integration has been set to 60 symbols (60 ms)" << TEXT_RESET << '\n';
+        }
+    else if ((trk_params.extend_correlation_symbols > 20) and (trk_params.extend_correlation_symbols % 20 != 0))
+        {
+            // integration intervals longer than one telemetry bit (20 ms) rely on the
+            // data bit signs fed back by the telemetry decoder, and must stay aligned
+            // with the bit boundaries
+            trk_params.extend_correlation_symbols = 20 * (trk_params.extend_correlation_symbols / 20);
+            std::cout << TEXT_RED << "WARNING: GPS L1 C/A. When bigger than 20, extend_correlation_symbols must be a multiple of 20. Coherent integration has been set to " << trk_params.extend_correlation_symbols << " symbols" << TEXT_RESET << '\n';
         }
     trk_params.track_pilot = configuration->property(role_ + ".track_pilot", false);
     if (trk_params.track_pilot)
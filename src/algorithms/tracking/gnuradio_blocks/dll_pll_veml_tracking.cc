@@ -23,6 +23,7 @@
 #include "dll_pll_veml_tracking.h"
 #include "Beidou_B1I.h"
 #include "Beidou_B3I.h"
+#include "GLONASS_L1_L2_CA.h"
 #include "GPS_L1_CA.h"
 #include "GPS_L2C.h"
 #include "GPS_L5.h"
@@ -31,11 +32,15 @@
 #include "Galileo_E5b.h"
 #include "Galileo_E6.h"
 #include "MATH_CONSTANTS.h"
+#include "async_dump_writer.h"
+#include "event_log.h"
 #include "beidou_b1i_signal_replica.h"
 #include "beidou_b3i_signal_replica.h"
 #include "galileo_e1_signal_replica.h"
 #include "galileo_e5_signal_replica.h"
 #include "galileo_e6_signal_replica.h"
+#include "glonass_l1_signal_replica.h"
+#include "glonass_l2_signal_replica.h"
 #include "gnss_satellite.h"
 #include "gnss_sdr_create_directory.h"
 #include "gnss_sdr_filesystem.h"
@@ -43,17 +48,24 @@
 #include "gps_l2c_signal_replica.h"
 #include "gps_l5_signal_replica.h"
 #include "gps_sdr_signal_replica.h"
+#include "latency_tracer.h"
 #include "lock_detectors.h"
+#include "streaming_mat_writer.h"
+#include "tlm_bit_prediction.h"
 #include "tracking_discriminators.h"
+#include "tracking_group_engine.h"
+#include "tracking_metrics_hook.h"
+#include "trackingcmd.h"
 #include <glog/logging.h>
 #include <gnuradio/io_signature.h>   // for io_signature
 #include <gnuradio/thread/thread.h>  // for scoped_lock
-#include <matio.h>                   // for Mat_VarCreate
-#include <pmt/pmt_sugar.h>           // for mp
+#include <pmt/pmt_sugar.h>  // for mp
+#include <volk/volk.h>      // for volk_32f_s32f_convert_16i (lite_mode)
 #include <volk_gnsssdr/volk_gnsssdr.h>
-#include <algorithm>  // for fill_n
+#include <algorithm>  // for fill_n, min
 #include <array>
-#include <cmath>      // for fmod, round, floor
+#include <cmath>      // for fmod, round, floor, llround
+#include <cstring>    // for memcpy
 #include <exception>  // for exception
 #include <iostream>   // for cout, cerr
 #include <map>
@@ -74,6 +86,18 @@ namespace wht = boost;
 namespace wht = std;
 #endif
 
+namespace
+{
+// Q32.32 fixed-point representation of the carrier phase in cycles: one LSB
+// is 2^-32 cycles (~0.2 nanocycles), well below the millicycle level
+constexpr double PHASE_Q32_PER_RAD = 4294967296.0 / TWO_PI;
+constexpr double PHASE_RAD_PER_Q32 = TWO_PI / 4294967296.0;
+// the phase rate step per sample^2 can be below one Q32.32 LSB, so it is
+// quantized on a 2^62 grid and rescaled to Q32.32 after the n^2 product
+constexpr double PHASE_RATE_Q62_PER_RAD = 4611686018427387904.0 / TWO_PI;
+constexpr int64_t PHASE_RATE_Q62_TO_Q32 = INT64_C(1) << 30;
+}  // namespace
+
 dll_pll_veml_tracking_sptr dll_pll_veml_make_tracking(const Dll_Pll_Conf &conf_)
 {
     return dll_pll_veml_tracking_sptr(new dll_pll_veml_tracking(conf_));
@@ -100,16 +124,23 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
       d_CN0_SNV_dB_Hz(0.0),
       d_carrier_lock_threshold(d_trk_parameters.carrier_lock_th),
       d_carrier_phase_step_rad(0.0),
+      d_carrier_doppler_phase_step_rad(0.0),
       d_carrier_phase_rate_step_rad(0.0),
       d_code_phase_step_chips(0.0),
       d_code_phase_rate_step_chips(0.0),
       d_rem_code_phase_samples(0.0),  // Residual code phase (in chips)
+      d_acc_carrier_phase_q32(0LL),
+      d_carrier_phase_step_q32(0LL),
+      d_carrier_phase_rate_step_q62(0LL),
       d_acq_sample_stamp(0ULL),
       d_rem_carr_phase_rad(0.0),  // Residual carrier phase
       d_state(0),                 // initial state: standby
       d_current_prn_length_samples(static_cast<int32_t>(d_trk_parameters.vector_length)),
       d_extend_correlation_symbols_count(0),
       d_extend_correlation_symbols(d_trk_parameters.extend_correlation_symbols),
+      d_integration_symbols_min(1),
+      d_integration_symbols_max(d_trk_parameters.extend_correlation_symbols),
+      d_adaptive_integration_counter(0),
       d_cn0_estimation_counter(0),
       d_carrier_lock_fail_counter(0),
       d_code_lock_fail_counter(0),
@@ -131,8 +162,9 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
 #else
     this->set_relative_rate(1.0 / static_cast<double>(d_trk_parameters.vector_length));
 #endif
+    d_epochs_per_work = std::max(d_trk_parameters.epochs_per_work, 1);
     // prevent telemetry symbols accumulation in output buffers
-    this->set_max_noutput_items(1);
+    this->set_max_noutput_items(d_epochs_per_work);
 
     // Telemetry bit synchronization message port input
     this->message_port_register_out(pmt::mp("events"));
@@ -149,6 +181,20 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
 #else
         boost::bind(&dll_pll_veml_tracking::msg_handler_telemetry_to_trk, this, _1));
 #endif
+#endif
+
+    // NCO commands from the PVT block (vector tracking assistance)
+    this->message_port_register_in(pmt::mp("pvt_to_trk"));
+    this->set_msg_handler(
+        pmt::mp("pvt_to_trk"),
+#if HAS_GENERIC_LAMBDA
+        [this](auto &&PH1) { msg_handler_pvt_to_trk(PH1); });
+#else
+#if USE_BOOST_BIND_PLACEHOLDERS
+        boost::bind(&dll_pll_veml_tracking::msg_handler_pvt_to_trk, this, boost::placeholders::_1));
+#else
+        boost::bind(&dll_pll_veml_tracking::msg_handler_pvt_to_trk, this, _1));
+#endif
 #endif
 
     // initialize internal vars
@@ -270,11 +316,25 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
                     // Galileo E1b has 1 trk symbol (4 ms) per tlm bit, no symbol integration required
                     d_symbols_per_bit = 1;
                     d_correlation_length_ms = 4;
-                    d_code_samples_per_chip = 2;  // CBOC disabled: 2 samples per chip. CBOC enabled: 12 samples per chip
+                    if (d_trk_parameters.cboc_enabled and d_trk_parameters.lite_mode)
+                        {
+                            LOG(WARNING) << "lite_mode does not support the CBOC replica, using the sinboc(1,1) replica";
+                            d_trk_parameters.cboc_enabled = false;
+                        }
                     d_veml = true;
                     d_trk_parameters.spc = d_trk_parameters.early_late_space_chips;
-                    d_trk_parameters.slope = static_cast<float>(-CalculateSlopeAbs(&SinBocCorrelationFunction<1, 1>, d_trk_parameters.spc));
-                    d_trk_parameters.y_intercept = static_cast<float>(GetYInterceptAbs(&SinBocCorrelationFunction<1, 1>, d_trk_parameters.spc));
+                    if (d_trk_parameters.cboc_enabled)
+                        {
+                            d_code_samples_per_chip = 12;  // CBOC(6,1,1/11) replica
+                            d_trk_parameters.slope = static_cast<float>(-CalculateSlopeAbs(&CbocCorrelationFunction, d_trk_parameters.spc));
+                            d_trk_parameters.y_intercept = static_cast<float>(GetYInterceptAbs(&CbocCorrelationFunction, d_trk_parameters.spc));
+                        }
+                    else
+                        {
+                            d_code_samples_per_chip = 2;  // CBOC disabled: 2 samples per chip. CBOC enabled: 12 samples per chip
+                            d_trk_parameters.slope = static_cast<float>(-CalculateSlopeAbs(&SinBocCorrelationFunction<1, 1>, d_trk_parameters.spc));
+                            d_trk_parameters.y_intercept = static_cast<float>(GetYInterceptAbs(&SinBocCorrelationFunction<1, 1>, d_trk_parameters.spc));
+                        }
                     if (d_trk_parameters.track_pilot)
                         {
                             d_secondary = true;
@@ -445,6 +505,41 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
                     d_symbols_per_bit = 0;
                 }
         }
+    else if (d_trk_parameters.system == 'R')
+        {
+            d_systemName = "GLONASS";
+            if (d_signal_type == "1G" or d_signal_type == "2G")
+                {
+                    // FDMA: this is the nominal center frequency; the offset of the
+                    // satellite frequency slot is applied in start_tracking()
+                    d_signal_carrier_freq = (d_signal_type == "1G") ? GLONASS_L1_CA_FREQ_HZ : GLONASS_L2_CA_FREQ_HZ;
+                    d_code_period = GLONASS_L1_CA_CODE_PERIOD_S;
+                    d_code_chip_rate = GLONASS_L1_CA_CODE_RATE_CPS;
+                    d_code_length_chips = static_cast<int32_t>(GLONASS_L1_CA_CODE_LENGTH_CHIPS);
+                    // the GNAV meander symbol spans 10 code periods
+                    d_symbols_per_bit = GLONASS_GNAV_TELEMETRY_SYMBOLS_PER_BIT;
+                    d_correlation_length_ms = 1;
+                    d_code_samples_per_chip = 1;
+                    // GLONASS L1/L2 C/A does not have pilot component nor secondary code
+                    d_secondary = false;
+                    d_trk_parameters.track_pilot = false;
+                    d_trk_parameters.slope = 1.0;
+                    d_trk_parameters.spc = d_trk_parameters.early_late_space_chips;
+                    d_trk_parameters.y_intercept = 1.0;
+                }
+            else
+                {
+                    LOG(WARNING) << "Invalid Signal argument when instantiating tracking blocks";
+                    std::cout << "Invalid Signal argument when instantiating tracking blocks\n";
+                    d_correlation_length_ms = 1;
+                    d_secondary = false;
+                    d_signal_carrier_freq = 0.0;
+                    d_code_period = 0.0;
+                    d_code_length_chips = 0;
+                    d_code_samples_per_chip = 0;
+                    d_symbols_per_bit = 0;
+                }
+        }
     else
         {
             LOG(WARNING) << "Invalid System argument when instantiating tracking blocks";
@@ -466,8 +561,9 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
     d_carrier_loop_filter.set_params(d_trk_parameters.fll_bw_hz, d_trk_parameters.pll_bw_hz, d_trk_parameters.pll_filter_order);
 
     // Initialization of local code replica
-    // Get space for a vector with the sinboc(1,1) replica sampled 2x/chip
-    d_tracking_code.resize(2 * d_code_length_chips, 0.0);
+    // Get space for a vector with the local replica: every signal fits in
+    // 2 samples per chip except the Galileo E1 CBOC replica (12 per chip)
+    d_tracking_code.resize(std::max(d_code_samples_per_chip, 2) * d_code_length_chips, 0.0);
     // correlator outputs (scalar)
     if (d_veml)
         {
@@ -512,6 +608,18 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
 
     d_multicorrelator_cpu.init(static_cast<int>(2 * d_trk_parameters.vector_length), d_n_correlator_taps);
 
+    if (d_trk_parameters.lite_mode and d_trk_parameters.track_pilot)
+        {
+            LOG(WARNING) << "lite_mode does not support pilot tracking, using the full-precision correlator";
+            d_trk_parameters.lite_mode = false;
+        }
+    if (d_trk_parameters.lite_mode)
+        {
+            d_multicorrelator_cpu_16sc.init(static_cast<int>(2 * d_trk_parameters.vector_length), d_n_correlator_taps);
+            d_correlator_outs_16sc = volk_gnsssdr::vector<lv_16sc_t>(d_n_correlator_taps);
+            d_input_16sc = volk_gnsssdr::vector<lv_16sc_t>(2 * d_trk_parameters.vector_length);
+        }
+
     if (d_trk_parameters.extend_correlation_symbols > 1)
         {
             d_enable_extended_integration = true;
@@ -528,15 +636,26 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
             // Extra correlator for the data component
             d_correlator_data_cpu.init(static_cast<int>(2 * d_trk_parameters.vector_length), 1);
             d_correlator_data_cpu.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
-            d_data_code.resize(2 * d_code_length_chips, 0.0);
+            d_data_code.resize(std::max(d_code_samples_per_chip, 2) * d_code_length_chips, 0.0);
         }
 
     // --- Initializations ---
     d_Prompt_circular_buffer.set_capacity(d_secondary_code_length);
+    update_secondary_code_signs();
     d_multicorrelator_cpu.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
+    if (d_trk_parameters.use_opencl_resampler)
+        {
+            // the single-tap data correlator stays on the CPU: its resampling
+            // cost does not justify a device round trip
+            if (!d_multicorrelator_cpu.enable_opencl_resampler(static_cast<int>(2 * d_trk_parameters.vector_length)))
+                {
+                    LOG(WARNING) << "use_opencl_resampler requested but no OpenCL device is usable, code resampling stays on the CPU";
+                }
+        }
 
     // CN0 estimation and lock detector buffers
     d_Prompt_buffer = volk_gnsssdr::vector<gr_complex>(d_trk_parameters.cn0_samples);
+    d_lock_detector_scratch = volk_gnsssdr::vector<float>(2 * d_trk_parameters.cn0_samples);
     d_Prompt_Data = volk_gnsssdr::vector<gr_complex>(1);
     d_cn0_smoother = Exponential_Smoother();
     d_cn0_smoother.set_alpha(d_trk_parameters.cn0_smoother_alpha);
@@ -601,6 +720,7 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
     d_last_timetag_samplecounter = 0;
     d_timetag_waiting = false;
     set_tag_propagation_policy(TPP_DONT);  // no tag propagation, the time tag will be adjusted and regenerated in work()
+    bind_hot_path();
 }
 
 
@@ -609,7 +729,7 @@ void dll_pll_veml_tracking::forecast(int noutput_items,
 {
     if (noutput_items != 0)
         {
-            ninput_items_required[0] = static_cast<int32_t>(d_trk_parameters.vector_length) * 2;
+            ninput_items_required[0] = static_cast<int32_t>(d_trk_parameters.vector_length) * (d_epochs_per_work + 1);
         }
 }
 
@@ -628,6 +748,17 @@ void dll_pll_veml_tracking::msg_handler_telemetry_to_trk(const pmt::pmt_t &msg)
                             d_carrier_lock_fail_counter = 200000;  // force loss-of-lock condition
                         }
                 }
+            else if (pmt::any_ref(msg).type().hash_code() == typeid(const std::shared_ptr<TlmBitPrediction>).hash_code())
+                {
+                    // data bit signs forecast by the telemetry decoder, used
+                    // by fold_data_bit() to extend the coherent integration
+                    // across the predicted bit boundaries
+                    const auto prediction = wht::any_cast<const std::shared_ptr<TlmBitPrediction>>(pmt::any_ref(msg));
+                    gr::thread::scoped_lock lock(d_setlock);
+                    d_predicted_bit_signs = prediction->bit_signs;
+                    d_bit_prediction_first_sample = prediction->first_bit_sample_counter;
+                    d_bit_prediction_valid = true;
+                }
         }
     catch (const wht::bad_any_cast &e)
         {
@@ -640,6 +771,45 @@ void dll_pll_veml_tracking::msg_handler_telemetry_to_trk(const pmt::pmt_t &msg)
 }
 
 
+void dll_pll_veml_tracking::msg_handler_pvt_to_trk(const pmt::pmt_t &msg)
+{
+    try
+        {
+            if (pmt::any_ref(msg).type().hash_code() == typeid(const std::shared_ptr<TrackingCmd>).hash_code())
+                {
+                    const auto cmd = wht::any_cast<const std::shared_ptr<TrackingCmd>>(pmt::any_ref(msg));
+                    if (cmd->channel_id != d_channel)
+                        {
+                            // the pvt_to_trk port is shared by all the channels
+                            return;
+                        }
+                    if (d_trk_parameters.enable_vtl_assist and cmd->enable_carrier_nco_cmd)
+                        {
+                            gr::thread::scoped_lock lock(d_setlock);
+                            d_vtl_cmd_doppler_hz = cmd->carrier_freq_hz;
+                            d_vtl_cmd_sample_counter = cmd->sample_counter;
+                            d_vtl_cmd_valid = true;
+                        }
+                }
+        }
+    catch (const wht::bad_any_cast &e)
+        {
+            LOG(WARNING) << "msg_handler_pvt_to_trk Bad any_cast: " << e.what();
+        }
+}
+
+
+bool dll_pll_veml_tracking::vtl_assist_is_fresh()
+{
+    // NCO commands older than one second no longer represent the receiver dynamics
+    if (!d_vtl_cmd_valid)
+        {
+            return false;
+        }
+    return (this->nitems_read(0) - d_vtl_cmd_sample_counter) < static_cast<uint64_t>(d_trk_parameters.fs_in);
+}
+
+
 void dll_pll_veml_tracking::start_tracking()
 {
     gr::thread::scoped_lock l(d_setlock);
@@ -649,7 +819,8 @@ void dll_pll_veml_tracking::start_tracking()
     d_acq_sample_stamp = d_acquisition_gnss_synchro->Acq_samplestamp_samples;
 
     d_carrier_doppler_hz = d_acq_carrier_doppler_hz;
-    d_carrier_phase_step_rad = TWO_PI * d_carrier_doppler_hz / d_trk_parameters.fs_in;
+    d_carrier_doppler_phase_step_rad = TWO_PI * d_carrier_doppler_hz / d_trk_parameters.fs_in;
+    d_carrier_phase_step_rad = d_carrier_doppler_phase_step_rad;
     d_carrier_phase_rate_step_rad = 0.0;
     d_carr_ph_history.clear();
     d_code_ph_history.clear();
@@ -683,7 +854,32 @@ void dll_pll_veml_tracking::start_tracking()
         }
     else if (d_systemName == "Galileo" and d_signal_type == "1B")
         {
-            if (d_trk_parameters.track_pilot)
+            if (d_trk_parameters.cboc_enabled)
+                {
+                    // generate the two CBOC subcarrier components and let the
+                    // correlator combine them analytically into the matched
+                    // replica, at the per-epoch cost of a single code
+                    const int32_t cboc_samples = d_code_samples_per_chip * d_code_length_chips;
+                    volk_gnsssdr::vector<float> boc11(cboc_samples);
+                    volk_gnsssdr::vector<float> boc61(cboc_samples);
+                    const auto alpha = static_cast<float>(std::sqrt(10.0 / 11.0));
+                    const auto beta = static_cast<float>(std::sqrt(1.0 / 11.0));
+                    if (d_trk_parameters.track_pilot)
+                        {
+                            const std::array<char, 3> pilot_signal = {{'1', 'C', '\0'}};
+                            galileo_e1_code_gen_cboc_components_float(boc11, boc61, pilot_signal, d_acquisition_gnss_synchro->PRN);
+                            d_multicorrelator_cpu.set_cboc_local_code_and_taps(cboc_samples, boc11.data(), boc61.data(), alpha, beta, d_local_code_shift_chips.data());
+                            galileo_e1_code_gen_cboc_components_float(boc11, boc61, Signal_, d_acquisition_gnss_synchro->PRN);
+                            d_Prompt_Data[0] = gr_complex(0.0, 0.0);
+                            d_correlator_data_cpu.set_cboc_local_code_and_taps(cboc_samples, boc11.data(), boc61.data(), alpha, beta, d_prompt_data_shift);
+                        }
+                    else
+                        {
+                            galileo_e1_code_gen_cboc_components_float(boc11, boc61, Signal_, d_acquisition_gnss_synchro->PRN);
+                            d_multicorrelator_cpu.set_cboc_local_code_and_taps(cboc_samples, boc11.data(), boc61.data(), alpha, beta, d_local_code_shift_chips.data());
+                        }
+                }
+            else if (d_trk_parameters.track_pilot)
                 {
                     const std::array<char, 3> pilot_signal = {{'1', 'C', '\0'}};
                     galileo_e1_code_gen_sinboc11_float(d_tracking_code, pilot_signal, d_acquisition_gnss_synchro->PRN);
@@ -833,15 +1029,68 @@ void dll_pll_veml_tracking::start_tracking()
                 }
         }
 
-    d_multicorrelator_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_tracking_code.data(), d_local_code_shift_chips.data());
+    else if (d_systemName == "GLONASS" and (d_signal_type == "1G" or d_signal_type == "2G"))
+        {
+            // all GLONASS satellites transmit the same m-sequence and are separated
+            // in frequency (FDMA), so the carrier NCO gets a constant feed-forward
+            // offset given by the frequency slot of this satellite
+            volk_gnsssdr::vector<gr_complex> aux_code(d_code_length_chips);
+            if (d_signal_type == "1G")
+                {
+                    glonass_l1_ca_code_gen_complex(aux_code, 0);
+                    d_fdma_carrier_offset_hz = DFRQ1_GLO * GLONASS_PRN.at(d_acquisition_gnss_synchro->PRN);
+                    d_signal_carrier_freq = GLONASS_L1_CA_FREQ_HZ + d_fdma_carrier_offset_hz;
+                }
+            else
+                {
+                    glonass_l2_ca_code_gen_complex(aux_code, 0);
+                    d_fdma_carrier_offset_hz = DFRQ2_GLO * GLONASS_PRN.at(d_acquisition_gnss_synchro->PRN);
+                    d_signal_carrier_freq = GLONASS_L2_CA_FREQ_HZ + d_fdma_carrier_offset_hz;
+                }
+            for (int32_t i = 0; i < d_code_length_chips; i++)
+                {
+                    d_tracking_code[i] = aux_code[i].real();
+                }
+            d_carrier_phase_step_rad = TWO_PI * (d_carrier_doppler_hz + d_fdma_carrier_offset_hz) / d_trk_parameters.fs_in;
+        }
+
+    update_secondary_code_signs();
+    if (!(d_systemName == "Galileo" and d_signal_type == "1B" and d_trk_parameters.cboc_enabled))
+        {
+            // in CBOC mode the correlator already holds the combined replica
+            d_multicorrelator_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_tracking_code.data(), d_local_code_shift_chips.data());
+        }
+    if (d_trk_parameters.lite_mode)
+        {
+            // quantize the +/-1 local code once per satellite assignment
+            const auto code_samples = static_cast<size_t>(d_code_samples_per_chip) * d_code_length_chips;
+            d_tracking_code_16sc.resize(code_samples);
+            for (size_t i = 0; i < code_samples; i++)
+                {
+                    d_tracking_code_16sc[i] = lv_16sc_t(static_cast<int16_t>(d_tracking_code[i]), 0);
+                }
+            d_multicorrelator_cpu_16sc.set_local_code_and_taps(static_cast<int>(code_samples), d_tracking_code_16sc.data(), d_local_code_shift_chips.data());
+        }
     std::fill_n(d_correlator_outs.begin(), d_n_correlator_taps, gr_complex(0.0, 0.0));
 
     d_carrier_lock_fail_counter = 0;
     d_code_lock_fail_counter = 0;
+    d_vtl_cmd_valid = false;         // discard assistance addressed to the previous satellite
+    d_bit_prediction_valid = false;  // discard bit signs predicted for the previous satellite
+    // the coherent integration can only span several data bits if each bit is
+    // integrated apart and its sign wiped off before folding it into the
+    // extended accumulators (see fold_data_bit())
+    d_extend_over_bits = (d_enable_extended_integration &&
+                          !d_trk_parameters.track_pilot &&
+                          d_symbols_per_bit > 1 &&
+                          d_data_secondary_code_length == 0 &&
+                          d_extend_correlation_symbols > d_symbols_per_bit &&
+                          (d_extend_correlation_symbols % d_symbols_per_bit == 0));
     d_rem_code_phase_samples = 0.0;
     d_rem_carr_phase_rad = 0.0;
     d_rem_code_phase_chips = 0.0;
     d_acc_carrier_phase_rad = 0.0;
+    d_acc_carrier_phase_q32 = 0LL;
     d_cn0_estimation_counter = 0;
     d_carrier_lock_test = 1.0;
     d_CN0_SNV_dB_Hz = 0.0;
@@ -874,6 +1123,7 @@ void dll_pll_veml_tracking::start_tracking()
     DLOG(INFO) << "Starting tracking of satellite " << Gnss_Satellite(d_systemName, d_acquisition_gnss_synchro->PRN) << " on channel " << d_channel;
 
     // enable tracking pull-in
+    bind_hot_path();  // d_secondary may have changed for this satellite
     d_state = 1;
     d_cloop = true;
     d_pull_in_transitory = true;
@@ -885,16 +1135,12 @@ void dll_pll_veml_tracking::start_tracking()
 
 dll_pll_veml_tracking::~dll_pll_veml_tracking()
 {
-    if (d_dump_file.is_open())
+    if (d_dump_stream_id >= 0)
         {
-            try
-                {
-                    d_dump_file.close();
-                }
-            catch (const std::exception &ex)
-                {
-                    LOG(WARNING) << "Exception in Tracking block destructor: " << ex.what();
-                }
+            // block until the dump is on disk, so save_matfile() below
+            // re-reads a complete file
+            Async_Dump_Writer::get_instance().close_stream(d_dump_stream_id);
+            d_dump_stream_id = -1;
         }
     if (d_dump_mat)
         {
@@ -913,6 +1159,10 @@ dll_pll_veml_tracking::~dll_pll_veml_tracking()
                 {
                     d_correlator_data_cpu.free();
                 }
+            if (d_trk_parameters.lite_mode)
+                {
+                    d_multicorrelator_cpu_16sc.free();
+                }
             d_multicorrelator_cpu.free();
         }
     catch (const std::exception &ex)
@@ -982,8 +1232,16 @@ bool dll_pll_veml_tracking::cn0_and_tracking_lock_status(double coh_integration_
 
     d_Prompt_buffer[d_cn0_estimation_counter % d_trk_parameters.cn0_samples] = d_P_accu;
     d_cn0_estimation_counter++;
+    // In steady state the lock indicators are only consumed at a much lower
+    // rate than the epoch rate, so they can be re-evaluated every k-th epoch.
+    // The prompt buffer keeps filling on every epoch regardless
+    if (!d_pull_in_transitory and (d_trk_parameters.lock_detector_decimation > 1) and
+        ((d_cn0_estimation_counter % d_trk_parameters.lock_detector_decimation) != 0))
+        {
+            return true;
+        }
     // Code lock indicator
-    const float d_CN0_SNV_dB_Hz_raw = cn0_m2m4_estimator(d_Prompt_buffer.data(), d_trk_parameters.cn0_samples, static_cast<float>(coh_integration_time_s));
+    const float d_CN0_SNV_dB_Hz_raw = cn0_m2m4_estimator(d_Prompt_buffer.data(), d_lock_detector_scratch.data(), d_trk_parameters.cn0_samples, static_cast<float>(coh_integration_time_s));
     d_CN0_SNV_dB_Hz = d_cn0_smoother.smooth(d_CN0_SNV_dB_Hz_raw);
     // Carrier lock indicator
     d_carrier_lock_test = d_carrier_lock_test_smoother.smooth(carrier_lock_detector(d_Prompt_buffer.data(), 1));
@@ -1016,10 +1274,30 @@ bool dll_pll_veml_tracking::cn0_and_tracking_lock_status(double coh_integration_
         }
     if (d_carrier_lock_fail_counter > d_trk_parameters.max_carrier_lock_fail or d_code_lock_fail_counter > d_trk_parameters.max_code_lock_fail)
         {
-            std::cout << "Loss of lock in channel " << d_channel << "!\n";
-            LOG(INFO) << "Loss of lock in channel " << d_channel
-                      << " (carrier_lock_fail_counter:" << d_carrier_lock_fail_counter
-                      << " code_lock_fail_counter : " << d_code_lock_fail_counter << ")";
+            if (d_trk_parameters.enable_vtl_assist and vtl_assist_is_fresh())
+                {
+                    // the navigation solution is still healthy: coast on the PVT
+                    // NCO commands instead of triggering a reacquisition. The PVT
+                    // block stops assisting a channel after a configurable coast
+                    // time, so a permanently lost satellite is still dropped
+                    d_carrier_lock_fail_counter = d_trk_parameters.max_carrier_lock_fail;
+                    d_code_lock_fail_counter = d_trk_parameters.max_code_lock_fail;
+                    DLOG(INFO) << "Channel " << d_channel << " coasting on vector tracking assistance";
+                    return true;
+                }
+            if (Event_Log::get_instance().enabled())
+                {
+                    // reacquisition storms: one fixed-size binary record
+                    // instead of formatting text in the signal path
+                    Event_Log::get_instance().record(Event_Log::Event::loss_of_lock, d_channel, d_acquisition_gnss_synchro->PRN, d_CN0_SNV_dB_Hz, d_carrier_lock_test);
+                }
+            else
+                {
+                    std::cout << "Loss of lock in channel " << d_channel << "!\n";
+                    LOG(INFO) << "Loss of lock in channel " << d_channel
+                              << " (carrier_lock_fail_counter:" << d_carrier_lock_fail_counter
+                              << " code_lock_fail_counter : " << d_code_lock_fail_counter << ")";
+                }
             this->message_port_pub(pmt::mp("events"), pmt::from_long(3));  // 3 -> loss of lock
             d_carrier_lock_fail_counter = 0;
             d_code_lock_fail_counter = 0;
@@ -1036,34 +1314,157 @@ bool dll_pll_veml_tracking::cn0_and_tracking_lock_status(double coh_integration_
 // - d_carrier_doppler_hz
 void dll_pll_veml_tracking::do_correlation_step(const gr_complex *input_samples)
 {
-    // ################# CARRIER WIPEOFF AND CORRELATORS ##############################
-    // perform carrier wipe-off and compute Early, Prompt and Late correlation
-    d_multicorrelator_cpu.set_input_output_vectors(d_correlator_outs.data(), input_samples);
-    d_multicorrelator_cpu.Carrier_wipeoff_multicorrelator_resampler(
-        d_rem_carr_phase_rad,
-        static_cast<float>(d_carrier_phase_step_rad), static_cast<float>(d_carrier_phase_rate_step_rad),
-        static_cast<float>(d_rem_code_phase_chips) * static_cast<float>(d_code_samples_per_chip),
-        static_cast<float>(d_code_phase_step_chips) * static_cast<float>(d_code_samples_per_chip),
-        static_cast<float>(d_code_phase_rate_step_chips) * static_cast<float>(d_code_samples_per_chip),
-        d_trk_parameters.vector_length);
-
-    // DATA CORRELATOR (if tracking tracks the pilot signal)
-    if (d_trk_parameters.track_pilot)
+    (this->*d_correlation_step_fn)(input_samples);
+}
+
+
+template <bool TrackPilot, bool LiteMode>
+void dll_pll_veml_tracking::do_correlation_step_tpl(const gr_complex *input_samples)
+{
+    const Tracking_Perf_Counters::Scoped_Timer perf_timer(&d_perf_counters, Tracking_Perf_Counters::CORRELATION, d_trk_parameters.dump_perf);
+    const auto correlation_job = [this, input_samples]() {
+        // ################# CARRIER WIPEOFF AND CORRELATORS ##############################
+        // perform carrier wipe-off and compute Early, Prompt and Late correlation
+        if constexpr (LiteMode)
+            {
+                // coarse-quality profile: quantize the input once, then
+                // resample, wipe off and accumulate in short integers (half
+                // the memory traffic and twice the SIMD lanes of the float
+                // path). The scale factor sets the quantizer load and is
+                // undone on the accumulator outputs, so the discriminators,
+                // the C/N0 estimator and the lock detectors are untouched
+                volk_32f_s32f_convert_16i(reinterpret_cast<int16_t *>(d_input_16sc.data()),
+                    reinterpret_cast<const float *>(input_samples),
+                    d_trk_parameters.lite_input_scale,
+                    2 * d_trk_parameters.vector_length);
+                d_multicorrelator_cpu_16sc.set_input_output_vectors(d_correlator_outs_16sc.data(), d_input_16sc.data());
+                d_multicorrelator_cpu_16sc.Carrier_wipeoff_multicorrelator_resampler(
+                    d_rem_carr_phase_rad,
+                    static_cast<float>(d_carrier_phase_step_rad),
+                    static_cast<float>(d_rem_code_phase_chips) * static_cast<float>(d_code_samples_per_chip),
+                    static_cast<float>(d_code_phase_step_chips) * static_cast<float>(d_code_samples_per_chip),
+                    static_cast<int>(d_trk_parameters.vector_length));
+                const float inv_scale = 1.0F / d_trk_parameters.lite_input_scale;
+                for (int n = 0; n < d_n_correlator_taps; n++)
+                    {
+                        d_correlator_outs[n] = gr_complex(static_cast<float>(d_correlator_outs_16sc[n].real()),
+                                                   static_cast<float>(d_correlator_outs_16sc[n].imag())) *
+                                               inv_scale;
+                    }
+                return;
+            }
+        if (d_veml)
+            {
+                // During the pull-in transitory only the E/P/L taps drive the loops
+                // (the VE/VL accumulators stay at zero, which degenerates the VEMLP
+                // discriminator into the normalized E-L one), so the two outer
+                // correlators can be skipped until the FLL->PLL transition completes
+                if (d_pull_in_transitory)
+                    {
+                        d_multicorrelator_cpu.set_active_correlator_window(1, 3);
+                        d_correlator_outs[0] = gr_complex(0.0, 0.0);
+                        d_correlator_outs[4] = gr_complex(0.0, 0.0);
+                    }
+                else
+                    {
+                        d_multicorrelator_cpu.set_active_correlator_window(0, d_n_correlator_taps);
+                    }
+            }
+        d_multicorrelator_cpu.set_input_output_vectors(d_correlator_outs.data(), input_samples);
+        // When the pilot component is tracked, the data prompt needs the same
+        // carrier-free samples as the pilot correlators. The joint path
+        // materializes the wipe-off (fixed-point NCO carrier) so it can be
+        // reused for both code families, instead of spending a second full
+        // rotator pass over the input for the single data dot product
+        const bool joint_data_pilot = TrackPilot and d_trk_parameters.joint_data_pilot_corr;
+        if (d_trk_parameters.use_lut_carrier_nco or joint_data_pilot)
+            {
+                d_multicorrelator_cpu.Carrier_wipeoff_multicorrelator_resampler_lut_nco(
+                    d_rem_carr_phase_rad,
+                    static_cast<float>(d_carrier_phase_step_rad), static_cast<float>(d_carrier_phase_rate_step_rad),
+                    static_cast<float>(d_rem_code_phase_chips) * static_cast<float>(d_code_samples_per_chip),
+                    static_cast<float>(d_code_phase_step_chips) * static_cast<float>(d_code_samples_per_chip),
+                    static_cast<float>(d_code_phase_rate_step_chips) * static_cast<float>(d_code_samples_per_chip),
+                    d_trk_parameters.vector_length);
+            }
+        else
+            {
+                d_multicorrelator_cpu.Carrier_wipeoff_multicorrelator_resampler(
+                    d_rem_carr_phase_rad,
+                    static_cast<float>(d_carrier_phase_step_rad), static_cast<float>(d_carrier_phase_rate_step_rad),
+                    static_cast<float>(d_rem_code_phase_chips) * static_cast<float>(d_code_samples_per_chip),
+                    static_cast<float>(d_code_phase_step_chips) * static_cast<float>(d_code_samples_per_chip),
+                    static_cast<float>(d_code_phase_rate_step_chips) * static_cast<float>(d_code_samples_per_chip),
+                    d_trk_parameters.vector_length);
+            }
+
+        // DATA CORRELATOR (if tracking tracks the pilot signal)
+        if constexpr (TrackPilot)
+            {
+                if (joint_data_pilot)
+                    {
+                        // two code dot products share the single carrier
+                        // wipe-off performed by the pilot pass above
+                        d_correlator_data_cpu.set_input_output_vectors(d_Prompt_Data.data(), d_multicorrelator_cpu.wiped_input());
+                        d_correlator_data_cpu.Multicorrelator_resampler(
+                            static_cast<float>(d_rem_code_phase_chips) * static_cast<float>(d_code_samples_per_chip),
+                            static_cast<float>(d_code_phase_step_chips) * static_cast<float>(d_code_samples_per_chip),
+                            static_cast<float>(d_code_phase_rate_step_chips) * static_cast<float>(d_code_samples_per_chip),
+                            d_trk_parameters.vector_length);
+                        return;
+                    }
+                d_correlator_data_cpu.set_input_output_vectors(d_Prompt_Data.data(), input_samples);
+                if (d_trk_parameters.use_lut_carrier_nco)
+                    {
+                        d_correlator_data_cpu.Carrier_wipeoff_multicorrelator_resampler_lut_nco(
+                            d_rem_carr_phase_rad,
+                            static_cast<float>(d_carrier_phase_step_rad), static_cast<float>(d_carrier_phase_rate_step_rad),
+                            static_cast<float>(d_rem_code_phase_chips) * static_cast<float>(d_code_samples_per_chip),
+                            static_cast<float>(d_code_phase_step_chips) * static_cast<float>(d_code_samples_per_chip),
+                            static_cast<float>(d_code_phase_rate_step_chips) * static_cast<float>(d_code_samples_per_chip),
+                            d_trk_parameters.vector_length);
+                    }
+                else
+                    {
+                        d_correlator_data_cpu.Carrier_wipeoff_multicorrelator_resampler(
+                            d_rem_carr_phase_rad,
+                            static_cast<float>(d_carrier_phase_step_rad), static_cast<float>(d_carrier_phase_rate_step_rad),
+                            static_cast<float>(d_rem_code_phase_chips) * static_cast<float>(d_code_samples_per_chip),
+                            static_cast<float>(d_code_phase_step_chips) * static_cast<float>(d_code_samples_per_chip),
+                            static_cast<float>(d_code_phase_rate_step_chips) * static_cast<float>(d_code_samples_per_chip),
+                            d_trk_parameters.vector_length);
+                    }
+            }
+    };
+
+    // Batch this epoch's correlation with those of other channels when enabled,
+    // so the resampler and rotator-dotprod kernels of a channel group run back
+    // to back on one thread instead of interleaved across threads
+    Tracking_Group_Engine::get_instance().execute(correlation_job, d_trk_parameters.correlation_group_size);
+
+    if (d_trk_parameters.dump_perf)
         {
-            d_correlator_data_cpu.set_input_output_vectors(d_Prompt_Data.data(), input_samples);
-            d_correlator_data_cpu.Carrier_wipeoff_multicorrelator_resampler(
-                d_rem_carr_phase_rad,
-                static_cast<float>(d_carrier_phase_step_rad), static_cast<float>(d_carrier_phase_rate_step_rad),
-                static_cast<float>(d_rem_code_phase_chips) * static_cast<float>(d_code_samples_per_chip),
-                static_cast<float>(d_code_phase_step_chips) * static_cast<float>(d_code_samples_per_chip),
-                static_cast<float>(d_code_phase_rate_step_chips) * static_cast<float>(d_code_samples_per_chip),
-                d_trk_parameters.vector_length);
+            d_perf_counters.count_epoch();
+            // low-rate report so a channel burning anomalous CPU (e.g. a
+            // pathological Doppler) shows up in the logs of a running receiver
+            if ((d_perf_counters.epochs() % 5000U) == 0U)
+                {
+                    LOG(INFO) << "Tracking channel " << d_channel << " (" << d_systemName << ' ' << d_signal_pretty_name << ") perf: " << d_perf_counters.summary();
+                }
         }
 }
 
 
 void dll_pll_veml_tracking::run_dll_pll()
 {
+    (this->*d_run_dll_pll_fn)();
+}
+
+
+template <bool EnableFll>
+void dll_pll_veml_tracking::run_dll_pll_tpl()
+{
+    const Tracking_Perf_Counters::Scoped_Timer perf_timer(&d_perf_counters, Tracking_Perf_Counters::LOOP_FILTERS, d_trk_parameters.dump_perf);
     // ################## PLL ##########################################################
     // PLL discriminator
     if (d_cloop)
@@ -1077,24 +1478,32 @@ void dll_pll_veml_tracking::run_dll_pll()
             d_carr_phase_error_hz = pll_four_quadrant_atan(d_P_accu) / TWO_PI;
         }
 
-    if ((d_pull_in_transitory == true and d_trk_parameters.enable_fll_pull_in == true) or d_trk_parameters.enable_fll_steady_state)
+    if constexpr (EnableFll)
         {
-            // FLL discriminator
-            // d_carr_freq_error_hz = fll_four_quadrant_atan(d_P_accu_old, d_P_accu, 0, d_current_correlation_time_s) / TWO_PI;
-            d_carr_freq_error_hz = fll_diff_atan(d_P_accu_old, d_P_accu, 0, d_current_correlation_time_s) / TWO_PI;
-
-            d_P_accu_old = d_P_accu;
-            // std::cout << "d_carr_freq_error_hz: " << d_carr_freq_error_hz << '\n';
-            // Carrier discriminator filter
-            if ((d_pull_in_transitory == true and d_trk_parameters.enable_fll_pull_in == true))
+            if ((d_pull_in_transitory == true and d_trk_parameters.enable_fll_pull_in == true) or d_trk_parameters.enable_fll_steady_state)
                 {
-                    // pure FLL, disable PLL
-                    d_carr_error_filt_hz = d_carrier_loop_filter.get_carrier_error(static_cast<float>(d_carr_freq_error_hz), 0.0F, static_cast<float>(d_current_correlation_time_s));
+                    // FLL discriminator
+                    // d_carr_freq_error_hz = fll_four_quadrant_atan(d_P_accu_old, d_P_accu, 0, d_current_correlation_time_s) / TWO_PI;
+                    d_carr_freq_error_hz = fll_diff_atan(d_P_accu_old, d_P_accu, 0, d_current_correlation_time_s) / TWO_PI;
+
+                    d_P_accu_old = d_P_accu;
+                    // std::cout << "d_carr_freq_error_hz: " << d_carr_freq_error_hz << '\n';
+                    // Carrier discriminator filter
+                    if ((d_pull_in_transitory == true and d_trk_parameters.enable_fll_pull_in == true))
+                        {
+                            // pure FLL, disable PLL
+                            d_carr_error_filt_hz = d_carrier_loop_filter.get_carrier_error(static_cast<float>(d_carr_freq_error_hz), 0.0F, static_cast<float>(d_current_correlation_time_s));
+                        }
+                    else
+                        {
+                            // FLL-aided PLL
+                            d_carr_error_filt_hz = d_carrier_loop_filter.get_carrier_error(static_cast<float>(d_carr_freq_error_hz), static_cast<float>(d_carr_phase_error_hz), static_cast<float>(d_current_correlation_time_s));
+                        }
                 }
             else
                 {
-                    // FLL-aided PLL
-                    d_carr_error_filt_hz = d_carrier_loop_filter.get_carrier_error(static_cast<float>(d_carr_freq_error_hz), static_cast<float>(d_carr_phase_error_hz), static_cast<float>(d_current_correlation_time_s));
+                    // Carrier discriminator filter
+                    d_carr_error_filt_hz = d_carrier_loop_filter.get_carrier_error(0, static_cast<float>(d_carr_phase_error_hz), static_cast<float>(d_current_correlation_time_s));
                 }
         }
     else
@@ -1106,6 +1515,18 @@ void dll_pll_veml_tracking::run_dll_pll()
     // New carrier Doppler frequency estimation
     d_carrier_doppler_hz = d_carr_error_filt_hz;
 
+    // Vector tracking assistance: when the signal is too weak for a reliable
+    // scalar estimation, slave the carrier NCO to the navigation-domain
+    // prediction received from the PVT block, so the channel follows the
+    // receiver dynamics instead of drifting on discriminator noise
+    if (d_trk_parameters.enable_vtl_assist and d_CN0_SNV_dB_Hz < d_trk_parameters.cn0_min and vtl_assist_is_fresh())
+        {
+            d_carrier_doppler_hz = d_vtl_cmd_doppler_hz;
+            // re-seed the loop filter so the scalar loop takes over smoothly
+            // when the signal comes back
+            d_carrier_loop_filter.initialize(static_cast<float>(d_vtl_cmd_doppler_hz));
+        }
+
     //    std::cout << "d_carrier_doppler_hz: " << d_carrier_doppler_hz << '\n';
     //    std::cout << "d_CN0_SNV_dB_Hz: " << this->d_CN0_SNV_dB_Hz << '\n';
 
@@ -1157,11 +1578,22 @@ void dll_pll_veml_tracking::check_carrier_phase_coherent_initialization()
     if (d_acc_carrier_phase_initialized == false)
         {
             d_acc_carrier_phase_rad = -d_rem_carr_phase_rad;
+            d_acc_carrier_phase_q32 = -static_cast<int64_t>(std::llround(static_cast<double>(d_rem_carr_phase_rad) * PHASE_Q32_PER_RAD));
             d_acc_carrier_phase_initialized = true;
         }
 }
 
 
+double dll_pll_veml_tracking::get_acc_carrier_phase_rad() const
+{
+    if (d_trk_parameters.fp_carrier_phase)
+        {
+            return static_cast<double>(d_acc_carrier_phase_q32) * PHASE_RAD_PER_Q32;
+        }
+    return d_acc_carrier_phase_rad;
+}
+
+
 void dll_pll_veml_tracking::clear_tracking_vars()
 {
     std::fill_n(d_correlator_outs.begin(), d_n_correlator_taps, gr_complex(0.0, 0.0));
@@ -1188,6 +1620,7 @@ void dll_pll_veml_tracking::clear_tracking_vars()
 
 void dll_pll_veml_tracking::update_tracking_vars()
 {
+    const Tracking_Perf_Counters::Scoped_Timer perf_timer(&d_perf_counters, Tracking_Perf_Counters::TRACKING_VARS, d_trk_parameters.dump_perf);
     d_T_chip_seconds = 1.0 / d_code_freq_chips;
     d_T_prn_seconds = d_T_chip_seconds * static_cast<double>(d_code_length_chips);
 
@@ -1200,7 +1633,11 @@ void dll_pll_veml_tracking::update_tracking_vars()
 
     // ################### PLL COMMANDS #################################################
     // carrier phase step (NCO phase increment per sample) [rads/sample]
-    d_carrier_phase_step_rad = TWO_PI * d_carrier_doppler_hz / d_trk_parameters.fs_in;
+    // the NCO step includes the FDMA slot offset (zero except for GLONASS
+    // channels); the Doppler-only step drives the accumulated carrier phase,
+    // which must not absorb the constant slot offset
+    d_carrier_doppler_phase_step_rad = TWO_PI * d_carrier_doppler_hz / d_trk_parameters.fs_in;
+    d_carrier_phase_step_rad = TWO_PI * (d_carrier_doppler_hz + d_fdma_carrier_offset_hz) / d_trk_parameters.fs_in;
     // carrier phase rate step (NCO phase increment rate per sample) [rads/sample^2]
     if (d_trk_parameters.high_dyn)
         {
@@ -1230,7 +1667,20 @@ void dll_pll_veml_tracking::update_tracking_vars()
     // double a = d_carrier_phase_step_rad * static_cast<double>(d_current_prn_length_samples);
     // double b = 0.5 * d_carrier_phase_rate_step_rad * static_cast<double>(d_current_prn_length_samples) * static_cast<double>(d_current_prn_length_samples);
     // std::cout << fmod(b, TWO_PI) / fmod(a, TWO_PI) << '\n';
-    d_acc_carrier_phase_rad -= (d_carrier_phase_step_rad * static_cast<double>(d_current_prn_length_samples) + 0.5 * d_carrier_phase_rate_step_rad * static_cast<double>(d_current_prn_length_samples) * static_cast<double>(d_current_prn_length_samples));
+    if (d_trk_parameters.fp_carrier_phase)
+        {
+            // the per-sample steps are quantized once per loop update and the
+            // accumulation itself is integer-only (Q32.32 cycles); the
+            // accumulator advances with the Doppler-only step
+            d_carrier_phase_step_q32 = std::llround(d_carrier_doppler_phase_step_rad * PHASE_Q32_PER_RAD);
+            d_carrier_phase_rate_step_q62 = std::llround(d_carrier_phase_rate_step_rad * PHASE_RATE_Q62_PER_RAD);
+            const auto n = static_cast<int64_t>(d_current_prn_length_samples);
+            d_acc_carrier_phase_q32 -= d_carrier_phase_step_q32 * n + ((d_carrier_phase_rate_step_q62 * n * n) / 2) / PHASE_RATE_Q62_TO_Q32;
+        }
+    else
+        {
+            d_acc_carrier_phase_rad -= (d_carrier_doppler_phase_step_rad * static_cast<double>(d_current_prn_length_samples) + 0.5 * d_carrier_phase_rate_step_rad * static_cast<double>(d_current_prn_length_samples) * static_cast<double>(d_current_prn_length_samples));
+        }
 
     // ################### DLL COMMANDS #################################################
     // code phase step (Code resampler phase increment per sample) [chips/sample]
@@ -1260,36 +1710,64 @@ void dll_pll_veml_tracking::update_tracking_vars()
 }
 
 
+void dll_pll_veml_tracking::update_secondary_code_signs()
+{
+    // Bake the secondary code chips into +/-1 tables once per (re)start, so
+    // the correlation epoch path multiplies by a precomputed sign instead of
+    // branching on the secondary code strings
+    d_secondary_code_signs.resize(d_secondary_code_length);
+    for (uint32_t i = 0; i < d_secondary_code_length; i++)
+        {
+            d_secondary_code_signs[i] = (d_secondary_code_string[i] == '0' ? 1.0F : -1.0F);
+        }
+    d_data_secondary_code_signs.resize(d_data_secondary_code_length);
+    for (uint32_t i = 0; i < d_data_secondary_code_length; i++)
+        {
+            d_data_secondary_code_signs[i] = (d_data_secondary_code_string[i] == '0' ? 1.0F : -1.0F);
+        }
+}
+
+
 void dll_pll_veml_tracking::save_correlation_results()
 {
-    if (d_secondary)
+    (this->*d_save_correlation_results_fn)();
+}
+
+
+template <bool HasSecondary, bool TrackPilot>
+void dll_pll_veml_tracking::save_correlation_results_tpl()
+{
+    if constexpr (HasSecondary)
         {
-            if (d_secondary_code_string[d_current_symbol] == '0')
-                {
-                    if (d_veml)
-                        {
-                            d_VE_accu += *d_Very_Early;
-                            d_VL_accu += *d_Very_Late;
-                        }
-                    d_E_accu += *d_Early;
-                    d_P_accu += *d_Prompt;
-                    d_L_accu += *d_Late;
-                }
-            else
+            // secondary code wipe-off with the sign table precomputed in
+            // update_secondary_code_signs(): the pseudo-random secondary
+            // sequence would defeat the branch predictor at every epoch
+            const float secondary_sign = d_secondary_code_signs[d_current_symbol];
+            if (d_veml)
                 {
-                    if (d_veml)
-                        {
-                            d_VE_accu -= *d_Very_Early;
-                            d_VL_accu -= *d_Very_Late;
-                        }
-                    d_E_accu -= *d_Early;
-                    d_P_accu -= *d_Prompt;
-                    d_L_accu -= *d_Late;
+                    d_VE_accu += secondary_sign * *d_Very_Early;
+                    d_VL_accu += secondary_sign * *d_Very_Late;
                 }
+            d_E_accu += secondary_sign * *d_Early;
+            d_P_accu += secondary_sign * *d_Prompt;
+            d_L_accu += secondary_sign * *d_Late;
             d_current_symbol++;
             // secondary code roll-up
             d_current_symbol %= d_secondary_code_length;
         }
+    else if (d_extend_over_bits)
+        {
+            // integrate the current data bit apart; fold_data_bit() adds it
+            // to the extended accumulators once its sign is known
+            if (d_veml)
+                {
+                    d_VE_bit_accu += *d_Very_Early;
+                    d_VL_bit_accu += *d_Very_Late;
+                }
+            d_E_bit_accu += *d_Early;
+            d_P_bit_accu += *d_Prompt;
+            d_L_bit_accu += *d_Late;
+        }
     else
         {
             if (d_veml)
@@ -1307,27 +1785,14 @@ void dll_pll_veml_tracking::save_correlation_results()
         {
             if (d_data_secondary_code_length > 0)
                 {
-                    if (d_trk_parameters.track_pilot)
+                    const float data_secondary_sign = d_data_secondary_code_signs[d_current_data_symbol];
+                    if constexpr (TrackPilot)
                         {
-                            if (d_data_secondary_code_string[d_current_data_symbol] == '0')
-                                {
-                                    d_P_data_accu += d_Prompt_Data[0];
-                                }
-                            else
-                                {
-                                    d_P_data_accu -= d_Prompt_Data[0];
-                                }
+                            d_P_data_accu += data_secondary_sign * d_Prompt_Data[0];
                         }
                     else
                         {
-                            if (d_data_secondary_code_string[d_current_data_symbol] == '0')
-                                {
-                                    d_P_data_accu += *d_Prompt;
-                                }
-                            else
-                                {
-                                    d_P_data_accu -= *d_Prompt;
-                                }
+                            d_P_data_accu += data_secondary_sign * *d_Prompt;
                         }
 
                     d_current_data_symbol++;
@@ -1336,7 +1801,7 @@ void dll_pll_veml_tracking::save_correlation_results()
                 }
             else
                 {
-                    if (d_trk_parameters.track_pilot)
+                    if constexpr (TrackPilot)
                         {
                             d_P_data_accu += d_Prompt_Data[0];
                         }
@@ -1347,11 +1812,15 @@ void dll_pll_veml_tracking::save_correlation_results()
                         }
                     d_current_data_symbol++;
                     d_current_data_symbol %= d_symbols_per_bit;
+                    if (d_extend_over_bits && d_current_data_symbol == 0)
+                        {
+                            fold_data_bit();
+                        }
                 }
         }
     else
         {
-            if (d_trk_parameters.track_pilot)
+            if constexpr (TrackPilot)
                 {
                     d_P_data_accu = d_Prompt_Data[0];
                 }
@@ -1361,7 +1830,7 @@ void dll_pll_veml_tracking::save_correlation_results()
                 }
         }
 
-    if (d_trk_parameters.track_pilot)
+    if constexpr (TrackPilot)
         {
             // If tracking pilot, disable Costas loop
             d_cloop = false;
@@ -1373,8 +1842,166 @@ void dll_pll_veml_tracking::save_correlation_results()
 }
 
 
+void dll_pll_veml_tracking::bind_hot_path()
+{
+    // select the template instances matching the configuration flags frozen
+    // at this point, so the per-epoch path carries no dead branches
+    if (d_trk_parameters.track_pilot)
+        {
+            d_correlation_step_fn = d_trk_parameters.lite_mode
+                                        ? &dll_pll_veml_tracking::do_correlation_step_tpl<true, true>
+                                        : &dll_pll_veml_tracking::do_correlation_step_tpl<true, false>;
+            d_save_correlation_results_fn = d_secondary
+                                                ? &dll_pll_veml_tracking::save_correlation_results_tpl<true, true>
+                                                : &dll_pll_veml_tracking::save_correlation_results_tpl<false, true>;
+        }
+    else
+        {
+            d_correlation_step_fn = d_trk_parameters.lite_mode
+                                        ? &dll_pll_veml_tracking::do_correlation_step_tpl<false, true>
+                                        : &dll_pll_veml_tracking::do_correlation_step_tpl<false, false>;
+            d_save_correlation_results_fn = d_secondary
+                                                ? &dll_pll_veml_tracking::save_correlation_results_tpl<true, false>
+                                                : &dll_pll_veml_tracking::save_correlation_results_tpl<false, false>;
+        }
+    d_run_dll_pll_fn = (d_trk_parameters.enable_fll_pull_in or d_trk_parameters.enable_fll_steady_state)
+                           ? &dll_pll_veml_tracking::run_dll_pll_tpl<true>
+                           : &dll_pll_veml_tracking::run_dll_pll_tpl<false>;
+}
+
+
+float dll_pll_veml_tracking::predicted_data_bit_sign()
+{
+    // sign of the data bit that has just been integrated, as forecast by the
+    // telemetry decoder (0.0 if the bit is not covered by the prediction)
+    if (!d_bit_prediction_valid)
+        {
+            return 0.0F;
+        }
+    const double samples_per_bit = d_trk_parameters.fs_in * d_code_period * static_cast<double>(d_symbols_per_bit);
+    const double delta_samples = static_cast<double>(this->nitems_read(0)) - static_cast<double>(d_bit_prediction_first_sample);
+    const int64_t bit_index = std::lround(delta_samples / samples_per_bit);
+    if (bit_index < 0 || static_cast<size_t>(bit_index) >= d_predicted_bit_signs.size())
+        {
+            return 0.0F;
+        }
+    return d_predicted_bit_signs[static_cast<size_t>(bit_index)];
+}
+
+
+void dll_pll_veml_tracking::fold_data_bit()
+{
+    // a data bit has just been completed: wipe its sign off and add it to the
+    // extended correlation accumulators, so the coherent integration can span
+    // several bits. Use the sign fed back by the telemetry decoder when the
+    // bit is covered by the prediction, and decide it from the prompt
+    // correlator otherwise
+    float bit_sign = predicted_data_bit_sign();
+    if (bit_sign == 0.0F)
+        {
+            bit_sign = (d_P_bit_accu.real() >= 0.0F) ? 1.0F : -1.0F;
+        }
+    if (d_veml)
+        {
+            d_VE_accu += bit_sign * d_VE_bit_accu;
+            d_VL_accu += bit_sign * d_VL_bit_accu;
+            d_VE_bit_accu = gr_complex(0.0, 0.0);
+            d_VL_bit_accu = gr_complex(0.0, 0.0);
+        }
+    d_E_accu += bit_sign * d_E_bit_accu;
+    d_P_accu += bit_sign * d_P_bit_accu;
+    d_L_accu += bit_sign * d_L_bit_accu;
+    d_E_bit_accu = gr_complex(0.0, 0.0);
+    d_P_bit_accu = gr_complex(0.0, 0.0);
+    d_L_bit_accu = gr_complex(0.0, 0.0);
+}
+
+
+void dll_pll_veml_tracking::adapt_integration_time()
+{
+    // Per-channel integration time controller: strong channels double the
+    // coherent integration up to the configured extension, halving their
+    // loop-update rate each step, while channels fading toward the lock
+    // threshold step back down so the loops stay agile. Changes wait until
+    // the C/N0 buffer has been refilled at the new length, and the
+    // up/down thresholds leave a hysteresis band where the length holds
+    if (++d_adaptive_integration_counter < d_trk_parameters.cn0_samples)
+        {
+            return;
+        }
+    const int32_t bit_symbols = std::max(d_symbols_per_bit, 1);
+    int32_t new_symbols = d_extend_correlation_symbols;
+    if ((d_CN0_SNV_dB_Hz > static_cast<double>(d_trk_parameters.adaptive_integration_cn0_up)) && (d_extend_correlation_symbols < d_integration_symbols_max))
+        {
+            new_symbols = std::min(2 * d_extend_correlation_symbols, d_integration_symbols_max);
+        }
+    else if ((d_CN0_SNV_dB_Hz < static_cast<double>(d_trk_parameters.adaptive_integration_cn0_down)) && (d_extend_correlation_symbols > d_integration_symbols_min))
+        {
+            new_symbols = std::max(d_extend_correlation_symbols / 2, d_integration_symbols_min);
+        }
+    // keep the length a whole number of data bits
+    new_symbols = std::max(bit_symbols * (new_symbols / bit_symbols), d_integration_symbols_min);
+    if (new_symbols == d_extend_correlation_symbols)
+        {
+            return;
+        }
+    d_adaptive_integration_counter = 0;
+    d_extend_correlation_symbols = new_symbols;
+    d_current_correlation_time_s = static_cast<float>(d_extend_correlation_symbols) * static_cast<float>(d_code_period);
+    d_code_loop_filter.set_update_interval(static_cast<float>(d_current_correlation_time_s));
+    DLOG(INFO) << "Channel " << d_channel << ": coherent integration set to "
+               << d_extend_correlation_symbols * static_cast<int32_t>(d_code_period * 1000.0)
+               << " ms at " << d_CN0_SNV_dB_Hz << " dB-Hz";
+}
+
+
 void dll_pll_veml_tracking::log_data()
 {
+    const Tracking_Perf_Counters::Scoped_Timer perf_timer(&d_perf_counters, Tracking_Perf_Counters::LOGGING, d_trk_parameters.dump_perf);
+    if (Tracking_Metrics_Hook::get_instance().has_subscribers())
+        {
+            // hand the epoch to the in-process subscribers, so analytics can
+            // consume the tracking state without enabling the binary dumps
+            gnss_sdr_tracking_epoch_t epoch{};
+            epoch.sample_counter = this->nitems_read(0) + static_cast<uint64_t>(d_current_prn_length_samples);
+            if (d_veml)
+                {
+                    epoch.abs_VE = static_cast<double>(std::abs<float>(d_VE_accu));
+                    epoch.abs_VL = static_cast<double>(std::abs<float>(d_VL_accu));
+                }
+            epoch.abs_E = static_cast<double>(std::abs<float>(d_E_accu));
+            epoch.abs_P = static_cast<double>(std::abs<float>(d_P_accu));
+            epoch.abs_L = static_cast<double>(std::abs<float>(d_L_accu));
+            if (d_trk_parameters.track_pilot)
+                {
+                    epoch.prompt_I = static_cast<double>(d_Prompt_Data.data()->real());
+                    epoch.prompt_Q = static_cast<double>(d_Prompt_Data.data()->imag());
+                }
+            else
+                {
+                    epoch.prompt_I = static_cast<double>(d_Prompt->real());
+                    epoch.prompt_Q = static_cast<double>(d_Prompt->imag());
+                }
+            epoch.acc_carrier_phase_rad = get_acc_carrier_phase_rad();
+            epoch.carrier_doppler_hz = d_carrier_doppler_hz;
+            epoch.carrier_phase_rate_hz_s = d_carrier_phase_rate_step_rad * d_trk_parameters.fs_in * d_trk_parameters.fs_in / TWO_PI;
+            epoch.code_freq_chips_s = d_code_freq_chips;
+            epoch.code_phase_rate_chips_s2 = d_code_phase_rate_step_chips * d_trk_parameters.fs_in * d_trk_parameters.fs_in;
+            epoch.carr_error_hz = d_carr_phase_error_hz;
+            epoch.carr_error_filt_hz = d_carr_error_filt_hz;
+            epoch.code_error_chips = d_code_error_chips;
+            epoch.code_error_filt_chips = d_code_error_filt_chips;
+            epoch.cn0_db_hz = d_CN0_SNV_dB_Hz;
+            epoch.carrier_lock_test = d_carrier_lock_test;
+            epoch.rem_code_phase_samples = d_rem_code_phase_samples;
+            epoch.channel = d_channel;
+            epoch.prn = d_acquisition_gnss_synchro->PRN;
+            epoch.system = d_acquisition_gnss_synchro->System;
+            epoch.signal[0] = d_acquisition_gnss_synchro->Signal[0];
+            epoch.signal[1] = d_acquisition_gnss_synchro->Signal[1];
+            epoch.signal[2] = '\0';
+            Tracking_Metrics_Hook::get_instance().publish(epoch);
+        }
     if (d_dump)
         {
             // Dump results to file
@@ -1412,62 +2039,66 @@ void dll_pll_veml_tracking::log_data()
             tmp_P = std::abs<float>(d_P_accu);
             tmp_L = std::abs<float>(d_L_accu);
 
-            try
-                {
-                    // Dump correlators output
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_VE), sizeof(float));
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_E), sizeof(float));
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_P), sizeof(float));
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_L), sizeof(float));
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_VL), sizeof(float));
-                    // PROMPT I and Q (to analyze navigation symbols)
-                    d_dump_file.write(reinterpret_cast<char *>(&prompt_I), sizeof(float));
-                    d_dump_file.write(reinterpret_cast<char *>(&prompt_Q), sizeof(float));
-                    // PRN start sample stamp
-                    tmp_long_int = this->nitems_read(0) + static_cast<uint64_t>(d_current_prn_length_samples);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_long_int), sizeof(uint64_t));
-                    // accumulated carrier phase
-                    tmp_float = static_cast<float>(d_acc_carrier_phase_rad);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    // carrier and code frequency
-                    tmp_float = static_cast<float>(d_carrier_doppler_hz);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    // carrier phase rate [Hz/s]
-                    tmp_float = static_cast<float>(d_carrier_phase_rate_step_rad * d_trk_parameters.fs_in * d_trk_parameters.fs_in / TWO_PI);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    tmp_float = static_cast<float>(d_code_freq_chips);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    // code phase rate [chips/s^2]
-                    tmp_float = static_cast<float>(d_code_phase_rate_step_chips * d_trk_parameters.fs_in * d_trk_parameters.fs_in);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    // PLL commands
-                    tmp_float = static_cast<float>(d_carr_phase_error_hz);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    tmp_float = static_cast<float>(d_carr_error_filt_hz);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    // DLL commands
-                    tmp_float = static_cast<float>(d_code_error_chips);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    tmp_float = static_cast<float>(d_code_error_filt_chips);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    // CN0 and carrier lock test
-                    tmp_float = static_cast<float>(d_CN0_SNV_dB_Hz);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    tmp_float = static_cast<float>(d_carrier_lock_test);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    // AUX vars (for debug purposes)
-                    tmp_float = static_cast<float>(d_rem_code_phase_samples);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    tmp_double = static_cast<double>(this->nitems_read(0) + d_current_prn_length_samples);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                    // PRN
-                    uint32_t prn_ = d_acquisition_gnss_synchro->PRN;
-                    d_dump_file.write(reinterpret_cast<char *>(&prn_), sizeof(uint32_t));
-                }
-            catch (const std::ofstream::failure &e)
-                {
-                    LOG(WARNING) << "Exception writing trk dump file " << e.what();
-                }
+            // stage the epoch into one contiguous record and hand it to the
+            // shared asynchronous writer, keeping the file layout expected
+            // by save_matfile()
+            std::vector<char> record;
+            record.reserve(19 * sizeof(float) + sizeof(uint64_t) + sizeof(double) + sizeof(uint32_t));
+            const auto put = [&record](const void *value, std::size_t size) {
+                const auto *bytes = static_cast<const char *>(value);
+                record.insert(record.end(), bytes, bytes + size);
+            };
+            // Dump correlators output
+            put(&tmp_VE, sizeof(float));
+            put(&tmp_E, sizeof(float));
+            put(&tmp_P, sizeof(float));
+            put(&tmp_L, sizeof(float));
+            put(&tmp_VL, sizeof(float));
+            // PROMPT I and Q (to analyze navigation symbols)
+            put(&prompt_I, sizeof(float));
+            put(&prompt_Q, sizeof(float));
+            // PRN start sample stamp
+            tmp_long_int = this->nitems_read(0) + static_cast<uint64_t>(d_current_prn_length_samples);
+            put(&tmp_long_int, sizeof(uint64_t));
+            // accumulated carrier phase
+            tmp_float = static_cast<float>(get_acc_carrier_phase_rad());
+            put(&tmp_float, sizeof(float));
+            // carrier and code frequency
+            tmp_float = static_cast<float>(d_carrier_doppler_hz);
+            put(&tmp_float, sizeof(float));
+            // carrier phase rate [Hz/s]
+            tmp_float = static_cast<float>(d_carrier_phase_rate_step_rad * d_trk_parameters.fs_in * d_trk_parameters.fs_in / TWO_PI);
+            put(&tmp_float, sizeof(float));
+            tmp_float = static_cast<float>(d_code_freq_chips);
+            put(&tmp_float, sizeof(float));
+            // code phase rate [chips/s^2]
+            tmp_float = static_cast<float>(d_code_phase_rate_step_chips * d_trk_parameters.fs_in * d_trk_parameters.fs_in);
+            put(&tmp_float, sizeof(float));
+            // PLL commands
+            tmp_float = static_cast<float>(d_carr_phase_error_hz);
+            put(&tmp_float, sizeof(float));
+            tmp_float = static_cast<float>(d_carr_error_filt_hz);
+            put(&tmp_float, sizeof(float));
+            // DLL commands
+            tmp_float = static_cast<float>(d_code_error_chips);
+            put(&tmp_float, sizeof(float));
+            tmp_float = static_cast<float>(d_code_error_filt_chips);
+            put(&tmp_float, sizeof(float));
+            // CN0 and carrier lock test
+            tmp_float = static_cast<float>(d_CN0_SNV_dB_Hz);
+            put(&tmp_float, sizeof(float));
+            tmp_float = static_cast<float>(d_carrier_lock_test);
+            put(&tmp_float, sizeof(float));
+            // AUX vars (for debug purposes)
+            tmp_float = static_cast<float>(d_rem_code_phase_samples);
+            put(&tmp_float, sizeof(float));
+            tmp_double = static_cast<double>(this->nitems_read(0) + d_current_prn_length_samples);
+            put(&tmp_double, sizeof(double));
+            // PRN
+            uint32_t prn_ = d_acquisition_gnss_synchro->PRN;
+            put(&prn_, sizeof(uint32_t));
+
+            Async_Dump_Writer::get_instance().write(d_dump_stream_id, record.data(), record.size());
         }
 }
 
@@ -1509,57 +2140,73 @@ int32_t dll_pll_veml_tracking::save_matfile() const
         {
             return 1;
         }
-    auto abs_VE = std::vector<float>(num_epoch);
-    auto abs_E = std::vector<float>(num_epoch);
-    auto abs_P = std::vector<float>(num_epoch);
-    auto abs_L = std::vector<float>(num_epoch);
-    auto abs_VL = std::vector<float>(num_epoch);
-    auto Prompt_I = std::vector<float>(num_epoch);
-    auto Prompt_Q = std::vector<float>(num_epoch);
-    auto PRN_start_sample_count = std::vector<uint64_t>(num_epoch);
-    auto acc_carrier_phase_rad = std::vector<float>(num_epoch);
-    auto carrier_doppler_hz = std::vector<float>(num_epoch);
-    auto carrier_doppler_rate_hz = std::vector<float>(num_epoch);
-    auto code_freq_chips = std::vector<float>(num_epoch);
-    auto code_freq_rate_chips = std::vector<float>(num_epoch);
-    auto carr_error_hz = std::vector<float>(num_epoch);
-    auto carr_error_filt_hz = std::vector<float>(num_epoch);
-    auto code_error_chips = std::vector<float>(num_epoch);
-    auto code_error_filt_chips = std::vector<float>(num_epoch);
-    auto CN0_SNV_dB_Hz = std::vector<float>(num_epoch);
-    auto carrier_lock_test = std::vector<float>(num_epoch);
-    auto aux1 = std::vector<float>(num_epoch);
-    auto aux2 = std::vector<double>(num_epoch);
-    auto PRN = std::vector<uint32_t>(num_epoch);
+    // WRITE MAT FILE
+    std::string filename = dump_filename_;
+    filename.erase(filename.length() - 4, 4);
+    filename.append(".mat");
+    Streaming_Mat_Writer mat_writer;
+    if (!mat_writer.open(filename))
+        {
+            std::cerr << "Problem creating .mat file " << filename << '\n';
+            return 1;
+        }
+
+    // field layout of one epoch record in the dump file
+    struct Dump_Field
+    {
+        const char *name;
+        Streaming_Mat_Writer::Mat_Type type;
+        std::size_t offset;
+        std::size_t size;
+    };
+    const std::array<Dump_Field, 22> fields = {{
+        {"abs_VE", Streaming_Mat_Writer::Mat_Type::mat_single, 0, sizeof(float)},
+        {"abs_E", Streaming_Mat_Writer::Mat_Type::mat_single, 4, sizeof(float)},
+        {"abs_P", Streaming_Mat_Writer::Mat_Type::mat_single, 8, sizeof(float)},
+        {"abs_L", Streaming_Mat_Writer::Mat_Type::mat_single, 12, sizeof(float)},
+        {"abs_VL", Streaming_Mat_Writer::Mat_Type::mat_single, 16, sizeof(float)},
+        {"Prompt_I", Streaming_Mat_Writer::Mat_Type::mat_single, 20, sizeof(float)},
+        {"Prompt_Q", Streaming_Mat_Writer::Mat_Type::mat_single, 24, sizeof(float)},
+        {"PRN_start_sample_count", Streaming_Mat_Writer::Mat_Type::mat_uint64, 28, sizeof(uint64_t)},
+        {"acc_carrier_phase_rad", Streaming_Mat_Writer::Mat_Type::mat_single, 36, sizeof(float)},
+        {"carrier_doppler_hz", Streaming_Mat_Writer::Mat_Type::mat_single, 40, sizeof(float)},
+        {"carrier_doppler_rate_hz", Streaming_Mat_Writer::Mat_Type::mat_single, 44, sizeof(float)},
+        {"code_freq_chips", Streaming_Mat_Writer::Mat_Type::mat_single, 48, sizeof(float)},
+        {"code_freq_rate_chips", Streaming_Mat_Writer::Mat_Type::mat_single, 52, sizeof(float)},
+        {"carr_error_hz", Streaming_Mat_Writer::Mat_Type::mat_single, 56, sizeof(float)},
+        {"carr_error_filt_hz", Streaming_Mat_Writer::Mat_Type::mat_single, 60, sizeof(float)},
+        {"code_error_chips", Streaming_Mat_Writer::Mat_Type::mat_single, 64, sizeof(float)},
+        {"code_error_filt_chips", Streaming_Mat_Writer::Mat_Type::mat_single, 68, sizeof(float)},
+        {"CN0_SNV_dB_Hz", Streaming_Mat_Writer::Mat_Type::mat_single, 72, sizeof(float)},
+        {"carrier_lock_test", Streaming_Mat_Writer::Mat_Type::mat_single, 76, sizeof(float)},
+        {"aux1", Streaming_Mat_Writer::Mat_Type::mat_single, 80, sizeof(float)},
+        {"aux2", Streaming_Mat_Writer::Mat_Type::mat_double, 84, sizeof(double)},
+        {"PRN", Streaming_Mat_Writer::Mat_Type::mat_uint32, 92, sizeof(uint32_t)},
+    }};
+
+    // one pass over the dump file per variable, in bounded chunks of epochs
+    const int64_t epochs_per_chunk = 4096;
+    auto chunk = std::vector<char>(epochs_per_chunk * epoch_size_bytes);
+    auto column = std::vector<char>(epochs_per_chunk * sizeof(double));
     try
         {
-            if (dump_file.is_open())
+            for (const auto &field : fields)
                 {
-                    for (int64_t i = 0; i < num_epoch; i++)
+                    dump_file.seekg(0, std::ios::beg);
+                    mat_writer.begin_variable(field.name, field.type, 1);
+                    int64_t epoch = 0;
+                    while (epoch < num_epoch)
                         {
-                            dump_file.read(reinterpret_cast<char *>(&abs_VE[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&abs_E[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&abs_P[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&abs_L[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&abs_VL[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&Prompt_I[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&Prompt_Q[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&PRN_start_sample_count[i]), sizeof(uint64_t));
-                            dump_file.read(reinterpret_cast<char *>(&acc_carrier_phase_rad[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&carrier_doppler_hz[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&carrier_doppler_rate_hz[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&code_freq_chips[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&code_freq_rate_chips[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&carr_error_hz[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&carr_error_filt_hz[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&code_error_chips[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&code_error_filt_chips[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&CN0_SNV_dB_Hz[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&carrier_lock_test[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&aux1[i]), sizeof(float));
-                            dump_file.read(reinterpret_cast<char *>(&aux2[i]), sizeof(double));
-                            dump_file.read(reinterpret_cast<char *>(&PRN[i]), sizeof(uint32_t));
+                            const int64_t epochs_in_chunk = std::min(epochs_per_chunk, num_epoch - epoch);
+                            dump_file.read(chunk.data(), epochs_in_chunk * epoch_size_bytes);
+                            for (int64_t i = 0; i < epochs_in_chunk; i++)
+                                {
+                                    std::memcpy(column.data() + static_cast<std::size_t>(i) * field.size, chunk.data() + i * epoch_size_bytes + field.offset, field.size);
+                                }
+                            mat_writer.append(column.data(), static_cast<std::size_t>(epochs_in_chunk));
+                            epoch += epochs_in_chunk;
                         }
+                    mat_writer.end_variable();
                 }
             dump_file.close();
         }
@@ -1568,106 +2215,7 @@ int32_t dll_pll_veml_tracking::save_matfile() const
             std::cerr << "Problem reading dump file:" << e.what() << '\n';
             return 1;
         }
-
-    // WRITE MAT FILE
-    mat_t *matfp;
-    matvar_t *matvar;
-    std::string filename = dump_filename_;
-    filename.erase(filename.length() - 4, 4);
-    filename.append(".mat");
-    matfp = Mat_CreateVer(filename.c_str(), nullptr, MAT_FT_MAT73);
-    if (reinterpret_cast<int64_t *>(matfp) != nullptr)
-        {
-            std::array<size_t, 2> dims{1, static_cast<size_t>(num_epoch)};
-            matvar = Mat_VarCreate("abs_VE", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), abs_VE.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("abs_E", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), abs_E.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("abs_P", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), abs_P.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("abs_L", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), abs_L.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("abs_VL", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), abs_VL.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("Prompt_I", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), Prompt_I.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("Prompt_Q", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), Prompt_Q.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("PRN_start_sample_count", MAT_C_UINT64, MAT_T_UINT64, 2, dims.data(), PRN_start_sample_count.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("acc_carrier_phase_rad", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), acc_carrier_phase_rad.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("carrier_doppler_hz", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), carrier_doppler_hz.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("carrier_doppler_rate_hz", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), carrier_doppler_rate_hz.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("code_freq_chips", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), code_freq_chips.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("code_freq_rate_chips", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), code_freq_rate_chips.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("carr_error_hz", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), carr_error_hz.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("carr_error_filt_hz", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), carr_error_filt_hz.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("code_error_chips", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), code_error_chips.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("code_error_filt_chips", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), code_error_filt_chips.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("CN0_SNV_dB_Hz", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), CN0_SNV_dB_Hz.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("carrier_lock_test", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), carrier_lock_test.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("aux1", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims.data(), aux1.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("aux2", MAT_C_DOUBLE, MAT_T_DOUBLE, 2, dims.data(), aux2.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-
-            matvar = Mat_VarCreate("PRN", MAT_C_UINT32, MAT_T_UINT32, 2, dims.data(), PRN.data(), 0);
-            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
-            Mat_VarFree(matvar);
-        }
-    Mat_Close(matfp);
+    mat_writer.close();
     return 0;
 }
 
@@ -1686,18 +2234,10 @@ void dll_pll_veml_tracking::set_channel(uint32_t channel)
             // add extension
             dump_filename_.append(".dat");
 
-            if (!d_dump_file.is_open())
+            if (d_dump_stream_id < 0)
                 {
-                    try
-                        {
-                            d_dump_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
-                            d_dump_file.open(dump_filename_.c_str(), std::ios::out | std::ios::binary);
-                            LOG(INFO) << "Tracking dump enabled on channel " << d_channel << " Log file: " << dump_filename_.c_str();
-                        }
-                    catch (const std::ofstream::failure &e)
-                        {
-                            LOG(WARNING) << "channel " << d_channel << " Exception opening trk dump file " << e.what();
-                        }
+                    d_dump_stream_id = Async_Dump_Writer::get_instance().open_stream(dump_filename_);
+                    LOG(INFO) << "Tracking dump enabled on channel " << d_channel << " Log file: " << dump_filename_.c_str();
                 }
         }
 }
@@ -1713,6 +2253,11 @@ void dll_pll_veml_tracking::set_gnss_synchro(Gnss_Synchro *p_gnss_synchro)
 void dll_pll_veml_tracking::stop_tracking()
 {
     gr::thread::scoped_lock l(d_setlock);
+    if (d_trk_parameters.dump_perf and (d_perf_counters.epochs() > 0U))
+        {
+            LOG(INFO) << "Tracking channel " << d_channel << " (" << d_systemName << ' ' << d_signal_pretty_name << ") final perf: " << d_perf_counters.summary();
+            d_perf_counters.reset();
+        }
     d_state = 0;
 }
 
@@ -1725,12 +2270,8 @@ int64_t dll_pll_veml_tracking::uint64diff(uint64_t first, uint64_t second)
 }
 
 
-int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items,
-    gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
+int dll_pll_veml_tracking::process_epoch(const gr_complex *in, int available_samples, Gnss_Synchro *out, int items_produced)
 {
-    gr::thread::scoped_lock l(d_setlock);
-    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
-    auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);
     Gnss_Synchro current_synchro_data = Gnss_Synchro();
     current_synchro_data.Flag_valid_symbol_output = false;
     bool loss_of_lock = false;
@@ -1749,8 +2290,8 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
         {
         case 0:  // Standby - Consume samples at full throttle, do nothing
             {
-                // d_sample_counter += static_cast<uint64_t>(ninput_items[0]);
-                consume_each(ninput_items[0]);
+                // d_sample_counter += static_cast<uint64_t>(available_samples);
+                consume_each(available_samples);
                 return 0;
                 break;
             }
@@ -1773,7 +2314,8 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
                 d_current_prn_length_samples = round(T_prn_mod_samples);
 
                 const int32_t samples_offset = round(d_acq_code_phase_samples);
-                d_acc_carrier_phase_rad -= d_carrier_phase_step_rad * static_cast<double>(samples_offset);
+                d_acc_carrier_phase_rad -= d_carrier_doppler_phase_step_rad * static_cast<double>(samples_offset);
+                d_acc_carrier_phase_q32 -= std::llround(d_carrier_doppler_phase_step_rad * static_cast<double>(samples_offset) * PHASE_Q32_PER_RAD);
                 d_state = 2;
                 // d_sample_counter += samples_offset;  // count for the processed samples
                 d_cn0_smoother.reset();
@@ -1882,6 +2424,11 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
                                 d_P_data_accu = gr_complex(0.0, 0.0);
                                 d_L_accu = gr_complex(0.0, 0.0);
                                 d_VL_accu = gr_complex(0.0, 0.0);
+                                d_VE_bit_accu = gr_complex(0.0, 0.0);
+                                d_E_bit_accu = gr_complex(0.0, 0.0);
+                                d_P_bit_accu = gr_complex(0.0, 0.0);
+                                d_L_bit_accu = gr_complex(0.0, 0.0);
+                                d_VL_bit_accu = gr_complex(0.0, 0.0);
                                 d_Prompt_circular_buffer.clear();
                                 d_current_symbol = 0;
                                 d_current_data_symbol = 0;
@@ -1921,6 +2468,15 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
                                                 d_local_code_shift_chips[2] = d_trk_parameters.early_late_space_narrow_chips * static_cast<float>(d_code_samples_per_chip);
                                                 d_trk_parameters.spc = d_trk_parameters.early_late_space_narrow_chips;
                                             }
+                                        if (d_trk_parameters.adaptive_integration)
+                                            {
+                                                // bounds for the integration time controller:
+                                                // whole data bits, at most the configured
+                                                // (and possibly GEO-clamped) extension
+                                                d_integration_symbols_max = d_extend_correlation_symbols;
+                                                d_integration_symbols_min = std::min(d_extend_correlation_symbols, std::max(2, d_symbols_per_bit));
+                                                d_adaptive_integration_counter = 0;
+                                            }
                                     }
                                 else
                                     {
@@ -1953,7 +2509,7 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
                                 current_synchro_data.Prompt_Q = static_cast<double>(d_P_data_accu.imag());
                             }
                         current_synchro_data.Code_phase_samples = d_rem_code_phase_samples;
-                        current_synchro_data.Carrier_phase_rads = d_acc_carrier_phase_rad;
+                        current_synchro_data.Carrier_phase_rads = get_acc_carrier_phase_rad();
                         current_synchro_data.Carrier_Doppler_hz = d_carrier_doppler_hz;
                         current_synchro_data.CN0_dB_hz = d_CN0_SNV_dB_Hz;
                         current_synchro_data.correlation_length_ms = d_correlation_length_ms;
@@ -2005,7 +2561,7 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
                                         current_synchro_data.Prompt_Q = static_cast<double>(d_P_data_accu.imag());
                                     }
                                 current_synchro_data.Code_phase_samples = d_rem_code_phase_samples;
-                                current_synchro_data.Carrier_phase_rads = d_acc_carrier_phase_rad;
+                                current_synchro_data.Carrier_phase_rads = get_acc_carrier_phase_rad();
                                 current_synchro_data.Carrier_Doppler_hz = d_carrier_doppler_hz;
                                 current_synchro_data.CN0_dB_hz = d_CN0_SNV_dB_Hz;
                                 current_synchro_data.correlation_length_ms = d_correlation_length_ms;
@@ -2019,6 +2575,12 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
                         d_P_accu = gr_complex(0.0, 0.0);
                         d_L_accu = gr_complex(0.0, 0.0);
                         d_VL_accu = gr_complex(0.0, 0.0);
+                        if (d_trk_parameters.adaptive_integration && d_enable_extended_integration)
+                            {
+                                // the cycle boundary is the only safe point to
+                                // change the coherent integration length
+                                adapt_integration_time();
+                            }
                         if (d_enable_extended_integration)
                             {
                                 d_state = 3;  // new coherent integration (correlation time extension) cycle
@@ -2066,7 +2628,15 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
             current_synchro_data.Tracking_sample_counter = this->nitems_read(0);
             current_synchro_data.Flag_valid_symbol_output = !loss_of_lock;
             current_synchro_data.Flag_PLL_180_deg_phase_locked = d_Flag_PLL_180_deg_phase_locked;
-            *out[0] = current_synchro_data;
+            // carrier lock state for the consumers downstream (e.g. the carrier
+            // smoother resets its Hatch filter when the detector reports a slip)
+            current_synchro_data.Flag_carrier_lock = !loss_of_lock and !d_pull_in_transitory and (d_carrier_lock_fail_counter == 0);
+            *out = current_synchro_data;
+
+            if (Latency_Tracer::get_instance().enabled())
+                {
+                    Latency_Tracer::get_instance().record_stage("tracking", current_synchro_data.Tracking_sample_counter);
+                }
 
             // generate new tag associated with gnss-synchro object
 
@@ -2082,7 +2652,7 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
                     tmp_obj->tow_ms = d_last_timetag.tow_ms + static_cast<int>(intpart);
                     tmp_obj->tow_ms_fraction = d_last_timetag.tow_ms_fraction;
                     tmp_obj->rx_time = static_cast<double>(current_synchro_data.Tracking_sample_counter) / d_trk_parameters.fs_in;
-                    add_item_tag(0, this->nitems_written(0) + 1, pmt::mp("timetag"), pmt::make_any(tmp_obj));
+                    add_item_tag(0, this->nitems_written(0) + items_produced + 1, pmt::mp("timetag"), pmt::make_any(tmp_obj));
 
                     // std::cout << "[" << this->nitems_written(0) + 1 << "][diff_time: " << 1000.0 * static_cast<double>(diff_samplecount) / d_trk_parameters.fs_in << "] Sent TimeTag Week: " << d_last_timetag.week << ", TOW: " << d_last_timetag.tow_ms << " [ms], TOW fraction: " << d_last_timetag.tow_ms_fraction << " [ms] \n";
                     d_timetag_waiting = false;
@@ -2092,3 +2662,32 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
         }
     return 0;
 }
+
+
+int dll_pll_veml_tracking::general_work(int noutput_items, gr_vector_int &ninput_items,
+    gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
+{
+    gr::thread::scoped_lock l(d_setlock);
+    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
+    auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);
+    int produced = 0;
+    int available_samples = ninput_items[0];
+
+    // Blockwise operation: correlate up to epochs_per_work consecutive
+    // integration periods in one call, iterating the loop filters locally
+    // over each result. This cuts the per-epoch scheduler crossings without
+    // changing the tracking loop dynamics
+    for (int32_t epoch = 0; epoch < d_epochs_per_work; epoch++)
+        {
+            const uint64_t nitems_read_before = this->nitems_read(0);
+            produced += process_epoch(in, available_samples, &out[0][produced], produced);
+            const auto samples_consumed = static_cast<int>(this->nitems_read(0) - nitems_read_before);
+            in += samples_consumed;
+            available_samples -= samples_consumed;
+            if (d_state < 2 || produced == noutput_items || available_samples <= d_current_prn_length_samples)
+                {
+                    break;
+                }
+        }
+    return produced;
+}
@@ -18,6 +18,7 @@
 #ifndef GNSS_SDR_DLL_PLL_VEML_TRACKING_H
 #define GNSS_SDR_DLL_PLL_VEML_TRACKING_H
 
+#include "cpu_multicorrelator_16sc.h"  // for the lite_mode integer path
 #include "cpu_multicorrelator_real_codes.h"
 #include "dll_pll_conf.h"
 #include "exponential_smoother.h"
@@ -25,6 +26,7 @@
 #include "gnss_time.h"                // for timetags produced by File_Timestamp_Signal_Source
 #include "tracking_FLL_PLL_filter.h"  // for PLL/FLL filter
 #include "tracking_loop_filter.h"     // for DLL filter
+#include "tracking_perf_counters.h"   // for per-stage CPU time counters
 #include <boost/circular_buffer.hpp>
 #include <gnuradio/block.h>                   // for block
 #include <gnuradio/gr_complex.h>              // for gr_complex
@@ -37,6 +39,7 @@
 #include <string>                             // for string
 #include <typeinfo>                           // for typeid
 #include <utility>                            // for pair
+#include <vector>                             // for vector
 
 /** \addtogroup Tracking
  * \{ */
@@ -75,12 +78,33 @@ private:
     explicit dll_pll_veml_tracking(const Dll_Pll_Conf &conf_);
 
     void msg_handler_telemetry_to_trk(const pmt::pmt_t &msg);
+    void msg_handler_pvt_to_trk(const pmt::pmt_t &msg);
+    bool vtl_assist_is_fresh();
+    int process_epoch(const gr_complex *in, int available_samples, Gnss_Synchro *out, int items_produced);
+    //! The per-epoch hot path is compiled once per tracking configuration
+    //! through the templates below; bind_hot_path() selects the instances
+    //! matching the flags frozen at start_tracking(), and the plain names are
+    //! thin dispatchers so the state machine in general_work() is unchanged
+    void bind_hot_path();
     void do_correlation_step(const gr_complex *input_samples);
+    template <bool TrackPilot, bool LiteMode>
+    void do_correlation_step_tpl(const gr_complex *input_samples);
     void run_dll_pll();
+    template <bool EnableFll>
+    void run_dll_pll_tpl();
     void check_carrier_phase_coherent_initialization();
+    //! Accumulated carrier phase in radians, converted from the fixed-point
+    //! accumulator when fp_carrier_phase is enabled
+    double get_acc_carrier_phase_rad() const;
     void update_tracking_vars();
     void clear_tracking_vars();
     void save_correlation_results();
+    template <bool HasSecondary, bool TrackPilot>
+    void save_correlation_results_tpl();
+    void fold_data_bit();
+    void adapt_integration_time();
+    float predicted_data_bit_sign();
+    void update_secondary_code_signs();
     void log_data();
     bool cn0_and_tracking_lock_status(double coh_integration_time_s);
     bool acquire_secondary();
@@ -89,6 +113,7 @@ private:
 
     Cpu_Multicorrelator_Real_Codes d_multicorrelator_cpu;
     Cpu_Multicorrelator_Real_Codes d_correlator_data_cpu;  // for data channel
+    Cpu_Multicorrelator_16sc d_multicorrelator_cpu_16sc;   // for lite_mode
 
     Dll_Pll_Conf d_trk_parameters;
 
@@ -98,14 +123,27 @@ private:
     Tracking_loop_filter d_code_loop_filter;
     Tracking_FLL_PLL_filter d_carrier_loop_filter;
 
+    Tracking_Perf_Counters d_perf_counters;
+
+    // hot-path template instances selected in bind_hot_path()
+    void (dll_pll_veml_tracking::*d_correlation_step_fn)(const gr_complex *) = nullptr;
+    void (dll_pll_veml_tracking::*d_run_dll_pll_fn)() = nullptr;
+    void (dll_pll_veml_tracking::*d_save_correlation_results_fn)() = nullptr;
+
     Gnss_Synchro *d_acquisition_gnss_synchro;
 
     volk_gnsssdr::vector<float> d_tracking_code;
+    volk_gnsssdr::vector<lv_16sc_t> d_tracking_code_16sc;    // for lite_mode
+    volk_gnsssdr::vector<lv_16sc_t> d_correlator_outs_16sc;  // for lite_mode
+    volk_gnsssdr::vector<lv_16sc_t> d_input_16sc;            // for lite_mode
     volk_gnsssdr::vector<float> d_data_code;
     volk_gnsssdr::vector<float> d_local_code_shift_chips;
     volk_gnsssdr::vector<gr_complex> d_correlator_outs;
     volk_gnsssdr::vector<gr_complex> d_Prompt_Data;
     volk_gnsssdr::vector<gr_complex> d_Prompt_buffer;
+    volk_gnsssdr::vector<float> d_lock_detector_scratch;
+    volk_gnsssdr::vector<float> d_secondary_code_signs;
+    volk_gnsssdr::vector<float> d_data_secondary_code_signs;
 
     boost::circular_buffer<float> d_dll_filt_history;
     boost::circular_buffer<std::pair<double, double>> d_code_ph_history;
@@ -137,10 +175,23 @@ private:
     double d_CN0_SNV_dB_Hz;
     double d_carrier_lock_threshold;
     double d_carrier_phase_step_rad;
+    double d_carrier_doppler_phase_step_rad;
     double d_carrier_phase_rate_step_rad;
     double d_code_phase_step_chips;
     double d_code_phase_rate_step_chips;
     double d_rem_code_phase_samples;
+    double d_vtl_cmd_doppler_hz = 0.0;  // last NCO command received from the PVT block
+    // GLONASS FDMA: constant carrier offset of the satellite frequency slot,
+    // fed forward to the carrier NCO so the loop filter only tracks Doppler
+    double d_fdma_carrier_offset_hz = 0.0;
+
+    // Q32.32 fixed-point carrier phase accumulator (in cycles), used instead
+    // of d_acc_carrier_phase_rad when fp_carrier_phase is enabled: the
+    // per-epoch accumulation is integer-only and the conversion to radians
+    // is deferred to observable emission
+    int64_t d_acc_carrier_phase_q32;
+    int64_t d_carrier_phase_step_q32;
+    int64_t d_carrier_phase_rate_step_q62;
 
     gr_complex *d_Very_Early;
     gr_complex *d_Early;
@@ -156,6 +207,15 @@ private:
     gr_complex d_VL_accu;
     gr_complex d_P_data_accu;
 
+    // per-bit partial sums, folded into the accumulators above by fold_data_bit()
+    gr_complex d_VE_bit_accu;
+    gr_complex d_E_bit_accu;
+    gr_complex d_P_bit_accu;
+    gr_complex d_L_bit_accu;
+    gr_complex d_VL_bit_accu;
+
+    std::vector<float> d_predicted_bit_signs;  // data bit signs fed back by the telemetry decoder
+
     std::string d_secondary_code_string;
     std::string d_data_secondary_code_string;
     std::string d_systemName;
@@ -163,10 +223,12 @@ private:
     std::string d_signal_pretty_name;
     std::string d_dump_filename;
 
-    std::ofstream d_dump_file;
+    int d_dump_stream_id = -1;  // handle into the shared Async_Dump_Writer
 
     // uint64_t d_sample_counter;
     uint64_t d_acq_sample_stamp;
+    uint64_t d_vtl_cmd_sample_counter = 0ULL;
+    uint64_t d_bit_prediction_first_sample = 0ULL;
     GnssTime d_last_timetag{};
     uint64_t d_last_timetag_samplecounter;
     bool d_timetag_waiting;
@@ -181,6 +243,10 @@ private:
     int32_t d_current_prn_length_samples;
     int32_t d_extend_correlation_symbols_count;
     int32_t d_extend_correlation_symbols;
+    int32_t d_integration_symbols_min;
+    int32_t d_integration_symbols_max;
+    int32_t d_adaptive_integration_counter;
+    int32_t d_epochs_per_work = 1;  // integration periods processed per work() call (blockwise mode)
     int32_t d_current_symbol;
     int32_t d_current_data_symbol;
     int32_t d_cn0_estimation_counter;
@@ -195,6 +261,7 @@ private:
 
     bool d_pull_in_transitory;
     bool d_corrected_doppler;
+    bool d_vtl_cmd_valid = false;
     bool d_interchange_iq;
     bool d_veml;
     bool d_cloop;
@@ -203,6 +270,8 @@ private:
     bool d_dump_mat;
     bool d_acc_carrier_phase_initialized;
     bool d_enable_extended_integration;
+    bool d_extend_over_bits = false;
+    bool d_bit_prediction_valid = false;
     bool d_Flag_PLL_180_deg_phase_locked;
 };
 
@@ -28,6 +28,7 @@
 #include "Galileo_E5a.h"
 #include "Galileo_E5b.h"
 #include "MATH_CONSTANTS.h"
+#include "arma_arena.h"
 #include "beidou_b1i_signal_replica.h"
 #include "beidou_b3i_signal_replica.h"
 #include "galileo_e1_signal_replica.h"
@@ -110,6 +111,7 @@ kf_tracking::kf_tracking(const Kf_Conf &conf_)
       d_rem_code_phase_chips(0.0),
       d_rem_code_phase_samples(0.0),
       d_beta(0.0),
+      d_steady_cn0_ref_dbhz(0.0),
       d_sample_counter(0ULL),
       d_acq_sample_stamp(0ULL),
       d_rem_carr_phase_rad(0.0),
@@ -122,6 +124,7 @@ kf_tracking::kf_tracking(const Kf_Conf &conf_)
       d_cn0_estimation_counter(0),
       d_carrier_lock_fail_counter(0),
       d_code_lock_fail_counter(0),
+      d_steady_gain_count(0),
       d_pull_in_transitory(true),
       d_corrected_doppler(false),
       d_interchange_iq(false),
@@ -129,7 +132,8 @@ kf_tracking::kf_tracking(const Kf_Conf &conf_)
       d_cloop(true),
       d_dump(d_trk_parameters.dump),
       d_dump_mat(d_trk_parameters.dump_mat && d_dump),
-      d_acc_carrier_phase_initialized(false)
+      d_acc_carrier_phase_initialized(false),
+      d_steady_state_gain(false)
 {
 #if GNURADIO_GREATER_THAN_38
     this->set_relative_rate(1, static_cast<uint64_t>(d_trk_parameters.vector_length));
@@ -890,6 +894,11 @@ void kf_tracking::init_kf(double acq_code_phase_chips, double acq_doppler_hz)
     // states: code_phase_chips, carrier_phase_rads, carrier_freq_hz, carrier_freq_rate_hz_s
     d_x_old_old = {acq_code_phase_chips, 0.0, acq_doppler_hz, 0.0};
 
+    // restart gain convergence tracking on every (re)initialization
+    d_steady_state_gain = false;
+    d_steady_gain_count = 0;
+    d_K_prev.reset();
+
     DLOG(INFO) << "F: " << d_F;
     DLOG(INFO) << "H: " << d_H;
     DLOG(INFO) << "R: " << d_R;
@@ -956,6 +965,14 @@ void kf_tracking::update_kf_cn0(double current_cn0_dbhz)
 
     d_R = {{Sigma2_Tau, 0.0},
         {0.0, Sigma2_Phase}};
+
+    // a C/N0 regime change invalidates the frozen gain: return to the full
+    // covariance update until the gain converges again
+    if (d_steady_state_gain and (std::fabs(current_cn0_dbhz - d_steady_cn0_ref_dbhz) > 1.0))
+        {
+            d_steady_state_gain = false;
+            d_steady_gain_count = 0;
+        }
 }
 
 
@@ -1156,18 +1173,67 @@ void kf_tracking::run_Kf()
 
     //  Kalman loop
 
-    // Prediction
-    d_x_new_old = d_F * d_x_old_old;
+    if (d_steady_state_gain)
+        {
+            // Constant-gain (alpha-beta-gamma style) update with the converged
+            // Kalman gain: no covariance propagation, no matrix inverse, and
+            // no Armadillo temporaries (all products are unrolled in place)
+            const double z_code = d_code_error_disc_chips;
+            const double z_carr = d_carr_phase_error_disc_hz * TWO_PI;
+            for (arma::uword r = 0; r < 4; r++)
+                {
+                    double acc = 0.0;
+                    for (arma::uword c = 0; c < 4; c++)
+                        {
+                            acc += d_F.at(r, c) * d_x_old_old.at(c);
+                        }
+                    d_x_new_old.at(r) = acc;
+                    d_x_new_new.at(r) = acc + d_K_steady.at(r, 0) * z_code + d_K_steady.at(r, 1) * z_carr;
+                }
+        }
+    else
+        {
+            // Prediction
+            d_x_new_old = d_F * d_x_old_old;
 
-    d_P_new_old = d_F * d_P_old_old * d_F.t() + d_Q;
+            d_P_new_old = d_F * d_P_old_old * d_F.t() + d_Q;
 
-    // Measurement update
-    arma::vec z = {d_code_error_disc_chips, d_carr_phase_error_disc_hz * TWO_PI};
-    arma::mat K = d_P_new_old * d_H.t() * arma::inv(d_H * d_P_new_old * d_H.t() + d_R);  // Kalman gain
+            // Measurement update (working objects drawn from the thread arena)
+            Arma_Arena_Scope arena;
+            arma::vec z = arena.vec(2);
+            z.at(0) = d_code_error_disc_chips;
+            z.at(1) = d_carr_phase_error_disc_hz * TWO_PI;
+            arma::mat K = arena.mat(4, 2);
+            K = d_P_new_old * d_H.t() * arma::inv(d_H * d_P_new_old * d_H.t() + d_R);  // Kalman gain
 
-    d_x_new_new = d_x_new_old + K * z;
+            d_x_new_new = d_x_new_old + K * z;
 
-    d_P_new_new = (arma::eye(4, 4) - K * d_H) * d_P_new_old;
+            d_P_new_new = (arma::eye(4, 4) - K * d_H) * d_P_new_old;
+
+            if (d_trk_parameters.use_steady_state_gain)
+                {
+                    // For stationary noise settings the gain converges within
+                    // seconds; once it stops moving, freeze it and switch to the
+                    // constant-gain update until the C/N0 regime changes
+                    if ((d_K_prev.n_elem == K.n_elem) && (arma::abs(K - d_K_prev).max() < 1e-3 * arma::abs(K).max()))
+                        {
+                            d_steady_gain_count++;
+                            if (d_steady_gain_count >= 100)
+                                {
+                                    d_K_steady = K;
+                                    d_steady_cn0_ref_dbhz = d_CN0_SNV_dB_Hz;
+                                    d_steady_state_gain = true;
+                                    DLOG(INFO) << "Kalman gain converged in channel " << d_channel
+                                               << ": switching to constant-gain update";
+                                }
+                        }
+                    else
+                        {
+                            d_steady_gain_count = 0;
+                        }
+                    d_K_prev = K;
+                }
+        }
 
     // new code phase estimation
     d_code_error_kf_chips = d_x_new_new(0);
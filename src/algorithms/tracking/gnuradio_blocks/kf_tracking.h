@@ -129,6 +129,10 @@ private:
     arma::vec d_x_new_old;
     arma::vec d_x_new_new;
 
+    // steady-state (constant gain) mode
+    arma::mat d_K_steady;
+    arma::mat d_K_prev;
+
     std::string d_secondary_code_string;
     std::string d_data_secondary_code_string;
     std::string d_systemName;
@@ -196,6 +200,7 @@ private:
     double d_rem_code_phase_samples;
 
     double d_beta;
+    double d_steady_cn0_ref_dbhz;
 
     uint64_t d_sample_counter;
     uint64_t d_acq_sample_stamp;
@@ -220,6 +225,7 @@ private:
     int32_t d_code_lock_fail_counter;
     int32_t d_code_samples_per_chip;  // All signals have 1 sample per chip code except Gal. E1 which has 2 (CBOC disabled) or 12 (CBOC enabled)
     int32_t d_code_length_chips;
+    int32_t d_steady_gain_count;
 
     bool d_pull_in_transitory;
     bool d_corrected_doppler;
@@ -231,6 +237,7 @@ private:
     bool d_dump_mat;
     bool d_acc_carrier_phase_initialized;
     bool d_enable_extended_integration;
+    bool d_steady_state_gain;
 };
 
 #endif  // GNSS_SDR_KF_TRACKING_H
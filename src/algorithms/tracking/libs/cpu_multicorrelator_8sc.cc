@@ -0,0 +1,124 @@
+/*!
+ * \file cpu_multicorrelator_8sc.cc
+ * \brief Highly optimized CPU vector multiTAP correlator class for lv_8sc_t (char complex)
+ *
+ * Class that implements a highly optimized vector multiTAP correlator class for CPUs
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "cpu_multicorrelator_8sc.h"
+#include <cmath>
+#include <cstdlib>
+
+
+bool Cpu_Multicorrelator_8sc::init(
+    int max_signal_length_samples,
+    int n_correlators)
+{
+    // ALLOCATE MEMORY FOR INTERNAL vectors
+    size_t size = max_signal_length_samples * sizeof(lv_8sc_t);
+
+    d_n_correlators = n_correlators;
+
+    d_local_codes_resampled = static_cast<lv_8sc_t**>(volk_gnsssdr_malloc(n_correlators * sizeof(lv_8sc_t*), volk_gnsssdr_get_alignment()));
+    for (int n = 0; n < n_correlators; n++)
+        {
+            d_local_codes_resampled[n] = static_cast<lv_8sc_t*>(volk_gnsssdr_malloc(size, volk_gnsssdr_get_alignment()));
+        }
+    return true;
+}
+
+
+bool Cpu_Multicorrelator_8sc::set_local_code_and_taps(
+    int code_length_chips,
+    const lv_8sc_t* local_code_in,
+    float* shifts_chips)
+{
+    d_local_code_in = local_code_in;
+    d_shifts_chips = shifts_chips;
+    d_code_length_chips = code_length_chips;
+    return true;
+}
+
+
+bool Cpu_Multicorrelator_8sc::set_input_output_vectors(lv_16sc_t* corr_out, const lv_8sc_t* sig_in)
+{
+    // Save CPU pointers
+    d_sig_in = sig_in;
+    d_corr_out = corr_out;
+    return true;
+}
+
+
+void Cpu_Multicorrelator_8sc::update_local_code(int correlator_length_samples, float rem_code_phase_chips, float code_phase_step_chips)
+{
+    // There is no 8ic xn-resampler kernel yet; the index arithmetic below is
+    // the same as in volk_gnsssdr_16ic_xn_resampler_16ic_xn_generic
+    int local_code_chip_index;
+    for (int current_correlator_tap = 0; current_correlator_tap < d_n_correlators; current_correlator_tap++)
+        {
+            for (int n = 0; n < correlator_length_samples; n++)
+                {
+                    // resample code for current tap
+                    local_code_chip_index = static_cast<int>(std::floor(code_phase_step_chips * static_cast<float>(n) + d_shifts_chips[current_correlator_tap] - rem_code_phase_chips));
+                    // Take into account that in multitap correlators, the shifts can be negative!
+                    if (local_code_chip_index < 0)
+                        {
+                            local_code_chip_index += d_code_length_chips * (std::abs(local_code_chip_index) / d_code_length_chips + 1);
+                        }
+                    local_code_chip_index = local_code_chip_index % d_code_length_chips;
+                    d_local_codes_resampled[current_correlator_tap][n] = d_local_code_in[local_code_chip_index];
+                }
+        }
+}
+
+
+bool Cpu_Multicorrelator_8sc::Carrier_wipeoff_multicorrelator_resampler(
+    float rem_carrier_phase_in_rad,
+    float phase_step_rad,
+    float rem_code_phase_chips,
+    float code_phase_step_chips,
+    int signal_length_samples)
+{
+    update_local_code(signal_length_samples, rem_code_phase_chips, code_phase_step_chips);
+    // Regenerate phase at each call in order to avoid numerical issues
+    lv_32fc_t phase_offset_as_complex[1];
+    phase_offset_as_complex[0] = lv_cmake(std::cos(rem_carrier_phase_in_rad), -std::sin(rem_carrier_phase_in_rad));
+    // call VOLK_GNSSSDR kernel
+    volk_gnsssdr_8ic_x2_rotator_dot_prod_16ic_xn(d_corr_out, d_sig_in, std::exp(lv_32fc_t(0, -phase_step_rad)), phase_offset_as_complex, const_cast<const lv_8sc_t**>(d_local_codes_resampled), d_n_correlators, signal_length_samples);
+    return true;
+}
+
+
+Cpu_Multicorrelator_8sc::~Cpu_Multicorrelator_8sc()
+{
+    if (d_local_codes_resampled != nullptr)
+        {
+            Cpu_Multicorrelator_8sc::free();
+        }
+}
+
+
+bool Cpu_Multicorrelator_8sc::free()
+{
+    // Free memory
+    if (d_local_codes_resampled != nullptr)
+        {
+            for (int n = 0; n < d_n_correlators; n++)
+                {
+                    volk_gnsssdr_free(d_local_codes_resampled[n]);
+                }
+            volk_gnsssdr_free(d_local_codes_resampled);
+            d_local_codes_resampled = nullptr;
+        }
+    return true;
+}
@@ -20,6 +20,7 @@
  */
 
 #include "cpu_multicorrelator_real_codes.h"
+#include <volk/volk.h>
 #include <volk_gnsssdr/volk_gnsssdr.h>
 #include <cmath>
 
@@ -38,14 +39,20 @@ bool Cpu_Multicorrelator_Real_Codes::init(
     int n_correlators)
 {
     // ALLOCATE MEMORY FOR INTERNAL vectors
-    size_t size = max_signal_length_samples * sizeof(float);
+    const size_t alignment = volk_gnsssdr_get_alignment();
 
-    d_local_codes_resampled = static_cast<float**>(volk_gnsssdr_malloc(n_correlators * sizeof(float*), volk_gnsssdr_get_alignment()));
+    // single hugepage-backed buffer holding one aligned row per correlator
+    const size_t stride = ((max_signal_length_samples * sizeof(float) + alignment - 1) / alignment) * alignment / sizeof(float);
+    d_local_codes_buffer.resize(stride * n_correlators);
+    d_local_codes_resampled = static_cast<float**>(volk_gnsssdr_malloc(n_correlators * sizeof(float*), alignment));
     for (int n = 0; n < n_correlators; n++)
         {
-            d_local_codes_resampled[n] = static_cast<float*>(volk_gnsssdr_malloc(size, volk_gnsssdr_get_alignment()));
+            d_local_codes_resampled[n] = d_local_codes_buffer.data() + n * stride;
         }
+    d_wiped_input = static_cast<std::complex<float>*>(volk_gnsssdr_malloc(max_signal_length_samples * sizeof(std::complex<float>), volk_gnsssdr_get_alignment()));
     d_n_correlators = n_correlators;
+    d_first_active = 0;
+    d_n_active = n_correlators;
     return true;
 }
 
@@ -58,11 +65,40 @@ bool Cpu_Multicorrelator_Real_Codes::set_local_code_and_taps(
     d_local_code_in = local_code_in;
     d_shifts_chips = shifts_chips;
     d_code_length_chips = code_length_chips;
+    d_resampled_codes_valid = false;
+#if ENABLE_OPENCL_RESAMPLER
+    if (d_opencl_resampler)
+        {
+            d_opencl_resampler->set_local_code(local_code_in, code_length_chips);
+        }
+#endif
 
     return true;
 }
 
 
+bool Cpu_Multicorrelator_Real_Codes::set_cboc_local_code_and_taps(
+    int code_length_samples,
+    const float* boc11_in,
+    const float* boc61_in,
+    float alpha,
+    float beta,
+    float* shifts_chips)
+{
+    // The CBOC matched filter is linear in its subcarrier components:
+    // R_cboc = alpha * R_boc11 + beta * R_boc61. Folding the weights into a
+    // single table once per satellite assignment keeps every epoch at one
+    // resampling pass and one dot product per tap, instead of correlating
+    // each component separately and combining the outputs
+    d_cboc_combined_code.resize(code_length_samples);
+    for (int i = 0; i < code_length_samples; i++)
+        {
+            d_cboc_combined_code[i] = alpha * boc11_in[i] + beta * boc61_in[i];
+        }
+    return set_local_code_and_taps(code_length_samples, d_cboc_combined_code.data(), shifts_chips);
+}
+
+
 bool Cpu_Multicorrelator_Real_Codes::set_input_output_vectors(std::complex<float>* corr_out, const std::complex<float>* sig_in)
 {
     // Save CPU pointers
@@ -72,32 +108,154 @@ bool Cpu_Multicorrelator_Real_Codes::set_input_output_vectors(std::complex<float
 }
 
 
+bool Cpu_Multicorrelator_Real_Codes::set_active_correlator_window(int first_correlator, int n_correlators)
+{
+    if ((first_correlator < 0) || (n_correlators < 1) || (first_correlator + n_correlators > d_n_correlators))
+        {
+            return false;
+        }
+    if ((first_correlator != d_first_active) || (n_correlators != d_n_active))
+        {
+            d_first_active = first_correlator;
+            d_n_active = n_correlators;
+            d_resampled_codes_valid = false;
+        }
+    return true;
+}
+
+
+bool Cpu_Multicorrelator_Real_Codes::cached_resample_still_valid(int correlator_length_samples, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips) const
+{
+    // In steady-state tracking the resampling parameters barely move between
+    // consecutive epochs. If the accumulated code-phase deviation over the
+    // whole integration stays below a small fraction of a chip, the resampled
+    // taps are sample-for-sample identical (or differ in a negligible number
+    // of boundary samples), so the previous epoch's codes can be reused
+    if (!d_resampled_codes_valid || (correlator_length_samples != d_cached_correlator_length_samples))
+        {
+            return false;
+        }
+    const auto samples = static_cast<float>(correlator_length_samples);
+    const float max_phase_deviation_chips = std::fabs(rem_code_phase_chips - d_cached_rem_code_phase_chips) +
+                                            samples * std::fabs(code_phase_step_chips - d_cached_code_phase_step_chips) +
+                                            0.5F * samples * samples * std::fabs(code_phase_rate_step_chips - d_cached_code_phase_rate_step_chips);
+    return max_phase_deviation_chips < 0.001F;
+}
+
+
 void Cpu_Multicorrelator_Real_Codes::update_local_code(int correlator_length_samples, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips)
 {
+    if (cached_resample_still_valid(correlator_length_samples, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips))
+        {
+            return;
+        }
     if (d_use_high_dynamics_resampler)
         {
-            volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn(d_local_codes_resampled,
+            volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn(d_local_codes_resampled + d_first_active,
                 d_local_code_in,
                 rem_code_phase_chips,
                 code_phase_step_chips,
                 code_phase_rate_step_chips,
-                d_shifts_chips,
+                d_shifts_chips + d_first_active,
                 d_code_length_chips,
-                d_n_correlators,
+                d_n_active,
                 correlator_length_samples);
         }
     else
         {
-            volk_gnsssdr_32f_xn_resampler_32f_xn(d_local_codes_resampled,
+            volk_gnsssdr_32f_xn_resampler_32f_xn(d_local_codes_resampled + d_first_active,
                 d_local_code_in,
                 rem_code_phase_chips,
                 code_phase_step_chips,
-                d_shifts_chips,
+                d_shifts_chips + d_first_active,
                 d_code_length_chips,
-                d_n_correlators,
+                d_n_active,
                 correlator_length_samples);
         }
+    d_cached_rem_code_phase_chips = rem_code_phase_chips;
+    d_cached_code_phase_step_chips = code_phase_step_chips;
+    d_cached_code_phase_rate_step_chips = code_phase_rate_step_chips;
+    d_cached_correlator_length_samples = correlator_length_samples;
+    d_resampled_codes_valid = true;
+}
+
+
+bool Cpu_Multicorrelator_Real_Codes::enable_opencl_resampler(int max_signal_length_samples)
+{
+#if ENABLE_OPENCL_RESAMPLER
+    auto resampler = std::make_unique<Opencl_Code_Resampler>();
+    if (!resampler->init(max_signal_length_samples, d_n_correlators))
+        {
+            return false;
+        }
+    d_opencl_resampler = std::move(resampler);
+    if (d_local_code_in != nullptr)
+        {
+            d_opencl_resampler->set_local_code(d_local_code_in, d_code_length_chips);
+        }
+    return true;
+#else
+    (void)max_signal_length_samples;
+    return false;
+#endif
+}
+
+
+#if ENABLE_OPENCL_RESAMPLER
+bool Cpu_Multicorrelator_Real_Codes::carrier_wipeoff_multicorrelator_resampler_opencl(
+    float rem_carrier_phase_in_rad,
+    float phase_step_rad,
+    float phase_rate_step_rad,
+    float rem_code_phase_chips,
+    float code_phase_step_chips,
+    float code_phase_rate_step_chips,
+    int signal_length_samples)
+{
+    // Launch the replica generation on the device, then do the carrier
+    // wipe-off on the CPU while the device works, so the two halves of the
+    // epoch overlap instead of running back to back
+    bool device_resampling = false;
+    if (!cached_resample_still_valid(signal_length_samples, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips))
+        {
+            device_resampling = d_opencl_resampler->enqueue(rem_code_phase_chips,
+                code_phase_step_chips,
+                code_phase_rate_step_chips,
+                d_shifts_chips + d_first_active,
+                d_local_codes_resampled + d_first_active,
+                d_n_active,
+                signal_length_samples);
+            if (!device_resampling)
+                {
+                    // device refused the batch: resample on the CPU instead
+                    update_local_code(signal_length_samples, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips);
+                }
+        }
+    d_carrier_nco.generate_conjugate_carrier(d_wiped_input, signal_length_samples, rem_carrier_phase_in_rad, phase_step_rad, phase_rate_step_rad);
+    volk_32fc_x2_multiply_32fc(reinterpret_cast<lv_32fc_t*>(d_wiped_input), reinterpret_cast<const lv_32fc_t*>(d_sig_in), reinterpret_cast<lv_32fc_t*>(d_wiped_input), signal_length_samples);
+    if (device_resampling)
+        {
+            if (d_opencl_resampler->gather())
+                {
+                    d_cached_rem_code_phase_chips = rem_code_phase_chips;
+                    d_cached_code_phase_step_chips = code_phase_step_chips;
+                    d_cached_code_phase_rate_step_chips = code_phase_rate_step_chips;
+                    d_cached_correlator_length_samples = signal_length_samples;
+                    d_resampled_codes_valid = true;
+                }
+            else
+                {
+                    // the read-back failed, the rows may be stale or torn
+                    d_resampled_codes_valid = false;
+                    update_local_code(signal_length_samples, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips);
+                }
+        }
+    for (int n = d_first_active; n < d_first_active + d_n_active; n++)
+        {
+            volk_32fc_32f_dot_prod_32fc(reinterpret_cast<lv_32fc_t*>(&d_corr_out[n]), reinterpret_cast<const lv_32fc_t*>(d_wiped_input), d_local_codes_resampled[n], signal_length_samples);
+        }
+    return true;
 }
+#endif
 
 
 bool Cpu_Multicorrelator_Real_Codes::Carrier_wipeoff_multicorrelator_resampler(
@@ -109,18 +267,27 @@ bool Cpu_Multicorrelator_Real_Codes::Carrier_wipeoff_multicorrelator_resampler(
     float code_phase_rate_step_chips,
     int signal_length_samples)
 {
-    update_local_code(signal_length_samples, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips);
+#if ENABLE_OPENCL_RESAMPLER
+    if (d_opencl_resampler && d_opencl_resampler->ready())
+        {
+            return carrier_wipeoff_multicorrelator_resampler_opencl(rem_carrier_phase_in_rad, phase_step_rad, phase_rate_step_rad, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips, signal_length_samples);
+        }
+#endif
     // Regenerate phase at each call in order to avoid numerical issues
     lv_32fc_t phase_offset_as_complex[1];
     phase_offset_as_complex[0] = lv_cmake(std::cos(rem_carrier_phase_in_rad), -std::sin(rem_carrier_phase_in_rad));
     // call VOLK_GNSSSDR kernel
     if (d_use_high_dynamics_resampler)
         {
-            volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn(d_corr_out, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), std::exp(lv_32fc_t(0.0, -phase_rate_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators, signal_length_samples);
+            update_local_code(signal_length_samples, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips);
+            volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn(d_corr_out + d_first_active, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), std::exp(lv_32fc_t(0.0, -phase_rate_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled + d_first_active), d_n_active, signal_length_samples);
         }
     else
         {
-            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(d_corr_out, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators, signal_length_samples);
+            // Fused kernel: the code replicas are resampled on the fly inside the
+            // dot product loop, so the sample block is streamed through memory
+            // only once instead of resampling into temporary buffers first
+            volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn(d_corr_out + d_first_active, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), phase_offset_as_complex, d_local_code_in, rem_code_phase_chips, code_phase_step_chips, d_shifts_chips + d_first_active, d_code_length_chips, d_n_active, signal_length_samples);
         }
     return true;
 }
@@ -134,12 +301,66 @@ bool Cpu_Multicorrelator_Real_Codes::Carrier_wipeoff_multicorrelator_resampler(
     float code_phase_rate_step_chips,
     int signal_length_samples)
 {
-    update_local_code(signal_length_samples, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips);
+#if ENABLE_OPENCL_RESAMPLER
+    if (d_opencl_resampler && d_opencl_resampler->ready())
+        {
+            return carrier_wipeoff_multicorrelator_resampler_opencl(rem_carrier_phase_in_rad, phase_step_rad, 0.0F, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips, signal_length_samples);
+        }
+#endif
     // Regenerate phase at each call in order to avoid numerical issues
     lv_32fc_t phase_offset_as_complex[1];
     phase_offset_as_complex[0] = lv_cmake(std::cos(rem_carrier_phase_in_rad), -std::sin(rem_carrier_phase_in_rad));
     // call VOLK_GNSSSDR kernel
-    volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(d_corr_out, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators, signal_length_samples);
+    // Fused kernel: the code replicas are resampled on the fly inside the
+    // dot product loop, so the sample block is streamed through memory
+    // only once instead of resampling into temporary buffers first
+    volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn(d_corr_out + d_first_active, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), phase_offset_as_complex, d_local_code_in, rem_code_phase_chips, code_phase_step_chips, d_shifts_chips + d_first_active, d_code_length_chips, d_n_active, signal_length_samples);
+    return true;
+}
+
+
+bool Cpu_Multicorrelator_Real_Codes::Carrier_wipeoff_multicorrelator_resampler_lut_nco(
+    float rem_carrier_phase_in_rad,
+    float phase_step_rad,
+    float phase_rate_step_rad,
+    float rem_code_phase_chips,
+    float code_phase_step_chips,
+    float code_phase_rate_step_chips,
+    int signal_length_samples)
+{
+#if ENABLE_OPENCL_RESAMPLER
+    if (d_opencl_resampler && d_opencl_resampler->ready())
+        {
+            return carrier_wipeoff_multicorrelator_resampler_opencl(rem_carrier_phase_in_rad, phase_step_rad, phase_rate_step_rad, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips, signal_length_samples);
+        }
+#endif
+    update_local_code(signal_length_samples, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips);
+    // Generate the conjugate carrier with the fixed-point NCO and wipe it off
+    // in place, then reduce against the resampled codes with plain dot
+    // products: no per-sample dependent complex multiplication chain remains
+    d_carrier_nco.generate_conjugate_carrier(d_wiped_input, signal_length_samples, rem_carrier_phase_in_rad, phase_step_rad, phase_rate_step_rad);
+    volk_32fc_x2_multiply_32fc(reinterpret_cast<lv_32fc_t*>(d_wiped_input), reinterpret_cast<const lv_32fc_t*>(d_sig_in), reinterpret_cast<lv_32fc_t*>(d_wiped_input), signal_length_samples);
+    for (int n = d_first_active; n < d_first_active + d_n_active; n++)
+        {
+            volk_32fc_32f_dot_prod_32fc(reinterpret_cast<lv_32fc_t*>(&d_corr_out[n]), reinterpret_cast<const lv_32fc_t*>(d_wiped_input), d_local_codes_resampled[n], signal_length_samples);
+        }
+    return true;
+}
+
+
+bool Cpu_Multicorrelator_Real_Codes::Multicorrelator_resampler(
+    float rem_code_phase_chips,
+    float code_phase_step_chips,
+    float code_phase_rate_step_chips,
+    int signal_length_samples)
+{
+    // The input samples are already carrier-free, so the rotator pass is
+    // skipped and only the code resampling and the dot products remain
+    update_local_code(signal_length_samples, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips);
+    for (int n = d_first_active; n < d_first_active + d_n_active; n++)
+        {
+            volk_32fc_32f_dot_prod_32fc(reinterpret_cast<lv_32fc_t*>(&d_corr_out[n]), reinterpret_cast<const lv_32fc_t*>(d_sig_in), d_local_codes_resampled[n], signal_length_samples);
+        }
     return true;
 }
 
@@ -149,12 +370,15 @@ bool Cpu_Multicorrelator_Real_Codes::free()
     // Free memory
     if (d_local_codes_resampled != nullptr)
         {
-            for (int n = 0; n < d_n_correlators; n++)
-                {
-                    volk_gnsssdr_free(d_local_codes_resampled[n]);
-                }
             volk_gnsssdr_free(d_local_codes_resampled);
             d_local_codes_resampled = nullptr;
+            d_local_codes_buffer = volk_gnsssdr::hugepage_vector<float>();
+            d_resampled_codes_valid = false;
+        }
+    if (d_wiped_input != nullptr)
+        {
+            volk_gnsssdr_free(d_wiped_input);
+            d_wiped_input = nullptr;
         }
     return true;
 }
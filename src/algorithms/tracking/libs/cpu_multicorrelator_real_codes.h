@@ -23,7 +23,13 @@
 #define GNSS_SDR_CPU_MULTICORRELATOR_REAL_CODES_H
 
 
+#include "fixed_point_nco.h"
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
 #include <complex>
+#if ENABLE_OPENCL_RESAMPLER
+#include "opencl_code_resampler.h"
+#include <memory>
+#endif
 
 /** \addtogroup Tracking
  * \{ */
@@ -42,22 +48,65 @@ public:
     ~Cpu_Multicorrelator_Real_Codes();
     bool init(int max_signal_length_samples, int n_correlators);
     bool set_local_code_and_taps(int code_length_chips, const float *local_code_in, float *shifts_chips);
+    //! Loads a CBOC local code given as its two subcarrier components (each
+    //! a +/-1 sequence sampled at the same rate). The components are combined
+    //! analytically into a single weighted replica table, so the matched CBOC
+    //! correlation keeps costing one resampling pass and one dot product per
+    //! tap instead of one per component
+    bool set_cboc_local_code_and_taps(int code_length_samples, const float *boc11_in, const float *boc61_in, float alpha, float beta, float *shifts_chips);
     bool set_input_output_vectors(std::complex<float> *corr_out, const std::complex<float> *sig_in);
+    //! Restricts resampling and correlation to n_correlators taps starting at first_correlator
+    bool set_active_correlator_window(int first_correlator, int n_correlators);
     void update_local_code(int correlator_length_samples, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips = 0.0);
     bool Carrier_wipeoff_multicorrelator_resampler(float rem_carrier_phase_in_rad, float phase_step_rad, float phase_rate_step_rad, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, int signal_length_samples);
     bool Carrier_wipeoff_multicorrelator_resampler(float rem_carrier_phase_in_rad, float phase_step_rad, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, int signal_length_samples);
+    //! Same correlation but with the carrier generated by a fixed-point LUT NCO instead of the float rotator
+    bool Carrier_wipeoff_multicorrelator_resampler_lut_nco(float rem_carrier_phase_in_rad, float phase_step_rad, float phase_rate_step_rad, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, int signal_length_samples);
+    //! Correlates the local codes against an input that is already carrier-free
+    //! (e.g. the wiped samples of another correlator driven by the same carrier
+    //! NCO parameters), so only the code dot products are computed
+    bool Multicorrelator_resampler(float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, int signal_length_samples);
+    //! Carrier-wiped input samples materialized by the last
+    //! Carrier_wipeoff_multicorrelator_resampler_lut_nco() call
+    const std::complex<float> *wiped_input() const { return d_wiped_input; }
+    //! Offloads the code replica resampling to an OpenCL device (typically an
+    //! otherwise idle integrated GPU), overlapping it with the CPU carrier
+    //! wipe-off of the same epoch. Call after init(). Returns false (and the
+    //! CPU resampler stays in use) when no device is available or OpenCL
+    //! support was not compiled in
+    bool enable_opencl_resampler(int max_signal_length_samples);
     bool free();
 
 private:
+    bool cached_resample_still_valid(int correlator_length_samples, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips) const;
+#if ENABLE_OPENCL_RESAMPLER
+    bool carrier_wipeoff_multicorrelator_resampler_opencl(float rem_carrier_phase_in_rad, float phase_step_rad, float phase_rate_step_rad, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, int signal_length_samples);
+    std::unique_ptr<Opencl_Code_Resampler> d_opencl_resampler;
+#endif
     // Allocate the device input vectors
     const std::complex<float> *d_sig_in{nullptr};
     const float *d_local_code_in{nullptr};
     std::complex<float> *d_corr_out{nullptr};
+    std::complex<float> *d_wiped_input{nullptr};
+    // resampled code replicas, one aligned row per correlator, backed by
+    // huge pages to reduce TLB pressure when many channels run in parallel
+    volk_gnsssdr::hugepage_vector<float> d_local_codes_buffer;
+    // weighted combination of the CBOC subcarrier components, built once per
+    // satellite assignment by set_cboc_local_code_and_taps()
+    volk_gnsssdr::vector<float> d_cboc_combined_code;
     float **d_local_codes_resampled{nullptr};
+    Fixed_Point_NCO d_carrier_nco;
     float *d_shifts_chips{nullptr};
+    float d_cached_rem_code_phase_chips{0.0};
+    float d_cached_code_phase_step_chips{0.0};
+    float d_cached_code_phase_rate_step_chips{0.0};
+    int d_cached_correlator_length_samples{0};
     int d_code_length_chips{0};
     int d_n_correlators{0};
+    int d_first_active{0};
+    int d_n_active{0};
     bool d_use_high_dynamics_resampler{true};
+    bool d_resampled_codes_valid{false};
 };
 
 
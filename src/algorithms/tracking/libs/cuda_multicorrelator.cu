@@ -123,6 +123,79 @@ __global__ void Doppler_wippe_scalarProdGPUCPXxN_shifts_chips(
 }
 
 
+__global__ void Doppler_wippe_scalarProdGPU32fxN_shifts_chips_rate(
+    GPU_Complex *d_corr_out,
+    GPU_Complex *d_sig_in,
+    GPU_Complex *d_sig_wiped,
+    float *d_local_code_in,
+    float *d_shifts_chips,
+    int code_length_chips,
+    float code_phase_step_chips,
+    float code_phase_rate_step_chips,
+    float rem_code_phase_chips,
+    int vectorN,
+    int elementN,
+    float rem_carrier_phase_in_rad,
+    float phase_step_rad,
+    float phase_rate_step_rad)
+{
+    //Accumulators cache
+    __shared__ GPU_Complex accumResult[ACCUM_N];
+
+    // CUDA version of the high-dynamics NCO: quadratic carrier phase evolution
+    float sin;
+    float cos;
+    for (int i = blockIdx.x * blockDim.x + threadIdx.x;
+         i < elementN;
+         i += blockDim.x * gridDim.x)
+        {
+            float i_f = __int2float_rd(i);
+            __sincosf(rem_carrier_phase_in_rad + i_f * phase_step_rad + 0.5f * phase_rate_step_rad * i_f * i_f, &sin, &cos);
+            d_sig_wiped[i] = d_sig_in[i] * GPU_Complex(cos, -sin);
+        }
+
+    __syncthreads();
+
+    for (int vec = blockIdx.x; vec < vectorN; vec += gridDim.x)
+        {
+            for (int iAccum = threadIdx.x; iAccum < ACCUM_N; iAccum += blockDim.x)
+                {
+                    GPU_Complex sum = GPU_Complex(0, 0);
+                    float local_code_chip_index = 0.0;
+                    for (int pos = iAccum; pos < elementN; pos += ACCUM_N)
+                        {
+                            // resample the real-valued local code for the current shift,
+                            // with the code phase rate term used by the high-dynamics CPU resampler
+                            float pos_f = __int2float_rd(pos);
+                            local_code_chip_index = fmodf(code_phase_step_chips * pos_f + code_phase_rate_step_chips * pos_f * pos_f + d_shifts_chips[vec] - rem_code_phase_chips, code_length_chips);
+
+                            //Take into account that in multitap correlators, the shifts can be negative!
+                            if (local_code_chip_index < 0.0) local_code_chip_index += (code_length_chips - 1);
+                            float code_sample = d_local_code_in[__float2int_rd(local_code_chip_index)];
+                            sum.r = __fmaf_rn(d_sig_wiped[pos].r, code_sample, sum.r);
+                            sum.i = __fmaf_rn(d_sig_wiped[pos].i, code_sample, sum.i);
+                        }
+                    accumResult[iAccum] = sum;
+                }
+
+            for (int stride = ACCUM_N / 2; stride > 0; stride >>= 1)
+                {
+                    __syncthreads();
+
+                    for (int iAccum = threadIdx.x; iAccum < stride; iAccum += blockDim.x)
+                        {
+                            accumResult[iAccum] += accumResult[stride + iAccum];
+                        }
+                }
+
+            if (threadIdx.x == 0)
+                {
+                    d_corr_out[vec] = accumResult[0];
+                }
+        }
+}
+
+
 bool cuda_multicorrelator::init_cuda_integrated_resampler(
     int signal_length_samples,
     int code_length_chips,
@@ -208,7 +281,13 @@ bool cuda_multicorrelator::init_cuda_integrated_resampler(
     cudaMalloc((void **)&d_local_codes_in, sizeof(std::complex<float>) * code_length_chips);
     cudaMemset(d_local_codes_in, 0, sizeof(std::complex<float>) * code_length_chips);
 
+    // Real-valued local code GPU memory (asynchronous path)
+    cudaMalloc((void **)&d_local_code_real_in, sizeof(float) * code_length_chips);
+    cudaMemset(d_local_code_real_in, 0, sizeof(float) * code_length_chips);
+
     d_code_length_chips = code_length_chips;
+    d_signal_length_samples = signal_length_samples;
+    d_n_correlators = n_correlators;
 
     // Vector with the chip shifts for each correlator tap
     //GPU memory (can be mapped to CPU memory in shared memory devices!)
@@ -224,7 +303,9 @@ bool cuda_multicorrelator::init_cuda_integrated_resampler(
     threadsPerBlock = 64;
     blocksPerGrid = 128;  //(int)(signal_length_samples+threadsPerBlock-1)/threadsPerBlock;
 
-    cudaStreamCreate(&stream1);
+    // Non-blocking stream: epochs of different channels overlap on the device
+    // instead of serializing behind the legacy default stream
+    cudaStreamCreateWithFlags(&stream1, cudaStreamNonBlocking);
     //cudaStreamCreate (&stream2) ;
     return true;
 }
@@ -266,6 +347,25 @@ bool cuda_multicorrelator::set_local_code_and_taps(
 }
 
 
+bool cuda_multicorrelator::set_local_code_and_taps(
+    int code_length_chips,
+    const float *local_code_in,
+    float *shifts_chips,
+    int n_correlators)
+{
+    cudaSetDevice(selected_gps_device);
+    //real-valued local code CPU -> GPU copy memory
+    cudaMemcpyAsync(d_local_code_real_in, local_code_in, sizeof(float) * code_length_chips, cudaMemcpyHostToDevice, stream1);
+    d_code_length_chips = code_length_chips;
+
+    //Correlator shifts vector CPU -> GPU copy memory (fractional chip shifts are allowed!)
+    cudaMemcpyAsync(d_shifts_chips, shifts_chips, sizeof(float) * n_correlators,
+        cudaMemcpyHostToDevice, stream1);
+
+    return true;
+}
+
+
 bool cuda_multicorrelator::set_input_output_vectors(
     std::complex<float> *corr_out,
     std::complex<float> *sig_in)
@@ -275,9 +375,31 @@ bool cuda_multicorrelator::set_input_output_vectors(
     d_sig_in_cpu = sig_in;
     d_corr_out_cpu = corr_out;
 
+    // Pin the host buffers so the asynchronous copies do not fall back to
+    // staged (pageable) transfers. Buffers already allocated with
+    // cudaHostAlloc by the caller are left as they are.
+    cudaError_t code;
+    code = cudaHostRegister((void *)sig_in, d_signal_length_samples * sizeof(std::complex<float>), cudaHostRegisterMapped);
+    if (code == cudaSuccess)
+        {
+            d_sig_in_pinned = true;
+        }
+    else if (code != cudaErrorHostMemoryAlreadyRegistered)
+        {
+            printf("cuda cudaHostRegister error in set_input_output_vectors \r\n");
+        }
+    code = cudaHostRegister((void *)corr_out, d_n_correlators * sizeof(std::complex<float>), cudaHostRegisterMapped);
+    if (code == cudaSuccess)
+        {
+            d_corr_out_pinned = true;
+        }
+    else if (code != cudaErrorHostMemoryAlreadyRegistered)
+        {
+            printf("cuda cudaHostRegister error in set_input_output_vectors \r\n");
+        }
+
     // Zero Copy version
     // Get device pointer from host memory. No allocation or memcpy
-    cudaError_t code;
     code = cudaHostGetDevicePointer((void **)&d_sig_in, (void *)sig_in, 0);
     code = cudaHostGetDevicePointer((void **)&d_corr_out, (void *)corr_out, 0);
     if (code != cudaSuccess)
@@ -346,28 +468,84 @@ bool cuda_multicorrelator::Carrier_wipeoff_multicorrelator_resampler_cuda(
 }
 
 
+bool cuda_multicorrelator::Carrier_wipeoff_multicorrelator_resampler_cuda_async(
+    float rem_carrier_phase_in_rad,
+    float phase_step_rad,
+    float phase_rate_step_rad,
+    float rem_code_phase_chips,
+    float code_phase_step_chips,
+    float code_phase_rate_step_chips,
+    int signal_length_samples,
+    int n_correlators)
+{
+    cudaSetDevice(selected_gps_device);
+    // The host buffers are pinned and mapped (see set_input_output_vectors),
+    // so the kernel reads the input signal and writes the correlator outputs
+    // through the device pointers without an explicit staged copy. Nothing
+    // here blocks: the caller launches all its channels and then collects
+    // each one with wait_correlation()
+    Doppler_wippe_scalarProdGPU32fxN_shifts_chips_rate<<<blocksPerGrid, threadsPerBlock, 0, stream1>>>(
+        d_corr_out,
+        d_sig_in,
+        d_sig_doppler_wiped,
+        d_local_code_real_in,
+        d_shifts_chips,
+        d_code_length_chips,
+        code_phase_step_chips,
+        code_phase_rate_step_chips,
+        rem_code_phase_chips,
+        n_correlators,
+        signal_length_samples,
+        rem_carrier_phase_in_rad,
+        phase_step_rad,
+        phase_rate_step_rad);
+
+    gpuErrchk(cudaPeekAtLastError());
+    return true;
+}
+
+
+bool cuda_multicorrelator::wait_correlation()
+{
+    cudaSetDevice(selected_gps_device);
+    gpuErrchk(cudaStreamSynchronize(stream1));
+    return true;
+}
+
+
 cuda_multicorrelator::cuda_multicorrelator()
 {
     d_sig_in = NULL;
     d_nco_in = NULL;
     d_sig_doppler_wiped = NULL;
     d_local_codes_in = NULL;
+    d_local_code_real_in = NULL;
     d_shifts_samples = NULL;
     d_shifts_chips = NULL;
     d_corr_out = NULL;
+    d_sig_in_cpu = NULL;
+    d_corr_out_cpu = NULL;
     threadsPerBlock = 0;
     blocksPerGrid = 0;
     d_code_length_chips = 0;
+    d_signal_length_samples = 0;
+    d_n_correlators = 0;
+    d_sig_in_pinned = false;
+    d_corr_out_pinned = false;
 }
 
 
 bool cuda_multicorrelator::free_cuda()
 {
+    // Unpin the host buffers registered in set_input_output_vectors
+    if (d_sig_in_pinned) cudaHostUnregister(d_sig_in_cpu);
+    if (d_corr_out_pinned) cudaHostUnregister(d_corr_out_cpu);
     // Free device global memory
     if (d_sig_in != NULL) cudaFree(d_sig_in);
     if (d_nco_in != NULL) cudaFree(d_nco_in);
     if (d_sig_doppler_wiped != NULL) cudaFree(d_sig_doppler_wiped);
     if (d_local_codes_in != NULL) cudaFree(d_local_codes_in);
+    if (d_local_code_real_in != NULL) cudaFree(d_local_code_real_in);
     if (d_corr_out != NULL) cudaFree(d_corr_out);
     if (d_shifts_samples != NULL) cudaFree(d_shifts_samples);
     if (d_shifts_chips != NULL) cudaFree(d_shifts_chips);
@@ -107,6 +107,13 @@ struct GPU_Complex_Short
 
 /*!
  * \brief Class that implements carrier wipe-off and correlators using NVIDIA CUDA GPU accelerators.
+ *
+ * Each instance owns a non-blocking CUDA stream and page-locked (pinned) host
+ * staging for its input signal and correlator outputs, so transfers and kernels
+ * of different channels overlap on the device. The asynchronous entry point
+ * enqueues the whole epoch (H2D copy, carrier wipe-off, multitap correlation,
+ * D2H copy) without blocking; a thread driving several GPU channels can launch
+ * them all and then collect the results with wait_correlation().
  */
 class cuda_multicorrelator
 {
@@ -121,6 +128,12 @@ public:
         const std::complex<float>* local_codes_in,
         float* shifts_chips,
         int n_correlators);
+    //! Real-valued local code replica, as generated for the CPU multicorrelator
+    bool set_local_code_and_taps(
+        int code_length_chips,
+        const float* local_code_in,
+        float* shifts_chips,
+        int n_correlators);
     bool set_input_output_vectors(
         std::complex<float>* corr_out,
         std::complex<float>* sig_in);
@@ -133,6 +146,21 @@ public:
         float rem_code_phase_chips,
         int signal_length_samples,
         int n_correlators);
+    //! Enqueue a full correlation epoch on this channel's stream and return
+    //! immediately. Takes the carrier phase rate and code phase rate terms
+    //! computed by the tracking block for high-dynamics operation.
+    bool Carrier_wipeoff_multicorrelator_resampler_cuda_async(
+        float rem_carrier_phase_in_rad,
+        float phase_step_rad,
+        float phase_rate_step_rad,
+        float rem_code_phase_chips,
+        float code_phase_step_chips,
+        float code_phase_rate_step_chips,
+        int signal_length_samples,
+        int n_correlators);
+    //! Block until the epoch enqueued by the asynchronous entry point is done
+    //! and the correlator outputs are back in the host output vector
+    bool wait_correlation();
 
 private:
     cudaStream_t stream1;
@@ -145,12 +173,16 @@ private:
     GPU_Complex* d_local_codes_in;
     GPU_Complex* d_corr_out;
 
+    float* d_local_code_real_in;
+
     std::complex<float>* d_sig_in_cpu;
     std::complex<float>* d_corr_out_cpu;
 
     float* d_shifts_chips;
     int* d_shifts_samples;
     int d_code_length_chips;
+    int d_signal_length_samples;
+    int d_n_correlators;
 
     int selected_gps_device;
     int threadsPerBlock;
@@ -158,6 +190,9 @@ private:
 
     int num_gpu_devices;
     int selected_device;
+
+    bool d_sig_in_pinned;
+    bool d_corr_out_pinned;
 };
 
 
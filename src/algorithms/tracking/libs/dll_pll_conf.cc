@@ -46,9 +46,27 @@ void Dll_Pll_Conf::SetFromConfiguration(const ConfigurationInterface *configurat
     double fs_in_deprecated = configuration->property("GNSS-SDR.internal_fs_hz", fs_in);
     fs_in = configuration->property("GNSS-SDR.internal_fs_sps", fs_in_deprecated);
     high_dyn = configuration->property(role + ".high_dyn", high_dyn);
+    use_lut_carrier_nco = configuration->property(role + ".use_lut_carrier_nco", use_lut_carrier_nco);
+    use_opencl_resampler = configuration->property(role + ".use_opencl_resampler", use_opencl_resampler);
+    joint_data_pilot_corr = configuration->property(role + ".joint_data_pilot_corr", joint_data_pilot_corr);
+    cboc_enabled = configuration->property(role + ".cboc", cboc_enabled);
+    fp_carrier_phase = configuration->property(role + ".fp_carrier_phase", fp_carrier_phase);
     dump = configuration->property(role + ".dump", dump);
     dump_filename = configuration->property(role + ".dump_filename", dump_filename);
     dump_mat = configuration->property(role + ".dump_mat", dump_mat);
+    dump_perf = configuration->property(role + ".dump_perf", dump_perf);
+    lite_mode = configuration->property(role + ".lite_mode", lite_mode);
+    lite_input_scale = configuration->property(role + ".lite_input_scale", lite_input_scale);
+    if (lite_mode)
+        {
+            // the coarse-quality profile trades observability for throughput
+            if (dump)
+                {
+                    LOG(WARNING) << "Tracking dump is not supported in lite_mode, disabling it";
+                }
+            dump = false;
+            dump_mat = false;
+        }
     pll_bw_hz = configuration->property(role + ".pll_bw_hz", pll_bw_hz);
     if (FLAGS_pll_bw_hz != 0.0)
         {
@@ -104,13 +122,37 @@ void Dll_Pll_Conf::SetFromConfiguration(const ConfigurationInterface *configurat
     very_early_late_space_chips = configuration->property(role + ".very_early_late_space_chips", very_early_late_space_chips);
     very_early_late_space_narrow_chips = configuration->property(role + ".very_early_late_space_narrow_chips", very_early_late_space_narrow_chips);
     extend_correlation_symbols = configuration->property(role + ".extend_correlation_symbols", extend_correlation_symbols);
+    adaptive_integration = configuration->property(role + ".adaptive_integration", adaptive_integration);
+    adaptive_integration_cn0_up = configuration->property(role + ".adaptive_integration_cn0_up", adaptive_integration_cn0_up);
+    adaptive_integration_cn0_down = configuration->property(role + ".adaptive_integration_cn0_down", adaptive_integration_cn0_down);
+    if (adaptive_integration_cn0_down >= adaptive_integration_cn0_up)
+        {
+            LOG(WARNING) << "adaptive_integration_cn0_down must be below adaptive_integration_cn0_up. Disabling adaptive integration";
+            adaptive_integration = false;
+        }
+    correlation_group_size = configuration->property(role + ".correlation_group_size", correlation_group_size);
+    if (correlation_group_size < 1U)
+        {
+            correlation_group_size = 1U;
+        }
+    epochs_per_work = configuration->property(role + ".epochs_per_work", epochs_per_work);
+    if (epochs_per_work < 1)
+        {
+            epochs_per_work = 1;
+        }
     track_pilot = configuration->property(role + ".track_pilot", track_pilot);
     cn0_samples = configuration->property(role + ".cn0_samples", cn0_samples);
+    lock_detector_decimation = configuration->property(role + ".lock_detector_decimation", lock_detector_decimation);
+    if (lock_detector_decimation < 1)
+        {
+            lock_detector_decimation = 1;
+        }
     cn0_min = configuration->property(role + ".cn0_min", cn0_min);
     max_code_lock_fail = configuration->property(role + ".max_lock_fail", max_code_lock_fail);
     max_carrier_lock_fail = configuration->property(role + ".max_carrier_lock_fail", max_carrier_lock_fail);
     carrier_lock_th = configuration->property(role + ".carrier_lock_th", carrier_lock_th);
     carrier_aiding = configuration->property(role + ".carrier_aiding", carrier_aiding);
+    enable_vtl_assist = configuration->property(role + ".enable_vtl_assist", enable_vtl_assist);
 
     // tracking lock tests smoother parameters
     cn0_smoother_samples = configuration->property(role + ".cn0_smoother_samples", cn0_smoother_samples);
@@ -60,12 +60,25 @@ public:
     uint32_t bit_synchronization_time_limit_s{20U};
     uint32_t vector_length{0U};
     uint32_t smoother_length{10U};
+    uint32_t correlation_group_size{1U};
     int32_t fll_filter_order{1};
     int32_t pll_filter_order{3};
     int32_t dll_filter_order{2};
     int32_t extend_correlation_symbols{1};
+    // adapt the coherent integration length to the estimated C/N0, between
+    // one data bit and extend_correlation_symbols: strong channels stretch
+    // the integration (fewer loop updates per second), channels fading
+    // toward the lock threshold shorten it to keep the loops agile
+    bool adaptive_integration{false};
+    float adaptive_integration_cn0_up{42.0};
+    float adaptive_integration_cn0_down{32.0};
+    // number of consecutive integration periods correlated in a single
+    // work() call. Values > 1 reduce the GNU Radio scheduler overhead per
+    // channel, at the price of delivering the telemetry symbols in bursts
+    int32_t epochs_per_work{1};
     int32_t cn0_samples{0};
     int32_t cn0_smoother_samples{200};
+    int32_t lock_detector_decimation{1};
     int32_t carrier_lock_test_smoother_samples{25};
     int32_t cn0_min{0};
     int32_t max_code_lock_fail{0};
@@ -77,9 +90,42 @@ public:
     bool track_pilot{true};
     bool enable_doppler_correction{false};
     bool carrier_aiding{true};
+    // accept NCO commands predicted by the PVT block (pvt_to_trk message
+    // port), so the channel can coast through signal blockage. It requires
+    // PVT.enable_vtl_assist=true
+    bool enable_vtl_assist{false};
     bool high_dyn{false};
+    bool use_lut_carrier_nco{false};
+    // resample the code replicas on an OpenCL device (typically the idle
+    // integrated GPU) while the CPU performs the carrier wipe-off of the
+    // same epoch. Worthwhile for wideband codes (E5a/E5b/E6); requires a
+    // build with ENABLE_OPENCL, otherwise silently stays on the CPU
+    bool use_opencl_resampler{false};
+    // accumulate the carrier phase in a Q32.32 fixed-point register (cycles)
+    // with integer-only arithmetic, converting to radians only when an
+    // observable is emitted. Helps platforms where double-precision SIMD
+    // runs at half rate (e.g. Cortex-A53); one LSB is 2^-32 cycles
+    bool fp_carrier_phase{false};
+    // when tracking the pilot component, wipe the carrier off once and feed
+    // the same carrier-free samples to the pilot and data code dot products,
+    // instead of running a second full rotator pass for the data prompt. The
+    // shared pass generates the carrier with the fixed-point NCO
+    bool joint_data_pilot_corr{true};
+    // Galileo E1 only: track against the full CBOC(6,1,1/11) replica
+    // (12 samples per chip) instead of the sinboc(1,1) approximation. The
+    // correlator combines the two subcarrier components analytically, so the
+    // per-epoch cost stays that of a single code. Ignored by other signals,
+    // by lite_mode and by the FPGA implementation
+    bool cboc_enabled{false};
+    // "lite" coarse-quality profile for very high channel counts: 16-bit
+    // integer correlation and no dump support. Pair it with
+    // extend_correlation_symbols and lock_detector_decimation to also cut
+    // the loop update rate
+    bool lite_mode{false};
+    float lite_input_scale{4.0};
     bool dump{false};
     bool dump_mat{true};
+    bool dump_perf{false};
 };
 
 
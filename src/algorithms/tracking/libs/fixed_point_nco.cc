@@ -0,0 +1,98 @@
+/*!
+ * \file fixed_point_nco.cc
+ * \brief Fixed-point numerically controlled oscillator with quarter-wave LUT
+ * \author Javier Arribas, 2021. jarribas(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "fixed_point_nco.h"
+#include <cmath>
+
+namespace
+{
+constexpr double TWO_PI_NCO = 6.283185307179586476925286766559;
+constexpr double CYCLE_TO_UINT32 = 4294967296.0;  // 2^32 accumulator counts per carrier cycle
+
+inline uint32_t rad_to_phase_counts(double phase_rad)
+{
+    double cycles = phase_rad / TWO_PI_NCO;
+    cycles -= std::floor(cycles);
+    return static_cast<uint32_t>(std::lround(cycles * CYCLE_TO_UINT32));
+}
+}  // namespace
+
+
+Fixed_Point_NCO::Fixed_Point_NCO()
+{
+    // force table construction outside the tracking hot loop
+    quarter_wave_table();
+}
+
+
+const std::array<float, 1024>& Fixed_Point_NCO::quarter_wave_table()
+{
+    // sin((i + 0.5) * pi/2 / 1024): the half-sample offset makes
+    // cos(theta) = table[1023 - index] exact under the same indexing
+    static const std::array<float, 1024> table = []() {
+        std::array<float, 1024> t{};
+        for (size_t i = 0; i < t.size(); i++)
+            {
+                t[i] = static_cast<float>(std::sin((static_cast<double>(i) + 0.5) * (TWO_PI_NCO / 4.0) / 1024.0));
+            }
+        return t;
+    }();
+    return table;
+}
+
+
+void Fixed_Point_NCO::generate_conjugate_carrier(std::complex<float>* out,
+    int num_samples,
+    float start_phase_rad,
+    float phase_step_rad,
+    float phase_rate_step_rad)
+{
+    const std::array<float, 1024>& table = quarter_wave_table();
+    uint32_t accumulator = rad_to_phase_counts(start_phase_rad);
+    uint32_t step = rad_to_phase_counts(phase_step_rad);
+    const uint32_t rate = rad_to_phase_counts(phase_rate_step_rad);
+    for (int n = 0; n < num_samples; n++)
+        {
+            const uint32_t quadrant = accumulator >> 30U;
+            const uint32_t index = (accumulator >> 20U) & 0x3FFU;
+            const float a = table[index];
+            const float b = table[1023U - index];
+            float sin_phase;
+            float cos_phase;
+            switch (quadrant)
+                {
+                case 0U:
+                    sin_phase = a;
+                    cos_phase = b;
+                    break;
+                case 1U:
+                    sin_phase = b;
+                    cos_phase = -a;
+                    break;
+                case 2U:
+                    sin_phase = -a;
+                    cos_phase = -b;
+                    break;
+                default:
+                    sin_phase = -b;
+                    cos_phase = a;
+                    break;
+                }
+            out[n] = std::complex<float>(cos_phase, -sin_phase);
+            accumulator += step;
+            step += rate;
+        }
+}
@@ -0,0 +1,62 @@
+/*!
+ * \file fixed_point_nco.h
+ * \brief Fixed-point numerically controlled oscillator with quarter-wave LUT
+ * \author Javier Arribas, 2021. jarribas(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_FIXED_POINT_NCO_H
+#define GNSS_SDR_FIXED_POINT_NCO_H
+
+#include <array>
+#include <complex>
+#include <cstdint>
+
+/** \addtogroup Tracking
+ * \{ */
+/** \addtogroup Tracking_libs
+ * \{ */
+
+
+/*!
+ * \brief Carrier replica generator based on an integer phase accumulator and
+ * a 1024-entry quarter-wave sine table.
+ *
+ * The float rotator regenerates the carrier through a chain of dependent
+ * complex multiplications, which serializes the loop on in-order cores. Here
+ * the phase is a 32-bit unsigned accumulator (one full cycle = 2^32), so
+ * consecutive samples only depend on an integer addition, and sine/cosine are
+ * read from a shared quarter-wave table indexed by the top accumulator bits.
+ * Carrier phase resolution is 2*pi/4096 rad (10-bit table plus quadrant
+ * folding); the phase step quantization of 2*pi/2^32 rad per sample keeps the
+ * accumulated Doppler error negligible over a tracking integration.
+ */
+class Fixed_Point_NCO
+{
+public:
+    Fixed_Point_NCO();
+
+    //! Writes num_samples of exp(-j*phase(n)) with phase(n) = start + n*step (+ rate term)
+    void generate_conjugate_carrier(std::complex<float>* out,
+        int num_samples,
+        float start_phase_rad,
+        float phase_step_rad,
+        float phase_rate_step_rad = 0.0);
+
+private:
+    static const std::array<float, 1024>& quarter_wave_table();
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_FIXED_POINT_NCO_H
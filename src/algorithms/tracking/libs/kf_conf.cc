@@ -62,6 +62,7 @@ Kf_Conf::Kf_Conf() : item_type("gr_complex"),
                      track_pilot(true),
                      enable_doppler_correction(false),
                      high_dyn(false),
+                     use_steady_state_gain(false),
                      dump(false),
                      dump_mat(true)
 {
@@ -84,6 +85,7 @@ void Kf_Conf::SetFromConfiguration(const ConfigurationInterface *configuration,
     double fs_in_deprecated = configuration->property("GNSS-SDR.internal_fs_hz", fs_in);
     fs_in = configuration->property("GNSS-SDR.internal_fs_sps", fs_in_deprecated);
     high_dyn = configuration->property(role + ".high_dyn", high_dyn);
+    use_steady_state_gain = configuration->property(role + ".use_steady_state_gain", use_steady_state_gain);
     dump = configuration->property(role + ".dump", dump);
     dump_filename = configuration->property(role + ".dump_filename", dump_filename);
     dump_mat = configuration->property(role + ".dump_mat", dump_mat);
@@ -79,6 +79,7 @@ public:
     bool track_pilot;
     bool enable_doppler_correction;
     bool high_dyn;
+    bool use_steady_state_gain;
     bool dump;
     bool dump_mat;
 };
@@ -33,6 +33,7 @@
  */
 
 #include "lock_detectors.h"
+#include <volk/volk.h>
 #include <cmath>
 
 /*
@@ -122,6 +123,43 @@ float cn0_m2m4_estimator(const gr_complex* Prompt_buffer, int length, float coh_
 }
 
 
+/*
+ * VOLK-backed M2M4 estimator. The second and fourth moments are reduced with
+ * vector kernels over a caller-provided scratch buffer; the signal power term
+ * is only needed for the degenerate (negative radicand) case and is computed
+ * on demand, since VOLK has no absolute-value reduction.
+ */
+float cn0_m2m4_estimator(const gr_complex* Prompt_buffer, float* magnitude_sq_buffer, int length, float coh_integration_time_s)
+{
+    float SNR_aux = 0.0;
+    float m_2 = 0.0;
+    float m_4 = 0.0;
+    const auto n = static_cast<float>(length);
+    volk_32fc_magnitude_squared_32f(magnitude_sq_buffer, reinterpret_cast<const lv_32fc_t*>(Prompt_buffer), length);
+    volk_32f_accumulator_s32f(&m_2, magnitude_sq_buffer, length);
+    volk_32f_x2_dot_prod_32f(&m_4, magnitude_sq_buffer, magnitude_sq_buffer, length);
+    m_2 /= n;
+    m_4 /= n;
+    const float aux = std::sqrt(2.0F * m_2 * m_2 - m_4);
+    if (std::isnan(aux))
+        {
+            float Psig = 0.0;
+            for (int i = 0; i < length; i++)
+                {
+                    Psig += std::abs(Prompt_buffer[i].real());
+                }
+            Psig /= n;
+            Psig = Psig * Psig;
+            SNR_aux = Psig / (m_2 - Psig);
+        }
+    else
+        {
+            SNR_aux = aux / (m_2 - aux);
+        }
+    return 10.0F * std::log10(SNR_aux) - 10.0F * std::log10(coh_integration_time_s);
+}
+
+
 /*
  * The estimate of the cosine of twice the carrier phase error is given by
  * \f{equation}
@@ -146,3 +184,20 @@ float carrier_lock_detector(const gr_complex* Prompt_buffer, int length)
     NBD = tmp_sum_I * tmp_sum_I - tmp_sum_Q * tmp_sum_Q;
     return NBD / NBP;
 }
+
+
+/*
+ * VOLK-backed carrier lock detector: the I and Q sums are reduced with vector
+ * kernels over a caller-provided scratch buffer of 2 * length floats.
+ */
+float carrier_lock_detector(const gr_complex* Prompt_buffer, float* deinterleaved_iq_buffer, int length)
+{
+    float tmp_sum_I = 0.0;
+    float tmp_sum_Q = 0.0;
+    volk_32fc_deinterleave_32f_x2(deinterleaved_iq_buffer, deinterleaved_iq_buffer + length, reinterpret_cast<const lv_32fc_t*>(Prompt_buffer), length);
+    volk_32f_accumulator_s32f(&tmp_sum_I, deinterleaved_iq_buffer, length);
+    volk_32f_accumulator_s32f(&tmp_sum_Q, deinterleaved_iq_buffer + length, length);
+    const float NBP = tmp_sum_I * tmp_sum_I + tmp_sum_Q * tmp_sum_Q;
+    const float NBD = tmp_sum_I * tmp_sum_I - tmp_sum_Q * tmp_sum_Q;
+    return NBD / NBP;
+}
@@ -92,6 +92,14 @@ float cn0_svn_estimator(const gr_complex* Prompt_buffer, int length, float coh_i
 float cn0_m2m4_estimator(const gr_complex* Prompt_buffer, int length, float coh_integration_time_s);
 
 
+/*! \brief VOLK-backed version of cn0_m2m4_estimator
+ *
+ * Computes the same M2M4 estimate with VOLK kernels. magnitude_sq_buffer must
+ * point to at least length floats of caller-provided scratch space.
+ */
+float cn0_m2m4_estimator(const gr_complex* Prompt_buffer, float* magnitude_sq_buffer, int length, float coh_integration_time_s);
+
+
 /*! \brief A carrier lock detector
  *
  * The Carrier Phase Lock Detector block uses the estimate of the cosine of twice the carrier phase error is given by
@@ -109,6 +117,14 @@ float cn0_m2m4_estimator(const gr_complex* Prompt_buffer, int length, float coh_
 float carrier_lock_detector(const gr_complex* Prompt_buffer, int length);
 
 
+/*! \brief VOLK-backed version of carrier_lock_detector
+ *
+ * Computes the same lock metric with VOLK kernels. deinterleaved_iq_buffer
+ * must point to at least 2 * length floats of caller-provided scratch space.
+ */
+float carrier_lock_detector(const gr_complex* Prompt_buffer, float* deinterleaved_iq_buffer, int length);
+
+
 /** \} */
 /** \} */
 #endif  // GNSS_SDR_LOCK_DETECTORS_H
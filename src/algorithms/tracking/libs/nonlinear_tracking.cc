@@ -27,6 +27,7 @@
  */
 
 #include "nonlinear_tracking.h"
+#include "arma_arena.h"
 
 /***************** CUBATURE KALMAN FILTER *****************/
 
@@ -64,6 +65,37 @@ void CubatureFilter::initialize(const arma::mat& x_pred_0, const arma::mat& P_x_
 
     x_est = x_pred_out;
     P_x_est = P_x_pred_out;
+
+    Sm_cache_valid = false;
+}
+
+
+/*
+ * Rank-1 downdate of a lower-triangular Cholesky factor, so that on return
+ * L*L.t() equals the old L*L.t() - v*v.t(). Returns false (leaving L
+ * partially modified) when the downdated matrix is not positive definite.
+ */
+bool CubatureFilter::chol_rank1_downdate(arma::mat& L, arma::vec v)
+{
+    const int n = L.n_rows;
+    for (int k = 0; k < n; k++)
+        {
+            const double d = L(k, k) * L(k, k) - v(k) * v(k);
+            if (d <= 0.0)
+                {
+                    return false;
+                }
+            const double r = std::sqrt(d);
+            const double c = r / L(k, k);
+            const double s = v(k) / L(k, k);
+            L(k, k) = r;
+            for (int i = k + 1; i < n; i++)
+                {
+                    L(i, k) = (L(i, k) - s * v(i)) / c;
+                    v(i) = c * v(i) - s * L(i, k);
+                }
+        }
+    return true;
 }
 
 
@@ -76,19 +108,37 @@ void CubatureFilter::predict_sequential(const arma::vec& x_post, const arma::mat
     int nx = x_post.n_elem;
     int np = 2 * nx;
 
-    // Generator Matrix
-    arma::mat gen_one = arma::join_horiz(arma::eye(nx, nx), -1.0 * arma::eye(nx, nx));
+    // Per-epoch working matrices come from the thread arena
+    Arma_Arena_Scope arena;
 
-    // Initialize predicted mean and covariance
-    arma::vec x_pred = arma::zeros(nx, 1);
-    arma::mat P_x_pred = arma::zeros(nx, nx);
+    // Generator Matrix (depends only on the state dimension, cached between epochs)
+    if (static_cast<int>(gen_one_cached.n_rows) != nx)
+        {
+            gen_one_cached = arma::join_horiz(arma::eye(nx, nx), -1.0 * arma::eye(nx, nx));
+        }
+    const arma::mat& gen_one = gen_one_cached;
 
-    // Factorize posterior covariance
-    arma::mat Sm_post = arma::chol(P_x_post, "lower");
+    // Initialize predicted mean and covariance
+    arma::vec x_pred = arena.vec(nx);
+    x_pred.zeros();
+    arma::mat P_x_pred = arena.mat(nx, nx);
+    P_x_pred.zeros();
+
+    // Factorize posterior covariance, reusing the factor kept up to date by
+    // update_sequential() when the posterior is the last estimate
+    arma::mat Sm_post = arena.mat(nx, nx);
+    if (Sm_cache_valid && arma::approx_equal(P_x_post, P_est_cached, "absdiff", 0.0))
+        {
+            Sm_post = Sm_est_cached;
+        }
+    else
+        {
+            Sm_post = arma::chol(P_x_post, "lower");
+        }
 
     // Propagate and evaluate cubature points
-    arma::vec Xi_post;
-    arma::vec Xi_pred;
+    arma::vec Xi_post = arena.vec(nx);
+    arma::vec Xi_pred = arena.vec(nx);
 
     for (int i = 0; i < np; i++)
         {
@@ -119,20 +169,31 @@ void CubatureFilter::update_sequential(const arma::vec& z_upd, const arma::vec&
     int nz = z_upd.n_elem;
     int np = 2 * nx;
 
-    // Generator Matrix
-    arma::mat gen_one = arma::join_horiz(arma::eye(nx, nx), -1.0 * arma::eye(nx, nx));
+    // Per-epoch working matrices come from the thread arena
+    Arma_Arena_Scope arena;
+
+    // Generator Matrix (depends only on the state dimension, cached between epochs)
+    if (static_cast<int>(gen_one_cached.n_rows) != nx)
+        {
+            gen_one_cached = arma::join_horiz(arma::eye(nx, nx), -1.0 * arma::eye(nx, nx));
+        }
+    const arma::mat& gen_one = gen_one_cached;
 
     // Initialize estimated predicted measurement and covariances
-    arma::mat z_pred = arma::zeros(nz, 1);
-    arma::mat P_zz_pred = arma::zeros(nz, nz);
-    arma::mat P_xz_pred = arma::zeros(nx, nz);
+    arma::mat z_pred = arena.mat(nz, 1);
+    z_pred.zeros();
+    arma::mat P_zz_pred = arena.mat(nz, nz);
+    P_zz_pred.zeros();
+    arma::mat P_xz_pred = arena.mat(nx, nz);
+    P_xz_pred.zeros();
 
     // Factorize predicted covariance
-    arma::mat Sm_pred = arma::chol(P_x_pred, "lower");
+    arma::mat Sm_pred = arena.mat(nx, nx);
+    Sm_pred = arma::chol(P_x_pred, "lower");
 
     // Propagate and evaluate cubature points
-    arma::vec Xi_pred;
-    arma::vec Zi_pred;
+    arma::vec Xi_pred = arena.vec(nx);
+    arma::vec Zi_pred = arena.vec(nz);
     for (int i = 0; i < np; i++)
         {
             Xi_pred = Sm_pred * (std::sqrt(static_cast<float>(np) / 2.0) * gen_one.col(i)) + x_pred;
@@ -149,11 +210,35 @@ void CubatureFilter::update_sequential(const arma::vec& z_upd, const arma::vec&
     P_xz_pred = P_xz_pred / static_cast<float>(np) - x_pred * z_pred.t();
 
     // Compute cubature Kalman gain
-    arma::mat W_k = P_xz_pred * arma::inv(P_zz_pred);
+    arma::mat W_k = arena.mat(nx, nz);
+    W_k = P_xz_pred * arma::inv(P_zz_pred);
 
     // Compute and store the updated mean and error covariance
     x_est = x_pred + W_k * (z_upd - z_pred);
     P_x_est = P_x_pred - W_k * P_zz_pred * W_k.t();
+
+    // Keep the Cholesky factor of the estimate covariance for the next
+    // prediction: P_x_est is a rank-nz downdate of P_x_pred, so its factor
+    // follows from Sm_pred with nz rank-1 downdates instead of a fresh
+    // O(nx^3) factorization
+    Sm_cache_valid = false;
+    arma::mat S_zz = arena.mat(nz, nz);
+    if (arma::chol(S_zz, P_zz_pred, "lower"))
+        {
+            arma::mat U = arena.mat(nx, nz);
+            U = W_k * S_zz;
+            Sm_est_cached = Sm_pred;
+            bool downdated = true;
+            for (int j = 0; j < nz && downdated; j++)
+                {
+                    downdated = chol_rank1_downdate(Sm_est_cached, U.col(j));
+                }
+            if (downdated)
+                {
+                    P_est_cached = P_x_est;
+                    Sm_cache_valid = true;
+                }
+        }
 }
 
 
@@ -241,16 +326,24 @@ void UnscentedFilter::predict_sequential(const arma::vec& x_post, const arma::ma
     float W0_c = lambda / (static_cast<float>(nx) + lambda) + (1 - std::pow(alpha, 2.0F) + beta);
     float Wi_m = 1.0F / (2.0F * (static_cast<float>(nx) + lambda));
 
+    // Per-epoch working matrices come from the thread arena
+    Arma_Arena_Scope arena;
+
     // Propagate and evaluate sigma points
-    arma::mat Xi_fact = arma::zeros(nx, nx);
-    arma::mat Xi_post = arma::zeros(nx, np);
-    arma::mat Xi_pred = arma::zeros(nx, np);
+    arma::mat Xi_fact = arena.mat(nx, nx);
+    Xi_fact.zeros();
+    arma::mat Xi_post = arena.mat(nx, np);
+    Xi_post.zeros();
+    arma::mat Xi_pred = arena.mat(nx, np);
+    Xi_pred.zeros();
 
     Xi_post.col(0) = x_post;
     Xi_pred.col(0) = (*transition_fcn)(Xi_post.col(0));
+    // The scaled matrix square root does not depend on the sigma point index:
+    // compute it once per call instead of once per state component
+    Xi_fact = std::sqrt(static_cast<float>(nx) + lambda) * arma::sqrtmat_sympd(P_x_post);
     for (int i = 1; i <= nx; i++)
         {
-            Xi_fact = std::sqrt(static_cast<float>(nx) + lambda) * arma::sqrtmat_sympd(P_x_post);
             Xi_post.col(i) = x_post + Xi_fact.col(i - 1);
             Xi_post.col(i + nx) = x_post - Xi_fact.col(i - 1);
 
@@ -259,10 +352,12 @@ void UnscentedFilter::predict_sequential(const arma::vec& x_post, const arma::ma
         }
 
     // Compute predicted mean
-    arma::vec x_pred = W0_m * Xi_pred.col(0) + Wi_m * arma::sum(Xi_pred.cols(1, np - 1), 1);
+    arma::vec x_pred = arena.vec(nx);
+    x_pred = W0_m * Xi_pred.col(0) + Wi_m * arma::sum(Xi_pred.cols(1, np - 1), 1);
 
     // Compute predicted error covariance
-    arma::mat P_x_pred = W0_c * ((Xi_pred.col(0) - x_pred) * (Xi_pred.col(0).t() - x_pred.t()));
+    arma::mat P_x_pred = arena.mat(nx, nx);
+    P_x_pred = W0_c * ((Xi_pred.col(0) - x_pred) * (Xi_pred.col(0).t() - x_pred.t()));
     for (int i = 1; i < np; i++)
         {
             P_x_pred = P_x_pred + Wi_m * ((Xi_pred.col(i) - x_pred) * (Xi_pred.col(i).t() - x_pred.t()));
@@ -296,16 +391,24 @@ void UnscentedFilter::update_sequential(const arma::vec& z_upd, const arma::vec&
     float W0_c = lambda / (static_cast<float>(nx) + lambda) + (1.0F - std::pow(alpha, 2.0F) + beta);
     float Wi_m = 1.0F / (2.0F * (static_cast<float>(nx) + lambda));
 
+    // Per-epoch working matrices come from the thread arena
+    Arma_Arena_Scope arena;
+
     // Propagate and evaluate sigma points
-    arma::mat Xi_fact = arma::zeros(nx, nx);
-    arma::mat Xi_pred = arma::zeros(nx, np);
-    arma::mat Zi_pred = arma::zeros(nz, np);
+    arma::mat Xi_fact = arena.mat(nx, nx);
+    Xi_fact.zeros();
+    arma::mat Xi_pred = arena.mat(nx, np);
+    Xi_pred.zeros();
+    arma::mat Zi_pred = arena.mat(nz, np);
+    Zi_pred.zeros();
 
     Xi_pred.col(0) = x_pred;
     Zi_pred.col(0) = (*measurement_fcn)(Xi_pred.col(0));
+    // The scaled matrix square root does not depend on the sigma point index:
+    // compute it once per call instead of once per state component
+    Xi_fact = std::sqrt(static_cast<float>(nx) + lambda) * arma::sqrtmat_sympd(P_x_pred);
     for (int i = 1; i <= nx; i++)
         {
-            Xi_fact = std::sqrt(static_cast<float>(nx) + lambda) * arma::sqrtmat_sympd(P_x_pred);
             Xi_pred.col(i) = x_pred + Xi_fact.col(i - 1);
             Xi_pred.col(i + nx) = x_pred - Xi_fact.col(i - 1);
 
@@ -314,11 +417,14 @@ void UnscentedFilter::update_sequential(const arma::vec& z_upd, const arma::vec&
         }
 
     // Compute measurement mean
-    arma::mat z_pred = W0_m * Zi_pred.col(0) + Wi_m * arma::sum(Zi_pred.cols(1, np - 1), 1);
+    arma::mat z_pred = arena.mat(nz, 1);
+    z_pred = W0_m * Zi_pred.col(0) + Wi_m * arma::sum(Zi_pred.cols(1, np - 1), 1);
 
     // Compute measurement covariance and cross covariance
-    arma::mat P_zz_pred = W0_c * ((Zi_pred.col(0) - z_pred) * (Zi_pred.col(0).t() - z_pred.t()));
-    arma::mat P_xz_pred = W0_c * ((Xi_pred.col(0) - x_pred) * (Zi_pred.col(0).t() - z_pred.t()));
+    arma::mat P_zz_pred = arena.mat(nz, nz);
+    P_zz_pred = W0_c * ((Zi_pred.col(0) - z_pred) * (Zi_pred.col(0).t() - z_pred.t()));
+    arma::mat P_xz_pred = arena.mat(nx, nz);
+    P_xz_pred = W0_c * ((Xi_pred.col(0) - x_pred) * (Zi_pred.col(0).t() - z_pred.t()));
     for (int i = 0; i < np; i++)
         {
             P_zz_pred = P_zz_pred + Wi_m * ((Zi_pred.col(i) - z_pred) * (Zi_pred.col(i).t() - z_pred.t()));
@@ -327,7 +433,8 @@ void UnscentedFilter::update_sequential(const arma::vec& z_upd, const arma::vec&
     P_zz_pred = P_zz_pred + noise_covariance;
 
     // Estimate cubature Kalman gain
-    arma::mat W_k = P_xz_pred * arma::inv(P_zz_pred);
+    arma::mat W_k = arena.mat(nx, nz);
+    W_k = P_xz_pred * arma::inv(P_zz_pred);
 
     // Estimate and store the updated mean and error covariance
     x_est = x_pred + W_k * (z_upd - z_pred);
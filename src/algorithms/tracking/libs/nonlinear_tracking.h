@@ -74,10 +74,22 @@ public:
     arma::mat get_P_x_est() const;
 
 private:
+    // Rank-1 downdate of a lower-triangular Cholesky factor (L*L.t() - v*v.t())
+    static bool chol_rank1_downdate(arma::mat& L, arma::vec v);
+
     arma::vec x_pred_out;
     arma::mat P_x_pred_out;
     arma::vec x_est;
     arma::mat P_x_est;
+
+    // Cached between epochs: the generator matrix depends only on the state
+    // dimension, and the Cholesky factor of the last estimate covariance is
+    // maintained by update_sequential() via rank-1 downdates so the next
+    // prediction can skip its factorization
+    arma::mat gen_one_cached;
+    arma::mat Sm_est_cached;
+    arma::mat P_est_cached;
+    bool Sm_cache_valid{false};
 };
 
 class UnscentedFilter
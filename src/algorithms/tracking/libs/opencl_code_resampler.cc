@@ -0,0 +1,167 @@
+/*!
+ * \file opencl_code_resampler.cc
+ * \brief Implementation of an OpenCL offload engine for the code replica
+ * resampling of the multitap correlators
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "opencl_code_resampler.h"
+#include <glog/logging.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Same nearest-sample indexing as the generic protokernel of
+// volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn, so the replicas are
+// sample-for-sample identical to the CPU path
+const std::string resampler_kernel_source = R"(
+__kernel void resample_code(__global const float* local_code,
+    __global float* result,
+    __global const float* shifts_chips,
+    const int code_length_chips,
+    const int correlator_length_samples,
+    const int row_stride,
+    const float rem_code_phase_chips,
+    const float code_phase_step_chips,
+    const float code_phase_rate_step_chips)
+{
+    const int n = get_global_id(0);
+    const int tap = get_global_id(1);
+    if (n >= correlator_length_samples)
+        {
+            return;
+        }
+    const float fn = (float)n;
+    int local_code_chip_index = (int)floor(code_phase_step_chips * fn +
+        code_phase_rate_step_chips * fn * fn +
+        shifts_chips[tap] - rem_code_phase_chips);
+    if (local_code_chip_index < 0)
+        {
+            local_code_chip_index += code_length_chips * (abs(local_code_chip_index) / code_length_chips + 1);
+        }
+    local_code_chip_index = local_code_chip_index % code_length_chips;
+    result[tap * row_stride + n] = local_code[local_code_chip_index];
+}
+)";
+}  // namespace
+
+
+bool Opencl_Code_Resampler::init(int max_signal_length_samples, int n_correlators)
+{
+    std::vector<cl::Platform> all_platforms;
+    cl::Platform::get(&all_platforms);
+    if (all_platforms.empty())
+        {
+            LOG(WARNING) << "No OpenCL platforms found, code resampling stays on the CPU";
+            return false;
+        }
+
+    std::vector<cl::Device> gpu_devices;
+    all_platforms[0].getDevices(CL_DEVICE_TYPE_GPU, &gpu_devices);
+    if (gpu_devices.empty())
+        {
+            LOG(WARNING) << "No OpenCL GPU devices found, code resampling stays on the CPU";
+            return false;
+        }
+    d_device = gpu_devices[0];
+
+    std::vector<cl::Device> device;
+    device.push_back(d_device);
+    d_context = cl::Context(device);
+
+    cl::Program::Sources sources;
+    sources.push_back({resampler_kernel_source.c_str(), resampler_kernel_source.length()});
+    d_program = cl::Program(d_context, sources);
+    if (d_program.build(device) != CL_SUCCESS)
+        {
+            LOG(WARNING) << "Error building the OpenCL resampler kernel: "
+                         << d_program.getBuildInfo<CL_PROGRAM_BUILD_LOG>(device[0]);
+            return false;
+        }
+    d_kernel = cl::Kernel(d_program, "resample_code");
+    d_queue = cl::CommandQueue(d_context, d_device);
+
+    d_shifts_buffer = cl::Buffer(d_context, CL_MEM_READ_ONLY, sizeof(float) * n_correlators);
+    d_out_buffer = cl::Buffer(d_context, CL_MEM_WRITE_ONLY, sizeof(float) * max_signal_length_samples * n_correlators);
+    d_max_signal_length_samples = max_signal_length_samples;
+    d_n_correlators = n_correlators;
+    d_ready = true;
+    LOG(INFO) << "OpenCL code resampler using device " << d_device.getInfo<CL_DEVICE_NAME>();
+    return true;
+}
+
+
+bool Opencl_Code_Resampler::set_local_code(const float* code, int code_length_chips)
+{
+    if (!d_ready)
+        {
+            return false;
+        }
+    d_code_buffer = cl::Buffer(d_context, CL_MEM_READ_ONLY, sizeof(float) * code_length_chips);
+    if (d_queue.enqueueWriteBuffer(d_code_buffer, CL_TRUE, 0, sizeof(float) * code_length_chips, code) != CL_SUCCESS)
+        {
+            d_code_length_chips = 0;
+            return false;
+        }
+    d_code_length_chips = code_length_chips;
+    return true;
+}
+
+
+bool Opencl_Code_Resampler::enqueue(float rem_code_phase_chips,
+    float code_phase_step_chips,
+    float code_phase_rate_step_chips,
+    const float* shifts_chips,
+    float** dest,
+    int n_codes,
+    int correlator_length_samples)
+{
+    if (!ready() || (n_codes > d_n_correlators) || (correlator_length_samples > d_max_signal_length_samples))
+        {
+            return false;
+        }
+    d_queue.enqueueWriteBuffer(d_shifts_buffer, CL_FALSE, 0, sizeof(float) * n_codes, shifts_chips);
+    d_kernel.setArg(0, d_code_buffer);
+    d_kernel.setArg(1, d_out_buffer);
+    d_kernel.setArg(2, d_shifts_buffer);
+    d_kernel.setArg(3, d_code_length_chips);
+    d_kernel.setArg(4, correlator_length_samples);
+    d_kernel.setArg(5, d_max_signal_length_samples);
+    d_kernel.setArg(6, rem_code_phase_chips);
+    d_kernel.setArg(7, code_phase_step_chips);
+    d_kernel.setArg(8, code_phase_rate_step_chips);
+    // round the sample dimension up to a multiple of the work-group size
+    const int local_size = 64;
+    const int global_size = ((correlator_length_samples + local_size - 1) / local_size) * local_size;
+    if (d_queue.enqueueNDRangeKernel(d_kernel, cl::NullRange,
+            cl::NDRange(global_size, n_codes), cl::NDRange(local_size, 1)) != CL_SUCCESS)
+        {
+            return false;
+        }
+    // non-blocking read-back straight into the correlator rows; gather()
+    // waits for these transfers before the dot products touch the rows
+    for (int tap = 0; tap < n_codes; tap++)
+        {
+            d_queue.enqueueReadBuffer(d_out_buffer, CL_FALSE,
+                sizeof(float) * tap * d_max_signal_length_samples,
+                sizeof(float) * correlator_length_samples, dest[tap]);
+        }
+    return true;
+}
+
+
+bool Opencl_Code_Resampler::gather()
+{
+    return d_queue.finish() == CL_SUCCESS;
+}
@@ -0,0 +1,91 @@
+/*!
+ * \file opencl_code_resampler.h
+ * \brief Interface of an OpenCL offload engine for the code replica
+ * resampling of the multitap correlators
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_OPENCL_CODE_RESAMPLER_H
+#define GNSS_SDR_OPENCL_CODE_RESAMPLER_H
+
+#include "opencl/cl.hpp"
+
+/** \addtogroup Tracking
+ * \{ */
+/** \addtogroup Tracking_libs
+ * \{ */
+
+
+/*!
+ * \brief OpenCL offload engine for the code replica resampling of the
+ * multitap correlators.
+ *
+ * Resampling 10230-chip codes at wideband rates dominates the E5/E6
+ * tracking cost on machines whose integrated GPU sits idle. This engine
+ * runs the same nearest-sample resampling as
+ * volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn on an OpenCL device:
+ * enqueue() launches the replica generation asynchronously so the CPU can
+ * perform the carrier wipe-off of the same epoch in parallel, and gather()
+ * blocks until the replicas are back in host memory for the dot products.
+ */
+class Opencl_Code_Resampler
+{
+public:
+    Opencl_Code_Resampler() = default;
+    ~Opencl_Code_Resampler() = default;
+
+    //! Selects the first GPU device, builds the kernel and allocates the
+    //! device buffers. Returns false when no usable device is found
+    bool init(int max_signal_length_samples, int n_correlators);
+
+    //! Uploads the local code (one float per chip). Called on satellite change
+    bool set_local_code(const float* code, int code_length_chips);
+
+    //! Launches the resampling of n_codes replicas on the device and the
+    //! read-back into dest (one row per replica). Non-blocking
+    bool enqueue(float rem_code_phase_chips,
+        float code_phase_step_chips,
+        float code_phase_rate_step_chips,
+        const float* shifts_chips,
+        float** dest,
+        int n_codes,
+        int correlator_length_samples);
+
+    //! Blocks until the batch launched by enqueue() is in host memory
+    bool gather();
+
+    //! True once init() and set_local_code() have both succeeded
+    bool ready() const
+    {
+        return d_ready && (d_code_length_chips > 0);
+    }
+
+private:
+    cl::Device d_device;
+    cl::Context d_context;
+    cl::CommandQueue d_queue;
+    cl::Program d_program;
+    cl::Kernel d_kernel;
+    cl::Buffer d_code_buffer;
+    cl::Buffer d_shifts_buffer;
+    cl::Buffer d_out_buffer;
+    int d_max_signal_length_samples{0};
+    int d_n_correlators{0};
+    int d_code_length_chips{0};
+    bool d_ready{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_OPENCL_CODE_RESAMPLER_H
@@ -20,7 +20,6 @@
 
 #include "tracking_discriminators.h"
 #include "MATH_CONSTANTS.h"
-#include <gnuradio/math.h>
 
 //  All the outputs are in RADIANS
 
@@ -54,7 +53,24 @@ double fll_four_quadrant_atan(gr_complex prompt_s1, gr_complex prompt_s2, double
 {
     const float dot = prompt_s1.real() * prompt_s2.real() + prompt_s1.imag() * prompt_s2.imag();
     const float cross = prompt_s1.real() * prompt_s2.imag() - prompt_s2.real() * prompt_s1.imag();
-    return static_cast<double>(gr::fast_atan2f(cross, dot) / (t2 - t1));
+    return static_cast<double>(fast_atan2f_poly(cross, dot)) / (t2 - t1);
+}
+
+
+/*
+ * Batched FLL four quadrant arctan discriminator: evaluates the
+ * discriminator above for num_channels prompt pairs in one loop that the
+ * compiler can vectorize, since fast_atan2f_poly has no table lookups.
+ */
+void fll_four_quadrant_atan_batch(const gr_complex* prompt_s1, const gr_complex* prompt_s2, double t1, double t2, double* error_rad_s, std::size_t num_channels)
+{
+    const double inv_dt = 1.0 / (t2 - t1);
+    for (std::size_t i = 0; i < num_channels; i++)
+        {
+            const float dot = prompt_s1[i].real() * prompt_s2[i].real() + prompt_s1[i].imag() * prompt_s2[i].imag();
+            const float cross = prompt_s1[i].real() * prompt_s2[i].imag() - prompt_s2[i].real() * prompt_s1[i].imag();
+            error_rad_s[i] = static_cast<double>(fast_atan2f_poly(cross, dot)) * inv_dt;
+        }
 }
 
 
@@ -85,7 +101,21 @@ double fll_diff_atan(gr_complex prompt_s1, gr_complex prompt_s2, double t1, doub
  */
 double pll_four_quadrant_atan(gr_complex prompt_s1)
 {
-    return static_cast<double>(gr::fast_atan2f(prompt_s1.imag(), prompt_s1.real()));
+    return static_cast<double>(fast_atan2f_poly(prompt_s1.imag(), prompt_s1.real()));
+}
+
+
+/*
+ * Batched PLL four quadrant arctan discriminator: evaluates the
+ * discriminator above for num_channels prompt correlator outputs in one
+ * vectorizable loop.
+ */
+void pll_four_quadrant_atan_batch(const gr_complex* prompt, double* error_rad, std::size_t num_channels)
+{
+    for (std::size_t i = 0; i < num_channels; i++)
+        {
+            error_rad[i] = static_cast<double>(fast_atan2f_poly(prompt[i].imag(), prompt[i].real()));
+        }
 }
 
 
@@ -25,7 +25,9 @@
 #define GNSS_SDR_TRACKING_DISCRIMINATORS_H
 
 #include <gnuradio/gr_complex.h>
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 
 /** \addtogroup Tracking
  * \{ */
@@ -33,6 +35,29 @@
  * \{ */
 
 
+/*! \brief Polynomial four quadrant arctangent approximation
+ *
+ * Branch-light minimax polynomial approximation of atan2, with a maximum
+ * error below 2e-3 rad, well under the discriminator noise floor. Unlike
+ * the table-based gr::fast_atan2f it contains no memory lookups, so the
+ * compiler can vectorize loops calling it (see the *_batch discriminators
+ * below and src/tests/benchmarks/benchmark_atan2.cc).
+ */
+inline float fast_atan2f_poly(float y, float x)
+{
+    const float ax = std::fabs(x);
+    const float ay = std::fabs(y);
+    const float mx = std::max(ax, ay);
+    const float mn = std::min(ax, ay);
+    const float a = (mx == 0.0F) ? 0.0F : mn / mx;
+    const float s = a * a;
+    float r = ((-0.0464964749F * s + 0.15931422F) * s - 0.327622764F) * s * a + a;
+    r = (ay > ax) ? 1.57079637F - r : r;
+    r = (x < 0.0F) ? 3.14159274F - r : r;
+    return (y < 0.0F) ? -r : r;
+}
+
+
 /*! brief FLL four quadrant arctan discriminator
  *
  * FLL four quadrant arctan discriminator:
@@ -72,6 +97,23 @@ double phase_unwrap(double phase_rad);
 double pll_four_quadrant_atan(gr_complex prompt_s1);
 
 
+/*! \brief Batched PLL four quadrant arctan discriminator
+ *
+ * Evaluates pll_four_quadrant_atan for num_channels prompt correlator
+ * outputs in one vectorizable loop. The outputs are in [radians].
+ */
+void pll_four_quadrant_atan_batch(const gr_complex* prompt, double* error_rad, std::size_t num_channels);
+
+
+/*! \brief Batched FLL four quadrant arctan discriminator
+ *
+ * Evaluates fll_four_quadrant_atan for num_channels pairs of prompt
+ * correlator outputs in one vectorizable loop. The outputs are in
+ * [radians/second].
+ */
+void fll_four_quadrant_atan_batch(const gr_complex* prompt_s1, const gr_complex* prompt_s2, double t1, double t2, double* error_rad_s, std::size_t num_channels);
+
+
 /*! \brief PLL Costas loop two quadrant arctan discriminator
  *
  * PLL Costas loop two quadrant arctan discriminator:
@@ -196,6 +238,17 @@ double CosBocCorrelationFunction(double offset_in_chips)
 }
 
 
+// Autocorrelation of the CBOC(6,1,1/11) modulation, modeled as the
+// power-weighted sum of the autocorrelations of its two BOC components.
+// The BOC(1,1)/BOC(6,1) cross term vanishes at the origin and stays
+// negligible over the main peak, so it is omitted
+inline double CbocCorrelationFunction(double offset_in_chips)
+{
+    return (10.0 / 11.0) * SinBocCorrelationFunction<1, 1>(offset_in_chips) +
+           (1.0 / 11.0) * SinBocCorrelationFunction<6, 1>(offset_in_chips);
+}
+
+
 /** \} */
 /** \} */
 #endif  // GNSS_SDR_TRACKING_DISCRIMINATORS_H
@@ -0,0 +1,89 @@
+/*!
+ * \file tracking_group_engine.cc
+ * \brief Batches the per-epoch correlator workloads of several tracking channels
+ * \author Javier Arribas, 2021. jarribas(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "tracking_group_engine.h"
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+
+Tracking_Group_Engine& Tracking_Group_Engine::get_instance()
+{
+    static Tracking_Group_Engine instance;
+    return instance;
+}
+
+
+void Tracking_Group_Engine::execute(const std::function<void()>& job, uint32_t group_size)
+{
+    if (group_size <= 1U)
+        {
+            job();
+            return;
+        }
+
+    auto this_job = std::make_shared<Job>();
+    this_job->fn = &job;
+
+    std::unique_lock<std::mutex> lock(d_mutex);
+    d_pending.push_back(this_job);
+
+    if (d_pending.size() >= group_size)
+        {
+            // This channel completes the group: take all pending jobs and run
+            // them consecutively, keeping the kernel code hot in the
+            // instruction cache across the whole batch
+            std::vector<std::shared_ptr<Job>> batch(d_pending.begin(), d_pending.end());
+            d_pending.clear();
+            lock.unlock();
+            for (const auto& batched_job : batch)
+                {
+                    (*batched_job->fn)();
+                }
+            lock.lock();
+            for (const auto& batched_job : batch)
+                {
+                    batched_job->done = true;
+                }
+            d_cv.notify_all();
+            return;
+        }
+
+    // Wait for another channel to complete the group; if the group does not
+    // fill up in time (channels idle or lost), run the job locally
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(2);
+    while (!this_job->done)
+        {
+            if (d_cv.wait_until(lock, deadline) == std::cv_status::timeout && !this_job->done)
+                {
+                    const auto it = std::find(d_pending.begin(), d_pending.end(), this_job);
+                    if (it != d_pending.end())
+                        {
+                            // still pending: withdraw it and run locally
+                            d_pending.erase(it);
+                            lock.unlock();
+                            job();
+                            return;
+                        }
+                    // an executor already took the job; keep waiting for it to finish
+                    while (!this_job->done)
+                        {
+                            d_cv.wait(lock);
+                        }
+                    return;
+                }
+        }
+}
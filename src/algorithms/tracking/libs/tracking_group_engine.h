@@ -0,0 +1,72 @@
+/*!
+ * \file tracking_group_engine.h
+ * \brief Batches the per-epoch correlator workloads of several tracking channels
+ * \author Javier Arribas, 2021. jarribas(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_TRACKING_GROUP_ENGINE_H
+#define GNSS_SDR_TRACKING_GROUP_ENGINE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+
+/** \addtogroup Tracking
+ * \{ */
+/** \addtogroup Tracking_libs
+ * \{ */
+
+
+/*!
+ * \brief Gathers the correlation jobs of up to group_size tracking channels
+ * and runs them back to back on a single thread.
+ *
+ * Each GNU Radio tracking block runs in its own thread, so with many channels
+ * the rotator-dotprod kernels of different channels interleave and evict each
+ * other from the instruction cache. Channels configured with the same
+ * group_size submit their per-epoch correlation as a closure; the channel that
+ * completes the group executes the whole batch consecutively while the others
+ * wait, so the kernel code and dispatch tables stay hot across the batch. A
+ * timeout keeps a partially filled group from stalling when some channels are
+ * idle (e.g. in acquisition), in which case the waiting channel runs its own
+ * job locally.
+ */
+class Tracking_Group_Engine
+{
+public:
+    static Tracking_Group_Engine& get_instance();
+
+    //! Runs \a job, batched with jobs from other channels when group_size > 1
+    void execute(const std::function<void()>& job, uint32_t group_size);
+
+private:
+    Tracking_Group_Engine() = default;
+
+    struct Job
+    {
+        const std::function<void()>* fn{nullptr};
+        bool done{false};
+    };
+
+    std::list<std::shared_ptr<Job>> d_pending;
+    std::condition_variable d_cv;
+    std::mutex d_mutex;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_TRACKING_GROUP_ENGINE_H
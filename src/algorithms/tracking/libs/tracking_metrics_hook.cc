@@ -0,0 +1,71 @@
+/*!
+ * \file tracking_metrics_hook.cc
+ * \brief Implementation of the in-process tracking metrics hook
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "tracking_metrics_hook.h"
+#include <algorithm>  // for remove_if
+
+
+Tracking_Metrics_Hook& Tracking_Metrics_Hook::get_instance()
+{
+    static Tracking_Metrics_Hook instance;
+    return instance;
+}
+
+
+int32_t Tracking_Metrics_Hook::register_callback(gnss_sdr_tracking_epoch_callback_t callback, void* user_data)
+{
+    if (callback == nullptr)
+        {
+            return -1;
+        }
+    std::lock_guard<std::mutex> lock(mutex_);
+    const int32_t handle = next_handle_++;
+    callbacks_.push_back({callback, user_data, handle});
+    subscribers_.store(static_cast<int>(callbacks_.size()), std::memory_order_relaxed);
+    return handle;
+}
+
+
+void Tracking_Metrics_Hook::unregister_callback(int32_t handle)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    callbacks_.erase(std::remove_if(callbacks_.begin(), callbacks_.end(),
+                         [handle](const Subscriber& s) { return s.handle == handle; }),
+        callbacks_.end());
+    subscribers_.store(static_cast<int>(callbacks_.size()), std::memory_order_relaxed);
+}
+
+
+void Tracking_Metrics_Hook::publish(const gnss_sdr_tracking_epoch_t& epoch) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& subscriber : callbacks_)
+        {
+            subscriber.callback(&epoch, subscriber.user_data);
+        }
+}
+
+
+int32_t gnss_sdr_tracking_hook_register(gnss_sdr_tracking_epoch_callback_t callback, void* user_data)
+{
+    return Tracking_Metrics_Hook::get_instance().register_callback(callback, user_data);
+}
+
+
+void gnss_sdr_tracking_hook_unregister(int32_t handle)
+{
+    Tracking_Metrics_Hook::get_instance().unregister_callback(handle);
+}
@@ -0,0 +1,136 @@
+/*!
+ * \file tracking_metrics_hook.h
+ * \brief In-process subscription hook for per-epoch tracking metrics
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * Analytics tools used to consume the binary tracking dumps with offline
+ * scripts, which required dump_filename to stay enabled in production and
+ * cost file I/O. This hook exposes the same per-epoch state through a plain
+ * C callback interface, so analysis code running in the receiver process
+ * (a plug-in, or Python attaching through ctypes/cffi to the exported
+ * gnss_sdr_tracking_hook_* symbols) receives each epoch with zero file I/O.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_TRACKING_METRICS_HOOK_H
+#define GNSS_SDR_TRACKING_METRICS_HOOK_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/** \addtogroup Tracking
+ * \{ */
+/** \addtogroup Tracking_libs
+ * \{ */
+
+
+extern "C"
+{
+    /*!
+     * \brief Per-epoch tracking state handed to the registered callbacks.
+     *
+     * Plain C layout (fixed-width fields, 8-byte members first) so foreign
+     * function interfaces can map it without knowledge of C++ types. The
+     * fields mirror the record written to the binary tracking dumps.
+     */
+    typedef struct gnss_sdr_tracking_epoch
+    {
+        uint64_t sample_counter;          /*!< absolute sample stamp at the end of the epoch */
+        double abs_VE;                    /*!< very early correlator magnitude (0 if unused) */
+        double abs_E;                     /*!< early correlator magnitude */
+        double abs_P;                     /*!< prompt correlator magnitude */
+        double abs_L;                     /*!< late correlator magnitude */
+        double abs_VL;                    /*!< very late correlator magnitude (0 if unused) */
+        double prompt_I;                  /*!< prompt in-phase component (data component if pilot tracking) */
+        double prompt_Q;                  /*!< prompt quadrature component */
+        double acc_carrier_phase_rad;     /*!< accumulated carrier phase [rad] */
+        double carrier_doppler_hz;        /*!< carrier Doppler shift [Hz] */
+        double carrier_phase_rate_hz_s;   /*!< carrier phase rate [Hz/s] */
+        double code_freq_chips_s;         /*!< code frequency [chips/s] */
+        double code_phase_rate_chips_s2;  /*!< code phase rate [chips/s^2] */
+        double carr_error_hz;             /*!< PLL discriminator output [Hz] */
+        double carr_error_filt_hz;        /*!< filtered PLL command [Hz] */
+        double code_error_chips;          /*!< DLL discriminator output [chips] */
+        double code_error_filt_chips;     /*!< filtered DLL command [chips] */
+        double cn0_db_hz;                 /*!< carrier-to-noise density ratio estimate [dB-Hz] */
+        double carrier_lock_test;         /*!< carrier lock detector output */
+        double rem_code_phase_samples;    /*!< remnant code phase [samples] */
+        uint32_t channel;                 /*!< channel number */
+        uint32_t prn;                     /*!< satellite PRN */
+        char system;                      /*!< system letter ('G', 'E', 'R', 'C', ...) */
+        char signal[3];                   /*!< signal identifier, null-terminated (e.g. "1C") */
+    } gnss_sdr_tracking_epoch_t;
+
+    //! Callback invoked once per tracking epoch, from the channel thread.
+    //! It must return quickly and must not block: it runs in the signal path.
+    typedef void (*gnss_sdr_tracking_epoch_callback_t)(const gnss_sdr_tracking_epoch_t* epoch, void* user_data);
+
+    //! Registers a callback for the tracking epochs of all channels and
+    //! returns a handle for gnss_sdr_tracking_hook_unregister()
+    int32_t gnss_sdr_tracking_hook_register(gnss_sdr_tracking_epoch_callback_t callback, void* user_data);
+
+    //! Unregisters a callback. No epoch is delivered to it after this returns
+    void gnss_sdr_tracking_hook_unregister(int32_t handle);
+}
+
+
+/*!
+ * \brief Process-wide registry of the tracking epoch callbacks.
+ *
+ * The tracking blocks call publish() once per epoch; with no subscribers
+ * the cost is a single relaxed atomic load, so the hook stays permanently
+ * wired in the hot path. Registration is expected to be rare, so publish()
+ * takes the registry mutex only when at least one subscriber exists.
+ */
+class Tracking_Metrics_Hook
+{
+public:
+    static Tracking_Metrics_Hook& get_instance();
+
+    //! True when at least one callback is registered (cheap, lock-free)
+    inline bool has_subscribers() const
+    {
+        return subscribers_.load(std::memory_order_relaxed) != 0;
+    }
+
+    //! Registers a callback and returns its handle
+    int32_t register_callback(gnss_sdr_tracking_epoch_callback_t callback, void* user_data);
+
+    //! Unregisters the callback with the given handle
+    void unregister_callback(int32_t handle);
+
+    //! Delivers one epoch to every registered callback
+    void publish(const gnss_sdr_tracking_epoch_t& epoch) const;
+
+private:
+    Tracking_Metrics_Hook() = default;
+    ~Tracking_Metrics_Hook() = default;
+
+    struct Subscriber
+    {
+        gnss_sdr_tracking_epoch_callback_t callback;
+        void* user_data;
+        int32_t handle;
+    };
+
+    std::vector<Subscriber> callbacks_;  // guarded by mutex_
+    mutable std::mutex mutex_;
+    std::atomic<int> subscribers_{0};
+    int32_t next_handle_{0};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_TRACKING_METRICS_HOOK_H
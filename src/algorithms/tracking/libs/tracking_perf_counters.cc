@@ -0,0 +1,78 @@
+/*!
+ * \file tracking_perf_counters.cc
+ * \brief Lightweight per-stage CPU time counters for tracking channels
+ * \author Javier Arribas, 2021. jarribas(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "tracking_perf_counters.h"
+#include <iomanip>
+#include <sstream>
+
+namespace
+{
+const std::array<const char*, Tracking_Perf_Counters::NUM_STAGES> STAGE_NAMES = {
+    "correlation",
+    "loop_filters",
+    "tracking_vars",
+    "logging"};
+}  // namespace
+
+
+void Tracking_Perf_Counters::accumulate(Stage stage, int64_t elapsed_ns)
+{
+    d_stage_ns[stage] += elapsed_ns;
+}
+
+
+void Tracking_Perf_Counters::count_epoch()
+{
+    d_epochs++;
+}
+
+
+void Tracking_Perf_Counters::reset()
+{
+    d_stage_ns.fill(0);
+    d_epochs = 0U;
+}
+
+
+uint64_t Tracking_Perf_Counters::epochs() const
+{
+    return d_epochs;
+}
+
+
+std::string Tracking_Perf_Counters::summary() const
+{
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(2);
+    if (d_epochs == 0U)
+        {
+            report << "no epochs processed";
+            return report.str();
+        }
+    int64_t total_ns = 0;
+    for (int stage = 0; stage < NUM_STAGES; stage++)
+        {
+            total_ns += d_stage_ns[stage];
+        }
+    report << "avg us/epoch over " << d_epochs << " epochs:";
+    for (int stage = 0; stage < NUM_STAGES; stage++)
+        {
+            report << ' ' << STAGE_NAMES[stage] << '='
+                   << static_cast<double>(d_stage_ns[stage]) / (1000.0 * static_cast<double>(d_epochs));
+        }
+    report << " total=" << static_cast<double>(total_ns) / (1000.0 * static_cast<double>(d_epochs));
+    return report.str();
+}
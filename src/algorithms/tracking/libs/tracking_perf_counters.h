@@ -0,0 +1,112 @@
+/*!
+ * \file tracking_perf_counters.h
+ * \brief Lightweight per-stage CPU time counters for tracking channels
+ * \author Javier Arribas, 2021. jarribas(at)cttc.es
+ *
+ * Accumulates wall-clock time spent in the stages of a tracking channel
+ * (correlation, loop filters, tracking variable updates, logging) so that a
+ * channel burning anomalous CPU can be spotted from the receiver logs without
+ * external profiling tools.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_TRACKING_PERF_COUNTERS_H
+#define GNSS_SDR_TRACKING_PERF_COUNTERS_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/** \addtogroup Tracking
+ * \{ */
+/** \addtogroup Tracking_libs
+ * \{ */
+
+
+/*!
+ * \brief Per-channel accumulator of CPU time spent in each tracking stage.
+ *
+ * Stages are timed with std::chrono::steady_clock through the RAII
+ * Scoped_Timer helper; an inactive timer costs a single branch, so the
+ * instrumentation can stay in the hot path and be enabled per channel with a
+ * configuration option.
+ */
+class Tracking_Perf_Counters
+{
+public:
+    enum Stage : int
+    {
+        CORRELATION = 0,  //!< carrier wipe-off and multitap correlation
+        LOOP_FILTERS,     //!< discriminators and DLL/PLL/FLL filters
+        TRACKING_VARS,    //!< NCO and tracking variable updates
+        LOGGING,          //!< dump files and monitor output
+        NUM_STAGES
+    };
+
+    //! RAII timer adding the elapsed time to one stage when it goes out of scope
+    class Scoped_Timer
+    {
+    public:
+        Scoped_Timer(Tracking_Perf_Counters* owner, Stage stage, bool enabled)
+            : d_owner(owner), d_stage(stage), d_enabled(enabled)
+        {
+            if (d_enabled)
+                {
+                    d_start = std::chrono::steady_clock::now();
+                }
+        }
+
+        ~Scoped_Timer()
+        {
+            if (d_enabled)
+                {
+                    d_owner->accumulate(d_stage,
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - d_start)
+                            .count());
+                }
+        }
+
+        Scoped_Timer(const Scoped_Timer&) = delete;
+        Scoped_Timer& operator=(const Scoped_Timer&) = delete;
+        Scoped_Timer(Scoped_Timer&&) = delete;
+        Scoped_Timer& operator=(Scoped_Timer&&) = delete;
+
+    private:
+        std::chrono::steady_clock::time_point d_start;
+        Tracking_Perf_Counters* d_owner;
+        Stage d_stage;
+        bool d_enabled;
+    };
+
+    Tracking_Perf_Counters() = default;
+    ~Tracking_Perf_Counters() = default;
+
+    void accumulate(Stage stage, int64_t elapsed_ns);
+    void count_epoch();  //!< Call once per processed correlation epoch
+    void reset();
+
+    uint64_t epochs() const;
+
+    //! One-line report with average microseconds per epoch spent in each stage
+    std::string summary() const;
+
+private:
+    std::array<int64_t, NUM_STAGES> d_stage_ns{};
+    uint64_t d_epochs{0U};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_TRACKING_PERF_COUNTERS_H
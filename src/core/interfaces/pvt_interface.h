@@ -61,6 +61,8 @@ public:
         double* ground_speed_kmh,
         double* course_over_ground_deg,
         time_t* UTC_time) = 0;
+
+    virtual double get_rx_clock_drift_ppm() = 0;
 };
 
 
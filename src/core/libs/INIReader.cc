@@ -38,6 +38,12 @@ INIReader::INIReader(const std::string& filename)
 }
 
 
+INIReader::INIReader(std::map<std::string, std::string> values)
+    : _values(std::move(values)), _error(0)
+{
+}
+
+
 int INIReader::ParseError() const
 {
     return _error;
@@ -101,3 +107,9 @@ bool INIReader::HasValue(const std::string& section, const std::string& name) co
     std::string key = MakeKey(section, name);
     return _values.count(key);
 }
+
+
+const std::map<std::string, std::string>& INIReader::Values() const
+{
+    return _values;
+}
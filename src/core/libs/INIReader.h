@@ -48,6 +48,10 @@ public:
     //! Construct INIReader and parse given filename. See ini.h for more info about the parsing.
     explicit INIReader(const std::string& filename);
 
+    //! Construct INIReader from an already parsed name/value map, e.g. a
+    //! compiled configuration snapshot. No parsing takes place.
+    explicit INIReader(std::map<std::string, std::string> values);
+
     //! Return the result of ini_parse(), i.e., 0 on success, line number of first error on parse error, or -1 on file open error.
     int ParseError() const;
 
@@ -64,6 +68,9 @@ public:
     //! Return true if a value exists with the given section and field names.
     bool HasValue(const std::string& section, const std::string& name) const;
 
+    //! Return all the parsed name/value pairs, keyed as "section.name" in lower case.
+    const std::map<std::string, std::string>& Values() const;
+
 private:
     static std::string MakeKey(const std::string& section, const std::string& name);
     static int ValueHandler(void* user, const char* section, const char* name,
@@ -15,10 +15,14 @@
  */
 
 #include "channel_event.h"
+#include "event_pool.h"
 
 channel_event_sptr channel_event_make(int channel_id, int event_type)
 {
-    return channel_event_sptr(new Channel_Event(channel_id, event_type));
+    // combined object + control block allocation served from the event arena,
+    // so channel churn recycles a few slots instead of hitting the heap
+    return std::allocate_shared<Channel_Event>(Event_Pool_Allocator<Channel_Event>(),
+        Channel_Event(channel_id, event_type));
 }
 
 Channel_Event::Channel_Event(int channel_id_, int event_type_)
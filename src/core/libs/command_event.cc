@@ -15,10 +15,13 @@
  */
 
 #include "command_event.h"
+#include "event_pool.h"
 
 command_event_sptr command_event_make(int command_id, int event_type)
 {
-    return command_event_sptr(new Command_Event(command_id, event_type));
+    // combined object + control block allocation served from the event arena
+    return std::allocate_shared<Command_Event>(Event_Pool_Allocator<Command_Event>(),
+        Command_Event(command_id, event_type));
 }
 
 Command_Event::Command_Event(int command_id_, int event_type_)
@@ -0,0 +1,73 @@
+/*!
+ * \file event_pool.cc
+ * \brief Fixed-size allocation pool for the receiver event objects
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "event_pool.h"
+
+Event_Arena& Event_Arena::get_instance()
+{
+    static Event_Arena instance;
+    return instance;
+}
+
+
+Event_Arena::Event_Arena() : d_storage(N_SLOTS)
+{
+    d_free_slots.reserve(N_SLOTS);
+    for (auto& s : d_storage)
+        {
+            d_free_slots.push_back(s.bytes);
+        }
+}
+
+
+void* Event_Arena::take(std::size_t bytes)
+{
+    if (bytes > SLOT_BYTES)
+        {
+            return nullptr;
+        }
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (d_free_slots.empty())
+        {
+            return nullptr;
+        }
+    void* p = d_free_slots.back();
+    d_free_slots.pop_back();
+    return p;
+}
+
+
+void Event_Arena::give_back(void* p)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_free_slots.push_back(p);
+}
+
+
+bool Event_Arena::owns(const void* p) const
+{
+    const auto* first = reinterpret_cast<const unsigned char*>(d_storage.data());
+    const auto* last = first + N_SLOTS * sizeof(slot);
+    const auto* q = reinterpret_cast<const unsigned char*>(p);
+    return q >= first and q < last;
+}
+
+
+std::size_t Event_Arena::slots_in_use() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return N_SLOTS - d_free_slots.size();
+}
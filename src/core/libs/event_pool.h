@@ -0,0 +1,128 @@
+/*!
+ * \file event_pool.h
+ * \brief Fixed-size allocation pool for the receiver event objects
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_EVENT_POOL_H
+#define GNSS_SDR_EVENT_POOL_H
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver_Library
+ * \{ */
+
+
+/*!
+ * \brief Recycling arena backing the receiver event vocabulary.
+ *
+ * The events exchanged through the control queue (Channel_Event,
+ * Command_Event) are tiny objects created at every acquisition, loss of lock
+ * or commanded state change, each costing a heap allocation for the object
+ * plus one for the std::shared_ptr control block. This arena hands out
+ * fixed-size slots large enough for a std::allocate_shared combined
+ * allocation, so under channel churn the same few slots are recycled instead
+ * of hitting the allocator tens of thousands of times per minute. When a
+ * request does not fit a slot or the arena is exhausted, it falls back to the
+ * regular heap, so pooling is transparent to the producers.
+ */
+class Event_Arena
+{
+public:
+    static Event_Arena& get_instance();
+
+    //! returns a slot, or nullptr if bytes exceeds the slot size or the arena is full
+    void* take(std::size_t bytes);
+    //! returns a slot obtained from take() to the free list
+    void give_back(void* p);
+    //! whether p points into the arena storage
+    bool owns(const void* p) const;
+
+    std::size_t slots_in_use() const;
+
+    // one slot holds the shared_ptr control block plus the event payload
+    static constexpr std::size_t SLOT_BYTES = 96;
+    static constexpr std::size_t N_SLOTS = 512;
+
+private:
+    Event_Arena();
+
+    struct alignas(alignof(std::max_align_t)) slot
+    {
+        unsigned char bytes[SLOT_BYTES];
+    };
+
+    std::vector<slot> d_storage;
+    std::vector<void*> d_free_slots;
+    mutable std::mutex d_mutex;
+};
+
+
+/*!
+ * \brief Minimal C++ allocator drawing from the Event_Arena, for use with
+ * std::allocate_shared in the event maker functions.
+ */
+template <typename T>
+class Event_Pool_Allocator
+{
+public:
+    using value_type = T;
+
+    Event_Pool_Allocator() = default;
+
+    template <typename U>
+    explicit Event_Pool_Allocator(const Event_Pool_Allocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n)
+    {
+        if (void* p = Event_Arena::get_instance().take(n * sizeof(T)))
+            {
+                return static_cast<T*>(p);
+            }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept
+    {
+        Event_Arena& arena = Event_Arena::get_instance();
+        if (arena.owns(p))
+            {
+                arena.give_back(p);
+            }
+        else
+            {
+                ::operator delete(p);
+            }
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const Event_Pool_Allocator<T>&, const Event_Pool_Allocator<U>&) noexcept
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const Event_Pool_Allocator<T>&, const Event_Pool_Allocator<U>&) noexcept
+{
+    return false;
+}
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_EVENT_POOL_H
@@ -0,0 +1,138 @@
+/*!
+ * \file fpga_epoch_counter.cc
+ * \brief Direct reader of the FPGA sample counter module for epoch alignment
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "fpga_epoch_counter.h"
+#include "uio_fpga.h"
+#include <glog/logging.h>
+#include <fcntl.h>  // for O_RDWR
+#include <iostream>
+#include <sys/mman.h>  // for mmap
+#include <unistd.h>    // for write, close, read, ssize_t
+
+
+Fpga_Epoch_Counter::~Fpga_Epoch_Counter()
+{
+    if (is_open)
+        {
+            close_device();
+        }
+}
+
+
+bool Fpga_Epoch_Counter::open_device()
+{
+    // find the uio device file corresponding to the sample counter module
+    std::string device_io_name;
+    if (find_uio_dev_file_name(device_io_name, device_name, 0) < 0)
+        {
+            std::cout << "Cannot find the FPGA uio device file corresponding to device name " << device_name << '\n';
+            return false;
+        }
+
+    // open communication with HW accelerator
+    if ((fd = open(device_io_name.c_str(), O_RDWR | O_SYNC)) == -1)
+        {
+            LOG(WARNING) << "Cannot open deviceio" << device_io_name;
+            std::cout << "Epoch counter: cannot open deviceio" << device_io_name << '\n';
+            return false;
+        }
+    map_base = reinterpret_cast<volatile uint32_t *>(mmap(nullptr, FPGA_PAGE_SIZE,
+        PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+
+    if (map_base == reinterpret_cast<void *>(-1))
+        {
+            LOG(WARNING) << "Cannot map the FPGA sample counter module into user memory";
+            std::cout << "Epoch counter: cannot map deviceio" << device_io_name << '\n';
+            close(fd);
+            fd = -1;
+            return false;
+        }
+
+    // sanity check : check test register
+    const uint32_t writeval = test_reg_sanity_check;
+    const uint32_t readval = test_register(writeval);
+    if (writeval != readval)
+        {
+            LOG(WARNING) << "Epoch counter test register sanity check failed";
+        }
+    else
+        {
+            LOG(INFO) << "Epoch counter test register sanity check success!";
+        }
+    is_open = true;
+    return true;
+}
+
+
+uint32_t Fpga_Epoch_Counter::test_register(uint32_t writeval)
+{
+    // write value to test register
+    map_base[3] = writeval;
+    // read value from test register
+    return map_base[3];
+}
+
+
+void Fpga_Epoch_Counter::set_samples_per_epoch(uint32_t samples_per_epoch)
+{
+    // note : the counter is a 48-bit value in the HW.
+    map_base[0] = samples_per_epoch - 1;
+}
+
+
+uint64_t Fpga_Epoch_Counter::wait_and_read()
+{
+    wait_for_interrupt();
+
+    uint64_t sample_counter = map_base[0];
+    uint64_t sample_counter_msw = map_base[1];
+    sample_counter_msw = sample_counter_msw << 32;
+    return sample_counter + sample_counter_msw;  // 2^32
+}
+
+
+void Fpga_Epoch_Counter::wait_for_interrupt() const
+{
+    int32_t irq_count;
+    ssize_t nb;
+
+    // enable interrupts
+    int32_t reenable = 1;
+    write(fd, reinterpret_cast<void *>(&reenable), sizeof(int32_t));
+
+    // wait for interrupt
+    nb = read(fd, &irq_count, sizeof(irq_count));
+    if (nb != sizeof(irq_count))
+        {
+            std::cout << "fpga epoch counter module read failed to retrieve 4 bytes!\n";
+            std::cout << "fpga epoch counter module interrupt number " << irq_count << '\n';
+        }
+}
+
+
+void Fpga_Epoch_Counter::close_device()
+{
+    map_base[2] = 0;  // disable the generation of the interrupt in the device
+
+    auto *aux = const_cast<uint32_t *>(map_base);
+    if (munmap(static_cast<void *>(aux), FPGA_PAGE_SIZE) == -1)
+        {
+            std::cout << "Failed to unmap memory uio\n";
+        }
+    close(fd);
+    fd = -1;
+    is_open = false;
+}
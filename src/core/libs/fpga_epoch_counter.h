@@ -0,0 +1,72 @@
+/*!
+ * \file fpga_epoch_counter.h
+ * \brief Direct reader of the FPGA sample counter module for epoch alignment
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_FPGA_EPOCH_COUNTER_H
+#define GNSS_SDR_FPGA_EPOCH_COUNTER_H
+
+#include <cstdint>
+#include <string>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver_Library
+ * \{ */
+
+
+/*!
+ * \brief Direct interface to the FPGA sample counter module.
+ *
+ * Provides the same epoch pulse as the gnss_sdr_fpga_sample_counter block
+ * but without a flowgraph stream: the consumer blocks on the counter
+ * interrupt and reads the 48-bit sample count straight from the module
+ * registers, so no scheduler crossing or stream buffer is involved
+ * (GNSS-SDR.fpga_epoch_source=true).
+ */
+class Fpga_Epoch_Counter
+{
+public:
+    Fpga_Epoch_Counter() = default;
+    ~Fpga_Epoch_Counter();
+
+    //! Finds and maps the counter UIO device. Returns false on failure
+    bool open_device();
+
+    //! Programs the number of samples between epoch interrupts
+    void set_samples_per_epoch(uint32_t samples_per_epoch);
+
+    //! Blocks until the next epoch interrupt and returns the sample count
+    uint64_t wait_and_read();
+
+    void close_device();
+
+private:
+    const std::string device_name = "counter";  // UIO device name
+
+    static const uint32_t FPGA_PAGE_SIZE = 0x1000;         // default page size for the counter memory map
+    static const uint32_t test_reg_sanity_check = 0x55AA;  // value to check the presence of the test register (to detect the hw)
+
+    uint32_t test_register(uint32_t writeval);
+    void wait_for_interrupt() const;
+
+    volatile uint32_t *map_base{nullptr};  // driver memory map
+    int32_t fd{-1};                        // driver descriptor
+    bool is_open{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_FPGA_EPOCH_COUNTER_H
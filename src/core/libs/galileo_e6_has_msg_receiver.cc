@@ -78,6 +78,7 @@ galileo_e6_has_msg_receiver::galileo_e6_has_msg_receiver() : gr::block("galileo_
 
     // Reserve memory for decoding matrices and received PIDs
     d_C_matrix = std::vector<std::vector<std::vector<uint8_t>>>(GALILEO_CNAV_INFORMATION_VECTOR_LENGTH, std::vector<std::vector<uint8_t>>(GALILEO_CNAV_MAX_NUMBER_SYMBOLS_ENCODED_BLOCK, std::vector<uint8_t>(GALILEO_CNAV_OCTETS_IN_SUBPAGE)));  // 32 x 255 x 53
+    d_syndrome_matrix = std::vector<std::vector<std::vector<uint8_t>>>(GALILEO_CNAV_INFORMATION_VECTOR_LENGTH, std::vector<std::vector<uint8_t>>(GALILEO_CNAV_OCTETS_IN_SUBPAGE, std::vector<uint8_t>(GALILEO_CNAV_MAX_NUMBER_SYMBOLS_ENCODED_BLOCK - GALILEO_CNAV_INFORMATION_VECTOR_LENGTH)));  // 32 x 53 x 223
     d_M_matrix = std::vector<std::vector<uint8_t>>(GALILEO_CNAV_INFORMATION_VECTOR_LENGTH, std::vector<uint8_t>(GALILEO_CNAV_OCTETS_IN_SUBPAGE));                                                                                                 // HAS message matrix 32 x 53
     d_received_pids = std::vector<std::vector<uint8_t>>(HAS_MSG_NUMBER_MESSAGE_IDS, std::vector<uint8_t>());
     d_received_timestamps = std::vector<std::vector<uint64_t>>(HAS_MSG_NUMBER_MESSAGE_IDS, std::vector<uint64_t>());
@@ -234,7 +235,11 @@ void galileo_e6_has_msg_receiver::process_HAS_page(const Galileo_HAS_page& has_p
                                                     constexpr int bits_in_octet = 8;
                                                     std::string bits8 = page_string.substr(k * bits_in_octet, bits_in_octet);
                                                     std::bitset<bits_in_octet> bs(bits8);
-                                                    d_C_matrix[has_page.message_id][has_page.message_page_id - 1][k] = static_cast<uint8_t>(bs.to_ulong());
+                                                    const auto octet = static_cast<uint8_t>(bs.to_ulong());
+                                                    d_C_matrix[has_page.message_id][has_page.message_page_id - 1][k] = octet;
+                                                    // fold the new page into the per-column syndromes, so the
+                                                    // Reed-Solomon decoder does not have to revisit the block
+                                                    d_rs->update_syndromes(d_syndrome_matrix[has_page.message_id][k], octet, has_page.message_page_id - 1);
                                                 }
                                         }
                                 }
@@ -284,6 +289,7 @@ void galileo_e6_has_msg_receiver::delete_outdated_data(const Galileo_HAS_page& h
                     d_received_pids[i].clear();
                     d_received_timestamps[i].clear();
                     d_C_matrix[i] = {GALILEO_CNAV_MAX_NUMBER_SYMBOLS_ENCODED_BLOCK, std::vector<uint8_t>(GALILEO_CNAV_OCTETS_IN_SUBPAGE)};
+                    d_syndrome_matrix[i] = {GALILEO_CNAV_OCTETS_IN_SUBPAGE, std::vector<uint8_t>(GALILEO_CNAV_MAX_NUMBER_SYMBOLS_ENCODED_BLOCK - GALILEO_CNAV_INFORMATION_VECTOR_LENGTH)};
                 }
         }
     for (size_t mid = 0; mid < HAS_MSG_NUMBER_MESSAGE_IDS; mid++)
@@ -336,6 +342,7 @@ int galileo_e6_has_msg_receiver::decode_message_type1(uint8_t message_id, uint8_
             LOG(ERROR) << msg;
             d_received_pids[message_id].clear();
             d_C_matrix[message_id] = {GALILEO_CNAV_MAX_NUMBER_SYMBOLS_ENCODED_BLOCK, std::vector<uint8_t>(GALILEO_CNAV_OCTETS_IN_SUBPAGE)};
+            d_syndrome_matrix[message_id] = {GALILEO_CNAV_OCTETS_IN_SUBPAGE, std::vector<uint8_t>(GALILEO_CNAV_MAX_NUMBER_SYMBOLS_ENCODED_BLOCK - GALILEO_CNAV_INFORMATION_VECTOR_LENGTH)};
             return -1;
         }
 
@@ -355,7 +362,7 @@ int galileo_e6_has_msg_receiver::decode_message_type1(uint8_t message_id, uint8_
                     C_column[pid - 1] = d_C_matrix[message_id][pid - 1][col];
                 }
 
-            int result = d_rs->decode(C_column, erasure_positions);
+            int result = d_rs->decode_with_syndromes(C_column, d_syndrome_matrix[message_id][col], erasure_positions);
 
             if (result < 0)
                 {
@@ -402,6 +409,7 @@ int galileo_e6_has_msg_receiver::decode_message_type1(uint8_t message_id, uint8_
 
     // reset data for next decoding
     d_C_matrix[message_id] = std::vector<std::vector<uint8_t>>(GALILEO_CNAV_MAX_NUMBER_SYMBOLS_ENCODED_BLOCK, std::vector<uint8_t>(GALILEO_CNAV_OCTETS_IN_SUBPAGE));
+    d_syndrome_matrix[message_id] = std::vector<std::vector<uint8_t>>(GALILEO_CNAV_OCTETS_IN_SUBPAGE, std::vector<uint8_t>(GALILEO_CNAV_MAX_NUMBER_SYMBOLS_ENCODED_BLOCK - GALILEO_CNAV_INFORMATION_VECTOR_LENGTH));
     d_received_pids[message_id].clear();
 
     // Trigger HAS message content reading and fill the d_HAS_data object
@@ -93,6 +93,7 @@ private:
     // Store decoding matrices and received PIDs
     std::vector<std::vector<uint64_t>> d_received_timestamps;
     std::vector<std::vector<std::vector<uint8_t>>> d_C_matrix;
+    std::vector<std::vector<std::vector<uint8_t>>> d_syndrome_matrix;
     std::vector<std::vector<uint8_t>> d_M_matrix;
     std::vector<std::vector<uint8_t>> d_received_pids;
     std::vector<uint64_t> d_printed_timestamps;
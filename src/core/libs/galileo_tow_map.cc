@@ -17,9 +17,12 @@
 
 #include "galileo_tow_map.h"
 #include <glog/logging.h>  // for LOG
+#include <atomic>          // for std::atomic_thread_fence
 #include <limits>          // for std::numeric_limits
+#include <map>             // for std::map
 #include <memory>          // for std::shared
 #include <typeinfo>        // for typeid
+#include <utility>         // for std::pair
 
 #if HAS_GENERIC_LAMBDA
 #else
@@ -57,17 +60,50 @@ galileo_tow_map::galileo_tow_map() : gr::block("galileo_tow_map", gr::io_signatu
         boost::bind(&galileo_tow_map::msg_handler_galileo_tow_map, this, _1));
 #endif
 #endif
+}
+
 
-    for (uint32_t prn = 0; prn < 37; prn++)
+bool galileo_tow_map::read_tow(uint32_t prn, uint32_t& tow_ms, uint64_t& sample_counter) const
+{
+    if (prn >= d_galileo_tow.size())
+        {
+            return false;
+        }
+    const Tow_Entry& entry = d_galileo_tow[prn];
+    uint32_t tow = std::numeric_limits<uint32_t>::max();
+    uint64_t counter = std::numeric_limits<uint64_t>::max();
+    for (;;)
+        {
+            const uint32_t seq_before = entry.seq.load(std::memory_order_acquire);
+            if ((seq_before & 1U) != 0U)
+                {
+                    // a write is in flight, retry
+                    continue;
+                }
+            tow = entry.tow_ms.load(std::memory_order_relaxed);
+            counter = entry.sample_counter.load(std::memory_order_relaxed);
+            // the fence keeps the payload loads from moving past the seq re-check
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (entry.seq.load(std::memory_order_relaxed) == seq_before)
+                {
+                    break;
+                }
+        }
+    if (tow == std::numeric_limits<uint32_t>::max())
         {
-            d_galileo_tow[prn] = std::pair<uint32_t, uint64_t>(std::numeric_limits<uint32_t>::max(), std::numeric_limits<uint64_t>::max());
+            return false;
         }
+    tow_ms = tow;
+    sample_counter = counter;
+    return true;
 }
 
 
 void galileo_tow_map::msg_handler_galileo_tow_map(const pmt::pmt_t& msg)
 {
-    gr::thread::scoped_lock lock(d_setlock);
+    // single writer: GNU Radio serializes the message handlers of a block,
+    // so the seqlock entries are updated without taking any lock and the
+    // concurrent read_tow() callers never serialize against this handler
     try
         {
             const size_t msg_type_hash_code = pmt::any_ref(msg).type().hash_code();
@@ -78,16 +114,34 @@ void galileo_tow_map::msg_handler_galileo_tow_map(const pmt::pmt_t& msg)
                     const uint32_t received_tow = received_tow_map->second.first;
                     const uint64_t received_sample_counter = received_tow_map->second.second;
 
-                    d_galileo_tow.erase(received_prn);
-                    if (received_tow < 604800000)  // received TOW is in ms
+                    if (received_prn < d_galileo_tow.size())
                         {
-                            d_galileo_tow[received_prn] = std::pair<uint32_t, uint64_t>(received_tow, received_sample_counter);
+                            Tow_Entry& entry = d_galileo_tow[received_prn];
+                            const uint32_t seq = entry.seq.load(std::memory_order_relaxed);
+                            entry.seq.store(seq + 1, std::memory_order_relaxed);  // odd: write in progress
+                            // the fence keeps the payload stores from moving ahead of the odd seq
+                            std::atomic_thread_fence(std::memory_order_release);
+                            if (received_tow < 604800000)  // received TOW is in ms
+                                {
+                                    entry.tow_ms.store(received_tow, std::memory_order_relaxed);
+                                    entry.sample_counter.store(received_sample_counter, std::memory_order_relaxed);
+                                }
+                            else
+                                {
+                                    entry.tow_ms.store(std::numeric_limits<uint32_t>::max(), std::memory_order_relaxed);
+                                    entry.sample_counter.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+                                }
+                            entry.seq.store(seq + 2, std::memory_order_release);
                         }
-                    else
+
+                    // keep publishing the whole map for the telemetry decoders
+                    // subscribed to TOW_to_TLM
+                    const auto tmp_obj = std::make_shared<std::map<uint32_t, std::pair<uint32_t, uint64_t>>>();
+                    for (uint32_t prn = 0; prn < d_galileo_tow.size(); prn++)
                         {
-                            d_galileo_tow[received_prn] = std::pair<uint32_t, uint64_t>(std::numeric_limits<uint32_t>::max(), std::numeric_limits<uint64_t>::max());
+                            (*tmp_obj)[prn] = std::pair<uint32_t, uint64_t>(d_galileo_tow[prn].tow_ms.load(std::memory_order_relaxed),
+                                d_galileo_tow[prn].sample_counter.load(std::memory_order_relaxed));
                         }
-                    const std::shared_ptr<std::map<uint32_t, std::pair<uint32_t, uint64_t>>> tmp_obj = std::make_shared<std::map<uint32_t, std::pair<uint32_t, uint64_t>>>(d_galileo_tow);
                     this->message_port_pub(pmt::mp("TOW_to_TLM"), pmt::make_any(tmp_obj));
                 }
         }
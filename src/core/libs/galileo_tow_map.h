@@ -20,9 +20,10 @@
 #include "gnss_block_interface.h"  // for gnss_shared_ptr
 #include <gnuradio/block.h>        // for gr::block
 #include <pmt/pmt.h>               // for pmt::pmt_t
+#include <array>
+#include <atomic>
 #include <cstdint>
-#include <map>
-#include <utility>
+#include <limits>
 
 /** \addtogroup Core
  * \{ */
@@ -40,13 +41,33 @@ class galileo_tow_map : public gr::block
 public:
     ~galileo_tow_map() = default;  //!< Default destructor
 
+    /*!
+     * \brief Lock-free lookup of the last TOW stored for a PRN.
+     *
+     * Safe to call concurrently from any thread; readers never block the
+     * writer nor each other. Returns false if no valid TOW has been
+     * received for that PRN
+     */
+    bool read_tow(uint32_t prn, uint32_t& tow_ms, uint64_t& sample_counter) const;
+
 private:
     friend galileo_tow_map_sptr galileo_tow_map_make();
+    friend class GalileoTowMapTest;  // drives the message handler directly in the seqlock unit test
     galileo_tow_map();
 
     void msg_handler_galileo_tow_map(const pmt::pmt_t& msg);
 
-    std::map<uint32_t, std::pair<uint32_t, uint64_t>> d_galileo_tow;
+    // seqlock-protected entry: the message handler (single writer) bumps seq
+    // to an odd value while updating, readers retry until they observe the
+    // same even seq before and after reading the payload
+    struct Tow_Entry
+    {
+        std::atomic<uint32_t> seq{0};
+        std::atomic<uint32_t> tow_ms{std::numeric_limits<uint32_t>::max()};
+        std::atomic<uint64_t> sample_counter{std::numeric_limits<uint64_t>::max()};
+    };
+
+    std::array<Tow_Entry, 37> d_galileo_tow;
 };
 
 /** \} */
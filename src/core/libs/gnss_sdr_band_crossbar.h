@@ -0,0 +1,91 @@
+/*!
+ * \file gnss_sdr_band_crossbar.h
+ * \brief GNU Radio block that routes signal conditioner outputs to channel
+ * inputs through a runtime-retunable crossbar
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SDR_BAND_CROSSBAR_H
+#define GNSS_SDR_GNSS_SDR_BAND_CROSSBAR_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/sync_block.h>
+#include <gnuradio/types.h>  // for gr_vector_const_void_star
+#include <atomic>
+#include <cstddef>  // for size_t
+#include <cstdint>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver_Library
+ * \{ */
+
+
+class gnss_sdr_band_crossbar;
+
+using gnss_sdr_band_crossbar_sptr = gnss_shared_ptr<gnss_sdr_band_crossbar>;
+
+gnss_sdr_band_crossbar_sptr gnss_sdr_make_band_crossbar(
+    size_t sizeof_stream_item,
+    int32_t n_bands,
+    int32_t n_channels);
+
+/*!
+ * \brief GNU Radio block with one input per signal conditioner and one output
+ * per channel. Each output copies the samples of the conditioner it is
+ * currently routed to, so a channel can be moved to a different RF feed at
+ * runtime without tearing the flowgraph down.
+ *
+ * All inputs are consumed in lockstep, so sample k of every output
+ * corresponds to sample k of every input and a route change is
+ * sample-aligned: the output stream continues with the sample that follows
+ * the last one taken from the previous conditioner, with no gap or overlap.
+ */
+class gnss_sdr_band_crossbar : public gr::sync_block
+{
+public:
+    ~gnss_sdr_band_crossbar() = default;
+
+    //! Routes channel output ch to conditioner input band. Thread-safe; the
+    //! change takes effect at the next scheduler call of this block
+    bool set_route(int32_t ch, int32_t band);
+
+    //! Conditioner input currently feeding channel output ch
+    int32_t route(int32_t ch) const;
+
+    int work(int noutput_items,
+        gr_vector_const_void_star& input_items,
+        gr_vector_void_star& output_items);
+
+private:
+    friend gnss_sdr_band_crossbar_sptr gnss_sdr_make_band_crossbar(
+        size_t sizeof_stream_item,
+        int32_t n_bands,
+        int32_t n_channels);
+
+    gnss_sdr_band_crossbar(size_t sizeof_stream_item,
+        int32_t n_bands,
+        int32_t n_channels);
+
+    std::vector<std::atomic<int32_t>> d_routes;
+    size_t d_sizeof_stream_item;
+    int32_t d_n_bands;
+    int32_t d_n_channels;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SDR_BAND_CROSSBAR_H
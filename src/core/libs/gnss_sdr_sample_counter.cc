@@ -18,6 +18,7 @@
 #include "gnss_sdr_sample_counter.h"
 #include "gnss_synchro.h"
 #include "gnss_time.h"
+#include "latency_tracer.h"
 #include <gnuradio/io_signature.h>
 #include <pmt/pmt.h>        // for from_double
 #include <pmt/pmt_sugar.h>  // for mp
@@ -151,6 +152,12 @@ int gnss_sdr_sample_counter::work(int noutput_items __attribute__((unused)),
     out[0].Tracking_sample_counter = sample_counter;
     current_T_rx_ms += interval_ms;
 
+    // anchor the sample count to the wall clock for the latency tracer
+    if (Latency_Tracer::get_instance().enabled())
+        {
+            Latency_Tracer::get_instance().set_anchor(sample_counter, fs);
+        }
+
     // *************** time tags ****************
     std::vector<gr::tag_t> tags_vec;
     // notice that nitems_read is updated in decimation blocks after leaving work() with return 1, equivalent to call consume_each
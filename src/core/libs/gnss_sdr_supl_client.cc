@@ -20,17 +20,118 @@
 #include "gnss_sdr_supl_client.h"
 #include "GPS_L1_CA.h"
 #include "MATH_CONSTANTS.h"
+#include "gnss_sdr_filesystem.h"
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/archive/xml_iarchive.hpp>
 #include <boost/archive/xml_oarchive.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
 #include <boost/serialization/map.hpp>
 #include <glog/logging.h>
 #include <pugixml.hpp>
 #include <cmath>      // for pow
 #include <exception>  // for exception
+#include <fstream>    // for ofstream
 #include <iostream>   // for cerr
 #include <utility>    // for pair
 #include <vector>
 
+#include <fcntl.h>     // for open
+#include <sys/mman.h>  // for mmap
+#include <sys/stat.h>  // for fstat
+#include <unistd.h>    // for close
+
+namespace
+{
+const char BIN_CACHE_SUFFIX[] = ".bin";
+
+/*
+ * Loads an object previously stored by save_bin_cache(). Parsing the XML
+ * assistance files with the Boost XML archive every boot is slow; the binary
+ * sidecar cache is read through a memory mapping instead. The cache is only
+ * trusted when it is not older than the XML file it mirrors, and any problem
+ * reading it silently falls back to the XML path
+ */
+template <class T>
+bool load_bin_cache(const std::string& xml_file_name, const char* tag, T& obj)
+{
+    const std::string cache_file_name = xml_file_name + BIN_CACHE_SUFFIX;
+    try
+        {
+            errorlib::error_code ec;
+            if (!fs::exists(cache_file_name, ec))
+                {
+                    return false;
+                }
+            if (fs::exists(xml_file_name, ec) && fs::last_write_time(cache_file_name, ec) < fs::last_write_time(xml_file_name, ec))
+                {
+                    return false;
+                }
+        }
+    catch (...)
+        {
+            return false;
+        }
+
+    const int fd = open(cache_file_name.c_str(), O_RDONLY);
+    if (fd == -1)
+        {
+            return false;
+        }
+    struct stat sb
+    {
+    };
+    if (fstat(fd, &sb) != 0 || sb.st_size <= 0)
+        {
+            close(fd);
+            return false;
+        }
+    void* mapped = mmap(nullptr, static_cast<size_t>(sb.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED)
+        {
+            return false;
+        }
+    bool loaded = false;
+    try
+        {
+            boost::iostreams::stream<boost::iostreams::array_source> buffer(static_cast<const char*>(mapped), static_cast<size_t>(sb.st_size));
+            boost::archive::binary_iarchive ar(buffer);
+            ar >> boost::serialization::make_nvp(tag, obj);
+            loaded = true;
+        }
+    catch (const std::exception& e)
+        {
+            LOG(INFO) << "Assistance cache " << cache_file_name << " could not be read (" << e.what() << "), falling back to XML";
+        }
+    munmap(mapped, static_cast<size_t>(sb.st_size));
+    if (loaded)
+        {
+            LOG(INFO) << "Loaded assistance data from binary cache " << cache_file_name;
+        }
+    return loaded;
+}
+
+
+//! Writes the binary sidecar cache read back by load_bin_cache()
+template <class T>
+void save_bin_cache(const std::string& xml_file_name, const char* tag, const T& obj)
+{
+    const std::string cache_file_name = xml_file_name + BIN_CACHE_SUFFIX;
+    try
+        {
+            std::ofstream ofs(cache_file_name.c_str(), std::ofstream::trunc | std::ofstream::out | std::ofstream::binary);
+            boost::archive::binary_oarchive ar(ofs);
+            ar << boost::serialization::make_nvp(tag, obj);
+        }
+    catch (const std::exception& e)
+        {
+            LOG(WARNING) << "Could not write assistance cache " << cache_file_name << ": " << e.what();
+        }
+}
+}  // namespace
+
 Gnss_Sdr_Supl_Client::Gnss_Sdr_Supl_Client()
     : server_port(0), request(0), mcc(0), mns(0), lac(0), ci(0)
 {
@@ -359,6 +460,10 @@ void Gnss_Sdr_Supl_Client::read_supl_data()
 
 bool Gnss_Sdr_Supl_Client::load_ephemeris_xml(const std::string& file_name)
 {
+    if (load_bin_cache(file_name, "GNSS-SDR_ephemeris_map", gps_ephemeris_map))
+        {
+            return true;
+        }
     std::ifstream ifs;
     try
         {
@@ -373,6 +478,7 @@ bool Gnss_Sdr_Supl_Client::load_ephemeris_xml(const std::string& file_name)
             LOG(WARNING) << e.what() << "File: " << file_name;
             return false;
         }
+    save_bin_cache(file_name, "GNSS-SDR_ephemeris_map", gps_ephemeris_map);
     return true;
 }
 
@@ -406,6 +512,10 @@ bool Gnss_Sdr_Supl_Client::save_ephemeris_map_xml(const std::string& file_name,
 
 bool Gnss_Sdr_Supl_Client::load_gal_ephemeris_xml(const std::string& file_name)
 {
+    if (load_bin_cache(file_name, "GNSS-SDR_gal_ephemeris_map", gal_ephemeris_map))
+        {
+            return true;
+        }
     std::ifstream ifs;
     try
         {
@@ -425,6 +535,7 @@ bool Gnss_Sdr_Supl_Client::load_gal_ephemeris_xml(const std::string& file_name)
             LOG(WARNING) << e.what() << "File: " << file_name;
             return false;
         }
+    save_bin_cache(file_name, "GNSS-SDR_gal_ephemeris_map", gal_ephemeris_map);
     return true;
 }
 
@@ -458,6 +569,10 @@ bool Gnss_Sdr_Supl_Client::save_gal_ephemeris_map_xml(const std::string& file_na
 
 bool Gnss_Sdr_Supl_Client::load_cnav_ephemeris_xml(const std::string& file_name)
 {
+    if (load_bin_cache(file_name, "GNSS-SDR_cnav_ephemeris_map", gps_cnav_ephemeris_map))
+        {
+            return true;
+        }
     std::ifstream ifs;
     try
         {
@@ -472,6 +587,7 @@ bool Gnss_Sdr_Supl_Client::load_cnav_ephemeris_xml(const std::string& file_name)
             LOG(WARNING) << e.what() << "File: " << file_name;
             return false;
         }
+    save_bin_cache(file_name, "GNSS-SDR_cnav_ephemeris_map", gps_cnav_ephemeris_map);
     return true;
 }
 
@@ -505,6 +621,10 @@ bool Gnss_Sdr_Supl_Client::save_cnav_ephemeris_map_xml(const std::string& file_n
 
 bool Gnss_Sdr_Supl_Client::load_gnav_ephemeris_xml(const std::string& file_name)
 {
+    if (load_bin_cache(file_name, "GNSS-SDR_gnav_ephemeris_map", glonass_gnav_ephemeris_map))
+        {
+            return true;
+        }
     std::ifstream ifs;
     try
         {
@@ -519,6 +639,7 @@ bool Gnss_Sdr_Supl_Client::load_gnav_ephemeris_xml(const std::string& file_name)
             LOG(WARNING) << e.what() << "File: " << file_name;
             return false;
         }
+    save_bin_cache(file_name, "GNSS-SDR_gnav_ephemeris_map", glonass_gnav_ephemeris_map);
     return true;
 }
 
@@ -552,6 +673,10 @@ bool Gnss_Sdr_Supl_Client::save_gnav_ephemeris_map_xml(const std::string& file_n
 
 bool Gnss_Sdr_Supl_Client::load_utc_xml(const std::string& file_name)
 {
+    if (load_bin_cache(file_name, "GNSS-SDR_utc_model", gps_utc))
+        {
+            return true;
+        }
     std::ifstream ifs;
     try
         {
@@ -565,6 +690,7 @@ bool Gnss_Sdr_Supl_Client::load_utc_xml(const std::string& file_name)
             LOG(WARNING) << e.what() << "File: " << file_name;
             return false;
         }
+    save_bin_cache(file_name, "GNSS-SDR_utc_model", gps_utc);
     return true;
 }
 
@@ -598,6 +724,10 @@ bool Gnss_Sdr_Supl_Client::save_utc_xml(const std::string& file_name, Gps_Utc_Mo
 
 bool Gnss_Sdr_Supl_Client::load_cnav_utc_xml(const std::string& file_name)
 {
+    if (load_bin_cache(file_name, "GNSS-SDR_cnav_utc_model", gps_cnav_utc))
+        {
+            return true;
+        }
     std::ifstream ifs;
     try
         {
@@ -611,6 +741,7 @@ bool Gnss_Sdr_Supl_Client::load_cnav_utc_xml(const std::string& file_name)
             LOG(WARNING) << e.what() << "File: " << file_name;
             return false;
         }
+    save_bin_cache(file_name, "GNSS-SDR_cnav_utc_model", gps_cnav_utc);
     return true;
 }
 
@@ -644,6 +775,10 @@ bool Gnss_Sdr_Supl_Client::save_cnav_utc_xml(const std::string& file_name, Gps_C
 
 bool Gnss_Sdr_Supl_Client::load_gal_utc_xml(const std::string& file_name)
 {
+    if (load_bin_cache(file_name, "GNSS-SDR_gal_utc_model", gal_utc))
+        {
+            return true;
+        }
     std::ifstream ifs;
     try
         {
@@ -657,6 +792,7 @@ bool Gnss_Sdr_Supl_Client::load_gal_utc_xml(const std::string& file_name)
             LOG(WARNING) << e.what() << "File: " << file_name;
             return false;
         }
+    save_bin_cache(file_name, "GNSS-SDR_gal_utc_model", gal_utc);
     return true;
 }
 
@@ -690,6 +826,10 @@ bool Gnss_Sdr_Supl_Client::save_gal_utc_xml(const std::string& file_name, Galile
 
 bool Gnss_Sdr_Supl_Client::load_iono_xml(const std::string& file_name)
 {
+    if (load_bin_cache(file_name, "GNSS-SDR_iono_model", gps_iono))
+        {
+            return true;
+        }
     std::ifstream ifs;
     try
         {
@@ -703,6 +843,7 @@ bool Gnss_Sdr_Supl_Client::load_iono_xml(const std::string& file_name)
             LOG(WARNING) << e.what() << "File: " << file_name;
             return false;
         }
+    save_bin_cache(file_name, "GNSS-SDR_iono_model", gps_iono);
     return true;
 }
 
@@ -736,6 +877,10 @@ bool Gnss_Sdr_Supl_Client::save_iono_xml(const std::string& file_name, Gps_Iono&
 
 bool Gnss_Sdr_Supl_Client::load_gal_iono_xml(const std::string& file_name)
 {
+    if (load_bin_cache(file_name, "GNSS-SDR_gal_iono_model", gal_iono))
+        {
+            return true;
+        }
     std::ifstream ifs;
     try
         {
@@ -749,6 +894,7 @@ bool Gnss_Sdr_Supl_Client::load_gal_iono_xml(const std::string& file_name)
             LOG(WARNING) << e.what() << "File: " << file_name;
             return false;
         }
+    save_bin_cache(file_name, "GNSS-SDR_gal_iono_model", gal_iono);
     return true;
 }
 
@@ -782,6 +928,10 @@ bool Gnss_Sdr_Supl_Client::save_gal_iono_xml(const std::string& file_name, Galil
 
 bool Gnss_Sdr_Supl_Client::load_gps_almanac_xml(const std::string& file_name)
 {
+    if (load_bin_cache(file_name, "GNSS-SDR_gps_almanac_map", gps_almanac_map))
+        {
+            return true;
+        }
     std::ifstream ifs;
     try
         {
@@ -796,6 +946,7 @@ bool Gnss_Sdr_Supl_Client::load_gps_almanac_xml(const std::string& file_name)
             LOG(WARNING) << e.what() << "File: " << file_name;
             return false;
         }
+    save_bin_cache(file_name, "GNSS-SDR_gps_almanac_map", gps_almanac_map);
     return true;
 }
 
@@ -829,6 +980,10 @@ bool Gnss_Sdr_Supl_Client::save_gps_almanac_xml(const std::string& file_name, st
 
 bool Gnss_Sdr_Supl_Client::load_gal_almanac_xml(const std::string& file_name)
 {
+    if (load_bin_cache(file_name, "GNSS-SDR_gal_almanac_map", gal_almanac_map))
+        {
+            return true;
+        }
     std::ifstream ifs;
     try
         {
@@ -843,6 +998,7 @@ bool Gnss_Sdr_Supl_Client::load_gal_almanac_xml(const std::string& file_name)
             return this->read_gal_almanac_from_gsa(file_name);
         }
     LOG(INFO) << "Loaded Galileo almanac map data with " << this->gal_almanac_map.size() << " satellites";
+    save_bin_cache(file_name, "GNSS-SDR_gal_almanac_map", gal_almanac_map);
     return true;
 }
 
@@ -894,6 +1050,7 @@ bool Gnss_Sdr_Supl_Client::read_gal_almanac_from_gsa(const std::string& file_nam
         {
             return false;
         }
+    save_bin_cache(file_name, "GNSS-SDR_gal_almanac_map", gal_almanac_map);
     return true;
 }
 
@@ -927,6 +1084,10 @@ bool Gnss_Sdr_Supl_Client::save_gal_almanac_xml(const std::string& file_name, st
 
 bool Gnss_Sdr_Supl_Client::load_glo_utc_xml(const std::string& file_name)
 {
+    if (load_bin_cache(file_name, "GNSS-SDR_glo_utc_model", glo_gnav_utc))
+        {
+            return true;
+        }
     std::ifstream ifs;
     try
         {
@@ -940,6 +1101,7 @@ bool Gnss_Sdr_Supl_Client::load_glo_utc_xml(const std::string& file_name)
             LOG(WARNING) << e.what() << "File: " << file_name;
             return false;
         }
+    save_bin_cache(file_name, "GNSS-SDR_glo_utc_model", glo_gnav_utc);
     return true;
 }
 
@@ -973,6 +1135,10 @@ bool Gnss_Sdr_Supl_Client::save_glo_utc_xml(const std::string& file_name, Glonas
 
 bool Gnss_Sdr_Supl_Client::load_ref_time_xml(const std::string& file_name)
 {
+    if (load_bin_cache(file_name, "GNSS-SDR_ref_time", gps_time))
+        {
+            return true;
+        }
     std::ifstream ifs;
     try
         {
@@ -986,6 +1152,7 @@ bool Gnss_Sdr_Supl_Client::load_ref_time_xml(const std::string& file_name)
             LOG(WARNING) << e.what() << "File: " << file_name;
             return false;
         }
+    save_bin_cache(file_name, "GNSS-SDR_ref_time", gps_time);
     return true;
 }
 
@@ -1019,6 +1186,10 @@ bool Gnss_Sdr_Supl_Client::save_ref_time_xml(const std::string& file_name, Agnss
 
 bool Gnss_Sdr_Supl_Client::load_ref_location_xml(const std::string& file_name)
 {
+    if (load_bin_cache(file_name, "GNSS-SDR_ref_location", gps_ref_loc))
+        {
+            return true;
+        }
     std::ifstream ifs;
     try
         {
@@ -1032,6 +1203,7 @@ bool Gnss_Sdr_Supl_Client::load_ref_location_xml(const std::string& file_name)
             LOG(WARNING) << e.what() << "File: " << file_name;
             return false;
         }
+    save_bin_cache(file_name, "GNSS-SDR_ref_location", gps_ref_loc);
     return true;
 }
 
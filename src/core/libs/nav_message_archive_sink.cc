@@ -0,0 +1,272 @@
+/*!
+ * \file nav_message_archive_sink.cc
+ * \brief Implementation of a class that archives Nav_Message_Packet objects
+ * into a columnar, indexed on-disk file for offline analytics.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "nav_message_archive_sink.h"
+#include <glog/logging.h>
+#include <algorithm>
+#include <tuple>
+
+namespace
+{
+const char GNMA_MAGIC[4] = {'G', 'N', 'M', 'A'};
+const uint8_t GNMA_VERSION = 1;
+}  // namespace
+
+
+Nav_Message_Archive_Sink::Nav_Message_Archive_Sink(const std::string& file_name, uint32_t rows_per_batch)
+    : rows_per_batch_(std::max(rows_per_batch, 1U))
+{
+    file_.open(file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file_.is_open())
+        {
+            LOG(WARNING) << "Error opening navigation message archive file " << file_name;
+            return;
+        }
+    file_.write(GNMA_MAGIC, sizeof(GNMA_MAGIC));
+    file_.put(static_cast<char>(GNMA_VERSION));
+    bytes_written_ = sizeof(GNMA_MAGIC) + 1;
+    buffer_.reserve(rows_per_batch_);
+    healthy_ = true;
+    DLOG(INFO) << "Navigation message archive file " << file_name << " opened, "
+               << rows_per_batch_ << " rows per batch";
+}
+
+
+Nav_Message_Archive_Sink::~Nav_Message_Archive_Sink()
+{
+    try
+        {
+            if (healthy_)
+                {
+                    flush_batch();
+                    write_footer();
+                }
+            if (file_.is_open())
+                {
+                    file_.close();
+                }
+        }
+    catch (const std::exception& e)
+        {
+            LOG(WARNING) << "Problem closing navigation message archive: " << e.what();
+        }
+    catch (...)
+        {
+            LOG(WARNING) << "Problem closing navigation message archive";
+        }
+}
+
+
+bool Nav_Message_Archive_Sink::archive_nav_message(const std::shared_ptr<Nav_Message_Packet>& nav_msg_packet)
+{
+    if (!healthy_)
+        {
+            return false;
+        }
+    buffer_.push_back(*nav_msg_packet);
+    if (buffer_.size() >= rows_per_batch_)
+        {
+            flush_batch();
+        }
+    return healthy_;
+}
+
+
+/*
+ * Batch encoding, all integers little-endian:
+ *   u32 payload size (bytes following this field)
+ *   u32 number of rows
+ *   u16 number of (system, signal, PRN) groups
+ *   per group:
+ *     u8  system length, system bytes
+ *     u8  signal length, signal bytes
+ *     varint PRN
+ *     varint number of rows in the group
+ *     varint first TOW (ms), then per remaining row a zigzag varint TOW delta
+ *     per row: varint number of navigation bits, then the '0'/'1' string
+ *              packed MSB-first into ceil(bits / 8) bytes
+ */
+void Nav_Message_Archive_Sink::flush_batch()
+{
+    if (buffer_.empty())
+        {
+            return;
+        }
+
+    // group rows by (system, signal, PRN) so each column group is contiguous
+    std::stable_sort(buffer_.begin(), buffer_.end(),
+        [](const Nav_Message_Packet& a, const Nav_Message_Packet& b) {
+            return std::tie(a.system, a.signal, a.prn) < std::tie(b.system, b.signal, b.prn);
+        });
+
+    std::vector<uint8_t> payload;
+    payload.reserve(buffer_.size() * 48);
+    append_u32(payload, static_cast<uint32_t>(buffer_.size()));
+
+    const size_t num_groups_pos = payload.size();
+    append_u16(payload, 0);  // patched below
+    uint16_t num_groups = 0;
+
+    int32_t min_tow = buffer_.front().tow_at_current_symbol_ms;
+    int32_t max_tow = min_tow;
+
+    size_t row = 0;
+    while (row < buffer_.size())
+        {
+            size_t group_end = row + 1;
+            while (group_end < buffer_.size() &&
+                   buffer_[group_end].system == buffer_[row].system &&
+                   buffer_[group_end].signal == buffer_[row].signal &&
+                   buffer_[group_end].prn == buffer_[row].prn)
+                {
+                    group_end++;
+                }
+
+            const Nav_Message_Packet& head = buffer_[row];
+            payload.push_back(static_cast<uint8_t>(head.system.size()));
+            payload.insert(payload.end(), head.system.begin(), head.system.end());
+            payload.push_back(static_cast<uint8_t>(head.signal.size()));
+            payload.insert(payload.end(), head.signal.begin(), head.signal.end());
+            append_varint(payload, static_cast<uint64_t>(head.prn));
+            append_varint(payload, group_end - row);
+
+            // TOW column: first value, then zigzag-encoded deltas
+            append_varint(payload, static_cast<uint64_t>(head.tow_at_current_symbol_ms));
+            for (size_t k = row + 1; k < group_end; k++)
+                {
+                    const int64_t delta = static_cast<int64_t>(buffer_[k].tow_at_current_symbol_ms) -
+                                          static_cast<int64_t>(buffer_[k - 1].tow_at_current_symbol_ms);
+                    append_varint(payload, zigzag_encode(delta));
+                }
+
+            // navigation message column: bit-packed pages
+            for (size_t k = row; k < group_end; k++)
+                {
+                    const std::string& bits = buffer_[k].nav_message;
+                    append_varint(payload, bits.size());
+                    uint8_t byte = 0;
+                    for (size_t bit = 0; bit < bits.size(); bit++)
+                        {
+                            byte = static_cast<uint8_t>((byte << 1) | (bits[bit] == '1' ? 1U : 0U));
+                            if ((bit % 8) == 7)
+                                {
+                                    payload.push_back(byte);
+                                    byte = 0;
+                                }
+                        }
+                    if ((bits.size() % 8) != 0)
+                        {
+                            payload.push_back(static_cast<uint8_t>(byte << (8 - bits.size() % 8)));
+                        }
+                    min_tow = std::min(min_tow, buffer_[k].tow_at_current_symbol_ms);
+                    max_tow = std::max(max_tow, buffer_[k].tow_at_current_symbol_ms);
+                }
+
+            num_groups++;
+            row = group_end;
+        }
+
+    payload[num_groups_pos] = static_cast<uint8_t>(num_groups & 0xFF);
+    payload[num_groups_pos + 1] = static_cast<uint8_t>(num_groups >> 8);
+
+    std::vector<uint8_t> header;
+    append_u32(header, static_cast<uint32_t>(payload.size()));
+    file_.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    file_.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+    if (!file_.good())
+        {
+            LOG(WARNING) << "Error writing navigation message archive batch";
+            healthy_ = false;
+            buffer_.clear();
+            return;
+        }
+
+    index_.push_back({bytes_written_, static_cast<uint32_t>(buffer_.size()), min_tow, max_tow});
+    bytes_written_ += header.size() + payload.size();
+    buffer_.clear();
+}
+
+
+/*
+ * Footer encoding:
+ *   u32 number of batches
+ *   per batch: u64 offset, u32 rows, u32 min TOW (ms), u32 max TOW (ms)
+ *   u64 footer offset
+ *   "GNMA"
+ */
+void Nav_Message_Archive_Sink::write_footer()
+{
+    const uint64_t footer_offset = bytes_written_;
+    std::vector<uint8_t> footer;
+    append_u32(footer, static_cast<uint32_t>(index_.size()));
+    for (const auto& entry : index_)
+        {
+            append_u64(footer, entry.offset);
+            append_u32(footer, entry.num_rows);
+            append_u32(footer, static_cast<uint32_t>(entry.min_tow_ms));
+            append_u32(footer, static_cast<uint32_t>(entry.max_tow_ms));
+        }
+    append_u64(footer, footer_offset);
+    file_.write(reinterpret_cast<const char*>(footer.data()), static_cast<std::streamsize>(footer.size()));
+    file_.write(GNMA_MAGIC, sizeof(GNMA_MAGIC));
+    if (!file_.good())
+        {
+            LOG(WARNING) << "Error writing navigation message archive footer";
+        }
+}
+
+
+void Nav_Message_Archive_Sink::append_u16(std::vector<uint8_t>& buffer, uint16_t value)
+{
+    buffer.push_back(static_cast<uint8_t>(value & 0xFF));
+    buffer.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+
+void Nav_Message_Archive_Sink::append_u32(std::vector<uint8_t>& buffer, uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+        {
+            buffer.push_back(static_cast<uint8_t>((value >> (8 * i)) & 0xFF));
+        }
+}
+
+
+void Nav_Message_Archive_Sink::append_u64(std::vector<uint8_t>& buffer, uint64_t value)
+{
+    for (int i = 0; i < 8; i++)
+        {
+            buffer.push_back(static_cast<uint8_t>((value >> (8 * i)) & 0xFF));
+        }
+}
+
+
+void Nav_Message_Archive_Sink::append_varint(std::vector<uint8_t>& buffer, uint64_t value)
+{
+    while (value >= 0x80)
+        {
+            buffer.push_back(static_cast<uint8_t>(value) | 0x80);
+            value >>= 7;
+        }
+    buffer.push_back(static_cast<uint8_t>(value));
+}
+
+
+uint64_t Nav_Message_Archive_Sink::zigzag_encode(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
@@ -0,0 +1,96 @@
+/*!
+ * \file nav_message_archive_sink.h
+ * \brief Interface of a class that archives Nav_Message_Packet objects into a
+ * columnar, indexed on-disk file for offline analytics.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_NAV_MESSAGE_ARCHIVE_SINK_H
+#define GNSS_SDR_NAV_MESSAGE_ARCHIVE_SINK_H
+
+#include "nav_message_packet.h"
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver_Library
+ * \{ */
+
+/*!
+ * \brief This class batches Nav_Message_Packet objects and writes them to a
+ * compact columnar file ("GNMA" format) suitable for long-running archival
+ * and fast offline queries.
+ *
+ * Packets are buffered in memory and flushed as row batches. Within each
+ * batch the rows are grouped by (system, signal, PRN), so a consumer can
+ * skip whole column groups it is not interested in; the TOW column is
+ * delta-encoded (zigzag varint) and the navigation page, a string of '0'/'1'
+ * characters, is packed to bits, giving roughly an 8x size reduction without
+ * any external compression dependency. A footer indexes every batch with its
+ * file offset, row count and TOW range, so a reader can locate the batches
+ * overlapping a time window without scanning the file.
+ *
+ * File layout:
+ *   "GNMA" <u8 version>
+ *   batch*            (see flush_batch() for the batch encoding)
+ *   footer            (per-batch index entries)
+ *   <u64 footer offset> "GNMA"
+ */
+class Nav_Message_Archive_Sink
+{
+public:
+    //! Opens the archive file; rows_per_batch controls the flush granularity
+    explicit Nav_Message_Archive_Sink(const std::string& file_name, uint32_t rows_per_batch = 1024);
+
+    //! Flushes any pending rows and writes the batch index footer
+    ~Nav_Message_Archive_Sink();
+
+    Nav_Message_Archive_Sink(const Nav_Message_Archive_Sink&) = delete;
+    Nav_Message_Archive_Sink& operator=(const Nav_Message_Archive_Sink&) = delete;
+
+    //! Buffers a packet; triggers a batch flush when the buffer is full
+    bool archive_nav_message(const std::shared_ptr<Nav_Message_Packet>& nav_msg_packet);
+
+private:
+    struct Batch_Index_Entry
+    {
+        uint64_t offset;
+        uint32_t num_rows;
+        int32_t min_tow_ms;
+        int32_t max_tow_ms;
+    };
+
+    void flush_batch();
+    void write_footer();
+    static void append_u16(std::vector<uint8_t>& buffer, uint16_t value);
+    static void append_u32(std::vector<uint8_t>& buffer, uint32_t value);
+    static void append_u64(std::vector<uint8_t>& buffer, uint64_t value);
+    static void append_varint(std::vector<uint8_t>& buffer, uint64_t value);
+    static uint64_t zigzag_encode(int64_t value);
+
+    std::ofstream file_;
+    std::vector<Nav_Message_Packet> buffer_;
+    std::vector<Batch_Index_Entry> index_;
+    uint64_t bytes_written_ = 0;
+    uint32_t rows_per_batch_;
+    bool healthy_ = false;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_NAV_MESSAGE_ARCHIVE_SINK_H
@@ -35,13 +35,13 @@ namespace wht = boost;
 namespace wht = std;
 #endif
 
-nav_message_monitor_sptr nav_message_monitor_make(const std::vector<std::string>& addresses, uint16_t port)
+nav_message_monitor_sptr nav_message_monitor_make(const std::vector<std::string>& addresses, uint16_t port, const std::string& archive_filename)
 {
-    return nav_message_monitor_sptr(new nav_message_monitor(addresses, port));
+    return nav_message_monitor_sptr(new nav_message_monitor(addresses, port, archive_filename));
 }
 
 
-nav_message_monitor::nav_message_monitor(const std::vector<std::string>& addresses, uint16_t port) : gr::block("nav_message_monitor", gr::io_signature::make(0, 0, 0), gr::io_signature::make(0, 0, 0))
+nav_message_monitor::nav_message_monitor(const std::vector<std::string>& addresses, uint16_t port, const std::string& archive_filename) : gr::block("nav_message_monitor", gr::io_signature::make(0, 0, 0), gr::io_signature::make(0, 0, 0))
 {
     // register Nav_msg_from_TLM input message port from telemetry blocks
     this->message_port_register_in(pmt::mp("Nav_msg_from_TLM"));
@@ -56,6 +56,10 @@ nav_message_monitor::nav_message_monitor(const std::vector<std::string>& address
 #endif
 #endif
     nav_message_udp_sink_ = std::make_unique<Nav_Message_Udp_Sink>(addresses, port);
+    if (!archive_filename.empty())
+        {
+            nav_message_archive_sink_ = std::make_unique<Nav_Message_Archive_Sink>(archive_filename);
+        }
 }
 
 
@@ -70,6 +74,10 @@ void nav_message_monitor::msg_handler_nav_message(const pmt::pmt_t& msg)
                 {
                     const auto nav_message_packet = wht::any_cast<std::shared_ptr<Nav_Message_Packet>>(pmt::any_ref(msg));
                     nav_message_udp_sink_->write_nav_message(nav_message_packet);
+                    if (nav_message_archive_sink_)
+                        {
+                            nav_message_archive_sink_->archive_nav_message(nav_message_packet);
+                        }
                 }
             else
                 {
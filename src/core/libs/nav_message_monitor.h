@@ -19,6 +19,7 @@
 #define GNSS_SDR_NAV_MESSAGE_MONITOR_H
 
 #include "gnss_block_interface.h"
+#include "nav_message_archive_sink.h"
 #include "nav_message_udp_sink.h"
 #include <gnuradio/block.h>
 #include <pmt/pmt.h>
@@ -36,11 +37,12 @@ class nav_message_monitor;
 
 using nav_message_monitor_sptr = gnss_shared_ptr<nav_message_monitor>;
 
-nav_message_monitor_sptr nav_message_monitor_make(const std::vector<std::string>& addresses, uint16_t port);
+nav_message_monitor_sptr nav_message_monitor_make(const std::vector<std::string>& addresses, uint16_t port, const std::string& archive_filename = std::string());
 
 /*!
  * \brief GNU Radio block that receives asynchronous Nav_Message_Packet obkects
- * from the telemetry blocks and sends them via UDP
+ * from the telemetry blocks, sends them via UDP, and optionally archives them
+ * to a columnar file
  */
 class nav_message_monitor : public gr::block
 {
@@ -48,10 +50,11 @@ public:
     ~nav_message_monitor() = default;  //!< Default destructor
 
 private:
-    friend nav_message_monitor_sptr nav_message_monitor_make(const std::vector<std::string>& addresses, uint16_t port);
-    nav_message_monitor(const std::vector<std::string>& addresses, uint16_t port);
+    friend nav_message_monitor_sptr nav_message_monitor_make(const std::vector<std::string>& addresses, uint16_t port, const std::string& archive_filename);
+    nav_message_monitor(const std::vector<std::string>& addresses, uint16_t port, const std::string& archive_filename);
     void msg_handler_nav_message(const pmt::pmt_t& msg);
     std::unique_ptr<Nav_Message_Udp_Sink> nav_message_udp_sink_;
+    std::unique_ptr<Nav_Message_Archive_Sink> nav_message_archive_sink_;
 };
 
 
@@ -38,6 +38,8 @@ bool Nav_Message_Udp_Sink::write_nav_message(const std::shared_ptr<Nav_Message_P
     for (const auto& endpoint : endpoints)
         {
             socket.open(endpoint.protocol(), error);
+            // never block the telemetry path on a slow or dead subscriber
+            socket.non_blocking(true, error);
             socket.connect(endpoint, error);
 
             try
@@ -0,0 +1,90 @@
+/*!
+ * \file startup_profiler.h
+ * \brief Interface of a process-wide timer of the receiver startup phases
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_STARTUP_PROFILER_H
+#define GNSS_SDR_STARTUP_PROFILER_H
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver_Library
+ * \{ */
+
+
+/*!
+ * \brief Process-wide collector of startup phase timings.
+ *
+ * Phases are recorded with Scoped_Startup_Timer instances placed around the
+ * cold-boot stages (block construction, flowgraph connection, assistance
+ * retrieval, flowgraph start). Once the receiver is up, write_report() dumps
+ * a machine-readable CSV (phase, start offset, duration) into --log_dir so
+ * field units can report where their time-to-first-fix budget goes.
+ */
+class Startup_Profiler
+{
+public:
+    static Startup_Profiler& get_instance();
+
+    //! Records a completed phase. Offsets are relative to program load
+    void record_phase(const std::string& phase_name,
+        const std::chrono::steady_clock::time_point& start,
+        const std::chrono::steady_clock::time_point& end);
+
+    //! Writes gnss_sdr_startup_profile.csv into --log_dir (or the current
+    //! directory if --log_dir is empty) and logs a per-phase summary
+    void write_report();
+
+private:
+    Startup_Profiler() = default;
+
+    struct Phase_Record
+    {
+        std::string name;
+        double start_ms;
+        double duration_ms;
+    };
+
+    std::vector<Phase_Record> phases_;
+    std::mutex mutex_;
+    bool report_written_ = false;
+};
+
+
+/*!
+ * \brief Measures the lifetime of a scope and records it as a startup phase.
+ */
+class Scoped_Startup_Timer
+{
+public:
+    explicit Scoped_Startup_Timer(std::string phase_name);
+    ~Scoped_Startup_Timer();
+
+    Scoped_Startup_Timer(const Scoped_Startup_Timer&) = delete;
+    Scoped_Startup_Timer& operator=(const Scoped_Startup_Timer&) = delete;
+
+private:
+    std::string phase_name_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_STARTUP_PROFILER_H
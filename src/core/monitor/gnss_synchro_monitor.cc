@@ -28,13 +28,19 @@ gnss_synchro_monitor_sptr gnss_synchro_make_monitor(int n_channels,
     int decimation_factor,
     int udp_port,
     const std::vector<std::string>& udp_addresses,
-    bool enable_protobuf)
+    bool enable_protobuf,
+    const std::string& shm_zone,
+    int shm_capacity,
+    bool enable_delta_compression)
 {
     return gnss_synchro_monitor_sptr(new gnss_synchro_monitor(n_channels,
         decimation_factor,
         udp_port,
         udp_addresses,
-        enable_protobuf));
+        enable_protobuf,
+        shm_zone,
+        shm_capacity,
+        enable_delta_compression));
 }
 
 
@@ -42,14 +48,24 @@ gnss_synchro_monitor::gnss_synchro_monitor(int n_channels,
     int decimation_factor,
     int udp_port,
     const std::vector<std::string>& udp_addresses,
-    bool enable_protobuf)
+    bool enable_protobuf,
+    const std::string& shm_zone,
+    int shm_capacity,
+    bool enable_delta_compression)
     : gr::block("gnss_synchro_monitor",
           gr::io_signature::make(n_channels, n_channels, sizeof(Gnss_Synchro)),
           gr::io_signature::make(0, 0, 0)),
       d_nchannels(n_channels),
       d_decimation_factor(decimation_factor)
 {
-    udp_sink_ptr = std::make_unique<Gnss_Synchro_Udp_Sink>(udp_addresses, udp_port, enable_protobuf);
+    if (!shm_zone.empty())
+        {
+            shm_sink_ptr = std::make_unique<Gnss_Synchro_Shm_Sink>(shm_zone, static_cast<uint32_t>(shm_capacity));
+        }
+    else
+        {
+            udp_sink_ptr = std::make_unique<Gnss_Synchro_Udp_Sink>(udp_addresses, udp_port, enable_protobuf, enable_delta_compression);
+        }
 }
 
 
@@ -80,10 +96,17 @@ int gnss_synchro_monitor::general_work(int noutput_items __attribute__((unused))
                     count++;
                     if (count >= d_decimation_factor)
                         {
-                            // Convert to a vector and write to the UDP sink
+                            // Convert to a vector and write to the configured sink
                             std::vector<Gnss_Synchro> stocks;
                             stocks.push_back(in[channel_index][item_index]);
-                            udp_sink_ptr->write_gnss_synchro(stocks);
+                            if (shm_sink_ptr)
+                                {
+                                    shm_sink_ptr->write_gnss_synchro(stocks);
+                                }
+                            else
+                                {
+                                    udp_sink_ptr->write_gnss_synchro(stocks);
+                                }
                             // Reset count variable
                             count = 0;
                             // Consume the number of items for the input stream channel
@@ -21,6 +21,7 @@
 #define GNSS_SDR_GNSS_SYNCHRO_MONITOR_H
 
 #include "gnss_block_interface.h"
+#include "gnss_synchro_shm_sink.h"
 #include "gnss_synchro_udp_sink.h"
 #include <gnuradio/block.h>
 #include <gnuradio/runtime_types.h>  // for gr_vector_void_star
@@ -43,12 +44,16 @@ gnss_synchro_monitor_sptr gnss_synchro_make_monitor(int n_channels,
     int decimation_factor,
     int udp_port,
     const std::vector<std::string>& udp_addresses,
-    bool enable_protobuf);
+    bool enable_protobuf,
+    const std::string& shm_zone = std::string(),
+    int shm_capacity = 1024,
+    bool enable_delta_compression = false);
 
 /*!
  * \brief This class implements a monitoring block which allows sending
  * a data stream with the receiver internal parameters (Gnss_Synchro objects)
- * to local or remote clients over UDP.
+ * to local or remote clients over UDP, or publishing it into a same-host
+ * shared-memory ring when a shared-memory zone name is given.
  */
 class gnss_synchro_monitor : public gr::block
 {
@@ -63,17 +68,24 @@ private:
         int decimation_factor,
         int udp_port,
         const std::vector<std::string>& udp_addresses,
-        bool enable_protobuf);
+        bool enable_protobuf,
+        const std::string& shm_zone,
+        int shm_capacity,
+        bool enable_delta_compression);
 
     gnss_synchro_monitor(int n_channels,
         int decimation_factor,
         int udp_port,
         const std::vector<std::string>& udp_addresses,
-        bool enable_protobuf);
+        bool enable_protobuf,
+        const std::string& shm_zone,
+        int shm_capacity,
+        bool enable_delta_compression);
 
     int d_nchannels;
     int d_decimation_factor;
     std::unique_ptr<Gnss_Synchro_Udp_Sink> udp_sink_ptr;
+    std::unique_ptr<Gnss_Synchro_Shm_Sink> shm_sink_ptr;
 };
 
 
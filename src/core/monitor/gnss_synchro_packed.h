@@ -0,0 +1,145 @@
+/*!
+ * \file gnss_synchro_packed.h
+ * \brief Packed wire layout for Gnss_Synchro objects
+ *
+ * Fixed-size, byte-packed image of the Gnss_Synchro fields sent to the
+ * monitor consumers. Serializing an epoch is a plain field copy per channel
+ * into a flat buffer, with no archive or message-building machinery, so the
+ * monitor path stays cheap at high observable rates. Multi-byte fields use
+ * the host byte order (little-endian on all supported platforms).
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SYNCHRO_PACKED_H
+#define GNSS_SDR_GNSS_SYNCHRO_PACKED_H
+
+#include "gnss_synchro.h"
+#include <cstdint>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Gnss_Synchro_Monitor
+ * \{ */
+
+
+#pragma pack(push, 1)
+
+/*!
+ * \brief Packed POD image of a Gnss_Synchro object.
+ *
+ * The field order (widest first) matches the natural alignment of the
+ * members, so the packed layout carries no hidden padding and the offsets
+ * are stable across compilers.
+ */
+struct Gnss_Synchro_Packed
+{
+    double acq_delay_samples;
+    double acq_doppler_hz;
+    uint64_t acq_samplestamp_samples;
+    int64_t fs;
+    double prompt_i;
+    double prompt_q;
+    double cn0_db_hz;
+    double carrier_doppler_hz;
+    double carrier_phase_rads;
+    double code_phase_samples;
+    uint64_t tracking_sample_counter;
+    double pseudorange_m;
+    double rx_time;
+    double interp_tow_ms;
+    uint32_t prn;
+    int32_t channel_id;
+    uint32_t acq_doppler_step;
+    int32_t correlation_length_ms;
+    uint32_t tow_at_current_symbol_ms;
+    char system;
+    char signal[2];
+    uint8_t flag_valid_acquisition;
+    uint8_t flag_valid_symbol_output;
+    uint8_t flag_valid_word;
+    uint8_t flag_valid_pseudorange;
+    uint8_t flag_pll_180_deg_phase_locked;
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(Gnss_Synchro_Packed) == 140, "unexpected padding in Gnss_Synchro_Packed");
+
+
+inline void pack_gnss_synchro(const Gnss_Synchro& gs, Gnss_Synchro_Packed& packed)
+{
+    packed.acq_delay_samples = gs.Acq_delay_samples;
+    packed.acq_doppler_hz = gs.Acq_doppler_hz;
+    packed.acq_samplestamp_samples = gs.Acq_samplestamp_samples;
+    packed.fs = gs.fs;
+    packed.prompt_i = gs.Prompt_I;
+    packed.prompt_q = gs.Prompt_Q;
+    packed.cn0_db_hz = gs.CN0_dB_hz;
+    packed.carrier_doppler_hz = gs.Carrier_Doppler_hz;
+    packed.carrier_phase_rads = gs.Carrier_phase_rads;
+    packed.code_phase_samples = gs.Code_phase_samples;
+    packed.tracking_sample_counter = gs.Tracking_sample_counter;
+    packed.pseudorange_m = gs.Pseudorange_m;
+    packed.rx_time = gs.RX_time;
+    packed.interp_tow_ms = gs.interp_TOW_ms;
+    packed.prn = gs.PRN;
+    packed.channel_id = gs.Channel_ID;
+    packed.acq_doppler_step = gs.Acq_doppler_step;
+    packed.correlation_length_ms = gs.correlation_length_ms;
+    packed.tow_at_current_symbol_ms = gs.TOW_at_current_symbol_ms;
+    packed.system = gs.System;
+    packed.signal[0] = gs.Signal[0];
+    packed.signal[1] = gs.Signal[1];
+    packed.flag_valid_acquisition = static_cast<uint8_t>(gs.Flag_valid_acquisition);
+    packed.flag_valid_symbol_output = static_cast<uint8_t>(gs.Flag_valid_symbol_output);
+    packed.flag_valid_word = static_cast<uint8_t>(gs.Flag_valid_word);
+    packed.flag_valid_pseudorange = static_cast<uint8_t>(gs.Flag_valid_pseudorange);
+    packed.flag_pll_180_deg_phase_locked = static_cast<uint8_t>(gs.Flag_PLL_180_deg_phase_locked);
+}
+
+
+inline void unpack_gnss_synchro(const Gnss_Synchro_Packed& packed, Gnss_Synchro& gs)
+{
+    gs.Acq_delay_samples = packed.acq_delay_samples;
+    gs.Acq_doppler_hz = packed.acq_doppler_hz;
+    gs.Acq_samplestamp_samples = packed.acq_samplestamp_samples;
+    gs.fs = packed.fs;
+    gs.Prompt_I = packed.prompt_i;
+    gs.Prompt_Q = packed.prompt_q;
+    gs.CN0_dB_hz = packed.cn0_db_hz;
+    gs.Carrier_Doppler_hz = packed.carrier_doppler_hz;
+    gs.Carrier_phase_rads = packed.carrier_phase_rads;
+    gs.Code_phase_samples = packed.code_phase_samples;
+    gs.Tracking_sample_counter = packed.tracking_sample_counter;
+    gs.Pseudorange_m = packed.pseudorange_m;
+    gs.RX_time = packed.rx_time;
+    gs.interp_TOW_ms = packed.interp_tow_ms;
+    gs.PRN = packed.prn;
+    gs.Channel_ID = packed.channel_id;
+    gs.Acq_doppler_step = packed.acq_doppler_step;
+    gs.correlation_length_ms = packed.correlation_length_ms;
+    gs.TOW_at_current_symbol_ms = packed.tow_at_current_symbol_ms;
+    gs.System = packed.system;
+    gs.Signal[0] = packed.signal[0];
+    gs.Signal[1] = packed.signal[1];
+    gs.Signal[2] = '\0';
+    gs.Flag_valid_acquisition = (packed.flag_valid_acquisition != 0);
+    gs.Flag_valid_symbol_output = (packed.flag_valid_symbol_output != 0);
+    gs.Flag_valid_word = (packed.flag_valid_word != 0);
+    gs.Flag_valid_pseudorange = (packed.flag_valid_pseudorange != 0);
+    gs.Flag_PLL_180_deg_phase_locked = (packed.flag_pll_180_deg_phase_locked != 0);
+}
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SYNCHRO_PACKED_H
@@ -0,0 +1,133 @@
+/*!
+ * \file gnss_synchro_shm_sink.cc
+ * \brief Implementation of a class that publishes Gnss_Synchro objects into
+ * a shared-memory ring for same-host consumers
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_synchro_shm_sink.h"
+#include <glog/logging.h>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>     // for O_CREAT, O_RDWR
+#include <sys/mman.h>  // for shm_open, mmap
+#include <unistd.h>    // for ftruncate, close
+
+namespace
+{
+const char shm_magic[8] = {'G', 'S', 'D', 'R', 'S', 'H', 'M', '\0'};
+const uint32_t shm_version = 1;
+}  // namespace
+
+
+Gnss_Synchro_Shm_Sink::Gnss_Synchro_Shm_Sink(const std::string& zone_name, uint32_t capacity)
+    : zone_name_(zone_name),
+      header_(nullptr),
+      slots_(nullptr),
+      zone_size_(0),
+      capacity_(capacity)
+{
+    if (capacity_ < 2)
+        {
+            capacity_ = 2;
+        }
+    // keep the modulo in the hot path a bit-mask
+    while ((capacity_ & (capacity_ - 1)) != 0)
+        {
+            capacity_++;
+        }
+
+    const int fd = shm_open(zone_name_.c_str(), O_CREAT | O_RDWR, 0644);
+    if (fd < 0)
+        {
+            LOG(WARNING) << "Monitor: failed to open shared-memory zone " << zone_name_
+                         << ": " << strerror(errno);
+            return;
+        }
+    zone_size_ = sizeof(Gnss_Synchro_Shm_Header) + static_cast<size_t>(capacity_) * sizeof(Gnss_Synchro_Shm_Slot);
+    if (ftruncate(fd, static_cast<off_t>(zone_size_)) != 0)
+        {
+            LOG(WARNING) << "Monitor: failed to size shared-memory zone " << zone_name_
+                         << ": " << strerror(errno);
+            close(fd);
+            shm_unlink(zone_name_.c_str());
+            return;
+        }
+    void* mapping = mmap(nullptr, zone_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // the mapping keeps its own reference to the object
+    close(fd);
+    if (mapping == MAP_FAILED)
+        {
+            LOG(WARNING) << "Monitor: failed to map shared-memory zone " << zone_name_
+                         << ": " << strerror(errno);
+            shm_unlink(zone_name_.c_str());
+            return;
+        }
+
+    header_ = static_cast<Gnss_Synchro_Shm_Header*>(mapping);
+    slots_ = reinterpret_cast<Gnss_Synchro_Shm_Slot*>(static_cast<char*>(mapping) + sizeof(Gnss_Synchro_Shm_Header));
+
+    // initialize the slots before publishing the header magic, so a consumer
+    // that finds the magic never reads uninitialized sequence numbers
+    for (uint32_t i = 0; i < capacity_; i++)
+        {
+            slots_[i].seq.store(0, std::memory_order_relaxed);
+            slots_[i].reserved = 0;
+        }
+    header_->version = shm_version;
+    header_->record_size = sizeof(Gnss_Synchro_Packed);
+    header_->capacity = capacity_;
+    header_->reserved = 0;
+    header_->write_index.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(header_->magic, shm_magic, sizeof(shm_magic));
+
+    LOG(INFO) << "Monitor: publishing Gnss_Synchro records to shared-memory zone "
+              << zone_name_ << " (" << capacity_ << " slots of "
+              << sizeof(Gnss_Synchro_Packed) << " bytes)";
+}
+
+
+Gnss_Synchro_Shm_Sink::~Gnss_Synchro_Shm_Sink()
+{
+    if (header_ != nullptr)
+        {
+            munmap(header_, zone_size_);
+            // consumers that are already attached keep their mapping alive;
+            // unlinking only removes the name so no stale zone is left behind
+            shm_unlink(zone_name_.c_str());
+        }
+}
+
+
+bool Gnss_Synchro_Shm_Sink::write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks)
+{
+    if (header_ == nullptr)
+        {
+            return false;
+        }
+    uint64_t index = header_->write_index.load(std::memory_order_relaxed);
+    for (const auto& gs : stocks)
+        {
+            Gnss_Synchro_Shm_Slot& slot = slots_[index & (capacity_ - 1)];
+            const uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+            slot.seq.store(seq + 1, std::memory_order_relaxed);  // odd: write in progress
+            std::atomic_thread_fence(std::memory_order_release);
+            pack_gnss_synchro(gs, slot.record);
+            std::atomic_thread_fence(std::memory_order_release);
+            slot.seq.store(seq + 2, std::memory_order_relaxed);  // even: record consistent
+            index++;
+            header_->write_index.store(index, std::memory_order_release);
+        }
+    return true;
+}
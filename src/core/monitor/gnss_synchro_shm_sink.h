@@ -0,0 +1,109 @@
+/*!
+ * \file gnss_synchro_shm_sink.h
+ * \brief Interface of a class that publishes Gnss_Synchro objects into a
+ * shared-memory ring for same-host consumers
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SYNCHRO_SHM_SINK_H
+#define GNSS_SDR_GNSS_SYNCHRO_SHM_SINK_H
+
+#include "gnss_synchro.h"
+#include "gnss_synchro_packed.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Gnss_Synchro_Monitor
+ * \{ */
+
+
+/*!
+ * \brief Header of the shared-memory monitor zone.
+ *
+ * The zone is a POSIX shared-memory object holding this header followed by
+ * \a capacity slots. write_index counts the records published since the
+ * receiver started; the slot of record i is (i % capacity).
+ */
+struct Gnss_Synchro_Shm_Header
+{
+    char magic[8];          // "GSDRSHM\0"
+    uint32_t version;       // layout version, currently 1
+    uint32_t record_size;   // sizeof(Gnss_Synchro_Packed)
+    uint32_t capacity;      // number of slots in the ring
+    uint32_t reserved;      // keeps write_index 8-byte aligned
+    std::atomic<uint64_t> write_index;
+};
+
+/*!
+ * \brief One seqlock-protected slot of the ring.
+ *
+ * The writer increments seq to an odd value, copies the record, and
+ * increments it again to an even value. A consumer reads seq, copies the
+ * record, re-reads seq, and retries if the two reads differ or the first
+ * one was odd, so it never blocks the receiver and never observes a
+ * half-written record.
+ */
+struct Gnss_Synchro_Shm_Slot
+{
+    std::atomic<uint32_t> seq;
+    uint32_t reserved;
+    Gnss_Synchro_Packed record;
+};
+
+// every member above is naturally aligned, so the layout is stable across
+// compilers without packing pragmas
+static_assert(sizeof(Gnss_Synchro_Shm_Header) == 32, "unexpected padding in Gnss_Synchro_Shm_Header");
+static_assert(sizeof(Gnss_Synchro_Shm_Slot) == 148, "unexpected padding in Gnss_Synchro_Shm_Slot");
+
+
+/*!
+ * \brief This class publishes Gnss_Synchro objects into a seqlock'd
+ * shared-memory ring, so same-host consumers can read the observables
+ * without serialization, system calls, or copies on the receiver side.
+ */
+class Gnss_Synchro_Shm_Sink
+{
+public:
+    /*!
+     * Creates (or re-creates) the shared-memory zone \a zone_name (a name
+     * starting with '/', see shm_open(3)) with room for \a capacity records
+     */
+    Gnss_Synchro_Shm_Sink(const std::string& zone_name, uint32_t capacity);
+    ~Gnss_Synchro_Shm_Sink();
+
+    Gnss_Synchro_Shm_Sink(const Gnss_Synchro_Shm_Sink&) = delete;
+    Gnss_Synchro_Shm_Sink& operator=(const Gnss_Synchro_Shm_Sink&) = delete;
+
+    bool write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks);
+
+    inline bool is_open() const
+    {
+        return header_ != nullptr;
+    }
+
+private:
+    std::string zone_name_;
+    Gnss_Synchro_Shm_Header* header_;
+    Gnss_Synchro_Shm_Slot* slots_;
+    size_t zone_size_;
+    uint32_t capacity_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SYNCHRO_SHM_SINK_H
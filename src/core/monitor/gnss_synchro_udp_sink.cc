@@ -16,59 +16,67 @@
  */
 
 #include "gnss_synchro_udp_sink.h"
-#include <boost/archive/binary_oarchive.hpp>
-#include <boost/serialization/vector.hpp>
-#include <iostream>
-#include <sstream>
+#include "gnss_sdr_make_unique.h"
+#include "gnss_synchro_packed.h"
+#include <cstring>
 
 Gnss_Synchro_Udp_Sink::Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses,
     const uint16_t& port,
-    bool enable_protobuf)
-    : socket{io_context},
+    bool enable_protobuf,
+    bool enable_delta_compression)
+    : sender(addresses, port),
       use_protobuf(enable_protobuf)
 {
     if (enable_protobuf)
         {
             serdes = Serdes_Gnss_Synchro();
         }
-    for (const auto& address : addresses)
+    if (enable_delta_compression)
         {
-            boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
-            endpoints.push_back(endpoint);
+            delta_codec = std::make_unique<Monitor_Delta_Codec>();
         }
 }
 
 
 bool Gnss_Synchro_Udp_Sink::write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks)
 {
-    std::string outbound_data;
     if (use_protobuf == false)
         {
-            std::ostringstream archive_stream;
-            boost::archive::binary_oarchive oa{archive_stream};
-            oa << stocks;
-            outbound_data = archive_stream.str();
+            // packed POD fast path: one fixed-size image per channel,
+            // copied into a reusable flat buffer
+            packed_buffer.resize(stocks.size() * sizeof(Gnss_Synchro_Packed));
+            char* buffer_ptr = packed_buffer.data();
+            for (const auto& gs : stocks)
+                {
+                    Gnss_Synchro_Packed packed{};
+                    pack_gnss_synchro(gs, packed);
+                    std::memcpy(buffer_ptr, &packed, sizeof(packed));
+                    buffer_ptr += sizeof(packed);
+                }
+            if (delta_codec)
+                {
+                    const std::string frame = delta_codec->encode(packed_buffer.data(), packed_buffer.size());
+                    sender.queue_datagram(frame.data(), frame.size());
+                }
+            else
+                {
+                    sender.queue_datagram(packed_buffer.data(), packed_buffer.size());
+                }
         }
     else
         {
-            outbound_data = serdes.createProtobuffer(stocks);
-        }
-    for (const auto& endpoint : endpoints)
-        {
-            socket.open(endpoint.protocol(), error);
-
-            try
+            const std::string outbound_data = serdes.createProtobuffer(stocks);
+            if (delta_codec)
                 {
-                    if (socket.send_to(boost::asio::buffer(outbound_data), endpoint) == 0)
-                        {
-                            std::cerr << "Gnss_Synchro_Udp_Sink sent 0 bytes\n";
-                        }
+                    const std::string frame = delta_codec->encode(outbound_data.data(), outbound_data.size());
+                    sender.queue_datagram(frame.data(), frame.size());
                 }
-            catch (boost::system::system_error const& e)
+            else
                 {
-                    std::cerr << e.what() << '\n';
-                    return false;
+                    sender.queue_datagram(outbound_data.data(), outbound_data.size());
                 }
         }
-    return true;
+    // one sendmmsg() per epoch covering every endpoint; a slow or dead
+    // subscriber makes the sender drop datagrams instead of blocking
+    return sender.flush();
 }
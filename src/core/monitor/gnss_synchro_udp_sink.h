@@ -19,10 +19,11 @@
 #define GNSS_SDR_GNSS_SYNCHRO_UDP_SINK_H
 
 #include "gnss_synchro.h"
+#include "monitor_delta_codec.h"
 #include "serdes_gnss_synchro.h"
-#include <boost/asio.hpp>
-#include <boost/system/error_code.hpp>
+#include "udp_batch_sender.h"
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -32,12 +33,6 @@
  * \{ */
 
 
-#if USE_BOOST_ASIO_IO_CONTEXT
-using b_io_context = boost::asio::io_context;
-#else
-using b_io_context = boost::asio::io_service;
-#endif
-
 /*!
  * \brief This class sends serialized Gnss_Synchro objects
  * over UDP to one or multiple endpoints.
@@ -45,15 +40,14 @@ using b_io_context = boost::asio::io_service;
 class Gnss_Synchro_Udp_Sink
 {
 public:
-    Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf);
+    Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf, bool enable_delta_compression = false);
     bool write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks);
 
 private:
-    b_io_context io_context;
-    boost::asio::ip::udp::socket socket;
-    boost::system::error_code error;
-    std::vector<boost::asio::ip::udp::endpoint> endpoints;
+    Udp_Batch_Sender sender;
+    std::vector<char> packed_buffer;  // reusable buffer for the packed POD fast path
     Serdes_Gnss_Synchro serdes;
+    std::unique_ptr<Monitor_Delta_Codec> delta_codec;  // optional delta framing layer
     bool use_protobuf;
 };
 
@@ -0,0 +1,226 @@
+/*!
+ * \file monitor_delta_codec.h
+ * \brief Delta framing layer shared by the monitor UDP sinks, exploiting the
+ * epoch-to-epoch redundancy of the serialized monitor streams
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_MONITOR_DELTA_CODEC_H
+#define GNSS_SDR_MONITOR_DELTA_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Gnss_Synchro_Monitor
+ * \{ */
+
+
+/*!
+ * \brief Optional framing layer for the monitor UDP sinks. Consecutive
+ * serialized epochs are highly redundant (satellite IDs, near-constant
+ * Dopplers), so each frame is XORed against the previous one and the
+ * resulting zero runs are run-length encoded, typically shrinking the
+ * stream by an order of magnitude without external compression libraries.
+ *
+ * Frame layout: 'G' 'D' | u8 flags (bit 0: delta frame) | u16 sequence
+ * number (little-endian) | payload. Keyframes carry the raw serialized
+ * bytes; delta frames carry a varint original size followed by
+ * (varint zero-run length, varint literal length, literal bytes) tokens of
+ * the XOR against the previous frame. A keyframe is emitted periodically,
+ * and whenever the delta would not be smaller than the raw payload, so a
+ * consumer joining mid-stream or suffering datagram loss resynchronizes
+ * after at most keyframe_interval frames.
+ */
+class Monitor_Delta_Codec
+{
+public:
+    explicit Monitor_Delta_Codec(uint32_t keyframe_interval = 32)
+        : keyframe_interval_(keyframe_interval < 1 ? 1 : keyframe_interval)
+    {
+    }
+
+    //! Wraps one serialized epoch into a keyframe or delta frame
+    std::string encode(const char* data, size_t size)
+    {
+        std::string frame;
+        const bool send_delta = !previous_.empty() && (frames_since_keyframe_ < keyframe_interval_);
+        seq_++;
+        if (send_delta)
+            {
+                frame.reserve(size / 4 + header_size);
+                put_header(frame, true);
+                append_varint(frame, size);
+                size_t pos = 0;
+                while (pos < size)
+                    {
+                        size_t zero_run = 0;
+                        while (pos + zero_run < size && xor_at(data, pos + zero_run) == 0)
+                            {
+                                zero_run++;
+                            }
+                        size_t lit_len = 0;
+                        while (pos + zero_run + lit_len < size && xor_at(data, pos + zero_run + lit_len) != 0)
+                            {
+                                lit_len++;
+                            }
+                        append_varint(frame, zero_run);
+                        append_varint(frame, lit_len);
+                        for (size_t k = 0; k < lit_len; k++)
+                            {
+                                frame.push_back(static_cast<char>(xor_at(data, pos + zero_run + k)));
+                            }
+                        pos += zero_run + lit_len;
+                    }
+            }
+        if (!send_delta || frame.size() >= size + header_size)
+            {
+                // keyframe: first frame, periodic refresh, or delta did not pay off
+                frame.clear();
+                frame.reserve(size + header_size);
+                put_header(frame, false);
+                frame.append(data, size);
+                frames_since_keyframe_ = 0;
+            }
+        else
+            {
+                frames_since_keyframe_++;
+            }
+        previous_.assign(data, size);
+        return frame;
+    }
+
+    /*!
+     * \brief Unwraps one frame; returns false (leaving out untouched) for
+     * malformed frames or delta frames received out of sequence, in which
+     * case the decoder stays unsynchronized until the next keyframe
+     */
+    bool decode(const char* data, size_t size, std::string& out)
+    {
+        if (size < header_size || data[0] != 'G' || data[1] != 'D')
+            {
+                return false;
+            }
+        const bool is_delta = (static_cast<uint8_t>(data[2]) & 0x01) != 0;
+        const uint16_t seq = static_cast<uint16_t>(static_cast<uint8_t>(data[3]) | (static_cast<uint8_t>(data[4]) << 8));
+        const char* p = data + header_size;
+        const char* end = data + size;
+        if (!is_delta)
+            {
+                decode_previous_.assign(p, end - p);
+                decode_synced_ = true;
+                decode_seq_ = seq;
+                out = decode_previous_;
+                return true;
+            }
+        if (!decode_synced_ || seq != static_cast<uint16_t>(decode_seq_ + 1))
+            {
+                // a datagram was lost: wait for the next keyframe
+                decode_synced_ = false;
+                return false;
+            }
+        uint64_t original_size = 0;
+        if (!read_varint(p, end, original_size))
+            {
+                decode_synced_ = false;
+                return false;
+            }
+        std::string decoded(original_size, '\0');
+        size_t pos = 0;
+        while (pos < original_size)
+            {
+                uint64_t zero_run = 0;
+                uint64_t lit_len = 0;
+                if (!read_varint(p, end, zero_run) || !read_varint(p, end, lit_len) ||
+                    pos + zero_run + lit_len > original_size || end - p < static_cast<ptrdiff_t>(lit_len))
+                    {
+                        decode_synced_ = false;
+                        return false;
+                    }
+                pos += zero_run;
+                for (uint64_t k = 0; k < lit_len; k++)
+                    {
+                        decoded[pos + k] = static_cast<char>(*p++);
+                    }
+                pos += lit_len;
+            }
+        for (size_t k = 0; k < decoded.size() && k < decode_previous_.size(); k++)
+            {
+                decoded[k] = static_cast<char>(decoded[k] ^ decode_previous_[k]);
+            }
+        decode_previous_ = decoded;
+        decode_seq_ = seq;
+        out = std::move(decoded);
+        return true;
+    }
+
+private:
+    static const size_t header_size = 5;
+
+    void put_header(std::string& frame, bool is_delta) const
+    {
+        frame.push_back('G');
+        frame.push_back('D');
+        frame.push_back(is_delta ? '\x01' : '\x00');
+        frame.push_back(static_cast<char>(seq_ & 0xFF));
+        frame.push_back(static_cast<char>(seq_ >> 8));
+    }
+
+    uint8_t xor_at(const char* data, size_t pos) const
+    {
+        const uint8_t prev = (pos < previous_.size()) ? static_cast<uint8_t>(previous_[pos]) : 0;
+        return static_cast<uint8_t>(data[pos]) ^ prev;
+    }
+
+    static void append_varint(std::string& frame, uint64_t value)
+    {
+        while (value >= 0x80)
+            {
+                frame.push_back(static_cast<char>(static_cast<uint8_t>(value) | 0x80));
+                value >>= 7;
+            }
+        frame.push_back(static_cast<char>(value));
+    }
+
+    static bool read_varint(const char*& p, const char* end, uint64_t& value)
+    {
+        value = 0;
+        int shift = 0;
+        while (p < end && shift < 64)
+            {
+                const uint8_t byte = static_cast<uint8_t>(*p++);
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                    {
+                        return true;
+                    }
+                shift += 7;
+            }
+        return false;
+    }
+
+    std::string previous_;
+    std::string decode_previous_;
+    uint32_t keyframe_interval_;
+    uint32_t frames_since_keyframe_ = 0;
+    uint16_t seq_ = 0xFFFF;  // first encoded frame gets sequence number 0
+    uint16_t decode_seq_ = 0;
+    bool decode_synced_ = false;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_MONITOR_DELTA_CODEC_H
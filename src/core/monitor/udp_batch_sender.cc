@@ -0,0 +1,124 @@
+/*!
+ * \file udp_batch_sender.cc
+ * \brief Implementation of a class that batches UDP datagrams towards one
+ * or multiple endpoints and sends them without ever blocking the caller
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "udp_batch_sender.h"
+#include <iostream>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/socket.h>
+#include <array>
+#include <cstring>
+#endif
+
+
+Udp_Batch_Sender::Udp_Batch_Sender(const std::vector<std::string>& addresses,
+    uint16_t port,
+    size_t max_pending_datagrams)
+    : socket{io_context},
+      max_pending(max_pending_datagrams)
+{
+    for (const auto& address : addresses)
+        {
+            boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
+            endpoints.push_back(endpoint);
+        }
+    if (!endpoints.empty())
+        {
+            socket.open(endpoints.front().protocol(), error);
+            socket.non_blocking(true, error);
+        }
+}
+
+
+void Udp_Batch_Sender::queue_datagram(const char* data, size_t size)
+{
+    if (pending_datagrams.size() >= max_pending)
+        {
+            pending_datagrams.pop_front();
+        }
+    pending_datagrams.emplace_back(data, size);
+}
+
+
+bool Udp_Batch_Sender::flush()
+{
+    if (pending_datagrams.empty() || endpoints.empty())
+        {
+            return true;
+        }
+    bool all_sent = true;
+#ifdef __linux__
+    // one sendmmsg() per batch of up to 64 datagram/endpoint pairs, instead
+    // of one syscall per datagram per endpoint
+    const size_t max_msgs_per_call = 64;
+    std::array<mmsghdr, 64> msgs{};
+    std::array<iovec, 64> iovs{};
+    size_t n_msgs = 0;
+    const auto send_batch = [&]() {
+        size_t sent = 0;
+        while (sent < n_msgs)
+            {
+                const int ret = sendmmsg(socket.native_handle(), msgs.data() + sent, n_msgs - sent, 0);
+                if (ret <= 0)
+                    {
+                        // would block or error: drop the remainder of the batch
+                        all_sent = false;
+                        break;
+                    }
+                sent += static_cast<size_t>(ret);
+            }
+        n_msgs = 0;
+    };
+    for (auto& datagram : pending_datagrams)
+        {
+            for (auto& endpoint : endpoints)
+                {
+                    iovs[n_msgs].iov_base = const_cast<char*>(datagram.data());
+                    iovs[n_msgs].iov_len = datagram.size();
+                    std::memset(&msgs[n_msgs].msg_hdr, 0, sizeof(msghdr));
+                    msgs[n_msgs].msg_hdr.msg_name = const_cast<void*>(static_cast<const void*>(endpoint.data()));
+                    msgs[n_msgs].msg_hdr.msg_namelen = endpoint.size();
+                    msgs[n_msgs].msg_hdr.msg_iov = &iovs[n_msgs];
+                    msgs[n_msgs].msg_hdr.msg_iovlen = 1;
+                    if (++n_msgs == max_msgs_per_call)
+                        {
+                            send_batch();
+                        }
+                }
+        }
+    if (n_msgs > 0)
+        {
+            send_batch();
+        }
+#else
+    for (const auto& datagram : pending_datagrams)
+        {
+            for (const auto& endpoint : endpoints)
+                {
+                    socket.send_to(boost::asio::buffer(datagram), endpoint, 0, error);
+                    if (error)
+                        {
+                            // would block or error: non-blocking socket, drop it
+                            all_sent = false;
+                        }
+                }
+        }
+#endif
+    pending_datagrams.clear();
+    return all_sent;
+}
@@ -0,0 +1,75 @@
+/*!
+ * \file udp_batch_sender.h
+ * \brief Interface of a class that batches UDP datagrams towards one or
+ * multiple endpoints and sends them without ever blocking the caller
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_UDP_BATCH_SENDER_H
+#define GNSS_SDR_UDP_BATCH_SENDER_H
+
+#include <boost/asio.hpp>
+#include <boost/system/error_code.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Gnss_Synchro_Monitor
+ * \{ */
+
+
+#if USE_BOOST_ASIO_IO_CONTEXT
+using b_io_context = boost::asio::io_context;
+#else
+using b_io_context = boost::asio::io_service;
+#endif
+
+/*!
+ * \brief This class batches outgoing UDP datagrams and sends each flush
+ * with a single sendmmsg() call per destination set on Linux (a send_to
+ * loop elsewhere). The socket is non-blocking and the pending queue is
+ * bounded with a drop-oldest policy, so a dead or slow subscriber can
+ * never stall the caller.
+ */
+class Udp_Batch_Sender
+{
+public:
+    Udp_Batch_Sender(const std::vector<std::string>& addresses,
+        uint16_t port,
+        size_t max_pending_datagrams = 128);
+
+    //! Queues one datagram for every endpoint, dropping the oldest pending
+    //! one if the queue is full
+    void queue_datagram(const char* data, size_t size);
+
+    //! Sends all pending datagrams; returns false if any of them could not
+    //! be handed to the network stack
+    bool flush();
+
+private:
+    b_io_context io_context;
+    boost::asio::ip::udp::socket socket;
+    boost::system::error_code error;
+    std::vector<boost::asio::ip::udp::endpoint> endpoints;
+    std::deque<std::string> pending_datagrams;
+    size_t max_pending;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_UDP_BATCH_SENDER_H
@@ -0,0 +1,95 @@
+/*!
+ * \file ab_fork_configuration.cc
+ * \brief Implementation of the B-set configuration overlay of an A/B fork.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "ab_fork_configuration.h"
+#include <utility>
+
+const std::string ABForkConfiguration::overlay_prefix_("AB_Fork.");
+
+
+ABForkConfiguration::ABForkConfiguration(std::shared_ptr<ConfigurationInterface> base_configuration)
+    : base_configuration_(std::move(base_configuration))
+{
+}
+
+
+// Each accessor resolves the base value first and then uses it as the
+// default of the overlay lookup, so a key without an AB_Fork counterpart
+// keeps the base configuration value with a single extra map lookup
+std::string ABForkConfiguration::property(std::string property_name, std::string default_value) const
+{
+    return base_configuration_->property(overlay_prefix_ + property_name, base_configuration_->property(property_name, std::move(default_value)));
+}
+
+
+bool ABForkConfiguration::property(std::string property_name, bool default_value) const
+{
+    return base_configuration_->property(overlay_prefix_ + property_name, base_configuration_->property(property_name, default_value));
+}
+
+
+int64_t ABForkConfiguration::property(std::string property_name, int64_t default_value) const
+{
+    return base_configuration_->property(overlay_prefix_ + property_name, base_configuration_->property(property_name, default_value));
+}
+
+
+uint64_t ABForkConfiguration::property(std::string property_name, uint64_t default_value) const
+{
+    return base_configuration_->property(overlay_prefix_ + property_name, base_configuration_->property(property_name, default_value));
+}
+
+
+int32_t ABForkConfiguration::property(std::string property_name, int32_t default_value) const
+{
+    return base_configuration_->property(overlay_prefix_ + property_name, base_configuration_->property(property_name, default_value));
+}
+
+
+uint32_t ABForkConfiguration::property(std::string property_name, uint32_t default_value) const
+{
+    return base_configuration_->property(overlay_prefix_ + property_name, base_configuration_->property(property_name, default_value));
+}
+
+
+int16_t ABForkConfiguration::property(std::string property_name, int16_t default_value) const
+{
+    return base_configuration_->property(overlay_prefix_ + property_name, base_configuration_->property(property_name, default_value));
+}
+
+
+uint16_t ABForkConfiguration::property(std::string property_name, uint16_t default_value) const
+{
+    return base_configuration_->property(overlay_prefix_ + property_name, base_configuration_->property(property_name, default_value));
+}
+
+
+float ABForkConfiguration::property(std::string property_name, float default_value) const
+{
+    return base_configuration_->property(overlay_prefix_ + property_name, base_configuration_->property(property_name, default_value));
+}
+
+
+double ABForkConfiguration::property(std::string property_name, double default_value) const
+{
+    return base_configuration_->property(overlay_prefix_ + property_name, base_configuration_->property(property_name, default_value));
+}
+
+
+void ABForkConfiguration::set_property(std::string property_name, std::string value)
+{
+    base_configuration_->set_property(overlay_prefix_ + std::move(property_name), std::move(value));
+}
@@ -0,0 +1,68 @@
+/*!
+ * \file ab_fork_configuration.h
+ * \brief A ConfigurationInterface overlay for the B set of an A/B fork.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * When the flow graph is forked for online algorithm comparison
+ * (GNSS-SDR.enable_ab_fork), the B channel set is built from the same
+ * configuration as the A set, with any parameter prefixed with "AB_Fork."
+ * taking precedence. E.g. AB_Fork.Tracking_1C.pll_bw_hz=15 makes the B
+ * channels run with a 15 Hz PLL bandwidth while the A channels keep the
+ * value of Tracking_1C.pll_bw_hz.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_AB_FORK_CONFIGURATION_H
+#define GNSS_SDR_AB_FORK_CONFIGURATION_H
+
+#include "configuration_interface.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver
+ * \{ */
+
+
+/*!
+ * \brief ConfigurationInterface overlay resolving each property as
+ * "AB_Fork." + name when that key is defined, and as the base
+ * configuration value otherwise.
+ */
+class ABForkConfiguration : public ConfigurationInterface
+{
+public:
+    explicit ABForkConfiguration(std::shared_ptr<ConfigurationInterface> base_configuration);
+    ~ABForkConfiguration() override = default;
+    std::string property(std::string property_name, std::string default_value) const override;
+    bool property(std::string property_name, bool default_value) const override;
+    int64_t property(std::string property_name, int64_t default_value) const override;
+    uint64_t property(std::string property_name, uint64_t default_value) const override;
+    int32_t property(std::string property_name, int32_t default_value) const override;
+    uint32_t property(std::string property_name, uint32_t default_value) const override;
+    int16_t property(std::string property_name, int16_t default_value) const override;
+    uint16_t property(std::string property_name, uint16_t default_value) const override;
+    float property(std::string property_name, float default_value) const override;
+    double property(std::string property_name, double default_value) const override;
+    void set_property(std::string property_name, std::string value) override;
+
+private:
+    static const std::string overlay_prefix_;
+    std::shared_ptr<ConfigurationInterface> base_configuration_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_AB_FORK_CONFIGURATION_H
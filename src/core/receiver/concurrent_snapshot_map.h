@@ -0,0 +1,95 @@
+/*!
+ * \file concurrent_snapshot_map.h
+ * \brief Interface of a read-optimized thread-safe std::map
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_CONCURRENT_SNAPSHOT_MAP_H
+#define GNSS_SDR_CONCURRENT_SNAPSHOT_MAP_H
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver core_receiver
+ * \{ */
+
+
+/*!
+ * \brief This class implements a thread-safe std::map optimized for frequent
+ * reads and rare writes.
+ *
+ * Unlike Concurrent_Map, readers never take a lock: the map is kept in an
+ * immutable snapshot behind a shared_ptr, and a write builds an updated copy
+ * and swaps the pointer atomically. Readers holding the previous snapshot
+ * keep a consistent view until they drop it. Suited to navigation data,
+ * which is read every epoch but updated only when a new subframe or page
+ * has been decoded.
+ */
+template <typename Data>
+class Concurrent_Snapshot_Map
+{
+public:
+    Concurrent_Snapshot_Map()
+        : snapshot_(std::make_shared<const std::map<int, Data>>())
+    {
+    }
+
+    void write(int key, Data const& data)
+    {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        auto updated = std::make_shared<std::map<int, Data>>(*std::atomic_load(&snapshot_));
+        (*updated)[key] = data;  // insert or update
+        std::atomic_store(&snapshot_, std::shared_ptr<const std::map<int, Data>>(std::move(updated)));
+    }
+
+    //! Lock-free consistent view of the map; cheap, shares ownership with the store
+    std::shared_ptr<const std::map<int, Data>> get_snapshot() const
+    {
+        return std::atomic_load(&snapshot_);
+    }
+
+    std::map<int, Data> get_map_copy() const
+    {
+        return *std::atomic_load(&snapshot_);
+    }
+
+    size_t size() const
+    {
+        return std::atomic_load(&snapshot_)->size();
+    }
+
+    bool read(int key, Data& p_data) const
+    {
+        const auto snapshot = std::atomic_load(&snapshot_);
+        const auto data_iter = snapshot->find(key);
+        if (data_iter != snapshot->end())
+            {
+                p_data = data_iter->second;
+                return true;
+            }
+        return false;
+    }
+
+private:
+    std::shared_ptr<const std::map<int, Data>> snapshot_;
+    std::mutex write_mutex_;  // serializes writers only; readers never take it
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_CONCURRENT_SNAPSHOT_MAP_H
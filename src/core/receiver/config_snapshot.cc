@@ -0,0 +1,198 @@
+/*!
+ * \file config_snapshot.cc
+ * \brief Binary snapshot of a fully resolved configuration property map
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "config_snapshot.h"
+#include <glog/logging.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+const char snapshot_magic[8] = {'G', 'S', 'D', 'R', 'C', 'F', 'G', '\0'};
+constexpr uint32_t snapshot_version = 1;
+
+struct Snapshot_Header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t n_entries;
+    uint64_t source_size;       // size of the source configuration file in bytes
+    int64_t source_mtime_s;     // mtime of the source configuration file, Unix seconds
+    uint64_t payload_bytes;     // size of the entry payload that follows the header
+    uint64_t payload_checksum;  // FNV-1a 64 over the payload
+};
+
+uint64_t fnv1a_64(const char* data, uint64_t size)
+{
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (uint64_t i = 0; i < size; i++)
+        {
+            hash ^= static_cast<unsigned char>(data[i]);
+            hash *= 0x100000001B3ULL;
+        }
+    return hash;
+}
+
+bool stat_source(const std::string& source_file, uint64_t& size, int64_t& mtime_s)
+{
+    struct stat source_stat
+    {
+    };
+    if (stat(source_file.c_str(), &source_stat) != 0)
+        {
+            return false;
+        }
+    size = static_cast<uint64_t>(source_stat.st_size);
+    mtime_s = static_cast<int64_t>(source_stat.st_mtime);
+    return true;
+}
+}  // namespace
+
+
+bool Config_Snapshot::save(const std::string& filename, const std::string& source_file, const std::map<std::string, std::string>& values)
+{
+    Snapshot_Header header{};
+    std::memcpy(header.magic, snapshot_magic, sizeof(header.magic));
+    header.version = snapshot_version;
+    header.n_entries = static_cast<uint32_t>(values.size());
+    if (!stat_source(source_file, header.source_size, header.source_mtime_s))
+        {
+            LOG(WARNING) << "Could not stat " << source_file << ", not writing the compiled configuration snapshot";
+            return false;
+        }
+
+    std::string payload;
+    for (const auto& value : values)
+        {
+            const auto key_len = static_cast<uint32_t>(value.first.size());
+            const auto value_len = static_cast<uint32_t>(value.second.size());
+            payload.append(reinterpret_cast<const char*>(&key_len), sizeof(key_len));
+            payload.append(reinterpret_cast<const char*>(&value_len), sizeof(value_len));
+            payload.append(value.first);
+            payload.append(value.second);
+        }
+    header.payload_bytes = payload.size();
+    header.payload_checksum = fnv1a_64(payload.data(), payload.size());
+
+    std::ofstream file(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+        {
+            LOG(WARNING) << "Could not open " << filename << " for writing the compiled configuration snapshot";
+            return false;
+        }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+    if (!file.good())
+        {
+            LOG(WARNING) << "Failure writing the compiled configuration snapshot to " << filename;
+            return false;
+        }
+    return true;
+}
+
+
+bool Config_Snapshot::load(const std::string& filename, const std::string& source_file, std::map<std::string, std::string>& values)
+{
+    uint64_t source_size = 0;
+    int64_t source_mtime_s = 0;
+    if (!stat_source(source_file, source_size, source_mtime_s))
+        {
+            return false;
+        }
+
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        {
+            DLOG(INFO) << "No compiled configuration snapshot found at " << filename;
+            return false;
+        }
+    struct stat snapshot_stat
+    {
+    };
+    if (fstat(fd, &snapshot_stat) != 0 || static_cast<size_t>(snapshot_stat.st_size) < sizeof(Snapshot_Header))
+        {
+            close(fd);
+            return false;
+        }
+    const auto mapped_bytes = static_cast<size_t>(snapshot_stat.st_size);
+    void* mapped = mmap(nullptr, mapped_bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED)
+        {
+            LOG(WARNING) << "Could not map the compiled configuration snapshot " << filename;
+            return false;
+        }
+
+    bool ok = false;
+    Snapshot_Header header{};
+    std::memcpy(&header, mapped, sizeof(header));
+    if (std::memcmp(header.magic, snapshot_magic, sizeof(header.magic)) != 0 || header.version != snapshot_version)
+        {
+            LOG(WARNING) << filename << " is not a compiled configuration snapshot";
+        }
+    else if (header.source_size != source_size || header.source_mtime_s != source_mtime_s)
+        {
+            LOG(INFO) << "Compiled configuration snapshot " << filename << " is stale, re-parsing " << source_file;
+        }
+    else if (sizeof(Snapshot_Header) + header.payload_bytes != mapped_bytes ||
+             fnv1a_64(static_cast<const char*>(mapped) + sizeof(Snapshot_Header), header.payload_bytes) != header.payload_checksum)
+        {
+            LOG(WARNING) << "Compiled configuration snapshot " << filename << " failed its checksum, re-parsing " << source_file;
+        }
+    else
+        {
+            const char* payload = static_cast<const char*>(mapped) + sizeof(Snapshot_Header);
+            uint64_t offset = 0;
+            uint32_t entries_read = 0;
+            ok = true;
+            while (entries_read < header.n_entries)
+                {
+                    uint32_t key_len = 0;
+                    uint32_t value_len = 0;
+                    if (offset + sizeof(key_len) + sizeof(value_len) > header.payload_bytes)
+                        {
+                            ok = false;
+                            break;
+                        }
+                    std::memcpy(&key_len, payload + offset, sizeof(key_len));
+                    std::memcpy(&value_len, payload + offset + sizeof(key_len), sizeof(value_len));
+                    offset += sizeof(key_len) + sizeof(value_len);
+                    if (offset + static_cast<uint64_t>(key_len) + value_len > header.payload_bytes)
+                        {
+                            ok = false;
+                            break;
+                        }
+                    std::string key(payload + offset, key_len);
+                    offset += key_len;
+                    std::string value(payload + offset, value_len);
+                    offset += value_len;
+                    values.emplace(std::move(key), std::move(value));
+                    entries_read++;
+                }
+            if (!ok)
+                {
+                    LOG(WARNING) << "Truncated compiled configuration snapshot " << filename << ", re-parsing " << source_file;
+                    values.clear();
+                }
+        }
+    munmap(mapped, mapped_bytes);
+    return ok;
+}
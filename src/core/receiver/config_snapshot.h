@@ -0,0 +1,58 @@
+/*!
+ * \file config_snapshot.h
+ * \brief Binary snapshot of a fully resolved configuration property map
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * On devices with fixed configurations the ini file never changes between
+ * boots, yet it is re-parsed and re-validated on every start. With the
+ * -compiled_config flag the receiver stores the resolved name/value map in
+ * a small binary image next to the configuration file after the first boot,
+ * and on later boots maps that image back into memory instead of running
+ * the parser. The image records the size and modification time of the
+ * source file and a checksum of its own payload, so any edit to the
+ * configuration or corruption of the snapshot falls back to a regular
+ * parse that rewrites it.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_CONFIG_SNAPSHOT_H
+#define GNSS_SDR_CONFIG_SNAPSHOT_H
+
+#include <map>
+#include <string>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver
+ * \{ */
+
+
+/*!
+ * \brief Reads and writes the compiled-configuration binary image
+ */
+class Config_Snapshot
+{
+public:
+    //! Writes the resolved property map of source_file to filename,
+    //! returns true on success
+    static bool save(const std::string& filename, const std::string& source_file, const std::map<std::string, std::string>& values);
+
+    //! Reads the property map back from a memory-mapped image. Returns
+    //! false if the image is missing, corrupted, or stale with respect
+    //! to source_file
+    static bool load(const std::string& filename, const std::string& source_file, std::map<std::string, std::string>& values);
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_CONFIG_SNAPSHOT_H
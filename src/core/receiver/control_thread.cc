@@ -35,6 +35,7 @@
 #include "glonass_gnav_utc_model.h"
 #include "gnss_flowgraph.h"
 #include "gnss_satellite.h"
+#include "gnss_sdr_fft_warmup.h"  // for gnss_fft_plan_warmup
 #include "gnss_sdr_flags.h"
 #include "gps_acq_assist.h"        // for Gps_Acq_Assist
 #include "gps_almanac.h"           // for Gps_Almanac
@@ -48,6 +49,9 @@
 #include "rtklib_conversions.h"    // for alm_to_rtklib
 #include "rtklib_ephemeris.h"      // for alm2pos, eph2pos
 #include "rtklib_rtkcmn.h"         // for utc2gpst
+#include "latency_tracer.h"        // for Latency_Tracer
+#include "startup_profiler.h"      // for Scoped_Startup_Timer
+#include "warm_start_snapshot.h"   // for Warm_Start_Snapshot
 #include <armadillo>               // for interaction with geofunctions
 #include <boost/lexical_cast.hpp>  // for bad_lexical_cast
 #include <glog/logging.h>          // for LOG
@@ -64,6 +68,7 @@
 #include <stdexcept>               // for invalid_argument
 #include <sys/ipc.h>               // for IPC_CREAT
 #include <sys/msg.h>               // for msgctl, msgget
+#include <sys/stat.h>              // for stat
 
 #ifdef ENABLE_FPGA
 #include <boost/chrono.hpp>  // for steady_clock
@@ -145,6 +150,24 @@ ControlThread::ControlThread(std::shared_ptr<ConfigurationInterface> configurati
 void ControlThread::init()
 {
     telecommand_enabled_ = configuration_->property("GNSS-SDR.telecommand_enabled", false);
+    // OPTIONAL: pre-plan FFTs of the given lengths (comma-separated list of
+    // samples) so that all channels find cached FFTW wisdom when they start
+    const std::string fft_warmup_str = configuration_->property("GNSS-SDR.fft_warmup_sizes", std::string(""));
+    if (!fft_warmup_str.empty())
+        {
+            std::vector<uint32_t> fft_sizes;
+            std::stringstream fft_ss(fft_warmup_str);
+            uint32_t fft_size;
+            while (fft_ss >> fft_size)
+                {
+                    fft_sizes.push_back(fft_size);
+                    if ((fft_ss.peek() == ',') || (fft_ss.peek() == ' '))
+                        {
+                            fft_ss.ignore();
+                        }
+                }
+            gnss_fft_plan_warmup(fft_sizes);
+        }
     // OPTIONAL: specify a custom year to override the system time in order to postprocess old gnss records and avoid wrong week rollover
     pre_2009_file_ = configuration_->property("GNSS-SDR.pre_2009_file", false);
     // Instantiates a control queue, a GNSS flowgraph, and a control message factory
@@ -154,6 +177,7 @@ void ControlThread::init()
         {
             try
                 {
+                    Scoped_Startup_Timer timer("block_construction");
                     flowgraph_ = std::make_shared<GNSSFlowgraph>(configuration_, control_queue_);
                 }
             catch (const boost::bad_lexical_cast &e)
@@ -254,6 +278,11 @@ ControlThread::~ControlThread()  // NOLINT(modernize-use-equals-default)
             msgctl(msqid_, IPC_RMID, nullptr);
         }
 
+    if (assist_thread_.joinable())
+        {
+            assist_thread_.join();
+        }
+
     if (sysv_queue_thread_.joinable())
         {
             sysv_queue_thread_.join();
@@ -263,6 +292,21 @@ ControlThread::~ControlThread()  // NOLINT(modernize-use-equals-default)
         {
             cmd_interface_thread_.join();
         }
+
+    if (config_reload_thread_.joinable())
+        {
+            config_reload_thread_.join();
+        }
+
+    if (acq_doppler_predictor_thread_.joinable())
+        {
+            acq_doppler_predictor_thread_.join();
+        }
+
+    if (visibility_scheduler_thread_.joinable())
+        {
+            visibility_scheduler_thread_.join();
+        }
 }
 
 
@@ -323,6 +367,11 @@ void ControlThread::event_dispatcher(bool &valid_event, pmt::pmt_t &msg)
                     // perform non-priority tasks
                     flowgraph_->acquisition_manager(0);  // start acquisition of untracked satellites
                 }
+            if (telecommand_enabled_)
+                {
+                    // refresh the status report served by the telecommand server
+                    cmd_interface_.update_status_snapshot();
+                }
         }
 }
 
@@ -346,6 +395,7 @@ int ControlThread::run()
         }
     try
         {
+            Scoped_Startup_Timer timer("flowgraph_connect");
             flowgraph_->connect();
         }
     catch (const std::exception &e)
@@ -361,8 +411,20 @@ int ControlThread::run()
         {
             return 0;
         }
+
+    // Pre-seed acquisition search windows from the last shutdown, if enabled
+    // and a recent snapshot is available
+    if (configuration_->property("GNSS-SDR.enable_warm_start", false))
+        {
+            Scoped_Startup_Timer timer("warm_start_load");
+            warm_start_load();
+        }
+
     // Start the flowgraph
-    flowgraph_->start();
+    {
+        Scoped_Startup_Timer timer("flowgraph_start");
+        flowgraph_->start();
+    }
     if (flowgraph_->running())
         {
             LOG(INFO) << "Flowgraph started";
@@ -372,8 +434,11 @@ int ControlThread::run()
             return 0;
         }
 
-    // launch GNSS assistance process AFTER the flowgraph is running because the GNU Radio asynchronous queues must be already running to transport msgs
-    assist_GNSS();
+    // launch GNSS assistance process AFTER the flowgraph is running because the GNU Radio asynchronous queues must be already running to transport msgs.
+    // It runs in a background thread so that a slow SUPL server does not hold
+    // up the receiver: the assistance data are injected through the flowgraph
+    // message ports whenever they arrive
+    assist_thread_ = std::thread(&ControlThread::assist_GNSS, this);
     // start the keyboard_listener thread
     if (FLAGS_keyboard)
         {
@@ -385,23 +450,76 @@ int ControlThread::run()
     cmd_interface_.set_pvt(flowgraph_->get_pvt());
     cmd_interface_thread_ = std::thread(&ControlThread::telecommand_listener, this);
 
+    // start the configuration hot-reload watcher, if enabled
+    if (configuration_->property("GNSS-SDR.enable_config_hot_reload", false))
+        {
+            config_reload_thread_ = std::thread(&ControlThread::config_reload_listener, this);
+        }
+
+    // start the almanac/ephemeris-based acquisition Doppler predictor, if enabled
+    if (configuration_->property("GNSS-SDR.enable_acq_doppler_prediction", false))
+        {
+            acq_doppler_predictor_thread_ = std::thread(&ControlThread::acq_doppler_predictor, this);
+        }
+
+    // start the almanac/ephemeris-based satellite visibility scheduler, if enabled
+    if (configuration_->property("GNSS-SDR.enable_visibility_scheduler", false))
+        {
+            visibility_scheduler_thread_ = std::thread(&ControlThread::visibility_scheduler, this);
+        }
+
 #ifdef ENABLE_FPGA
     // Create a task for the acquisition such that id doesn't block the flow of the control thread
     fpga_helper_thread_ = boost::thread(&GNSSFlowgraph::start_acquisition_helper,
         flowgraph_);
 #endif
+    // The receiver is up: dump the startup phase timings (--log_dir)
+    Startup_Profiler::get_instance().write_report();
+
     // Main loop to read and process the control messages
+    // An optional busy-spin phase before the blocking wait shaves the
+    // condition-variable wakeup latency off the event handling path, at the
+    // cost of one core spinning for up to that long per loop iteration
+    control_queue_->set_spin_duration_us(configuration_->property("GNSS-SDR.control_queue_spin_us", 0));
     pmt::pmt_t msg;
+    std::vector<pmt::pmt_t> event_batch;
     while (flowgraph_->running() && !stop_)
         {
-            // read event messages, triggered by event signaling with a 100 ms timeout to perform low priority receiver management tasks
-            bool valid_event = control_queue_->timed_wait_and_pop(msg, 100);
-            // call the new sat dispatcher and receiver controller
-            event_dispatcher(valid_event, msg);
+            // read event messages, triggered by event signaling with a 100 ms timeout to perform low priority receiver management tasks.
+            // The whole backlog is drained with a single wakeup, so reacquisition storms on many-channel
+            // configurations do not wake this thread once per event
+            event_batch.clear();
+            bool valid_event = control_queue_->timed_wait_and_pop_all(event_batch, 100);
+            if (valid_event)
+                {
+                    for (auto &event : event_batch)
+                        {
+                            // call the new sat dispatcher and receiver controller
+                            event_dispatcher(valid_event, event);
+                            if (stop_ || !flowgraph_->running())
+                                {
+                                    break;
+                                }
+                        }
+                }
+            else
+                {
+                    event_dispatcher(valid_event, msg);
+                }
         }
     std::cout << "Stopping GNSS-SDR, please wait!\n";
     flowgraph_->stop();
     stop_ = true;
+
+    // final per-stage latency summary (GNSS-SDR.enable_latency_trace)
+    Latency_Tracer::get_instance().write_report();
+
+    // Persist the last per-satellite Doppler estimates for the next start
+    if (configuration_->property("GNSS-SDR.enable_warm_start", false))
+        {
+            warm_start_save();
+        }
+
     flowgraph_->disconnect();
 
 #ifdef ENABLE_FPGA
@@ -974,7 +1092,7 @@ void ControlThread::apply_action(unsigned int what)
 }
 
 
-std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time_t rx_utc_time, const std::array<float, 3> &LLH)
+std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time_t rx_utc_time, const std::array<float, 3> &LLH, bool print_status)
 {
     // 1. Compute rx ECEF position from LLH WGS84
     const arma::vec LLH_rad = arma::vec{degtorad(LLH[0]), degtorad(LLH[1]), LLH[2]};
@@ -1002,8 +1120,11 @@ std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time
     tstruct = *gmtime(&rx_utc_time);
     strftime(buf, sizeof(buf), "%d/%m/%Y %H:%M:%S ", &tstruct);
     const std::string str_time = std::string(buf);
-    std::cout << "Get visible satellites at " << str_time
-              << "UTC, assuming RX position " << LLH[0] << " [deg], " << LLH[1] << " [deg], " << LLH[2] << " [m]\n";
+    if (print_status)
+        {
+            std::cout << "Get visible satellites at " << str_time
+                      << "UTC, assuming RX position " << LLH[0] << " [deg], " << LLH[1] << " [deg], " << LLH[2] << " [m]\n";
+        }
 
     const std::map<int, Gps_Ephemeris> gps_eph_map = pvt_ptr->get_gps_ephemeris();
     for (const auto &it : gps_eph_map)
@@ -1023,7 +1144,10 @@ std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time
             // push sat
             if (El > 0)
                 {
-                    std::cout << "Using GPS Ephemeris: Sat " << it.second.PRN << " Az: " << Az << " El: " << El << '\n';
+                    if (print_status)
+                        {
+                            std::cout << "Using GPS Ephemeris: Sat " << it.second.PRN << " Az: " << Az << " El: " << El << '\n';
+                        }
                     available_satellites.emplace_back(floor(El),
                         (Gnss_Satellite(std::string("GPS"), it.second.PRN)));
                     visible_gps.push_back(it.second.PRN);
@@ -1048,7 +1172,10 @@ std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time
             // push sat
             if (El > 0)
                 {
-                    std::cout << "Using Galileo Ephemeris: Sat " << it.second.PRN << " Az: " << Az << " El: " << El << '\n';
+                    if (print_status)
+                        {
+                            std::cout << "Using Galileo Ephemeris: Sat " << it.second.PRN << " Az: " << Az << " El: " << El << '\n';
+                        }
                     available_satellites.emplace_back(floor(El),
                         (Gnss_Satellite(std::string("Galileo"), it.second.PRN)));
                     visible_gal.push_back(it.second.PRN);
@@ -1078,7 +1205,10 @@ std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time
                     it2 = std::find(visible_gps.begin(), visible_gps.end(), it.second.PRN);
                     if (it2 == visible_gps.end())
                         {
-                            std::cout << "Using GPS Almanac:  Sat " << it.second.PRN << " Az: " << Az << " El: " << El << '\n';
+                            if (print_status)
+                                {
+                                    std::cout << "Using GPS Almanac:  Sat " << it.second.PRN << " Az: " << Az << " El: " << El << '\n';
+                                }
                             available_satellites.emplace_back(floor(El),
                                 (Gnss_Satellite(std::string("GPS"), it.second.PRN)));
                         }
@@ -1108,7 +1238,10 @@ std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time
                     it2 = std::find(visible_gal.begin(), visible_gal.end(), it.second.PRN);
                     if (it2 == visible_gal.end())
                         {
-                            std::cout << "Using Galileo Almanac:  Sat " << it.second.PRN << " Az: " << Az << " El: " << El << '\n';
+                            if (print_status)
+                                {
+                                    std::cout << "Using Galileo Almanac:  Sat " << it.second.PRN << " Az: " << Az << " El: " << El << '\n';
+                                }
                             available_satellites.emplace_back(floor(El),
                                 (Gnss_Satellite(std::string("Galileo"), it.second.PRN)));
                         }
@@ -1125,6 +1258,207 @@ std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time
 }
 
 
+void ControlThread::acq_doppler_predictor()
+{
+    const int period_s = configuration_->property("GNSS-SDR.acq_doppler_prediction_period_s", 10);
+    const std::shared_ptr<PvtInterface> pvt_ptr = flowgraph_->get_pvt();
+    // satellite velocity from a finite difference of the broadcast orbit
+    const double dt_s = 0.5;
+
+    while (!stop_)
+        {
+            // sleep in one-second slices so shutdown is not delayed by a whole period
+            for (int slept_s = 0; (slept_s < period_s) && !stop_; slept_s++)
+                {
+                    std::this_thread::sleep_for(std::chrono::seconds(1));
+                }
+            if (stop_)
+                {
+                    break;
+                }
+
+            // Reference position and time: the latest PVT fix when available,
+            // the A-GNSS reference location otherwise
+            double rx_longitude_deg;
+            double rx_latitude_deg;
+            double rx_height_m;
+            double ground_speed_kmh;
+            double course_over_ground_deg;
+            time_t rx_utc_time = 0;
+            arma::vec LLH_rad;
+            if (pvt_ptr->get_latest_PVT(&rx_longitude_deg, &rx_latitude_deg, &rx_height_m,
+                    &ground_speed_kmh, &course_over_ground_deg, &rx_utc_time) == true)
+                {
+                    LLH_rad = arma::vec{degtorad(rx_latitude_deg), degtorad(rx_longitude_deg), rx_height_m};
+                }
+            else if (agnss_ref_location_.valid == true)
+                {
+                    LLH_rad = arma::vec{degtorad(agnss_ref_location_.lat), degtorad(agnss_ref_location_.lon), 0.0};
+                    rx_utc_time = time(nullptr);
+                }
+            else
+                {
+                    // nothing to predict from yet
+                    continue;
+                }
+
+            arma::mat C_tmp = arma::zeros(3, 3);
+            arma::vec r_eb_e = arma::zeros(3, 1);
+            arma::vec v_eb_e = arma::zeros(3, 1);
+            Geo_to_ECEF(LLH_rad, arma::vec{0, 0, 0}, C_tmp, r_eb_e, v_eb_e, C_tmp);
+
+            gtime_t utc_gtime;
+            utc_gtime.time = rx_utc_time;
+            utc_gtime.sec = 0.0;
+            const gtime_t gps_gtime = utc2gpst(utc_gtime);
+            gtime_t gps_gtime_plus = gps_gtime;
+            gps_gtime_plus.sec += dt_s;
+
+            // Predicted Doppler at the L1/E1 carrier for a static receiver:
+            // f_d = -(v_sat . u_los) f_1 / c, plus the common Doppler bias
+            // caused by the receiver oscillator drift (about 1.5 kHz/ppm at
+            // L1, so a TCXO temperature ramp would otherwise defeat the
+            // narrowed assisted search). The assisted search span configured
+            // in the channels absorbs the remaining prediction error
+            // (satellite acceleration and receiver motion)
+            const double rx_clock_drift_ppm = pvt_ptr->get_rx_clock_drift_ppm();
+            const double oscillator_doppler_l1_hz = -rx_clock_drift_ppm * 1.0e-6 * FREQ1;
+            std::map<std::pair<char, uint32_t>, double> predictions_hz;
+            const auto push_prediction = [&predictions_hz, &r_eb_e, dt_s, oscillator_doppler_l1_hz](char system, uint32_t prn,
+                                             const std::array<double, 3> &r_sat_t1, const std::array<double, 3> &r_sat_t2) {
+                const arma::vec r_sat = arma::vec{r_sat_t1[0], r_sat_t1[1], r_sat_t1[2]};
+                const arma::vec v_sat = (arma::vec{r_sat_t2[0], r_sat_t2[1], r_sat_t2[2]} - r_sat) / dt_s;
+                const arma::vec dx = r_sat - r_eb_e;
+                double Az;
+                double El;
+                double dist_m;
+                topocent(&Az, &El, &dist_m, r_eb_e, dx);
+                if (El <= 0.0)
+                    {
+                        return;
+                    }
+                const double range_rate_m_s = arma::dot(v_sat, dx / arma::norm(dx));
+                predictions_hz[{system, prn}] = -range_rate_m_s * FREQ1 / SPEED_OF_LIGHT_M_S + oscillator_doppler_l1_hz;
+            };
+
+            std::array<double, 3> r_sat_t1{};
+            std::array<double, 3> r_sat_t2{};
+            double clock_bias_s;
+            double sat_pos_variance_m2;
+
+            for (const auto &it : pvt_ptr->get_gps_ephemeris())
+                {
+                    const eph_t rtklib_eph = eph_to_rtklib(it.second, pre_2009_file_);
+                    eph2pos(gps_gtime, &rtklib_eph, r_sat_t1.data(), &clock_bias_s, &sat_pos_variance_m2);
+                    eph2pos(gps_gtime_plus, &rtklib_eph, r_sat_t2.data(), &clock_bias_s, &sat_pos_variance_m2);
+                    push_prediction('G', it.second.PRN, r_sat_t1, r_sat_t2);
+                }
+
+            for (const auto &it : pvt_ptr->get_galileo_ephemeris())
+                {
+                    const eph_t rtklib_eph = eph_to_rtklib(it.second);
+                    eph2pos(gps_gtime, &rtklib_eph, r_sat_t1.data(), &clock_bias_s, &sat_pos_variance_m2);
+                    eph2pos(gps_gtime_plus, &rtklib_eph, r_sat_t2.data(), &clock_bias_s, &sat_pos_variance_m2);
+                    push_prediction('E', it.second.PRN, r_sat_t1, r_sat_t2);
+                }
+
+            // almanac fallback for the satellites without ephemeris, with the
+            // same time handling as get_visible_sats()
+            gtime_t alm_gtime;
+            alm_gtime.time = fmod(utc2gpst(gps_gtime).time + 345600, 604800);
+            alm_gtime.sec = 0.0;
+            gtime_t alm_gtime_plus = alm_gtime;
+            alm_gtime_plus.sec += dt_s;
+
+            for (const auto &it : pvt_ptr->get_gps_almanac())
+                {
+                    if (predictions_hz.find({'G', it.second.PRN}) != predictions_hz.end())
+                        {
+                            continue;
+                        }
+                    const alm_t rtklib_alm = alm_to_rtklib(it.second);
+                    alm2pos(alm_gtime, &rtklib_alm, r_sat_t1.data(), &clock_bias_s);
+                    alm2pos(alm_gtime_plus, &rtklib_alm, r_sat_t2.data(), &clock_bias_s);
+                    push_prediction('G', it.second.PRN, r_sat_t1, r_sat_t2);
+                }
+
+            for (const auto &it : pvt_ptr->get_galileo_almanac())
+                {
+                    if (predictions_hz.find({'E', it.second.PRN}) != predictions_hz.end())
+                        {
+                            continue;
+                        }
+                    const alm_t rtklib_alm = alm_to_rtklib(it.second);
+                    alm2pos(alm_gtime, &rtklib_alm, r_sat_t1.data(), &clock_bias_s);
+                    alm2pos(alm_gtime_plus, &rtklib_alm, r_sat_t2.data(), &clock_bias_s);
+                    push_prediction('E', it.second.PRN, r_sat_t1, r_sat_t2);
+                }
+
+            flowgraph_->update_acq_doppler_predictions(predictions_hz);
+            DLOG(INFO) << "Acquisition Doppler predictor: " << predictions_hz.size() << " satellite(s) predicted";
+        }
+}
+
+
+void ControlThread::visibility_scheduler()
+{
+    const int period_s = configuration_->property("GNSS-SDR.visibility_scheduler_period_s", 30);
+    const std::shared_ptr<PvtInterface> pvt_ptr = flowgraph_->get_pvt();
+
+    while (!stop_)
+        {
+            // sleep in one-second slices so shutdown is not delayed by a whole period
+            for (int slept_s = 0; (slept_s < period_s) && !stop_; slept_s++)
+                {
+                    std::this_thread::sleep_for(std::chrono::seconds(1));
+                }
+            if (stop_)
+                {
+                    break;
+                }
+
+            // Reference position and time: the latest PVT fix when available,
+            // the A-GNSS reference location otherwise
+            double rx_longitude_deg;
+            double rx_latitude_deg;
+            double rx_height_m;
+            double ground_speed_kmh;
+            double course_over_ground_deg;
+            time_t rx_utc_time = 0;
+            std::array<float, 3> LLH{};
+            if (pvt_ptr->get_latest_PVT(&rx_longitude_deg, &rx_latitude_deg, &rx_height_m,
+                    &ground_speed_kmh, &course_over_ground_deg, &rx_utc_time) == true)
+                {
+                    LLH[0] = static_cast<float>(rx_latitude_deg);
+                    LLH[1] = static_cast<float>(rx_longitude_deg);
+                    LLH[2] = static_cast<float>(rx_height_m);
+                }
+            else if (agnss_ref_location_.valid == true)
+                {
+                    LLH[0] = agnss_ref_location_.lat;
+                    LLH[1] = agnss_ref_location_.lon;
+                    rx_utc_time = time(nullptr);
+                }
+            else
+                {
+                    // nothing to schedule from yet
+                    continue;
+                }
+
+            const std::vector<std::pair<int, Gnss_Satellite>> visible_sats = get_visible_sats(rx_utc_time, LLH, false);
+            if (visible_sats.empty())
+                {
+                    continue;
+                }
+            // move the visible satellites, ordered by elevation, to the head
+            // of the search lists, so cold channels do not waste full
+            // acquisition sweeps on satellites below the horizon
+            flowgraph_->priorize_satellites(visible_sats);
+            DLOG(INFO) << "Visibility scheduler: " << visible_sats.size() << " satellite(s) predicted above the horizon";
+        }
+}
+
+
 void ControlThread::gps_acq_assist_data_collector() const
 {
     // ############ 1.bis READ EPHEMERIS/UTC_MODE/IONO QUEUE ####################
@@ -1160,6 +1494,52 @@ void ControlThread::gps_acq_assist_data_collector() const
 }
 
 
+void ControlThread::warm_start_load()
+{
+    const std::string filename = configuration_->property("GNSS-SDR.warm_start_file", std::string("./warm_start.bin"));
+    const auto max_age_s = static_cast<int64_t>(configuration_->property("GNSS-SDR.warm_start_max_age_s", 3600));
+    const std::vector<Warm_Start_Record> records = Warm_Start_Snapshot::load(filename, max_age_s);
+    if (records.empty())
+        {
+            return;
+        }
+    // narrow the Doppler search of the channels that got one of the
+    // snapshotted satellites assigned
+    flowgraph_->seed_warm_start(records);
+    // and make the Doppler estimates available to the assisted acquisition
+    // implementations through the global acquisition assistance map
+    for (const auto &record : records)
+        {
+            if (record.system == 'G' && record.signal[0] == '1' && record.signal[1] == 'C')
+                {
+                    Gps_Acq_Assist gps_acq;
+                    gps_acq.PRN = record.prn;
+                    gps_acq.tow = record.rx_time_s;
+                    gps_acq.Doppler0 = record.doppler_hz;
+                    global_gps_acq_assist_map.write(static_cast<int>(gps_acq.PRN), gps_acq);
+                }
+        }
+    std::cout << "Warm start: loaded " << records.size() << " satellite record(s) from " << filename << '\n';
+}
+
+
+void ControlThread::warm_start_save()
+{
+    const std::string filename = configuration_->property("GNSS-SDR.warm_start_file", std::string("./warm_start.bin"));
+    const std::vector<Warm_Start_Record> records = flowgraph_->warm_start_records();
+    if (records.empty())
+        {
+            // keep a previous snapshot rather than overwriting it with nothing
+            LOG(INFO) << "Warm start: no channel with valid telemetry, snapshot not updated";
+            return;
+        }
+    if (Warm_Start_Snapshot::save(filename, records))
+        {
+            std::cout << "Warm start: saved " << records.size() << " satellite record(s) to " << filename << '\n';
+        }
+}
+
+
 void ControlThread::sysv_queue_listener()
 {
     typedef struct
@@ -1219,6 +1599,121 @@ void ControlThread::keyboard_listener()
 }
 
 
+void ControlThread::config_reload_listener()
+{
+    const auto current_config = std::dynamic_pointer_cast<FileConfiguration>(configuration_);
+    if (!current_config)
+        {
+            return;
+        }
+    const std::string config_file = current_config->filename();
+    struct stat file_status
+    {
+    };
+    if (stat(config_file.c_str(), &file_status) != 0)
+        {
+            return;
+        }
+    time_t last_mtime = file_status.st_mtime;
+
+    // parameters with runtime setters, pushed into the running channels
+    const auto is_hot_key = [](const std::string& key) {
+        if (key.compare(0, std::string("gnss-sdr.acquisition_").size(), "gnss-sdr.acquisition_") != 0)
+            {
+                return false;
+            }
+        for (const auto* suffix : {".doppler_max", ".doppler_step", ".doppler_center", ".threshold"})
+            {
+                const std::string suffix_str(suffix);
+                if (key.size() > suffix_str.size() && key.compare(key.size() - suffix_str.size(), suffix_str.size(), suffix_str) == 0)
+                    {
+                        return true;
+                    }
+            }
+        return false;
+    };
+
+    while (!stop_)
+        {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            if (stop_)
+                {
+                    break;
+                }
+            if (stat(config_file.c_str(), &file_status) != 0)
+                {
+                    continue;
+                }
+            if (file_status.st_mtime == last_mtime)
+                {
+                    continue;
+                }
+            last_mtime = file_status.st_mtime;
+
+            const auto new_config = std::make_shared<FileConfiguration>(config_file);
+            if (!new_config->has_section())
+                {
+                    LOG(WARNING) << "Configuration hot reload: " << config_file << " is malformed, keeping the running configuration";
+                    continue;
+                }
+
+            // diff the property maps of the two file snapshots
+            const auto& old_values = current_config->ini_values();
+            const auto& new_values = new_config->ini_values();
+            bool hot_changes = false;
+            std::vector<std::string> restart_keys;
+            for (const auto& property : new_values)
+                {
+                    const auto old_property = old_values.find(property.first);
+                    if (old_property != old_values.end() && old_property->second == property.second)
+                        {
+                            continue;
+                        }
+                    if (is_hot_key(property.first))
+                        {
+                            hot_changes = true;
+                        }
+                    else
+                        {
+                            restart_keys.push_back(property.first);
+                        }
+                }
+            for (const auto& property : old_values)
+                {
+                    if (new_values.find(property.first) == new_values.end())
+                        {
+                            restart_keys.push_back(property.first);
+                        }
+                }
+
+            if (hot_changes)
+                {
+                    LOG(INFO) << "Configuration hot reload: applying acquisition parameter changes from " << config_file;
+                    flowgraph_->apply_hot_configuration(new_config);
+                }
+            if (!restart_keys.empty())
+                {
+                    std::string key_list;
+                    for (const auto& key : restart_keys)
+                        {
+                            key_list += ' ' + key;
+                        }
+                    if (new_config->property("GNSS-SDR.hot_reload_restart", false))
+                        {
+                            std::cout << "Configuration changes require a restart, restarting the receiver\n";
+                            LOG(INFO) << "Configuration hot reload: restarting to apply:" << key_list;
+                            control_queue_->push(pmt::make_any(command_event_make(200, 1)));
+                        }
+                    else
+                        {
+                            LOG(WARNING) << "Configuration hot reload: the following changes have no runtime setter "
+                                         << "and need a receiver restart:" << key_list;
+                        }
+                }
+        }
+}
+
+
 void ControlThread::print_help_at_exit() const
 {
     std::cerr << "Error: the configuration file is not well formatted\n";
@@ -142,17 +142,39 @@ private:
     /*
      * Compute elevations for the specified time and position for all the available satellites in ephemeris and almanac queues
      * returns a vector filled with the available satellites ordered from high elevation to low elevation angle.
+     * The per-satellite report on the standard output can be muted with print_status = false.
      */
-    std::vector<std::pair<int, Gnss_Satellite>> get_visible_sats(time_t rx_utc_time, const std::array<float, 3> &LLH);
+    std::vector<std::pair<int, Gnss_Satellite>> get_visible_sats(time_t rx_utc_time, const std::array<float, 3> &LLH, bool print_status = true);
 
     /*
      * Read initial GNSS assistance from SUPL server or local XML files
      */
     void assist_GNSS();
 
+    // Warm-start snapshot: restore / persist per-satellite Doppler estimates
+    // across power cycles (GNSS-SDR.enable_warm_start)
+    void warm_start_load();
+    void warm_start_save();
+
     void telecommand_listener();
     void keyboard_listener();
     void sysv_queue_listener();
+
+    // Watch the configuration file (GNSS-SDR.enable_config_hot_reload) and
+    // push parameter changes with runtime setters into the running flowgraph
+    void config_reload_listener();
+
+    // Periodically predict the per-satellite Doppler from almanac/ephemeris
+    // and the last known position (GNSS-SDR.enable_acq_doppler_prediction)
+    // and push the predictions into the flowgraph, so acquisition searches a
+    // narrow window around them instead of the full grid
+    void acq_doppler_predictor();
+
+    // Periodically reorder the satellite search lists by the elevation
+    // predicted from almanac/ephemeris and the last known position
+    // (GNSS-SDR.enable_visibility_scheduler), so cold channels do not waste
+    // full acquisition sweeps on satellites below the horizon
+    void visibility_scheduler();
     void print_help_at_exit() const;
 
     // default filename for assistance data
@@ -178,10 +200,14 @@ private:
     std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue_;
     std::shared_ptr<GNSSFlowgraph> flowgraph_;
 
+    std::thread assist_thread_;
     std::thread cmd_interface_thread_;
     std::thread keyboard_thread_;
     std::thread sysv_queue_thread_;
     std::thread gps_acq_assist_data_collector_thread_;
+    std::thread config_reload_thread_;
+    std::thread acq_doppler_predictor_thread_;
+    std::thread visibility_scheduler_thread_;
 
 #ifdef ENABLE_FPGA
     boost::thread fpga_helper_thread_;
@@ -20,9 +20,13 @@
  */
 
 #include "file_configuration.h"
+#include "config_snapshot.h"
+#include "gnss_sdr_flags.h"
 #include "gnss_sdr_make_unique.h"
+#include "startup_profiler.h"
 #include <glog/logging.h>
 #include <iostream>
+#include <map>
 #include <utility>
 
 
@@ -44,11 +48,31 @@ void FileConfiguration::init()
 {
     converter_ = std::make_unique<StringConverter>();
     overrided_ = std::make_unique<InMemoryConfiguration>();
-    ini_reader_ = std::make_unique<INIReader>(filename_);
+    const std::string snapshot_filename = filename_ + ".snap";
+    if (FLAGS_compiled_config)
+        {
+            Scoped_Startup_Timer timer("config_snapshot_load");
+            std::map<std::string, std::string> values;
+            if (Config_Snapshot::load(snapshot_filename, filename_, values))
+                {
+                    ini_reader_ = std::make_unique<INIReader>(std::move(values));
+                    error_ = 0;
+                    DLOG(INFO) << "Configuration loaded from compiled snapshot " << snapshot_filename;
+                    return;
+                }
+        }
+    {
+        Scoped_Startup_Timer timer("config_parse");
+        ini_reader_ = std::make_unique<INIReader>(filename_);
+    }
     error_ = ini_reader_->ParseError();
     if (error_ == 0)
         {
             DLOG(INFO) << "Configuration file " << filename_ << " opened with no errors";
+            if (FLAGS_compiled_config)
+                {
+                    Config_Snapshot::save(snapshot_filename, filename_, ini_reader_->Values());
+                }
         }
     else if (error_ > 0)
         {
@@ -67,6 +91,18 @@ bool FileConfiguration::has_section() const
 }
 
 
+const std::string& FileConfiguration::filename() const
+{
+    return filename_;
+}
+
+
+const std::map<std::string, std::string>& FileConfiguration::ini_values() const
+{
+    return ini_reader_->Values();
+}
+
+
 std::string FileConfiguration::property(std::string property_name, std::string default_value) const
 {
     if (overrided_->is_present(property_name))
@@ -27,6 +27,7 @@
 #include "in_memory_configuration.h"
 #include "string_converter.h"
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 
@@ -65,6 +66,12 @@ public:
     bool is_present(const std::string& property_name) const;
     bool has_section() const;
 
+    //! Gets the name of the configuration file
+    const std::string& filename() const;
+
+    //! Gets all the properties read from the file, keyed in lower case
+    const std::map<std::string, std::string>& ini_values() const;
+
 private:
     void init();
     std::string filename_;
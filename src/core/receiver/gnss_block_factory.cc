@@ -39,6 +39,7 @@
 #include "direct_resampler_conditioner.h"
 #include "fifo_signal_source.h"
 #include "file_signal_source.h"
+#include "file_signal_source_mmap.h"
 #include "file_timestamp_signal_source.h"
 #include "fir_filter.h"
 #include "four_bit_cpx_file_signal_source.h"
@@ -88,6 +89,7 @@
 #include "gps_l5_dll_pll_tracking.h"
 #include "gps_l5_telemetry_decoder.h"
 #include "gps_l5i_pcps_acquisition.h"
+#include "half_band_resampler_conditioner.h"
 #include "hybrid_observables.h"
 #include "ibyte_to_cbyte.h"
 #include "ibyte_to_complex.h"
@@ -97,6 +99,8 @@
 #include "ishort_to_cshort.h"
 #include "labsat_signal_source.h"
 #include "mmse_resampler_conditioner.h"
+#include "ion_metadata_signal_source.h"
+#include "multicast_signal_source.h"
 #include "multichannel_file_signal_source.h"
 #include "notch_filter.h"
 #include "notch_filter_lite.h"
@@ -114,14 +118,21 @@
 #include "two_bit_cpx_file_signal_source.h"
 #include "two_bit_packed_file_signal_source.h"
 #include <glog/logging.h>
+#include <atomic>     // for atomic
 #include <exception>  // for exception
 #include <iostream>   // for cerr
+#include <mutex>      // for mutex
+#include <thread>     // for thread
 #include <utility>    // for move
 
 #if RAW_UDP
 #include "custom_udp_signal_source.h"
 #endif
 
+#if LZ4_CAPTURE
+#include "file_signal_source_lz4.h"
+#endif
+
 #if ENABLE_FPGA
 #include "galileo_e1_dll_pll_veml_tracking_fpga.h"
 #include "galileo_e1_pcps_ambiguous_acquisition_fpga.h"
@@ -179,6 +190,7 @@
 
 #if CUDA_GPU_ACCEL
 #include "gps_l1_ca_dll_pll_tracking_gpu.h"
+#include "gpu_fft_resampler_conditioner.h"
 #endif
 
 using namespace std::string_literals;
@@ -410,19 +422,32 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetChannel(
             return nullptr;
         }
 
+    // Telemetry-free channel profile (Channels.telemetry_free), for raw
+    // observable streaming applications (e.g. scintillation monitors) that
+    // only need phase/Doppler/C-N0 at high rate: the telemetry decoder block
+    // is not instantiated at all and the tracking output feeds the
+    // observables block directly, saving its scheduler thread per channel.
+    // No navigation data is decoded, so no pseudoranges or PVT are formed
+    bool telemetry_free = configuration->property("Channels.telemetry_free", false);
+    telemetry_free = configuration->property("Channels_" + signal + ".telemetry_free", telemetry_free);
+
     LOG(INFO) << "Instantiating Channel " << channel
               << " with Acquisition Implementation: "
               << configuration->property("Acquisition_" + signal + appendix1 + impl_prop, std::string("W"))
               << ", Tracking Implementation: "
               << configuration->property("Tracking_" + signal + appendix2 + impl_prop, std::string("W"))
               << ", Telemetry Decoder implementation: "
-              << configuration->property("TelemetryDecoder_" + signal + appendix3 + impl_prop, std::string("W"));
+              << (telemetry_free ? std::string("none (telemetry-free channel)") : configuration->property("TelemetryDecoder_" + signal + appendix3 + impl_prop, std::string("W")));
 
     std::unique_ptr<AcquisitionInterface> acq_ = GetAcqBlock(configuration, "Acquisition_" + signal + appendix1, 1, 0);
     std::unique_ptr<TrackingInterface> trk_ = GetTrkBlock(configuration, "Tracking_" + signal + appendix2, 1, 1);
-    std::unique_ptr<TelemetryDecoderInterface> tlm_ = GetTlmBlock(configuration, "TelemetryDecoder_" + signal + appendix3, 1, 1);
+    std::unique_ptr<TelemetryDecoderInterface> tlm_;
+    if (!telemetry_free)
+        {
+            tlm_ = GetTlmBlock(configuration, "TelemetryDecoder_" + signal + appendix3, 1, 1);
+        }
 
-    if (acq_ == nullptr or trk_ == nullptr or tlm_ == nullptr)
+    if (acq_ == nullptr or trk_ == nullptr or (tlm_ == nullptr and !telemetry_free))
         {
             return nullptr;
         }
@@ -444,7 +469,8 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetChannel(
 
 std::unique_ptr<std::vector<std::unique_ptr<GNSSBlockInterface>>> GNSSBlockFactory::GetChannels(
     const ConfigurationInterface* configuration,
-    Concurrent_Queue<pmt::pmt_t>* queue)
+    Concurrent_Queue<pmt::pmt_t>* queue,
+    int channel_id_offset)
 {
     int channel_absolute_id = 0;
 
@@ -475,147 +501,99 @@ std::unique_ptr<std::vector<std::unique_ptr<GNSSBlockInterface>>> GNSSBlockFacto
     auto channels = std::make_unique<std::vector<std::unique_ptr<GNSSBlockInterface>>>(total_channels);
     try
         {
-            // **************** GPS L1 C/A CHANNELS ****************************
-            LOG(INFO) << "Getting " << Channels_1C_count << " GPS L1 C/A channels";
-
-            for (unsigned int i = 0; i < Channels_1C_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("1C"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** GPS L2C (M) CHANNELS ***************************
-            LOG(INFO) << "Getting " << Channels_2S_count << " GPS L2C (M) channels";
-
-            for (unsigned int i = 0; i < Channels_2S_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("2S"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** GPS L5 CHANNELS ********************************
-            LOG(INFO) << "Getting " << Channels_L5_count << " GPS L5 channels";
-
-            for (unsigned int i = 0; i < Channels_L5_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("L5"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** GALILEO E1 B (I/NAV OS) CHANNELS ***************
-            LOG(INFO) << "Getting " << Channels_1B_count << " GALILEO E1 B (I/NAV OS) channels";
-
-            for (unsigned int i = 0; i < Channels_1B_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("1B"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** GALILEO E5a I (F/NAV OS) CHANNELS **************
-            LOG(INFO) << "Getting " << Channels_5X_count << " GALILEO E5a I (F/NAV OS) channels";
-
-            for (unsigned int i = 0; i < Channels_5X_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("5X"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** GALILEO E6 (B/C HAS) CHANNELS **************
-            LOG(INFO) << "Getting " << Channels_E6_count << " GALILEO E6 (B/C HAS) channels";
-
-            for (unsigned int i = 0; i < Channels_E6_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("E6"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** GLONASS L1 C/A CHANNELS ************************
-            LOG(INFO) << "Getting " << Channels_1G_count << " GLONASS L1 C/A channels";
-
-            for (unsigned int i = 0; i < Channels_1G_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("1G"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** GLONASS L2 C/A CHANNELS ************************
-            LOG(INFO) << "Getting " << Channels_2G_count << " GLONASS L2 C/A channels";
-
-            for (unsigned int i = 0; i < Channels_2G_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("2G"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** BEIDOU B1I CHANNELS ****************************
-            LOG(INFO) << "Getting " << Channels_B1_count << " BEIDOU B1I channels";
-
-            for (unsigned int i = 0; i < Channels_B1_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("B1"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** BEIDOU B3I CHANNELS ****************************
-            LOG(INFO) << "Getting " << Channels_B3_count << " BEIDOU B3I channels";
-
-            for (unsigned int i = 0; i < Channels_B3_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("B3"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
+            // Assign an absolute channel id to each configured signal, keeping
+            // the historical ordering of the channel vector
+            std::vector<std::string> channel_signals;
+            channel_signals.reserve(total_channels);
+            const auto append_signals = [&channel_signals](const std::string& signal, unsigned int count, const char* description) {
+                LOG(INFO) << "Getting " << count << ' ' << description << " channels";
+                for (unsigned int i = 0; i < count; i++)
+                    {
+                        channel_signals.push_back(signal);
+                    }
+            };
+
+            append_signals("1C", Channels_1C_count, "GPS L1 C/A");
+            append_signals("2S", Channels_2S_count, "GPS L2C (M)");
+            append_signals("L5", Channels_L5_count, "GPS L5");
+            append_signals("1B", Channels_1B_count, "GALILEO E1 B (I/NAV OS)");
+            append_signals("5X", Channels_5X_count, "GALILEO E5a I (F/NAV OS)");
+            append_signals("E6", Channels_E6_count, "GALILEO E6 (B/C HAS)");
+            append_signals("1G", Channels_1G_count, "GLONASS L1 C/A");
+            append_signals("2G", Channels_2G_count, "GLONASS L2 C/A");
+            append_signals("B1", Channels_B1_count, "BEIDOU B1I");
+            append_signals("B3", Channels_B3_count, "BEIDOU B3I");
+            append_signals("7X", Channels_7X_count, "GALILEO E5b I (I/NAV OS)");
+
+            // Channels are independent until the flowgraph connects them, so
+            // they can be instantiated concurrently. FFTW plan creation is
+            // serialized internally by GNU Radio, so concurrent block
+            // constructors are safe
+            int requested_threads = configuration->property("GNSS-SDR.channel_init_threads", static_cast<int>(std::thread::hardware_concurrency()));
+            if (requested_threads < 1)
+                {
+                    requested_threads = 1;
+                }
+            unsigned int num_threads = static_cast<unsigned int>(requested_threads);
+            if (num_threads > total_channels)
+                {
+                    num_threads = total_channels;
+                }
+
+            if (num_threads <= 1)
+                {
+                    for (channel_absolute_id = 0; channel_absolute_id < static_cast<int>(total_channels); channel_absolute_id++)
+                        {
+                            // Store the channel into the vector of channels
+                            channels->at(channel_absolute_id) = GetChannel(configuration,
+                                channel_signals[channel_absolute_id],
+                                channel_absolute_id + channel_id_offset,
+                                queue);
+                        }
                 }
-
-            // **************** GALILEO E5b I (I/NAV OS) CHANNELS **************
-            LOG(INFO) << "Getting " << Channels_7X_count << " GALILEO E5b I (I/NAV OS) channels";
-
-            for (unsigned int i = 0; i < Channels_7X_count; i++)
+            else
                 {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("7X"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
+                    LOG(INFO) << "Instantiating " << total_channels << " channels with " << num_threads << " threads";
+                    std::atomic<unsigned int> next_channel(0);
+                    std::mutex error_mutex;
+                    std::exception_ptr first_error = nullptr;
+                    const auto worker = [&]() {
+                        unsigned int ch;
+                        while ((ch = next_channel.fetch_add(1)) < total_channels)
+                            {
+                                try
+                                    {
+                                        channels->at(ch) = GetChannel(configuration,
+                                            channel_signals[ch],
+                                            static_cast<int>(ch) + channel_id_offset,
+                                            queue);
+                                    }
+                                catch (const std::exception&)
+                                    {
+                                        std::lock_guard<std::mutex> lock(error_mutex);
+                                        if (first_error == nullptr)
+                                            {
+                                                first_error = std::current_exception();
+                                            }
+                                    }
+                            }
+                    };
+
+                    std::vector<std::thread> pool;
+                    pool.reserve(num_threads - 1);
+                    for (unsigned int t = 0; t < num_threads - 1; t++)
+                        {
+                            pool.emplace_back(worker);
+                        }
+                    worker();
+                    for (auto& thread : pool)
+                        {
+                            thread.join();
+                        }
+                    if (first_error != nullptr)
+                        {
+                            std::rethrow_exception(first_error);
+                        }
                 }
         }
     catch (const std::exception& e)
@@ -668,6 +646,20 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetBlock(
                         out_streams, queue);
                     block = std::move(block_);
                 }
+            else if (implementation == "File_Signal_Source_Mmap")
+                {
+                    std::unique_ptr<GNSSBlockInterface> block_ = std::make_unique<FileSignalSourceMmap>(configuration, role, in_streams,
+                        out_streams, queue);
+                    block = std::move(block_);
+                }
+#if LZ4_CAPTURE
+            else if (implementation == "File_Signal_Source_Lz4")
+                {
+                    std::unique_ptr<GNSSBlockInterface> block_ = std::make_unique<FileSignalSourceLz4>(configuration, role, in_streams,
+                        out_streams, queue);
+                    block = std::move(block_);
+                }
+#endif
             else if (implementation == "File_Timestamp_Signal_Source")
                 {
                     std::unique_ptr<GNSSBlockInterface> block_ = std::make_unique<FileTimestampSignalSource>(configuration, role, in_streams,
@@ -680,6 +672,18 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetBlock(
                         out_streams, queue);
                     block = std::move(block_);
                 }
+            else if (implementation == "ION_Metadata_Signal_Source")
+                {
+                    std::unique_ptr<GNSSBlockInterface> block_ = std::make_unique<IonMetadataSignalSource>(configuration, role, in_streams,
+                        out_streams, queue);
+                    block = std::move(block_);
+                }
+            else if (implementation == "Multicast_Signal_Source")
+                {
+                    std::unique_ptr<GNSSBlockInterface> block_ = std::make_unique<MulticastSignalSource>(configuration, role, in_streams,
+                        out_streams, queue);
+                    block = std::move(block_);
+                }
 #if RAW_UDP
             else if (implementation == "Custom_UDP_Signal_Source")
                 {
@@ -911,6 +915,13 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetBlock(
                     block = std::move(block_);
                 }
 
+            else if (implementation == "Half_Band_Resampler")
+                {
+                    std::unique_ptr<GNSSBlockInterface> block_ = std::make_unique<HalfBandResamplerConditioner>(configuration, role,
+                        in_streams, out_streams);
+                    block = std::move(block_);
+                }
+
             else if ((implementation == "Fractional_Resampler") || (implementation == "Mmse_Resampler"))
                 {
                     std::unique_ptr<GNSSBlockInterface> block_ = std::make_unique<MmseResamplerConditioner>(configuration, role,
@@ -918,6 +929,15 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetBlock(
                     block = std::move(block_);
                 }
 
+#if CUDA_GPU_ACCEL
+            else if (implementation == "GPU_FFT_Resampler")
+                {
+                    std::unique_ptr<GNSSBlockInterface> block_ = std::make_unique<GpuFftResamplerConditioner>(configuration, role,
+                        in_streams, out_streams);
+                    block = std::move(block_);
+                }
+#endif
+
             // ACQUISITION BLOCKS ------------------------------------------------------
             else if (implementation == "GPS_L1_CA_PCPS_Acquisition")
                 {
@@ -57,8 +57,10 @@ public:
 
     std::unique_ptr<GNSSBlockInterface> GetSignalConditioner(const ConfigurationInterface* configuration, int ID = -1);
 
+    //! channel_id_offset shifts the absolute channel numbering, so a second
+    //! channel set (e.g. the B set of an A/B fork) gets non-colliding IDs
     std::unique_ptr<std::vector<std::unique_ptr<GNSSBlockInterface>>> GetChannels(const ConfigurationInterface* configuration,
-        Concurrent_Queue<pmt::pmt_t>* queue);
+        Concurrent_Queue<pmt::pmt_t>* queue, int channel_id_offset = 0);
 
     std::unique_ptr<GNSSBlockInterface> GetObservables(const ConfigurationInterface* configuration);
 
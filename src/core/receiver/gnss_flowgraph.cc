@@ -27,42 +27,55 @@
 #include "Galileo_E5a.h"
 #include "Galileo_E5b.h"
 #include "Galileo_E6.h"
+#include "ab_fork_configuration.h"
 #include "channel.h"
 #include "channel_fsm.h"
 #include "channel_interface.h"
 #include "configuration_interface.h"
+#include "event_log.h"
 #include "gnss_block_factory.h"
 #include "gnss_block_interface.h"
 #include "gnss_satellite.h"
 #include "gnss_sdr_make_unique.h"
 #include "gnss_synchro_monitor.h"
+#include "latency_tracer.h"
 #include "nav_message_monitor.h"
 #include "signal_source_interface.h"
-#include <boost/lexical_cast.hpp>    // for boost::lexical_cast
-#include <boost/tokenizer.hpp>       // for boost::tokenizer
-#include <glog/logging.h>            // for LOG
-#include <gnuradio/basic_block.h>    // for basic_block
-#include <gnuradio/filter/firdes.h>  // for gr::filter::firdes
-#include <gnuradio/io_signature.h>   // for io_signature
-#include <gnuradio/top_block.h>      // for top_block, make_top_block
-#include <pmt/pmt_sugar.h>           // for mp
-#include <algorithm>                 // for transform, sort, unique
-#include <cmath>                     // for floor
-#include <cstddef>                   // for size_t
-#include <exception>                 // for exception
-#include <iostream>                  // for operator<<
-#include <iterator>                  // for insert_iterator, inserter
-#include <memory>                    // for std::shared_ptr
-#include <set>                       // for set
-#include <sstream>                   // for std::stringstream
-#include <stdexcept>                 // for invalid_argument
-#include <thread>                    // for std::thread
-#include <utility>                   // for std::move
+#include "startup_profiler.h"
+#include "udp_batch_sender.h"
+#include <boost/lexical_cast.hpp>     // for boost::lexical_cast
+#include <boost/tokenizer.hpp>        // for boost::tokenizer
+#include <glog/logging.h>             // for LOG
+#include <gnuradio/basic_block.h>     // for basic_block
+#include <gnuradio/block.h>           // for block, set_processor_affinity
+#include <gnuradio/filter/firdes.h>   // for gr::filter::firdes
+#include <gnuradio/high_res_timer.h>  // for high_res_timer_tps
+#include <gnuradio/io_signature.h>    // for io_signature
+#include <gnuradio/prefs.h>           // for gr::prefs
+#include <gnuradio/top_block.h>       // for top_block, make_top_block
+#include <pmt/pmt_sugar.h>            // for mp
+#include <algorithm>                  // for transform, sort, unique
+#include <chrono>                     // for steady_clock
+#include <cmath>                      // for floor
+#include <cstddef>                    // for size_t
+#include <cstdint>                    // for uint16_t
+#include <exception>                  // for exception
+#include <iostream>                   // for operator<<
+#include <iterator>                   // for insert_iterator, inserter
+#include <map>                        // for multimap
+#include <memory>                     // for std::shared_ptr
+#include <set>                        // for set
+#include <sstream>                    // for std::stringstream
+#include <stdexcept>                  // for invalid_argument
+#include <thread>                     // for std::thread
+#include <utility>                    // for std::move
 
 #ifdef GR_GREATER_38
 #include <gnuradio/filter/fir_filter_blk.h>
+#include <gnuradio/filter/freq_xlating_fir_filter.h>
 #else
 #include <gnuradio/filter/fir_filter_ccf.h>
+#include <gnuradio/filter/freq_xlating_fir_filter_ccf.h>
 #endif
 
 
@@ -73,6 +86,8 @@ GNSSFlowgraph::GNSSFlowgraph(std::shared_ptr<ConfigurationInterface> configurati
     std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue)  // NOLINT(performance-unnecessary-value-param)
     : configuration_(std::move(configuration)),
       queue_(std::move(queue)),
+      ab_fork_boundary_(0),
+      ab_fork_enabled_(false),
       connected_(false),
       running_(false),
       multiband_(GNSSFlowgraph::is_multiband()),
@@ -86,6 +101,16 @@ GNSSFlowgraph::GNSSFlowgraph(std::shared_ptr<ConfigurationInterface> configurati
 GNSSFlowgraph::~GNSSFlowgraph()
 {
     DLOG(INFO) << "GNSSFlowgraph destructor called";
+    stop_governor_ = true;
+    if (load_governor_thread_.joinable())
+        {
+            load_governor_thread_.join();
+        }
+    stop_perf_monitor_ = true;
+    if (perf_monitor_thread_.joinable())
+        {
+            perf_monitor_thread_.join();
+        }
     if (connected_)
         {
             GNSSFlowgraph::disconnect();
@@ -100,6 +125,17 @@ void GNSSFlowgraph::init()
      */
     auto block_factory = std::make_unique<GNSSBlockFactory>();
 
+    if (configuration_->property("GNSS-SDR.enable_latency_trace", false))
+        {
+            Latency_Tracer::get_instance().enable();
+        }
+
+    const std::string event_log_filename = configuration_->property("GNSS-SDR.event_log_filename", std::string(""));
+    if (!event_log_filename.empty())
+        {
+            Event_Log::get_instance().enable(event_log_filename);
+        }
+
     channels_status_ = channel_status_msg_receiver_make();
 
     if (configuration_->property("Channels_E6.count", 0) > 0)
@@ -169,6 +205,40 @@ void GNSSFlowgraph::init()
             channels_.push_back(std::dynamic_pointer_cast<ChannelInterface>(chan_));
         }
 
+    // A/B fork: append a shadow channel set built from the AB_Fork.* overlay,
+    // with its own observables and PVT instances, fed from the same
+    // conditioned sample stream as the A set for sample-accurate comparison
+    ab_fork_enabled_ = configuration_->property("GNSS-SDR.enable_ab_fork", false);
+    ab_fork_boundary_ = channels_count_;
+    if (ab_fork_enabled_ && enable_fpga_offloading_)
+        {
+            LOG(WARNING) << "A/B fork is not supported with FPGA off-loading, disabling it";
+            ab_fork_enabled_ = false;
+        }
+    if (ab_fork_enabled_)
+        {
+            const auto fork_configuration = std::make_shared<ABForkConfiguration>(configuration_);
+            auto channels_b = block_factory->GetChannels(fork_configuration.get(), queue_.get(), ab_fork_boundary_);
+            if (static_cast<int>(channels_b->size()) != ab_fork_boundary_)
+                {
+                    LOG(WARNING) << "A/B fork disabled: the AB_Fork.* overlay must not change the number of channels";
+                    std::cout << "A/B fork disabled: the AB_Fork.* overlay must not change the number of channels\n";
+                    ab_fork_enabled_ = false;
+                }
+            else
+                {
+                    observables_b_ = block_factory->GetObservables(fork_configuration.get());
+                    pvt_b_ = block_factory->GetPVT(fork_configuration.get());
+                    for (int i = 0; i < ab_fork_boundary_; i++)
+                        {
+                            std::shared_ptr<GNSSBlockInterface> chan_ = std::move(channels_b->at(i));
+                            channels_.push_back(std::dynamic_pointer_cast<ChannelInterface>(chan_));
+                        }
+                    channels_count_ = static_cast<int>(channels_.size());
+                    std::cout << "A/B fork enabled: " << ab_fork_boundary_ << " shadow channels instantiated from the AB_Fork.* overlay\n";
+                }
+        }
+
     top_block_ = gr::make_top_block("GNSSFlowgraph");
 
     mapStringValues_["1C"] = evGPS_1C;
@@ -205,11 +275,22 @@ void GNSSFlowgraph::init()
             std::sort(udp_addr_vec.begin(), udp_addr_vec.end());
             udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
 
+            // Same-host consumers can read the observables from a seqlock'd
+            // shared-memory ring instead of the UDP stream
+            std::string shm_zone;
+            if (configuration_->property("Monitor.implementation", std::string("UDP")) == "SharedMemory")
+                {
+                    shm_zone = configuration_->property("Monitor.shm_zone", std::string("/gnss_sdr_monitor"));
+                }
+
             // Instantiate monitor object
             GnssSynchroMonitor_ = gnss_synchro_make_monitor(channels_count_,
                 configuration_->property("Monitor.decimation_factor", 1),
                 configuration_->property("Monitor.udp_port", 1234),
-                udp_addr_vec, enable_protobuf);
+                udp_addr_vec, enable_protobuf,
+                shm_zone,
+                configuration_->property("Monitor.shm_capacity", 1024),
+                configuration_->property("Monitor.enable_delta_compression", false));
         }
 
     /*
@@ -229,10 +310,19 @@ void GNSSFlowgraph::init()
             std::sort(udp_addr_vec.begin(), udp_addr_vec.end());
             udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
 
+            std::string shm_zone;
+            if (configuration_->property("AcquisitionMonitor.implementation", std::string("UDP")) == "SharedMemory")
+                {
+                    shm_zone = configuration_->property("AcquisitionMonitor.shm_zone", std::string("/gnss_sdr_monitor_acq"));
+                }
+
             GnssSynchroAcquisitionMonitor_ = gnss_synchro_make_monitor(channels_count_,
                 configuration_->property("AcquisitionMonitor.decimation_factor", 1),
                 configuration_->property("AcquisitionMonitor.udp_port", 1235),
-                udp_addr_vec, enable_protobuf);
+                udp_addr_vec, enable_protobuf,
+                shm_zone,
+                configuration_->property("AcquisitionMonitor.shm_capacity", 1024),
+                configuration_->property("AcquisitionMonitor.enable_delta_compression", false));
         }
 
     /*
@@ -252,10 +342,19 @@ void GNSSFlowgraph::init()
             std::sort(udp_addr_vec.begin(), udp_addr_vec.end());
             udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
 
+            std::string shm_zone;
+            if (configuration_->property("TrackingMonitor.implementation", std::string("UDP")) == "SharedMemory")
+                {
+                    shm_zone = configuration_->property("TrackingMonitor.shm_zone", std::string("/gnss_sdr_monitor_trk"));
+                }
+
             GnssSynchroTrackingMonitor_ = gnss_synchro_make_monitor(channels_count_,
                 configuration_->property("TrackingMonitor.decimation_factor", 1),
                 configuration_->property("TrackingMonitor.udp_port", 1236),
-                udp_addr_vec, enable_protobuf);
+                udp_addr_vec, enable_protobuf,
+                shm_zone,
+                configuration_->property("TrackingMonitor.shm_capacity", 1024),
+                configuration_->property("TrackingMonitor.enable_delta_compression", false));
         }
 
     /*
@@ -269,7 +368,12 @@ void GNSSFlowgraph::init()
             std::vector<std::string> udp_addr_vec = split_string(address_string, '_');
             std::sort(udp_addr_vec.begin(), udp_addr_vec.end());
             udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
-            NavDataMonitor_ = nav_message_monitor_make(udp_addr_vec, configuration_->property("NavDataMonitor.port", 1237));
+            std::string archive_filename;
+            if (configuration_->property("NavDataMonitor.enable_archive", false))
+                {
+                    archive_filename = configuration_->property("NavDataMonitor.archive_filename", std::string("./nav_messages.gnma"));
+                }
+            NavDataMonitor_ = nav_message_monitor_make(udp_addr_vec, configuration_->property("NavDataMonitor.port", 1237), archive_filename);
         }
 }
 
@@ -284,7 +388,16 @@ void GNSSFlowgraph::start()
 
     try
         {
-            top_block_->start();
+            if (configuration_->property("GNSS-SDR.deterministic_profiling", false))
+                {
+                    // fixed scheduler quantum, so every replay issues the same
+                    // sequence of work() calls (see apply_deterministic_profiling)
+                    top_block_->start(configuration_->property("GNSS-SDR.deterministic_profiling_quantum", 4096));
+                }
+            else
+                {
+                    top_block_->start();
+                }
         }
     catch (const std::exception& e)
         {
@@ -303,11 +416,35 @@ void GNSSFlowgraph::start()
         }
 
     running_ = true;
+
+    apply_thread_priorities();
+
+    if (configuration_->property("GNSS-SDR.enable_load_governor", false))
+        {
+            stop_governor_ = false;
+            load_governor_thread_ = std::thread(&GNSSFlowgraph::load_governor, this);
+        }
+
+    if (configuration_->property("PerfMonitor.enable_monitor", false))
+        {
+            stop_perf_monitor_ = false;
+            perf_monitor_thread_ = std::thread(&GNSSFlowgraph::perf_monitor_process, this);
+        }
 }
 
 
 void GNSSFlowgraph::stop()
 {
+    stop_governor_ = true;
+    if (load_governor_thread_.joinable())
+        {
+            load_governor_thread_.join();
+        }
+    stop_perf_monitor_ = true;
+    if (perf_monitor_thread_.joinable())
+        {
+            perf_monitor_thread_.join();
+        }
     for (const auto& chan : channels_)
         {
             chan->stop_channel();  // stop the acquisition or tracking operation
@@ -415,20 +552,29 @@ int GNSSFlowgraph::connect_desktop_flowgraph()
             return 1;
         }
 
-    if (connect_signal_sources() != 0)
-        {
-            return 1;
-        }
-
-    if (connect_signal_conditioners() != 0)
-        {
-            return 1;
-        }
-
-    if (connect_channels() != 0)
-        {
-            return 1;
-        }
+    {
+        Scoped_Startup_Timer timer("connect_signal_sources");
+        if (connect_signal_sources() != 0)
+            {
+                return 1;
+            }
+    }
+
+    {
+        Scoped_Startup_Timer timer("connect_signal_conditioners");
+        if (connect_signal_conditioners() != 0)
+            {
+                return 1;
+            }
+    }
+
+    {
+        Scoped_Startup_Timer timer("connect_channels");
+        if (connect_channels() != 0)
+            {
+                return 1;
+            }
+    }
 
     if (connect_observables() != 0)
         {
@@ -490,6 +636,12 @@ int GNSSFlowgraph::connect_desktop_flowgraph()
                 }
         }
 
+    apply_cpu_placement();
+
+    apply_deterministic_profiling();
+
+    apply_buffer_sizing();
+
     // Activate acquisition in enabled channels
     for (int i = 0; i < channels_count_; i++)
         {
@@ -772,6 +924,10 @@ int GNSSFlowgraph::connect_observables()
     try
         {
             observables_->connect(top_block_);
+            if (ab_fork_enabled_)
+                {
+                    observables_b_->connect(top_block_);
+                }
         }
     catch (const std::exception& e)
         {
@@ -796,6 +952,10 @@ int GNSSFlowgraph::connect_pvt()
     try
         {
             pvt_->connect(top_block_);
+            if (ab_fork_enabled_)
+                {
+                    pvt_b_->connect(top_block_);
+                }
         }
     catch (const std::exception& e)
         {
@@ -817,6 +977,13 @@ int GNSSFlowgraph::connect_galileo_tow_map()
                     std::string sig = channels_.at(i)->get_signal().get_signal_str();
                     if (sig == "1B" || sig == "E6" || sig == "5X" || sig == "7X")
                         {
+                            bool telemetry_free = configuration_->property("Channels.telemetry_free", false);
+                            telemetry_free = configuration_->property("Channels_" + sig + ".telemetry_free", telemetry_free);
+                            if (telemetry_free)
+                                {
+                                    // no telemetry decoder in the channel to exchange TOW with
+                                    continue;
+                                }
                             top_block_->msg_connect(channels_.at(i)->get_right_block(), pmt::mp("TOW_from_TLM"), galileo_tow_map_, pmt::mp("TOW_from_TLM"));
                             top_block_->msg_connect(galileo_tow_map_, pmt::mp("TOW_to_TLM"), channels_.at(i)->get_right_block(), pmt::mp("TOW_to_TLM"));
                         }
@@ -849,7 +1016,12 @@ int GNSSFlowgraph::connect_sample_counter()
             const int observable_interval_ms = configuration_->property("GNSS-SDR.observable_interval_ms", 20);
             ch_out_sample_counter_ = gnss_sdr_make_sample_counter(fs, observable_interval_ms, sig_conditioner_.at(0)->get_right_block()->output_signature()->sizeof_stream_item(0));
             top_block_->connect(sig_conditioner_.at(0)->get_right_block(), 0, ch_out_sample_counter_, 0);
-            top_block_->connect(ch_out_sample_counter_, 0, observables_->get_left_block(), channels_count_);  // extra port for the sample counter pulse
+            top_block_->connect(ch_out_sample_counter_, 0, observables_->get_left_block(), ab_fork_boundary_);  // extra port for the sample counter pulse
+            if (ab_fork_enabled_)
+                {
+                    // both observables instances take the pulse from the same counter, so A and B epochs stay sample aligned
+                    top_block_->connect(ch_out_sample_counter_, 0, observables_b_->get_left_block(), ab_fork_boundary_);
+                }
         }
     catch (const std::exception& e)
         {
@@ -858,6 +1030,33 @@ int GNSSFlowgraph::connect_sample_counter()
             return 1;
         }
     DLOG(INFO) << "sample counter successfully connected to Signal Conditioner and Observables blocks";
+
+    // optional multicast relay: publish the conditioned sample stream to a
+    // multicast group, so any number of processing nodes (running a
+    // Multicast_Signal_Source) can be fed at constant sender bandwidth
+    const std::string multicast_relay_address = configuration_->property("GNSS-SDR.multicast_relay_address", std::string(""));
+    if (!multicast_relay_address.empty())
+        {
+            try
+                {
+                    const int multicast_relay_port = configuration_->property("GNSS-SDR.multicast_relay_port", 21234);
+                    const int multicast_relay_payload_bytes = configuration_->property("GNSS-SDR.multicast_relay_payload_bytes", 1448);
+                    const int multicast_relay_fec_group = configuration_->property("GNSS-SDR.multicast_relay_fec_group", 8);
+                    const int multicast_relay_ttl = configuration_->property("GNSS-SDR.multicast_relay_ttl", 1);
+                    const size_t relay_item_size = sig_conditioner_.at(0)->get_right_block()->output_signature()->sizeof_stream_item(0);
+                    multicast_relay_sink_ = UdpMulticastSink::make(relay_item_size, multicast_relay_address,
+                        static_cast<uint16_t>(multicast_relay_port), multicast_relay_payload_bytes, multicast_relay_fec_group, multicast_relay_ttl);
+                    top_block_->connect(sig_conditioner_.at(0)->get_right_block(), 0, multicast_relay_sink_, 0);
+                    std::cout << "Relaying the conditioned sample stream to multicast group "
+                              << multicast_relay_address << ":" << multicast_relay_port << '\n';
+                }
+            catch (const std::exception& e)
+                {
+                    LOG(ERROR) << "Can't connect multicast relay sink: " << e.what();
+                    top_block_->disconnect_all();
+                    return 1;
+                }
+        }
     return 0;
 }
 
@@ -865,6 +1064,13 @@ int GNSSFlowgraph::connect_sample_counter()
 #if ENABLE_FPGA
 int GNSSFlowgraph::connect_fpga_sample_counter()
 {
+    if (configuration_->property("GNSS-SDR.fpga_epoch_source", false))
+        {
+            // the observables block reads the FPGA counter registers directly
+            // (one read per interrupt), so no sample-counter stream is needed
+            LOG(INFO) << "FPGA sample counter stream not instantiated: the observables block reads the counter directly";
+            return 0;
+        }
     // create a hardware-defined gnss_synchro pulse for the observables block
     try
         {
@@ -1006,29 +1212,111 @@ int GNSSFlowgraph::connect_signal_sources_to_signal_conditioners()
 
 int GNSSFlowgraph::connect_signal_conditioners_to_channels()
 {
+    if (configuration_->property("GNSS-SDR.enable_crossbar", false) && !sig_conditioner_.empty())
+        {
+            // one crossbar input per conditioner and one output per channel:
+            // the channels hang from their crossbar output, so they can be
+            // moved to another RF feed at runtime (see set_channel_rf_route)
+            // with a sample-aligned handover instead of a flowgraph restart
+            if (configuration_->property("GNSS-SDR.use_band_splitter", false))
+                {
+                    LOG(WARNING) << "use_band_splitter shares one stream per band and cannot sit downstream of the crossbar, ignoring it";
+                }
+            const size_t crossbar_item_size = sig_conditioner_.at(0)->get_right_block()->output_signature()->sizeof_stream_item(0);
+            band_crossbar_ = gnss_sdr_make_band_crossbar(crossbar_item_size, static_cast<int32_t>(sig_conditioner_.size()), channels_count_);
+            try
+                {
+                    for (size_t n = 0; n < sig_conditioner_.size(); n++)
+                        {
+                            top_block_->connect(sig_conditioner_.at(n)->get_right_block(), 0, band_crossbar_, static_cast<int>(n));
+                            signal_conditioner_connected_.at(n) = true;  // every conditioner feeds the crossbar
+                        }
+                }
+            catch (const std::exception& e)
+                {
+                    LOG(ERROR) << "Can't connect signal conditioners to the band crossbar: " << e.what();
+                    top_block_->disconnect_all();
+                    return 1;
+                }
+        }
     for (int i = 0; i < channels_count_; i++)
         {
             int selected_signal_conditioner_ID = 0;
             const bool use_acq_resampler = configuration_->property("GNSS-SDR.use_acquisition_resampler", false);
+            const bool use_band_splitter = configuration_->property("GNSS-SDR.use_band_splitter", false) && !band_crossbar_;
             const uint32_t fs = configuration_->property("GNSS-SDR.internal_fs_sps", 0);
 
             try
                 {
                     selected_signal_conditioner_ID = configuration_->property("Channels_" + channels_.at(i)->get_signal().get_signal_str() + ".RF_channel_ID", 0);
-                    selected_signal_conditioner_ID = configuration_->property("Channel" + std::to_string(i) + ".RF_channel_ID", selected_signal_conditioner_ID);
+                    // B-set channels take the RF channel of their A partner
+                    selected_signal_conditioner_ID = configuration_->property("Channel" + std::to_string(i % ab_fork_boundary_) + ".RF_channel_ID", selected_signal_conditioner_ID);
                 }
             catch (const std::exception& e)
                 {
                     LOG(WARNING) << e.what();
                 }
+            gr::basic_block_sptr band_src = sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block();
+            int band_src_port = 0;
+            if (band_crossbar_)
+                {
+                    band_crossbar_->set_route(i, selected_signal_conditioner_ID);
+                    band_src = band_crossbar_;
+                    band_src_port = i;
+                }
+            uint32_t band_fs = fs;
             try
                 {
+                    // Optional per-band fan-out: when several channels of the same
+                    // band share a wideband source, perform the frequency
+                    // translation (BandSplitter_<signal>.freq_shift, the IF of the
+                    // band center in Hz) and decimation
+                    // (BandSplitter_<signal>.decimation) once, and feed every
+                    // channel of the band from the shared decimated stream. With
+                    // decimation > 1 the channel blocks of that band must be
+                    // configured with the decimated sampling rate
+                    if (use_band_splitter)
+                        {
+                            const std::string signal_str = channels_.at(i)->get_signal().get_signal_str();
+                            const std::string band_role = "BandSplitter_" + signal_str;
+                            const double freq_shift = configuration_->property(band_role + ".freq_shift", 0.0);
+                            const int band_decimation = configuration_->property(band_role + ".decimation", 1);
+                            if (freq_shift != 0.0 || band_decimation > 1)
+                                {
+                                    // one splitter per band and RF channel, shared by all its channels
+                                    const std::string band_key = signal_str + std::to_string(selected_signal_conditioner_ID);
+                                    if (band_splitters_.find(band_key) == band_splitters_.end())
+                                        {
+                                            std::vector<float> band_taps;
+                                            if (band_decimation > 1)
+                                                {
+                                                    const double fs_band_out = static_cast<double>(fs) / static_cast<double>(band_decimation);
+                                                    band_taps = gr::filter::firdes::low_pass(1.0,
+                                                        fs,
+                                                        fs_band_out / 2.1,
+                                                        fs_band_out / 2);
+                                                }
+                                            else
+                                                {
+                                                    band_taps = {1.0F};  // pure frequency rotator
+                                                }
+                                            gr::basic_block_sptr band_splitter = gr::filter::freq_xlating_fir_filter_ccf::make(band_decimation, band_taps, freq_shift, static_cast<double>(fs));
+                                            band_splitters_.insert(std::pair<std::string, gr::basic_block_sptr>(band_key, band_splitter));
+                                            top_block_->connect(band_src, 0, band_splitters_.at(band_key), 0);
+                                            LOG(INFO) << "Created " << signal_str
+                                                      << " band splitter for RF channel " << std::to_string(selected_signal_conditioner_ID)
+                                                      << " with " << band_taps.size() << " taps, frequency shift of " << freq_shift << " Hz and decimation factor of " << band_decimation;
+                                        }
+                                    band_src = band_splitters_.at(band_key);
+                                    band_fs = fs / static_cast<uint32_t>(band_decimation);
+                                }
+                        }
                     // Enable automatic resampler for the acquisition, if required
                     if (use_acq_resampler == true)
                         {
                             // create acquisition resamplers if required
                             double resampler_ratio = 1.0;
-                            double acq_fs = fs;
+                            double acq_fs = band_fs;
                             // find the signal associated to this channel
                             switch (mapStringValues_[channels_.at(i)->get_signal().get_signal_str()])
                                 {
@@ -1060,29 +1348,30 @@ int GNSSFlowgraph::connect_signal_conditioners_to_channels()
                                 case evGLO_2G:
                                 case evBDS_B1:
                                 case evBDS_B3:
-                                    acq_fs = fs;
+                                    acq_fs = band_fs;
                                     break;
                                 default:
                                     break;
                                 }
 
-                            if (acq_fs < fs)
+                            if (acq_fs < band_fs)
                                 {
                                     // check if the resampler is already created for the channel system/signal and for the specific RF Channel
-                                    const std::string map_key = channels_.at(i)->get_signal().get_signal_str() + std::to_string(selected_signal_conditioner_ID);
-                                    resampler_ratio = static_cast<double>(fs) / acq_fs;
+                                    // (with the crossbar each channel owns its resampler, since its source can be retuned independently)
+                                    const std::string map_key = channels_.at(i)->get_signal().get_signal_str() + std::to_string(selected_signal_conditioner_ID) + (band_crossbar_ ? "_ch" + std::to_string(i) : "");
+                                    resampler_ratio = static_cast<double>(band_fs) / acq_fs;
                                     int decimation = floor(resampler_ratio);
-                                    while (fs % decimation > 0)
+                                    while (band_fs % decimation > 0)
                                         {
                                             decimation--;
                                         };
-                                    const double acq_fs_decimated = static_cast<double>(fs) / static_cast<double>(decimation);
+                                    const double acq_fs_decimated = static_cast<double>(band_fs) / static_cast<double>(decimation);
 
                                     if (decimation > 1)
                                         {
                                             // create a FIR low pass filter
                                             std::vector<float> taps = gr::filter::firdes::low_pass(1.0,
-                                                fs,
+                                                band_fs,
                                                 acq_fs_decimated / 2.1,
                                                 acq_fs_decimated / 2);
 
@@ -1092,7 +1381,7 @@ int GNSSFlowgraph::connect_signal_conditioners_to_channels()
                                             ret = acq_resamplers_.insert(std::pair<std::string, gr::basic_block_sptr>(map_key, fir_filter_ccf_));
                                             if (ret.second == true)
                                                 {
-                                                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                                    top_block_->connect(band_src, band_src_port,
                                                         acq_resamplers_.at(map_key), 0);
                                                     LOG(INFO) << "Created "
                                                               << channels_.at(i)->get_signal().get_signal_str()
@@ -1115,23 +1404,23 @@ int GNSSFlowgraph::connect_signal_conditioners_to_channels()
                                         {
                                             LOG(INFO) << "Disabled acquisition resampler because the input sampling frequency is too low";
                                             // resampler not required!
-                                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                            top_block_->connect(band_src, band_src_port,
                                                 channels_.at(i)->get_left_block_acq(), 0);
                                         }
                                 }
                             else
                                 {
                                     LOG(INFO) << "Disabled acquisition resampler because the input sampling frequency is too low";
-                                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                    top_block_->connect(band_src, band_src_port,
                                         channels_.at(i)->get_left_block_acq(), 0);
                                 }
                         }
                     else
                         {
-                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                            top_block_->connect(band_src, band_src_port,
                                 channels_.at(i)->get_left_block_acq(), 0);
                         }
-                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                    top_block_->connect(band_src, band_src_port,
                         channels_.at(i)->get_left_block_trk(), 0);
                 }
             catch (const std::exception& e)
@@ -1154,8 +1443,10 @@ int GNSSFlowgraph::connect_channels_to_observables()
         {
             try
                 {
+                    // B-set channels feed their own observables instance
+                    const auto& observables = is_b_channel(i) ? observables_b_ : observables_;
                     top_block_->connect(channels_.at(i)->get_right_block(), 0,
-                        observables_->get_left_block(), i);
+                        observables->get_left_block(), i % ab_fork_boundary_);
                 }
             catch (const std::exception& e)
                 {
@@ -1176,8 +1467,11 @@ int GNSSFlowgraph::connect_observables_to_pvt()
         {
             for (int i = 0; i < channels_count_; i++)
                 {
-                    top_block_->connect(observables_->get_right_block(), i, pvt_->get_left_block(), i);
-                    top_block_->msg_connect(channels_.at(i)->get_right_block(), pmt::mp("telemetry"), pvt_->get_left_block(), pmt::mp("telemetry"));
+                    // B-set channels work against their own observables and PVT instances
+                    const auto& observables = is_b_channel(i) ? observables_b_ : observables_;
+                    const auto& pvt = is_b_channel(i) ? pvt_b_ : pvt_;
+                    top_block_->connect(observables->get_right_block(), i % ab_fork_boundary_, pvt->get_left_block(), i % ab_fork_boundary_);
+                    top_block_->msg_connect(channels_.at(i)->get_right_block(), pmt::mp("telemetry"), pvt->get_left_block(), pmt::mp("telemetry"));
                     // experimental Vector Tracking Loop (VTL) messages from PVT to Tracking blocks
                     // not supported by all tracking algorithms
                     pmt::pmt_t ports_in = channels_.at(i)->get_left_block_trk()->message_ports_in();
@@ -1186,7 +1480,7 @@ int GNSSFlowgraph::connect_observables_to_pvt()
                             // std::cout << "pmt: " << pmt::symbol_to_string(pmt::vector_ref(ports_in, n)) << "\n";
                             if (pmt::symbol_to_string(pmt::vector_ref(ports_in, n)) == "pvt_to_trk")
                                 {
-                                    top_block_->msg_connect(pvt_->get_left_block(), pmt::mp("pvt_to_trk"), channels_.at(i)->get_left_block_trk(), pmt::mp("pvt_to_trk"));
+                                    top_block_->msg_connect(pvt->get_left_block(), pmt::mp("pvt_to_trk"), channels_.at(i)->get_left_block_trk(), pmt::mp("pvt_to_trk"));
                                     LOG(INFO) << "pvt_to_trk message port connected in " << channels_.at(i)->implementation();
                                 }
                         }
@@ -1196,6 +1490,13 @@ int GNSSFlowgraph::connect_observables_to_pvt()
 
             top_block_->msg_connect(pvt_->get_left_block(), pmt::mp("pvt_to_observables"), observables_->get_right_block(), pmt::mp("pvt_to_observables"));
             top_block_->msg_connect(pvt_->get_left_block(), pmt::mp("status"), channels_status_, pmt::mp("status"));
+
+            if (ab_fork_enabled_)
+                {
+                    top_block_->msg_connect(observables_b_->get_right_block(), pmt::mp("status"), channels_status_, pmt::mp("status"));
+                    top_block_->msg_connect(pvt_b_->get_left_block(), pmt::mp("pvt_to_observables"), observables_b_->get_right_block(), pmt::mp("pvt_to_observables"));
+                    top_block_->msg_connect(pvt_b_->get_left_block(), pmt::mp("status"), channels_status_, pmt::mp("status"));
+                }
         }
     catch (const std::exception& e)
         {
@@ -1214,7 +1515,12 @@ int GNSSFlowgraph::connect_gnss_synchro_monitor()
         {
             for (int i = 0; i < channels_count_; i++)
                 {
-                    top_block_->connect(observables_->get_right_block(), i, GnssSynchroMonitor_, i);
+                    // with an A/B fork the monitor carries both observables sets
+                    // in one stream, B channels on the ports (and channel IDs)
+                    // offset by the A-set size, so consumers can compare them
+                    // epoch by epoch
+                    const auto& observables = is_b_channel(i) ? observables_b_ : observables_;
+                    top_block_->connect(observables->get_right_block(), i % ab_fork_boundary_, GnssSynchroMonitor_, i);
                 }
         }
     catch (const std::exception& e)
@@ -1387,11 +1693,416 @@ void GNSSFlowgraph::check_signal_conditioners()
 }
 
 
+void GNSSFlowgraph::apply_cpu_placement()
+{
+    // Optional placement policy. By default thread placement is left to the
+    // GNU Radio scheduler, which on multi-socket machines scatters correlator
+    // threads across NUMA nodes. Pinning the per-channel threads before the
+    // flowgraph starts also keeps their stream buffers node-local, since
+    // Linux first-touch allocation happens in the pinned producing thread.
+    //
+    //   GNSS-SDR.channel_cpu_affinity : comma-separated core list handed out
+    //     round-robin to the channels, grouped by RF channel so channels of
+    //     the same band draw consecutive cores on their conditioner's socket
+    //   ChannelN.cpu_affinity         : per-channel core list override
+    //   SignalConditionerN.cpu_affinity : core list for the conditioner output
+    auto parse_core_list = [this](const std::string& s) {
+        std::vector<int> cores;
+        for (const auto& token : split_string(s, ','))
+            {
+                try
+                    {
+                        cores.push_back(std::stoi(token));
+                    }
+                catch (const std::exception& e)
+                    {
+                        LOG(WARNING) << "Malformed cpu_affinity entry " << token << ": " << e.what();
+                    }
+            }
+        return cores;
+    };
+    auto pin_block = [](const gr::basic_block_sptr& bb, const std::vector<int>& cores) {
+        auto blk = std::dynamic_pointer_cast<gr::block>(bb);
+        if (blk)
+            {
+                blk->set_processor_affinity(cores);
+            }
+    };
+    auto core_list_str = [](const std::vector<int>& cores) {
+        std::string s;
+        for (const auto core : cores)
+            {
+                s += (s.empty() ? "" : ",") + std::to_string(core);
+            }
+        return s;
+    };
+
+    const std::vector<int> global_cores = parse_core_list(configuration_->property("GNSS-SDR.channel_cpu_affinity", std::string("")));
+
+    // visit channels ordered by their signal conditioner, so the round-robin
+    // assignment keeps same-band channels on contiguous cores
+    std::multimap<int, int> channels_by_conditioner;
+    for (int i = 0; i < channels_count_; i++)
+        {
+            int conditioner_id = configuration_->property("Channels_" + channels_.at(i)->get_signal().get_signal_str() + ".RF_channel_ID", 0);
+            conditioner_id = configuration_->property("Channel" + std::to_string(i) + ".RF_channel_ID", conditioner_id);
+            channels_by_conditioner.insert({conditioner_id, i});
+        }
+
+    size_t next_core = 0;
+    for (const auto& entry : channels_by_conditioner)
+        {
+            const int i = entry.second;
+            std::vector<int> cores = parse_core_list(configuration_->property("Channel" + std::to_string(i) + ".cpu_affinity", std::string("")));
+            if (cores.empty() && !global_cores.empty())
+                {
+                    cores.push_back(global_cores[next_core % global_cores.size()]);
+                    next_core++;
+                }
+            if (cores.empty())
+                {
+                    continue;
+                }
+            pin_block(channels_.at(i)->get_left_block_trk(), cores);
+            pin_block(channels_.at(i)->get_right_block(), cores);
+            LOG(INFO) << "Channel " << i << " (RF channel " << entry.first << ") tracking and telemetry pinned to core(s) " << core_list_str(cores);
+        }
+
+    for (size_t n = 0; n < sig_conditioner_.size(); n++)
+        {
+            std::string cores_str = configuration_->property("SignalConditioner" + std::to_string(n) + ".cpu_affinity", std::string(""));
+            if (cores_str.empty() && n == 0)
+                {
+                    cores_str = configuration_->property("SignalConditioner.cpu_affinity", std::string(""));
+                }
+            const std::vector<int> cores = parse_core_list(cores_str);
+            if (!cores.empty())
+                {
+                    pin_block(sig_conditioner_.at(n)->get_right_block(), cores);
+                    LOG(INFO) << "Signal conditioner " << n << " pinned to core(s) " << core_list_str(cores);
+                }
+        }
+}
+
+
+void GNSSFlowgraph::apply_deterministic_profiling()
+{
+    // Deterministic profiling mode (GNSS-SDR.deterministic_profiling). GNU
+    // Radio runs one thread per block, so two replays of the same file
+    // schedule differently and the timing noise drowns small regressions
+    // when profiles of two builds are compared. This mode pins every block
+    // of the flowgraph to a single core and fixes the scheduler quantum
+    // (the max_noutput_items passed at start), so the sequence and size of
+    // the work() calls is reproducible from run to run. It is meant for
+    // file replay without throttling, where the receiver is free to run in
+    // its own virtual time; a real-time source overruns when the whole
+    // receiver shares one core. It runs after apply_cpu_placement(), so it
+    // overrides any per-block placement when both are configured
+    //
+    //   GNSS-SDR.deterministic_profiling         : enable the mode (default false)
+    //   GNSS-SDR.deterministic_profiling_core    : core that runs the receiver (default 0)
+    //   GNSS-SDR.deterministic_profiling_quantum : max items per work() call
+    //     (default 4096), also applied at GNSSFlowgraph::start()
+    if (!configuration_->property("GNSS-SDR.deterministic_profiling", false))
+        {
+            return;
+        }
+    const int core = configuration_->property("GNSS-SDR.deterministic_profiling_core", 0);
+    top_block_->set_processor_affinity(std::vector<int>{core});
+    const std::string source_impl = configuration_->property("SignalSource.implementation", std::string(""));
+    if (source_impl.find("File") == std::string::npos)
+        {
+            LOG(WARNING) << "GNSS-SDR.deterministic_profiling is meant for file replay; signal source "
+                         << source_impl << " may overrun with the receiver on a single core";
+        }
+    LOG(INFO) << "Deterministic profiling mode: flowgraph pinned to core " << core
+              << ", scheduler quantum "
+              << configuration_->property("GNSS-SDR.deterministic_profiling_quantum", 4096)
+              << " items";
+}
+
+
+void GNSSFlowgraph::apply_thread_priorities()
+{
+    // Optional real-time priority bands per block role
+    // (GNSS-SDR.enable_thread_priorities). All the flowgraph threads run
+    // under the default CFS policy, so under CPU pressure the kernel steals
+    // time from the tracking loops, which must close every code period, to
+    // feed deadline-tolerant consumers such as the PVT printers. Raising
+    // the deadline-critical threads to SCHED_FIFO keeps them runnable
+    // whenever ready, while the telemetry decoders and the PVT output keep
+    // the default policy (priority 0) and absorb the slack. Priorities act
+    // on the running block threads, so this is called at the end of
+    // start(). If the process lacks CAP_SYS_NICE (or RLIMIT_RTPRIO is 0)
+    // the request is denied per block and the receiver keeps running with
+    // default scheduling
+    //
+    //   GNSS-SDR.enable_thread_priorities : enable the policy (default false)
+    //   GNSS-SDR.source_priority      : signal conditioner outputs (default 55)
+    //   GNSS-SDR.tracking_priority    : channel tracking blocks (default 50)
+    //   GNSS-SDR.observables_priority : observables block (default 45)
+    //   GNSS-SDR.telemetry_priority   : telemetry decoders (default 0: keep CFS)
+    //   GNSS-SDR.pvt_priority         : PVT block (default 0: keep CFS)
+    //   ChannelN.thread_priority      : per-channel tracking override
+    if (!configuration_->property("GNSS-SDR.enable_thread_priorities", false))
+        {
+            return;
+        }
+    bool priority_denied = false;
+    auto set_priority = [&priority_denied](const gr::basic_block_sptr& bb, int priority, const std::string& role) {
+        if (priority <= 0)
+            {
+                return;
+            }
+        auto blk = std::dynamic_pointer_cast<gr::block>(bb);
+        if (!blk)
+            {
+                return;
+            }
+        if (blk->set_thread_priority(priority) != 0)
+            {
+                if (!priority_denied)
+                    {
+                        LOG(WARNING) << "Real-time priority denied (missing CAP_SYS_NICE or RLIMIT_RTPRIO); keeping default scheduling";
+                        priority_denied = true;
+                    }
+            }
+        else
+            {
+                DLOG(INFO) << role << " thread raised to SCHED_FIFO priority " << priority;
+            }
+    };
+
+    const int source_priority = configuration_->property("GNSS-SDR.source_priority", 55);
+    const int tracking_priority = configuration_->property("GNSS-SDR.tracking_priority", 50);
+    const int observables_priority = configuration_->property("GNSS-SDR.observables_priority", 45);
+    const int telemetry_priority = configuration_->property("GNSS-SDR.telemetry_priority", 0);
+    const int pvt_priority = configuration_->property("GNSS-SDR.pvt_priority", 0);
+
+    for (size_t n = 0; n < sig_conditioner_.size(); n++)
+        {
+            set_priority(sig_conditioner_.at(n)->get_right_block(), source_priority, "Signal conditioner " + std::to_string(n));
+        }
+    for (int i = 0; i < channels_count_; i++)
+        {
+            const int channel_priority = configuration_->property("Channel" + std::to_string(i) + ".thread_priority", tracking_priority);
+            set_priority(channels_.at(i)->get_left_block_trk(), channel_priority, "Channel " + std::to_string(i) + " tracking");
+            set_priority(channels_.at(i)->get_right_block(), telemetry_priority, "Channel " + std::to_string(i) + " telemetry");
+        }
+    set_priority(observables_->get_right_block(), observables_priority, "Observables");
+    set_priority(pvt_->get_right_block(), pvt_priority, "PVT");
+    LOG(INFO) << "Thread priority bands applied: source " << source_priority
+              << ", tracking " << tracking_priority
+              << ", observables " << observables_priority
+              << ", telemetry " << telemetry_priority
+              << ", PVT " << pvt_priority;
+}
+
+
+void GNSSFlowgraph::apply_buffer_sizing()
+{
+    // Optional deterministic sizing of the sample-stream buffers
+    // (GNSS-SDR.buffer_sizing). GNU Radio sizes every edge from the item
+    // size alone, so the conditioner output shared by all the channels of a
+    // band gets the same generic buffer as any other edge: not necessarily
+    // large enough for the per-call consumption of the channel blocks at
+    // high sampling rates, and much larger than the working set they need
+    // otherwise, which hurts cache locality when tens of tracking channels
+    // sweep the same ring buffer. This pass derives one explicit size per
+    // edge from the configured sampling rate and the history requirements of
+    // the attached readers, pins it (min = max) before the buffers are
+    // allocated at flowgraph start, and logs a per-edge report. The signal
+    // source output is not touched here; it can be bounded with
+    // GNSS-SDR.max_source_buffer_samples
+    //
+    //   GNSS-SDR.buffer_sizing          : enable the pass (default false)
+    //   GNSS-SDR.buffer_sizing_depth_ms : buffering depth granted on each
+    //     sample-stream edge, in ms of signal (default 32). It must exceed
+    //     the longest coherent integration configured in the channels
+    if (!configuration_->property("GNSS-SDR.buffer_sizing", false))
+        {
+            return;
+        }
+    const uint32_t fs = configuration_->property("GNSS-SDR.internal_fs_sps", 0);
+    if (fs == 0)
+        {
+            LOG(WARNING) << "Buffer sizing requires GNSS-SDR.internal_fs_sps to be set. Leaving the buffer sizes to the scheduler";
+            return;
+        }
+    const int depth_ms = configuration_->property("GNSS-SDR.buffer_sizing_depth_ms", 32);
+
+    auto reader_history = [](const gr::basic_block_sptr& bb) {
+        auto blk = std::dynamic_pointer_cast<gr::block>(bb);
+        return blk ? static_cast<int64_t>(blk->history()) : int64_t{1};
+    };
+
+    // every reader of a sample-stream edge announces the past samples it
+    // revisits through set_history() (notch filters, resamplers, band
+    // splitters); the largest requirement is added on top of the requested
+    // depth so no reader can be starved by the cap
+    int64_t max_history = 1;
+    for (int i = 0; i < channels_count_; i++)
+        {
+            max_history = std::max(max_history, reader_history(channels_.at(i)->get_left_block_acq()));
+            max_history = std::max(max_history, reader_history(channels_.at(i)->get_left_block_trk()));
+        }
+    for (const auto& resampler : acq_resamplers_)
+        {
+            max_history = std::max(max_history, reader_history(resampler.second));
+        }
+    for (const auto& splitter : band_splitters_)
+        {
+            max_history = std::max(max_history, reader_history(splitter.second));
+        }
+
+    // round up to a multiple of 4096 items so the doubly-mapped circular
+    // buffer allocator gets a page-aligned size for any power-of-two item
+    int64_t edge_items = static_cast<int64_t>(fs) / 1000 * depth_ms + (max_history - 1);
+    edge_items = ((edge_items + 4095) / 4096) * 4096;
+
+    int64_t total_bytes = 0;
+    auto size_edge = [&edge_items, &total_bytes](const gr::basic_block_sptr& bb, const std::string& what) {
+        auto blk = std::dynamic_pointer_cast<gr::block>(bb);
+        if (!blk)
+            {
+                return;
+            }
+        blk->set_min_output_buffer(edge_items);
+        blk->set_max_output_buffer(edge_items);
+        total_bytes += edge_items * static_cast<int64_t>(sizeof(gr_complex));
+        LOG(INFO) << "Buffer sizing: " << what << " output buffer set to "
+                  << edge_items << " items ("
+                  << (edge_items * static_cast<int64_t>(sizeof(gr_complex))) / 1024 << " KiB)";
+    };
+
+    for (size_t n = 0; n < sig_conditioner_.size(); n++)
+        {
+            size_edge(sig_conditioner_.at(n)->get_right_block(), "signal conditioner " + std::to_string(n));
+        }
+    for (const auto& splitter : band_splitters_)
+        {
+            size_edge(splitter.second, "band splitter " + splitter.first);
+        }
+    for (const auto& resampler : acq_resamplers_)
+        {
+            size_edge(resampler.second, "acquisition resampler " + resampler.first);
+        }
+    LOG(INFO) << "Buffer sizing: " << depth_ms << " ms of buffering per sample-stream edge, largest reader history "
+              << max_history << " samples, " << total_bytes / 1024 << " KiB in total";
+}
+
+
+std::vector<Warm_Start_Record> GNSSFlowgraph::warm_start_records()
+{
+    std::vector<Warm_Start_Record> records;
+    const std::map<int, std::shared_ptr<Gnss_Synchro>> current_channels_status = channels_status_->get_current_status_map();
+    for (const auto& current_status : current_channels_status)
+        {
+            const auto& synchro = current_status.second;
+            if (!synchro)
+                {
+                    continue;
+                }
+            Warm_Start_Record record{};
+            record.system = synchro->System;
+            record.signal[0] = synchro->Signal[0];
+            record.signal[1] = synchro->Signal[1];
+            record.signal[2] = '\0';
+            record.prn = synchro->PRN;
+            record.doppler_hz = synchro->Carrier_Doppler_hz;
+            record.rx_time_s = synchro->RX_time;
+            records.push_back(record);
+        }
+    return records;
+}
+
+
+void GNSSFlowgraph::seed_warm_start(const std::vector<Warm_Start_Record>& records)
+{
+    int n_seeded = 0;
+    for (int i = 0; i < channels_count_; i++)
+        {
+            const Gnss_Signal assigned_signal = channels_.at(i)->get_signal();
+            const std::string system_short = assigned_signal.get_satellite().get_system_short();
+            for (const auto& record : records)
+                {
+                    if (record.prn == assigned_signal.get_satellite().get_PRN() &&
+                        !system_short.empty() &&
+                        record.system == system_short[0] &&
+                        assigned_signal.get_signal_str() == std::string(record.signal))
+                        {
+                            channels_.at(i)->assist_acquisition_doppler(record.doppler_hz);
+                            n_seeded++;
+                            break;
+                        }
+                }
+        }
+    // satellites in the snapshot that are not assigned to any channel will be
+    // assisted through the regular dual-frequency projection path once their
+    // primary frequency is re-acquired
+    LOG(INFO) << "Warm start: pre-seeded the acquisition Doppler of " << n_seeded << " channel(s) out of " << records.size() << " snapshot record(s)";
+}
+
+
+void GNSSFlowgraph::update_acq_doppler_predictions(const std::map<std::pair<char, uint32_t>, double>& predictions_hz)
+{
+    std::lock_guard<std::mutex> lock(acq_doppler_predictions_mutex_);
+    acq_doppler_predictions_ = predictions_hz;
+}
+
+
+void GNSSFlowgraph::apply_hot_configuration(const std::shared_ptr<ConfigurationInterface>& new_configuration)
+{
+    std::lock_guard<std::mutex> lock(signal_list_mutex_);
+    for (int i = 0; i < channels_count_; i++)
+        {
+            auto channel = std::dynamic_pointer_cast<Channel>(channels_.at(i));
+            if (!channel)
+                {
+                    continue;
+                }
+            const std::string signal_str = channel->get_signal().get_signal_str();
+            const std::string role = "Acquisition_" + signal_str;
+            const std::string role_ch = role + std::to_string(i);
+
+            // -1 sentinels: only push the parameters the reloaded file defines
+            const int64_t doppler_max = new_configuration->property(role_ch + ".doppler_max",
+                new_configuration->property(role + ".doppler_max", static_cast<int64_t>(-1)));
+            const int64_t doppler_step = new_configuration->property(role_ch + ".doppler_step",
+                new_configuration->property(role + ".doppler_step", static_cast<int64_t>(-1)));
+            const int64_t doppler_center = new_configuration->property(role_ch + ".doppler_center",
+                new_configuration->property(role + ".doppler_center", static_cast<int64_t>(-1)));
+            const float threshold = new_configuration->property(role_ch + ".threshold",
+                new_configuration->property(role + ".threshold", static_cast<float>(-1.0)));
+
+            if (doppler_max > 0)
+                {
+                    channel->acquisition()->set_doppler_max(static_cast<unsigned int>(doppler_max));
+                }
+            if (doppler_step > 0)
+                {
+                    channel->acquisition()->set_doppler_step(static_cast<unsigned int>(doppler_step));
+                }
+            if (doppler_center != -1)
+                {
+                    channel->acquisition()->set_doppler_center(static_cast<int>(doppler_center));
+                }
+            if (threshold > 0.0F)
+                {
+                    channel->acquisition()->set_threshold(threshold);
+                }
+        }
+    LOG(INFO) << "Configuration hot reload: acquisition parameters updated in the running channels";
+}
+
+
 int GNSSFlowgraph::assign_channels()
 {
-    // Put channels fixed to a given satellite at the beginning of the vector, then the rest
+    // Put channels fixed to a given satellite at the beginning of the vector, then the rest.
+    // With an A/B fork only the A set draws from the available signal lists;
+    // the B channels mirror their partner's assignment below
     std::vector<unsigned int> vector_of_channels;
-    for (int i = 0; i < channels_count_; i++)
+    for (int i = 0; i < ab_fork_boundary_; i++)
         {
             unsigned int sat = 0;
             try
@@ -1606,6 +2317,15 @@ int GNSSFlowgraph::assign_channels()
                     channels_.at(i)->set_signal(gnss_signal);
                 }
         }
+
+    // B-set channels shadow the satellite assignment of their A partner
+    if (ab_fork_enabled_)
+        {
+            for (int i = 0; i < ab_fork_boundary_; i++)
+                {
+                    channels_.at(i + ab_fork_boundary_)->set_signal(channels_.at(i)->get_signal());
+                }
+        }
     return 0;
 }
 
@@ -1648,8 +2368,36 @@ bool GNSSFlowgraph::send_telemetry_msg(const pmt::pmt_t& msg)
 }
 
 
+bool GNSSFlowgraph::set_channel_rf_route(int channel, int rf_channel_id)
+{
+    if (!band_crossbar_)
+        {
+            LOG(WARNING) << "Channel RF routing requested but the band crossbar is not enabled (set GNSS-SDR.enable_crossbar=true)";
+            return false;
+        }
+    if ((channel < 0) || (channel >= channels_count_))
+        {
+            LOG(WARNING) << "Channel RF routing requested for non-existing channel " << channel;
+            return false;
+        }
+    if (!band_crossbar_->set_route(channel, rf_channel_id))
+        {
+            return false;
+        }
+    LOG(INFO) << "Channel " << channel << " retuned to RF channel " << rf_channel_id;
+    return true;
+}
+
+
 void GNSSFlowgraph::push_back_signal(const Gnss_Signal& gs)
 {
+    // the signal is searchable again: drop any in-flight claim left by a
+    // channel that stopped without reporting an acquisition result
+    const auto hist = acq_history_.find(candidate_key(gs));
+    if (hist != acq_history_.end())
+        {
+            hist->second.in_flight = false;
+        }
     switch (mapStringValues_[gs.get_signal_str()])
         {
         case evGPS_1C:
@@ -1796,9 +2544,11 @@ double GNSSFlowgraph::project_doppler(const std::string& searched_signal, double
 void GNSSFlowgraph::acquisition_manager(unsigned int who)
 {
     unsigned int current_channel;
-    for (int i = 0; i < channels_count_; i++)
+    // with an A/B fork the manager schedules the A set only; B channels are
+    // started below as mirrors of their partner
+    for (int i = 0; i < ab_fork_boundary_; i++)
         {
-            current_channel = (i + who + 1) % channels_count_;
+            current_channel = (i + who + 1) % ab_fork_boundary_;
             unsigned int sat_ = 0;
             try
                 {
@@ -1808,7 +2558,7 @@ void GNSSFlowgraph::acquisition_manager(unsigned int who)
                 {
                     LOG(WARNING) << e.what();
                 }
-            if ((acq_channels_count_ < max_acq_channels_) && (channels_state_[current_channel] == 0))
+            if ((acq_channels_count_ < max_acq_channels_) && (channels_state_[current_channel] == 0) && !channels_suspended_[current_channel])
                 {
                     bool is_primary_freq = true;
                     bool assistance_available = false;
@@ -1846,8 +2596,26 @@ void GNSSFlowgraph::acquisition_manager(unsigned int who)
                                 }
                             else
                                 {
-                                    // set Doppler center to 0 Hz
-                                    channels_[current_channel]->assist_acquisition_doppler(0);
+                                    // no dual-frequency assistance: fall back to the Doppler
+                                    // predicted by the control thread from almanac/ephemeris
+                                    // and the last known position, when one is available for
+                                    // the assigned satellite (0 Hz and the full configured
+                                    // grid otherwise)
+                                    double predicted_doppler_hz = 0.0;
+                                    const std::string system_short = channels_[current_channel]->get_signal().get_satellite().get_system_short();
+                                    if (!system_short.empty())
+                                        {
+                                            std::lock_guard<std::mutex> pred_lock(acq_doppler_predictions_mutex_);
+                                            const auto prediction = acq_doppler_predictions_.find({system_short[0], channels_[current_channel]->get_signal().get_satellite().get_PRN()});
+                                            if (prediction != acq_doppler_predictions_.end())
+                                                {
+                                                    predicted_doppler_hz = project_doppler(channels_[current_channel]->get_signal().get_signal_str(), prediction->second);
+                                                    DLOG(INFO) << "Channel " << current_channel
+                                                               << " seeded with predicted Doppler " << predicted_doppler_hz
+                                                               << " [Hz] for " << channels_[current_channel]->get_signal().get_satellite();
+                                                }
+                                        }
+                                    channels_[current_channel]->assist_acquisition_doppler(predicted_doppler_hz);
                                 }
 #if ENABLE_FPGA
                             if (enable_fpga_offloading_)
@@ -1863,6 +2631,18 @@ void GNSSFlowgraph::acquisition_manager(unsigned int who)
 #else
                             channels_[current_channel]->start_acquisition();
 #endif
+                            if (ab_fork_enabled_)
+                                {
+                                    // start the idle B mirror on the same satellite; a busy
+                                    // mirror resynchronizes on its own acquisition event
+                                    const unsigned int mirror_channel = current_channel + static_cast<unsigned int>(ab_fork_boundary_);
+                                    if (channels_state_[mirror_channel] == 0 && !channels_suspended_[mirror_channel])
+                                        {
+                                            channels_state_[mirror_channel] = 1;
+                                            channels_[mirror_channel]->set_signal(channels_[current_channel]->get_signal());
+                                            channels_[mirror_channel]->start_acquisition();
+                                        }
+                                }
                         }
                     else
                         {
@@ -1918,11 +2698,55 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
                     LOG(WARNING) << e.what();
                 }
         }
+    if (is_b_channel(static_cast<int>(who)) && (what < 10))
+        {
+            // shadow B channel of an A/B fork: keep chasing the satellite of
+            // its A partner, without touching the available signal lists or
+            // the acquisition budget of the A set
+            gs = channels_[who]->get_signal();
+            switch (what)
+                {
+                case 0:
+                    DLOG(INFO) << "Channel " << who << " (B set) ACQ FAILED satellite " << gs.get_satellite() << ", Signal " << gs.get_signal_str();
+                    if (!channels_suspended_[who])
+                        {
+                            channels_state_[who] = 1;
+                            channels_[who]->set_signal(channels_[ab_partner(static_cast<int>(who))]->get_signal());
+                            channels_[who]->start_acquisition();
+                        }
+                    else
+                        {
+                            channels_state_[who] = 0;
+                        }
+                    break;
+                case 1:
+                    DLOG(INFO) << "Channel " << who << " (B set) ACQ SUCCESS satellite " << gs.get_satellite();
+                    channels_state_[who] = 2;
+                    break;
+                case 2:
+                    DLOG(INFO) << "Channel " << who << " (B set) TRK FAILED satellite " << gs.get_satellite();
+                    if (!channels_suspended_[who])
+                        {
+                            channels_state_[who] = 1;
+                            channels_[who]->set_signal(channels_[ab_partner(static_cast<int>(who))]->get_signal());
+                            channels_[who]->start_acquisition();
+                        }
+                    else
+                        {
+                            channels_state_[who] = 0;
+                        }
+                    break;
+                default:
+                    break;
+                }
+            return;
+        }
     switch (what)
         {
         case 0:
             gs = channels_[who]->get_signal();
             DLOG(INFO) << "Channel " << who << " ACQ FAILED satellite " << gs.get_satellite() << ", Signal " << gs.get_signal_str();
+            record_acq_failure(gs);
             channels_state_[who] = 0;
             if (acq_channels_count_ > 0)
                 {
@@ -1939,6 +2763,7 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
         case 1:
             gs = channels_[who]->get_signal();
             DLOG(INFO) << "Channel " << who << " ACQ SUCCESS satellite " << gs.get_satellite();
+            record_acq_success(gs);
             // If the satellite is in the list of available ones, remove it.
             remove_signal(gs);
 
@@ -1954,6 +2779,7 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
         case 2:
             gs = channels_[who]->get_signal();
             DLOG(INFO) << "Channel " << who << " TRK FAILED satellite " << gs.get_satellite();
+            record_signal_loss(gs, who);
             if (acq_channels_count_ < max_acq_channels_)
                 {
                     // try to acquire the same satellite
@@ -1992,9 +2818,12 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
                 {
                     if (channels_state_[n] == 1 or channels_state_[n] == 2)  // channel in acquisition or in tracking
                         {
-                            // recover the satellite assigned
-                            Gnss_Signal gs_assigned = channels_[n]->get_signal();
-                            push_back_signal(gs_assigned);
+                            // recover the satellite assigned (B-set mirrors never took it from the lists)
+                            if (!is_b_channel(static_cast<int>(n)))
+                                {
+                                    Gnss_Signal gs_assigned = channels_[n]->get_signal();
+                                    push_back_signal(gs_assigned);
+                                }
 
                             channels_[n]->stop_channel();  // stop the acquisition or tracking operation
                             channels_state_[n] = 0;
@@ -2008,12 +2837,249 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
 }
 
 
+void GNSSFlowgraph::load_governor()
+{
+    const int period_ms = configuration_->property("GNSS-SDR.load_governor_period_ms", 2000);
+    const double low_watermark = configuration_->property("GNSS-SDR.load_governor_low_watermark", 0.97);
+    const double high_watermark = configuration_->property("GNSS-SDR.load_governor_high_watermark", 0.995);
+    const int min_tracking_channels = configuration_->property("GNSS-SDR.load_governor_min_channels", 4);
+    const int holdoff_periods = configuration_->property("GNSS-SDR.load_governor_holdoff_periods", 5);
+
+    LOG(INFO) << "Load governor started (period " << period_ms << " ms, watermarks "
+              << low_watermark << '/' << high_watermark << ", keeping at least "
+              << min_tracking_channels << " tracking channels)";
+
+    double last_rx_time_s = 0.0;
+    auto last_wall_time = std::chrono::steady_clock::now();
+    bool have_reference = false;
+    int headroom_periods = 0;
+
+    while (!stop_governor_)
+        {
+            // sleep in short slices so stop() is not delayed by a whole period
+            for (int slept_ms = 0; (slept_ms < period_ms) && !stop_governor_; slept_ms += 100)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                }
+            if (stop_governor_)
+                {
+                    break;
+                }
+
+            // Receiver time advances with processed samples, so the ratio of
+            // receiver-time progress to wall-clock progress measures how well
+            // the processing chain keeps up with a real-time source. A ratio
+            // below 1.0 means the source buffers are filling up and samples
+            // will eventually be dropped; post-processing runs stay above 1.0
+            // and are never throttled
+            double rx_time_s = 0.0;
+            const auto status = channels_status_->get_current_status_map();
+            for (const auto& ch : status)
+                {
+                    rx_time_s = std::max(rx_time_s, ch.second->RX_time);
+                }
+            const auto now = std::chrono::steady_clock::now();
+            const double wall_s = std::chrono::duration<double>(now - last_wall_time).count();
+            const double rx_progress_s = rx_time_s - last_rx_time_s;
+            last_wall_time = now;
+
+            if (!have_reference || (rx_time_s <= 0.0) || (rx_progress_s < 0.0) || (wall_s <= 0.0))
+                {
+                    // no channel has produced telemetry yet, or receiver time
+                    // jumped (e.g. week rollover): re-arm the reference
+                    last_rx_time_s = rx_time_s;
+                    have_reference = (rx_time_s > 0.0);
+                    continue;
+                }
+            last_rx_time_s = rx_time_s;
+
+            const double throughput_ratio = rx_progress_s / wall_s;
+            DLOG(INFO) << "Load governor: throughput ratio " << throughput_ratio;
+
+            if (throughput_ratio < low_watermark)
+                {
+                    headroom_periods = 0;
+                    suspend_weakest_channel(min_tracking_channels);
+                }
+            else if (throughput_ratio > high_watermark)
+                {
+                    headroom_periods++;
+                    if (headroom_periods >= holdoff_periods)
+                        {
+                            headroom_periods = 0;
+                            resume_suspended_channel();
+                        }
+                }
+            else
+                {
+                    headroom_periods = 0;
+                }
+        }
+    LOG(INFO) << "Load governor stopped";
+}
+
+
+void GNSSFlowgraph::suspend_weakest_channel(int min_tracking_channels)
+{
+    std::lock_guard<std::mutex> lock(signal_list_mutex_);
+    // Pick the tracking channel with the lowest C/N0. The flowgraph has no
+    // elevation data, and the weakest signal is both the likeliest to be at
+    // low elevation and the least harmful to drop from the PVT solution
+    const auto status = channels_status_->get_current_status_map();
+    int tracking_channels = 0;
+    int weakest_channel = -1;
+    double weakest_cn0_dB_hz = 0.0;
+    for (const auto& ch : status)
+        {
+            const int channel_id = ch.first;
+            if ((channel_id < 0) || (channel_id >= channels_count_) || (channels_state_[channel_id] != 2))
+                {
+                    continue;
+                }
+            tracking_channels++;
+            if ((weakest_channel == -1) || (ch.second->CN0_dB_hz < weakest_cn0_dB_hz))
+                {
+                    weakest_channel = channel_id;
+                    weakest_cn0_dB_hz = ch.second->CN0_dB_hz;
+                }
+        }
+    if ((weakest_channel == -1) || (tracking_channels <= min_tracking_channels))
+        {
+            return;
+        }
+
+    const Gnss_Signal gs = channels_[weakest_channel]->get_signal();
+    LOG(INFO) << "Load governor: suspending channel " << weakest_channel
+              << " (" << gs.get_satellite() << ", Signal " << gs.get_signal_str()
+              << ", " << weakest_cn0_dB_hz << " dB-Hz)";
+    push_back_signal(gs);
+    channels_[weakest_channel]->stop_channel();
+    channels_state_[weakest_channel] = 0;
+    channels_suspended_[weakest_channel] = true;
+}
+
+
+void GNSSFlowgraph::resume_suspended_channel()
+{
+    std::lock_guard<std::mutex> lock(signal_list_mutex_);
+    for (int n = 0; n < channels_count_; n++)
+        {
+            if (channels_suspended_[n])
+                {
+                    LOG(INFO) << "Load governor: restoring channel " << n;
+                    channels_suspended_[n] = false;
+                    // let the acquisition manager assign a satellite and start
+                    // the acquisition when an acquisition slot is available
+                    acquisition_manager(n);
+                    return;
+                }
+        }
+}
+
+
+void GNSSFlowgraph::perf_monitor_process()
+{
+    const int period_ms = configuration_->property("PerfMonitor.period_ms", 1000);
+    const std::string address_string = configuration_->property("PerfMonitor.client_addresses", std::string("127.0.0.1"));
+    const std::vector<std::string> udp_addresses = split_string(address_string, '_');
+    const auto udp_port = static_cast<uint16_t>(configuration_->property("PerfMonitor.udp_port", 1238));
+
+    if (!gr::prefs::singleton()->get_bool("PerfCounters", "on", false))
+        {
+            LOG(WARNING) << "PerfMonitor is enabled but GNU Radio performance counters are off. "
+                            "Build GNU Radio with -DENABLE_PERFORMANCE_COUNTERS=ON and set "
+                            "[PerfCounters] on = True in its prefs; all samples read zero otherwise";
+        }
+
+    // Named gr::block handles of the receiver chain. The adapters only hand
+    // out their boundary blocks, so the per-channel figures cover the
+    // tracking and telemetry blocks, which dominate the channel cost.
+    // Hierarchical blocks fail the cast and are silently skipped
+    std::vector<std::pair<std::string, gr::block_sptr>> blocks;
+    const auto add_block = [&blocks](const std::string& name, const gr::basic_block_sptr& bb) {
+        auto blk = std::dynamic_pointer_cast<gr::block>(bb);
+        if (blk)
+            {
+                blocks.emplace_back(name, blk);
+            }
+    };
+    for (size_t n = 0; n < sig_source_.size(); n++)
+        {
+            add_block("SignalSource" + std::to_string(n), sig_source_.at(n)->get_right_block());
+        }
+    for (size_t n = 0; n < sig_conditioner_.size(); n++)
+        {
+            add_block("SignalConditioner" + std::to_string(n), sig_conditioner_.at(n)->get_right_block());
+        }
+    for (int i = 0; i < channels_count_; i++)
+        {
+            add_block("Channel" + std::to_string(i) + ".Tracking", channels_.at(i)->get_left_block_trk());
+            add_block("Channel" + std::to_string(i) + ".TelemetryDecoder", channels_.at(i)->get_right_block());
+        }
+    add_block("Observables", observables_->get_right_block());
+    add_block("PVT", pvt_->get_left_block());
+
+    Udp_Batch_Sender sender(udp_addresses, udp_port);
+    std::vector<double> last_work_time_total(blocks.size(), 0.0);
+    const auto ticks_per_second = static_cast<double>(gr::high_res_timer_tps());
+
+    LOG(INFO) << "Performance counter monitor started (period " << period_ms
+              << " ms, " << blocks.size() << " blocks, UDP port " << udp_port << ')';
+
+    auto last_tick = std::chrono::steady_clock::now();
+    while (!stop_perf_monitor_)
+        {
+            // sleep in short slices so stop() is not delayed by a whole period
+            for (int slept_ms = 0; (slept_ms < period_ms) && !stop_perf_monitor_; slept_ms += 100)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                }
+            if (stop_perf_monitor_)
+                {
+                    break;
+                }
+            const auto now = std::chrono::steady_clock::now();
+            const double wall_s = std::chrono::duration<double>(now - last_tick).count();
+            last_tick = now;
+
+            // One CSV datagram per sampling period:
+            //   block name, fraction of the period spent inside work(),
+            //   average work() call duration in microseconds, average items
+            //   produced per work() call
+            std::ostringstream report;
+            report << "timestamp_ms," << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count() << '\n';
+            for (size_t b = 0; b < blocks.size(); b++)
+                {
+                    const auto& blk = blocks[b].second;
+                    const auto work_time_total = static_cast<double>(blk->pc_work_time_total());
+                    const double busy_ticks = work_time_total - last_work_time_total[b];
+                    last_work_time_total[b] = work_time_total;
+                    const double utilization = (wall_s > 0.0) ? busy_ticks / (ticks_per_second * wall_s) : 0.0;
+                    report << blocks[b].first << ','
+                           << utilization << ','
+                           << static_cast<double>(blk->pc_work_time_avg()) * 1e6 / ticks_per_second << ','
+                           << static_cast<double>(blk->pc_nproduced_avg()) << '\n';
+                }
+            const std::string datagram = report.str();
+            sender.queue_datagram(datagram.data(), datagram.size());
+            sender.flush();
+        }
+    LOG(INFO) << "Performance counter monitor stopped";
+}
+
+
 void GNSSFlowgraph::priorize_satellites(const std::vector<std::pair<int, Gnss_Satellite>>& visible_satellites)
 {
+    // may run concurrently with the channel event handling (apply_action)
+    // when called from the visibility scheduler thread
+    std::lock_guard<std::mutex> lock(signal_list_mutex_);
     size_t old_size;
     Gnss_Signal gs;
-    for (const auto& visible_satellite : visible_satellites)
+    // iterate from the lowest to the highest elevation, so that after the
+    // repeated push_front the highest satellite ends up at the list head
+    for (auto visible_satellite_it = visible_satellites.rbegin(); visible_satellite_it != visible_satellites.rend(); ++visible_satellite_it)
         {
+            const auto& visible_satellite = *visible_satellite_it;
             if (visible_satellite.second.get_system() == "GPS")
                 {
                     gs = Gnss_Signal(visible_satellite.second, "1C");
@@ -2538,16 +3604,18 @@ void GNSSFlowgraph::set_signals_list()
 void GNSSFlowgraph::set_channels_state()
 {
     std::lock_guard<std::mutex> lock(signal_list_mutex_);
-    max_acq_channels_ = configuration_->property("Channels.in_acquisition", channels_count_);
-    if (max_acq_channels_ > channels_count_)
+    // with an A/B fork the acquisition budget applies to the A set; the B
+    // channels shadow their partner and are not counted in acq_channels_count_
+    max_acq_channels_ = configuration_->property("Channels.in_acquisition", ab_fork_boundary_);
+    if (max_acq_channels_ > ab_fork_boundary_)
         {
-            max_acq_channels_ = channels_count_;
-            LOG(WARNING) << "Channels_in_acquisition is bigger than number of channels. Variable acq_channels_count_ is set to " << channels_count_;
+            max_acq_channels_ = ab_fork_boundary_;
+            LOG(WARNING) << "Channels_in_acquisition is bigger than number of channels. Variable acq_channels_count_ is set to " << ab_fork_boundary_;
         }
     channels_state_.reserve(channels_count_);
     for (int i = 0; i < channels_count_; i++)
         {
-            if (i < max_acq_channels_)
+            if ((i % ab_fork_boundary_) < max_acq_channels_)
                 {
                     channels_state_.push_back(1);
                 }
@@ -2557,6 +3625,7 @@ void GNSSFlowgraph::set_channels_state()
                 }
             DLOG(INFO) << "Channel " << i << " in state " << channels_state_[i];
         }
+    channels_suspended_ = std::vector<bool>(channels_count_, false);
     acq_channels_count_ = max_acq_channels_;
     DLOG(INFO) << acq_channels_count_ << " channels in acquisition state";
 }
@@ -2609,6 +3678,111 @@ bool GNSSFlowgraph::is_multiband() const
 }
 
 
+std::string GNSSFlowgraph::candidate_key(const Gnss_Signal& gs)
+{
+    return gs.get_satellite().get_system_short() + "_" + gs.get_signal_str() + "_" + std::to_string(gs.get_satellite().get_PRN());
+}
+
+
+double GNSSFlowgraph::candidate_score(const Gnss_Signal& gs, int list_position) const
+{
+    // Position prior: the control thread keeps the available lists ordered by
+    // predicted elevation when GNSS-SDR.enable_visibility_scheduler is set
+    // (see priorize_satellites), so earlier entries are more likely high in
+    // the sky. Without the scheduler the prior just preserves the original
+    // round-robin order among candidates with no history
+    double score = 35.0 - 0.5 * static_cast<double>(list_position);
+    const auto it = acq_history_.find(candidate_key(gs));
+    if (it != acq_history_.end())
+        {
+            if (it->second.in_flight)
+                {
+                    // already handed to a channel whose acquisition has not
+                    // resolved yet: no history bonus can rescue it, so a
+                    // concurrent searcher only gets it if nothing else is left
+                    return score - 1000.0;
+                }
+            if (it->second.ever_seen)
+                {
+                    // a satellite seen recently at high C/N0 is very likely
+                    // still acquirable; confidence decays as the geometry
+                    // changes (about 3 dB every minute out of sight)
+                    const double age_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - it->second.last_seen).count();
+                    score = std::max(score, static_cast<double>(it->second.last_cn0_db_hz) - 0.05 * age_s);
+                }
+            score -= 2.0 * static_cast<double>(it->second.failed_attempts);
+        }
+    return score;
+}
+
+
+Gnss_Signal GNSSFlowgraph::take_best_candidate(std::list<Gnss_Signal>& available_signals)
+{
+    auto best = available_signals.begin();
+    double best_score = candidate_score(*best, 0);
+    int position = 0;
+    for (auto it = available_signals.begin(); it != available_signals.end(); ++it, position++)
+        {
+            const double score = candidate_score(*it, position);
+            if (score > best_score)
+                {
+                    best = it;
+                    best_score = score;
+                }
+        }
+    const Gnss_Signal result = *best;
+    // the claimed candidate goes to the back of the list, as in the previous
+    // round-robin scheme, and is flagged in flight so that its history score
+    // cannot make it the top pick of a concurrent searcher while the
+    // acquisition is still running
+    available_signals.erase(best);
+    available_signals.push_back(result);
+    acq_history_[candidate_key(result)].in_flight = true;
+    return result;
+}
+
+
+void GNSSFlowgraph::record_acq_failure(const Gnss_Signal& gs)
+{
+    auto& hist = acq_history_[candidate_key(gs)];
+    hist.failed_attempts = std::min(hist.failed_attempts + 1, 20);
+    hist.in_flight = false;
+}
+
+
+void GNSSFlowgraph::record_acq_success(const Gnss_Signal& gs)
+{
+    auto& hist = acq_history_[candidate_key(gs)];
+    hist.failed_attempts = 0;
+    hist.in_flight = false;
+    hist.last_seen = std::chrono::steady_clock::now();
+    if (!hist.ever_seen)
+        {
+            // real C/N0 is not known until tracking reports it; start from a
+            // value that keeps the satellite attractive after a short outage
+            hist.last_cn0_db_hz = 40.0;
+            hist.ever_seen = true;
+        }
+}
+
+
+void GNSSFlowgraph::record_signal_loss(const Gnss_Signal& gs, unsigned int who)
+{
+    auto& hist = acq_history_[candidate_key(gs)];
+    hist.failed_attempts = 0;
+    hist.in_flight = false;
+    hist.last_seen = std::chrono::steady_clock::now();
+    hist.ever_seen = true;
+    // last C/N0 reported by the channel that just lost the satellite
+    std::map<int, std::shared_ptr<Gnss_Synchro>> current_channels_status = channels_status_->get_current_status_map();
+    const auto it = current_channels_status.find(static_cast<int>(who));
+    if (it != current_channels_status.end())
+        {
+            hist.last_cn0_db_hz = static_cast<float>(it->second->CN0_dB_hz);
+        }
+}
+
+
 Gnss_Signal GNSSFlowgraph::search_next_signal(const std::string& searched_signal,
     bool& is_primary_frequency,
     bool& assistance_available,
@@ -2622,10 +3796,9 @@ Gnss_Signal GNSSFlowgraph::search_next_signal(const std::string& searched_signal
     switch (mapStringValues_[searched_signal])
         {
         case evGPS_1C:
-            // todo: assist the satellite selection with almanac and current PVT here (reuse priorize_satellite function used in control_thread)
-            result = available_GPS_1C_signals_.front();
-            available_GPS_1C_signals_.pop_front();
-            available_GPS_1C_signals_.push_back(result);
+            // the control thread reorders this list by predicted elevation when
+            // GNSS-SDR.enable_visibility_scheduler is set (see priorize_satellites)
+            result = take_best_candidate(available_GPS_1C_signals_);
             is_primary_frequency = true;  // indicate that the searched satellite signal belongs to "primary" link (L1, E1, B1, etc..)
             break;
 
@@ -2660,9 +3833,7 @@ Gnss_Signal GNSSFlowgraph::search_next_signal(const std::string& searched_signal
             // fallback: pick the front satellite because there is no tracked satellites in L1 to assist L2
             if (found_signal == false)
                 {
-                    result = available_GPS_2S_signals_.front();
-                    available_GPS_2S_signals_.pop_front();
-                    available_GPS_2S_signals_.push_back(result);
+                    result = take_best_candidate(available_GPS_2S_signals_);
                 }
             break;
 
@@ -2698,16 +3869,12 @@ Gnss_Signal GNSSFlowgraph::search_next_signal(const std::string& searched_signal
             // fallback: pick the front satellite because there is no tracked satellites in L1 to assist L5
             if (found_signal == false)
                 {
-                    result = available_GPS_L5_signals_.front();
-                    available_GPS_L5_signals_.pop_front();
-                    available_GPS_L5_signals_.push_back(result);
+                    result = take_best_candidate(available_GPS_L5_signals_);
                 }
             break;
 
         case evGAL_1B:
-            result = available_GAL_1B_signals_.front();
-            available_GAL_1B_signals_.pop_front();
-            available_GAL_1B_signals_.push_back(result);
+            result = take_best_candidate(available_GAL_1B_signals_);
             is_primary_frequency = true;  // indicate that the searched satellite signal belongs to "primary" link (L1, E1, B1, etc..)
             break;
 
@@ -2743,9 +3910,7 @@ Gnss_Signal GNSSFlowgraph::search_next_signal(const std::string& searched_signal
             // fallback: pick the front satellite because there is no tracked satellites in E1 to assist E5
             if (found_signal == false)
                 {
-                    result = available_GAL_5X_signals_.front();
-                    available_GAL_5X_signals_.pop_front();
-                    available_GAL_5X_signals_.push_back(result);
+                    result = take_best_candidate(available_GAL_5X_signals_);
                 }
             break;
 
@@ -2781,9 +3946,7 @@ Gnss_Signal GNSSFlowgraph::search_next_signal(const std::string& searched_signal
             // fallback: pick the front satellite because there is no tracked satellites in E1 to assist E5
             if (found_signal == false)
                 {
-                    result = available_GAL_7X_signals_.front();
-                    available_GAL_7X_signals_.pop_front();
-                    available_GAL_7X_signals_.push_back(result);
+                    result = take_best_candidate(available_GAL_7X_signals_);
                 }
             break;
 
@@ -2819,45 +3982,33 @@ Gnss_Signal GNSSFlowgraph::search_next_signal(const std::string& searched_signal
             // fallback: pick the front satellite because there is no tracked satellites in E1 to assist E6
             if (found_signal == false)
                 {
-                    result = available_GAL_E6_signals_.front();
-                    available_GAL_E6_signals_.pop_front();
-                    available_GAL_E6_signals_.push_back(result);
+                    result = take_best_candidate(available_GAL_E6_signals_);
                 }
             break;
 
         case evGLO_1G:
-            result = available_GLO_1G_signals_.front();
-            available_GLO_1G_signals_.pop_front();
-            available_GLO_1G_signals_.push_back(result);
+            result = take_best_candidate(available_GLO_1G_signals_);
             is_primary_frequency = true;  // indicate that the searched satellite signal belongs to "primary" link (L1, E1, B1, etc..)
             break;
 
         case evGLO_2G:
-            result = available_GLO_2G_signals_.front();
-            available_GLO_2G_signals_.pop_front();
-            available_GLO_2G_signals_.push_back(result);
+            result = take_best_candidate(available_GLO_2G_signals_);
             break;
 
         case evBDS_B1:
-            result = available_BDS_B1_signals_.front();
-            available_BDS_B1_signals_.pop_front();
-            available_BDS_B1_signals_.push_back(result);
+            result = take_best_candidate(available_BDS_B1_signals_);
             is_primary_frequency = true;  // indicate that the searched satellite signal belongs to "primary" link (L1, E1, B1, etc..)
             break;
 
         case evBDS_B3:
-            result = available_BDS_B3_signals_.front();
-            available_BDS_B3_signals_.pop_front();
-            available_BDS_B3_signals_.push_back(result);
+            result = take_best_candidate(available_BDS_B3_signals_);
             break;
 
         default:
             LOG(ERROR) << "This should not happen :-(";
             if (!available_GPS_1C_signals_.empty())
                 {
-                    result = available_GPS_1C_signals_.front();
-                    available_GPS_1C_signals_.pop_front();
-                    available_GPS_1C_signals_.push_back(result);
+                    result = take_best_candidate(available_GPS_1C_signals_);
                 }
             break;
         }
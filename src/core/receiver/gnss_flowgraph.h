@@ -28,17 +28,24 @@
 #include "concurrent_queue.h"
 #include "galileo_e6_has_msg_receiver.h"
 #include "galileo_tow_map.h"
+#include "gnss_sdr_band_crossbar.h"
 #include "gnss_sdr_sample_counter.h"
 #include "gnss_signal.h"
+#include "udp_multicast_sink.h"
 #include "pvt_interface.h"
+#include "warm_start_snapshot.h"
 #include <gnuradio/blocks/null_sink.h>  // for null_sink
 #include <gnuradio/runtime_types.h>     // for basic_block_sptr, top_block_sptr
 #include <pmt/pmt.h>                    // for pmt_t
+#include <atomic>                       // for atomic
+#include <chrono>                       // for steady_clock
+#include <cstdint>                      // for uint32_t
 #include <list>                         // for list
 #include <map>                          // for map
 #include <memory>                       // for for shared_ptr, dynamic_pointer_cast
 #include <mutex>                        // for mutex
 #include <string>                       // for string
+#include <thread>                       // for thread
 #include <utility>                      // for pair
 #include <vector>                       // for vector
 #if ENABLE_FPGA
@@ -143,6 +150,15 @@ public:
      */
     bool send_telemetry_msg(const pmt::pmt_t& msg);
 
+    /*!
+     * \brief Moves a channel to another RF feed at runtime, without tearing
+     * the flowgraph down. Only available when GNSS-SDR.enable_crossbar=true
+     * wired the channels through the band crossbar; the handover is
+     * sample-aligned. The channel keeps its signal type, so the target RF
+     * channel must carry the same band.
+     */
+    bool set_channel_rf_route(int channel, int rf_channel_id);
+
     /*!
      * \brief Returns a smart pointer to the PVT object
      */
@@ -156,6 +172,33 @@ public:
      */
     void priorize_satellites(const std::vector<std::pair<int, Gnss_Satellite>>& visible_satellites);
 
+    /*!
+     * \brief Collect warm-start records from the channels with valid telemetry
+     */
+    std::vector<Warm_Start_Record> warm_start_records();
+
+    /*!
+     * \brief Pre-seed the acquisition Doppler search window of the assigned
+     * channels from a warm-start snapshot. Must be called after connect()
+     */
+    void seed_warm_start(const std::vector<Warm_Start_Record>& records);
+
+    /*!
+     * \brief Replace the per-satellite acquisition Doppler predictions
+     * computed by the control thread from almanac/ephemeris and the last
+     * known position. Values are Doppler shifts at the L1/E1 carrier in Hz,
+     * keyed by system short name character and PRN; they seed the search
+     * window center of channels without dual-frequency assistance
+     */
+    void update_acq_doppler_predictions(const std::map<std::pair<char, uint32_t>, double>& predictions_hz);
+
+    /*!
+     * \brief Push the acquisition parameters that have runtime setters
+     * (Doppler window and threshold) from a reloaded configuration into the
+     * running channels, without tearing the flow graph down
+     */
+    void apply_hot_configuration(const std::shared_ptr<ConfigurationInterface>& new_configuration);
+
 #if ENABLE_FPGA
     void start_acquisition_helper();
 
@@ -192,6 +235,33 @@ private:
 
     int assign_channels();
     void check_signal_conditioners();
+    void apply_cpu_placement();
+
+    // Deterministic profiling mode (GNSS-SDR.deterministic_profiling): pins
+    // the whole flowgraph to one core and fixes the scheduler quantum so
+    // file replays produce comparable timing profiles
+    void apply_deterministic_profiling();
+
+    // SCHED_FIFO priority bands per block role
+    // (GNSS-SDR.enable_thread_priorities), applied once the flowgraph
+    // threads are running
+    void apply_thread_priorities();
+
+    // Explicit sizing of the sample-stream buffers from the configured
+    // sampling rate and the reader block histories (GNSS-SDR.buffer_sizing)
+    void apply_buffer_sizing();
+
+    // Load governor (GNSS-SDR.enable_load_governor): suspends the weakest
+    // channels when the receiver falls behind a real-time source and
+    // restores them when headroom returns
+    void load_governor();
+    void suspend_weakest_channel(int min_tracking_channels);
+    void resume_suspended_channel();
+
+    // Performance counter monitor (PerfMonitor.enable_monitor): samples the
+    // GNU Radio work-time / throughput counters of the receiver blocks once
+    // per second and publishes them over UDP
+    void perf_monitor_process();
 
     void set_signals_list();
     void set_channels_state();  // Initializes the channels state (start acquisition or keep standby)
@@ -204,12 +274,37 @@ private:
 
     void push_back_signal(const Gnss_Signal& gs);
     void remove_signal(const Gnss_Signal& gs);
+
+    // C/N0-ordered candidate selection: every call to search_next_signal()
+    // claims the candidate with the best predicted C/N0 (list position, which
+    // the visibility scheduler keeps ordered by elevation, refined by the
+    // last-seen C/N0 history and by failed acquisition attempts). Selection
+    // and claim happen under signal_list_mutex_, so two idle channels can
+    // never claim the same candidate
+    double candidate_score(const Gnss_Signal& gs, int list_position) const;
+    Gnss_Signal take_best_candidate(std::list<Gnss_Signal>& available_signals);
+    void record_acq_failure(const Gnss_Signal& gs);
+    void record_acq_success(const Gnss_Signal& gs);
+    void record_signal_loss(const Gnss_Signal& gs, unsigned int who);
+    static std::string candidate_key(const Gnss_Signal& gs);
     void print_help();
     void check_desktop_conf_in_fpga_env();
 
     double project_doppler(const std::string& searched_signal, double primary_freq_doppler_hz);
     bool is_multiband() const;
 
+    // True if the channel index belongs to the B set of an A/B fork
+    bool is_b_channel(int channel_index) const
+    {
+        return ab_fork_enabled_ && (channel_index >= ab_fork_boundary_);
+    }
+
+    // Index of the channel mirrored in the other set of an A/B fork
+    int ab_partner(int channel_index) const
+    {
+        return is_b_channel(channel_index) ? channel_index - ab_fork_boundary_ : channel_index + ab_fork_boundary_;
+    }
+
     std::vector<std::string> split_string(const std::string& s, char delim);
     std::vector<bool> signal_conditioner_connected_;
 
@@ -224,7 +319,16 @@ private:
     std::shared_ptr<GNSSBlockInterface> observables_;
     std::shared_ptr<GNSSBlockInterface> pvt_;
 
+    // A/B fork (GNSS-SDR.enable_ab_fork): a second channel set built from the
+    // AB_Fork.* configuration overlay, appended to channels_ after the first
+    // ab_fork_boundary_ entries, with its own observables and PVT instances.
+    // B channels shadow the satellite assignment of their A partner, so both
+    // sets process the same satellites from the same conditioned samples
+    std::shared_ptr<GNSSBlockInterface> observables_b_;
+    std::shared_ptr<GNSSBlockInterface> pvt_b_;
+
     std::map<std::string, gr::basic_block_sptr> acq_resamplers_;
+    std::map<std::string, gr::basic_block_sptr> band_splitters_;
     std::vector<gr::blocks::null_sink::sptr> null_sinks_;
 
     gr::basic_block_sptr GnssSynchroMonitor_;
@@ -236,11 +340,20 @@ private:
     galileo_tow_map_sptr galileo_tow_map_;
 
     gnss_sdr_sample_counter_sptr ch_out_sample_counter_;
+    gnss_sdr_band_crossbar_sptr band_crossbar_;  // optional runtime-retunable conditioner-to-channel routing
+    UdpMulticastSink::sptr multicast_relay_sink_;  // optional fan-out of the conditioned samples to processing nodes
 #if ENABLE_FPGA
     gnss_sdr_fpga_sample_counter_sptr ch_out_fpga_sample_counter_;
 #endif
 
     std::vector<unsigned int> channels_state_;
+    std::vector<bool> channels_suspended_;
+
+    std::thread load_governor_thread_;
+    std::atomic<bool> stop_governor_{false};
+
+    std::thread perf_monitor_thread_;
+    std::atomic<bool> stop_perf_monitor_{false};
 
     std::list<Gnss_Signal> available_GPS_1C_signals_;
     std::list<Gnss_Signal> available_GPS_2S_signals_;
@@ -272,6 +385,21 @@ private:
     };
     std::map<std::string, StringValue> mapStringValues_;
 
+    std::map<std::pair<char, uint32_t>, double> acq_doppler_predictions_;
+    mutable std::mutex acq_doppler_predictions_mutex_;
+
+    // per-candidate acquisition history, shared by all channels and protected
+    // by signal_list_mutex_
+    struct AcqCandidateHistory
+    {
+        std::chrono::steady_clock::time_point last_seen;
+        float last_cn0_db_hz{0.0};
+        int failed_attempts{0};
+        bool ever_seen{false};
+        bool in_flight{false};  // handed to a channel, acquisition not resolved yet
+    };
+    std::map<std::string, AcqCandidateHistory> acq_history_;
+
     std::string config_file_;
     std::string help_hint_;
 
@@ -281,7 +409,9 @@ private:
     int channels_count_;
     int acq_channels_count_;
     int max_acq_channels_;
+    int ab_fork_boundary_;  // number of A-set channels; B-set channels start at this index
 
+    bool ab_fork_enabled_;
     bool connected_;
     bool running_;
     bool multiband_;
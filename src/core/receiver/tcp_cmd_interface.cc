@@ -22,6 +22,8 @@
 #include <cmath>      // for isnan
 #include <exception>  // for exception
 #include <iomanip>    // for setprecision
+#include <iostream>   // for cout, cerr
+#include <iterator>   // for istream_iterator
 #include <sstream>    // for stringstream
 #include <utility>    // for move
 
@@ -118,6 +120,28 @@ std::string TcpCmdInterface::standby(const std::vector<std::string> &commandLine
 
 
 std::string TcpCmdInterface::status(const std::vector<std::string> &commandLine __attribute__((unused)))
+{
+    // serve the snapshot refreshed by the control thread, so frequent status
+    // polls never contend with receiver control or the PVT engine
+    const std::shared_ptr<const std::string> snapshot = std::atomic_load(&status_snapshot_);
+    if (snapshot)
+        {
+            return *snapshot;
+        }
+    return format_status();
+}
+
+
+void TcpCmdInterface::update_status_snapshot()
+{
+    if (PVT_sptr_ != nullptr)
+        {
+            std::atomic_store(&status_snapshot_, std::shared_ptr<const std::string>(std::make_shared<const std::string>(format_status())));
+        }
+}
+
+
+std::string TcpCmdInterface::format_status()
 {
     std::stringstream str_stream;
     // todo: implement the receiver status report
@@ -302,120 +326,156 @@ void TcpCmdInterface::set_msg_queue(std::shared_ptr<Concurrent_Queue<pmt::pmt_t>
 }
 
 
+std::string TcpCmdInterface::execute_command(const std::string &line, bool &close_connection)
+{
+    close_connection = false;
+    std::string response;
+    std::istringstream iss(line);
+    const std::vector<std::string> cmd_vector(std::istream_iterator<std::string>{iss},
+        std::istream_iterator<std::string>());
+
+    if (!cmd_vector.empty())
+        {
+            try
+                {
+                    if (cmd_vector.at(0) == "exit")
+                        {
+                            close_connection = true;
+                            response = "OK\n";
+                        }
+                    else
+                        {
+                            response = functions_[cmd_vector.at(0)](cmd_vector);
+                        }
+                }
+            catch (const std::bad_function_call &ex)
+                {
+                    response = "ERROR: command not found \n ";
+                }
+            catch (const std::exception &ex)
+                {
+                    response = "ERROR: command execution error: " + std::string(ex.what()) + "\n";
+                }
+        }
+    else
+        {
+            response = "ERROR: empty command\n";
+        }
+    return response;
+}
+
+
+/*
+ * One client connection of the telecommand server. Sessions own their socket,
+ * keep themselves alive through the shared_ptr captured in the handlers, and
+ * run on the single server thread, so any number of clients can be served
+ * without per-connection threads or locks. Commands already buffered behind
+ * the current line are picked up by the next async_read_until without a
+ * round trip, which gives pipelined clients one-pass service.
+ */
+class Tcp_Cmd_Session : public std::enable_shared_from_this<Tcp_Cmd_Session>
+{
+public:
+    Tcp_Cmd_Session(boost::asio::ip::tcp::socket socket, TcpCmdInterface *cmd_interface)
+        : socket_(std::move(socket)), cmd_interface_(cmd_interface)
+    {
+    }
+
+    void start()
+    {
+        do_read();
+    }
+
+private:
+    void do_read()
+    {
+        auto self = shared_from_this();
+        boost::asio::async_read_until(socket_, buffer_, '\n',
+            [this, self](const boost::system::error_code &error, size_t bytes_transferred __attribute__((unused))) {
+                if (error)
+                    {
+                        close();
+                        return;
+                    }
+                std::istream is(&buffer_);
+                std::string line;
+                std::getline(is, line);
+                bool close_connection = false;
+                const std::string response = cmd_interface_->execute_command(line, close_connection);
+                do_write(response, close_connection);
+            });
+    }
+
+    void do_write(const std::string &response, bool close_after)
+    {
+        auto self = shared_from_this();
+        auto response_buffer = std::make_shared<std::string>(response);
+        boost::asio::async_write(socket_, boost::asio::buffer(*response_buffer),
+            [this, self, response_buffer, close_after](const boost::system::error_code &error, size_t bytes_transferred __attribute__((unused))) {
+                if (error || close_after)
+                    {
+                        close();
+                        return;
+                    }
+                do_read();
+            });
+    }
+
+    void close()
+    {
+        boost::system::error_code not_throw;
+        socket_.close(not_throw);
+    }
+
+    boost::asio::ip::tcp::socket socket_;
+    boost::asio::streambuf buffer_;
+    TcpCmdInterface *cmd_interface_;
+};
+
+
 void TcpCmdInterface::run_cmd_server(int tcp_port)
 {
     // Get the port from the parameters
     const uint16_t port = tcp_port;
 
-    // Error to not throw exception
-    boost::system::error_code not_throw;
-
-    // Socket and acceptor
     b_io_context context;
     try
         {
             boost::asio::ip::tcp::acceptor acceptor(context, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port));
-
-            while (keep_running_)
-                {
-                    try
+            std::cout << "TcpCmdInterface: Telecommand TCP interface listening on port " << tcp_port << '\n';
+
+            // accept loop: each accepted connection becomes a self-contained
+            // session and the acceptor immediately rearms itself
+            std::function<void()> start_accept = [&]() {
+                auto socket = std::make_shared<boost::asio::ip::tcp::socket>(context);
+                acceptor.async_accept(*socket, [&, socket](const boost::system::error_code &error) {
+                    if (!error)
                         {
-                            std::cout << "TcpCmdInterface: Telecommand TCP interface listening on port " << tcp_port << '\n';
-
-                            boost::asio::ip::tcp::socket socket(context);
-                            acceptor.accept(socket, not_throw);
-                            if (not_throw)
-                                {
-                                    std::cerr << "TcpCmdInterface: Error when binding the port in the socket\n";
-                                    continue;
-                                }
-
-                            // Read a message
-                            boost::system::error_code error = boost::asio::error::eof;
-                            do
-                                {
-                                    std::string response;
-                                    boost::asio::streambuf b;
-                                    if (boost::asio::read_until(socket, b, '\n', error) == 0)
-                                        {
-                                            std::cerr << "TcpCmdInterface: Error reading messages: " << error.message() << '\n';
-                                        }
-                                    std::istream is(&b);
-                                    std::string line;
-                                    std::getline(is, line);
-                                    std::istringstream iss(line);
-                                    const std::vector<std::string> cmd_vector(std::istream_iterator<std::string>{iss},
-                                        std::istream_iterator<std::string>());
-
-                                    if (!cmd_vector.empty())
-                                        {
-                                            try
-                                                {
-                                                    if (cmd_vector.at(0) == "exit")
-                                                        {
-                                                            error = boost::asio::error::eof;
-                                                            // send cmd response
-                                                            if (socket.write_some(boost::asio::buffer("OK\n"), not_throw) == 0)
-                                                                {
-                                                                    std::cerr << "Error: 0 bytes sent in cmd response\n";
-                                                                }
-                                                        }
-                                                    else
-                                                        {
-                                                            response = functions_[cmd_vector.at(0)](cmd_vector);
-                                                        }
-                                                }
-                                            catch (const std::bad_function_call &ex)
-                                                {
-                                                    response = "ERROR: command not found \n ";
-                                                }
-                                            catch (const std::exception &ex)
-                                                {
-                                                    response = "ERROR: command execution error: " + std::string(ex.what()) + "\n";
-                                                }
-                                        }
-                                    else
-                                        {
-                                            response = "ERROR: empty command\n";
-                                        }
-
-                                    // send cmd response
-                                    if (socket.write_some(boost::asio::buffer(response), not_throw) == 0)
-                                        {
-                                            std::cerr << "Error: 0 bytes sent in cmd response\n";
-                                        }
-                                    if (not_throw)
-                                        {
-                                            std::cerr << "Error sending(" << not_throw.value() << "): " << not_throw.message() << '\n';
-                                            break;
-                                        }
-                                }
-                            while (error != boost::asio::error::eof);
-
-                            if (error == boost::asio::error::eof)
-                                {
-                                    std::cerr << "TcpCmdInterface: EOF detected\n";
-                                }
-                            else
-                                {
-                                    std::cerr << "TcpCmdInterface unexpected error: " << error << '\n';
-                                }
-
-                            // Close socket
-                            socket.close();
+                            std::make_shared<Tcp_Cmd_Session>(std::move(*socket), this)->start();
                         }
-                    catch (const boost::exception &e)
+                    else
                         {
-                            std::cerr << "TcpCmdInterface: Boost exception\n";
+                            std::cerr << "TcpCmdInterface: Error accepting connection: " << error.message() << '\n';
                         }
-                    catch (const std::exception &ex)
+                    if (keep_running_)
                         {
-                            std::cerr << "TcpCmdInterface: Exception " << ex.what() << '\n';
+                            start_accept();
                         }
-                }
+                });
+            };
+            start_accept();
+
+            // the context multiplexes the acceptor and every client session
+            // on this thread; status queries are served from the snapshot and
+            // never touch the receiver control plane
+            context.run();
         }
     catch (const boost::exception &e)
         {
             std::cerr << "TCP Command Interface exception: address already in use\n";
         }
+    catch (const std::exception &ex)
+        {
+            std::cerr << "TcpCmdInterface: Exception " << ex.what() << '\n';
+        }
 }
@@ -46,6 +46,21 @@ public:
     void run_cmd_server(int tcp_port);
     void set_msg_queue(std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue);
 
+    /*!
+     * \brief Parses and executes a single command line. Sets
+     * close_connection when the client requested to end the session.
+     * Called by the TCP sessions from the server thread
+     */
+    std::string execute_command(const std::string &line, bool &close_connection);
+
+    /*!
+     * \brief Refreshes the preformatted status report served to the clients.
+     *
+     * Called periodically by the control thread, so status queries read a
+     * ready-made snapshot instead of querying the PVT engine per request
+     */
+    void update_status_snapshot();
+
     /*!
      * \brief gets the UTC time parsed from the last TC command issued
      */
@@ -61,6 +76,7 @@ public:
 private:
     std::unordered_map<std::string, std::function<std::string(const std::vector<std::string> &)>>
         functions_;
+    std::string format_status();
     std::string status(const std::vector<std::string> &commandLine);
     std::string reset(const std::vector<std::string> &commandLine);
     std::string standby(const std::vector<std::string> &commandLine);
@@ -73,6 +89,7 @@ private:
 
     std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue_;
     std::shared_ptr<PvtInterface> PVT_sptr_;
+    std::shared_ptr<const std::string> status_snapshot_;  // accessed with std::atomic_load / std::atomic_store
 
     float rx_latitude_;
     float rx_longitude_;
@@ -0,0 +1,109 @@
+/*!
+ * \file warm_start_snapshot.cc
+ * \brief Binary snapshot of per-satellite acquisition state for warm starts
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "warm_start_snapshot.h"
+#include <glog/logging.h>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+const char snapshot_magic[8] = {'G', 'S', 'D', 'R', 'W', 'S', 'T', '\0'};
+constexpr uint32_t snapshot_version = 1;
+
+struct Snapshot_Header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t n_records;
+    int64_t saved_utc_s;  // seconds since the Unix epoch at save time
+};
+
+int64_t now_utc_s()
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+}  // namespace
+
+
+bool Warm_Start_Snapshot::save(const std::string& filename, const std::vector<Warm_Start_Record>& records)
+{
+    std::ofstream file(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+        {
+            LOG(WARNING) << "Could not open " << filename << " for writing the warm-start snapshot";
+            return false;
+        }
+    Snapshot_Header header{};
+    std::memcpy(header.magic, snapshot_magic, sizeof(header.magic));
+    header.version = snapshot_version;
+    header.n_records = static_cast<uint32_t>(records.size());
+    header.saved_utc_s = now_utc_s();
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!records.empty())
+        {
+            file.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(Warm_Start_Record)));
+        }
+    if (!file.good())
+        {
+            LOG(WARNING) << "Failure writing the warm-start snapshot to " << filename;
+            return false;
+        }
+    return true;
+}
+
+
+std::vector<Warm_Start_Record> Warm_Start_Snapshot::load(const std::string& filename, int64_t max_age_s)
+{
+    std::ifstream file(filename, std::ios::in | std::ios::binary);
+    if (!file.is_open())
+        {
+            DLOG(INFO) << "No warm-start snapshot found at " << filename;
+            return {};
+        }
+    Snapshot_Header header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file.good() || std::memcmp(header.magic, snapshot_magic, sizeof(header.magic)) != 0)
+        {
+            LOG(WARNING) << filename << " is not a warm-start snapshot";
+            return {};
+        }
+    if (header.version != snapshot_version)
+        {
+            LOG(WARNING) << "Unsupported warm-start snapshot version " << header.version << " in " << filename;
+            return {};
+        }
+    const int64_t age_s = now_utc_s() - header.saved_utc_s;
+    if (age_s < 0 || age_s > max_age_s)
+        {
+            LOG(INFO) << "Discarding warm-start snapshot " << filename << ": " << age_s << " s old, maximum is " << max_age_s << " s";
+            return {};
+        }
+    std::vector<Warm_Start_Record> records(header.n_records);
+    if (header.n_records > 0)
+        {
+            file.read(reinterpret_cast<char*>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(Warm_Start_Record)));
+            if (!file.good())
+                {
+                    LOG(WARNING) << "Truncated warm-start snapshot " << filename;
+                    return {};
+                }
+        }
+    return records;
+}
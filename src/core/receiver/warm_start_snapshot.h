@@ -0,0 +1,66 @@
+/*!
+ * \file warm_start_snapshot.h
+ * \brief Binary snapshot of per-satellite acquisition state for warm starts
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * On shutdown the receiver can persist the last Doppler estimate of every
+ * satellite with valid telemetry in a single small binary image. On the next
+ * start the image is read back and, if recent enough, used to pre-seed the
+ * acquisition search windows, cutting the time to first fix on receivers
+ * that power-cycle often. Ephemeris, almanac and clock models keep using the
+ * existing XML assistance files.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_WARM_START_SNAPSHOT_H
+#define GNSS_SDR_WARM_START_SNAPSHOT_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver
+ * \{ */
+
+
+/*!
+ * \brief Per-satellite state stored in the warm-start image
+ */
+struct Warm_Start_Record
+{
+    char system;         // system character as in Gnss_Synchro ('G', 'E', ...)
+    char signal[3];      // signal string as in Gnss_Synchro ("1C", "5X", ...)
+    uint32_t prn;        // satellite PRN
+    double doppler_hz;   // last carrier Doppler estimate
+    double rx_time_s;    // receiver time of the estimate, seconds of week
+};
+
+/*!
+ * \brief Reads and writes the warm-start binary image
+ */
+class Warm_Start_Snapshot
+{
+public:
+    //! Writes the records to filename, returns true on success
+    static bool save(const std::string& filename, const std::vector<Warm_Start_Record>& records);
+
+    //! Reads the records back. Returns an empty vector if the file is
+    //! missing, malformed, or older than max_age_s seconds
+    static std::vector<Warm_Start_Record> load(const std::string& filename, int64_t max_age_s);
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_WARM_START_SNAPSHOT_H
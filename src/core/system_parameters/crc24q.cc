@@ -0,0 +1,82 @@
+/*!
+ * \file crc24q.cc
+ * \brief Implementation of the CRC-24Q cyclic redundancy check routine
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "crc24q.h"
+#include <array>
+
+namespace
+{
+constexpr uint32_t CRC24Q_POLYNOMIAL = 0x1864CFB;
+constexpr uint32_t CRC24Q_MASK = 0xFFFFFF;
+
+// table[k][b] is the CRC-24Q of byte b followed by k zero bytes, so eight
+// input bytes can be folded into the running remainder with one table lookup
+// each (slice-by-8)
+std::array<std::array<uint32_t, 256>, 8> generate_tables()
+{
+    std::array<std::array<uint32_t, 256>, 8> table{};
+    for (uint32_t byte = 0; byte < 256; byte++)
+        {
+            uint32_t crc = byte << 16;
+            for (int bit = 0; bit < 8; bit++)
+                {
+                    crc <<= 1;
+                    if ((crc & 0x1000000) != 0)
+                        {
+                            crc ^= CRC24Q_POLYNOMIAL;
+                        }
+                }
+            table[0][byte] = crc & CRC24Q_MASK;
+        }
+    for (int slice = 1; slice < 8; slice++)
+        {
+            for (uint32_t byte = 0; byte < 256; byte++)
+                {
+                    const uint32_t crc = table[slice - 1][byte];
+                    table[slice][byte] = ((crc << 8) & CRC24Q_MASK) ^ table[0][(crc >> 16) & 0xFF];
+                }
+        }
+    return table;
+}
+
+const std::array<std::array<uint32_t, 256>, 8> CRC24Q_TABLE = generate_tables();
+}  // namespace
+
+
+uint32_t compute_crc_24q(const unsigned char* data, size_t length)
+{
+    uint32_t crc = 0;
+    // the 24-bit remainder spans the first three bytes of each slice
+    while (length >= 8)
+        {
+            crc = CRC24Q_TABLE[7][data[0] ^ ((crc >> 16) & 0xFF)] ^
+                  CRC24Q_TABLE[6][data[1] ^ ((crc >> 8) & 0xFF)] ^
+                  CRC24Q_TABLE[5][data[2] ^ (crc & 0xFF)] ^
+                  CRC24Q_TABLE[4][data[3]] ^
+                  CRC24Q_TABLE[3][data[4]] ^
+                  CRC24Q_TABLE[2][data[5]] ^
+                  CRC24Q_TABLE[1][data[6]] ^
+                  CRC24Q_TABLE[0][data[7]];
+            data += 8;
+            length -= 8;
+        }
+    while (length > 0)
+        {
+            crc = ((crc << 8) & CRC24Q_MASK) ^ CRC24Q_TABLE[0][((crc >> 16) ^ *data) & 0xFF];
+            data++;
+            length--;
+        }
+    return crc;
+}
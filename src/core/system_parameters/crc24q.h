@@ -0,0 +1,42 @@
+/*!
+ * \file crc24q.h
+ * \brief Interface of the CRC-24Q cyclic redundancy check routine
+ *
+ * CRC-24Q (polynomial 0x1864CFB, zero initial value, no reflection) protects
+ * the Galileo I/NAV, F/NAV and C/NAV (HAS) navigation messages as well as
+ * RTCM frames. This implementation processes eight input bytes per step with
+ * sliced lookup tables, replacing the byte-at-a-time loops previously used by
+ * the message classes.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2021  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_CRC24Q_H
+#define GNSS_SDR_CRC24Q_H
+
+#include <cstddef>
+#include <cstdint>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup System_Parameters
+ * \{ */
+
+
+/*!
+ * \brief Computes the CRC-24Q checksum of a byte sequence
+ */
+uint32_t compute_crc_24q(const unsigned char* data, size_t length);
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_CRC24Q_H
@@ -17,20 +17,15 @@
  */
 
 #include "galileo_cnav_message.h"
-#include <boost/crc.hpp>             // for boost::crc_basic, boost::crc_optimal
+#include "crc24q.h"
 #include <boost/dynamic_bitset.hpp>  // for boost::dynamic_bitset
 #include <glog/logging.h>
 #include <algorithm>  // for reverse
 #include <limits>
 #include <vector>
 
-using CRC_Galileo_CNAV_type = boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false>;
-
-
 bool Galileo_Cnav_Message::CRC_test(const std::bitset<GALILEO_CNAV_BITS_FOR_CRC>& bits, uint32_t checksum) const
 {
-    CRC_Galileo_CNAV_type crc_galileo_e6b;
-
     // Galileo CNAV frame for CRC is not an integer multiple of bytes
     // it needs to be filled with zeroes at the start of the frame.
     // This operation is done in the transformation from bits to bytes
@@ -42,9 +37,7 @@ bool Galileo_Cnav_Message::CRC_test(const std::bitset<GALILEO_CNAV_BITS_FOR_CRC>
     boost::to_block_range(frame_bits, std::back_inserter(bytes));
     std::reverse(bytes.begin(), bytes.end());
 
-    crc_galileo_e6b.process_bytes(bytes.data(), GALILEO_CNAV_BYTES_FOR_CRC);
-
-    const uint32_t crc_computed = crc_galileo_e6b.checksum();
+    const uint32_t crc_computed = compute_crc_24q(bytes.data(), GALILEO_CNAV_BYTES_FOR_CRC);
     if (checksum == crc_computed)
         {
             return true;
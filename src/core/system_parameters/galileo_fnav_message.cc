@@ -21,16 +21,13 @@
  */
 
 #include "galileo_fnav_message.h"
-#include <boost/crc.hpp>  // for boost::crc_basic, boost::crc_optimal
+#include "crc24q.h"
 #include <boost/dynamic_bitset.hpp>
 #include <glog/logging.h>
 #include <algorithm>  // for reverse
 #include <iostream>   // for string, operator<<
 #include <iterator>   // for back_insert_iterator
 
-using CRC_Galileo_FNAV_type = boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false>;
-
-
 void Galileo_Fnav_Message::split_page(const std::string& page_string)
 {
     const std::string message_word = page_string.substr(0, 214);
@@ -52,8 +49,6 @@ void Galileo_Fnav_Message::split_page(const std::string& page_string)
 
 bool Galileo_Fnav_Message::CRC_test(const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS>& bits, uint32_t checksum) const
 {
-    CRC_Galileo_FNAV_type CRC_Galileo;
-
     // Galileo FNAV frame for CRC is not an integer multiple of bytes
     // it needs to be filled with zeroes at the start of the frame.
     // This operation is done in the transformation from bits to bytes
@@ -66,9 +61,7 @@ bool Galileo_Fnav_Message::CRC_test(const std::bitset<GALILEO_FNAV_DATA_FRAME_BI
     boost::to_block_range(frame_bits, std::back_inserter(bytes));
     std::reverse(bytes.begin(), bytes.end());
 
-    CRC_Galileo.process_bytes(bytes.data(), GALILEO_FNAV_DATA_FRAME_BYTES);
-
-    const uint32_t crc_computed = CRC_Galileo.checksum();
+    const uint32_t crc_computed = compute_crc_24q(bytes.data(), GALILEO_FNAV_DATA_FRAME_BYTES);
     if (checksum == crc_computed)
         {
             return true;
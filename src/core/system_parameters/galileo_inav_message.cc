@@ -17,9 +17,9 @@
  */
 
 #include "galileo_inav_message.h"
+#include "crc24q.h"
 #include "galileo_reduced_ced.h"
 #include "reed_solomon.h"
-#include <boost/crc.hpp>             // for boost::crc_basic, boost::crc_optimal
 #include <boost/dynamic_bitset.hpp>  // for boost::dynamic_bitset
 #include <glog/logging.h>            // for DLOG
 #include <algorithm>                 // for reverse
@@ -28,9 +28,6 @@
 #include <numeric>                   // for std::accumulate
 
 
-using CRC_Galileo_INAV_type = boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false>;
-
-
 Galileo_Inav_Message::Galileo_Inav_Message()
 {
     rs_buffer = std::vector<uint8_t>(INAV_RS_BUFFER_LENGTH, 0);
@@ -46,8 +43,6 @@ Galileo_Inav_Message::~Galileo_Inav_Message() = default;
 
 bool Galileo_Inav_Message::CRC_test(const std::bitset<GALILEO_DATA_FRAME_BITS>& bits, uint32_t checksum) const
 {
-    CRC_Galileo_INAV_type CRC_Galileo;
-
     // Galileo INAV frame for CRC is not an integer multiple of bytes
     // it needs to be filled with zeroes at the start of the frame.
     // This operation is done in the transformation from bits to bytes
@@ -60,9 +55,7 @@ bool Galileo_Inav_Message::CRC_test(const std::bitset<GALILEO_DATA_FRAME_BITS>&
     boost::to_block_range(frame_bits, std::back_inserter(bytes));
     std::reverse(bytes.begin(), bytes.end());
 
-    CRC_Galileo.process_bytes(bytes.data(), GALILEO_DATA_FRAME_BYTES);
-
-    const uint32_t crc_computed = CRC_Galileo.checksum();
+    const uint32_t crc_computed = compute_crc_24q(bytes.data(), GALILEO_DATA_FRAME_BYTES);
     if (checksum == crc_computed)
         {
             return true;
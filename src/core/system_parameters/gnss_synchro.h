@@ -79,6 +79,7 @@ public:
     bool Flag_valid_word{};                //!< Set by Telemetry Decoder processing block
     bool Flag_valid_pseudorange{};         //!< Set by Observables processing block
     bool Flag_PLL_180_deg_phase_locked{};  //!< Set by Telemetry Decoder processing block
+    bool Flag_carrier_lock{};              //!< Set by Tracking processing block from its carrier lock detector
 
     /// Copy constructor
     Gnss_Synchro(const Gnss_Synchro& other) noexcept = default;
@@ -117,6 +118,7 @@ public:
                 this->Flag_valid_word = rhs.Flag_valid_word;
                 this->Flag_valid_pseudorange = rhs.Flag_valid_pseudorange;
                 this->Flag_PLL_180_deg_phase_locked = rhs.Flag_PLL_180_deg_phase_locked;
+                this->Flag_carrier_lock = rhs.Flag_carrier_lock;
             }
         return *this;
     };
@@ -157,6 +159,7 @@ public:
                 this->Flag_valid_word = other.Flag_valid_word;
                 this->Flag_valid_pseudorange = other.Flag_valid_pseudorange;
                 this->Flag_PLL_180_deg_phase_locked = other.Flag_PLL_180_deg_phase_locked;
+                this->Flag_carrier_lock = other.Flag_carrier_lock;
 
                 // Leave the source object in a valid but unspecified state
                 other.Signal[0] = '\0';
@@ -187,6 +190,7 @@ public:
                 other.Flag_valid_word = false;
                 other.Flag_valid_pseudorange = false;
                 other.Flag_PLL_180_deg_phase_locked = false;
+                other.Flag_carrier_lock = false;
             }
         return *this;
     };
@@ -234,6 +238,7 @@ public:
         ar& BOOST_SERIALIZATION_NVP(Flag_valid_word);
         ar& BOOST_SERIALIZATION_NVP(Flag_valid_pseudorange);
         ar& BOOST_SERIALIZATION_NVP(Flag_PLL_180_deg_phase_locked);
+        ar& BOOST_SERIALIZATION_NVP(Flag_carrier_lock);
     }
 };
 
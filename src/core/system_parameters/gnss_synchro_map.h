@@ -0,0 +1,43 @@
+/*!
+ * \file gnss_synchro_map.h
+ * \brief Container holding the observables of one epoch, keyed by channel ID
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SYNCHRO_MAP_H
+#define GNSS_SDR_GNSS_SYNCHRO_MAP_H
+
+#include "gnss_synchro.h"
+#include <boost/container/flat_map.hpp>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup System_Parameters core_system_parameters
+ * \{ */
+
+
+/*!
+ * \brief Set of Gnss_Synchro observables of a single epoch, keyed by channel ID.
+ *
+ * This container is rebuilt on every observables epoch, so it is a flat map
+ * (a sorted vector of key-value pairs) rather than a node-based std::map:
+ * the elements are stored contiguously, and capacity obtained with reserve()
+ * survives clear(), so once warmed up the per-epoch rebuild performs no heap
+ * allocations. The interface is the same as std::map.
+ */
+using Gnss_Synchro_Map = boost::container::flat_map<int, Gnss_Synchro>;
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SYNCHRO_MAP_H
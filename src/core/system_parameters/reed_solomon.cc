@@ -808,7 +808,47 @@ int ReedSolomon::decode(std::vector<uint8_t>& data_to_decode, const std::vector<
 }
 
 
-int ReedSolomon::decode_rs_8(uint8_t* data, const int* eras_pos, int no_eras) const
+void ReedSolomon::update_syndromes(std::vector<uint8_t>& syndromes, uint8_t symbol, int position) const
+{
+    if (symbol == 0)
+        {
+            return;
+        }
+    const int symbol_index = d_index_of[symbol];
+    const int power = d_symbols_per_block - d_pad - 1 - position;
+    for (int i = 0; i < d_nroots; i++)
+        {
+            const int root_exponent = ((d_fcr + i) * d_prim * power) % d_symbols_per_block;
+            syndromes[i] ^= d_alpha_to[mod255(symbol_index + root_exponent)];
+        }
+}
+
+
+int ReedSolomon::decode_with_syndromes(std::vector<uint8_t>& data_to_decode,
+    const std::vector<uint8_t>& syndromes,
+    const std::vector<int>& erasure_positions) const
+{
+    int result = -1;
+    if (erasure_positions.size() > std::size_t(d_nroots))
+        {
+            std::cerr << "Reed Solomon usage error: too much erasure positions.\n";
+            return result;
+        }
+    if (syndromes.size() != static_cast<size_t>(d_nroots))
+        {
+            std::cerr << "Reed Solomon usage error: wrong syndrome vector size in decode_with_syndromes method.\n";
+            return result;
+        }
+    if (data_to_decode.size() != static_cast<size_t>(d_symbols_per_block))
+        {
+            std::cerr << "Reed Solomon usage error: wrong vector input size in decode_with_syndromes method.\n";
+            return result;
+        }
+    return decode_rs_8(data_to_decode.data(), erasure_positions.data(), erasure_positions.size(), syndromes.data());
+}
+
+
+int ReedSolomon::decode_rs_8(uint8_t* data, const int* eras_pos, int no_eras, const uint8_t* syndromes) const
 {
     int deg_lambda;
     int el;
@@ -838,23 +878,34 @@ int ReedSolomon::decode_rs_8(uint8_t* data, const int* eras_pos, int no_eras) co
     std::vector<uint8_t> loc(d_nroots);
 
     // Syndrome computation
-    // form the syndromes; i.e., evaluate data(x) at roots of g(x)
-    for (i = 0; i < d_nroots; i++)
+    if (syndromes != nullptr)
         {
-            s[i] = data[0];
+            // the caller accumulated the syndromes incrementally
+            for (i = 0; i < d_nroots; i++)
+                {
+                    s[i] = syndromes[i];
+                }
         }
-
-    for (j = 1; j < d_symbols_per_block - d_pad; j++)
+    else
         {
+            // form the syndromes; i.e., evaluate data(x) at roots of g(x)
             for (i = 0; i < d_nroots; i++)
                 {
-                    if (s[i] == 0)
-                        {
-                            s[i] = data[j];
-                        }
-                    else
+                    s[i] = data[0];
+                }
+
+            for (j = 1; j < d_symbols_per_block - d_pad; j++)
+                {
+                    for (i = 0; i < d_nroots; i++)
                         {
-                            s[i] = data[j] ^ d_alpha_to[mod255(d_index_of[s[i]] + (d_fcr + i) * d_prim)];
+                            if (s[i] == 0)
+                                {
+                                    s[i] = data[j];
+                                }
+                            else
+                                {
+                                    s[i] = data[j] ^ d_alpha_to[mod255(d_index_of[s[i]] + (d_fcr + i) * d_prim)];
+                                }
                         }
                 }
         }
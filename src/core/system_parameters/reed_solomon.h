@@ -101,6 +101,31 @@ public:
     int decode(std::vector<uint8_t>& data_to_decode,
         const std::vector<int>& erasure_positions = std::vector<int>{}) const;
 
+    /*!
+     * \brief Add the contribution of a single symbol to a set of syndromes.
+     *
+     * The syndromes vector must have nroots elements (in value form), all
+     * zeros for a fully erased block. position is the symbol index within the
+     * unshortened block. Zero symbols do not change the syndromes, so only
+     * received symbols need to be folded in, making the accumulated cost
+     * proportional to the number of received symbols instead of the block
+     * length.
+     */
+    void update_syndromes(std::vector<uint8_t>& syndromes, uint8_t symbol, int position) const;
+
+    /*!
+     * \brief Decode an encoded block with externally accumulated syndromes.
+     *
+     * Behaves like decode(), but skips the syndrome computation and takes the
+     * values incrementally accumulated with update_syndromes() instead. Only
+     * available for full-length (255 symbol) input blocks.
+     *
+     * Returns the number of corrected errors, or -1 if decoding failed.
+     */
+    int decode_with_syndromes(std::vector<uint8_t>& data_to_decode,
+        const std::vector<uint8_t>& syndromes,
+        const std::vector<int>& erasure_positions = std::vector<int>{}) const;
+
     /*!
      * \brief Encode data with the generator matrix (for testing purposes)
      *
@@ -123,7 +148,7 @@ private:
 
     int mod255(int x) const;
     int rs_min(int a, int b) const;
-    int decode_rs_8(uint8_t* data, const int* eras_pos, int no_eras) const;
+    int decode_rs_8(uint8_t* data, const int* eras_pos, int no_eras, const uint8_t* syndromes = nullptr) const;
 
     uint8_t galois_mul(uint8_t a, uint8_t b) const;
     uint8_t galois_add(uint8_t a, uint8_t b) const;
@@ -0,0 +1,290 @@
+/*!
+ * \file rinex_nav_batch.cc
+ * \brief Batch converter from archived navigation data XML files to RINEX
+ * navigation files, with file-level parallelism
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * The receiver archives the decoded navigation data as XML files
+ * (GNSS-SDR.SUPL_gps_ephemeris_xml and friends, also written at shutdown).
+ * This tool converts a set of those archives to RINEX NAV without running
+ * the receiver, one worker thread per file, reusing the Rinex_Printer
+ * formatting engine.
+ *
+ * Usage:
+ *   rinex-nav-batch [flags] eph1.xml [eph2.xml ...]
+ *
+ * The GNSS system of each archive is inferred from its file name
+ * (e.g. gal_ephemeris.xml, glo_gnav_ephemeris.xml) and can be forced for
+ * all inputs with --system=gps|gps_cnav|galileo|glonass. UTC and
+ * ionospheric model archives can be supplied with --utc_xml and
+ * --iono_xml; without them the headers carry zeroed correction terms.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_VERSION
+#define GNSS_SDR_VERSION "0.0.18"
+#endif
+
+#include "gnss_sdr_filesystem.h"
+#include "gnss_sdr_supl_client.h"
+#include "gps_cnav_iono.h"
+#include "rinex_printer.h"
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+#include <algorithm>  // for transform
+#include <atomic>     // for atomic
+#include <cctype>     // for tolower
+#include <iostream>   // for cout, cerr
+#include <mutex>      // for mutex, lock_guard
+#include <string>     // for string
+#include <thread>     // for thread
+#include <vector>     // for vector
+
+#if GFLAGS_OLD_NAMESPACE
+namespace gflags
+{
+using namespace google;
+}
+#endif
+
+DEFINE_string(system, "", "Force the GNSS system of all inputs: gps, gps_cnav, galileo or glonass (default: infer from each file name)");
+DEFINE_string(utc_xml, "", "Optional UTC model XML archive for the navigation file headers");
+DEFINE_string(iono_xml, "", "Optional ionospheric model XML archive for the navigation file headers");
+DEFINE_string(output_dir, ".", "Directory where the RINEX navigation files are created");
+DEFINE_int32(rinex_version, 3, "RINEX version of the output files (2 or 3)");
+DEFINE_int32(jobs, 0, "Number of worker threads (0: one per hardware thread)");
+
+namespace
+{
+enum class Nav_System
+{
+    gps,
+    gps_cnav,
+    galileo,
+    glonass,
+    unknown
+};
+
+// the XML archives are deserialized under this lock: the Boost.Serialization
+// type registry is process-global and its lazy initialization is not
+// thread-safe, while the formatting stage (the dominant cost) is per-file
+std::mutex load_mutex;
+std::mutex console_mutex;
+
+Nav_System parse_system(const std::string& name)
+{
+    std::string lower(name);
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return std::tolower(c); });
+    if (lower.find("cnav") != std::string::npos)
+        {
+            return Nav_System::gps_cnav;
+        }
+    if (lower.find("gal") != std::string::npos)
+        {
+            return Nav_System::galileo;
+        }
+    if (lower.find("glo") != std::string::npos or lower.find("gnav") != std::string::npos)
+        {
+            return Nav_System::glonass;
+        }
+    if (lower.find("gps") != std::string::npos)
+        {
+            return Nav_System::gps;
+        }
+    return Nav_System::unknown;
+}
+
+
+bool convert_file(const std::string& input_file, Nav_System system)
+{
+    Gnss_Sdr_Supl_Client archive;
+    bool loaded = false;
+    {
+        std::lock_guard<std::mutex> lock(load_mutex);
+        switch (system)
+            {
+            case Nav_System::gps:
+                loaded = archive.load_ephemeris_xml(input_file);
+                if (loaded and !FLAGS_utc_xml.empty())
+                    {
+                        archive.load_utc_xml(FLAGS_utc_xml);
+                    }
+                if (loaded and !FLAGS_iono_xml.empty())
+                    {
+                        archive.load_iono_xml(FLAGS_iono_xml);
+                    }
+                break;
+            case Nav_System::gps_cnav:
+                loaded = archive.load_cnav_ephemeris_xml(input_file);
+                if (loaded and !FLAGS_utc_xml.empty())
+                    {
+                        archive.load_cnav_utc_xml(FLAGS_utc_xml);
+                    }
+                break;
+            case Nav_System::galileo:
+                loaded = archive.load_gal_ephemeris_xml(input_file);
+                if (loaded and !FLAGS_utc_xml.empty())
+                    {
+                        archive.load_gal_utc_xml(FLAGS_utc_xml);
+                    }
+                if (loaded and !FLAGS_iono_xml.empty())
+                    {
+                        archive.load_gal_iono_xml(FLAGS_iono_xml);
+                    }
+                break;
+            case Nav_System::glonass:
+                loaded = archive.load_gnav_ephemeris_xml(input_file);
+                if (loaded and !FLAGS_utc_xml.empty())
+                    {
+                        archive.load_glo_utc_xml(FLAGS_utc_xml);
+                    }
+                break;
+            default:
+                break;
+            }
+    }
+    if (!loaded)
+        {
+            std::lock_guard<std::mutex> lock(console_mutex);
+            std::cerr << "Could not load navigation data from " << input_file << '\n';
+            return false;
+        }
+
+    // one printer per input keeps the workers independent; files it does
+    // not write (observation, SBAS, ...) are removed empty by its destructor
+    const std::string base_name = fs::path(input_file).stem().string();
+    Rinex_Printer printer(FLAGS_rinex_version, FLAGS_output_dir, base_name);
+
+    switch (system)
+        {
+        case Nav_System::gps:
+            if (archive.gps_ephemeris_map.empty())
+                {
+                    loaded = false;
+                    break;
+                }
+            printer.print_gps_nav_header(archive.gps_iono, archive.gps_utc, archive.gps_ephemeris_map.cbegin()->second);
+            printer.log_rinex_nav_gps_nav(1, archive.gps_ephemeris_map);
+            break;
+        case Nav_System::gps_cnav:
+            if (archive.gps_cnav_ephemeris_map.empty())
+                {
+                    loaded = false;
+                    break;
+                }
+            printer.print_gps_cnav_header(Gps_CNAV_Iono(), archive.gps_cnav_utc);
+            printer.log_rinex_nav_gps_cnav(2, archive.gps_cnav_ephemeris_map);
+            break;
+        case Nav_System::galileo:
+            if (archive.gal_ephemeris_map.empty())
+                {
+                    loaded = false;
+                    break;
+                }
+            printer.print_gal_nav_header(archive.gal_iono, archive.gal_utc);
+            printer.log_rinex_nav_gal_nav(4, archive.gal_ephemeris_map);
+            break;
+        case Nav_System::glonass:
+            if (archive.glonass_gnav_ephemeris_map.empty())
+                {
+                    loaded = false;
+                    break;
+                }
+            printer.print_glo_gnav_header(archive.glo_gnav_utc, archive.glonass_gnav_ephemeris_map.cbegin()->second);
+            printer.log_rinex_nav_glo_gnav(23, archive.glonass_gnav_ephemeris_map);
+            break;
+        default:
+            loaded = false;
+            break;
+        }
+
+    std::lock_guard<std::mutex> lock(console_mutex);
+    if (!loaded)
+        {
+            std::cerr << "No satellites found in " << input_file << '\n';
+            return false;
+        }
+    for (const auto& navfile : printer.get_navfilename())
+        {
+            std::cout << input_file << " -> " << navfile << '\n';
+        }
+    return true;
+}
+}  // namespace
+
+
+int main(int argc, char** argv)
+{
+    const std::string intro_help(
+        std::string("\nrinex-nav-batch converts archived GNSS-SDR navigation data XML files to RINEX NAV\n") +
+        "Copyright (C) 2010-2026 (see AUTHORS file for a list of contributors)\n" +
+        "This program comes with ABSOLUTELY NO WARRANTY;\n" +
+        "See COPYING file to see a copy of the General Public License\n \n" +
+        "Usage: rinex-nav-batch [flags] ephemeris1.xml [ephemeris2.xml ...]\n");
+
+    gflags::SetUsageMessage(intro_help);
+    gflags::SetVersionString(GNSS_SDR_VERSION);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+    google::InitGoogleLogging(argv[0]);
+
+    if (argc < 2)
+        {
+            std::cerr << intro_help;
+            gflags::ShutDownCommandLineFlags();
+            return 1;
+        }
+
+    const Nav_System forced_system = FLAGS_system.empty() ? Nav_System::unknown : parse_system(FLAGS_system);
+    if (!FLAGS_system.empty() and forced_system == Nav_System::unknown)
+        {
+            std::cerr << "Unknown system " << FLAGS_system << " (expected gps, gps_cnav, galileo or glonass)\n";
+            gflags::ShutDownCommandLineFlags();
+            return 1;
+        }
+
+    std::vector<std::string> input_files(argv + 1, argv + argc);
+    unsigned int num_workers = FLAGS_jobs > 0 ? static_cast<unsigned int>(FLAGS_jobs) : std::max(std::thread::hardware_concurrency(), 1U);
+    num_workers = std::min(num_workers, static_cast<unsigned int>(input_files.size()));
+
+    std::atomic<size_t> next_file(0);
+    std::atomic<size_t> converted(0);
+    std::vector<std::thread> workers;
+    workers.reserve(num_workers);
+    for (unsigned int n = 0; n < num_workers; n++)
+        {
+            workers.emplace_back([&input_files, &next_file, &converted, forced_system]() {
+                size_t index;
+                while ((index = next_file.fetch_add(1)) < input_files.size())
+                    {
+                        const Nav_System system = forced_system != Nav_System::unknown ? forced_system : parse_system(fs::path(input_files[index]).filename().string());
+                        if (system == Nav_System::unknown)
+                            {
+                                std::lock_guard<std::mutex> lock(console_mutex);
+                                std::cerr << "Could not infer the GNSS system of " << input_files[index] << ", use --system\n";
+                            }
+                        else if (convert_file(input_files[index], system))
+                            {
+                                converted++;
+                            }
+                    }
+            });
+        }
+    for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+    std::cout << "Converted " << converted.load() << " of " << input_files.size() << " navigation data file(s)\n";
+    const bool all_converted = (converted.load() == input_files.size());
+    gflags::ShutDownCommandLineFlags();
+    return all_converted ? 0 : 1;
+}
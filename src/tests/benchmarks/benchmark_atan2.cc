@@ -15,8 +15,10 @@
  * -----------------------------------------------------------------------------
  */
 
+#include "tracking_discriminators.h"
 #include <benchmark/benchmark.h>
 #include <gnuradio/math.h>
+#include <array>
 #include <cmath>
 #include <random>
 
@@ -59,7 +61,50 @@ void bm_gr_fast_atan2f(benchmark::State& state)
         }
 }
 
+void bm_fast_atan2f_poly(benchmark::State& state)
+{
+    std::random_device rd;
+    std::default_random_engine e2(rd());
+    std::uniform_real_distribution<> dist(-1.0, 1.0);
+
+    float a = dist(e2);
+    float b = dist(e2);
+    float c;
+    while (state.KeepRunning())
+        {
+            c = fast_atan2f_poly(a, b);
+        }
+    if (c > 1.0)
+        {
+            // Avoid unused-but-set-variable warning
+        }
+}
+
+
+void bm_pll_four_quadrant_atan_batch(benchmark::State& state)
+{
+    std::random_device rd;
+    std::default_random_engine e2(rd());
+    std::uniform_real_distribution<> dist(-1.0, 1.0);
+
+    constexpr std::size_t num_channels = 16;
+    std::array<gr_complex, num_channels> prompts{};
+    std::array<double, num_channels> errors{};
+    for (auto& prompt : prompts)
+        {
+            prompt = gr_complex(dist(e2), dist(e2));
+        }
+    while (state.KeepRunning())
+        {
+            pll_four_quadrant_atan_batch(prompts.data(), errors.data(), num_channels);
+            benchmark::DoNotOptimize(errors.data());
+        }
+}
+
+
 BENCHMARK(bm_std_atan2);
 BENCHMARK(bm_gr_fast_atan2f);
+BENCHMARK(bm_fast_atan2f_poly);
+BENCHMARK(bm_pll_four_quadrant_atan_batch);
 
 BENCHMARK_MAIN();
@@ -0,0 +1,95 @@
+/*!
+ * \file benchmark_cart2geo.cc
+ * \brief Benchmark for ECEF-to-geodetic conversion, per point vs. batched
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "geofunctions.h"
+#include <benchmark/benchmark.h>
+#include <armadillo>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+// random points between ground level and LEO altitude, in SoA layout
+void make_points(std::vector<double>& x, std::vector<double>& y, std::vector<double>& z, size_t num_points)
+{
+    std::mt19937 e2(42);
+    std::uniform_real_distribution<double> lat_dist(-85.0, 85.0);
+    std::uniform_real_distribution<double> lon_dist(-180.0, 180.0);
+    std::uniform_real_distribution<double> height_dist(-400.0, 400000.0);
+    x.resize(num_points);
+    y.resize(num_points);
+    z.resize(num_points);
+    const double a = 6378137.0;
+    const double f = 1.0 / 298.257223563;
+    const double e2_ellips = f * (2.0 - f);
+    for (size_t i = 0; i < num_points; i++)
+        {
+            const double lat = lat_dist(e2) * M_PI / 180.0;
+            const double lon = lon_dist(e2) * M_PI / 180.0;
+            const double h = height_dist(e2);
+            const double N = a / std::sqrt(1.0 - e2_ellips * std::sin(lat) * std::sin(lat));
+            x[i] = (N + h) * std::cos(lat) * std::cos(lon);
+            y[i] = (N + h) * std::cos(lat) * std::sin(lon);
+            z[i] = (N * (1.0 - e2_ellips) + h) * std::sin(lat);
+        }
+}
+}  // namespace
+
+
+void bm_cart2geo_per_point(benchmark::State& state)
+{
+    const auto num_points = static_cast<size_t>(state.range(0));
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> z;
+    make_points(x, y, z, num_points);
+    while (state.KeepRunning())
+        {
+            for (size_t i = 0; i < num_points; i++)
+                {
+                    const arma::vec XYZ = {x[i], y[i], z[i]};
+                    benchmark::DoNotOptimize(cart2geo(XYZ, 4));
+                }
+        }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(num_points));
+}
+
+
+void bm_cart2geo_batch(benchmark::State& state)
+{
+    const auto num_points = static_cast<size_t>(state.range(0));
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> z;
+    make_points(x, y, z, num_points);
+    std::vector<double> lat(num_points);
+    std::vector<double> lon(num_points);
+    std::vector<double> h(num_points);
+    while (state.KeepRunning())
+        {
+            cart2geo_batch(x.data(), y.data(), z.data(), num_points, lat.data(), lon.data(), h.data(), 4);
+            benchmark::DoNotOptimize(lat.data());
+        }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(num_points));
+}
+
+
+BENCHMARK(bm_cart2geo_per_point)->Arg(1024)->Arg(65536);
+BENCHMARK(bm_cart2geo_batch)->Arg(1024)->Arg(65536);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,122 @@
+/*!
+ * \file benchmark_multicorrelator.cc
+ * \brief Benchmark comparing the float and the 16-bit integer (lite_mode)
+ * tracking multicorrelators, including the accuracy cost of quantization
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "cpu_multicorrelator_16sc.h"
+#include "cpu_multicorrelator_real_codes.h"
+#include "gps_sdr_signal_replica.h"
+#include <benchmark/benchmark.h>
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <cmath>
+#include <complex>
+#include <random>
+
+namespace
+{
+// GPS L1 C/A epoch at a 4 MS/s front end, the dominant lite_mode use case
+constexpr int fs_sps = 4000000;
+constexpr int code_length_chips = 1023;
+constexpr int vector_length = fs_sps / 1000;
+constexpr int n_taps = 3;
+constexpr float input_scale = 4.0F;
+constexpr float doppler_hz = 1250.0F;
+constexpr float code_phase_step_chips = static_cast<float>(code_length_chips) / static_cast<float>(vector_length);
+
+struct Scenario
+{
+    volk_gnsssdr::vector<float> code_float{volk_gnsssdr::vector<float>(code_length_chips)};
+    volk_gnsssdr::vector<lv_16sc_t> code_16sc{volk_gnsssdr::vector<lv_16sc_t>(code_length_chips)};
+    volk_gnsssdr::vector<std::complex<float>> input{volk_gnsssdr::vector<std::complex<float>>(vector_length)};
+    volk_gnsssdr::vector<lv_16sc_t> input_16sc{volk_gnsssdr::vector<lv_16sc_t>(vector_length)};
+    float shifts_chips[n_taps] = {-0.25F, 0.0F, 0.25F};
+};
+
+Scenario& scenario()
+{
+    static Scenario s = []() {
+        Scenario sc;
+        gps_l1_ca_code_gen_float(sc.code_float, 1, 0);
+        for (int i = 0; i < code_length_chips; i++)
+            {
+                sc.code_16sc[i] = lv_16sc_t(static_cast<int16_t>(sc.code_float[i]), 0);
+            }
+        // received signal: the same code at a Doppler offset plus noise
+        std::mt19937 rng(42);
+        std::normal_distribution<float> noise(0.0F, 0.5F);
+        double phase = 0.0;
+        for (int i = 0; i < vector_length; i++)
+            {
+                const auto chip = static_cast<int>(static_cast<float>(i) * code_phase_step_chips) % code_length_chips;
+                sc.input[i] = sc.code_float[chip] * std::complex<float>(static_cast<float>(std::cos(phase)), static_cast<float>(std::sin(phase))) +
+                              std::complex<float>(noise(rng), noise(rng));
+                phase += 2.0 * M_PI * doppler_hz / fs_sps;
+            }
+        return sc;
+    }();
+    return s;
+}
+}  // namespace
+
+
+void bm_multicorrelator_float(benchmark::State& state)
+{
+    auto& sc = scenario();
+    Cpu_Multicorrelator_Real_Codes correlator;
+    correlator.init(2 * vector_length, n_taps);
+    correlator.set_local_code_and_taps(code_length_chips, sc.code_float.data(), sc.shifts_chips);
+    std::complex<float> outs[n_taps];
+    correlator.set_input_output_vectors(outs, sc.input.data());
+
+    while (state.KeepRunning())
+        {
+            correlator.Carrier_wipeoff_multicorrelator_resampler(0.0F,
+                2.0F * static_cast<float>(M_PI) * doppler_hz / fs_sps, 0.0F,
+                0.0F, code_phase_step_chips, 0.0F, vector_length);
+            benchmark::DoNotOptimize(outs[1]);
+        }
+    state.counters["prompt_mag"] = std::abs(outs[1]);
+    correlator.free();
+}
+
+
+// the lite_mode path: scaled float-to-short conversion plus integer correlation
+void bm_multicorrelator_16sc(benchmark::State& state)
+{
+    auto& sc = scenario();
+    Cpu_Multicorrelator_16sc correlator;
+    correlator.init(2 * vector_length, n_taps);
+    correlator.set_local_code_and_taps(code_length_chips, sc.code_16sc.data(), sc.shifts_chips);
+    lv_16sc_t outs[n_taps];
+    correlator.set_input_output_vectors(outs, sc.input_16sc.data());
+
+    while (state.KeepRunning())
+        {
+            volk_32f_s32f_convert_16i(reinterpret_cast<int16_t*>(sc.input_16sc.data()),
+                reinterpret_cast<const float*>(sc.input.data()), input_scale, 2 * vector_length);
+            correlator.Carrier_wipeoff_multicorrelator_resampler(0.0F,
+                2.0F * static_cast<float>(M_PI) * doppler_hz / fs_sps,
+                0.0F, code_phase_step_chips, vector_length);
+            benchmark::DoNotOptimize(outs[1]);
+        }
+    // quantization accuracy: prompt magnitude after undoing the input scale,
+    // to be compared against the float prompt_mag counter
+    state.counters["prompt_mag"] = std::abs(std::complex<float>(static_cast<float>(outs[1].real()), static_cast<float>(outs[1].imag()))) / input_scale;
+}
+
+BENCHMARK(bm_multicorrelator_float);
+BENCHMARK(bm_multicorrelator_16sc);
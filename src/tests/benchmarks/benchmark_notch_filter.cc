@@ -0,0 +1,108 @@
+/*!
+ * \file benchmark_notch_filter.cc
+ * \brief Benchmark for the per-sample and frequency-domain notch filter kernels
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_fft.h"
+#include <benchmark/benchmark.h>
+#include <volk/volk.h>
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+// one frequency-domain block, and the same number of samples through the
+// per-sample filter, so iteration times are directly comparable
+constexpr int fft_size = 4096;
+
+static std::vector<std::complex<float>> make_input()
+{
+    std::mt19937 rng(42);
+    std::normal_distribution<float> noise(0.0F, 1.0F);
+    std::vector<std::complex<float>> input(fft_size);
+    float phase = 0.0F;
+    float freq = 0.05F;
+    for (int i = 0; i < fft_size; i++)
+        {
+            // noise plus a chirp jammer sweeping across the band
+            phase += freq;
+            freq += 1e-6F;
+            input[i] = std::complex<float>(noise(rng), noise(rng)) + 10.0F * std::complex<float>(std::cos(phase), std::sin(phase));
+        }
+    return input;
+}
+
+
+// inner loop of the time-domain notch (notch_cc.cc): a conjugate product and
+// an atan2 per segment, then a complex exponential per sample
+void bm_notch_per_sample(benchmark::State& state)
+{
+    const auto input = make_input();
+    std::vector<std::complex<float>> output(fft_size);
+    std::vector<std::complex<float>> c_samples(fft_size);
+    std::vector<float> angle(fft_size);
+    const std::complex<float> p_c_factor(0.9F, 0.0F);
+    std::complex<float> last_out(0.0F, 0.0F);
+
+    while (state.KeepRunning())
+        {
+            volk_32fc_x2_multiply_conjugate_32fc(c_samples.data(), input.data() + 1, input.data(), fft_size - 1);
+            volk_32fc_s32f_atan2_32f(angle.data(), c_samples.data(), 1.0F, fft_size - 1);
+            for (int i = 0; i < fft_size - 1; i++)
+                {
+                    const std::complex<float> z_0 = std::exp(std::complex<float>(0.0F, 1.0F) * angle[i]);
+                    output[i] = input[i + 1] - z_0 * input[i] + p_c_factor * z_0 * last_out;
+                    last_out = output[i];
+                }
+            benchmark::DoNotOptimize(output.data());
+        }
+}
+
+
+// inner loop of the frequency-domain notch (notch_fd_cc.cc): FFT, noise-floor
+// estimate, bin mask, inverse FFT
+void bm_notch_frequency_domain(benchmark::State& state)
+{
+    const auto input = make_input();
+    std::vector<std::complex<float>> output(fft_size);
+    std::vector<float> power_spect(fft_size);
+    std::vector<float> mask(fft_size);
+    auto fft = gnss_fft_fwd_make_unique(fft_size);
+    auto ifft = gnss_fft_rev_make_unique(fft_size);
+    const float inv_size = 1.0F / static_cast<float>(fft_size);
+
+    while (state.KeepRunning())
+        {
+            std::copy(input.begin(), input.end(), fft->get_inbuf());
+            fft->execute();
+            float sig2dB = 0.0F;
+            volk_32fc_s32f_power_spectrum_32f(power_spect.data(), fft->get_outbuf(), 1.0, fft_size);
+            volk_32f_s32f_calc_spectral_noise_floor_32f(&sig2dB, power_spect.data(), 15.0, fft_size);
+            const float thr = sig2dB + 8.4F;  // pfa = 0.001 with 2 degrees of freedom
+            for (int bin = 0; bin < fft_size; bin++)
+                {
+                    mask[bin] = (power_spect[bin] > thr) ? 0.0F : inv_size;
+                }
+            volk_32fc_32f_multiply_32fc(ifft->get_inbuf(), fft->get_outbuf(), mask.data(), fft_size);
+            ifft->execute();
+            std::copy(ifft->get_outbuf(), ifft->get_outbuf() + fft_size, output.begin());
+            benchmark::DoNotOptimize(output.data());
+        }
+}
+
+BENCHMARK(bm_notch_per_sample);
+BENCHMARK(bm_notch_frequency_domain);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,180 @@
+/*!
+ * \file benchmark_receiver_chain.cc
+ * \brief Throughput benchmark replaying a synthetic IF capture through the
+ * full receiver flowgraph with configurable channel counts
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "concurrent_queue.h"
+#include "gnss_flowgraph.h"
+#include "gps_sdr_signal_replica.h"
+#include "in_memory_configuration.h"
+#include <benchmark/benchmark.h>
+#include <pmt/pmt.h>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#include <sys/time.h>
+#endif
+
+namespace
+{
+const double fs_hz = 2000000.0;
+const double capture_duration_s = 2.0;
+
+/*
+ * Writes a deterministic short IF capture (gr_complex binary) with a few
+ * C/A-modulated carriers at distinct Dopplers buried in Gaussian noise, so
+ * acquisition and tracking perform representative work during the replay
+ */
+std::string generate_capture_file()
+{
+    static std::string filename;
+    if (!filename.empty())
+        {
+            return filename;
+        }
+    filename = std::string(P_tmpdir) + "/gnss_sdr_bench_capture.dat";
+
+    const auto num_samples = static_cast<size_t>(fs_hz * capture_duration_s);
+    const uint32_t prns[] = {1, 11, 17, 32};
+    const double dopplers_hz[] = {750.0, -1250.0, 2150.0, -3100.0};
+
+    std::vector<std::complex<float>> code(static_cast<size_t>(fs_hz * 1e-3));
+    std::vector<std::complex<float>> signal(num_samples, std::complex<float>(0.0F, 0.0F));
+    for (int sv = 0; sv < 4; sv++)
+        {
+            gps_l1_ca_code_gen_complex_sampled(code, prns[sv], static_cast<int32_t>(fs_hz), 0);
+            const double phase_step = 2.0 * M_PI * dopplers_hz[sv] / fs_hz;
+            double phase = 0.0;
+            for (size_t n = 0; n < num_samples; n++)
+                {
+                    signal[n] += code[n % code.size()] * std::complex<float>(static_cast<float>(std::cos(phase)), static_cast<float>(std::sin(phase)));
+                    phase += phase_step;
+                }
+        }
+
+    std::mt19937 gen(42);  // fixed seed: identical capture on every run
+    std::normal_distribution<float> noise(0.0F, 2.0F);
+    for (auto& sample : signal)
+        {
+            sample += std::complex<float>(noise(gen), noise(gen));
+        }
+
+    std::ofstream file(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(signal.data()), static_cast<std::streamsize>(signal.size() * sizeof(std::complex<float>)));
+    return filename;
+}
+
+
+std::shared_ptr<InMemoryConfiguration> make_configuration(int num_channels, const std::string& capture)
+{
+    auto config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("GNSS-SDR.internal_fs_sps", std::to_string(static_cast<int64_t>(fs_hz)));
+    config->set_property("SignalSource.implementation", "File_Signal_Source");
+    config->set_property("SignalSource.filename", capture);
+    config->set_property("SignalSource.item_type", "gr_complex");
+    config->set_property("SignalSource.sampling_frequency", std::to_string(static_cast<int64_t>(fs_hz)));
+    config->set_property("SignalSource.repeat", "false");
+    config->set_property("SignalSource.enable_throttle_control", "false");
+    config->set_property("SignalConditioner.implementation", "Pass_Through");
+    config->set_property("Channels_1C.count", std::to_string(num_channels));
+    config->set_property("Channels.in_acquisition", "1");
+    config->set_property("Acquisition_1C.implementation", "GPS_L1_CA_PCPS_Acquisition");
+    config->set_property("Acquisition_1C.threshold", "2.5");
+    config->set_property("Acquisition_1C.doppler_max", "5000");
+    config->set_property("Acquisition_1C.doppler_step", "250");
+    config->set_property("Tracking_1C.implementation", "GPS_L1_CA_DLL_PLL_Tracking");
+    config->set_property("TelemetryDecoder_1C.implementation", "GPS_L1_CA_Telemetry_Decoder");
+    config->set_property("Observables.implementation", "Hybrid_Observables");
+    config->set_property("PVT.implementation", "RTKLIB_PVT");
+    return config;
+}
+
+
+#if defined(__linux__)
+double process_cpu_seconds()
+{
+    struct rusage usage
+    {
+    };
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_utime.tv_sec) + static_cast<double>(usage.ru_utime.tv_usec) * 1e-6 +
+           static_cast<double>(usage.ru_stime.tv_sec) + static_cast<double>(usage.ru_stime.tv_usec) * 1e-6;
+}
+#endif
+}  // namespace
+
+
+/*
+ * Replays the capture through the full flowgraph. The channel count is the
+ * benchmark argument, so a release or a compiler flag set can be compared
+ * with e.g.
+ *   ./benchmark_receiver_chain --benchmark_format=json
+ * Counters:
+ *   samples_per_second  processed sample rate
+ *   real_time_margin    samples_per_second / fs (>1 means faster than real time)
+ *   cpu_utilization     process CPU seconds per wall-clock second (Linux)
+ */
+void bm_receiver_chain(benchmark::State& state)
+{
+    const int num_channels = static_cast<int>(state.range(0));
+    const std::string capture = generate_capture_file();
+    const auto num_samples = static_cast<double>(static_cast<size_t>(fs_hz * capture_duration_s));
+
+    double samples_per_second = 0.0;
+    double cpu_utilization = 0.0;
+    for (auto _ : state)
+        {
+            auto config = make_configuration(num_channels, capture);
+            auto queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+            auto flowgraph = std::make_shared<GNSSFlowgraph>(config, queue);
+            flowgraph->connect();
+
+#if defined(__linux__)
+            const double cpu_start = process_cpu_seconds();
+#endif
+            const auto start = std::chrono::steady_clock::now();
+            flowgraph->start();
+            flowgraph->wait();  // the file source exhausts the capture
+            const auto stop = std::chrono::steady_clock::now();
+#if defined(__linux__)
+            const double cpu_stop = process_cpu_seconds();
+#endif
+            flowgraph->stop();
+
+            const double elapsed_s = std::chrono::duration<double>(stop - start).count();
+            state.SetIterationTime(elapsed_s);
+            samples_per_second = num_samples / elapsed_s;
+#if defined(__linux__)
+            cpu_utilization = (cpu_stop - cpu_start) / elapsed_s;
+#endif
+        }
+
+    state.counters["samples_per_second"] = samples_per_second;
+    state.counters["real_time_margin"] = samples_per_second / fs_hz;
+    state.counters["cpu_utilization"] = cpu_utilization;
+}
+
+BENCHMARK(bm_receiver_chain)->Arg(1)->Arg(4)->Arg(8)->Arg(12)->UseManualTime()->Unit(benchmark::kMillisecond)->Iterations(3);
@@ -0,0 +1,239 @@
+/*!
+ * \file benchmark_rtklib_solver.cc
+ * \brief Benchmark for the PVT computation performed by Rtklib_Solver
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_make_unique.h"  // for std::make_unique in C++11
+#include "gnss_synchro.h"
+#include "gps_ephemeris.h"
+#include "pvt_conf.h"
+#include "rtklib.h"
+#include "rtklib_conversions.h"
+#include "rtklib_ephemeris.h"
+#include "rtklib_rtkcmn.h"
+#include "rtklib_rtkpos.h"
+#include "rtklib_solver.h"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace
+{
+rtk_t make_rtk(int positioning_mode, int number_of_frequencies)
+{
+    snrmask_t snrmask = {{}, {{}, {}}};
+    prcopt_t opt = {
+        positioning_mode,                /* positioning mode (PMODE_XXX) */
+        0,                               /* solution type (0:forward) */
+        number_of_frequencies,           /* number of frequencies (1:L1, 2:L1+L2) */
+        SYS_GPS,                         /* navigation system */
+        1.0 * D2R,                       /* elevation mask angle (rad) */
+        snrmask,                         /* SNR mask */
+        0,                               /* satellite ephemeris/clock (EPHOPT_BRDC) */
+        0,                               /* AR mode off */
+        0,                               /* GLONASS AR mode off */
+        0,                               /* BeiDou AR mode off */
+        5,                               /* obs outage count to reset bias */
+        0,                               /* min lock count to fix ambiguity */
+        10,                              /* min fix count to hold ambiguity */
+        1,                               /* max iteration to resolve ambiguity */
+        IONOOPT_OFF,                     /* ionosphere option */
+        TROPOPT_OFF,                     /* troposphere option */
+        0,                               /* dynamics model off */
+        0,                               /* earth tide correction off */
+        1,                               /* number of filter iteration */
+        0,                               /* code smoothing window size */
+        0,                               /* interpolate reference obs */
+        0,                               /* SBAS correction options */
+        0,                               /* SBAS satellite selection */
+        0,                               /* rover position for fixed mode */
+        0,                               /* base position for relative mode */
+        {100.0, 100.0, 100.0},           /* eratio[NFREQ] code/phase error ratio */
+        {100.0, 0.003, 0.003, 0.0, 1.0}, /* err[5] measurement error factor */
+        {30.0, 0.03, 0.3},               /* std[3] initial-state std */
+        {1e-4, 1e-3, 1e-4, 1e-1, 1e-2, 0.0}, /* prn[6] process-noise std */
+        5e-12,                               /* sclkstab */
+        {3.0, 0.9999, 0.25, 0.1, 0.05, 0.0, 0.0, 0.0}, /* thresar[8] */
+        0.0,                                           /* elevation mask of AR (deg) */
+        0.0,                                           /* elevation mask to hold ambiguity (deg) */
+        0.05,                                          /* slip threshold (m) */
+        30.0,                                          /* max difference of time (sec) */
+        30.0,                                          /* reject threshold of innovation (m) */
+        30.0,                                          /* reject threshold of gdop */
+        {},                                            /* baseline[2] */
+        {},                                            /* ru[3] */
+        {},                                            /* rb[3] */
+        {"", ""},                                      /* anttype[2] */
+        {{}, {}},                                      /* antdel[2][3] */
+        {},                                            /* pcvr[2] */
+        {},                                            /* exsats[MAXSAT] */
+        0,                                             /* max averaging epoches */
+        0,                                             /* initialize by restart */
+        1,                                             /* output single by outage */
+        {"", ""},                                      /* rnxopt[2] */
+        {0, 0, 0, 0, 0},                               /* posopt[6] */
+        0,                                             /* solution sync mode */
+        {{}, {}},                                      /* odisp[2][6*11] */
+        {{}, {{}, {}}, {{}, {}}, {}, {}},              /* exterr */
+        0,                                             /* disable L2-AR */
+        {},                                            /* pppopt */
+        true                                           /* Bancroft initialization */
+    };
+    rtk_t rtk;
+    rtkinit(&rtk, &opt);
+    return rtk;
+}
+
+
+Gps_Ephemeris make_gps_eph(int prn, int nsat, int week, double tow)
+{
+    Gps_Ephemeris eph;
+    eph.PRN = static_cast<uint32_t>(prn);
+    eph.WN = week % 1024;
+    eph.tow = tow;
+    eph.toe = static_cast<int32_t>(tow);
+    eph.toc = static_cast<int32_t>(tow);
+    eph.sqrtA = std::sqrt(26560.0e3);
+    eph.ecc = 0.01;
+    eph.i_0 = 0.97;
+    eph.OMEGA_0 = TWO_PI * static_cast<double>(prn - 1) / static_cast<double>(nsat);
+    eph.omega = 0.5;
+    eph.M_0 = TWO_PI * static_cast<double>(prn - 1) / static_cast<double>(nsat);
+    eph.OMEGAdot = -2.6e-9;
+    eph.af0 = 1.0e-4;
+    return eph;
+}
+
+
+// Build one epoch of observables geometrically consistent with the synthetic
+// ephemerides and a receiver at position rr (ECEF), so that the solver can
+// actually converge to a valid fix
+Gnss_Synchro_Map make_epoch(const std::map<int, Gps_Ephemeris>& eph_map,
+    const double rr[3], gtime_t t_rx, double tow, bool dual_frequency)
+{
+    Gnss_Synchro_Map obs_map;
+    int channel_id = 0;
+    for (const auto& eph_pair : eph_map)
+        {
+            eph_t reph = eph_to_rtklib(eph_pair.second, false);
+            double rs[3];
+            double e[3];
+            double dts = 0.0;
+            double var = 0.0;
+            double pseudorange_m = 2.2e7;
+            for (int iter = 0; iter < 3; iter++)
+                {
+                    const gtime_t t_tx = timeadd(t_rx, -pseudorange_m / CLIGHT);
+                    eph2pos(t_tx, &reph, rs, &dts, &var);
+                    pseudorange_m = geodist(rs, rr, e) - CLIGHT * dts;
+                }
+            Gnss_Synchro gs{};
+            gs.System = 'G';
+            gs.Signal[0] = '1';
+            gs.Signal[1] = 'C';
+            gs.Signal[2] = '\0';
+            gs.PRN = eph_pair.second.PRN;
+            gs.Channel_ID = channel_id;
+            gs.CN0_dB_hz = 45.0;
+            gs.Pseudorange_m = pseudorange_m;
+            gs.RX_time = tow;
+            gs.Flag_valid_pseudorange = true;
+            gs.Flag_valid_word = true;
+            obs_map[channel_id] = gs;
+            channel_id++;
+            if (dual_frequency)
+                {
+                    Gnss_Synchro gs2 = gs;
+                    gs2.Signal[0] = '2';
+                    gs2.Signal[1] = 'S';
+                    gs2.Channel_ID = channel_id;
+                    obs_map[channel_id] = gs2;
+                    channel_id++;
+                }
+        }
+    return obs_map;
+}
+
+
+void run_solver_benchmark(benchmark::State& state, int positioning_mode, bool dual_frequency)
+{
+    // GPS-only constellation; the requested 60-satellite multi-constellation
+    // case would need synthetic ephemerides for all systems and is left out
+    const int nsat = static_cast<int>(state.range(0));
+
+    // epoch taken from the computer clock, so that the week number stored
+    // modulo 1024 in the ephemeris resolves consistently in eph_to_rtklib()
+    const gtime_t t_rx = utc2gpst(timeget());
+    int week;
+    const double tow = time2gpst(t_rx, &week);
+
+    std::map<int, Gps_Ephemeris> eph_map;
+    for (int prn = 1; prn <= nsat; prn++)
+        {
+            eph_map[prn] = make_gps_eph(prn, nsat, week, tow);
+        }
+
+    // receiver on the Earth surface; satellites below the elevation mask are
+    // discarded by the solver, the remaining geometry still yields a fix
+    const double pos[3] = {41.27 * D2R, 1.99 * D2R, 100.0};
+    double rr[3];
+    pos2ecef(pos, rr);
+
+    const Gnss_Synchro_Map epoch = make_epoch(eph_map, rr, t_rx, tow, dual_frequency);
+
+    rtk_t rtk = make_rtk(positioning_mode, dual_frequency ? 2 : 1);
+    Pvt_Conf conf;
+    conf.use_e6_for_pvt = false;
+    auto solver = std::make_unique<Rtklib_Solver>(rtk, static_cast<uint32_t>(epoch.size()),
+        std::string(".benchmark_rtklib_solver_dump.dat"), 1, false, false, conf);
+    solver->set_averaging_depth(1);
+    solver->gps_ephemeris_map = eph_map;
+
+    uint64_t valid_solutions = 0;
+    for (auto _ : state)
+        {
+            if (solver->get_PVT(epoch, 0.0))
+                {
+                    valid_solutions++;
+                }
+            benchmark::ClobberMemory();
+        }
+    state.counters["valid"] = static_cast<double>(valid_solutions);
+}
+
+
+void bm_rtklib_solver_spp(benchmark::State& state)
+{
+    run_solver_benchmark(state, PMODE_SINGLE, false);
+}
+
+
+void bm_rtklib_solver_spp_dual_freq(benchmark::State& state)
+{
+    run_solver_benchmark(state, PMODE_SINGLE, true);
+}
+
+
+void bm_rtklib_solver_ppp_static(benchmark::State& state)
+{
+    run_solver_benchmark(state, PMODE_PPP_STATIC, false);
+}
+}  // namespace
+
+BENCHMARK(bm_rtklib_solver_spp)->Arg(8)->Arg(16)->Arg(31);
+BENCHMARK(bm_rtklib_solver_spp_dual_freq)->Arg(8)->Arg(16)->Arg(31);
+BENCHMARK(bm_rtklib_solver_ppp_static)->Arg(8)->Arg(16)->Arg(31);
@@ -0,0 +1,83 @@
+/*!
+ * \file benchmark_satposs.cc
+ * \brief Benchmark for the satellite position and clock computation
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_make_unique.h"  // for std::make_unique in C++11
+#include "rtklib.h"
+#include "rtklib_ephemeris.h"
+#include "rtklib_rtkcmn.h"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+void bm_satposs(benchmark::State& state)
+{
+    const int nsat = static_cast<int>(state.range(0));
+
+    double ep[] = {2026.0, 1.0, 1.0, 0.0, 0.0, 0.0};
+    const gtime_t teph = epoch2time(ep);
+    int week;
+    const double tow = time2gpst(teph, &week);
+
+    // synthetic GPS broadcast ephemerides, one healthy satellite per PRN
+    auto nav = std::make_unique<nav_t>();
+    std::vector<eph_t> eph(nsat);
+    for (int i = 0; i < nsat; i++)
+        {
+            eph[i].sat = i + 1;
+            eph[i].toe = teph;
+            eph[i].toc = teph;
+            eph[i].ttr = teph;
+            eph[i].week = week;
+            eph[i].toes = tow;
+            eph[i].A = 26560.0e3;
+            eph[i].e = 0.01;
+            eph[i].i0 = 0.97;
+            eph[i].OMG0 = TWO_PI * static_cast<double>(i) / static_cast<double>(nsat);
+            eph[i].omg = 0.5;
+            eph[i].M0 = TWO_PI * static_cast<double>(i) / static_cast<double>(nsat);
+            eph[i].OMGd = -2.6e-9;
+            eph[i].f0 = 1.0e-4;
+            eph[i].fit = 4.0;
+        }
+    nav->eph = eph.data();
+    nav->n = nsat;
+    nav->nmax = nsat;
+
+    std::vector<obsd_t> obs(nsat);
+    for (int i = 0; i < nsat; i++)
+        {
+            obs[i].time = teph;
+            obs[i].sat = i + 1;
+            obs[i].P[0] = 2.2e7;
+        }
+
+    std::vector<double> rs(6 * nsat);
+    std::vector<double> dts(2 * nsat);
+    std::vector<double> var(nsat);
+    std::vector<int> svh(nsat);
+
+    for (auto _ : state)
+        {
+            satposs(teph, obs.data(), nsat, nav.get(), EPHOPT_BRDC,
+                rs.data(), dts.data(), var.data(), svh.data());
+            benchmark::DoNotOptimize(rs.data());
+            benchmark::ClobberMemory();
+        }
+}
+
+BENCHMARK(bm_satposs)->Arg(8)->Arg(16)->Arg(32);
@@ -0,0 +1,282 @@
+/*!
+ * \file benchmark_volk_kernels.cc
+ * \brief Benchmarks for the volk_gnsssdr kernels that dominate the
+ * receiver runtime
+ *
+ * Each kernel is measured with the best implementation selected by the
+ * dispatcher and with the portable generic implementation, so the SIMD
+ * speed-up (and any regression of it) can be quantified per machine.
+ * Block lengths cover 1 ms to 20 ms of signal at 2.046 Msps, and the
+ * multi-tap correlation kernels run with 3, 5 and 7 correlators as
+ * configured by the tracking loops.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <benchmark/benchmark.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+constexpr int code_length_chips = 2046;
+constexpr float code_phase_step_chips = 0.25;
+constexpr float rem_code_phase_chips = -0.123;
+
+volk_gnsssdr::vector<std::complex<float>> random_complex_vector(unsigned int num_points)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-1.0F, 1.0F);
+    volk_gnsssdr::vector<std::complex<float>> vec(num_points);
+    for (auto& v : vec)
+        {
+            v = std::complex<float>(dist(gen), dist(gen));
+        }
+    return vec;
+}
+
+volk_gnsssdr::vector<float> random_float_vector(unsigned int num_points)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-1.0F, 1.0F);
+    volk_gnsssdr::vector<float> vec(num_points);
+    for (auto& v : vec)
+        {
+            v = dist(gen);
+        }
+    return vec;
+}
+
+std::vector<float> correlator_shifts(int num_correlators)
+{
+    std::vector<float> shifts(num_correlators);
+    for (int i = 0; i < num_correlators; i++)
+        {
+            shifts[i] = -0.5F * static_cast<float>(num_correlators - 1) + static_cast<float>(i);
+        }
+    return shifts;
+}
+}  // namespace
+
+
+void bm_32fc_32f_rotator_dot_prod_xn(benchmark::State& state)
+{
+    const auto num_points = static_cast<unsigned int>(state.range(0));
+    const int num_correlators = static_cast<int>(state.range(1));
+
+    const auto sig_in = random_complex_vector(num_points);
+    std::vector<volk_gnsssdr::vector<float>> codes(num_correlators, random_float_vector(num_points));
+    std::vector<const float*> code_ptrs(num_correlators);
+    for (int i = 0; i < num_correlators; i++)
+        {
+            code_ptrs[i] = codes[i].data();
+        }
+    volk_gnsssdr::vector<std::complex<float>> result(num_correlators);
+    const lv_32fc_t phase_inc = lv_cmake(std::cos(0.001F), std::sin(0.001F));
+    lv_32fc_t phase[1] = {lv_cmake(1.0F, 0.0F)};
+
+    for (auto _ : state)
+        {
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(result.data(), sig_in.data(), phase_inc, phase, code_ptrs.data(), num_correlators, num_points);
+            benchmark::DoNotOptimize(result.data());
+        }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * num_points);
+}
+
+
+void bm_32fc_32f_rotator_dot_prod_xn_generic(benchmark::State& state)
+{
+    const auto num_points = static_cast<unsigned int>(state.range(0));
+    const int num_correlators = static_cast<int>(state.range(1));
+
+    const auto sig_in = random_complex_vector(num_points);
+    std::vector<volk_gnsssdr::vector<float>> codes(num_correlators, random_float_vector(num_points));
+    std::vector<const float*> code_ptrs(num_correlators);
+    for (int i = 0; i < num_correlators; i++)
+        {
+            code_ptrs[i] = codes[i].data();
+        }
+    volk_gnsssdr::vector<std::complex<float>> result(num_correlators);
+    const lv_32fc_t phase_inc = lv_cmake(std::cos(0.001F), std::sin(0.001F));
+    lv_32fc_t phase[1] = {lv_cmake(1.0F, 0.0F)};
+
+    for (auto _ : state)
+        {
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_manual(result.data(), sig_in.data(), phase_inc, phase, code_ptrs.data(), num_correlators, num_points, "generic");
+            benchmark::DoNotOptimize(result.data());
+        }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * num_points);
+}
+
+
+void bm_32f_xn_resampler(benchmark::State& state)
+{
+    const auto num_points = static_cast<unsigned int>(state.range(0));
+    const int num_correlators = static_cast<int>(state.range(1));
+
+    const auto code = random_float_vector(code_length_chips);
+    auto shifts = correlator_shifts(num_correlators);
+    std::vector<volk_gnsssdr::vector<float>> resampled(num_correlators, volk_gnsssdr::vector<float>(num_points));
+    std::vector<float*> resampled_ptrs(num_correlators);
+    for (int i = 0; i < num_correlators; i++)
+        {
+            resampled_ptrs[i] = resampled[i].data();
+        }
+
+    for (auto _ : state)
+        {
+            volk_gnsssdr_32f_xn_resampler_32f_xn(resampled_ptrs.data(), code.data(), rem_code_phase_chips, code_phase_step_chips, shifts.data(), code_length_chips, num_correlators, num_points);
+            benchmark::DoNotOptimize(resampled_ptrs.data());
+        }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * num_points);
+}
+
+
+void bm_32f_xn_resampler_generic(benchmark::State& state)
+{
+    const auto num_points = static_cast<unsigned int>(state.range(0));
+    const int num_correlators = static_cast<int>(state.range(1));
+
+    const auto code = random_float_vector(code_length_chips);
+    auto shifts = correlator_shifts(num_correlators);
+    std::vector<volk_gnsssdr::vector<float>> resampled(num_correlators, volk_gnsssdr::vector<float>(num_points));
+    std::vector<float*> resampled_ptrs(num_correlators);
+    for (int i = 0; i < num_correlators; i++)
+        {
+            resampled_ptrs[i] = resampled[i].data();
+        }
+
+    for (auto _ : state)
+        {
+            volk_gnsssdr_32f_xn_resampler_32f_xn_manual(resampled_ptrs.data(), code.data(), rem_code_phase_chips, code_phase_step_chips, shifts.data(), code_length_chips, num_correlators, num_points, "generic");
+            benchmark::DoNotOptimize(resampled_ptrs.data());
+        }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * num_points);
+}
+
+
+void bm_32fc_32f_rotator_resampler_dot_prod_xn(benchmark::State& state)
+{
+    const auto num_points = static_cast<unsigned int>(state.range(0));
+    const int num_correlators = static_cast<int>(state.range(1));
+
+    const auto sig_in = random_complex_vector(num_points);
+    const auto code = random_float_vector(code_length_chips);
+    auto shifts = correlator_shifts(num_correlators);
+    volk_gnsssdr::vector<std::complex<float>> result(num_correlators);
+    const lv_32fc_t phase_inc = lv_cmake(std::cos(0.001F), std::sin(0.001F));
+    lv_32fc_t phase[1] = {lv_cmake(1.0F, 0.0F)};
+
+    for (auto _ : state)
+        {
+            volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn(result.data(), sig_in.data(), phase_inc, phase, code.data(), rem_code_phase_chips, code_phase_step_chips, shifts.data(), code_length_chips, num_correlators, num_points);
+            benchmark::DoNotOptimize(result.data());
+        }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * num_points);
+}
+
+
+void bm_16ic_x2_rotator_dot_prod_xn(benchmark::State& state)
+{
+    const auto num_points = static_cast<unsigned int>(state.range(0));
+    const int num_correlators = static_cast<int>(state.range(1));
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int16_t> dist(-512, 511);
+    volk_gnsssdr::vector<lv_16sc_t> sig_in(num_points);
+    for (auto& v : sig_in)
+        {
+            v = lv_cmake(dist(gen), dist(gen));
+        }
+    std::vector<volk_gnsssdr::vector<lv_16sc_t>> codes(num_correlators, sig_in);
+    std::vector<const lv_16sc_t*> code_ptrs(num_correlators);
+    for (int i = 0; i < num_correlators; i++)
+        {
+            code_ptrs[i] = codes[i].data();
+        }
+    volk_gnsssdr::vector<lv_16sc_t> result(num_correlators);
+    const lv_32fc_t phase_inc = lv_cmake(std::cos(0.001F), std::sin(0.001F));
+    lv_32fc_t phase[1] = {lv_cmake(1.0F, 0.0F)};
+
+    for (auto _ : state)
+        {
+            volk_gnsssdr_16ic_x2_rotator_dot_prod_16ic_xn(result.data(), sig_in.data(), phase_inc, phase, code_ptrs.data(), num_correlators, num_points);
+            benchmark::DoNotOptimize(result.data());
+        }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * num_points);
+}
+
+
+void bm_s32f_sincos(benchmark::State& state)
+{
+    const auto num_points = static_cast<unsigned int>(state.range(0));
+    volk_gnsssdr::vector<std::complex<float>> carrier(num_points);
+    float phase[1] = {0.0F};
+
+    for (auto _ : state)
+        {
+            volk_gnsssdr_s32f_sincos_32fc(carrier.data(), -0.2F, phase, num_points);
+            benchmark::DoNotOptimize(carrier.data());
+        }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * num_points);
+}
+
+
+void bm_32f_index_max(benchmark::State& state)
+{
+    const auto num_points = static_cast<unsigned int>(state.range(0));
+    const auto magnitude = random_float_vector(num_points);
+    uint32_t index = 0;
+
+    for (auto _ : state)
+        {
+            volk_gnsssdr_32f_index_max_32u(&index, magnitude.data(), num_points);
+            benchmark::DoNotOptimize(index);
+        }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * num_points);
+}
+
+
+void bm_32f_index_max_stats(benchmark::State& state)
+{
+    const auto num_points = static_cast<unsigned int>(state.range(0));
+    const auto magnitude = random_float_vector(num_points);
+    uint32_t index = 0;
+    float max_value = 0.0F;
+    float sum = 0.0F;
+    float sum_sq = 0.0F;
+
+    for (auto _ : state)
+        {
+            volk_gnsssdr_32f_index_max_stats_32u(&index, &max_value, &sum, &sum_sq, magnitude.data(), num_points);
+            benchmark::DoNotOptimize(index);
+        }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * num_points);
+}
+
+
+// 1 ms to 20 ms of signal at 2.046 Msps, with 3, 5 and 7 correlators
+BENCHMARK(bm_32fc_32f_rotator_dot_prod_xn)->ArgsProduct({{2046, 10230, 20460, 40920}, {3, 5, 7}});
+BENCHMARK(bm_32fc_32f_rotator_dot_prod_xn_generic)->ArgsProduct({{2046, 10230, 20460, 40920}, {3, 5, 7}});
+BENCHMARK(bm_32f_xn_resampler)->ArgsProduct({{2046, 10230, 20460, 40920}, {3, 5, 7}});
+BENCHMARK(bm_32f_xn_resampler_generic)->ArgsProduct({{2046, 10230, 20460, 40920}, {3, 5, 7}});
+BENCHMARK(bm_32fc_32f_rotator_resampler_dot_prod_xn)->ArgsProduct({{2046, 10230, 20460, 40920}, {3, 5, 7}});
+BENCHMARK(bm_16ic_x2_rotator_dot_prod_xn)->ArgsProduct({{2046, 10230, 20460, 40920}, {3, 5, 7}});
+BENCHMARK(bm_s32f_sincos)->Arg(2046)->Arg(10230)->Arg(40920);
+BENCHMARK(bm_32f_index_max)->Arg(2046)->Arg(10230)->Arg(40920);
+BENCHMARK(bm_32f_index_max_stats)->Arg(2046)->Arg(10230)->Arg(40920);
+
+BENCHMARK_MAIN();
@@ -54,6 +54,9 @@ DECLARE_string(log_dir);
 #include "unit-tests/arithmetic/magnitude_squared_test.cc"
 #include "unit-tests/arithmetic/multiply_test.cc"
 #include "unit-tests/arithmetic/preamble_correlator_test.cc"
+#include "unit-tests/control-plane/config_snapshot_test.cc"
+#include "unit-tests/control-plane/event_pool_test.cc"
+#include "unit-tests/control-plane/galileo_tow_map_test.cc"
 #include "unit-tests/control-plane/in_memory_configuration_test.cc"
 #include "unit-tests/control-plane/protobuf_test.cc"
 #include "unit-tests/control-plane/string_converter_test.cc"
@@ -71,7 +74,10 @@ DECLARE_string(log_dir);
 #include "unit-tests/signal-processing-blocks/acquisition/gps_l1_ca_pcps_tong_acquisition_gsoc2013_test.cc"
 #include "unit-tests/signal-processing-blocks/adapter/adapter_test.cc"
 #include "unit-tests/signal-processing-blocks/adapter/pass_through_test.cc"
+#include "unit-tests/signal-processing-blocks/libs/event_log_test.cc"
 #include "unit-tests/signal-processing-blocks/libs/item_type_helpers_test.cc"
+#include "unit-tests/signal-processing-blocks/libs/streaming_mat_writer_test.cc"
+#include "unit-tests/signal-processing-blocks/pvt/fixed_width_string_test.cc"
 #include "unit-tests/signal-processing-blocks/pvt/geohash_test.cc"
 #include "unit-tests/signal-processing-blocks/pvt/nmea_printer_test.cc"
 #include "unit-tests/signal-processing-blocks/pvt/rinex_printer_test.cc"
@@ -118,6 +124,10 @@ DECLARE_string(log_dir);
 #include "unit-tests/signal-processing-blocks/acquisition/gps_l1_ca_pcps_opencl_acquisition_gsoc2013_test.cc"
 #endif
 
+#if LZ4_BLOCKS_TEST
+#include "unit-tests/signal-processing-blocks/sources/lz4_capture_test.cc"
+#endif
+
 #include "unit-tests/signal-processing-blocks/tracking/bayesian_estimation_test.cc"
 #if ARMADILLO_HAVE_MVNRND
 #include "unit-tests/signal-processing-blocks/tracking/cubature_filter_test.cc"
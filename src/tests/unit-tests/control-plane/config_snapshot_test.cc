@@ -0,0 +1,122 @@
+/*!
+ * \file config_snapshot_test.cc
+ * \brief Implements Unit Tests for the Config_Snapshot class.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "config_snapshot.h"
+#include "gnss_sdr_filesystem.h"
+#include <fstream>
+#include <map>
+#include <string>
+
+namespace config_snapshot_test
+{
+void write_source_file(const std::string& filename, const std::string& content)
+{
+    std::ofstream file(filename, std::ios::out | std::ios::trunc);
+    file << content;
+}
+
+std::map<std::string, std::string> sample_values()
+{
+    return {
+        {"GNSS-SDR.internal_fs_sps", "4000000"},
+        {"SignalSource.implementation", "File_Signal_Source"},
+        {"SignalSource.filename", "/data/capture.dat"},
+        {"Channels_1C.count", "8"},
+        {"PVT.flag_rtcm_server", "false"},
+        {"Tracking_1C.extend_correlation_symbols", ""}};  // empty value
+}
+
+void cleanup(const std::string& snapshot, const std::string& source)
+{
+    errorlib::error_code ec;
+    fs::remove(fs::path(snapshot), ec);
+    fs::remove(fs::path(source), ec);
+}
+}  // namespace config_snapshot_test
+
+
+TEST(ConfigSnapshotTest, SaveAndLoadRoundTrip)
+{
+    const std::string source = "./config_snapshot_test_source.conf";
+    const std::string snapshot = "./config_snapshot_test.bin";
+    config_snapshot_test::write_source_file(source, "[GNSS-SDR]\nGNSS-SDR.internal_fs_sps=4000000\n");
+    const auto values = config_snapshot_test::sample_values();
+
+    std::map<std::string, std::string> loaded;
+    EXPECT_FALSE(Config_Snapshot::load(snapshot, source, loaded));  // no image yet
+    ASSERT_TRUE(Config_Snapshot::save(snapshot, source, values));
+    ASSERT_TRUE(Config_Snapshot::load(snapshot, source, loaded));
+    EXPECT_EQ(loaded, values);
+
+    config_snapshot_test::cleanup(snapshot, source);
+}
+
+
+TEST(ConfigSnapshotTest, RejectsCorruptedPayload)
+{
+    const std::string source = "./config_snapshot_test_source.conf";
+    const std::string snapshot = "./config_snapshot_test.bin";
+    config_snapshot_test::write_source_file(source, "[GNSS-SDR]\nGNSS-SDR.internal_fs_sps=4000000\n");
+    ASSERT_TRUE(Config_Snapshot::save(snapshot, source, config_snapshot_test::sample_values()));
+
+    // flip one byte inside the payload; the FNV-1a checksum must catch it
+    errorlib::error_code ec;
+    const auto image_size = static_cast<std::streamoff>(fs::file_size(fs::path(snapshot), ec));
+    std::fstream image(snapshot, std::ios::in | std::ios::out | std::ios::binary);
+    ASSERT_TRUE(image.is_open());
+    image.seekg(image_size - 5);
+    char byte = 0;
+    image.read(&byte, 1);
+    byte = static_cast<char>(byte ^ 0x5A);
+    image.seekp(image_size - 5);
+    image.write(&byte, 1);
+    image.close();
+
+    std::map<std::string, std::string> loaded;
+    EXPECT_FALSE(Config_Snapshot::load(snapshot, source, loaded));
+    EXPECT_TRUE(loaded.empty());
+
+    // a truncated image must be rejected as well
+    ASSERT_TRUE(Config_Snapshot::save(snapshot, source, config_snapshot_test::sample_values()));
+    fs::resize_file(fs::path(snapshot), static_cast<uintmax_t>(image_size) - 7, ec);
+    EXPECT_FALSE(Config_Snapshot::load(snapshot, source, loaded));
+    EXPECT_TRUE(loaded.empty());
+
+    config_snapshot_test::cleanup(snapshot, source);
+}
+
+
+TEST(ConfigSnapshotTest, StaleWhenSourceChanges)
+{
+    const std::string source = "./config_snapshot_test_source.conf";
+    const std::string snapshot = "./config_snapshot_test.bin";
+    config_snapshot_test::write_source_file(source, "[GNSS-SDR]\nGNSS-SDR.internal_fs_sps=4000000\n");
+    ASSERT_TRUE(Config_Snapshot::save(snapshot, source, config_snapshot_test::sample_values()));
+
+    // editing the source file changes its size, so the image is stale and
+    // the caller falls back to a regular parse
+    config_snapshot_test::write_source_file(source, "[GNSS-SDR]\nGNSS-SDR.internal_fs_sps=2600000\n; edited\n");
+    std::map<std::string, std::string> loaded;
+    EXPECT_FALSE(Config_Snapshot::load(snapshot, source, loaded));
+    EXPECT_TRUE(loaded.empty());
+
+    // saving again against the edited source makes it valid once more
+    ASSERT_TRUE(Config_Snapshot::save(snapshot, source, config_snapshot_test::sample_values()));
+    ASSERT_TRUE(Config_Snapshot::load(snapshot, source, loaded));
+    EXPECT_EQ(loaded, config_snapshot_test::sample_values());
+
+    config_snapshot_test::cleanup(snapshot, source);
+}
@@ -248,3 +248,52 @@ TEST_F(ItemTypeHelpersTest, CheckConversionsComplex)
     converter(float_array_out.data(), float_array_in.data(), N);
     EXPECT_TRUE(std::equal(float_array_in.begin(), float_array_in.begin() + N, float_array_out.begin()));
 }
+
+
+TEST_F(ItemTypeHelpersTest, CheckScalingConverters)
+{
+    std::string input_type = "byte";
+    std::string output_type = "float";
+    item_type_converter_t converter = make_vector_scaling_converter(input_type, output_type, 2.0F);
+    EXPECT_NE(converter, nullptr);
+    converter(float_array_out.data(), byte_array_in.data(), N);
+    for (size_t i = 0; i < N; ++i)
+        {
+            EXPECT_FLOAT_EQ(float_array_out[i], 2.0F * byte_array_in[i]);
+        }
+
+    input_type = "float";
+    output_type = "float";
+    converter = make_vector_scaling_converter(input_type, output_type, 0.5F);
+    EXPECT_NE(converter, nullptr);
+    converter(float_array_out.data(), float_array_out.data(), N);
+    for (size_t i = 0; i < N; ++i)
+        {
+            EXPECT_FLOAT_EQ(float_array_out[i], static_cast<float>(byte_array_in[i]));
+        }
+
+    // A scaled round trip with reciprocal factors recovers the input
+    input_type = "byte";
+    output_type = "float";
+    converter = make_vector_scaling_converter(input_type, output_type, 4.0F);
+    EXPECT_NE(converter, nullptr);
+    converter(float_array_out.data(), byte_array_in.data(), N);
+    converter = make_vector_scaling_converter(output_type, input_type, 0.25F);
+    EXPECT_NE(converter, nullptr);
+    converter(byte_array_out.data(), float_array_out.data(), N);
+    EXPECT_TRUE(std::equal(byte_array_out.begin(), byte_array_out.begin() + N, byte_array_in.begin()));
+
+    input_type = "cshort";
+    output_type = "gr_complex";
+    converter = make_vector_scaling_converter(input_type, output_type, 2.0F);
+    EXPECT_NE(converter, nullptr);
+    converter(float_array_out.data(), short_array_in.data(), N);
+    for (size_t i = 0; i < 2 * N; ++i)
+        {
+            EXPECT_FLOAT_EQ(float_array_out[i], 2.0F * short_array_in[i]);
+        }
+
+    // Integer-to-integer combinations have no fused kernel
+    EXPECT_THROW(converter = make_vector_scaling_converter("byte", "short", 2.0F), std::runtime_error);
+    EXPECT_THROW(converter = make_vector_scaling_converter("cbyte", "cshort", 2.0F), std::runtime_error);
+}
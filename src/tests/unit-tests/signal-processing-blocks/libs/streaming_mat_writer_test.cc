@@ -0,0 +1,129 @@
+/*!
+ * \file streaming_mat_writer_test.cc
+ * \brief Implements Unit Tests for the Streaming_Mat_Writer class, reading
+ * the produced files back with matio.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_filesystem.h"
+#include "streaming_mat_writer.h"
+#include <matio.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace streaming_mat_writer_test
+{
+template <typename T>
+void expect_variable(mat_t *matfp, const char *name, matio_classes expected_class, size_t rows, size_t cols, const std::vector<T> &expected)
+{
+    matvar_t *matvar = Mat_VarRead(matfp, name);
+    ASSERT_NE(matvar, nullptr) << "Variable " << name << " not found";
+    EXPECT_EQ(matvar->class_type, expected_class) << "Wrong class for " << name;
+    ASSERT_EQ(matvar->rank, 2) << "Wrong rank for " << name;
+    EXPECT_EQ(matvar->dims[0], rows) << "Wrong number of rows for " << name;
+    EXPECT_EQ(matvar->dims[1], cols) << "Wrong number of columns for " << name;
+    const T *data = reinterpret_cast<const T *>(matvar->data);
+    ASSERT_NE(data, nullptr);
+    for (size_t i = 0; i < expected.size(); i++)
+        {
+            EXPECT_EQ(data[i], expected[i]) << "Mismatch in " << name << " at element " << i;
+        }
+    Mat_VarFree(matvar);
+}
+}  // namespace streaming_mat_writer_test
+
+
+TEST(StreamingMatWriterTest, StreamedVariablesReadBackWithMatio)
+{
+    const std::string filename = "./streaming_mat_writer_test.mat";
+    Streaming_Mat_Writer writer;
+    ASSERT_TRUE(writer.open(filename));
+
+    // first variable: appended in uneven chunks, so the column count and
+    // the miMATRIX / data-tag sizes are only known when it is closed
+    std::vector<double> var_a(3 * 6);
+    for (size_t i = 0; i < var_a.size(); i++)
+        {
+            var_a[i] = 0.5 * static_cast<double>(i) - 4.0;
+        }
+    ASSERT_TRUE(writer.begin_variable("a", Streaming_Mat_Writer::Mat_Type::mat_double, 3));
+    ASSERT_TRUE(writer.append(var_a.data(), 3 * 4));
+    ASSERT_TRUE(writer.append(var_a.data() + 3 * 4, 3 * 2));
+    ASSERT_TRUE(writer.end_variable());
+
+    // second variable: single row and an odd element count, so the 8-byte
+    // alignment padding before the next element is exercised
+    std::vector<float> var_b = {1.0F, -2.5F, 3.25F, -4.125F, 5.0F};
+    ASSERT_TRUE(writer.begin_variable("b", Streaming_Mat_Writer::Mat_Type::mat_single, 1));
+    ASSERT_TRUE(writer.append(var_b.data(), var_b.size()));
+    ASSERT_TRUE(writer.end_variable());
+    writer.close();
+
+    mat_t *matfp = Mat_Open(filename.c_str(), MAT_ACC_RDONLY);
+    ASSERT_NE(matfp, nullptr) << "matio cannot open the written file";
+    streaming_mat_writer_test::expect_variable<double>(matfp, "a", MAT_C_DOUBLE, 3, 6, var_a);
+    streaming_mat_writer_test::expect_variable<float>(matfp, "b", MAT_C_SINGLE, 1, 5, var_b);
+    Mat_Close(matfp);
+
+    errorlib::error_code ec;
+    fs::remove(fs::path(filename), ec);
+}
+
+
+TEST(StreamingMatWriterTest, AllTypesRoundTrip)
+{
+    const std::string filename = "./streaming_mat_writer_types_test.mat";
+    Streaming_Mat_Writer writer;
+    ASSERT_TRUE(writer.open(filename));
+
+    const std::vector<int8_t> v_int8 = {-3, -2, -1, 0, 1, 2};
+    const std::vector<uint8_t> v_uint8 = {0, 1, 2, 253, 254, 255};
+    const std::vector<int16_t> v_int16 = {-300, -200, -100, 100, 200, 300};
+    const std::vector<uint16_t> v_uint16 = {0, 1, 2, 65533, 65534, 65535};
+    const std::vector<int32_t> v_int32 = {-70000, -1, 0, 1, 70000, 80000};
+    const std::vector<uint32_t> v_uint32 = {0U, 1U, 2U, 3U, 4U, 4294967295U};
+    const std::vector<float> v_single = {-1.5F, -0.5F, 0.0F, 0.5F, 1.5F, 2.5F};
+    const std::vector<int64_t> v_int64 = {-5000000000LL, -1LL, 0LL, 1LL, 5000000000LL, 6000000000LL};
+    const std::vector<uint64_t> v_uint64 = {0ULL, 1ULL, 2ULL, 3ULL, 4ULL, 10000000000ULL};
+    const std::vector<double> v_double = {-1.25, -0.25, 0.0, 0.25, 1.25, 2.25};
+
+    ASSERT_TRUE(writer.write_variable("t_int8", Streaming_Mat_Writer::Mat_Type::mat_int8, 2, v_int8.data(), v_int8.size()));
+    ASSERT_TRUE(writer.write_variable("t_uint8", Streaming_Mat_Writer::Mat_Type::mat_uint8, 2, v_uint8.data(), v_uint8.size()));
+    ASSERT_TRUE(writer.write_variable("t_int16", Streaming_Mat_Writer::Mat_Type::mat_int16, 2, v_int16.data(), v_int16.size()));
+    ASSERT_TRUE(writer.write_variable("t_uint16", Streaming_Mat_Writer::Mat_Type::mat_uint16, 2, v_uint16.data(), v_uint16.size()));
+    ASSERT_TRUE(writer.write_variable("t_int32", Streaming_Mat_Writer::Mat_Type::mat_int32, 2, v_int32.data(), v_int32.size()));
+    ASSERT_TRUE(writer.write_variable("t_uint32", Streaming_Mat_Writer::Mat_Type::mat_uint32, 2, v_uint32.data(), v_uint32.size()));
+    ASSERT_TRUE(writer.write_variable("t_single", Streaming_Mat_Writer::Mat_Type::mat_single, 2, v_single.data(), v_single.size()));
+    ASSERT_TRUE(writer.write_variable("t_int64", Streaming_Mat_Writer::Mat_Type::mat_int64, 2, v_int64.data(), v_int64.size()));
+    ASSERT_TRUE(writer.write_variable("t_uint64", Streaming_Mat_Writer::Mat_Type::mat_uint64, 2, v_uint64.data(), v_uint64.size()));
+    ASSERT_TRUE(writer.write_variable("t_double", Streaming_Mat_Writer::Mat_Type::mat_double, 2, v_double.data(), v_double.size()));
+    writer.close();
+
+    mat_t *matfp = Mat_Open(filename.c_str(), MAT_ACC_RDONLY);
+    ASSERT_NE(matfp, nullptr) << "matio cannot open the written file";
+    streaming_mat_writer_test::expect_variable<int8_t>(matfp, "t_int8", MAT_C_INT8, 2, 3, v_int8);
+    streaming_mat_writer_test::expect_variable<uint8_t>(matfp, "t_uint8", MAT_C_UINT8, 2, 3, v_uint8);
+    streaming_mat_writer_test::expect_variable<int16_t>(matfp, "t_int16", MAT_C_INT16, 2, 3, v_int16);
+    streaming_mat_writer_test::expect_variable<uint16_t>(matfp, "t_uint16", MAT_C_UINT16, 2, 3, v_uint16);
+    streaming_mat_writer_test::expect_variable<int32_t>(matfp, "t_int32", MAT_C_INT32, 2, 3, v_int32);
+    streaming_mat_writer_test::expect_variable<uint32_t>(matfp, "t_uint32", MAT_C_UINT32, 2, 3, v_uint32);
+    streaming_mat_writer_test::expect_variable<float>(matfp, "t_single", MAT_C_SINGLE, 2, 3, v_single);
+    streaming_mat_writer_test::expect_variable<int64_t>(matfp, "t_int64", MAT_C_INT64, 2, 3, v_int64);
+    streaming_mat_writer_test::expect_variable<uint64_t>(matfp, "t_uint64", MAT_C_UINT64, 2, 3, v_uint64);
+    streaming_mat_writer_test::expect_variable<double>(matfp, "t_double", MAT_C_DOUBLE, 2, 3, v_double);
+    Mat_Close(matfp);
+
+    errorlib::error_code ec;
+    fs::remove(fs::path(filename), ec);
+}
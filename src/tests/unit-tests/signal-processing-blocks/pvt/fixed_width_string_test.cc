@@ -0,0 +1,134 @@
+/*!
+ * \file fixed_width_string_test.cc
+ * \brief Implements Unit Tests for the Rinex_Printer::fixedWidthString method.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rinex_printer.h"
+#include <cmath>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace fixed_width_string_test
+{
+// independent reimplementation of the legacy formatting path,
+// rightJustify(asString(x, precision), width), used as the oracle
+std::string legacy_fixed_width(double x, int width, int precision)
+{
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(precision) << x;
+    std::string s = ss.str();
+    const auto length = static_cast<std::string::size_type>(width);
+    if (length < s.length())
+        {
+            return s.substr(s.length() - length, std::string::npos);
+        }
+    return std::string(length - s.length(), ' ') + s;
+}
+}  // namespace fixed_width_string_test
+
+
+TEST(FixedWidthStringTest, RandomizedSweepMatchesLegacyPath)
+{
+    Rinex_Printer rp;
+    std::mt19937 gen(0x1517);  // fixed seed, so failures are reproducible
+    std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent(-6, 12);
+    std::uniform_int_distribution<int> width(1, 20);
+    std::uniform_int_distribution<int> precision(0, 9);
+    for (int i = 0; i < 100000; i++)
+        {
+            const double x = mantissa(gen) * std::pow(10.0, exponent(gen));
+            const int w = width(gen);
+            const int p = precision(gen);
+            EXPECT_EQ(fixed_width_string_test::legacy_fixed_width(x, w, p), rp.fixedWidthString(x, w, p))
+                << "x=" << std::setprecision(17) << x << " width=" << w << " precision=" << p;
+        }
+}
+
+
+TEST(FixedWidthStringTest, FractionalCarryAtRounding)
+{
+    Rinex_Printer rp;
+    // fractional parts that round up to the next integer must carry into
+    // the integer digits, including across a widening of the field
+    const double values[] = {0.9999999995, 9.9999999, 99.99999999, -0.9999999995, -9.9999999, 1.0 - 1e-13, 123456.99999999};
+    for (const double x : values)
+        {
+            for (int p = 0; p <= 9; p++)
+                {
+                    for (int w = 1; w <= 16; w++)
+                        {
+                            EXPECT_EQ(fixed_width_string_test::legacy_fixed_width(x, w, p), rp.fixedWidthString(x, w, p))
+                                << "x=" << std::setprecision(17) << x << " width=" << w << " precision=" << p;
+                        }
+                }
+        }
+}
+
+
+TEST(FixedWidthStringTest, ExactlyRepresentableTiesRoundToEven)
+{
+    Rinex_Printer rp;
+    // dyadic values whose scaled fraction is an exact halfway case; the
+    // stringstream path rounds them to even, and the integer path must agree
+    const double values[] = {0.5, 1.5, 2.5, -0.5, -2.5, 0.25, -0.25, 0.0625, 2.0625};
+    for (const double x : values)
+        {
+            for (int p = 0; p <= 4; p++)
+                {
+                    EXPECT_EQ(fixed_width_string_test::legacy_fixed_width(x, 14, p), rp.fixedWidthString(x, 14, p))
+                        << "x=" << std::setprecision(17) << x << " precision=" << p;
+                }
+        }
+}
+
+
+TEST(FixedWidthStringTest, RangeGuardFallsBackToLegacyPath)
+{
+    Rinex_Printer rp;
+    // values at and beyond the 9.0e15 integer-safe guard take the
+    // stringstream fallback, so both paths must stay identical there
+    for (int p = 0; p <= 9; p++)
+        {
+            const double limit = 9.0e15 / std::pow(10.0, p);
+            const double values[] = {limit * (1.0 - 1e-12), limit, limit * (1.0 + 1e-12), -limit, 1.0e16, -1.0e16};
+            for (const double x : values)
+                {
+                    EXPECT_EQ(fixed_width_string_test::legacy_fixed_width(x, 20, p), rp.fixedWidthString(x, 20, p))
+                        << "x=" << std::setprecision(17) << x << " precision=" << p;
+                }
+        }
+}
+
+
+TEST(FixedWidthStringTest, NegativesNearZero)
+{
+    Rinex_Printer rp;
+    // negative values that round to zero keep the minus sign in the
+    // stringstream path; negative zero included
+    const double values[] = {-0.0, -1.0e-12, -0.0001, -0.0004999, 1.0e-12, 0.0};
+    for (const double x : values)
+        {
+            for (int p = 0; p <= 6; p++)
+                {
+                    for (int w = 1; w <= 14; w++)
+                        {
+                            EXPECT_EQ(fixed_width_string_test::legacy_fixed_width(x, w, p), rp.fixedWidthString(x, w, p))
+                                << "x=" << std::setprecision(17) << x << " width=" << w << " precision=" << p;
+                        }
+                }
+        }
+}
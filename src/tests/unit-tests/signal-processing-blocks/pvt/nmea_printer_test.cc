@@ -18,6 +18,7 @@
 #include "gnss_sdr_filesystem.h"
 #include "nmea_printer.h"
 #include "pvt_conf.h"
+#include "pvt_solution_snapshot.h"
 #include "rtklib_rtkpos.h"
 #include "rtklib_solver.h"
 #include <fstream>
@@ -168,7 +169,8 @@ TEST_F(NmeaPrinterTest, PrintLine)
     bool flag_nmea_output_file = true;
     ASSERT_NO_THROW({
         std::shared_ptr<Nmea_Printer> nmea_printer = std::make_shared<Nmea_Printer>(filename, flag_nmea_output_file, false, "");
-        nmea_printer->Print_Nmea_Line(pvt_solution.get());
+        const Pvt_Solution_Snapshot snapshot(*pvt_solution);
+        nmea_printer->Print_Nmea_Line(&snapshot);
     }) << "Failure printing NMEA messages.";
 
     std::ifstream test_file(filename);
@@ -441,9 +441,11 @@ TEST(RTKLibSolverTest, test1)
         }
     ifs.close();
 
+    Gnss_Synchro_Map gnss_observables_map(gnss_synchro_map.cbegin(), gnss_synchro_map.cend());
+
     // solve
     bool pvt_valid = false;
-    if (d_ls_pvt->get_PVT(gnss_synchro_map, false))
+    if (d_ls_pvt->get_PVT(gnss_observables_map, false))
         {
             // DEBUG MESSAGE: Display position in console output
             if (d_ls_pvt->is_valid_position())
@@ -0,0 +1,203 @@
+/*!
+ * \file lz4_capture_test.cc
+ * \brief Implements Unit Tests for the LZ4 capture container: a known
+ * stream written through Lz4DumpSink is replayed via Lz4FileSource,
+ * with skip and repeat, and the footer index is checked on disk.
+ * \author Carles Fernandez-Prades, 2026. cfernandez(at)cttc.es
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_filesystem.h"
+#include "lz4_capture_container.h"
+#include "lz4_dump_sink.h"
+#include "lz4_file_source.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace lz4_capture_test
+{
+// enough int16 items to span two full 1 MiB blocks plus a short last one
+constexpr size_t num_items = 1200000;
+
+std::vector<int16_t> reference_stream()
+{
+    std::vector<int16_t> data(num_items);
+    for (size_t i = 0; i < num_items; i++)
+        {
+            // slowly varying ramp with a fast component, so blocks differ
+            // from each other but still compress
+            data[i] = static_cast<int16_t>((i / 64) % 2048) - static_cast<int16_t>(i % 17);
+        }
+    return data;
+}
+
+// pushes the stream through the sink in uneven work() calls and destroys
+// the sink, which flushes the last block and appends the index and footer
+void write_capture(const std::string &filename, const std::vector<int16_t> &data)
+{
+    auto sink = Lz4DumpSink::make(sizeof(int16_t), filename);
+    gr_vector_void_star outputs;
+    size_t written = 0;
+    size_t chunk = 1;
+    while (written < data.size())
+        {
+            const size_t n = std::min(chunk, data.size() - written);
+            gr_vector_const_void_star inputs{data.data() + written};
+            EXPECT_EQ(sink->work(static_cast<int>(n), inputs, outputs), static_cast<int>(n));
+            written += n;
+            chunk = chunk * 3 + 1;  // 1, 4, 13, ... irregular on purpose
+        }
+}
+
+// drains the source until work() signals EOF, or up to max_items
+std::vector<int16_t> read_back(const Lz4FileSource::sptr &source, size_t max_items)
+{
+    std::vector<int16_t> out;
+    std::vector<int16_t> buf(4096);
+    gr_vector_const_void_star inputs;
+    while (out.size() < max_items)
+        {
+            gr_vector_void_star outputs{buf.data()};
+            const int n = source->work(static_cast<int>(std::min(buf.size(), max_items - out.size())), inputs, outputs);
+            if (n <= 0)
+                {
+                    break;
+                }
+            out.insert(out.end(), buf.begin(), buf.begin() + n);
+        }
+    return out;
+}
+}  // namespace lz4_capture_test
+
+
+TEST(Lz4CaptureTest, FullStreamRoundTripIsBitExact)
+{
+    const std::string filename = "./lz4_capture_roundtrip_test.dat";
+    const auto data = lz4_capture_test::reference_stream();
+    lz4_capture_test::write_capture(filename, data);
+
+    auto source = Lz4FileSource::make(filename, sizeof(int16_t), 0, false);
+    EXPECT_EQ(source->uncompressed_bytes(), data.size() * sizeof(int16_t));
+    const auto replayed = lz4_capture_test::read_back(source, data.size() + 1000);
+    ASSERT_EQ(replayed.size(), data.size());
+    EXPECT_TRUE(std::memcmp(replayed.data(), data.data(), data.size() * sizeof(int16_t)) == 0);
+
+    // a further work() call keeps signalling EOF
+    std::vector<int16_t> buf(16);
+    gr_vector_const_void_star inputs;
+    gr_vector_void_star outputs{buf.data()};
+    EXPECT_EQ(source->work(16, inputs, outputs), -1);
+
+    errorlib::error_code ec;
+    fs::remove(fs::path(filename), ec);
+}
+
+
+TEST(Lz4CaptureTest, OffsetSkipsIntoTheMiddleOfABlock)
+{
+    const std::string filename = "./lz4_capture_skip_test.dat";
+    const auto data = lz4_capture_test::reference_stream();
+    lz4_capture_test::write_capture(filename, data);
+
+    // skip lands inside the second block, not on a block boundary
+    const size_t skip_items = 750001;
+    auto source = Lz4FileSource::make(filename, sizeof(int16_t), skip_items * sizeof(int16_t), false);
+    const auto replayed = lz4_capture_test::read_back(source, data.size());
+    ASSERT_EQ(replayed.size(), data.size() - skip_items);
+    EXPECT_TRUE(std::memcmp(replayed.data(), data.data() + skip_items, replayed.size() * sizeof(int16_t)) == 0);
+
+    errorlib::error_code ec;
+    fs::remove(fs::path(filename), ec);
+}
+
+
+TEST(Lz4CaptureTest, RepeatWrapsBackToTheOffset)
+{
+    const std::string filename = "./lz4_capture_repeat_test.dat";
+    const auto data = lz4_capture_test::reference_stream();
+    lz4_capture_test::write_capture(filename, data);
+
+    const size_t skip_items = 100;
+    const size_t lap = data.size() - skip_items;
+    auto source = Lz4FileSource::make(filename, sizeof(int16_t), skip_items * sizeof(int16_t), true);
+    // one and a half laps: the second half must restart at the offset, not
+    // at the beginning of the file
+    const auto replayed = lz4_capture_test::read_back(source, lap + lap / 2);
+    ASSERT_EQ(replayed.size(), lap + lap / 2);
+    EXPECT_TRUE(std::memcmp(replayed.data(), data.data() + skip_items, lap * sizeof(int16_t)) == 0);
+    EXPECT_TRUE(std::memcmp(replayed.data() + lap, data.data() + skip_items, (lap / 2) * sizeof(int16_t)) == 0);
+
+    errorlib::error_code ec;
+    fs::remove(fs::path(filename), ec);
+}
+
+
+TEST(Lz4CaptureTest, FooterIndexMapsOffsetsToBlocks)
+{
+    const std::string filename = "./lz4_capture_index_test.dat";
+    const auto data = lz4_capture_test::reference_stream();
+    lz4_capture_test::write_capture(filename, data);
+
+    std::ifstream file(filename, std::ios::in | std::ios::binary);
+    ASSERT_TRUE(file.is_open());
+
+    lz4_capture::file_header header{};
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    EXPECT_TRUE(lz4_capture::check_magic(header.magic));
+    EXPECT_EQ(header.version, lz4_capture::format_version);
+    EXPECT_EQ(header.block_size, lz4_capture::default_block_size);
+    EXPECT_EQ(header.item_size, sizeof(int16_t));
+
+    file.seekg(0, std::ios::end);
+    const auto file_size = static_cast<uint64_t>(file.tellg());
+    lz4_capture::file_footer footer{};
+    file.seekg(file_size - sizeof(footer));
+    file.read(reinterpret_cast<char *>(&footer), sizeof(footer));
+    EXPECT_TRUE(lz4_capture::check_magic(footer.magic));
+    const uint64_t raw_bytes = data.size() * sizeof(int16_t);
+    EXPECT_EQ(footer.uncompressed_bytes, raw_bytes);
+    const uint64_t expected_blocks = (raw_bytes + header.block_size - 1) / header.block_size;
+    ASSERT_EQ(footer.n_blocks, expected_blocks);
+
+    const uint64_t index_pos = file_size - sizeof(footer) - footer.n_blocks * sizeof(uint64_t);
+    std::vector<uint64_t> offsets(footer.n_blocks);
+    file.seekg(index_pos);
+    file.read(reinterpret_cast<char *>(offsets.data()), offsets.size() * sizeof(uint64_t));
+    ASSERT_TRUE(file.good());
+
+    // walking the [u32 len | block] chain from each indexed offset must land
+    // exactly on the next one, and the last block must end where the index
+    // begins: the index is gap-free, so byte N of the raw stream really does
+    // live in block N / block_size
+    EXPECT_EQ(offsets.front(), sizeof(lz4_capture::file_header));
+    uint64_t pos = offsets.front();
+    for (size_t b = 0; b < offsets.size(); b++)
+        {
+            ASSERT_EQ(offsets[b], pos) << "Index entry " << b << " does not match the block chain";
+            uint32_t compressed_len = 0;
+            file.seekg(pos);
+            file.read(reinterpret_cast<char *>(&compressed_len), sizeof(compressed_len));
+            ASSERT_TRUE(file.good());
+            ASSERT_GT(compressed_len, 0U);
+            pos += sizeof(compressed_len) + compressed_len;
+        }
+    EXPECT_EQ(pos, index_pos);
+    file.close();
+
+    errorlib::error_code ec;
+    fs::remove(fs::path(filename), ec);
+}
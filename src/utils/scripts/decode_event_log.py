@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+# Decoder for the GNSS-SDR binary event log (GNSS-SDR.event_log_filename).
+#
+# Prints one CSV line per event with the wall-clock timestamp reconstructed
+# from the monotonic/wall-clock pairing stored in the file header.
+#
+# Usage: ./decode_event_log.py event_log.bin
+#
+# SPDX-FileCopyrightText: 2026 Carles Fernandez-Prades <cfernandez(at)cttc.es>
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+import struct
+import sys
+
+EVENT_NAMES = {
+    1: "acquisition_positive",
+    2: "acquisition_negative",
+    3: "loss_of_lock",
+    4: "fsm_start_acquisition",
+    5: "fsm_valid_acquisition",
+    6: "fsm_failed_acquisition",
+    7: "fsm_failed_tracking",
+    8: "fsm_stop_channel",
+}
+
+RECORD_FORMAT = "=QIHHdd"  # timestamp_ns, event_id, channel, prn, value_a, value_b
+RECORD_SIZE = struct.calcsize(RECORD_FORMAT)
+
+
+def main():
+    if len(sys.argv) != 2:
+        print("Usage: {} event_log.bin".format(sys.argv[0]), file=sys.stderr)
+        sys.exit(1)
+
+    with open(sys.argv[1], "rb") as f:
+        header = f.read(24)
+        if len(header) < 24 or header[:8] != b"GNSSEVT1":
+            print("Not a GNSS-SDR event log file", file=sys.stderr)
+            sys.exit(1)
+        wall_ns, steady_ns = struct.unpack("=QQ", header[8:])
+
+        print("wall_time_s,elapsed_s,event,channel,prn,value_a,value_b")
+        while True:
+            chunk = f.read(RECORD_SIZE)
+            if len(chunk) < RECORD_SIZE:
+                break
+            timestamp_ns, event_id, channel, prn, value_a, value_b = struct.unpack(RECORD_FORMAT, chunk)
+            wall_time_s = (wall_ns + timestamp_ns - steady_ns) * 1e-9
+            elapsed_s = (timestamp_ns - steady_ns) * 1e-9
+            event = EVENT_NAMES.get(event_id, "event_{}".format(event_id))
+            print("{:.9f},{:.9f},{},{},{},{:.6f},{:.6f}".format(
+                wall_time_s, elapsed_s, event, channel, prn, value_a, value_b))
+
+
+if __name__ == "__main__":
+    main()